@@ -0,0 +1,286 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        batch_bench.c
+ * Description:  Scaling benchmark of the host batch runner
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.16.1
+ *
+ * Target Processor: Host (POSIX)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+  Usage: dsp_batch_bench [file] [channels] [frames]
+
+  A synthetic recording is written to file. Each channel is filtered by a FIR
+  and a biquad cascade, then goes through a statistics node and an STFT node.
+  The job is run with 1, 2, 4 ... threads up to the number of CPUs.
+  The outputs of every run are compared with the single-threaded run.
+ */
+
+/* clock_gettime is POSIX, not C99 */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "arm_math.h"
+#include "cmsis_dsp_batch.h"
+
+#define NUM_TAPS     64
+#define NUM_STAGES   4
+#define FFT_LEN      256
+#define HOP          128
+#define BLOCK_SIZE   4096
+
+static float32_t firCoeffs[NUM_TAPS];
+static float32_t biquadCoeffs[5 * NUM_STAGES];
+static float32_t window[FFT_LEN];
+
+/* Per channel checksum of the spectra. Only the worker holding a channel updates it. */
+static float64_t *specSum;
+
+static void on_frame(void *pCtx, uint32_t channel, uint32_t node, uint64_t frame,
+                     const float32_t *pMag, uint32_t numBins)
+{
+  uint32_t i;
+
+  (void)pCtx;
+  (void)node;
+  (void)frame;
+  for (i = 0U; i < numBins; i++)
+  {
+    specSum[channel] += pMag[i];
+  }
+}
+
+static float64_t now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((float64_t)ts.tv_sec + 1e-9 * (float64_t)ts.tv_nsec);
+}
+
+static int write_input(const char *path, uint32_t numChannels, uint64_t numFrames)
+{
+  float32_t frame[256];
+  uint64_t n;
+  uint32_t c;
+  uint32_t seed = 1U;
+  FILE *f = fopen(path, "wb");
+
+  if (f == NULL)
+  {
+    return (-1);
+  }
+
+  for (n = 0U; n < numFrames; n++)
+  {
+    for (c = 0U; c < numChannels; c++)
+    {
+      seed = seed * 1664525U + 1013904223U;
+      frame[c] = 0.5f * arm_sin_f32(0.001f * (float32_t)(c + 1U) * (float32_t)(n % 100000U))
+               + ((float32_t)(seed >> 8) / 16777216.0f - 0.5f) * 0.1f;
+    }
+    fwrite(frame, sizeof(float32_t), numChannels, f);
+  }
+
+  fclose(f);
+  return (0);
+}
+
+static uint64_t checksum(const char *path)
+{
+  uint8_t buf[65536];
+  uint64_t h = 1469598103934665603ULL;
+  size_t n, i;
+  FILE *f = fopen(path, "rb");
+
+  if (f == NULL)
+  {
+    return (0U);
+  }
+
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0U)
+  {
+    for (i = 0U; i < n; i++)
+    {
+      h = (h ^ buf[i]) * 1099511628211ULL;
+    }
+  }
+
+  fclose(f);
+  return (h);
+}
+
+int main(int argc, char **argv)
+{
+  const char *inPath = (argc > 1) ? argv[1] : "dsp_batch_bench.raw";
+  uint32_t numChannels = (argc > 2) ? (uint32_t)atoi(argv[2]) : 64U;
+  uint64_t numFrames = (argc > 3) ? (uint64_t)atoll(argv[3]) : 1000000U;
+  long numCpus = sysconf(_SC_NPROCESSORS_ONLN);
+  char outPath[512];
+  dsp_batch_node nodes[4];
+  dsp_batch_chain chain;
+  dsp_batch_chain *pChains;
+  dsp_batch_config cfg;
+  dsp_batch_job *pJob;
+  dsp_batch_stats stats;
+  float64_t t0, t1, base = 0.0;
+  float64_t *refSpec;
+  dsp_batch_stats *refStats;
+  uint64_t refOut = 0U, out;
+  uint32_t threads, c, i;
+  int identical;
+
+  if ((numChannels == 0U) || (numChannels > 256U))
+  {
+    fprintf(stderr, "1 to 256 channels\n");
+    return (1);
+  }
+
+  snprintf(outPath, sizeof(outPath), "%s.out", inPath);
+
+  for (i = 0U; i < NUM_TAPS; i++)
+  {
+    firCoeffs[i] = 1.0f / NUM_TAPS;
+  }
+  for (i = 0U; i < NUM_STAGES; i++)
+  {
+    biquadCoeffs[5 * i + 0] = 0.2f;
+    biquadCoeffs[5 * i + 1] = 0.4f;
+    biquadCoeffs[5 * i + 2] = 0.2f;
+    biquadCoeffs[5 * i + 3] = 0.5f;
+    biquadCoeffs[5 * i + 4] = -0.3f;
+  }
+  for (i = 0U; i < FFT_LEN; i++)
+  {
+    window[i] = 0.5f - 0.5f * arm_cos_f32(2.0f * PI * (float32_t)i / FFT_LEN);
+  }
+
+  memset(nodes, 0, sizeof(nodes));
+  nodes[0].type = DSP_BATCH_NODE_FIR;
+  nodes[0].u.fir.numTaps = NUM_TAPS;
+  nodes[0].u.fir.pCoeffs = firCoeffs;
+  nodes[1].type = DSP_BATCH_NODE_BIQUAD;
+  nodes[1].u.biquad.numStages = NUM_STAGES;
+  nodes[1].u.biquad.pCoeffs = biquadCoeffs;
+  nodes[2].type = DSP_BATCH_NODE_STATS;
+  nodes[3].type = DSP_BATCH_NODE_STFT;
+  nodes[3].u.stft.fftLen = FFT_LEN;
+  nodes[3].u.stft.hop = HOP;
+  nodes[3].u.stft.pWindow = window;
+  nodes[3].u.stft.onFrame = on_frame;
+
+  chain.numNodes = 4U;
+  chain.pNodes = nodes;
+
+  pChains = malloc(numChannels * sizeof(dsp_batch_chain));
+  specSum = calloc(numChannels, sizeof(float64_t));
+  refSpec = calloc(numChannels, sizeof(float64_t));
+  refStats = calloc(numChannels, sizeof(dsp_batch_stats));
+  if ((pChains == NULL) || (specSum == NULL) || (refSpec == NULL) || (refStats == NULL))
+  {
+    return (1);
+  }
+  for (c = 0U; c < numChannels; c++)
+  {
+    pChains[c] = chain;
+  }
+
+  if (write_input(inPath, numChannels, numFrames) != 0)
+  {
+    fprintf(stderr, "Cannot write %s\n", inPath);
+    return (1);
+  }
+
+  memset(&cfg, 0, sizeof(cfg));
+  cfg.pInPath = inPath;
+  cfg.pOutPath = outPath;
+  cfg.format = DSP_BATCH_FORMAT_F32;
+  cfg.numChannels = numChannels;
+  cfg.pChains = pChains;
+  cfg.blockSize = BLOCK_SIZE;
+
+  printf("%u channels, %llu frames\n", (unsigned)numChannels, (unsigned long long)numFrames);
+
+  numCpus = (numCpus > 0) ? numCpus : 1;
+
+  for (threads = 1U; ; threads = ((threads * 2U) < (uint32_t)numCpus) ? (threads * 2U) : (uint32_t)numCpus)
+  {
+    cfg.numThreads = threads;
+    memset(specSum, 0, numChannels * sizeof(float64_t));
+
+    if (dsp_batch_create(&pJob, &cfg) != DSP_BATCH_SUCCESS)
+    {
+      fprintf(stderr, "Cannot create the job\n");
+      return (1);
+    }
+
+    t0 = now();
+    dsp_batch_run(pJob);
+    t1 = now();
+
+    identical = 1;
+    for (c = 0U; c < numChannels; c++)
+    {
+      dsp_batch_get_stats(pJob, c, 2U, &stats);
+      if (threads == 1U)
+      {
+        refStats[c] = stats;
+        refSpec[c] = specSum[c];
+      }
+      else if ((memcmp(&refStats[c], &stats, sizeof(stats)) != 0) || (refSpec[c] != specSum[c]))
+      {
+        identical = 0;
+      }
+    }
+    dsp_batch_destroy(pJob);
+
+    out = checksum(outPath);
+    if (threads == 1U)
+    {
+      refOut = out;
+      base = t1 - t0;
+    }
+    identical = identical && (out == refOut);
+
+    printf("%3u threads: %8.3f s  speedup %5.2f  %s\n", (unsigned)threads, t1 - t0,
+           base / (t1 - t0), identical ? "identical" : "DIFFERENT");
+
+    if (threads >= (uint32_t)numCpus)
+    {
+      break;
+    }
+  }
+
+  unlink(outPath);
+  unlink(inPath);
+  free(pChains);
+  free(specSum);
+  free(refSpec);
+  free(refStats);
+
+  return (0);
+}
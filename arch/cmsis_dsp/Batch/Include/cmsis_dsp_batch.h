@@ -0,0 +1,255 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        cmsis_dsp_batch.h
+ * Description:  Public header of the host batch runner for multi-channel offline processing
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.16.1
+ *
+ * Target Processor: Host (POSIX)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CMSIS_DSP_BATCH_H_
+#define CMSIS_DSP_BATCH_H_
+
+#include "arm_math_types.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @defgroup groupBatch Host Batch Processing
+ *
+ * Host-only library running chains of CMSIS-DSP instances over large
+ * recorded multi-channel files.
+ *
+ * The input file is memory-mapped. It contains interleaved frames of
+ * <code>numChannels</code> samples in float32 or Q15 format.
+ * Each channel is processed by its own chain of nodes:
+ * - FIR and biquad nodes filter the stream,
+ * - STFT nodes compute magnitude spectra and pass the stream unchanged,
+ * - statistics nodes accumulate mean, RMS, variance, min and max and pass the stream unchanged.
+ *
+ * The output of the last filtering node of each channel is optionally written
+ * to an output file as interleaved float32 frames.
+ *
+ * @par Scheduling
+ * A task is the processing of one block of <code>blockSize</code> samples of one channel.
+ * Tasks are run by a pool of worker threads with one deque per worker. A worker continues
+ * the channel it is processing and idle workers steal the channels not yet processed.
+ * Parallelism is across channels: at most <code>numChannels</code> workers are busy at a time.
+ * The speedup has not been measured; Examples/batch_bench.c reports it for the host it runs on.
+ *
+ * @par Determinism
+ * A channel is held by a single worker at a time and its blocks are processed in order.
+ * The block boundaries do not depend on the number of threads, so the results are
+ * identical whatever the number of threads.
+ * The state of the DSP instances belongs to the channel. The temporary buffers
+ * belong to the worker thread.
+ */
+
+/**
+ * @addtogroup groupBatch
+ * @{
+ */
+
+/**
+ * @brief Error status returned by the batch functions.
+ */
+typedef enum
+{
+  DSP_BATCH_SUCCESS        =  0,        /**< No error */
+  DSP_BATCH_ARGUMENT_ERROR = -1,        /**< One or more arguments are incorrect */
+  DSP_BATCH_IO_ERROR       = -2,        /**< A file could not be opened or mapped */
+  DSP_BATCH_NO_MEMORY      = -3,        /**< Memory allocation failed */
+  DSP_BATCH_THREAD_ERROR   = -4         /**< A worker thread could not be created */
+} dsp_batch_status;
+
+/**
+ * @brief Sample format of the input file.
+ */
+typedef enum
+{
+  DSP_BATCH_FORMAT_F32 = 0,             /**< float32 samples */
+  DSP_BATCH_FORMAT_Q15 = 1              /**< Q15 samples, converted with arm_q15_to_float */
+} dsp_batch_format;
+
+/**
+ * @brief Type of a node of a channel chain.
+ */
+typedef enum
+{
+  DSP_BATCH_NODE_FIR    = 0,            /**< FIR filter (arm_fir_f32) */
+  DSP_BATCH_NODE_BIQUAD = 1,            /**< Biquad cascade (arm_biquad_cascade_df2T_f32) */
+  DSP_BATCH_NODE_STFT   = 2,            /**< Short-time magnitude spectrum (arm_rfft_fast_f32) */
+  DSP_BATCH_NODE_STATS  = 3             /**< Statistics */
+} dsp_batch_node_type;
+
+/**
+ * @brief STFT frame callback.
+ * @param[in] pCtx     user context of the node
+ * @param[in] channel  channel index
+ * @param[in] node     node index in the chain
+ * @param[in] frame    frame index, starting at 0 for each channel
+ * @param[in] pMag     magnitude spectrum
+ * @param[in] numBins  number of bins (fftLen / 2 + 1)
+ *
+ * The callback is called from the worker threads. Calls for one channel are sequential
+ * and in frame order. Calls for different channels may be concurrent.
+ */
+typedef void (*dsp_batch_frame_cb)(
+  void * pCtx,
+  uint32_t channel,
+  uint32_t node,
+  uint64_t frame,
+  const float32_t * pMag,
+  uint32_t numBins);
+
+/**
+ * @brief Description of a node of a channel chain.
+ */
+typedef struct
+{
+  dsp_batch_node_type type;             /**< Type of the node */
+  union
+  {
+    struct
+    {
+      uint16_t numTaps;                 /**< Number of filter coefficients */
+      const float32_t *pCoeffs;         /**< Coefficients in time reversed order */
+    } fir;
+    struct
+    {
+      uint8_t numStages;                /**< Number of 2nd order stages */
+      const float32_t *pCoeffs;         /**< Coefficients, 5 per stage */
+    } biquad;
+    struct
+    {
+      uint16_t fftLen;                  /**< RFFT length */
+      uint16_t hop;                     /**< Number of samples between frames (1 to fftLen) */
+      const float32_t *pWindow;         /**< Analysis window of length fftLen, or NULL */
+      dsp_batch_frame_cb onFrame;       /**< Called for each frame */
+      void *pCtx;                       /**< User context given to onFrame */
+    } stft;
+  } u;
+} dsp_batch_node;
+
+/**
+ * @brief Chain of nodes processing one channel.
+ */
+typedef struct
+{
+  uint32_t numNodes;                    /**< Number of nodes */
+  const dsp_batch_node *pNodes;         /**< Nodes in processing order */
+} dsp_batch_chain;
+
+/**
+ * @brief Configuration of a batch job.
+ */
+typedef struct
+{
+  const char *pInPath;                  /**< Input file */
+  const char *pOutPath;                 /**< Output file for the filtered streams, or NULL */
+  dsp_batch_format format;              /**< Sample format of the input file */
+  uint32_t numChannels;                 /**< Number of interleaved channels */
+  const dsp_batch_chain *pChains;       /**< One chain per channel. Chains may share nodes */
+  uint32_t blockSize;                   /**< Samples per channel in a task */
+  uint32_t numThreads;                  /**< Number of worker threads, 0 for the number of online CPUs */
+} dsp_batch_config;
+
+/**
+ * @brief Statistics accumulated by a statistics node.
+ */
+typedef struct
+{
+  uint64_t count;                       /**< Number of samples */
+  float64_t mean;                       /**< Mean */
+  float64_t rms;                        /**< Root mean square */
+  float64_t var;                        /**< Population variance */
+  float32_t min;                        /**< Minimum */
+  float32_t max;                        /**< Maximum */
+} dsp_batch_stats;
+
+/**
+ * @brief Opaque batch job.
+ */
+typedef struct dsp_batch_job dsp_batch_job;
+
+/**
+ * @brief Create a batch job.
+ * @param[out] ppJob  created job
+ * @param[in]  pCfg   configuration. The chains and coefficients must remain valid until the job is destroyed.
+ * @return     execution status
+ *
+ * The input file is mapped and the output file is created with the size of the input
+ * number of frames.
+ */
+dsp_batch_status dsp_batch_create(
+  dsp_batch_job ** ppJob,
+  const dsp_batch_config * pCfg);
+
+/**
+ * @brief Run a batch job over the whole input file.
+ * @param[in,out] pJob  job
+ * @return        execution status
+ */
+dsp_batch_status dsp_batch_run(
+  dsp_batch_job * pJob);
+
+/**
+ * @brief Number of frames of the input file.
+ * @param[in] pJob  job
+ * @return    number of frames
+ */
+uint64_t dsp_batch_num_frames(
+  const dsp_batch_job * pJob);
+
+/**
+ * @brief Read the result of a statistics node.
+ * @param[in]  pJob     job
+ * @param[in]  channel  channel index
+ * @param[in]  node     index of a statistics node in the chain of the channel
+ * @param[out] pStats   statistics
+ * @return     execution status
+ */
+dsp_batch_status dsp_batch_get_stats(
+  const dsp_batch_job * pJob,
+  uint32_t channel,
+  uint32_t node,
+  dsp_batch_stats * pStats);
+
+/**
+ * @brief Unmap the files and free a batch job.
+ * @param[in] pJob  job
+ */
+void dsp_batch_destroy(
+  dsp_batch_job * pJob);
+
+/**
+ * @} end of groupBatch group
+ */
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* CMSIS_DSP_BATCH_H_ */
@@ -0,0 +1,603 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        cmsis_dsp_batch.c
+ * Description:  Host batch runner for multi-channel offline processing
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.16.1
+ *
+ * Target Processor: Host (POSIX)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* mmap, ftruncate and posix_madvise are POSIX, not C99 */
+#define _POSIX_C_SOURCE 200809L
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "dsp/filtering_functions.h"
+#include "dsp/statistics_functions.h"
+#include "dsp/support_functions.h"
+#include "dsp/transform_functions.h"
+#include "dsp/complex_math_functions.h"
+#include "dsp/basic_math_functions.h"
+
+#include "cmsis_dsp_batch.h"
+#include "dsp_batch_pool.h"
+
+/* State of a node for one channel */
+typedef struct
+{
+  const dsp_batch_node *pDesc;
+  union
+  {
+    arm_fir_instance_f32 fir;
+    arm_biquad_cascade_df2T_instance_f32 biquad;
+    struct
+    {
+      arm_rfft_fast_instance_f32 rfft;
+      float32_t *pHist;                 /* Last fftLen samples */
+      uint32_t fill;                    /* Number of samples in pHist */
+      uint64_t frame;                   /* Next frame index */
+    } stft;
+    struct
+    {
+      float64_t sum;
+      float64_t sumSq;
+      float32_t min;
+      float32_t max;
+      uint64_t count;
+    } stats;
+  } u;
+  float32_t *pState;                    /* Filter state or STFT history */
+} dsp_batch_node_state;
+
+/* Channel. Only the worker holding the channel task accesses it. */
+typedef struct
+{
+  dsp_batch_node_state *pNodes;
+  uint32_t numNodes;
+  uint64_t nextFrame;                   /* First frame of the next block */
+} dsp_batch_channel;
+
+/* Temporary buffers of a worker */
+typedef struct
+{
+  float32_t *pBlock;                    /* Block of the channel */
+  float32_t *pTmp;                      /* Filter output */
+  int16_t *pRaw;                        /* Gathered Q15 samples */
+  float32_t *pFftIn;                    /* 2 * max fftLen */
+  float32_t *pFftOut;
+  float32_t *pMag;
+} dsp_batch_scratch;
+
+struct dsp_batch_job
+{
+  dsp_batch_config cfg;
+  const uint8_t *pIn;
+  size_t inSize;
+  float32_t *pOut;
+  size_t outSize;
+  uint64_t numFrames;
+  dsp_batch_channel *pChannels;
+  dsp_batch_scratch *pScratch;
+  uint32_t numThreads;
+  uint16_t maxFftLen;
+};
+
+static dsp_batch_status node_init(
+  dsp_batch_node_state *pNode,
+  const dsp_batch_node *pDesc,
+  uint32_t blockSize)
+{
+  pNode->pDesc = pDesc;
+  pNode->pState = NULL;
+
+  switch (pDesc->type)
+  {
+    case DSP_BATCH_NODE_FIR:
+      if ((pDesc->u.fir.numTaps == 0U) || (pDesc->u.fir.pCoeffs == NULL))
+      {
+        return (DSP_BATCH_ARGUMENT_ERROR);
+      }
+      pNode->pState = calloc(pDesc->u.fir.numTaps + blockSize - 1U, sizeof(float32_t));
+      if (pNode->pState == NULL)
+      {
+        return (DSP_BATCH_NO_MEMORY);
+      }
+      arm_fir_init_f32(&pNode->u.fir, pDesc->u.fir.numTaps, pDesc->u.fir.pCoeffs, pNode->pState, blockSize);
+      break;
+
+    case DSP_BATCH_NODE_BIQUAD:
+      if ((pDesc->u.biquad.numStages == 0U) || (pDesc->u.biquad.pCoeffs == NULL))
+      {
+        return (DSP_BATCH_ARGUMENT_ERROR);
+      }
+      pNode->pState = calloc(2U * pDesc->u.biquad.numStages, sizeof(float32_t));
+      if (pNode->pState == NULL)
+      {
+        return (DSP_BATCH_NO_MEMORY);
+      }
+      arm_biquad_cascade_df2T_init_f32(&pNode->u.biquad, pDesc->u.biquad.numStages,
+                                       pDesc->u.biquad.pCoeffs, pNode->pState);
+      break;
+
+    case DSP_BATCH_NODE_STFT:
+      if ((pDesc->u.stft.hop == 0U) || (pDesc->u.stft.hop > pDesc->u.stft.fftLen) ||
+          (pDesc->u.stft.onFrame == NULL) ||
+          (arm_rfft_fast_init_f32(&pNode->u.stft.rfft, pDesc->u.stft.fftLen) != ARM_MATH_SUCCESS))
+      {
+        return (DSP_BATCH_ARGUMENT_ERROR);
+      }
+      pNode->pState = calloc(pDesc->u.stft.fftLen, sizeof(float32_t));
+      if (pNode->pState == NULL)
+      {
+        return (DSP_BATCH_NO_MEMORY);
+      }
+      pNode->u.stft.pHist = pNode->pState;
+      pNode->u.stft.fill = 0U;
+      pNode->u.stft.frame = 0U;
+      break;
+
+    case DSP_BATCH_NODE_STATS:
+      pNode->u.stats.sum = 0.0;
+      pNode->u.stats.sumSq = 0.0;
+      pNode->u.stats.min = F32_MAX;
+      pNode->u.stats.max = -F32_MAX;
+      pNode->u.stats.count = 0U;
+      break;
+
+    default:
+      return (DSP_BATCH_ARGUMENT_ERROR);
+  }
+
+  return (DSP_BATCH_SUCCESS);
+}
+
+/* Feed a block to an STFT node and emit the completed frames */
+static void stft_process(
+  dsp_batch_node_state *pNode,
+  const dsp_batch_scratch *pScratch,
+  uint32_t channel,
+  uint32_t node,
+  const float32_t *pSrc,
+  uint32_t blockSize)
+{
+  const dsp_batch_node *pDesc = pNode->pDesc;
+  uint32_t fftLen = pDesc->u.stft.fftLen;
+  uint32_t hop = pDesc->u.stft.hop;
+  uint32_t half = fftLen >> 1U;
+  float32_t *pHist = pNode->u.stft.pHist;
+  uint32_t n;
+
+  while (blockSize > 0U)
+  {
+    n = fftLen - pNode->u.stft.fill;
+    if (n > blockSize)
+    {
+      n = blockSize;
+    }
+
+    memcpy(pHist + pNode->u.stft.fill, pSrc, n * sizeof(float32_t));
+    pNode->u.stft.fill += n;
+    pSrc += n;
+    blockSize -= n;
+
+    if (pNode->u.stft.fill == fftLen)
+    {
+      if (pDesc->u.stft.pWindow != NULL)
+      {
+        arm_mult_f32(pHist, pDesc->u.stft.pWindow, pScratch->pFftIn, fftLen);
+      }
+      else
+      {
+        memcpy(pScratch->pFftIn, pHist, fftLen * sizeof(float32_t));
+      }
+
+      arm_rfft_fast_f32(&pNode->u.stft.rfft, pScratch->pFftIn, pScratch->pFftOut, 0);
+
+      /* DC and Nyquist bins are real and packed in the first complex value */
+      pScratch->pMag[0] = fabsf(pScratch->pFftOut[0]);
+      pScratch->pMag[half] = fabsf(pScratch->pFftOut[1]);
+      arm_cmplx_mag_f32(pScratch->pFftOut + 2, pScratch->pMag + 1, half - 1U);
+
+      pDesc->u.stft.onFrame(pDesc->u.stft.pCtx, channel, node, pNode->u.stft.frame,
+                            pScratch->pMag, half + 1U);
+      pNode->u.stft.frame++;
+
+      memmove(pHist, pHist + hop, (fftLen - hop) * sizeof(float32_t));
+      pNode->u.stft.fill = fftLen - hop;
+    }
+  }
+}
+
+static void stats_process(
+  dsp_batch_node_state *pNode,
+  const float32_t *pSrc,
+  uint32_t blockSize)
+{
+  float32_t sum, power, mn, mx;
+
+  arm_accumulate_f32(pSrc, blockSize, &sum);
+  arm_power_f32(pSrc, blockSize, &power);
+  arm_min_no_idx_f32(pSrc, blockSize, &mn);
+  arm_max_no_idx_f32(pSrc, blockSize, &mx);
+
+  pNode->u.stats.sum += (float64_t)sum;
+  pNode->u.stats.sumSq += (float64_t)power;
+  pNode->u.stats.min = (mn < pNode->u.stats.min) ? mn : pNode->u.stats.min;
+  pNode->u.stats.max = (mx > pNode->u.stats.max) ? mx : pNode->u.stats.max;
+  pNode->u.stats.count += blockSize;
+}
+
+/* Process the next block of a channel. Returns non zero while blocks remain. */
+static int32_t channel_task(void *pCtx, uint32_t worker, uint32_t channel)
+{
+  dsp_batch_job *pJob = (dsp_batch_job *)pCtx;
+  dsp_batch_channel *pChan = &pJob->pChannels[channel];
+  const dsp_batch_scratch *pScratch = &pJob->pScratch[worker];
+  uint32_t numChannels = pJob->cfg.numChannels;
+  uint64_t first = pChan->nextFrame;
+  uint32_t blockSize = pJob->cfg.blockSize;
+  float32_t *pBlock = pScratch->pBlock;
+  float32_t *pTmp = pScratch->pTmp;
+  float32_t *pSwap;
+  uint32_t i, k;
+
+  if ((pJob->numFrames - first) < blockSize)
+  {
+    blockSize = (uint32_t)(pJob->numFrames - first);
+  }
+
+  /* Gather the channel samples */
+  if (pJob->cfg.format == DSP_BATCH_FORMAT_Q15)
+  {
+    const int16_t *pIn = (const int16_t *)pJob->pIn + first * numChannels + channel;
+
+    for (i = 0U; i < blockSize; i++)
+    {
+      pScratch->pRaw[i] = pIn[(size_t)i * numChannels];
+    }
+    arm_q15_to_float(pScratch->pRaw, pBlock, blockSize);
+  }
+  else
+  {
+    const float32_t *pIn = (const float32_t *)pJob->pIn + first * numChannels + channel;
+
+    for (i = 0U; i < blockSize; i++)
+    {
+      pBlock[i] = pIn[(size_t)i * numChannels];
+    }
+  }
+
+  for (k = 0U; k < pChan->numNodes; k++)
+  {
+    dsp_batch_node_state *pNode = &pChan->pNodes[k];
+
+    switch (pNode->pDesc->type)
+    {
+      case DSP_BATCH_NODE_FIR:
+        arm_fir_f32(&pNode->u.fir, pBlock, pTmp, blockSize);
+        pSwap = pBlock; pBlock = pTmp; pTmp = pSwap;
+        break;
+
+      case DSP_BATCH_NODE_BIQUAD:
+        arm_biquad_cascade_df2T_f32(&pNode->u.biquad, pBlock, pTmp, blockSize);
+        pSwap = pBlock; pBlock = pTmp; pTmp = pSwap;
+        break;
+
+      case DSP_BATCH_NODE_STFT:
+        stft_process(pNode, pScratch, channel, k, pBlock, blockSize);
+        break;
+
+      case DSP_BATCH_NODE_STATS:
+        stats_process(pNode, pBlock, blockSize);
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  /* Scatter the filtered stream */
+  if (pJob->pOut != NULL)
+  {
+    float32_t *pOut = pJob->pOut + first * numChannels + channel;
+
+    for (i = 0U; i < blockSize; i++)
+    {
+      pOut[(size_t)i * numChannels] = pBlock[i];
+    }
+  }
+
+  pChan->nextFrame = first + blockSize;
+
+  return (pChan->nextFrame < pJob->numFrames);
+}
+
+dsp_batch_status dsp_batch_create(
+  dsp_batch_job ** ppJob,
+  const dsp_batch_config * pCfg)
+{
+  dsp_batch_job *pJob;
+  dsp_batch_status status = DSP_BATCH_SUCCESS;
+  struct stat st;
+  size_t sampleSize;
+  uint32_t c, k, t;
+  int fd;
+
+  if ((ppJob == NULL) || (pCfg == NULL) || (pCfg->pInPath == NULL) || (pCfg->pChains == NULL) ||
+      (pCfg->numChannels == 0U) || (pCfg->blockSize == 0U) ||
+      ((pCfg->format != DSP_BATCH_FORMAT_F32) && (pCfg->format != DSP_BATCH_FORMAT_Q15)))
+  {
+    return (DSP_BATCH_ARGUMENT_ERROR);
+  }
+
+  pJob = calloc(1U, sizeof(dsp_batch_job));
+  if (pJob == NULL)
+  {
+    return (DSP_BATCH_NO_MEMORY);
+  }
+  pJob->cfg = *pCfg;
+  *ppJob = pJob;
+
+  /* Map the input */
+  fd = open(pCfg->pInPath, O_RDONLY);
+  if (fd < 0)
+  {
+    dsp_batch_destroy(pJob);
+    *ppJob = NULL;
+    return (DSP_BATCH_IO_ERROR);
+  }
+  if ((fstat(fd, &st) == 0) && (st.st_size > 0))
+  {
+    pJob->inSize = (size_t)st.st_size;
+    pJob->pIn = mmap(NULL, pJob->inSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (pJob->pIn == MAP_FAILED)
+    {
+      pJob->pIn = NULL;
+      status = DSP_BATCH_IO_ERROR;
+    }
+    else
+    {
+      (void)posix_madvise((void *)pJob->pIn, pJob->inSize, POSIX_MADV_SEQUENTIAL);
+    }
+  }
+  close(fd);
+
+  sampleSize = (pCfg->format == DSP_BATCH_FORMAT_Q15) ? sizeof(int16_t) : sizeof(float32_t);
+  pJob->numFrames = pJob->inSize / (sampleSize * pCfg->numChannels);
+
+  /* Create and map the output */
+  if ((status == DSP_BATCH_SUCCESS) && (pCfg->pOutPath != NULL) && (pJob->numFrames > 0U))
+  {
+    pJob->outSize = pJob->numFrames * pCfg->numChannels * sizeof(float32_t);
+    fd = open(pCfg->pOutPath, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if ((fd < 0) || (ftruncate(fd, (off_t)pJob->outSize) != 0))
+    {
+      status = DSP_BATCH_IO_ERROR;
+    }
+    else
+    {
+      pJob->pOut = mmap(NULL, pJob->outSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+      if (pJob->pOut == MAP_FAILED)
+      {
+        pJob->pOut = NULL;
+        status = DSP_BATCH_IO_ERROR;
+      }
+    }
+    if (fd >= 0)
+    {
+      close(fd);
+    }
+  }
+
+  /* Instances of the channels */
+  if (status == DSP_BATCH_SUCCESS)
+  {
+    pJob->pChannels = calloc(pCfg->numChannels, sizeof(dsp_batch_channel));
+    if (pJob->pChannels == NULL)
+    {
+      status = DSP_BATCH_NO_MEMORY;
+    }
+  }
+
+  for (c = 0U; (status == DSP_BATCH_SUCCESS) && (c < pCfg->numChannels); c++)
+  {
+    const dsp_batch_chain *pChain = &pCfg->pChains[c];
+
+    pJob->pChannels[c].pNodes = calloc(pChain->numNodes + 1U, sizeof(dsp_batch_node_state));
+    if (pJob->pChannels[c].pNodes == NULL)
+    {
+      status = DSP_BATCH_NO_MEMORY;
+      break;
+    }
+
+    for (k = 0U; (status == DSP_BATCH_SUCCESS) && (k < pChain->numNodes); k++)
+    {
+      status = node_init(&pJob->pChannels[c].pNodes[k], &pChain->pNodes[k], pCfg->blockSize);
+      pJob->pChannels[c].numNodes = k + 1U;
+
+      if ((pChain->pNodes[k].type == DSP_BATCH_NODE_STFT) &&
+          (pChain->pNodes[k].u.stft.fftLen > pJob->maxFftLen))
+      {
+        pJob->maxFftLen = pChain->pNodes[k].u.stft.fftLen;
+      }
+    }
+  }
+
+  /* Temporary buffers of the workers */
+  if (status == DSP_BATCH_SUCCESS)
+  {
+    pJob->numThreads = pCfg->numThreads;
+    if (pJob->numThreads == 0U)
+    {
+      long n = sysconf(_SC_NPROCESSORS_ONLN);
+
+      pJob->numThreads = (n > 0) ? (uint32_t)n : 1U;
+    }
+
+    pJob->pScratch = calloc(pJob->numThreads, sizeof(dsp_batch_scratch));
+    if (pJob->pScratch == NULL)
+    {
+      status = DSP_BATCH_NO_MEMORY;
+    }
+  }
+
+  for (t = 0U; (status == DSP_BATCH_SUCCESS) && (t < pJob->numThreads); t++)
+  {
+    dsp_batch_scratch *pScratch = &pJob->pScratch[t];
+
+    pScratch->pBlock = malloc(pCfg->blockSize * sizeof(float32_t));
+    pScratch->pTmp = malloc(pCfg->blockSize * sizeof(float32_t));
+    pScratch->pRaw = malloc(pCfg->blockSize * sizeof(int16_t));
+    pScratch->pFftIn = malloc((pJob->maxFftLen + 2U) * sizeof(float32_t));
+    pScratch->pFftOut = malloc((pJob->maxFftLen + 2U) * sizeof(float32_t));
+    pScratch->pMag = malloc(((pJob->maxFftLen >> 1U) + 1U) * sizeof(float32_t));
+    if ((pScratch->pBlock == NULL) || (pScratch->pTmp == NULL) || (pScratch->pRaw == NULL) ||
+        (pScratch->pFftIn == NULL) || (pScratch->pFftOut == NULL) || (pScratch->pMag == NULL))
+    {
+      status = DSP_BATCH_NO_MEMORY;
+    }
+  }
+
+  if (status != DSP_BATCH_SUCCESS)
+  {
+    dsp_batch_destroy(pJob);
+    *ppJob = NULL;
+  }
+
+  return (status);
+}
+
+dsp_batch_status dsp_batch_run(
+  dsp_batch_job * pJob)
+{
+  if (pJob == NULL)
+  {
+    return (DSP_BATCH_ARGUMENT_ERROR);
+  }
+
+  if (pJob->numFrames == 0U)
+  {
+    return (DSP_BATCH_SUCCESS);
+  }
+
+  /* A channel is never run by two workers so extra workers would stay idle */
+  return (dsp_batch_pool_run((pJob->numThreads < pJob->cfg.numChannels) ? pJob->numThreads : pJob->cfg.numChannels,
+                             pJob->cfg.numChannels, channel_task, pJob));
+}
+
+uint64_t dsp_batch_num_frames(
+  const dsp_batch_job * pJob)
+{
+  return ((pJob != NULL) ? pJob->numFrames : 0U);
+}
+
+dsp_batch_status dsp_batch_get_stats(
+  const dsp_batch_job * pJob,
+  uint32_t channel,
+  uint32_t node,
+  dsp_batch_stats * pStats)
+{
+  const dsp_batch_node_state *pNode;
+  float64_t n;
+
+  if ((pJob == NULL) || (pStats == NULL) || (channel >= pJob->cfg.numChannels) ||
+      (node >= pJob->pChannels[channel].numNodes))
+  {
+    return (DSP_BATCH_ARGUMENT_ERROR);
+  }
+
+  pNode = &pJob->pChannels[channel].pNodes[node];
+  if (pNode->pDesc->type != DSP_BATCH_NODE_STATS)
+  {
+    return (DSP_BATCH_ARGUMENT_ERROR);
+  }
+
+  memset(pStats, 0, sizeof(dsp_batch_stats));
+  pStats->count = pNode->u.stats.count;
+  if (pStats->count > 0U)
+  {
+    n = (float64_t)pStats->count;
+    pStats->mean = pNode->u.stats.sum / n;
+    pStats->var = (pNode->u.stats.sumSq / n) - (pStats->mean * pStats->mean);
+    pStats->var = (pStats->var > 0.0) ? pStats->var : 0.0;
+    pStats->rms = sqrt(pNode->u.stats.sumSq / n);
+    pStats->min = pNode->u.stats.min;
+    pStats->max = pNode->u.stats.max;
+  }
+
+  return (DSP_BATCH_SUCCESS);
+}
+
+void dsp_batch_destroy(
+  dsp_batch_job * pJob)
+{
+  uint32_t c, k, t;
+
+  if (pJob == NULL)
+  {
+    return;
+  }
+
+  if (pJob->pChannels != NULL)
+  {
+    for (c = 0U; c < pJob->cfg.numChannels; c++)
+    {
+      for (k = 0U; k < pJob->pChannels[c].numNodes; k++)
+      {
+        free(pJob->pChannels[c].pNodes[k].pState);
+      }
+      free(pJob->pChannels[c].pNodes);
+    }
+    free(pJob->pChannels);
+  }
+
+  if (pJob->pScratch != NULL)
+  {
+    for (t = 0U; t < pJob->numThreads; t++)
+    {
+      free(pJob->pScratch[t].pBlock);
+      free(pJob->pScratch[t].pTmp);
+      free(pJob->pScratch[t].pRaw);
+      free(pJob->pScratch[t].pFftIn);
+      free(pJob->pScratch[t].pFftOut);
+      free(pJob->pScratch[t].pMag);
+    }
+    free(pJob->pScratch);
+  }
+
+  if (pJob->pOut != NULL)
+  {
+    munmap(pJob->pOut, pJob->outSize);
+  }
+
+  if (pJob->pIn != NULL)
+  {
+    munmap((void *)pJob->pIn, pJob->inSize);
+  }
+
+  free(pJob);
+}
@@ -0,0 +1,229 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        dsp_batch_pool.c
+ * Description:  Work-stealing thread pool of the host batch runner
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.16.1
+ *
+ * Target Processor: Host (POSIX)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* pthread is POSIX, not C99 */
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "dsp_batch_pool.h"
+
+/*
+  Deque of a worker.
+  The owner pushes and pops at the bottom, thieves take at the top.
+  A task is present at most once in all the deques so the capacity is numTasks.
+  Tasks last a whole block so a mutex per deque is not a bottleneck.
+ */
+typedef struct
+{
+  pthread_mutex_t lock;
+  uint32_t *pTasks;
+  uint32_t top;                         /* Index of the oldest task */
+  uint32_t count;                       /* Number of tasks */
+  uint32_t capacity;
+} dsp_batch_deque;
+
+typedef struct dsp_batch_pool dsp_batch_pool;
+
+typedef struct
+{
+  dsp_batch_pool *pPool;
+  uint32_t id;
+  pthread_t thread;
+} dsp_batch_worker;
+
+struct dsp_batch_pool
+{
+  dsp_batch_deque *pDeques;
+  dsp_batch_worker *pWorkers;
+  uint32_t numThreads;
+  dsp_batch_task_fn fn;
+  void *pCtx;
+};
+
+static void deque_push_bottom(dsp_batch_deque *pDeque, uint32_t task)
+{
+  pthread_mutex_lock(&pDeque->lock);
+  pDeque->pTasks[(pDeque->top + pDeque->count) % pDeque->capacity] = task;
+  pDeque->count++;
+  pthread_mutex_unlock(&pDeque->lock);
+}
+
+static int32_t deque_pop_bottom(dsp_batch_deque *pDeque, uint32_t *pTask)
+{
+  int32_t found = 0;
+
+  pthread_mutex_lock(&pDeque->lock);
+  if (pDeque->count > 0U)
+  {
+    pDeque->count--;
+    *pTask = pDeque->pTasks[(pDeque->top + pDeque->count) % pDeque->capacity];
+    found = 1;
+  }
+  pthread_mutex_unlock(&pDeque->lock);
+
+  return (found);
+}
+
+static int32_t deque_steal_top(dsp_batch_deque *pDeque, uint32_t *pTask)
+{
+  int32_t found = 0;
+
+  pthread_mutex_lock(&pDeque->lock);
+  if (pDeque->count > 0U)
+  {
+    *pTask = pDeque->pTasks[pDeque->top];
+    pDeque->top = (pDeque->top + 1U) % pDeque->capacity;
+    pDeque->count--;
+    found = 1;
+  }
+  pthread_mutex_unlock(&pDeque->lock);
+
+  return (found);
+}
+
+static void *worker_main(void *pArg)
+{
+  dsp_batch_worker *pWorker = (dsp_batch_worker *)pArg;
+  dsp_batch_pool *pPool = pWorker->pPool;
+  dsp_batch_deque *pOwn = &pPool->pDeques[pWorker->id];
+  uint32_t task, i;
+  int32_t found;
+
+  for (;;)
+  {
+    found = deque_pop_bottom(pOwn, &task);
+
+    /* Steal from the other workers, starting with the next one */
+    for (i = 1U; (found == 0) && (i < pPool->numThreads); i++)
+    {
+      found = deque_steal_top(&pPool->pDeques[(pWorker->id + i) % pPool->numThreads], &task);
+    }
+
+    /* All the remaining tasks are being run by other workers which
+       will continue them. There is nothing left for this worker. */
+    if (found == 0)
+    {
+      break;
+    }
+
+    if (pPool->fn(pPool->pCtx, pWorker->id, task) != 0)
+    {
+      deque_push_bottom(pOwn, task);
+    }
+  }
+
+  return (NULL);
+}
+
+dsp_batch_status dsp_batch_pool_run(
+  uint32_t numThreads,
+  uint32_t numTasks,
+  dsp_batch_task_fn fn,
+  void * pCtx)
+{
+  dsp_batch_pool pool;
+  dsp_batch_status status = DSP_BATCH_SUCCESS;
+  uint32_t i, started = 0U;
+
+  if ((numThreads == 0U) || (fn == NULL))
+  {
+    return (DSP_BATCH_ARGUMENT_ERROR);
+  }
+
+  if (numTasks == 0U)
+  {
+    return (DSP_BATCH_SUCCESS);
+  }
+
+  pool.numThreads = numThreads;
+  pool.fn = fn;
+  pool.pCtx = pCtx;
+  pool.pDeques = calloc(numThreads, sizeof(dsp_batch_deque));
+  pool.pWorkers = calloc(numThreads, sizeof(dsp_batch_worker));
+  if ((pool.pDeques == NULL) || (pool.pWorkers == NULL))
+  {
+    free(pool.pDeques);
+    free(pool.pWorkers);
+    return (DSP_BATCH_NO_MEMORY);
+  }
+
+  for (i = 0U; i < numThreads; i++)
+  {
+    pthread_mutex_init(&pool.pDeques[i].lock, NULL);
+    pool.pDeques[i].capacity = numTasks;
+    pool.pDeques[i].pTasks = malloc(numTasks * sizeof(uint32_t));
+    if (pool.pDeques[i].pTasks == NULL)
+    {
+      status = DSP_BATCH_NO_MEMORY;
+    }
+  }
+
+  if (status == DSP_BATCH_SUCCESS)
+  {
+    /* Initial distribution. The first task of a deque is the last one popped by its owner. */
+    for (i = 0U; i < numTasks; i++)
+    {
+      deque_push_bottom(&pool.pDeques[i % numThreads], i);
+    }
+
+    for (i = 0U; i < numThreads; i++)
+    {
+      pool.pWorkers[i].pPool = &pool;
+      pool.pWorkers[i].id = i;
+      if (pthread_create(&pool.pWorkers[i].thread, NULL, worker_main, &pool.pWorkers[i]) != 0)
+      {
+        status = DSP_BATCH_THREAD_ERROR;
+        break;
+      }
+      started++;
+    }
+
+    /* If some threads could not be created, the started ones still complete all the tasks */
+    if ((started > 0U) && (status == DSP_BATCH_THREAD_ERROR))
+    {
+      status = DSP_BATCH_SUCCESS;
+    }
+
+    for (i = 0U; i < started; i++)
+    {
+      pthread_join(pool.pWorkers[i].thread, NULL);
+    }
+  }
+
+  for (i = 0U; i < numThreads; i++)
+  {
+    free(pool.pDeques[i].pTasks);
+    pthread_mutex_destroy(&pool.pDeques[i].lock);
+  }
+  free(pool.pDeques);
+  free(pool.pWorkers);
+
+  return (status);
+}
@@ -0,0 +1,63 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        dsp_batch_pool.h
+ * Description:  Private header of the work-stealing thread pool
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.16.1
+ *
+ * Target Processor: Host (POSIX)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DSP_BATCH_POOL_H_
+#define DSP_BATCH_POOL_H_
+
+#include "cmsis_dsp_batch.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/*
+  Task function. Returns a non zero value when the task must be run again
+  (the channel has more blocks). The task is then pushed on the deque of the
+  worker which ran it.
+ */
+typedef int32_t (*dsp_batch_task_fn)(
+  void * pCtx,
+  uint32_t worker,
+  uint32_t task);
+
+/*
+  Run the tasks 0 to numTasks-1 on numThreads workers until all of them return 0.
+  A task is never run by two workers at the same time.
+ */
+dsp_batch_status dsp_batch_pool_run(
+  uint32_t numThreads,
+  uint32_t numTasks,
+  dsp_batch_task_fn fn,
+  void * pCtx);
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* DSP_BATCH_POOL_H_ */
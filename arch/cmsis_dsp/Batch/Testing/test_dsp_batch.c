@@ -0,0 +1,439 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        test_dsp_batch.c
+ * Description:  Host tests of the batch runner
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.16.1
+ *
+ * Target Processor: Host (POSIX)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+  Usage: test_dsp_batch [prefix]
+
+  The input and output files are created as prefix.in and prefix.out.
+
+  A float32 recording of 3 channels is processed by:
+  - channel 0: FIR, statistics, windowed STFT
+  - channel 1: biquad cascade, STFT without window
+  - channel 2: statistics only
+
+  The filtered streams, spectra and statistics are compared with a double
+  precision reference (direct convolution, direct recursion and naive DFT).
+  The job is then run with several numbers of threads and block sizes which
+  divide the recording differently; the results must be bit-identical for the
+  same block size. A Q15 recording checks the conversion path.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cmsis_dsp_batch.h"
+
+#define NUM_CHANNELS 3U
+#define NUM_FRAMES   10007U
+#define NUM_TAPS     17U
+#define NUM_STAGES   2U
+#define FFT_LEN      128U
+#define HOP          48U
+#define NUM_BINS     (FFT_LEN / 2U + 1U)
+#define NUM_SPECTRA  (((NUM_FRAMES - FFT_LEN) / HOP) + 1U)
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+static float32_t input[NUM_FRAMES][NUM_CHANNELS];
+static float32_t firCoeffs[NUM_TAPS];
+static float32_t biquadCoeffs[5U * NUM_STAGES];
+static float32_t window[FFT_LEN];
+
+/* Spectra delivered by the runner, per channel and frame */
+static float32_t spectra[NUM_CHANNELS][NUM_SPECTRA][NUM_BINS];
+static uint32_t frameCount[NUM_CHANNELS];
+static int orderError;
+
+static int failures;
+
+#define CHECK(cond, ...)                                  \
+  do                                                      \
+  {                                                       \
+    if (!(cond))                                          \
+    {                                                     \
+      printf("FAIL %s:%d: ", __FILE__, __LINE__);         \
+      printf(__VA_ARGS__);                                \
+      printf("\n");                                       \
+      failures++;                                         \
+    }                                                     \
+  } while (0)
+
+static void on_frame(void *pCtx, uint32_t channel, uint32_t node, uint64_t frame,
+                     const float32_t *pMag, uint32_t numBins)
+{
+  (void)pCtx;
+  (void)node;
+
+  /* Frames of a channel are delivered in order */
+  if ((frame != frameCount[channel]) || (frame >= NUM_SPECTRA) || (numBins != NUM_BINS))
+  {
+    orderError = 1;
+    return;
+  }
+  memcpy(spectra[channel][frame], pMag, numBins * sizeof(float32_t));
+  frameCount[channel]++;
+}
+
+static float32_t rnd(uint32_t *pSeed)
+{
+  *pSeed = *pSeed * 1664525U + 1013904223U;
+  return ((float32_t)(*pSeed >> 8) / 16777216.0f) - 0.5f;
+}
+
+static int write_file(const char *pPath, const void *pData, size_t size)
+{
+  FILE *f = fopen(pPath, "wb");
+  int status;
+
+  if (f == NULL)
+  {
+    return (-1);
+  }
+  status = (fwrite(pData, 1U, size, f) == size) ? 0 : -1;
+  return ((fclose(f) == 0) ? status : -1);
+}
+
+static int read_file(const char *pPath, void *pData, size_t size)
+{
+  FILE *f = fopen(pPath, "rb");
+  int status;
+
+  if (f == NULL)
+  {
+    return (-1);
+  }
+  status = (fread(pData, 1U, size, f) == size) ? 0 : -1;
+  fclose(f);
+  return (status);
+}
+
+/* Result of one run */
+typedef struct
+{
+  float32_t out[NUM_FRAMES][NUM_CHANNELS];
+  float32_t spectra[NUM_CHANNELS][NUM_SPECTRA][NUM_BINS];
+  dsp_batch_stats stats[2];
+} run_result;
+
+static int run(const char *pIn, const char *pOut, dsp_batch_format format,
+               uint32_t numThreads, uint32_t blockSize, run_result *pRes)
+{
+  dsp_batch_node nodes0[3];
+  dsp_batch_node nodes1[2];
+  dsp_batch_node nodes2[1];
+  dsp_batch_chain chains[NUM_CHANNELS];
+  dsp_batch_config cfg;
+  dsp_batch_job *pJob;
+  dsp_batch_status status;
+
+  memset(nodes0, 0, sizeof(nodes0));
+  memset(nodes1, 0, sizeof(nodes1));
+  memset(nodes2, 0, sizeof(nodes2));
+
+  nodes0[0].type = DSP_BATCH_NODE_FIR;
+  nodes0[0].u.fir.numTaps = NUM_TAPS;
+  nodes0[0].u.fir.pCoeffs = firCoeffs;
+  nodes0[1].type = DSP_BATCH_NODE_STATS;
+  nodes0[2].type = DSP_BATCH_NODE_STFT;
+  nodes0[2].u.stft.fftLen = FFT_LEN;
+  nodes0[2].u.stft.hop = HOP;
+  nodes0[2].u.stft.pWindow = window;
+  nodes0[2].u.stft.onFrame = on_frame;
+
+  nodes1[0].type = DSP_BATCH_NODE_BIQUAD;
+  nodes1[0].u.biquad.numStages = NUM_STAGES;
+  nodes1[0].u.biquad.pCoeffs = biquadCoeffs;
+  nodes1[1].type = DSP_BATCH_NODE_STFT;
+  nodes1[1].u.stft.fftLen = FFT_LEN;
+  nodes1[1].u.stft.hop = HOP;
+  nodes1[1].u.stft.pWindow = NULL;
+  nodes1[1].u.stft.onFrame = on_frame;
+
+  nodes2[0].type = DSP_BATCH_NODE_STATS;
+
+  chains[0].numNodes = 3U;
+  chains[0].pNodes = nodes0;
+  chains[1].numNodes = 2U;
+  chains[1].pNodes = nodes1;
+  chains[2].numNodes = 1U;
+  chains[2].pNodes = nodes2;
+
+  memset(&cfg, 0, sizeof(cfg));
+  cfg.pInPath = pIn;
+  cfg.pOutPath = pOut;
+  cfg.format = format;
+  cfg.numChannels = NUM_CHANNELS;
+  cfg.pChains = chains;
+  cfg.blockSize = blockSize;
+  cfg.numThreads = numThreads;
+
+  memset(frameCount, 0, sizeof(frameCount));
+  memset(spectra, 0, sizeof(spectra));
+  orderError = 0;
+
+  status = dsp_batch_create(&pJob, &cfg);
+  if (status != DSP_BATCH_SUCCESS)
+  {
+    printf("FAIL dsp_batch_create: %d\n", (int)status);
+    return (-1);
+  }
+
+  CHECK(dsp_batch_num_frames(pJob) == NUM_FRAMES, "%llu frames", (unsigned long long)dsp_batch_num_frames(pJob));
+  status = dsp_batch_run(pJob);
+  CHECK(status == DSP_BATCH_SUCCESS, "dsp_batch_run: %d", (int)status);
+  CHECK(dsp_batch_get_stats(pJob, 0U, 1U, &pRes->stats[0]) == DSP_BATCH_SUCCESS, "stats of channel 0");
+  CHECK(dsp_batch_get_stats(pJob, 2U, 0U, &pRes->stats[1]) == DSP_BATCH_SUCCESS, "stats of channel 2");
+  CHECK(dsp_batch_get_stats(pJob, 1U, 0U, &pRes->stats[1]) == DSP_BATCH_ARGUMENT_ERROR, "stats of a biquad node");
+  dsp_batch_destroy(pJob);
+
+  CHECK(orderError == 0, "frames out of order");
+  CHECK((frameCount[0] == NUM_SPECTRA) && (frameCount[1] == NUM_SPECTRA) && (frameCount[2] == 0U),
+        "frame counts %u %u %u, expected %u", frameCount[0], frameCount[1], frameCount[2], NUM_SPECTRA);
+
+  memcpy(pRes->spectra, spectra, sizeof(spectra));
+  CHECK(read_file(pOut, pRes->out, sizeof(pRes->out)) == 0, "read %s", pOut);
+
+  return (0);
+}
+
+static int close_enough(float64_t ref, float64_t val, float64_t tol)
+{
+  return (fabs(ref - val) <= tol * (1.0 + fabs(ref)));
+}
+
+/* Compare a run with the double precision reference of the input it processed */
+static void check_reference(const run_result *pRes, float32_t (*pIn)[NUM_CHANNELS], float64_t tol)
+{
+  static float64_t y0[NUM_FRAMES];
+  static float64_t y1[NUM_FRAMES];
+  float64_t state[NUM_STAGES][2];
+  float64_t sum, sumSq, mn, mx, maxErr;
+  uint32_t n, k, s, f, c;
+
+  /* FIR: pCoeffs is in time reversed order */
+  for (n = 0U; n < NUM_FRAMES; n++)
+  {
+    y0[n] = 0.0;
+    for (k = 0U; (k < NUM_TAPS) && (k <= n); k++)
+    {
+      y0[n] += (float64_t)firCoeffs[NUM_TAPS - 1U - k] * pIn[n - k][0];
+    }
+  }
+
+  /* Biquad cascade, direct form II transposed */
+  memset(state, 0, sizeof(state));
+  for (n = 0U; n < NUM_FRAMES; n++)
+  {
+    float64_t x = pIn[n][1];
+
+    for (s = 0U; s < NUM_STAGES; s++)
+    {
+      const float32_t *b = &biquadCoeffs[5U * s];
+      float64_t y = b[0] * x + state[s][0];
+
+      state[s][0] = b[1] * x + b[3] * y + state[s][1];
+      state[s][1] = b[2] * x + b[4] * y;
+      x = y;
+    }
+    y1[n] = x;
+  }
+
+  maxErr = 0.0;
+  for (n = 0U; n < NUM_FRAMES; n++)
+  {
+    maxErr = fmax(maxErr, fabs(y0[n] - pRes->out[n][0]));
+    maxErr = fmax(maxErr, fabs(y1[n] - pRes->out[n][1]));
+    CHECK(pRes->out[n][2] == pIn[n][2], "channel 2 output at %u", n);
+  }
+  CHECK(maxErr < tol, "filtered streams differ by %g", maxErr);
+
+  /* Naive DFT of each frame */
+  maxErr = 0.0;
+  for (c = 0U; c < 2U; c++)
+  {
+    const float64_t *y = (c == 0U) ? y0 : y1;
+
+    for (f = 0U; f < NUM_SPECTRA; f++)
+    {
+      for (k = 0U; k < NUM_BINS; k++)
+      {
+        float64_t re = 0.0, im = 0.0;
+
+        for (n = 0U; n < FFT_LEN; n++)
+        {
+          float64_t v = y[f * HOP + n] * ((c == 0U) ? (float64_t)window[n] : 1.0);
+          float64_t phase = 2.0 * M_PI * (float64_t)((k * n) % FFT_LEN) / FFT_LEN;
+
+          re += v * cos(phase);
+          im -= v * sin(phase);
+        }
+        maxErr = fmax(maxErr, fabs(sqrt(re * re + im * im) - pRes->spectra[c][f][k]));
+      }
+    }
+  }
+  CHECK(maxErr < 10.0 * tol, "spectra differ from the DFT by %g", maxErr);
+
+  /* Statistics of the FIR output and of the raw channel 2 */
+  for (c = 0U; c < 2U; c++)
+  {
+    const dsp_batch_stats *pStats = &pRes->stats[c];
+
+    sum = 0.0;
+    sumSq = 0.0;
+    mn = HUGE_VAL;
+    mx = -HUGE_VAL;
+    for (n = 0U; n < NUM_FRAMES; n++)
+    {
+      float64_t v = (c == 0U) ? (float64_t)pRes->out[n][0] : (float64_t)pIn[n][2];
+
+      sum += v;
+      sumSq += v * v;
+      mn = fmin(mn, v);
+      mx = fmax(mx, v);
+    }
+    CHECK(pStats->count == NUM_FRAMES, "stats count %llu", (unsigned long long)pStats->count);
+    CHECK(close_enough(sum / NUM_FRAMES, pStats->mean, 1e-5), "mean %g, expected %g", pStats->mean, sum / NUM_FRAMES);
+    CHECK(close_enough(sqrt(sumSq / NUM_FRAMES), pStats->rms, 1e-5), "rms %g", pStats->rms);
+    CHECK(close_enough((sumSq / NUM_FRAMES) - (sum / NUM_FRAMES) * (sum / NUM_FRAMES), pStats->var, 1e-5),
+          "var %g", pStats->var);
+    CHECK(((float64_t)pStats->min == mn) && ((float64_t)pStats->max == mx), "min %g max %g", pStats->min, pStats->max);
+  }
+}
+
+static int same_result(const run_result *pA, const run_result *pB)
+{
+  return ((memcmp(pA->out, pB->out, sizeof(pA->out)) == 0) &&
+          (memcmp(pA->spectra, pB->spectra, sizeof(pA->spectra)) == 0) &&
+          (memcmp(pA->stats, pB->stats, sizeof(pA->stats)) == 0));
+}
+
+int main(int argc, char **argv)
+{
+  static const uint32_t threads[] = { 1U, 2U, 3U, 5U };
+  static const uint32_t blockSizes[] = { 1000U, 64U, 20000U };
+  static float32_t converted[NUM_FRAMES][NUM_CHANNELS];
+  static int16_t inputQ15[NUM_FRAMES][NUM_CHANNELS];
+  const char *pPrefix = (argc > 1) ? argv[1] : "test_dsp_batch";
+  char inPath[512], outPath[512];
+  run_result *pRef = malloc(sizeof(run_result));
+  run_result *pRes = malloc(sizeof(run_result));
+  uint32_t seed = 7U;
+  uint32_t i, c, t, b;
+
+  if ((pRef == NULL) || (pRes == NULL))
+  {
+    return (1);
+  }
+
+  snprintf(inPath, sizeof(inPath), "%s.in", pPrefix);
+  snprintf(outPath, sizeof(outPath), "%s.out", pPrefix);
+
+  for (i = 0U; i < NUM_TAPS; i++)
+  {
+    firCoeffs[i] = rnd(&seed) / (float32_t)NUM_TAPS;
+  }
+  for (i = 0U; i < NUM_STAGES; i++)
+  {
+    biquadCoeffs[5U * i + 0U] = 0.2f;
+    biquadCoeffs[5U * i + 1U] = 0.4f;
+    biquadCoeffs[5U * i + 2U] = 0.2f;
+    biquadCoeffs[5U * i + 3U] = 0.5f;
+    biquadCoeffs[5U * i + 4U] = -0.3f;
+  }
+  for (i = 0U; i < FFT_LEN; i++)
+  {
+    window[i] = (float32_t)(0.5 - 0.5 * cos(2.0 * M_PI * (float64_t)i / FFT_LEN));
+  }
+  for (i = 0U; i < NUM_FRAMES; i++)
+  {
+    for (c = 0U; c < NUM_CHANNELS; c++)
+    {
+      input[i][c] = (float32_t)(0.5 * sin(0.01 * (float64_t)((c + 1U) * i))) + 0.2f * rnd(&seed);
+    }
+  }
+
+  /* float32 input: reference, then every number of threads and block size */
+  if (write_file(inPath, input, sizeof(input)) != 0)
+  {
+    printf("FAIL cannot write %s\n", inPath);
+    return (1);
+  }
+
+  for (b = 0U; b < sizeof(blockSizes) / sizeof(blockSizes[0]); b++)
+  {
+    if (run(inPath, outPath, DSP_BATCH_FORMAT_F32, 1U, blockSizes[b], pRef) != 0)
+    {
+      return (1);
+    }
+    check_reference(pRef, input, 1e-5);
+
+    for (t = 1U; t < sizeof(threads) / sizeof(threads[0]); t++)
+    {
+      if (run(inPath, outPath, DSP_BATCH_FORMAT_F32, threads[t], blockSizes[b], pRes) != 0)
+      {
+        return (1);
+      }
+      CHECK(same_result(pRef, pRes), "%u threads differ from 1 thread with blocks of %u",
+            threads[t], blockSizes[b]);
+    }
+  }
+
+  /* Q15 input: the reference is computed on the converted samples */
+  for (i = 0U; i < NUM_FRAMES; i++)
+  {
+    for (c = 0U; c < NUM_CHANNELS; c++)
+    {
+      inputQ15[i][c] = (int16_t)lrintf(input[i][c] * 32768.0f);
+      converted[i][c] = (float32_t)inputQ15[i][c] / 32768.0f;
+    }
+  }
+  if ((write_file(inPath, inputQ15, sizeof(inputQ15)) != 0) ||
+      (run(inPath, outPath, DSP_BATCH_FORMAT_Q15, 2U, 1000U, pRes) != 0))
+  {
+    return (1);
+  }
+  check_reference(pRes, converted, 1e-5);
+
+  remove(inPath);
+  remove(outPath);
+  free(pRef);
+  free(pRes);
+
+  if (failures != 0)
+  {
+    printf("%d check(s) failed\n", failures);
+    return (1);
+  }
+
+  printf("All checks passed\n");
+  return (0);
+}
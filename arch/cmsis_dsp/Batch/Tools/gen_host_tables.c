@@ -0,0 +1,290 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        gen_host_tables.c
+ * Description:  Generation of the floating-point FFT and sine tables
+ *               for the host builds of the batch runner and of the tests
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.16.1
+ *
+ * Target Processor: Host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+  Usage: gen_host_tables output.c
+
+  This pack does not ship CommonTables/arm_common_tables.c. The batch runner
+  and the host tests only need the tables below, which are generated here:
+
+  - sinTable_f32:         sin(2*pi*i/FAST_MATH_TABLE_SIZE)
+  - sinTable_q31:         the same in Q31, saturated at 0x7FFFFFFF
+  - twiddleCoef_N:        cos and sin of 2*pi*i/N for i < N
+  - twiddleCoef_rfft_N:   sin and cos of 2*pi*i/N for i < N/2
+  - armBitRevIndexTableN: the swaps reordering the output of the radix-8
+                          butterflies of arm_cfft_f32
+  - arm_cfft_sR_f32_lenN: the instances of arm_const_structs.c using them
+
+  The output order of the butterflies is measured rather than derived: each
+  pure tone is transformed without bit reversal and the bin where its energy
+  lands gives the permutation. The permutation is then written as the
+  sequence of swaps applied by arm_bitreversal_32, as byte offsets of the
+  complex samples, and padded to the length declared in arm_common_tables.h.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "dsp/transform_functions.h"
+#include "dsp/fast_math_functions.h"
+#include "arm_common_tables.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define MIN_CFFT_LEN 16U
+#define MAX_CFFT_LEN 4096U
+
+static const uint16_t bitRevLengths[] = {
+  ARMBITREVINDEXTABLE_16_TABLE_LENGTH,
+  ARMBITREVINDEXTABLE_32_TABLE_LENGTH,
+  ARMBITREVINDEXTABLE_64_TABLE_LENGTH,
+  ARMBITREVINDEXTABLE_128_TABLE_LENGTH,
+  ARMBITREVINDEXTABLE_256_TABLE_LENGTH,
+  ARMBITREVINDEXTABLE_512_TABLE_LENGTH,
+  ARMBITREVINDEXTABLE_1024_TABLE_LENGTH,
+  ARMBITREVINDEXTABLE_2048_TABLE_LENGTH,
+  ARMBITREVINDEXTABLE_4096_TABLE_LENGTH
+};
+
+static void write_floats(FILE *pOut, const char *pName, const float32_t *pData, uint32_t len)
+{
+  uint32_t i;
+
+  fprintf(pOut, "const float32_t %s[%u] ARM_DSP_TABLE_ATTRIBUTE = {", pName, len);
+  for (i = 0; i < len; i++)
+  {
+    fprintf(pOut, "%s%#.9gf%s", ((i % 4U) == 0U) ? "\n    " : " ", (double)pData[i], (i + 1U < len) ? "," : "");
+  }
+  fprintf(pOut, "\n};\n\n");
+}
+
+/* Output position of each bin when the butterflies run without bit reversal */
+static int measure_order(uint32_t len, const float32_t *pTwiddle, uint32_t *pPos)
+{
+  arm_cfft_instance_f32 S = { (uint16_t)len, pTwiddle, NULL, 0U };
+  float32_t *pBuf = malloc(2U * len * sizeof(float32_t));
+  uint8_t *pSeen = calloc(len, 1U);
+  uint32_t k, n, best;
+  int status = 0;
+
+  if ((pBuf == NULL) || (pSeen == NULL))
+  {
+    status = -1;
+  }
+
+  for (k = 0U; (status == 0) && (k < len); k++)
+  {
+    float32_t bestMag = 0.0f;
+
+    for (n = 0U; n < len; n++)
+    {
+      double phase = 2.0 * M_PI * (double)((k * n) % len) / (double)len;
+      pBuf[2U * n]      = (float32_t)cos(phase);
+      pBuf[2U * n + 1U] = (float32_t)sin(phase);
+    }
+    arm_cfft_f32(&S, pBuf, 0U, 0U);
+
+    best = 0U;
+    for (n = 0U; n < len; n++)
+    {
+      float32_t mag = (pBuf[2U * n] * pBuf[2U * n]) + (pBuf[2U * n + 1U] * pBuf[2U * n + 1U]);
+      if (mag > bestMag)
+      {
+        bestMag = mag;
+        best = n;
+      }
+    }
+
+    /* The tone must land in a single bin, and each bin must receive one tone */
+    if ((bestMag < 0.9f * (float32_t)len * (float32_t)len) || (pSeen[best] != 0U))
+    {
+      status = -1;
+    }
+    pSeen[best] = 1U;
+    pPos[k] = best;
+  }
+
+  free(pSeen);
+  free(pBuf);
+  return status;
+}
+
+/* Swaps moving the sample at pPos[k] to k for every k */
+static uint32_t build_swaps(uint32_t len, const uint32_t *pPos, uint16_t *pSwaps)
+{
+  uint32_t *pAt = malloc(len * sizeof(uint32_t));     /* Bin held at each position */
+  uint32_t *pWhere = malloc(len * sizeof(uint32_t));  /* Position of each butterfly output */
+  uint32_t k, count = 0U;
+
+  if ((pAt == NULL) || (pWhere == NULL))
+  {
+    free(pAt);
+    free(pWhere);
+    return UINT32_MAX;
+  }
+
+  for (k = 0U; k < len; k++)
+  {
+    pAt[k] = k;
+    pWhere[k] = k;
+  }
+
+  for (k = 0U; k < len; k++)
+  {
+    uint32_t from = pWhere[pPos[k]];
+
+    if (from != k)
+    {
+      uint32_t moved = pAt[k];
+
+      pSwaps[count++] = (uint16_t)(8U * k);
+      pSwaps[count++] = (uint16_t)(8U * from);
+      pAt[from] = moved;
+      pWhere[moved] = from;
+      pAt[k] = pPos[k];
+      pWhere[pPos[k]] = k;
+    }
+  }
+
+  free(pAt);
+  free(pWhere);
+  return count;
+}
+
+int main(int argc, char **argv)
+{
+  FILE *pOut;
+  float32_t *pTable;
+  uint32_t *pPos;
+  uint16_t *pSwaps;
+  uint32_t len, i, count, sizeIdx;
+  char name[48];
+
+  if (argc != 2)
+  {
+    fprintf(stderr, "usage: %s output.c\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  pTable = malloc(2U * MAX_CFFT_LEN * sizeof(float32_t));
+  pPos = malloc(MAX_CFFT_LEN * sizeof(uint32_t));
+  pSwaps = malloc(2U * MAX_CFFT_LEN * sizeof(uint16_t));
+  pOut = fopen(argv[1], "w");
+  if ((pTable == NULL) || (pPos == NULL) || (pSwaps == NULL) || (pOut == NULL))
+  {
+    fprintf(stderr, "%s: cannot create %s\n", argv[0], argv[1]);
+    return EXIT_FAILURE;
+  }
+
+  fprintf(pOut, "/* Generated by gen_host_tables.c, do not edit */\n\n");
+  fprintf(pOut, "#include \"arm_math_types.h\"\n");
+  fprintf(pOut, "#include \"dsp/fast_math_functions.h\"\n");
+  fprintf(pOut, "#include \"arm_common_tables.h\"\n");
+  fprintf(pOut, "#include \"arm_const_structs.h\"\n\n");
+
+  for (i = 0U; i <= FAST_MATH_TABLE_SIZE; i++)
+  {
+    pTable[i] = (float32_t)sin(2.0 * M_PI * (double)i / (double)FAST_MATH_TABLE_SIZE);
+  }
+  write_floats(pOut, "sinTable_f32", pTable, FAST_MATH_TABLE_SIZE + 1U);
+
+  fprintf(pOut, "const q31_t sinTable_q31[%u] ARM_DSP_TABLE_ATTRIBUTE = {", FAST_MATH_TABLE_SIZE + 1U);
+  for (i = 0U; i <= FAST_MATH_TABLE_SIZE; i++)
+  {
+    double v = round(sin(2.0 * M_PI * (double)i / (double)FAST_MATH_TABLE_SIZE) * 2147483648.0);
+
+    fprintf(pOut, "%s%ld%s", ((i % 8U) == 0U) ? "\n    " : " ", (long)((v > 2147483647.0) ? 2147483647.0 : v),
+            (i < FAST_MATH_TABLE_SIZE) ? "," : "");
+  }
+  fprintf(pOut, "\n};\n\n");
+
+  for (len = MIN_CFFT_LEN, sizeIdx = 0U; len <= MAX_CFFT_LEN; len *= 2U, sizeIdx++)
+  {
+    for (i = 0U; i < len; i++)
+    {
+      pTable[2U * i]      = (float32_t)cos(2.0 * M_PI * (double)i / (double)len);
+      pTable[2U * i + 1U] = (float32_t)sin(2.0 * M_PI * (double)i / (double)len);
+    }
+    snprintf(name, sizeof(name), "twiddleCoef_%u", len);
+    write_floats(pOut, name, pTable, 2U * len);
+
+    if (measure_order(len, pTable, pPos) != 0)
+    {
+      fprintf(stderr, "%s: the %u-point butterflies do not give a permutation\n", argv[0], len);
+      return EXIT_FAILURE;
+    }
+    count = build_swaps(len, pPos, pSwaps);
+    if (count > bitRevLengths[sizeIdx])
+    {
+      fprintf(stderr, "%s: %u-point reordering needs %u entries, %u declared\n",
+              argv[0], len, count, bitRevLengths[sizeIdx]);
+      return EXIT_FAILURE;
+    }
+
+    /* Pad with swaps of the first sample with itself */
+    fprintf(pOut, "const uint16_t armBitRevIndexTable%u[ARMBITREVINDEXTABLE_%u_TABLE_LENGTH] ARM_DSP_TABLE_ATTRIBUTE = {",
+            len, len);
+    for (i = 0U; i < bitRevLengths[sizeIdx]; i++)
+    {
+      fprintf(pOut, "%s%u%s", ((i % 8U) == 0U) ? "\n    " : " ", (i < count) ? pSwaps[i] : 0U,
+              (i + 1U < bitRevLengths[sizeIdx]) ? "," : "");
+    }
+    fprintf(pOut, "\n};\n\n");
+
+    fprintf(pOut, "const arm_cfft_instance_f32 arm_cfft_sR_f32_len%u ARM_DSP_TABLE_ATTRIBUTE = {\n", len);
+    fprintf(pOut, "  %u, twiddleCoef_%u, armBitRevIndexTable%u, ARMBITREVINDEXTABLE_%u_TABLE_LENGTH\n};\n\n",
+            len, len, len, len);
+
+    /* The real FFT of 2N points uses the N-point complex FFT */
+    for (i = 0U; i < len; i++)
+    {
+      pTable[2U * i]      = (float32_t)sin(2.0 * M_PI * (double)i / (double)(2U * len));
+      pTable[2U * i + 1U] = (float32_t)cos(2.0 * M_PI * (double)i / (double)(2U * len));
+    }
+    if ((2U * len) <= MAX_CFFT_LEN)
+    {
+      snprintf(name, sizeof(name), "twiddleCoef_rfft_%u", 2U * len);
+      write_floats(pOut, name, pTable, 2U * len);
+    }
+  }
+
+  free(pSwaps);
+  free(pPos);
+  free(pTable);
+
+  if (fclose(pOut) != 0)
+  {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
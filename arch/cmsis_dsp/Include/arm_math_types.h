@@ -129,6 +129,13 @@ extern "C"
   #endif
 #endif
 
+#if defined(ARM_MATH_SSE) || defined(ARM_MATH_AVX2)
+  #include <immintrin.h>
+  #if defined(ARM_MATH_AVX2) && !defined(ARM_MATH_SSE)
+    #define ARM_MATH_SSE
+  #endif
+#endif
+
 #if !defined(ARM_MATH_AUTOVECTORIZE)
 
 
@@ -339,6 +346,17 @@ extern "C"
    */
   typedef double float64_t;
 
+  /**
+   * @brief 16-bit brain floating-point storage type (upper half of a float32_t).
+   */
+  typedef uint16_t bf16_t;
+
+  /**
+   * @brief 16-bit IEEE half-precision storage type, holding the bits of a float16_t
+   * without requiring compiler support for half-precision.
+   */
+  typedef uint16_t fp16_t;
+
   /**
    * @brief vector types
    */
@@ -413,6 +413,34 @@ const float64_t * pSrc,
         float32_t * result);
 
 
+  /**
+   * @brief Dot product of bf16 vectors with floating-point accumulation.
+   * @param[in]  pSrcA      points to the first input vector
+   * @param[in]  pSrcB      points to the second input vector
+   * @param[in]  blockSize  number of samples in each vector
+   * @param[out] result     output result returned here
+   */
+  void arm_dot_prod_bf16_f32(
+  const bf16_t * pSrcA,
+  const bf16_t * pSrcB,
+        uint32_t blockSize,
+        float32_t * result);
+
+
+  /**
+   * @brief Dot product of f16 vectors with floating-point accumulation.
+   * @param[in]  pSrcA      points to the first input vector
+   * @param[in]  pSrcB      points to the second input vector
+   * @param[in]  blockSize  number of samples in each vector
+   * @param[out] result     output result returned here
+   */
+  void arm_dot_prod_f16_f32(
+  const fp16_t * pSrcA,
+  const fp16_t * pSrcB,
+        uint32_t blockSize,
+        float32_t * result);
+
+
 
 /**
  * @brief Dot product of floating-point vectors.
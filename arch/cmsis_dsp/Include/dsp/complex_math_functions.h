@@ -156,6 +156,30 @@ extern "C"
         uint32_t numSamples);
 
 
+  /**
+   * @brief  f16 complex magnitude computed with floating-point arithmetic
+   * @param[in]  pSrc        points to the complex input vector
+   * @param[out] pDst        points to the real output vector
+   * @param[in]  numSamples  number of complex samples in the input vector
+   */
+  void arm_cmplx_mag_f16_f32(
+  const fp16_t * pSrc,
+        fp16_t * pDst,
+        uint32_t numSamples);
+
+
+  /**
+   * @brief  bf16 complex magnitude computed with floating-point arithmetic
+   * @param[in]  pSrc        points to the complex input vector
+   * @param[out] pDst        points to the real output vector
+   * @param[in]  numSamples  number of complex samples in the input vector
+   */
+  void arm_cmplx_mag_bf16_f32(
+  const bf16_t * pSrc,
+        bf16_t * pDst,
+        uint32_t numSamples);
+
+
   /**
    * @brief  Q31 complex magnitude
    * @param[in]  pSrc        points to the complex input vector
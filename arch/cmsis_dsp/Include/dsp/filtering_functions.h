@@ -35,6 +35,7 @@
 
 #include "dsp/support_functions.h"
 #include "dsp/fast_math_functions.h"
+#include "dsp/transform_functions.h"
 
 #ifdef   __cplusplus
 extern "C"
@@ -90,6 +91,26 @@ extern "C"
     const float32_t *pCoeffs;   /**< points to the coefficient array. The array is of length numTaps. */
   } arm_fir_instance_f32;
 
+  /**
+   * @brief Instance structure for the FIR filter with f16 coefficients and floating-point data.
+   */
+  typedef struct
+  {
+          uint16_t numTaps;     /**< number of filter coefficients in the filter. */
+          float32_t *pState;    /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    const fp16_t *pCoeffs;      /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_instance_f16_f32;
+
+  /**
+   * @brief Instance structure for the FIR filter with bf16 coefficients and floating-point data.
+   */
+  typedef struct
+  {
+          uint16_t numTaps;     /**< number of filter coefficients in the filter. */
+          float32_t *pState;    /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    const bf16_t *pCoeffs;      /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_instance_bf16_f32;
+
   /**
    * @brief Instance structure for the floating-point FIR filter.
    */
@@ -264,6 +285,62 @@ extern "C"
         float32_t * pState,
         uint32_t blockSize);
 
+  /**
+   * @brief Processing function for the FIR filter with f16 coefficients and floating-point data.
+   * @param[in]  S          points to an instance of the FIR structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_fir_f16_f32(
+  const arm_fir_instance_f16_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the FIR filter with f16 coefficients and floating-point data.
+   * @param[in,out] S          points to an instance of the FIR filter structure.
+   * @param[in]     numTaps    Number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of samples that are processed at a time.
+   */
+  void arm_fir_init_f16_f32(
+        arm_fir_instance_f16_f32 * S,
+        uint16_t numTaps,
+  const fp16_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the FIR filter with bf16 coefficients and floating-point data.
+   * @param[in]  S          points to an instance of the FIR structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_fir_bf16_f32(
+  const arm_fir_instance_bf16_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the FIR filter with bf16 coefficients and floating-point data.
+   * @param[in,out] S          points to an instance of the FIR filter structure.
+   * @param[in]     numTaps    Number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of samples that are processed at a time.
+   */
+  void arm_fir_init_bf16_f32(
+        arm_fir_instance_bf16_f32 * S,
+        uint16_t numTaps,
+  const bf16_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize);
+
   /**
    * @brief  Initialization function for the floating-point FIR filter.
    * @param[in,out] S          points to an instance of the floating-point FIR filter structure.
@@ -2563,6 +2640,178 @@ void arm_levinson_durbin_q31(const q31_t *phi,
   q31_t *err,
   int nbCoefs);
 
+/**
+ * @brief Maximum prediction order supported by the LPC functions.
+ */
+#define ARM_LPC_MAX_ORDER 32
+
+  /**
+   * @brief Instance structure for the floating-point LPC analysis.
+   */
+  typedef struct
+  {
+          uint16_t order;                      /**< prediction order P. */
+          uint32_t frameLength;                /**< number of samples in an analysis frame. */
+    const float32_t *pWindow;                  /**< points to the analysis window of length frameLength, or NULL for a rectangular window. */
+    const float32_t *pLagWindow;               /**< points to the lag window of length order+1, or NULL. */
+    const arm_rfft_fast_instance_f32 *pRfft;   /**< points to the RFFT used for the autocorrelation, or NULL for the direct kernel. */
+          float32_t *pScratch;                 /**< points to the scratch buffer. */
+  } arm_lpc_analysis_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 LPC analysis.
+   */
+  typedef struct
+  {
+          uint16_t order;                      /**< prediction order P. */
+          uint32_t frameLength;                /**< number of samples in an analysis frame. */
+    const q31_t *pWindow;                      /**< points to the analysis window of length frameLength, or NULL for a rectangular window. */
+    const q31_t *pLagWindow;                   /**< points to the lag window of length order+1, or NULL. */
+          q31_t *pScratch;                     /**< points to the scratch buffer of length frameLength+order+1. */
+  } arm_lpc_analysis_instance_q31;
+
+
+  /**
+   * @brief Initialization function for the floating-point LPC analysis.
+   * @param[in,out] S            points to an instance of the floating-point LPC analysis structure.
+   * @param[in]     order        prediction order.
+   * @param[in]     frameLength  number of samples in an analysis frame.
+   * @param[in]     pWindow      points to the analysis window, or NULL.
+   * @param[in]     pLagWindow   points to the lag window, or NULL.
+   * @param[in]     pRfft        points to an initialized RFFT instance, or NULL.
+   * @param[in]     pScratch     points to the scratch buffer.
+   * @return        execution status
+   */
+  arm_status arm_lpc_analysis_init_f32(
+        arm_lpc_analysis_instance_f32 * S,
+        uint16_t order,
+        uint32_t frameLength,
+  const float32_t * pWindow,
+  const float32_t * pLagWindow,
+  const arm_rfft_fast_instance_f32 * pRfft,
+        float32_t * pScratch);
+
+
+  /**
+   * @brief Floating-point LPC analysis.
+   * @param[in]  S        points to an instance of the floating-point LPC analysis structure.
+   * @param[in]  pSrc     points to the frame of input samples.
+   * @param[out] pCoeffs  points to the prediction coefficients (length order).
+   * @param[out] pLsf     points to the line spectral frequencies (length order), or NULL.
+   * @param[out] pErr     points to the prediction error.
+   * @return     execution status
+   */
+  arm_status arm_lpc_analysis_f32(
+  const arm_lpc_analysis_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pCoeffs,
+        float32_t * pLsf,
+        float32_t * pErr);
+
+
+  /**
+   * @brief Initialization function for the Q31 LPC analysis.
+   * @param[in,out] S            points to an instance of the Q31 LPC analysis structure.
+   * @param[in]     order        prediction order.
+   * @param[in]     frameLength  number of samples in an analysis frame.
+   * @param[in]     pWindow      points to the analysis window, or NULL.
+   * @param[in]     pLagWindow   points to the lag window, or NULL.
+   * @param[in]     pScratch     points to the scratch buffer of length frameLength+order+1.
+   * @return        execution status
+   */
+  arm_status arm_lpc_analysis_init_q31(
+        arm_lpc_analysis_instance_q31 * S,
+        uint16_t order,
+        uint32_t frameLength,
+  const q31_t * pWindow,
+  const q31_t * pLagWindow,
+        q31_t * pScratch);
+
+
+  /**
+   * @brief Q31 LPC analysis.
+   * @param[in]  S        points to an instance of the Q31 LPC analysis structure.
+   * @param[in]  pSrc     points to the frame of input samples.
+   * @param[out] pCoeffs  points to the prediction coefficients (length order).
+   * @param[out] pLsf     points to the line spectral frequencies (length order), or NULL.
+   * @param[out] pErr     points to the normalized prediction error.
+   * @return     execution status
+   */
+  arm_status arm_lpc_analysis_q31(
+  const arm_lpc_analysis_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pCoeffs,
+        q31_t * pLsf,
+        q31_t * pErr);
+
+
+  /**
+   * @brief Conversion of floating-point prediction coefficients to line spectral frequencies.
+   * @param[in]  pCoeffs  points to the prediction coefficients (length order).
+   * @param[out] pLsf     points to the line spectral frequencies in radians (length order).
+   * @param[in]  order    prediction order. Must be even.
+   * @return     execution status
+   */
+  arm_status arm_lpc_to_lsf_f32(
+  const float32_t * pCoeffs,
+        float32_t * pLsf,
+        uint16_t order);
+
+
+  /**
+   * @brief Conversion of Q31 prediction coefficients to line spectral frequencies.
+   * @param[in]  pCoeffs  points to the prediction coefficients (length order).
+   * @param[out] pLsf     points to the line spectral frequencies normalized by pi (length order).
+   * @param[in]  order    prediction order. Must be even.
+   * @return     execution status
+   */
+  arm_status arm_lpc_to_lsf_q31(
+  const q31_t * pCoeffs,
+        q31_t * pLsf,
+        uint16_t order);
+
+
+  /**
+   * @brief Initialization function for the floating-point LPC synthesis lattice filter.
+   * @param[in,out] S          points to an instance of the floating-point IIR lattice structure.
+   * @param[in]     order      prediction order.
+   * @param[in]     pCoeffs    points to the prediction coefficients (length order).
+   * @param[out]    pkCoeffs   points to the reflection coefficient buffer (length order).
+   * @param[out]    pvCoeffs   points to the ladder coefficient buffer (length order+1).
+   * @param[in]     pState     points to the state buffer (length order+blockSize).
+   * @param[in]     blockSize  number of samples to process.
+   * @return        execution status
+   */
+  arm_status arm_lpc_synthesis_init_f32(
+        arm_iir_lattice_instance_f32 * S,
+        uint16_t order,
+  const float32_t * pCoeffs,
+        float32_t * pkCoeffs,
+        float32_t * pvCoeffs,
+        float32_t * pState,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief Initialization function for the Q31 LPC synthesis lattice filter.
+   * @param[in,out] S          points to an instance of the Q31 IIR lattice structure.
+   * @param[in]     order      prediction order.
+   * @param[in]     pCoeffs    points to the prediction coefficients (length order).
+   * @param[out]    pkCoeffs   points to the reflection coefficient buffer (length order).
+   * @param[out]    pvCoeffs   points to the ladder coefficient buffer (length order+1).
+   * @param[in]     pState     points to the state buffer (length order+blockSize).
+   * @param[in]     blockSize  number of samples to process.
+   * @return        execution status
+   */
+  arm_status arm_lpc_synthesis_init_q31(
+        arm_iir_lattice_instance_q31 * S,
+        uint16_t order,
+  const q31_t * pCoeffs,
+        q31_t * pkCoeffs,
+        q31_t * pvCoeffs,
+        q31_t * pState,
+        uint32_t blockSize);
+
 #ifdef   __cplusplus
 }
 #endif
@@ -120,6 +120,18 @@ extern "C"
     float32_t * coeffs;        /**< Coefficients buffer (b,c, and d) */
   } arm_spline_instance_f32;
 
+  /**
+   * @brief Instance structure for the Q31 cubic spline interpolation.
+   */
+  typedef struct
+  {
+    arm_spline_type type;      /**< Type (boundary conditions) */
+    const q31_t * x;           /**< x values */
+    const q31_t * y;           /**< y values */
+    uint32_t n_x;              /**< Number of known data points */
+    q31_t * coeffs;            /**< Coefficients buffer (B, C, D, 1/h mantissa and shift per segment) */
+  } arm_spline_instance_q31;
+
 
   /**
    * @brief Processing function for the floating-point cubic spline interpolation.
@@ -140,7 +152,7 @@ extern "C"
    * @param[in]     type     type of cubic spline interpolation (boundary conditions)
    * @param[in]     x        points to the x values of the known data points.
    * @param[in]     y        points to the y values of the known data points.
-   * @param[in]     n        number of known data points.
+   * @param[in]     n        number of known data points (at least 2).
    * @param[in]     coeffs   coefficients array for b, c, and d
    * @param[in]     tempBuffer   buffer array for internal computations
    */
@@ -153,6 +165,76 @@ extern "C"
           float32_t * coeffs,
           float32_t * tempBuffer);
 
+  /**
+   * @brief Floating-point cubic spline interpolation of a single point.
+   * @param[in]  S   points to an instance of the floating-point spline structure.
+   * @param[in]  xq  x value of the interpolated data point.
+   * @return     interpolated value.
+   */
+  float32_t arm_spline_lookup_f32(
+    const arm_spline_instance_f32 * S,
+          float32_t xq);
+
+  /**
+   * @brief Floating-point cubic spline interpolation of unordered points.
+   * @param[in]  S          points to an instance of the floating-point spline structure.
+   * @param[in]  xq         points to the x values of the interpolated data points (any order).
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples of output data.
+   */
+  void arm_spline_unsorted_f32(
+    const arm_spline_instance_f32 * S,
+    const float32_t * xq,
+          float32_t * pDst,
+          uint32_t blockSize);
+
+  /**
+   * @brief Floating-point cubic spline resampling on a uniform grid.
+   * @param[in]  S          points to an instance of the floating-point spline structure.
+   * @param[in]  x0         first x value of the grid.
+   * @param[in]  dx         grid step.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples of output data.
+   */
+  void arm_spline_resample_uniform_f32(
+    const arm_spline_instance_f32 * S,
+          float32_t x0,
+          float32_t dx,
+          float32_t * pDst,
+          uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q31 cubic spline interpolation.
+   * @param[in]  S          points to an instance of the Q31 spline structure.
+   * @param[in]  xq         points to the x values of the interpolated data points (any order).
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples of output data.
+   */
+  void arm_spline_q31(
+    const arm_spline_instance_q31 * S,
+    const q31_t * xq,
+          q31_t * pDst,
+          uint32_t blockSize);
+
+  /**
+   * @brief Initialization function for the Q31 cubic spline interpolation.
+   * @param[in,out] S           points to an instance of the Q31 spline structure.
+   * @param[in]     type        type of cubic spline interpolation (boundary conditions)
+   * @param[in]     x           points to the x values of the known data points.
+   * @param[in]     y           points to the y values of the known data points.
+   * @param[in]     n           number of known data points (at least 2).
+   * @param[in]     coeffs      coefficients array of size 5*(n-1)
+   * @param[in]     tempBuffer  floating-point buffer of size 7*n-4 for internal computations
+   */
+  void arm_spline_init_q31(
+          arm_spline_instance_q31 * S,
+          arm_spline_type type,
+    const q31_t * x,
+    const q31_t * y,
+          uint32_t n,
+          q31_t * coeffs,
+          float32_t * tempBuffer);
+
 
    /**
    * @brief  Process function for the floating-point Linear Interpolation Function.
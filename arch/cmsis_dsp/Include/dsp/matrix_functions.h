@@ -132,6 +132,26 @@ extern "C"
     float64_t *pData;     /**< points to the data of the matrix. */
   } arm_matrix_instance_f64;
 
+ /**
+   * @brief Instance structure for the bf16 matrix structure.
+   */
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix.     */
+    uint16_t numCols;     /**< number of columns of the matrix.  */
+    bf16_t *pData;        /**< points to the data of the matrix. */
+  } arm_matrix_instance_bf16;
+
+ /**
+   * @brief Instance structure for the f16 storage matrix structure.
+   */
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix.     */
+    uint16_t numCols;     /**< number of columns of the matrix.  */
+    fp16_t *pData;        /**< points to the data of the matrix. */
+  } arm_matrix_instance_fp16;
+
  /**
    * @brief Instance structure for the Q7 matrix structure.
    */
@@ -367,6 +387,28 @@ void arm_mat_vec_mult_f32(
   const float32_t *pVec, 
   float32_t *pDst);
 
+  /**
+   * @brief bf16 matrix and floating-point vector multiplication with floating-point accumulation
+   * @param[in]  pSrcMat  points to the input matrix structure
+   * @param[in]  pVec     points to vector
+   * @param[out] pDst     points to output vector
+   */
+void arm_mat_vec_mult_bf16_f32(
+  const arm_matrix_instance_bf16 *pSrcMat, 
+  const float32_t *pVec, 
+  float32_t *pDst);
+
+  /**
+   * @brief f16 matrix and floating-point vector multiplication with floating-point accumulation
+   * @param[in]  pSrcMat  points to the input matrix structure
+   * @param[in]  pVec     points to vector
+   * @param[out] pDst     points to output vector
+   */
+void arm_mat_vec_mult_f16_f32(
+  const arm_matrix_instance_fp16 *pSrcMat, 
+  const float32_t *pVec, 
+  float32_t *pDst);
+
   /**
    * @brief Q7 matrix multiplication
    * @param[in]  pSrcA   points to the first input matrix structure
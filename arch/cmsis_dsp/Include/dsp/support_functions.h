@@ -135,6 +135,54 @@ extern "C"
         q7_t * pDst,
         uint32_t blockSize);
 
+
+  /**
+   * @brief Converts the elements of the floating-point vector to bf16 vector.
+   * @param[in]  pSrc       points to the floating-point input vector
+   * @param[out] pDst       points to the bf16 output vector
+   * @param[in]  blockSize  length of the input vector
+   */
+  void arm_float_to_bf16(
+  const float32_t * pSrc,
+        bf16_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief Converts the elements of the bf16 vector to floating-point vector.
+   * @param[in]  pSrc       points to the bf16 input vector
+   * @param[out] pDst       points to the floating-point output vector
+   * @param[in]  blockSize  length of the input vector
+   */
+  void arm_bf16_to_float(
+  const bf16_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief Converts the elements of the floating-point vector to f16 storage vector.
+   * @param[in]  pSrc       points to the floating-point input vector
+   * @param[out] pDst       points to the f16 output vector
+   * @param[in]  blockSize  length of the input vector
+   */
+  void arm_float_to_fp16(
+  const float32_t * pSrc,
+        fp16_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief Converts the elements of the f16 storage vector to floating-point vector.
+   * @param[in]  pSrc       points to the f16 input vector
+   * @param[out] pDst       points to the floating-point output vector
+   * @param[in]  blockSize  length of the input vector
+   */
+  void arm_fp16_to_float(
+  const fp16_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
 /**
  * @brief  Converts the elements of the Q31 vector to 64 bit floating-point vector.
  * @param[in]  pSrc       is input pointer
@@ -253,6 +253,157 @@ __STATIC_INLINE int32_t arm_div_int64_to_int32(int64_t num, int32_t den)
     return result;
 }
 
+/**
+ * @brief  Conversion of a bf16 value to float32_t
+ * @param[in]  in   bf16 value
+ * @return     float32_t value
+ */
+__STATIC_FORCEINLINE float32_t arm_bf16_to_f32(bf16_t in)
+{
+    union
+    {
+        uint32_t  u;
+        float32_t f;
+    } v;
+
+    v.u = (uint32_t)in << 16;
+
+    return v.f;
+}
+
+/**
+ * @brief  Conversion of a float32_t value to bf16 with rounding to nearest even
+ * @param[in]  in   float32_t value
+ * @return     bf16 value
+ */
+__STATIC_FORCEINLINE bf16_t arm_f32_to_bf16(float32_t in)
+{
+    union
+    {
+        uint32_t  u;
+        float32_t f;
+    } v;
+
+    v.f = in;
+
+    /* Keep NaN quiet instead of rounding it to infinity */
+    if ((v.u & 0x7FFFFFFFU) > 0x7F800000U)
+    {
+        return (bf16_t)((v.u >> 16) | 0x0040U);
+    }
+
+    v.u += 0x7FFFU + ((v.u >> 16) & 1U);
+
+    return (bf16_t)(v.u >> 16);
+}
+
+/**
+ * @brief  Conversion of a f16 value to float32_t
+ * @param[in]  in   f16 value
+ * @return     float32_t value
+ */
+__STATIC_FORCEINLINE float32_t arm_fp16_to_f32(fp16_t in)
+{
+#if defined(__ARM_FP16_FORMAT_IEEE)
+    union
+    {
+        fp16_t  u;
+        __fp16  h;
+    } h;
+
+    /* Single VCVTB when the FPU supports half-precision conversions */
+    h.u = in;
+
+    return (float32_t)h.h;
+#else
+    union
+    {
+        uint32_t  u;
+        float32_t f;
+    } v;
+    uint32_t sign = ((uint32_t)in & 0x8000U) << 16;
+    uint32_t expo = ((uint32_t)in >> 10) & 0x1FU;
+    uint32_t mant = (uint32_t)in & 0x3FFU;
+
+    if (expo == 0x1FU)
+    {
+        /* Infinity or NaN */
+        v.u = sign | 0x7F800000U | (mant << 13);
+    }
+    else if (expo != 0U)
+    {
+        /* Normal value: the exponent bias goes from 15 to 127 */
+        v.u = sign | ((expo + 112U) << 23) | (mant << 13);
+    }
+    else
+    {
+        /* Zero or subnormal value: mant * 2^-24 is exact in float32_t */
+        v.f = (float32_t)mant * 5.9604644775390625e-8f;
+        v.u |= sign;
+    }
+
+    return v.f;
+#endif
+}
+
+/**
+ * @brief  Conversion of a float32_t value to f16 with rounding to nearest even
+ * @param[in]  in   float32_t value
+ * @return     f16 value
+ */
+__STATIC_FORCEINLINE fp16_t arm_f32_to_fp16(float32_t in)
+{
+#if defined(__ARM_FP16_FORMAT_IEEE)
+    union
+    {
+        fp16_t  u;
+        __fp16  h;
+    } h;
+
+    h.h = (__fp16)in;
+
+    return h.u;
+#else
+    union
+    {
+        uint32_t  u;
+        float32_t f;
+    } v;
+    uint32_t sign;
+    uint32_t half;
+
+    v.f = in;
+    sign = (v.u >> 16) & 0x8000U;
+    v.u &= 0x7FFFFFFFU;
+
+    if (v.u >= 0x7F800000U)
+    {
+        /* Infinity, or NaN kept quiet */
+        half = (v.u > 0x7F800000U) ? (0x7E00U | ((v.u >> 13) & 0x3FFU)) : 0x7C00U;
+    }
+    else if (v.u >= 0x477FF000U)
+    {
+        /* 65520 and above round to infinity */
+        half = 0x7C00U;
+    }
+    else if (v.u >= 0x38800000U)
+    {
+        /* Normal value: round the 13 dropped bits to nearest even, then rebias the exponent */
+        v.u += 0xFFFU + ((v.u >> 13) & 1U);
+        half = (v.u - 0x38000000U) >> 13;
+    }
+    else
+    {
+        /* Subnormal value or zero: adding 0.5 aligns the value on the 2^-24 unit
+           and the FPU rounds it to nearest even */
+        v.f += 0.5f;
+        half = v.u - 0x3F000000U;
+    }
+
+    return (fp16_t)(sign | half);
+#endif
+}
+
 #undef INDEX_MASK
 
 #ifdef   __cplusplus
@@ -0,0 +1,112 @@
+/******************************************************************************
+ * @file     arm_spline_search.h
+ * @brief    Private header file for CMSIS DSP Library
+ * @version  V1.16.1
+ * @date     18 October 2026
+ ******************************************************************************/
+/*
+ * Copyright (c) 2010-2026 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ARM_SPLINE_SEARCH_H_
+#define ARM_SPLINE_SEARCH_H_
+
+#include "dsp/interpolation_functions.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief  Index of the spline segment of a query point.
+ * @param[in] x   points to the x values of the known data points (sorted)
+ * @param[in] n   number of known data points (at least 2)
+ * @param[in] xq  query point
+ * @return  largest i in [0, n-2] such that x[i] <= xq, or 0 when xq < x[0]
+ */
+__STATIC_FORCEINLINE uint32_t arm_spline_segment_f32(
+  const float32_t * x,
+        uint32_t n,
+        float32_t xq)
+{
+  uint32_t lo = 0U, hi = n - 1U, mid;
+
+  while ((hi - lo) > 1U)
+  {
+    mid = (lo + hi) >> 1U;
+    if (x[mid] <= xq)
+    {
+      lo = mid;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+
+  return (lo);
+}
+
+/**
+ * @brief  Index of the spline segment of a Q31 query point.
+ * @param[in] x   points to the x values of the known data points (sorted)
+ * @param[in] n   number of known data points (at least 2)
+ * @param[in] xq  query point
+ * @return  largest i in [0, n-2] such that x[i] <= xq, or 0 when xq < x[0]
+ */
+__STATIC_FORCEINLINE uint32_t arm_spline_segment_q31(
+  const q31_t * x,
+        uint32_t n,
+        q31_t xq)
+{
+  uint32_t lo = 0U, hi = n - 1U, mid;
+
+  while ((hi - lo) > 1U)
+  {
+    mid = (lo + hi) >> 1U;
+    if (x[mid] <= xq)
+    {
+      lo = mid;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+
+  return (lo);
+}
+
+/**
+ * @brief  Horner evaluation of a + b*t + c*t^2 + d*t^3
+ */
+__STATIC_FORCEINLINE float32_t arm_spline_horner_f32(
+  float32_t a,
+  float32_t b,
+  float32_t c,
+  float32_t d,
+  float32_t t)
+{
+  return (a + t * (b + t * (c + t * d)));
+}
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* ARM_SPLINE_SEARCH_H_ */
@@ -0,0 +1,148 @@
+/******************************************************************************
+ * @file     arm_vec_sse.h
+ * @brief    Private header file for CMSIS DSP Library
+ * @version  V1.16.1
+ * @date     18 October 2026
+ ******************************************************************************/
+/*
+ * Copyright (c) 2010-2026 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ARM_VEC_SSE_H_
+#define ARM_VEC_SSE_H_
+
+#include "arm_math_types.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+#if defined(ARM_MATH_SSE) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+/*
+  Widest float32 vector of the x86 host.
+
+  Kernels written with these wrappers use 8 lanes when built with AVX2
+  and 4 lanes when built with SSE4.1 only.
+  Only separate multiply and add are used (no FMA) so that a lane computes
+  exactly the same operations as the scalar code.
+ */
+#if defined(ARM_MATH_AVX2)
+
+typedef __m256 f32xN_t;
+
+#define ARM_SSE_LANES           8U
+#define arm_sse_zero()          _mm256_setzero_ps()
+#define arm_sse_dup(x)          _mm256_set1_ps(x)
+#define arm_sse_load(p)         _mm256_loadu_ps(p)
+#define arm_sse_store(p, v)     _mm256_storeu_ps((p), (v))
+#define arm_sse_add(a, b)       _mm256_add_ps((a), (b))
+#define arm_sse_mul(a, b)       _mm256_mul_ps((a), (b))
+#define arm_sse_sqrt(a)         _mm256_sqrt_ps(a)
+
+/* Horizontal sum of all lanes */
+__STATIC_FORCEINLINE float32_t arm_sse_hsum(f32xN_t v)
+{
+  __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+
+  s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+  s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 1));
+  return (_mm_cvtss_f32(s));
+}
+
+/* Squared magnitude of 8 complex values stored in (re, im) order */
+__STATIC_FORCEINLINE f32xN_t arm_sse_cmplx_mag_squared(const float32_t *p)
+{
+  f32xN_t a = _mm256_loadu_ps(p);
+  f32xN_t b = _mm256_loadu_ps(p + 8);
+  f32xN_t s;
+
+  /* hadd works on 128-bit halves and returns values 0,1,4,5,2,3,6,7 */
+  s = _mm256_hadd_ps(_mm256_mul_ps(a, a), _mm256_mul_ps(b, b));
+  return (_mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(s), 0xD8)));
+}
+
+#else
+
+typedef __m128 f32xN_t;
+
+#define ARM_SSE_LANES           4U
+#define arm_sse_zero()          _mm_setzero_ps()
+#define arm_sse_dup(x)          _mm_set1_ps(x)
+#define arm_sse_load(p)         _mm_loadu_ps(p)
+#define arm_sse_store(p, v)     _mm_storeu_ps((p), (v))
+#define arm_sse_add(a, b)       _mm_add_ps((a), (b))
+#define arm_sse_mul(a, b)       _mm_mul_ps((a), (b))
+#define arm_sse_sqrt(a)         _mm_sqrt_ps(a)
+
+/* Horizontal sum of all lanes */
+__STATIC_FORCEINLINE float32_t arm_sse_hsum(f32xN_t v)
+{
+  __m128 s = _mm_add_ps(v, _mm_movehl_ps(v, v));
+
+  s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 1));
+  return (_mm_cvtss_f32(s));
+}
+
+/* Squared magnitude of 4 complex values stored in (re, im) order */
+__STATIC_FORCEINLINE f32xN_t arm_sse_cmplx_mag_squared(const float32_t *p)
+{
+  __m128 a = _mm_loadu_ps(p);
+  __m128 b = _mm_loadu_ps(p + 4);
+
+  return (_mm_hadd_ps(_mm_mul_ps(a, a), _mm_mul_ps(b, b)));
+}
+
+#endif /* defined(ARM_MATH_AVX2) */
+
+/*
+  Complex helpers on 2 complex values stored in (re, im) order in a 128-bit register.
+ */
+
+/* x - j * y */
+__STATIC_FORCEINLINE __m128 arm_sse_cmplx_sub_jmul(__m128 x, __m128 y)
+{
+  __m128 ys = _mm_shuffle_ps(y, y, _MM_SHUFFLE(2, 3, 0, 1));
+
+  return (_mm_add_ps(x, _mm_xor_ps(ys, _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f))));
+}
+
+/* x + j * y */
+__STATIC_FORCEINLINE __m128 arm_sse_cmplx_add_jmul(__m128 x, __m128 y)
+{
+  __m128 ys = _mm_shuffle_ps(y, y, _MM_SHUFFLE(2, 3, 0, 1));
+
+  return (_mm_add_ps(x, _mm_xor_ps(ys, _mm_set_ps(0.0f, -0.0f, 0.0f, -0.0f))));
+}
+
+/* x * conj(w) where co and si hold the real and imaginary parts of w duplicated per complex value */
+__STATIC_FORCEINLINE __m128 arm_sse_cmplx_mul_conj(__m128 x, __m128 co, __m128 si)
+{
+  __m128 xs = _mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 3, 0, 1));
+
+  return (_mm_add_ps(_mm_mul_ps(co, x),
+                     _mm_xor_ps(_mm_mul_ps(si, xs), _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f))));
+}
+
+#endif /* defined(ARM_MATH_SSE) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* ARM_VEC_SSE_H_ */
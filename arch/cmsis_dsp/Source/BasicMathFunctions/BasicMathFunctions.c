@@ -40,6 +40,8 @@
 #include "arm_and_u32.c"
 #include "arm_and_u8.c"
 #include "arm_dot_prod_f32.c"
+#include "arm_dot_prod_bf16_f32.c"
+#include "arm_dot_prod_f16_f32.c"
 #include "arm_dot_prod_f64.c"
 #include "arm_dot_prod_q15.c"
 #include "arm_dot_prod_q31.c"
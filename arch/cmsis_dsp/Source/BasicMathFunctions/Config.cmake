@@ -15,6 +15,8 @@ set(SRCF32 BasicMathFunctions/arm_abs_f32.c
 BasicMathFunctions/arm_add_f32.c
 BasicMathFunctions/arm_clip_f32.c
 BasicMathFunctions/arm_dot_prod_f32.c
+BasicMathFunctions/arm_dot_prod_bf16_f32.c
+BasicMathFunctions/arm_dot_prod_f16_f32.c
 BasicMathFunctions/arm_mult_f32.c
 BasicMathFunctions/arm_negate_f32.c
 BasicMathFunctions/arm_offset_f32.c
@@ -0,0 +1,115 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_dot_prod_bf16_f32.c
+ * Description:  bf16 dot product with floating-point accumulation
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.16.1
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/basic_math_functions.h"
+
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicDotProd
+  @{
+ */
+
+/**
+  @brief         Dot product of bf16 vectors with floating-point accumulation.
+  @param[in]     pSrcA      points to the first input vector.
+  @param[in]     pSrcB      points to the second input vector.
+  @param[in]     blockSize  number of samples in each vector.
+  @param[out]    result     output result returned here.
+
+  @par           Details
+                   The bf16 operands are only a storage format. They are converted to
+                   float32_t when loaded and the accumulation is done in float32_t.
+                   This halves the memory needed by large tables without requiring
+                   native bf16 arithmetic.
+ */
+ARM_DSP_ATTRIBUTE void arm_dot_prod_bf16_f32(
+  const bf16_t * pSrcA,
+  const bf16_t * pSrcB,
+        uint32_t blockSize,
+        float32_t * result)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+        float32_t sum = 0.0f;                          /* Temporary return variable */
+
+#if defined (ARM_MATH_LOOPUNROLL) && !defined(ARM_MATH_AUTOVECTORIZE)
+        float32_t sum2 = 0.0f;                         /* Second accumulator */
+
+  /* Loop unrolling: Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling. Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C = A[0]* B[0] + A[1]* B[1] + A[2]* B[2] + .....+ A[blockSize-1]* B[blockSize-1] */
+
+    /* Two accumulators to break the dependency chain on the FPU */
+    sum  += arm_bf16_to_f32(pSrcA[0]) * arm_bf16_to_f32(pSrcB[0]);
+    sum2 += arm_bf16_to_f32(pSrcA[1]) * arm_bf16_to_f32(pSrcB[1]);
+    sum  += arm_bf16_to_f32(pSrcA[2]) * arm_bf16_to_f32(pSrcB[2]);
+    sum2 += arm_bf16_to_f32(pSrcA[3]) * arm_bf16_to_f32(pSrcB[3]);
+
+    pSrcA += 4;
+    pSrcB += 4;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  sum += sum2;
+
+  /* Loop unrolling: Compute remaining outputs */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = A[0]* B[0] + A[1]* B[1] + A[2]* B[2] + .....+ A[blockSize-1]* B[blockSize-1] */
+    sum += arm_bf16_to_f32(*pSrcA++) * arm_bf16_to_f32(*pSrcB++);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Store result in destination buffer */
+  *result = sum;
+}
+
+/**
+  @} end of BasicDotProd group
+ */
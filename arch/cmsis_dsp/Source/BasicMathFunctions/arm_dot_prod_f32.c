@@ -28,6 +28,10 @@
 
 #include "dsp/basic_math_functions.h"
 
+#if defined(ARM_MATH_SSE) && !defined(ARM_MATH_AUTOVECTORIZE)
+#include "arm_vec_sse.h"
+#endif
+
 /**
   @ingroup groupMath
  */
@@ -56,6 +60,14 @@
   @param[in]     pSrcB      points to the second input vector.
   @param[in]     blockSize  number of samples in each vector.
   @param[out]    result     output result returned here.
+
+  @par           x86 host acceleration
+                   With <code>ARM_MATH_SSE</code> the products are summed in 4 (SSE) or 8 (AVX2)
+                   partial sums. The result is not bit-exact with the scalar version:
+                   the difference is bounded by the usual summation error,
+                   about <code>blockSize * eps * sum(|pSrcA[n] * pSrcB[n]|)</code>.
+                   The other accelerated float kernels (FIR, biquad DF2T, CFFT/RFFT,
+                   matrix multiplication and complex magnitude) give the same results as the scalar code.
  */
 
 #if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
@@ -170,6 +182,30 @@ ARM_DSP_ATTRIBUTE void arm_dot_prod_f32(
     /* Tail */
     blkCnt = blockSize & 0x3;
 
+#elif defined(ARM_MATH_SSE) && !defined(ARM_MATH_AUTOVECTORIZE)
+    f32xN_t accum = arm_sse_zero();
+
+    /* Compute ARM_SSE_LANES partial sums at a time */
+    blkCnt = blockSize / ARM_SSE_LANES;
+
+    while (blkCnt > 0U)
+    {
+        /* C = A[0]*B[0] + A[1]*B[1] + A[2]*B[2] + ... + A[blockSize-1]*B[blockSize-1] */
+        accum = arm_sse_add(accum, arm_sse_mul(arm_sse_load(pSrcA), arm_sse_load(pSrcB)));
+
+        /* Increment pointers */
+        pSrcA += ARM_SSE_LANES;
+        pSrcB += ARM_SSE_LANES;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    sum = arm_sse_hsum(accum);
+
+    /* Tail */
+    blkCnt = blockSize % ARM_SSE_LANES;
+
 #else
 #if defined (ARM_MATH_LOOPUNROLL) && !defined(ARM_MATH_AUTOVECTORIZE)
 
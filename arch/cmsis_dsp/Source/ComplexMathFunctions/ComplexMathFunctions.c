@@ -33,6 +33,8 @@
 #include "arm_cmplx_dot_prod_q15.c"
 #include "arm_cmplx_dot_prod_q31.c"
 #include "arm_cmplx_mag_f32.c"
+#include "arm_cmplx_mag_f16_f32.c"
+#include "arm_cmplx_mag_bf16_f32.c"
 #include "arm_cmplx_mag_f64.c"
 #include "arm_cmplx_mag_q15.c"
 #include "arm_cmplx_mag_fast_q15.c"
@@ -19,6 +19,8 @@ target_sources(CMSISDSP PRIVATE ComplexMathFunctions/arm_cmplx_dot_prod_f32.c)
 target_sources(CMSISDSP PRIVATE ComplexMathFunctions/arm_cmplx_dot_prod_q15.c)
 target_sources(CMSISDSP PRIVATE ComplexMathFunctions/arm_cmplx_dot_prod_q31.c)
 target_sources(CMSISDSP PRIVATE ComplexMathFunctions/arm_cmplx_mag_f32.c)
+target_sources(CMSISDSP PRIVATE ComplexMathFunctions/arm_cmplx_mag_f16_f32.c)
+target_sources(CMSISDSP PRIVATE ComplexMathFunctions/arm_cmplx_mag_bf16_f32.c)
 target_sources(CMSISDSP PRIVATE ComplexMathFunctions/arm_cmplx_mag_f64.c)
 target_sources(CMSISDSP PRIVATE ComplexMathFunctions/arm_cmplx_mag_squared_f32.c)
 target_sources(CMSISDSP PRIVATE ComplexMathFunctions/arm_cmplx_mag_squared_f64.c)
@@ -0,0 +1,109 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cmplx_mag_bf16_f32.c
+ * Description:  bf16 complex magnitude computed with floating-point arithmetic
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.16.1
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/complex_math_functions.h"
+
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_mag
+  @{
+ */
+
+/**
+  @brief         bf16 complex magnitude computed with floating-point arithmetic.
+  @param[in]     pSrc        points to input vector
+  @param[out]    pDst        points to output vector
+  @param[in]     numSamples  number of samples in each vector
+
+  @par           Details
+                   Input and output are stored in bf16. The squares, the sum and the
+                   square root are computed in float32_t so that the function does not
+                   require native bf16 arithmetic and keeps the float32_t precision in
+                   intermediate results.
+ */
+ARM_DSP_ATTRIBUTE void arm_cmplx_mag_bf16_f32(
+  const bf16_t * pSrc,
+        bf16_t * pDst,
+        uint32_t numSamples)
+{
+        uint32_t blkCnt;                               /* loop counter */
+        float32_t real, imag;                          /* Temporary variables to hold input values */
+        float32_t res;                                 /* Temporary variable to hold output value */
+
+#if defined (ARM_MATH_LOOPUNROLL) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+  /* Loop unrolling: Compute 2 outputs at a time */
+  blkCnt = numSamples >> 1U;
+
+  while (blkCnt > 0U)
+  {
+    /* C[0] = sqrt(A[0] * A[0] + A[1] * A[1]) */
+    real = arm_bf16_to_f32(*pSrc++);
+    imag = arm_bf16_to_f32(*pSrc++);
+    arm_sqrt_f32((real * real) + (imag * imag), &res);
+    *pDst++ = arm_f32_to_bf16(res);
+
+    real = arm_bf16_to_f32(*pSrc++);
+    imag = arm_bf16_to_f32(*pSrc++);
+    arm_sqrt_f32((real * real) + (imag * imag), &res);
+    *pDst++ = arm_f32_to_bf16(res);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Loop unrolling: Compute remaining outputs */
+  blkCnt = numSamples & 1U;
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = numSamples;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  while (blkCnt > 0U)
+  {
+    /* C[0] = sqrt(A[0] * A[0] + A[1] * A[1]) */
+    real = arm_bf16_to_f32(*pSrc++);
+    imag = arm_bf16_to_f32(*pSrc++);
+    arm_sqrt_f32((real * real) + (imag * imag), &res);
+    *pDst++ = arm_f32_to_bf16(res);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+  @} end of cmplx_mag group
+ */
@@ -72,6 +72,10 @@
 #include "arm_vec_math.h"
 #endif
 
+#if defined(ARM_MATH_SSE) && !defined(ARM_MATH_AUTOVECTORIZE)
+#include "arm_vec_sse.h"
+#endif
+
 #if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
 
 #include "arm_helium_utils.h"
@@ -206,6 +210,25 @@ ARM_DSP_ATTRIBUTE void arm_cmplx_mag_f32(
 
   blkCnt = numSamples & 7;
 
+#elif defined(ARM_MATH_SSE) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+  /* Compute ARM_SSE_LANES outputs at a time */
+  blkCnt = numSamples / ARM_SSE_LANES;
+
+  while (blkCnt > 0U)
+  {
+    /* out = sqrt((real * real) + (imag * imag)) */
+    arm_sse_store(pDst, arm_sse_sqrt(arm_sse_cmplx_mag_squared(pSrc)));
+
+    pSrc += 2U * ARM_SSE_LANES;
+    pDst += ARM_SSE_LANES;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = numSamples % ARM_SSE_LANES;
+
 #else
 
 #if defined (ARM_MATH_LOOPUNROLL) && !defined(ARM_MATH_AUTOVECTORIZE)
@@ -59,10 +59,14 @@ target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_decimate_init_q31.c)
 target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_decimate_q15.c)
 target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_decimate_q31.c)
 target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_f32.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_f16_f32.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_bf16_f32.c)
 target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_f64.c)
 target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_fast_q15.c)
 target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_fast_q31.c)
 target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_init_f32.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_init_f16_f32.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_init_bf16_f32.c)
 target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_init_f64.c)
 target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_init_q15.c)
 target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_init_q31.c)
@@ -108,6 +112,14 @@ target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_lms_q15.c)
 target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_lms_q31.c)
 target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_levinson_durbin_f32.c)
 target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_levinson_durbin_q31.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_lpc_analysis_f32.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_lpc_analysis_init_f32.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_lpc_analysis_init_q31.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_lpc_analysis_q31.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_lpc_synthesis_init_f32.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_lpc_synthesis_init_q31.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_lpc_to_lsf_f32.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_lpc_to_lsf_q31.c)
 
 if ((NOT ARMAC5) AND (NOT DISABLEFLOAT16))
 target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_f16.c)
@@ -81,10 +81,14 @@
 #include "arm_fir_decimate_q15.c"
 #include "arm_fir_decimate_q31.c"
 #include "arm_fir_f32.c"
+#include "arm_fir_f16_f32.c"
+#include "arm_fir_bf16_f32.c"
 #include "arm_fir_f64.c"
 #include "arm_fir_fast_q15.c"
 #include "arm_fir_fast_q31.c"
 #include "arm_fir_init_f32.c"
+#include "arm_fir_init_f16_f32.c"
+#include "arm_fir_init_bf16_f32.c"
 #include "arm_fir_init_f64.c"
 #include "arm_fir_init_q15.c"
 #include "arm_fir_init_q31.c"
@@ -133,3 +137,12 @@
 
 #include "arm_levinson_durbin_f32.c"
 #include "arm_levinson_durbin_q31.c"
+
+#include "arm_lpc_analysis_f32.c"
+#include "arm_lpc_analysis_init_f32.c"
+#include "arm_lpc_analysis_init_q31.c"
+#include "arm_lpc_analysis_q31.c"
+#include "arm_lpc_synthesis_init_f32.c"
+#include "arm_lpc_synthesis_init_q31.c"
+#include "arm_lpc_to_lsf_f32.c"
+#include "arm_lpc_to_lsf_q31.c"
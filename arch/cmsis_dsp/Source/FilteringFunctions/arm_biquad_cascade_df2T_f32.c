@@ -341,6 +341,148 @@ ARM_DSP_ATTRIBUTE void arm_biquad_cascade_df2T_f32(
       stageCnt--;
    }
 }
+#elif defined(ARM_MATH_SSE) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+/*
+  One step of 4 consecutive stages. Lane s processes the sample that lane s-1
+  produced at the previous step so the 4 recursions run in parallel.
+  The operations of each lane are those of the scalar loop.
+ */
+#define BIQUAD_DF2T_SSE_STEP(Xn, acc, d1, d2, nd1, nd2)  \
+  acc = _mm_add_ps(_mm_mul_ps(b0, Xn), d1);              \
+  nd1 = _mm_add_ps(_mm_mul_ps(b1, Xn), d2);              \
+  nd1 = _mm_add_ps(nd1, _mm_mul_ps(a1, acc));            \
+  nd2 = _mm_mul_ps(b2, Xn);                              \
+  nd2 = _mm_add_ps(nd2, _mm_mul_ps(a2, acc))
+
+ARM_DSP_ATTRIBUTE void arm_biquad_cascade_df2T_f32(
+  const arm_biquad_cascade_df2T_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const float32_t *pIn = pSrc;                         /* Source pointer */
+        float32_t *pOut = pDst;                        /* Destination pointer */
+        float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+        float32_t acc1;                                /* Accumulator */
+        float32_t b0s, b1s, b2s, a1s, a2s;             /* Filter coefficients */
+        float32_t Xn1;                                 /* Temporary input */
+        float32_t d1s, d2s;                            /* State variables */
+        uint32_t sample, stage = S->numStages;         /* Loop counters */
+        uint32_t t;                                    /* Wavefront step */
+  const __m128i laneIdx = _mm_set_epi32(3, 2, 1, 0);
+        __m128 b0, b1, b2, a1, a2;                     /* Coefficients of 4 stages */
+        __m128 d1, d2, nd1, nd2;                       /* State of 4 stages */
+        __m128 Xn, acc, active;
+
+  /* Groups of 4 stages */
+  while (stage >= 4U)
+  {
+     b0 = _mm_set_ps(pCoeffs[15], pCoeffs[10], pCoeffs[5], pCoeffs[0]);
+     b1 = _mm_set_ps(pCoeffs[16], pCoeffs[11], pCoeffs[6], pCoeffs[1]);
+     b2 = _mm_set_ps(pCoeffs[17], pCoeffs[12], pCoeffs[7], pCoeffs[2]);
+     a1 = _mm_set_ps(pCoeffs[18], pCoeffs[13], pCoeffs[8], pCoeffs[3]);
+     a2 = _mm_set_ps(pCoeffs[19], pCoeffs[14], pCoeffs[9], pCoeffs[4]);
+
+     d1 = _mm_set_ps(pState[6], pState[4], pState[2], pState[0]);
+     d2 = _mm_set_ps(pState[7], pState[5], pState[3], pState[1]);
+
+     acc = _mm_setzero_ps();
+
+     /* Stage s handles sample t - s at step t */
+     for (t = 0U; t < (blockSize + 3U); t++)
+     {
+        Xn = _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(acc), 4));
+        Xn = _mm_move_ss(Xn, _mm_set_ss((t < blockSize) ? pIn[t] : 0.0f));
+
+        BIQUAD_DF2T_SSE_STEP(Xn, acc, d1, d2, nd1, nd2);
+
+        if ((t >= 3U) && (t < blockSize))
+        {
+           d1 = nd1;
+           d2 = nd2;
+        }
+        else
+        {
+           /* Pipeline fill and drain: only update the stages having a sample */
+           active = _mm_castsi128_ps(_mm_and_si128(
+                      _mm_cmplt_epi32(laneIdx, _mm_set1_epi32((int32_t)t + 1)),
+                      _mm_cmpgt_epi32(_mm_add_epi32(laneIdx, _mm_set1_epi32((int32_t)blockSize)),
+                                      _mm_set1_epi32((int32_t)t))));
+           d1 = _mm_blendv_ps(d1, nd1, active);
+           d2 = _mm_blendv_ps(d2, nd2, active);
+        }
+
+        if (t >= 3U)
+        {
+           pOut[t - 3U] = _mm_cvtss_f32(_mm_shuffle_ps(acc, acc, _MM_SHUFFLE(3, 3, 3, 3)));
+        }
+     }
+
+     _mm_storeu_ps(pState, _mm_unpacklo_ps(d1, d2));
+     _mm_storeu_ps(pState + 4, _mm_unpackhi_ps(d1, d2));
+
+     pState += 8U;
+     pCoeffs += 20U;
+
+     /* The current stage output is given as the input to the next stage */
+     pIn = pDst;
+
+     stage -= 4U;
+  }
+
+  /* Remaining stages */
+  while (stage > 0U)
+  {
+     /* Reading the coefficients */
+     b0s = pCoeffs[0];
+     b1s = pCoeffs[1];
+     b2s = pCoeffs[2];
+     a1s = pCoeffs[3];
+     a2s = pCoeffs[4];
+
+     /* Reading the state values */
+     d1s = pState[0];
+     d2s = pState[1];
+
+     pCoeffs += 5U;
+
+     sample = blockSize;
+
+     while (sample > 0U) {
+        Xn1 = *pIn++;
+
+        acc1 = b0s * Xn1 + d1s;
+
+        d1s = b1s * Xn1 + d2s;
+        d1s += a1s * acc1;
+
+        d2s = b2s * Xn1;
+        d2s += a2s * acc1;
+
+        *pOut++ = acc1;
+
+        /* decrement loop counter */
+        sample--;
+     }
+
+     /* Store the updated state variables back into the state array */
+     pState[0] = d1s;
+     pState[1] = d2s;
+
+     pState += 2U;
+
+     /* The current stage output is given as the input to the next stage */
+     pIn = pDst;
+
+     /* Reset the output working pointer */
+     pOut = pDst;
+
+     /* decrement loop counter */
+     stage--;
+  }
+}
 #else
 
 ARM_DSP_ATTRIBUTE void arm_biquad_cascade_df2T_f32(
@@ -28,6 +28,10 @@
 
 #include "dsp/filtering_functions.h"
 
+#if defined(ARM_MATH_SSE) && !defined(ARM_MATH_AUTOVECTORIZE)
+#include "arm_vec_sse.h"
+#endif
+
 /**
   @ingroup groupFilters
  */
@@ -906,6 +910,129 @@ uint32_t blockSize)
       tapCnt--;
    }
 
+}
+#elif defined(ARM_MATH_SSE) && !defined(ARM_MATH_AUTOVECTORIZE)
+ARM_DSP_ATTRIBUTE void arm_fir_f32(
+  const arm_fir_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+        float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+        float32_t *px;                                 /* Temporary pointer for state buffer */
+  const float32_t *pb;                                 /* Temporary pointer for coefficient buffer */
+        float32_t acc0;                                /* Accumulator */
+        f32xN_t vacc0, vacc1;                          /* Vector accumulators */
+        f32xN_t c0;                                    /* Duplicated coefficient */
+        uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+        uint32_t i, tapCnt, blkCnt;                    /* Loop counters */
+
+  /* S->pState points to state array which contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = &(S->pState[(numTaps - 1U)]);
+
+  /* Compute 2 * ARM_SSE_LANES outputs at a time.
+   * Each lane accumulates the taps in the same order as the scalar version:
+   *
+   *    acc(n) =  b[numTaps-1] * x[n-numTaps-1] + b[numTaps-2] * x[n-numTaps-2] + ... + b[0] * x[n]
+   */
+  blkCnt = blockSize / (2U * ARM_SSE_LANES);
+
+  while (blkCnt > 0U)
+  {
+    /* Copy new input samples into the state buffer */
+    for (i = 0U; i < 2U * ARM_SSE_LANES; i++)
+    {
+      *pStateCurnt++ = *pSrc++;
+    }
+
+    vacc0 = arm_sse_zero();
+    vacc1 = arm_sse_zero();
+
+    px = pState;
+    pb = pCoeffs;
+
+    i = numTaps;
+
+    while (i > 0U)
+    {
+      c0 = arm_sse_dup(*pb++);
+
+      vacc0 = arm_sse_add(vacc0, arm_sse_mul(arm_sse_load(px), c0));
+      vacc1 = arm_sse_add(vacc1, arm_sse_mul(arm_sse_load(px + ARM_SSE_LANES), c0));
+      px++;
+
+      i--;
+    }
+
+    arm_sse_store(pDst, vacc0);
+    arm_sse_store(pDst + ARM_SSE_LANES, vacc1);
+    pDst += 2U * ARM_SSE_LANES;
+
+    /* Advance state pointer for the next block */
+    pState = pState + 2U * ARM_SSE_LANES;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Compute remaining output samples */
+  blkCnt = blockSize % (2U * ARM_SSE_LANES);
+
+  while (blkCnt > 0U)
+  {
+    /* Copy one sample at a time into state buffer */
+    *pStateCurnt++ = *pSrc++;
+
+    /* Set the accumulator to zero */
+    acc0 = 0.0f;
+
+    /* Initialize state pointer */
+    px = pState;
+
+    /* Initialize Coefficient pointer */
+    pb = pCoeffs;
+
+    i = numTaps;
+
+    /* Perform the multiply-accumulates */
+    while (i > 0U)
+    {
+      acc0 += *px++ * *pb++;
+
+      i--;
+    }
+
+    /* Store result in destination buffer. */
+    *pDst++ = acc0;
+
+    /* Advance state pointer by 1 for the next sample */
+    pState = pState + 1U;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+     Now copy the last numTaps - 1 samples to the start of the state buffer.
+     This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  /* Copy data */
+  tapCnt = (numTaps - 1U);
+
+  while (tapCnt > 0U)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement loop counter */
+    tapCnt--;
+  }
+
 }
 #else
 ARM_DSP_ATTRIBUTE void arm_fir_f32(
@@ -0,0 +1,172 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_lpc_analysis_f32.c
+ * Description:  Floating-point LPC analysis
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.16.1
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup LPC Linear Prediction Analysis and Synthesis
+
+  This set of functions implements the linear prediction front end used by
+  speech codecs. One call to the analysis function processes a frame of
+  <code>frameLength</code> samples and computes:
+  - the windowed autocorrelation up to lag <code>order</code>,
+  - the lag-windowed autocorrelation,
+  - the prediction coefficients and prediction error (Levinson Durbin),
+  - optionally the line spectral frequencies.
+
+  @par           Algorithm
+  <pre>
+      xw(n)   = w(n) * x(n)                          for n = 0, 1, ..., N-1
+      r(k)    = lw(k) * sum xw(n) * xw(n-k)          for k = 0, 1, ..., P
+      x(n)   ~= a0 * x(n-1) + a1 * x(n-2) + ... + aP-1 * x(n-P)
+  </pre>
+  @par
+                   The autocorrelation is computed with the dot product kernel for each lag.
+                   When an RFFT instance is provided, it is computed instead from the power spectrum
+                   of the zero-padded frame. This is faster for long frames. The RFFT length must be
+                   at least <code>frameLength + order</code> to avoid circular aliasing.
+  @par
+                   The lag window <code>lw</code> is typically a Gaussian used for bandwidth expansion.
+                   White noise correction is obtained by setting <code>lw(0)</code> slightly above 1.
+  @par
+                   The synthesis filter 1/A(z) is implemented with the IIR lattice filter.
+                   The prediction coefficients are converted to reflection coefficients by
+                   the initialization function which then initializes an IIR lattice instance.
+                   Samples are then filtered with \ref arm_iir_lattice_f32 or \ref arm_iir_lattice_q31.
+
+  @par           Scratch Buffer
+                   The floating-point analysis needs a scratch buffer of length <code>frameLength + order + 1</code>
+                   when the direct kernel is used and of length <code>2 * fftLen</code> when the RFFT is used.
+                   The Q31 analysis needs a scratch buffer of length <code>frameLength + order + 1</code>.
+ */
+
+/**
+  @addtogroup LPC
+  @{
+ */
+
+/**
+  @brief         Floating-point LPC analysis.
+  @param[in]     S        points to an instance of the floating-point LPC analysis structure
+  @param[in]     pSrc     points to the frame of input samples (length frameLength)
+  @param[out]    pCoeffs  points to the prediction coefficients (length order)
+  @param[out]    pLsf     points to the line spectral frequencies in radians (length order), or NULL
+  @param[out]    pErr     points to the prediction error
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS                 : Operation successful
+                   - \ref ARM_MATH_SINGULAR                : Frame energy is zero
+                   - \ref ARM_MATH_DECOMPOSITION_FAILURE   : Line spectral frequencies could not be found
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_lpc_analysis_f32(
+  const arm_lpc_analysis_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pCoeffs,
+        float32_t * pLsf,
+        float32_t * pErr)
+{
+        float32_t *pWin = S->pScratch;                   /* Windowed frame */
+        float32_t *pPhi;                                 /* Autocorrelation */
+        uint32_t frameLength = S->frameLength;           /* Frame length */
+        uint32_t order = S->order;                       /* Prediction order */
+        uint32_t k;                                      /* Loop counter */
+
+  /* Window the frame */
+  if (S->pWindow != NULL)
+  {
+    arm_mult_f32(pSrc, S->pWindow, pWin, frameLength);
+  }
+  else
+  {
+    arm_copy_f32(pSrc, pWin, frameLength);
+  }
+
+  if (S->pRfft != NULL)
+  {
+    uint32_t fftLen = S->pRfft->fftLenRFFT;
+    float32_t *pSpec = pWin + fftLen;
+
+    /* Zero pad the frame */
+    arm_fill_f32(0.0f, pWin + frameLength, fftLen - frameLength);
+
+    arm_rfft_fast_f32(S->pRfft, pWin, pSpec, 0);
+
+    /* Power spectrum in the packed RFFT format.
+       DC and Nyquist bins are real and stored in the first two slots. */
+    pWin[0] = pSpec[0] * pSpec[0];
+    pWin[1] = pSpec[1] * pSpec[1];
+    for (k = 1U; k < (fftLen >> 1U); k++)
+    {
+      float32_t re = pSpec[2U * k];
+      float32_t im = pSpec[2U * k + 1U];
+
+      pWin[2U * k]      = re * re + im * im;
+      pWin[2U * k + 1U] = 0.0f;
+    }
+
+    /* Inverse transform gives the autocorrelation in pSpec */
+    arm_rfft_fast_f32(S->pRfft, pWin, pSpec, 1);
+    pPhi = pSpec;
+  }
+  else
+  {
+    pPhi = pWin + frameLength;
+
+    for (k = 0U; k <= order; k++)
+    {
+      arm_dot_prod_f32(pWin + k, pWin, frameLength - k, &pPhi[k]);
+    }
+  }
+
+  if (pPhi[0] <= 0.0f)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  /* Lag window */
+  if (S->pLagWindow != NULL)
+  {
+    arm_mult_f32(pPhi, S->pLagWindow, pPhi, order + 1U);
+  }
+
+  arm_levinson_durbin_f32(pPhi, pCoeffs, pErr, (int)order);
+
+  if (pLsf != NULL)
+  {
+    return (arm_lpc_to_lsf_f32(pCoeffs, pLsf, (uint16_t)order));
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of LPC group
+ */
@@ -0,0 +1,89 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_lpc_analysis_init_f32.c
+ * Description:  Floating-point LPC analysis initialization function
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.16.1
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup LPC
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point LPC analysis.
+  @param[in,out] S            points to an instance of the floating-point LPC analysis structure
+  @param[in]     order        prediction order (1 to ARM_LPC_MAX_ORDER)
+  @param[in]     frameLength  number of samples in an analysis frame
+  @param[in]     pWindow      points to the analysis window of length frameLength, or NULL
+  @param[in]     pLagWindow   points to the lag window of length order+1, or NULL
+  @param[in]     pRfft        points to an initialized RFFT instance, or NULL for the direct kernel
+  @param[in]     pScratch     points to the scratch buffer
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : order is out of range or RFFT is too short
+
+  @par           Details
+                   The scratch buffer length is <code>frameLength + order + 1</code> without RFFT
+                   and <code>2 * fftLen</code> with RFFT. The RFFT length must be at least
+                   <code>frameLength + order</code>.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_lpc_analysis_init_f32(
+        arm_lpc_analysis_instance_f32 * S,
+        uint16_t order,
+        uint32_t frameLength,
+  const float32_t * pWindow,
+  const float32_t * pLagWindow,
+  const arm_rfft_fast_instance_f32 * pRfft,
+        float32_t * pScratch)
+{
+  if ((order == 0U) || (order > ARM_LPC_MAX_ORDER) || (frameLength <= order))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  if ((pRfft != NULL) && (pRfft->fftLenRFFT < (frameLength + order)))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->order = order;
+  S->frameLength = frameLength;
+  S->pWindow = pWindow;
+  S->pLagWindow = pLagWindow;
+  S->pRfft = pRfft;
+  S->pScratch = pScratch;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of LPC group
+ */
@@ -0,0 +1,76 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_lpc_analysis_init_q31.c
+ * Description:  Q31 LPC analysis initialization function
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.16.1
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup LPC
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q31 LPC analysis.
+  @param[in,out] S            points to an instance of the Q31 LPC analysis structure
+  @param[in]     order        prediction order (1 to ARM_LPC_MAX_ORDER)
+  @param[in]     frameLength  number of samples in an analysis frame
+  @param[in]     pWindow      points to the analysis window of length frameLength, or NULL
+  @param[in]     pLagWindow   points to the lag window of length order+1, or NULL
+  @param[in]     pScratch     points to the scratch buffer of length frameLength+order+1
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : order is out of range
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_lpc_analysis_init_q31(
+        arm_lpc_analysis_instance_q31 * S,
+        uint16_t order,
+        uint32_t frameLength,
+  const q31_t * pWindow,
+  const q31_t * pLagWindow,
+        q31_t * pScratch)
+{
+  if ((order == 0U) || (order > ARM_LPC_MAX_ORDER) || (frameLength <= order))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->order = order;
+  S->frameLength = frameLength;
+  S->pWindow = pWindow;
+  S->pLagWindow = pLagWindow;
+  S->pScratch = pScratch;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of LPC group
+ */
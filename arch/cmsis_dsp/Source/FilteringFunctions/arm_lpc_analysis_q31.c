@@ -0,0 +1,143 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_lpc_analysis_q31.c
+ * Description:  Q31 LPC analysis
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.16.1
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup LPC
+  @{
+ */
+
+/**
+  @brief         Q31 LPC analysis.
+  @param[in]     S        points to an instance of the Q31 LPC analysis structure
+  @param[in]     pSrc     points to the frame of input samples (length frameLength)
+  @param[out]    pCoeffs  points to the prediction coefficients (length order)
+  @param[out]    pLsf     points to the line spectral frequencies normalized by pi (length order), or NULL
+  @param[out]    pErr     points to the normalized prediction error
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS                 : Operation successful
+                   - \ref ARM_MATH_SINGULAR                : Frame energy is zero
+                   - \ref ARM_MATH_DECOMPOSITION_FAILURE   : Line spectral frequencies could not be found
+
+  @par           Scaling and Overflow Behavior
+                   The autocorrelation is accumulated in 64 bits with \ref arm_dot_prod_q31
+                   and normalized so that r(0) lies in [0.5, 1). The prediction error is
+                   relative to this normalized r(0).
+  @par
+                   The lag window is applied with saturation so <code>lw(0)</code> cannot exceed 1.
+                   White noise correction must be folded into the other lags by dividing them by
+                   the correction factor.
+  @par
+                   As with \ref arm_levinson_durbin_q31, the prediction coefficients must be
+                   in the range [-1, 1).
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_lpc_analysis_q31(
+  const arm_lpc_analysis_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pCoeffs,
+        q31_t * pLsf,
+        q31_t * pErr)
+{
+        q31_t *pWin = S->pScratch;                       /* Windowed frame */
+        q31_t *pPhi = S->pScratch + S->frameLength;      /* Autocorrelation */
+        uint32_t frameLength = S->frameLength;           /* Frame length */
+        uint32_t order = S->order;                       /* Prediction order */
+        q63_t acc;                                       /* Accumulator */
+        uint32_t hi, lo;                                 /* Halves of r(0) */
+        int32_t shift;                                   /* Normalization shift */
+        uint32_t k;                                      /* Loop counter */
+
+  /* Window the frame */
+  if (S->pWindow != NULL)
+  {
+    arm_mult_q31(pSrc, S->pWindow, pWin, frameLength);
+  }
+  else
+  {
+    arm_copy_q31(pSrc, pWin, frameLength);
+  }
+
+  arm_dot_prod_q31(pWin, pWin, frameLength, &acc);
+  if (acc <= 0)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  /* Normalization of r(0) to [0.5, 1) */
+  hi = (uint32_t)((uint64_t)acc >> 32);
+  lo = (uint32_t)acc;
+  if (hi != 0U)
+  {
+    shift = 33 - (int32_t)__CLZ(hi);
+  }
+  else
+  {
+    shift = 1 - (int32_t)__CLZ(lo);
+  }
+
+  for (k = 0U; k <= order; k++)
+  {
+    if (k != 0U)
+    {
+      arm_dot_prod_q31(pWin + k, pWin, frameLength - k, &acc);
+    }
+
+    if (shift >= 0)
+    {
+      pPhi[k] = (q31_t)(acc >> shift);
+    }
+    else
+    {
+      pPhi[k] = (q31_t)(acc << -shift);
+    }
+  }
+
+  /* Lag window */
+  if (S->pLagWindow != NULL)
+  {
+    arm_mult_q31(pPhi, S->pLagWindow, pPhi, order + 1U);
+  }
+
+  arm_levinson_durbin_q31(pPhi, pCoeffs, pErr, (int)order);
+
+  if (pLsf != NULL)
+  {
+    return (arm_lpc_to_lsf_q31(pCoeffs, pLsf, (uint16_t)order));
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of LPC group
+ */
@@ -0,0 +1,188 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_lpc_synthesis_init_q31.c
+ * Description:  Q31 LPC synthesis lattice filter initialization function
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.16.1
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup LPC
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q31 LPC synthesis lattice filter.
+  @param[in,out] S          points to an instance of the Q31 IIR lattice structure
+  @param[in]     order      prediction order (1 to ARM_LPC_MAX_ORDER)
+  @param[in]     pCoeffs    points to the prediction coefficients (length order)
+  @param[out]    pkCoeffs   points to the reflection coefficient buffer (length order)
+  @param[out]    pvCoeffs   points to the ladder coefficient buffer (length order+1)
+  @param[in]     pState     points to the state buffer (length order+blockSize)
+  @param[in]     blockSize  number of samples to process
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : order is out of range or the synthesis filter is unstable
+
+  @par           Details
+                   Same as \ref arm_lpc_synthesis_init_f32.
+  @par           Scaling and Overflow Behavior
+                   The lower order prediction coefficients of a stable filter can exceed 1 even when
+                   the coefficients of order P are in Q31. The step-down recursion therefore keeps
+                   them in a block floating-point format: a Q31 mantissa per coefficient and a shift
+                   common to all of them, adjusted at each order so that the largest coefficient
+                   uses the full mantissa. Each step is computed with 64-bit intermediate results
+                   and no coefficient is saturated. A filter whose lower order coefficients would
+                   need a shift above 30 is rejected.
+  @par
+                   The step-down recursion amplifies the rounding of the prediction coefficients
+                   by 1/(1 - k*k) at each order. With reflection coefficients up to 0.6 in magnitude
+                   they are accurate to about 2e-6. Close to 1 in magnitude the rounding of the Q31
+                   input itself can make the filter unstable, and the function then returns
+                   \ref ARM_MATH_ARGUMENT_ERROR.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_lpc_synthesis_init_q31(
+        arm_iir_lattice_instance_q31 * S,
+        uint16_t order,
+  const q31_t * pCoeffs,
+        q31_t * pkCoeffs,
+        q31_t * pvCoeffs,
+        q31_t * pState,
+        uint32_t blockSize)
+{
+  q31_t a[ARM_LPC_MAX_ORDER];            /* Coefficients in Q(31 - shift) */
+  q63_t quot[ARM_LPC_MAX_ORDER];         /* Coefficients of the next order in Q(31 - shift) ... */
+  q31_t rem[ARM_LPC_MAX_ORDER];          /* ... and the remainders of their division */
+  uint32_t shift = 0U;                   /* Block exponent of a */
+  uint32_t m, j;
+
+  if ((order == 0U) || (order > ARM_LPC_MAX_ORDER))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  arm_copy_q31(pCoeffs, a, order);
+
+  /* Step-down recursion from order P to 1 */
+  for (m = order; m > 0U; m--)
+  {
+    q63_t kk = (q63_t)a[m - 1U] * (1LL << shift);
+    q31_t k;
+    q63_t d;
+    q63_t absMax = 0;
+
+    /* k = a(m-1) in Q31: |k| >= 1 means the filter is unstable */
+    if ((kk > 0x7FFFFFFFLL) || (kk <= -0x80000000LL))
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+    k = (q31_t)kk;
+
+    /* d = 1 - k * k in Q31 */
+    d = 0x7FFFFFFFLL - (((q63_t)k * k) >> 31);
+    if (d <= 0)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    /* The lattice filter uses the opposite sign convention */
+    pkCoeffs[order - m] = -k;
+
+    /* a(j) = (a(j) + k * a(m-2-j)) / (1 - k * k), in Q(62 - shift) before the division.
+       |a(j)| and |k * a(m-2-j)| are below 2^62 so the sum does not overflow.
+       The remainder keeps the bits below Q(31 - shift) for the renormalization. */
+    for (j = 0U; j < (m - 1U); j++)
+    {
+      q63_t num = ((q63_t)a[j] << 31) + (q63_t)k * a[m - 2U - j];
+
+      quot[j] = num / d;
+      rem[j] = (q31_t)(num % d);
+      if (quot[j] > absMax)
+      {
+        absMax = quot[j];
+      }
+      else if (-quot[j] > absMax)
+      {
+        absMax = -quot[j];
+      }
+    }
+
+    if (absMax > 0x7FFFFFFFLL)
+    {
+      /* Scale down with rounding until the largest coefficient fits in Q31 */
+      uint32_t s = 1U;
+
+      while (((absMax + ((q63_t)1 << (s - 1U))) >> s) > 0x7FFFFFFFLL)
+      {
+        s++;
+      }
+      shift += s;
+      if (shift > 30U)
+      {
+        return (ARM_MATH_ARGUMENT_ERROR);
+      }
+
+      for (j = 0U; j < (m - 1U); j++)
+      {
+        a[j] = (q31_t)((quot[j] + ((q63_t)1 << (s - 1U))) >> s);
+      }
+    }
+    else
+    {
+      /* Scale up, within Q31, with the bits of the remainder */
+      uint32_t s = 0U;
+
+      while ((s < shift) && (((absMax + 1) << (s + 1U)) <= 0x80000000LL))
+      {
+        s++;
+      }
+      shift -= s;
+
+      /* The rounding of the remainder can reach 2^31 by one LSB */
+      for (j = 0U; j < (m - 1U); j++)
+      {
+        q63_t fract = (q63_t)rem[j] * (1LL << s);
+
+        a[j] = clip_q63_to_q31((quot[j] * (1LL << s)) + ((fract + ((fract < 0) ? -(d >> 1) : (d >> 1))) / d));
+      }
+    }
+  }
+
+  /* All-pole output: only v0 is used */
+  arm_fill_q31(0, pvCoeffs, order);
+  pvCoeffs[order] = 0x7FFFFFFF;
+
+  arm_iir_lattice_init_q31(S, order, pkCoeffs, pvCoeffs, pState, blockSize);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of LPC group
+ */
@@ -0,0 +1,204 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_lpc_to_lsf_f32.c
+ * Description:  Floating-point conversion of prediction coefficients to line spectral frequencies
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.16.1
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+#define LSF_GRID_POINTS 128
+#define LSF_BISECTIONS  4
+
+/*
+  Evaluate f[0] T_m(x) + f[1] T_m-1(x) + ... + f[m-1] T_1(x) + f[m] / 2
+  with the Clenshaw recurrence.
+ */
+__STATIC_FORCEINLINE float32_t lsf_cheb_f32(float32_t x, const float32_t *f, uint32_t m)
+{
+  float32_t b0, b1 = 0.0f, b2 = 0.0f;
+  uint32_t i;
+
+  for (i = 0U; i < m; i++)
+  {
+    b0 = 2.0f * x * b1 - b2 + f[i];
+    b2 = b1;
+    b1 = b0;
+  }
+
+  return (x * b1 - b2 + 0.5f * f[m]);
+}
+
+/* Find the m roots of one polynomial on the frequency grid */
+static uint32_t lsf_roots_f32(const float32_t *f, uint32_t m, float32_t *pRoots)
+{
+  const float32_t step = PI / (float32_t)LSF_GRID_POINTS;
+  float32_t wLo, wHi, fLo, fHi;
+  uint32_t nb = 0U;
+  uint32_t i, j;
+
+  wLo = 0.0f;
+  fLo = lsf_cheb_f32(1.0f, f, m);
+
+  for (i = 1U; (i <= LSF_GRID_POINTS) && (nb < m); i++)
+  {
+    wHi = step * (float32_t)i;
+    fHi = lsf_cheb_f32(arm_cos_f32(wHi), f, m);
+
+    if (((fLo * fHi) < 0.0f) || (fHi == 0.0f))
+    {
+      float32_t a = wLo, b = wHi, fa = fLo, fb = fHi;
+
+      /* Refine the bracket by bisection */
+      for (j = 0U; j < LSF_BISECTIONS; j++)
+      {
+        float32_t wMid = 0.5f * (a + b);
+        float32_t fMid = lsf_cheb_f32(arm_cos_f32(wMid), f, m);
+
+        if ((fa * fMid) <= 0.0f)
+        {
+          b = wMid;
+          fb = fMid;
+        }
+        else
+        {
+          a = wMid;
+          fa = fMid;
+        }
+      }
+
+      /* Final linear interpolation */
+      if (fa != fb)
+      {
+        pRoots[nb] = a + (b - a) * fa / (fa - fb);
+      }
+      else
+      {
+        pRoots[nb] = 0.5f * (a + b);
+      }
+      nb++;
+    }
+
+    wLo = wHi;
+    fLo = fHi;
+  }
+
+  return (nb);
+}
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup LPC
+  @{
+ */
+
+/**
+  @brief         Conversion of floating-point prediction coefficients to line spectral frequencies.
+  @param[in]     pCoeffs  points to the prediction coefficients (length order)
+  @param[out]    pLsf     points to the line spectral frequencies (length order)
+  @param[in]     order    prediction order. Must be even and not greater than ARM_LPC_MAX_ORDER
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS                 : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR          : order is odd or out of range
+                   - \ref ARM_MATH_DECOMPOSITION_FAILURE   : Line spectral frequencies could not be found
+
+  @par           Details
+                   The prediction polynomial A(z) = 1 - a0 z^-1 - ... - aP-1 z^-P is split
+                   into the symmetric and antisymmetric polynomials
+  <pre>
+      P(z) = A(z) + z^-(P+1) A(1/z)
+      Q(z) = A(z) - z^-(P+1) A(1/z)
+  </pre>
+  @par
+                   The trivial roots at z=-1 and z=1 are removed and the remaining
+                   polynomials are evaluated as Chebyshev series in cos(w).
+                   Roots are located on a grid of 128 points over [0, pi] and refined
+                   by bisection followed by a linear interpolation.
+  @par
+                   The line spectral frequencies are returned in ascending order,
+                   in radians in the range [0, pi].
+  @par           Accuracy
+                   With the 128 point grid and 4 bisections, the line spectral frequencies are
+                   accurate to about 1e-3 rad, and to a few 1e-3 rad when two of them are closer
+                   than the grid step pi/128. Two roots of the same polynomial within one grid step
+                   are not seen: fewer roots than the order are found and
+                   \ref ARM_MATH_DECOMPOSITION_FAILURE is returned. This happens with reflection
+                   coefficients close to 1 in magnitude, which pull line spectral frequencies together.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_lpc_to_lsf_f32(
+  const float32_t * pCoeffs,
+        float32_t * pLsf,
+        uint16_t order)
+{
+  float32_t f1[ARM_LPC_MAX_ORDER / 2 + 1];
+  float32_t f2[ARM_LPC_MAX_ORDER / 2 + 1];
+  float32_t r1[ARM_LPC_MAX_ORDER / 2];
+  float32_t r2[ARM_LPC_MAX_ORDER / 2];
+  uint32_t m = (uint32_t)order >> 1U;
+  uint32_t i, i1, i2;
+
+  if ((order == 0U) || ((order & 1U) != 0U) || (order > ARM_LPC_MAX_ORDER))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* A(z) coefficients are 1, -pCoeffs[0], ..., -pCoeffs[P-1].
+     Sum and difference polynomials with trivial roots removed. */
+  f1[0] = 1.0f;
+  f2[0] = 1.0f;
+  for (i = 0U; i < m; i++)
+  {
+    f1[i + 1U] = -pCoeffs[i] - pCoeffs[order - 1U - i] - f1[i];
+    f2[i + 1U] = -pCoeffs[i] + pCoeffs[order - 1U - i] + f2[i];
+  }
+
+  if ((lsf_roots_f32(f1, m, r1) != m) || (lsf_roots_f32(f2, m, r2) != m))
+  {
+    return (ARM_MATH_DECOMPOSITION_FAILURE);
+  }
+
+  /* The roots of both polynomials interlace. Merge them in ascending order. */
+  i1 = 0U;
+  i2 = 0U;
+  for (i = 0U; i < order; i++)
+  {
+    if ((i2 >= m) || ((i1 < m) && (r1[i1] <= r2[i2])))
+    {
+      pLsf[i] = r1[i1++];
+    }
+    else
+    {
+      pLsf[i] = r2[i2++];
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of LPC group
+ */
@@ -0,0 +1,207 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_lpc_to_lsf_q31.c
+ * Description:  Q31 conversion of prediction coefficients to line spectral frequencies
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.16.1
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+#define LSF_GRID_POINTS 128
+#define LSF_BISECTIONS  4
+
+/* Polynomial coefficients are computed in Q20 to leave headroom for the recurrence */
+#define LSF_Q31_HEADROOM 11
+
+/*
+  Evaluate f[0] T_m(x) + f[1] T_m-1(x) + ... + f[m-1] T_1(x) + f[m] / 2
+  with the Clenshaw recurrence. x is in Q31 and f in Q20.
+ */
+__STATIC_FORCEINLINE q31_t lsf_cheb_q31(q31_t x, const q31_t *f, uint32_t m)
+{
+  q31_t b0, b1 = 0, b2 = 0;
+  uint32_t i;
+
+  for (i = 0U; i < m; i++)
+  {
+    b0 = (q31_t)(((q63_t)x * b1) >> 30) - b2 + f[i];
+    b2 = b1;
+    b1 = b0;
+  }
+
+  return ((q31_t)(((q63_t)x * b1) >> 31) - b2 + (f[m] >> 1));
+}
+
+/*
+  Find the m roots of one polynomial on the frequency grid.
+  Phases are in the arm_cos_q31 format where 0x40000000 is pi.
+ */
+static uint32_t lsf_roots_q31(const q31_t *f, uint32_t m, q31_t *pRoots)
+{
+  const q31_t step = (q31_t)(0x40000000 / LSF_GRID_POINTS);
+  q31_t wLo, wHi, fLo, fHi;
+  uint32_t nb = 0U;
+  uint32_t i, j;
+
+  wLo = 0;
+  fLo = lsf_cheb_q31(0x7FFFFFFF, f, m);
+
+  for (i = 1U; (i <= LSF_GRID_POINTS) && (nb < m); i++)
+  {
+    wHi = step * (q31_t)i;
+    fHi = lsf_cheb_q31(arm_cos_q31(wHi), f, m);
+
+    /* A grid point exactly on a root ends the cell of that root: the next cell starts
+       with fLo == 0 and must not count it again */
+    if ((((fLo ^ fHi) < 0) && (fLo != 0)) || (fHi == 0))
+    {
+      q31_t a = wLo, b = wHi, fa = fLo, fb = fHi;
+
+      /* Refine the bracket by bisection */
+      for (j = 0U; j < LSF_BISECTIONS; j++)
+      {
+        q31_t wMid = a + ((b - a) >> 1);
+        q31_t fMid = lsf_cheb_q31(arm_cos_q31(wMid), f, m);
+
+        if (((fa ^ fMid) < 0) || (fMid == 0))
+        {
+          b = wMid;
+          fb = fMid;
+        }
+        else
+        {
+          a = wMid;
+          fa = fMid;
+        }
+      }
+
+      /* Final linear interpolation */
+      if (fa != fb)
+      {
+        a += (q31_t)(((q63_t)(b - a) * fa) / ((q63_t)fa - fb));
+      }
+      else
+      {
+        a += (b - a) >> 1;
+      }
+
+      /* Phase to frequency normalized by pi */
+      pRoots[nb] = (a >= 0x40000000) ? 0x7FFFFFFF : (a << 1);
+      nb++;
+    }
+
+    wLo = wHi;
+    fLo = fHi;
+  }
+
+  return (nb);
+}
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup LPC
+  @{
+ */
+
+/**
+  @brief         Conversion of Q31 prediction coefficients to line spectral frequencies.
+  @param[in]     pCoeffs  points to the prediction coefficients (length order)
+  @param[out]    pLsf     points to the line spectral frequencies (length order)
+  @param[in]     order    prediction order. Must be even and not greater than ARM_LPC_MAX_ORDER
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS                 : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR          : order is odd or out of range
+                   - \ref ARM_MATH_DECOMPOSITION_FAILURE   : Line spectral frequencies could not be found
+
+  @par           Details
+                   Same algorithm as \ref arm_lpc_to_lsf_f32. The line spectral frequencies are
+                   returned in ascending order, normalized by pi: 0x7FFFFFFF corresponds to pi.
+  @par           Scaling and Overflow Behavior
+                   The Chebyshev series is evaluated in 1.11.20 format. This leaves enough
+                   headroom for any stable filter up to order ARM_LPC_MAX_ORDER.
+  @par           Accuracy
+                   Same as \ref arm_lpc_to_lsf_f32. Line spectral frequencies closer than about
+                   1e-5 rad to each other cannot be separated in the 1.11.20 format, so some filters
+                   whose floating-point conversion succeeds by chance return
+                   \ref ARM_MATH_DECOMPOSITION_FAILURE.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_lpc_to_lsf_q31(
+  const q31_t * pCoeffs,
+        q31_t * pLsf,
+        uint16_t order)
+{
+  q31_t f1[ARM_LPC_MAX_ORDER / 2 + 1];
+  q31_t f2[ARM_LPC_MAX_ORDER / 2 + 1];
+  q31_t r1[ARM_LPC_MAX_ORDER / 2];
+  q31_t r2[ARM_LPC_MAX_ORDER / 2];
+  uint32_t m = (uint32_t)order >> 1U;
+  uint32_t i, i1, i2;
+
+  if ((order == 0U) || ((order & 1U) != 0U) || (order > ARM_LPC_MAX_ORDER))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* A(z) coefficients are 1, -pCoeffs[0], ..., -pCoeffs[P-1].
+     Sum and difference polynomials with trivial roots removed. */
+  f1[0] = (q31_t)(1L << (31 - LSF_Q31_HEADROOM));
+  f2[0] = f1[0];
+  for (i = 0U; i < m; i++)
+  {
+    q31_t x = pCoeffs[i] >> LSF_Q31_HEADROOM;
+    q31_t y = pCoeffs[order - 1U - i] >> LSF_Q31_HEADROOM;
+
+    f1[i + 1U] = -x - y - f1[i];
+    f2[i + 1U] = -x + y + f2[i];
+  }
+
+  if ((lsf_roots_q31(f1, m, r1) != m) || (lsf_roots_q31(f2, m, r2) != m))
+  {
+    return (ARM_MATH_DECOMPOSITION_FAILURE);
+  }
+
+  /* The roots of both polynomials interlace. Merge them in ascending order. */
+  i1 = 0U;
+  i2 = 0U;
+  for (i = 0U; i < order; i++)
+  {
+    if ((i2 >= m) || ((i1 < m) && (r1[i1] <= r2[i2])))
+    {
+      pLsf[i] = r1[i1++];
+    }
+    else
+    {
+      pLsf[i] = r2[i2++];
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of LPC group
+ */
@@ -14,6 +14,11 @@ target_sources(CMSISDSP PRIVATE InterpolationFunctions/arm_linear_interp_q31.c)
 target_sources(CMSISDSP PRIVATE InterpolationFunctions/arm_linear_interp_q7.c)
 target_sources(CMSISDSP PRIVATE InterpolationFunctions/arm_spline_interp_f32.c)
 target_sources(CMSISDSP PRIVATE InterpolationFunctions/arm_spline_interp_init_f32.c)
+target_sources(CMSISDSP PRIVATE InterpolationFunctions/arm_spline_interp_q31.c)
+target_sources(CMSISDSP PRIVATE InterpolationFunctions/arm_spline_interp_init_q31.c)
+target_sources(CMSISDSP PRIVATE InterpolationFunctions/arm_spline_lookup_f32.c)
+target_sources(CMSISDSP PRIVATE InterpolationFunctions/arm_spline_unsorted_f32.c)
+target_sources(CMSISDSP PRIVATE InterpolationFunctions/arm_spline_resample_uniform_f32.c)
 
 
 
@@ -36,6 +36,11 @@
 #include "arm_linear_interp_q7.c"
 #include "arm_spline_interp_f32.c"
 #include "arm_spline_interp_init_f32.c"
+#include "arm_spline_interp_q31.c"
+#include "arm_spline_interp_init_q31.c"
+#include "arm_spline_lookup_f32.c"
+#include "arm_spline_unsorted_f32.c"
+#include "arm_spline_resample_uniform_f32.c"
 
 
 
@@ -27,6 +27,7 @@
  */
 
 #include "dsp/interpolation_functions.h"
+#include "arm_spline_search.h"
 
 /**
   @ingroup groupInterpolation
@@ -221,7 +222,7 @@ ARM_DSP_ATTRIBUTE void arm_spline_f32(
         {
             x_sc = *pXq++;
 
-            *pDst = y[i]+b[i]*(x_sc-x[i])+c[i]*(x_sc-x[i])*(x_sc-x[i])+d[i]*(x_sc-x[i])*(x_sc-x[i])*(x_sc-x[i]);
+            *pDst = arm_spline_horner_f32(y[i], b[i], c[i], d[i], x_sc-x[i]);
 
             pDst++;
             blkCnt--;
@@ -271,7 +272,7 @@ ARM_DSP_ATTRIBUTE void arm_spline_f32(
     { 
         x_sc = *pXq++; 
   
-        *pDst = y[i-1]+b[i-1]*(x_sc-x[i-1])+c[i-1]*(x_sc-x[i-1])*(x_sc-x[i-1])+d[i-1]*(x_sc-x[i-1])*(x_sc-x[i-1])*(x_sc-x[i-1]);
+        *pDst = arm_spline_horner_f32(y[i-1], b[i-1], c[i-1], d[i-1], x_sc-x[i-1]);
  
         pDst++; 
         blkCnt2--;   
@@ -47,6 +47,11 @@
 
   The x input array must be strictly sorted in ascending order and it must
   not contain twice the same value (x(i)<x(i+1)).
+
+  @par
+
+  At least 2 known points are needed. With 2 points, both types give the
+  straight line through them.
  
 */
 
@@ -56,7 +61,7 @@
  * @param[in]     type        type of cubic spline interpolation (boundary conditions)
  * @param[in]     x           points to the x values of the known data points.
  * @param[in]     y           points to the y values of the known data points.
- * @param[in]     n           number of known data points.
+ * @param[in]     n           number of known data points (at least 2).
  * @param[in]     coeffs      coefficients array for b, c, and d
  * @param[in]     tempBuffer  buffer array for internal computations
  *
@@ -139,8 +144,17 @@ ARM_DSP_ATTRIBUTE void arm_spline_init_f32(
     }
     else if(type == ARM_SPLINE_PARABOLIC_RUNOUT)
     {
-        li = 1+u[n-2];      /* a(N,N) = 1; a(N,N-1) = -1 */
-        z[n-1] = z[n-2]/li; /* a(N,N-1) = -1 */
+        if (n > 2U)
+        {
+            li = 1+u[n-2];      /* a(N,N) = 1; a(N,N-1) = -1 */
+            z[n-1] = z[n-2]/li; /* a(N,N-1) = -1 */
+        }
+        else
+        {
+            /* Single interval: c(1) = c(2) does not fix c and l(N) = 0,
+               the straight line of the natural spline is kept */
+            z[n-1] = 0;
+        }
     }
 
     /* == Solve UX = Z to obtain c(i) and    */
@@ -0,0 +1,134 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_spline_interp_init_q31.c
+ * Description:  Initialization function for the Q31 cubic spline interpolation
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.16.1
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/interpolation_functions.h"
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupInterpolation
+ */
+
+/**
+  @addtogroup SplineInterpolate
+  @{
+ */
+
+/**
+ * @brief Initialization function for the Q31 cubic spline interpolation.
+ * @param[in,out] S           points to an instance of the Q31 spline structure.
+ * @param[in]     type        type of cubic spline interpolation (boundary conditions)
+ * @param[in]     x           points to the x values of the known data points.
+ * @param[in]     y           points to the y values of the known data points.
+ * @param[in]     n           number of known data points (at least 2).
+ * @param[in]     coeffs      coefficients array of size 5*(n-1)
+ * @param[in]     tempBuffer  floating-point buffer of size 7*n-4 for internal computations
+ *
+ * @par
+ * The x input array must be strictly sorted in ascending order.
+ * @par
+ * The coefficients are computed once with the floating-point algorithm of
+ * \ref arm_spline_init_f32. For each segment i, the polynomial is then stored
+ * in the normalized variable t = (x - x(i)) / h(i) in [0, 1]:
+ * <pre>
+ *     S(t) = y(i) + B(i) t + C(i) t^2 + D(i) t^3
+ * </pre>
+ * with B, C and D in 4.28 format, together with 1/h(i) as a normalized mantissa and shift.
+ * \ref arm_spline_q31 only uses integer arithmetic.
+ */
+
+ARM_DSP_ATTRIBUTE void arm_spline_init_q31(
+        arm_spline_instance_q31 * S,
+        arm_spline_type type,
+  const q31_t * x,
+  const q31_t * y,
+        uint32_t n,
+        q31_t * coeffs,
+        float32_t * tempBuffer)
+{
+    float32_t * xf = tempBuffer;                /* n float x values */
+    float32_t * yf = tempBuffer + n;            /* n float y values */
+    float32_t * cf = tempBuffer + 2*n;          /* 3*(n-1) float coefficients */
+    float32_t * tmp = cf + 3*(n-1);             /* 2*n-1 scratch for the float initialization */
+    arm_spline_instance_f32 Sf;
+    float32_t h, v[3];
+    uint32_t hInt, norm, i, k;
+    uint64_t mant;
+    q31_t * pSeg;
+
+    arm_q31_to_float(x, xf, n);
+    arm_q31_to_float(y, yf, n);
+
+    arm_spline_init_f32(&Sf, type, xf, yf, n, cf, tmp);
+
+    for (i = 0U; i < n - 1U; i++)
+    {
+        pSeg = coeffs + 5U * i;
+
+        /* Coefficients in t = (x - x(i)) / h(i) */
+        h = xf[i+1] - xf[i];
+        v[0] = cf[i] * h;
+        v[1] = cf[(n-1) + i] * h * h;
+        v[2] = cf[2*(n-1) + i] * h * h * h;
+
+        /* 4.28 format with saturation */
+        for (k = 0U; k < 3U; k++)
+        {
+            v[k] = v[k] * 268435456.0f;
+            if (v[k] >= 2147483647.0f)
+            {
+                pSeg[k] = 0x7FFFFFFF;
+            }
+            else if (v[k] <= -2147483648.0f)
+            {
+                pSeg[k] = (q31_t)0x80000000;
+            }
+            else
+            {
+                pSeg[k] = (q31_t)v[k];
+            }
+        }
+
+        /* 1/h = mantissa * 2^norm / 2^31 with mantissa = 2^62 / (h << norm) */
+        hInt = (uint32_t)((int64_t)x[i+1] - (int64_t)x[i]);
+        hInt = (hInt > 0U) ? hInt : 1U;
+        norm = __CLZ(hInt);
+        mant = ((uint64_t)1U << 62) / ((uint64_t)hInt << norm);
+        pSeg[3] = (mant > 0x7FFFFFFFU) ? 0x7FFFFFFF : (q31_t)mant;
+        pSeg[4] = (q31_t)norm;
+    }
+
+    S->type = type;
+    S->x = x;
+    S->y = y;
+    S->n_x = n;
+    S->coeffs = coeffs;
+}
+
+/**
+  @} end of SplineInterpolate group
+ */
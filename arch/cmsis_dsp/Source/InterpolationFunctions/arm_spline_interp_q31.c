@@ -0,0 +1,107 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_spline_interp_q31.c
+ * Description:  Q31 cubic spline interpolation
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.16.1
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/interpolation_functions.h"
+#include "arm_spline_search.h"
+
+/**
+  @ingroup groupInterpolation
+ */
+
+/**
+  @addtogroup SplineInterpolate
+  @{
+ */
+
+/**
+ * @brief Processing function for the Q31 cubic spline interpolation.
+ * @param[in]  S          points to an instance of the Q31 spline structure.
+ * @param[in]  xq         points to the x values of the interpolated data points (any order).
+ * @param[out] pDst       points to the block of output data.
+ * @param[in]  blockSize  number of samples of output data.
+ *
+ * @par
+ * The segment is found by binary search, the segment of the previous point being tried first.
+ * The query points are saturated to the range [x(0), x(n-1)] so the output
+ * is the boundary value outside of the known range.
+ * @par
+ * The normalized variable t is computed in 1.31 format and the polynomial is evaluated
+ * in Horner form with 64-bit intermediate products. The result is saturated to 1.31.
+ */
+
+ARM_DSP_ATTRIBUTE void arm_spline_q31(
+  const arm_spline_instance_q31 * S,
+  const q31_t * xq,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+    const q31_t * x = S->x;
+    const q31_t * y = S->y;
+    uint32_t n = S->n_x;
+    const q31_t * pSeg;
+
+    uint32_t i = 0U;
+    q31_t x_sc;
+    q63_t t, acc;
+
+    while (blockSize > 0U)
+    {
+        x_sc = *xq++;
+
+        /* Saturate to the known range */
+        x_sc = (x_sc < x[0]) ? x[0] : x_sc;
+        x_sc = (x_sc > x[n-1]) ? x[n-1] : x_sc;
+
+        /* Keep the segment of the previous point when it still contains x_sc */
+        if (!((x[i] <= x_sc) && ((i == n - 2U) || (x_sc < x[i+1]))))
+        {
+            i = arm_spline_segment_q31(x, n, x_sc);
+        }
+
+        pSeg = S->coeffs + 5U * i;
+
+        /* t = (x - x(i)) / h(i) in 1.31 format */
+        t = (((q63_t)x_sc - (q63_t)x[i]) * (q63_t)pSeg[3]) >> (31 - pSeg[4]);
+        t = (t > 0x7FFFFFFF) ? 0x7FFFFFFF : t;
+
+        /* Horner evaluation in 4.28 format */
+        acc = pSeg[2];
+        acc = (q63_t)pSeg[1] + ((acc * t) >> 31);
+        acc = (q63_t)pSeg[0] + ((acc * t) >> 31);
+        acc = (acc * t) >> 31;
+
+        /* Back to 1.31 format */
+        *pDst++ = clip_q63_to_q31((q63_t)y[i] + acc * 8);
+
+        blockSize--;
+    }
+}
+
+/**
+  @} end of SplineInterpolate group
+ */
@@ -0,0 +1,73 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_spline_lookup_f32.c
+ * Description:  Floating-point cubic spline interpolation at unordered points
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.16.1
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/interpolation_functions.h"
+#include "arm_spline_search.h"
+
+/**
+  @ingroup groupInterpolation
+ */
+
+/**
+  @addtogroup SplineInterpolate
+  @{
+ */
+
+/**
+ * @brief Floating-point cubic spline interpolation of a single point.
+ * @param[in]  S   points to an instance of the floating-point spline structure.
+ * @param[in]  xq  x value of the interpolated data point.
+ * @return     interpolated value.
+ *
+ * @par
+ * The segment is found by binary search so there is no constraint on the
+ * order of successive queries. The cubic is evaluated in Horner form.
+ * Outside of the known range, the first and last polynomials are extrapolated.
+ */
+
+ARM_DSP_ATTRIBUTE float32_t arm_spline_lookup_f32(
+  const arm_spline_instance_f32 * S,
+        float32_t xq)
+{
+    const float32_t * x = S->x;
+    const float32_t * y = S->y;
+    uint32_t n = S->n_x;
+
+    /* Coefficients (a==y for i<=n-1) */
+    const float32_t * b = (S->coeffs);
+    const float32_t * c = (S->coeffs)+(n-1);
+    const float32_t * d = (S->coeffs)+(2*(n-1));
+
+    uint32_t i = arm_spline_segment_f32(x, n, xq);
+
+    return (arm_spline_horner_f32(y[i], b[i], c[i], d[i], xq - x[i]));
+}
+
+/**
+  @} end of SplineInterpolate group
+ */
@@ -0,0 +1,146 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_spline_resample_uniform_f32.c
+ * Description:  Floating-point cubic spline resampling on a uniform grid
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.16.1
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/interpolation_functions.h"
+#include "arm_spline_search.h"
+
+/* Maximum number of forward difference steps before the differences
+   are recomputed from the polynomial to limit the error growth */
+#define SPLINE_FD_RESTART 64U
+
+/**
+  @ingroup groupInterpolation
+ */
+
+/**
+  @addtogroup SplineInterpolate
+  @{
+ */
+
+/**
+ * @brief Floating-point cubic spline resampling on a uniform grid.
+ * @param[in]  S          points to an instance of the floating-point spline structure.
+ * @param[in]  x0         first x value of the grid.
+ * @param[in]  dx         grid step. Must be positive.
+ * @param[out] pDst       points to the block of output data: S(x0 + k*dx) for k = 0 ... blockSize-1.
+ * @param[in]  blockSize  number of samples of output data.
+ *
+ * @par
+ * Inside a segment, the cubic is evaluated by forward differencing:
+ * <pre>
+ *     y(k+1)   = y(k) + D1(k)
+ *     D1(k+1)  = D1(k) + D2(k)
+ *     D2(k+1)  = D2(k) + D3
+ * </pre>
+ * so each output costs 3 additions. The differences are recomputed from the
+ * polynomial at each segment boundary and every 64 samples which bounds
+ * the accumulated rounding error.
+ * @par
+ * When dx is not positive, each sample is computed with \ref arm_spline_lookup_f32.
+ */
+
+ARM_DSP_ATTRIBUTE void arm_spline_resample_uniform_f32(
+  const arm_spline_instance_f32 * S,
+        float32_t x0,
+        float32_t dx,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+    const float32_t * x = S->x;
+    const float32_t * y = S->y;
+    uint32_t n = S->n_x;
+
+    /* Coefficients (a==y for i<=n-1) */
+    const float32_t * b = (S->coeffs);
+    const float32_t * c = (S->coeffs)+(n-1);
+    const float32_t * d = (S->coeffs)+(2*(n-1));
+
+    float32_t t, y0, d1, d2, d3;
+    float32_t dx2 = dx * dx;
+    float32_t dx3 = dx2 * dx;
+    uint32_t i, k = 0U, kEnd, kRestart;
+    float32_t kLimit;
+
+    if (!(dx > 0.0f))
+    {
+        for (k = 0U; k < blockSize; k++)
+        {
+            pDst[k] = arm_spline_lookup_f32(S, x0 + (float32_t)k * dx);
+        }
+        return;
+    }
+
+    i = arm_spline_segment_f32(x, n, x0);
+
+    while (k < blockSize)
+    {
+        t = (x0 + (float32_t)k * dx);
+
+        /* Move to the segment of the current grid point */
+        while ((i < n - 2U) && (t >= x[i+1]))
+        {
+            i++;
+        }
+
+        /* Grid points up to the end of the segment */
+        kEnd = blockSize;
+        if (i < n - 2U)
+        {
+            kLimit = (x[i+1] - x0) / dx;
+            if (kLimit < (float32_t)blockSize)
+            {
+                kEnd = (uint32_t)kLimit + 1U;
+                kEnd = (kEnd > k) ? kEnd : (k + 1U);
+            }
+        }
+
+        while (k < kEnd)
+        {
+            /* Differences of the cubic at t with step dx */
+            t = (x0 + (float32_t)k * dx) - x[i];
+            y0 = arm_spline_horner_f32(y[i], b[i], c[i], d[i], t);
+            d1 = b[i] * dx + c[i] * (2.0f * t * dx + dx2) + d[i] * (3.0f * t * (t * dx + dx2) + dx3);
+            d2 = 2.0f * c[i] * dx2 + 6.0f * d[i] * (t * dx2 + dx3);
+            d3 = 6.0f * d[i] * dx3;
+
+            kRestart = ((kEnd - k) > SPLINE_FD_RESTART) ? (k + SPLINE_FD_RESTART) : kEnd;
+
+            while (k < kRestart)
+            {
+                pDst[k++] = y0;
+                y0 += d1;
+                d1 += d2;
+                d2 += d3;
+            }
+        }
+    }
+}
+
+/**
+  @} end of SplineInterpolate group
+ */
@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_spline_unsorted_f32.c
+ * Description:  Floating-point cubic spline interpolation of a block of unordered points
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.16.1
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/interpolation_functions.h"
+#include "arm_spline_search.h"
+
+/**
+  @ingroup groupInterpolation
+ */
+
+/**
+  @addtogroup SplineInterpolate
+  @{
+ */
+
+/**
+ * @brief Floating-point cubic spline interpolation of unordered points.
+ * @param[in]  S          points to an instance of the floating-point spline structure.
+ * @param[in]  xq         points to the x values of the interpolated data points (any order).
+ * @param[out] pDst       points to the block of output data.
+ * @param[in]  blockSize  number of samples of output data.
+ *
+ * @par
+ * Unlike \ref arm_spline_f32, the query points do not need to be sorted.
+ * The segment of the previous point is tried first, so slowly varying queries
+ * (for example coming from a control loop) do not pay for the binary search.
+ * The cubic is evaluated in Horner form.
+ */
+
+ARM_DSP_ATTRIBUTE void arm_spline_unsorted_f32(
+  const arm_spline_instance_f32 * S,
+  const float32_t * xq,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+    const float32_t * x = S->x;
+    const float32_t * y = S->y;
+    uint32_t n = S->n_x;
+
+    /* Coefficients (a==y for i<=n-1) */
+    const float32_t * b = (S->coeffs);
+    const float32_t * c = (S->coeffs)+(n-1);
+    const float32_t * d = (S->coeffs)+(2*(n-1));
+
+    uint32_t i = 0U;
+    float32_t x_sc;
+
+    while (blockSize > 0U)
+    {
+        x_sc = *xq++;
+
+        /* Keep the segment of the previous point when it still contains x_sc */
+        if (!(((i == 0U) || (x[i] <= x_sc)) && ((i == n - 2U) || (x_sc < x[i+1]))))
+        {
+            i = arm_spline_segment_f32(x, n, x_sc);
+        }
+
+        *pDst++ = arm_spline_horner_f32(y[i], b[i], c[i], d[i], x_sc - x[i]);
+
+        blockSize--;
+    }
+}
+
+/**
+  @} end of SplineInterpolate group
+ */
@@ -29,6 +29,8 @@ MatrixFunctions/arm_mat_solve_upper_triangular_f32.c
 MatrixFunctions/arm_mat_sub_f32.c
 MatrixFunctions/arm_mat_trans_f32.c
 MatrixFunctions/arm_mat_vec_mult_f32.c
+MatrixFunctions/arm_mat_vec_mult_bf16_f32.c
+MatrixFunctions/arm_mat_vec_mult_f16_f32.c
 MatrixFunctions/arm_mat_qr_f32.c
 MatrixFunctions/arm_householder_f32.c
 )
@@ -59,6 +59,8 @@
 #include "arm_mat_trans_q15.c"
 #include "arm_mat_trans_q31.c"
 #include "arm_mat_vec_mult_f32.c"
+#include "arm_mat_vec_mult_bf16_f32.c"
+#include "arm_mat_vec_mult_f16_f32.c"
 #include "arm_mat_vec_mult_q31.c"
 #include "arm_mat_vec_mult_q15.c"
 #include "arm_mat_vec_mult_q7.c"
@@ -32,6 +32,10 @@
 #define GROUPOFROWS 8
 #endif
 
+#if defined(ARM_MATH_SSE) && !defined(ARM_MATH_AUTOVECTORIZE)
+#include "arm_vec_sse.h"
+#endif
+
 /**
  * @ingroup groupMatrix
  */
@@ -872,6 +876,118 @@ ARM_DSP_ATTRIBUTE arm_status arm_mat_mult_f32(
   /* Return to application */
   return (status);
 }
+#elif defined(ARM_MATH_SSE) && !defined(ARM_MATH_AUTOVECTORIZE)
+/**
+ * @brief Floating-point matrix multiplication.
+ * @param[in]       *pSrcA points to the first input matrix structure
+ * @param[in]       *pSrcB points to the second input matrix structure
+ * @param[out]      *pDst points to output matrix structure
+ * @return          The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * Each output is accumulated in the same order as the scalar version so results are identical.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_mult_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst)
+{
+  const float32_t *pInA = pSrcA->pData;          /* Input data matrix pointer A */
+  const float32_t *pInB = pSrcB->pData;          /* Input data matrix pointer B */
+  float32_t *pOut = pDst->pData;                 /* Output data matrix pointer */
+  float32_t sum;                                 /* Accumulator */
+  f32xN_t acc0, acc1;                            /* Vector accumulators */
+  uint16_t numRowsA = pSrcA->numRows;            /* Number of rows of input matrix A */
+  uint16_t numColsB = pSrcB->numCols;            /* Number of columns of input matrix B */
+  uint16_t numColsA = pSrcA->numCols;            /* Number of columns of input matrix A */
+  uint32_t row, col, k;                          /* Loop counters */
+  arm_status status;                             /* Status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    /* Row loop */
+    for (row = 0U; row < numRowsA; row++)
+    {
+      col = 0U;
+
+      /* Compute 2 * ARM_SSE_LANES outputs of the row at a time.
+         c(m,p..) = a(m,1) * b(1,p..) + a(m,2) * b(2,p..) + .... + a(m,n) * b(n,p..) */
+      for (; (col + 2U * ARM_SSE_LANES) <= numColsB; col += 2U * ARM_SSE_LANES)
+      {
+        const float32_t *pB = pInB + col;
+
+        acc0 = arm_sse_zero();
+        acc1 = arm_sse_zero();
+
+        for (k = 0U; k < numColsA; k++)
+        {
+          f32xN_t a = arm_sse_dup(pInA[k]);
+
+          acc0 = arm_sse_add(acc0, arm_sse_mul(a, arm_sse_load(pB)));
+          acc1 = arm_sse_add(acc1, arm_sse_mul(a, arm_sse_load(pB + ARM_SSE_LANES)));
+          pB += numColsB;
+        }
+
+        arm_sse_store(pOut + col, acc0);
+        arm_sse_store(pOut + col + ARM_SSE_LANES, acc1);
+      }
+
+      for (; (col + ARM_SSE_LANES) <= numColsB; col += ARM_SSE_LANES)
+      {
+        const float32_t *pB = pInB + col;
+
+        acc0 = arm_sse_zero();
+
+        for (k = 0U; k < numColsA; k++)
+        {
+          acc0 = arm_sse_add(acc0, arm_sse_mul(arm_sse_dup(pInA[k]), arm_sse_load(pB)));
+          pB += numColsB;
+        }
+
+        arm_sse_store(pOut + col, acc0);
+      }
+
+      /* Remaining columns */
+      for (; col < numColsB; col++)
+      {
+        const float32_t *pB = pInB + col;
+
+        sum = 0.0f;
+
+        for (k = 0U; k < numColsA; k++)
+        {
+          sum += pInA[k] * *pB;
+          pB += numColsB;
+        }
+
+        pOut[col] = sum;
+      }
+
+      /* Next row */
+      pInA += numColsA;
+      pOut += numColsB;
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
 #else
 /**
  * @brief Floating-point matrix multiplication.
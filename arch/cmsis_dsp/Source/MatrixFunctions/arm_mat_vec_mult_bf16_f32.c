@@ -0,0 +1,142 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_vec_mult_bf16_f32.c
+ * Description:  bf16 matrix and floating-point vector multiplication
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.16.1
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+
+/**
+ * @ingroup groupMatrix
+ */
+
+
+/**
+ * @addtogroup MatrixVectMult
+ * @{
+ */
+
+/**
+ * @brief bf16 matrix and floating-point vector multiplication with floating-point accumulation.
+ * @param[in]       *pSrcMat points to the input matrix structure
+ * @param[in]       *pVec points to the input vector
+ * @param[out]      *pDst points to the output vector
+ *
+ * @par Details
+ *      The matrix is stored in bf16 and converted to float32_t when loaded.
+ *      The vector, the accumulation and the result are float32_t.
+ *      This is intended for large weight tables on cores without native bf16 arithmetic.
+ */
+ARM_DSP_ATTRIBUTE void arm_mat_vec_mult_bf16_f32(const arm_matrix_instance_bf16 *pSrcMat, const float32_t *pVec, float32_t *pDst)
+{
+    uint32_t numRows = pSrcMat->numRows;
+    uint32_t numCols = pSrcMat->numCols;
+    const bf16_t *pSrcA = pSrcMat->pData;
+    const bf16_t *pInA1;      /* input data matrix pointer of row 1 */
+    const bf16_t *pInA2;      /* input data matrix pointer of row 2 */
+    const bf16_t *pInA3;      /* input data matrix pointer of row 3 */
+    const bf16_t *pInA4;      /* input data matrix pointer of row 4 */
+    const float32_t *pInVec;     /* input data vector pointer */
+    float32_t *px;               /* Temporary output data pointer */
+    uint32_t i;
+    uint16_t row, colCnt; /* loop counters */
+    float32_t vecData;
+
+
+    /* Process 4 rows at a time */
+    row = numRows >> 2;
+    i = 0u;
+    px = pDst;
+
+    /* The following loop performs the dot-product of each row in pSrcA with the vector */
+    /* row loop */
+    while (row > 0) {
+        /* Initialize accumulators */
+        float32_t sum1 = 0.0f;
+        float32_t sum2 = 0.0f;
+        float32_t sum3 = 0.0f;
+        float32_t sum4 = 0.0f;
+
+        /* For every row wise process, the pInVec pointer is set
+         ** to the starting address of the vector */
+        pInVec = pVec;
+
+        colCnt = numCols;
+
+        /* Initialize pointers to the starting address of the column being processed */
+        pInA1 = pSrcA + i;
+        pInA2 = pInA1 + numCols;
+        pInA3 = pInA2 + numCols;
+        pInA4 = pInA3 + numCols;
+
+        // Main loop: matrix-vector multiplication
+        while (colCnt > 0u) {
+            // Read 1 value from the vector, reused for the 4 rows
+            vecData = *(pInVec)++;
+            sum1 += arm_bf16_to_f32(*(pInA1)++) * vecData;
+            sum2 += arm_bf16_to_f32(*(pInA2)++) * vecData;
+            sum3 += arm_bf16_to_f32(*(pInA3)++) * vecData;
+            sum4 += arm_bf16_to_f32(*(pInA4)++) * vecData;
+
+            // Decrement the loop counter
+            colCnt--;
+        }
+
+        /* Store the result in the destination buffer */
+        *px++ = sum1;
+        *px++ = sum2;
+        *px++ = sum3;
+        *px++ = sum4;
+
+        i = i + numCols * 4;
+
+        /* Decrement the row loop counter */
+        row--;
+    }
+
+    /* process any remaining rows */
+    row = numRows & 3u;
+    while (row > 0) {
+
+        float32_t sum = 0.0f;
+        pInVec = pVec;
+        pInA1 = pSrcA + i;
+
+        colCnt = numCols;
+        while (colCnt > 0) {
+            sum += arm_bf16_to_f32(*pInA1++) * *pInVec++;
+            colCnt--;
+        }
+
+        *px++ = sum;
+        i = i + numCols;
+        row--;
+    }
+}
+
+/**
+ * @} end of MatrixMult group
+ */
@@ -26,6 +26,8 @@ SupportFunctions/arm_float_to_f64.c
 SupportFunctions/arm_float_to_q15.c
 SupportFunctions/arm_float_to_q31.c
 SupportFunctions/arm_float_to_q7.c
+SupportFunctions/arm_float_to_bf16.c
+SupportFunctions/arm_float_to_fp16.c
 SupportFunctions/arm_heap_sort_f32.c
 SupportFunctions/arm_insertion_sort_f32.c
 SupportFunctions/arm_merge_sort_f32.c
@@ -40,6 +42,8 @@ SupportFunctions/arm_q31_to_q15.c
 SupportFunctions/arm_q31_to_q7.c
 SupportFunctions/arm_q7_to_f64.c
 SupportFunctions/arm_q7_to_float.c
+SupportFunctions/arm_bf16_to_float.c
+SupportFunctions/arm_fp16_to_float.c
 SupportFunctions/arm_q7_to_q15.c
 SupportFunctions/arm_q7_to_q31.c
 SupportFunctions/arm_quick_sort_f32.c
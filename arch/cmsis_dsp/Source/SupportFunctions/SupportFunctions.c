@@ -57,6 +57,8 @@
 #include "arm_float_to_q15.c"
 #include "arm_float_to_q31.c"
 #include "arm_float_to_q7.c"
+#include "arm_float_to_bf16.c"
+#include "arm_float_to_fp16.c"
 #include "arm_q15_to_f64.c"
 #include "arm_q15_to_float.c"
 #include "arm_q15_to_q31.c"
@@ -67,5 +69,7 @@
 #include "arm_q31_to_q7.c"
 #include "arm_q7_to_f64.c"
 #include "arm_q7_to_float.c"
+#include "arm_bf16_to_float.c"
+#include "arm_fp16_to_float.c"
 #include "arm_q7_to_q15.c"
 #include "arm_q7_to_q31.c"
@@ -48,6 +48,177 @@ void arm_radix8_butterfly_f32(
   return        none
 */
 
+#if defined(ARM_MATH_SSE) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+#include "arm_vec_sse.h"
+
+#define R8_SSE_LOAD(pA, pB) \
+  _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)(pA)), (const __m64 *)(pB))
+
+#define R8_SSE_STORE(pA, pB, v) \
+  _mm_storel_pi((__m64 *)(pA), (v)); _mm_storeh_pi((__m64 *)(pB), (v))
+
+/*
+  Radix-8 butterfly computed on the low and high halves of the SSE registers.
+  pA and pB point to the first input of two butterflies and may be equal.
+  pCo and pSi hold the twiddles of outputs 1 to 7, or are NULL for the first column.
+  The operations are those of the scalar butterfly so results are identical.
+ */
+__STATIC_FORCEINLINE void arm_radix8_butterfly_sse_f32(
+  float32_t * pA,
+  float32_t * pB,
+  uint32_t n2,
+  const __m128 * pCo,
+  const __m128 * pSi)
+{
+   const __m128 C81 = _mm_set1_ps(0.70710678118f);
+   const uint32_t s = 2U * n2;
+   __m128 a1, a2, a3, a4, a5, a6, a7, a8;
+   __m128 x0, x1, x2, x3, x4, x5, x6, x7;
+   __m128 t, u, p, q;
+
+   x0 = R8_SSE_LOAD(pA         , pB         );
+   x1 = R8_SSE_LOAD(pA +      s, pB +      s);
+   x2 = R8_SSE_LOAD(pA + 2U * s, pB + 2U * s);
+   x3 = R8_SSE_LOAD(pA + 3U * s, pB + 3U * s);
+   x4 = R8_SSE_LOAD(pA + 4U * s, pB + 4U * s);
+   x5 = R8_SSE_LOAD(pA + 5U * s, pB + 5U * s);
+   x6 = R8_SSE_LOAD(pA + 6U * s, pB + 6U * s);
+   x7 = R8_SSE_LOAD(pA + 7U * s, pB + 7U * s);
+
+   a1 = _mm_add_ps(x0, x4);
+   a5 = _mm_sub_ps(x0, x4);
+   a2 = _mm_add_ps(x1, x5);
+   a6 = _mm_sub_ps(x1, x5);
+   a3 = _mm_add_ps(x2, x6);
+   a7 = _mm_sub_ps(x2, x6);
+   a4 = _mm_add_ps(x3, x7);
+   a8 = _mm_sub_ps(x3, x7);
+
+   /* Even outputs */
+   t  = _mm_sub_ps(a1, a3);
+   a1 = _mm_add_ps(a1, a3);
+   u  = _mm_sub_ps(a2, a4);
+   a2 = _mm_add_ps(a2, a4);
+   x0 = _mm_add_ps(a1, a2);
+   x4 = _mm_sub_ps(a1, a2);
+   x2 = arm_sse_cmplx_sub_jmul(t, u);
+   x6 = arm_sse_cmplx_add_jmul(t, u);
+
+   /* Odd outputs */
+   p  = _mm_mul_ps(_mm_sub_ps(a6, a8), C81);
+   q  = _mm_mul_ps(_mm_add_ps(a6, a8), C81);
+   t  = _mm_sub_ps(a5, p);
+   a5 = _mm_add_ps(a5, p);
+   u  = _mm_sub_ps(a7, q);
+   a7 = _mm_add_ps(a7, q);
+   x1 = arm_sse_cmplx_sub_jmul(a5, a7);
+   x7 = arm_sse_cmplx_add_jmul(a5, a7);
+   x5 = arm_sse_cmplx_sub_jmul(t, u);
+   x3 = arm_sse_cmplx_add_jmul(t, u);
+
+   if (pCo != NULL)
+   {
+      x1 = arm_sse_cmplx_mul_conj(x1, pCo[0], pSi[0]);
+      x2 = arm_sse_cmplx_mul_conj(x2, pCo[1], pSi[1]);
+      x3 = arm_sse_cmplx_mul_conj(x3, pCo[2], pSi[2]);
+      x4 = arm_sse_cmplx_mul_conj(x4, pCo[3], pSi[3]);
+      x5 = arm_sse_cmplx_mul_conj(x5, pCo[4], pSi[4]);
+      x6 = arm_sse_cmplx_mul_conj(x6, pCo[5], pSi[5]);
+      x7 = arm_sse_cmplx_mul_conj(x7, pCo[6], pSi[6]);
+   }
+
+   R8_SSE_STORE(pA         , pB         , x0);
+   R8_SSE_STORE(pA +      s, pB +      s, x1);
+   R8_SSE_STORE(pA + 2U * s, pB + 2U * s, x2);
+   R8_SSE_STORE(pA + 3U * s, pB + 3U * s, x3);
+   R8_SSE_STORE(pA + 4U * s, pB + 4U * s, x4);
+   R8_SSE_STORE(pA + 5U * s, pB + 5U * s, x5);
+   R8_SSE_STORE(pA + 6U * s, pB + 6U * s, x6);
+   R8_SSE_STORE(pA + 7U * s, pB + 7U * s, x7);
+}
+
+ARM_DSP_ATTRIBUTE void arm_radix8_butterfly_f32(
+  float32_t * pSrc,
+  uint16_t fftLen,
+  const float32_t * pCoef,
+  uint16_t twidCoefModifier)
+{
+   __m128 co[7], si[7];
+   uint32_t ia, ib;
+   uint32_t i1, jb;
+   uint32_t n1, n2, j, k;
+
+   n2 = fftLen;
+
+   do
+   {
+      n1 = n2;
+      n2 = n2 >> 3;
+
+      /* First column, without twiddles.
+         Butterflies of the same column are paired two by two. */
+      if (n1 == fftLen)
+      {
+         arm_radix8_butterfly_sse_f32(pSrc, pSrc, n2, NULL, NULL);
+      }
+      else
+      {
+         for (i1 = 0U; i1 < fftLen; i1 += 2U * n1)
+         {
+            arm_radix8_butterfly_sse_f32(pSrc + 2U * i1, pSrc + 2U * (i1 + n1), n2, NULL, NULL);
+         }
+      }
+
+      if (n2 < 8)
+         break;
+
+      if (n1 == fftLen)
+      {
+         /* One butterfly per column: pair adjacent columns */
+         for (j = 1U; j < n2; j += 2U)
+         {
+            jb = ((j + 1U) < n2) ? (j + 1U) : j;
+            ia = j * twidCoefModifier;
+            ib = jb * twidCoefModifier;
+
+            for (k = 0U; k < 7U; k++)
+            {
+               co[k] = _mm_set_ps(pCoef[2U * (k + 1U) * ib], pCoef[2U * (k + 1U) * ib],
+                                  pCoef[2U * (k + 1U) * ia], pCoef[2U * (k + 1U) * ia]);
+               si[k] = _mm_set_ps(pCoef[2U * (k + 1U) * ib + 1U], pCoef[2U * (k + 1U) * ib + 1U],
+                                  pCoef[2U * (k + 1U) * ia + 1U], pCoef[2U * (k + 1U) * ia + 1U]);
+            }
+
+            arm_radix8_butterfly_sse_f32(pSrc + 2U * j, pSrc + 2U * jb, n2, co, si);
+         }
+      }
+      else
+      {
+         /* Several butterflies per column sharing the same twiddles */
+         for (j = 1U; j < n2; j++)
+         {
+            ia = j * twidCoefModifier;
+
+            for (k = 0U; k < 7U; k++)
+            {
+               co[k] = _mm_set1_ps(pCoef[2U * (k + 1U) * ia]);
+               si[k] = _mm_set1_ps(pCoef[2U * (k + 1U) * ia + 1U]);
+            }
+
+            for (i1 = j; i1 < fftLen; i1 += 2U * n1)
+            {
+               arm_radix8_butterfly_sse_f32(pSrc + 2U * i1, pSrc + 2U * (i1 + n1), n2, co, si);
+            }
+         }
+      }
+
+      twidCoefModifier <<= 3;
+   } while (n2 > 7);
+}
+
+#else
+
 ARM_DSP_ATTRIBUTE void arm_radix8_butterfly_f32(
   float32_t * pSrc,
   uint16_t fftLen,
@@ -289,3 +460,5 @@ ARM_DSP_ATTRIBUTE void arm_radix8_butterfly_f32(
       twidCoefModifier <<= 3;
    } while (n2 > 7);
 }
+
+#endif /* defined(ARM_MATH_SSE) && !defined(ARM_MATH_AUTOVECTORIZE) */
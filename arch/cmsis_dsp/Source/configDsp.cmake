@@ -27,6 +27,22 @@ if (NEON)
 
 endif()
 
+if (SSE OR AVX2)
+    # x86 host acceleration. Contraction is disabled so that vector and
+    # scalar code round identically.
+    target_compile_definitions(${project} PRIVATE ARM_MATH_SSE)
+    target_compile_options(${project} PRIVATE $<$<STREQUAL:${CMAKE_C_COMPILER_ID},GNU>:-msse4.1>)
+    target_compile_options(${project} PRIVATE $<$<STREQUAL:${CMAKE_C_COMPILER_ID},GNU>:-ffp-contract=off>)
+    target_compile_options(${project} PRIVATE $<$<STREQUAL:${CMAKE_C_COMPILER_ID},Clang>:-msse4.1>)
+    target_compile_options(${project} PRIVATE $<$<STREQUAL:${CMAKE_C_COMPILER_ID},Clang>:-ffp-contract=off>)
+endif()
+
+if (AVX2)
+    target_compile_definitions(${project} PRIVATE ARM_MATH_AVX2)
+    target_compile_options(${project} PRIVATE $<$<STREQUAL:${CMAKE_C_COMPILER_ID},GNU>:-mavx2>)
+    target_compile_options(${project} PRIVATE $<$<STREQUAL:${CMAKE_C_COMPILER_ID},Clang>:-mavx2>)
+endif()
+
 if (NEONEXPERIMENTAL)
     # Used in arm_vec_math.h
     target_include_directories(${project} PUBLIC "${DSP}/ComputeLibrary/Include")
@@ -0,0 +1,679 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        test_lpc.c
+ * Description:  Host tests of the LPC analysis and synthesis chain
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.16.1
+ *
+ * Target Processor: Host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+  Stable filters are built from random reflection coefficients with the
+  step-up recursion in double precision, so the expected reflection
+  coefficients are known exactly. The tests check:
+  - the reflection coefficients of the synthesis initialization, and the
+    impulse response of the lattice filter against the direct form 1/A(z),
+  - the line spectral frequencies against a double precision search on a
+    fine grid, and the Q31 conversion against the floating-point one,
+  - a Q31 filter whose line spectral frequency falls exactly on a grid point,
+  - the analysis of an autoregressive process against a double precision
+    autocorrelation and Levinson Durbin recursion.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arm_math.h"
+#include "arm_const_structs.h"
+
+#define NUM_FILTERS      4000
+#define IMPULSE_LEN      200
+#define REF_GRID_POINTS  4096
+#define FRAME_LEN        490
+#define FFT_LEN          512
+
+static int failures;
+
+#define CHECK(cond, ...)                          \
+  do                                              \
+  {                                               \
+    if (!(cond))                                  \
+    {                                             \
+      printf("FAIL %s:%d: ", __FILE__, __LINE__); \
+      printf(__VA_ARGS__);                        \
+      printf("\n");                               \
+      failures++;                                 \
+    }                                             \
+  } while (0)
+
+static uint32_t rngState = 0x12345678U;
+
+/* Uniform in [-1, 1) */
+static double rand_f64(void)
+{
+  rngState = rngState * 1664525U + 1013904223U;
+  return ((double)(rngState >> 8) / 8388608.0) - 1.0;
+}
+
+static uint32_t rand_u32(uint32_t n)
+{
+  rngState = rngState * 1664525U + 1013904223U;
+  return (rngState >> 8) % n;
+}
+
+static q31_t to_q31(double x)
+{
+  double v = round(x * 2147483648.0);
+
+  return (q31_t)((v > 2147483647.0) ? 2147483647.0 : ((v < -2147483648.0) ? -2147483648.0 : v));
+}
+
+/* Prediction coefficients of the filter whose reflection coefficients are k[0] (order 1) to k[P-1] */
+static void step_up(const double *k, uint32_t order, double *a)
+{
+  double prev[ARM_LPC_MAX_ORDER];
+  uint32_t m, j;
+
+  for (m = 1U; m <= order; m++)
+  {
+    memcpy(prev, a, (m - 1U) * sizeof(double));
+    for (j = 0U; j < (m - 1U); j++)
+    {
+      a[j] = prev[j] - k[m - 1U] * prev[m - 2U - j];
+    }
+    a[m - 1U] = k[m - 1U];
+  }
+}
+
+static void random_filter(uint32_t order, double kMax, double *k, double *a)
+{
+  uint32_t i;
+
+  for (i = 0U; i < order; i++)
+  {
+    k[i] = kMax * rand_f64();
+  }
+  step_up(k, order, a);
+}
+
+static int fits_q31(const double *a, uint32_t order)
+{
+  uint32_t i;
+
+  for (i = 0U; i < order; i++)
+  {
+    if ((a[i] >= 1.0) || (a[i] < -1.0))
+    {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+/* Impulse response of 1/A(z) in direct form */
+static void ref_impulse(const double *a, uint32_t order, double *h, uint32_t len)
+{
+  uint32_t n, i;
+
+  for (n = 0U; n < len; n++)
+  {
+    double acc = (n == 0U) ? 1.0 : 0.0;
+
+    for (i = 0U; (i < order) && (i < n); i++)
+    {
+      acc += a[i] * h[n - 1U - i];
+    }
+    h[n] = acc;
+  }
+}
+
+/* Largest error of the lattice impulse response, relative to the peak of the reference */
+static double lattice_error(const float32_t *pk, uint32_t order, const double *a)
+{
+  arm_iir_lattice_instance_f32 S;
+  float32_t k[ARM_LPC_MAX_ORDER], v[ARM_LPC_MAX_ORDER + 1];
+  float32_t state[ARM_LPC_MAX_ORDER + IMPULSE_LEN];
+  float32_t x[IMPULSE_LEN], y[IMPULSE_LEN];
+  double h[IMPULSE_LEN];
+  double peak = 0.0, err = 0.0;
+  uint32_t n;
+
+  memcpy(k, pk, order * sizeof(float32_t));
+  memset(v, 0, sizeof(v));
+  v[order] = 1.0f;
+  memset(state, 0, sizeof(state));
+  arm_iir_lattice_init_f32(&S, (uint16_t)order, k, v, state, IMPULSE_LEN);
+
+  memset(x, 0, sizeof(x));
+  x[0] = 1.0f;
+  arm_iir_lattice_f32(&S, x, y, IMPULSE_LEN);
+  ref_impulse(a, order, h, IMPULSE_LEN);
+
+  for (n = 0U; n < IMPULSE_LEN; n++)
+  {
+    peak = fmax(peak, fabs(h[n]));
+    err = fmax(err, fabs((double)y[n] - h[n]));
+  }
+  return err / peak;
+}
+
+/* Chebyshev series of arm_lpc_to_lsf_f32, in double precision */
+static double ref_cheb(double x, const double *f, uint32_t m)
+{
+  double b0, b1 = 0.0, b2 = 0.0;
+  uint32_t i;
+
+  for (i = 0U; i < m; i++)
+  {
+    b0 = 2.0 * x * b1 - b2 + f[i];
+    b2 = b1;
+    b1 = b0;
+  }
+  return x * b1 - b2 + 0.5 * f[m];
+}
+
+static uint32_t ref_roots(const double *f, uint32_t m, double *pRoots)
+{
+  double wLo = 0.0, fLo = ref_cheb(1.0, f, m);
+  uint32_t nb = 0U, i, j;
+
+  for (i = 1U; (i <= REF_GRID_POINTS) && (nb < m); i++)
+  {
+    double wHi = PI * (double)i / (double)REF_GRID_POINTS;
+    double fHi = ref_cheb(cos(wHi), f, m);
+
+    if (((fLo * fHi) < 0.0) || (fHi == 0.0))
+    {
+      double lo = wLo, hi = wHi, fl = fLo;
+
+      for (j = 0U; j < 50U; j++)
+      {
+        double mid = 0.5 * (lo + hi);
+        double fm = ref_cheb(cos(mid), f, m);
+
+        if ((fl * fm) <= 0.0)
+        {
+          hi = mid;
+        }
+        else
+        {
+          lo = mid;
+          fl = fm;
+        }
+      }
+      pRoots[nb++] = 0.5 * (lo + hi);
+    }
+    wLo = wHi;
+    fLo = fHi;
+  }
+  return nb;
+}
+
+/* Line spectral frequencies in radians, 0 if they could not all be found */
+static int ref_lsf(const double *a, uint32_t order, double *pLsf)
+{
+  double f1[ARM_LPC_MAX_ORDER / 2 + 1], f2[ARM_LPC_MAX_ORDER / 2 + 1];
+  double r1[ARM_LPC_MAX_ORDER / 2], r2[ARM_LPC_MAX_ORDER / 2];
+  uint32_t m = order / 2U, i, i1 = 0U, i2 = 0U;
+
+  f1[0] = 1.0;
+  f2[0] = 1.0;
+  for (i = 0U; i < m; i++)
+  {
+    f1[i + 1U] = -a[i] - a[order - 1U - i] - f1[i];
+    f2[i + 1U] = -a[i] + a[order - 1U - i] + f2[i];
+  }
+  if ((ref_roots(f1, m, r1) != m) || (ref_roots(f2, m, r2) != m))
+  {
+    return 0;
+  }
+  for (i = 0U; i < order; i++)
+  {
+    pLsf[i] = ((i2 >= m) || ((i1 < m) && (r1[i1] <= r2[i2]))) ? r1[i1++] : r2[i2++];
+  }
+  return 1;
+}
+
+/* Smallest distance between two line spectral frequencies, or to 0 and pi */
+static double lsf_spacing(const double *pLsf, uint32_t order)
+{
+  double d = fmin(pLsf[0], PI - pLsf[order - 1U]);
+  uint32_t i;
+
+  for (i = 1U; i < order; i++)
+  {
+    d = fmin(d, pLsf[i] - pLsf[i - 1U]);
+  }
+  return d;
+}
+
+/* Step-down recursion in double precision, 0 when the filter is unstable */
+static int ref_step_down(const double *pCoeffs, uint32_t order, double *k)
+{
+  double a[ARM_LPC_MAX_ORDER], prev[ARM_LPC_MAX_ORDER];
+  uint32_t m, j;
+
+  memcpy(a, pCoeffs, order * sizeof(double));
+  for (m = order; m > 0U; m--)
+  {
+    if (fabs(a[m - 1U]) >= 1.0)
+    {
+      return 0;
+    }
+    k[m - 1U] = a[m - 1U];
+    memcpy(prev, a, (m - 1U) * sizeof(double));
+    for (j = 0U; j < (m - 1U); j++)
+    {
+      a[j] = (prev[j] + k[m - 1U] * prev[m - 2U - j]) / (1.0 - k[m - 1U] * k[m - 1U]);
+    }
+  }
+  return 1;
+}
+
+/*
+  The lower order coefficients of these filters often exceed 1 although the
+  coefficients of order P are in Q31: saturating them gave wrong reflection
+  coefficients with ARM_MATH_SUCCESS, or rejected stable filters.
+ */
+static void test_synthesis_q31(void)
+{
+  static const double kMax[] = {0.6, 0.9, 0.99};
+  double k[ARM_LPC_MAX_ORDER], a[ARM_LPC_MAX_ORDER], aRef[ARM_LPC_MAX_ORDER], kRef[ARM_LPC_MAX_ORDER];
+  q31_t aq[ARM_LPC_MAX_ORDER], kq[ARM_LPC_MAX_ORDER], vq[ARM_LPC_MAX_ORDER + 1];
+  q31_t state[ARM_LPC_MAX_ORDER + 1];
+  float32_t kf[ARM_LPC_MAX_ORDER];
+  arm_iir_lattice_instance_q31 S;
+  uint32_t f, r, i;
+
+  for (r = 0U; r < (sizeof(kMax) / sizeof(kMax[0])); r++)
+  {
+    double maxKErr = 0.0, maxOutErr = 0.0;
+    uint32_t tested = 0U, unstable = 0U;
+
+    for (f = 0U; f < NUM_FILTERS; f++)
+    {
+      uint32_t order = 1U + rand_u32(ARM_LPC_MAX_ORDER);
+      arm_status status;
+      double margin;
+      int stable;
+
+      random_filter(order, kMax[r], k, a);
+      if (!fits_q31(a, order))
+      {
+        continue;
+      }
+      tested++;
+
+      /* The rounding to Q31 can make the filter unstable when |k| is close to 1 */
+      for (i = 0U; i < order; i++)
+      {
+        aq[i] = to_q31(a[i]);
+        aRef[i] = (double)aq[i] / 2147483648.0;
+      }
+      stable = ref_step_down(aRef, order, kRef);
+      unstable += (stable == 0) ? 1U : 0U;
+      margin = 1.0;
+      for (i = 0U; (i < order) && stable; i++)
+      {
+        margin = fmin(margin, 1.0 - fabs(kRef[i]));
+      }
+
+      /* Near |k| = 1 the precision lost by the block shift can decide either way */
+      status = arm_lpc_synthesis_init_q31(&S, (uint16_t)order, aq, kq, vq, state, 1U);
+      CHECK((status == (stable ? ARM_MATH_SUCCESS : ARM_MATH_ARGUMENT_ERROR)) || (margin < 1.0e-3),
+            "order %u, |k| <= %g: status %d", order, kMax[r], (int)status);
+      if (status != ARM_MATH_SUCCESS)
+      {
+        continue;
+      }
+
+      /* The lattice stores the reflection coefficients from order P down to 1, with the opposite sign */
+      for (i = 0U; i < order; i++)
+      {
+        maxKErr = fmax(maxKErr, fabs((double)kq[i] / 2147483648.0 + k[order - 1U - i]));
+        kf[i] = (float32_t)kq[i] / 2147483648.0f;
+      }
+      CHECK(vq[order] == 0x7FFFFFFF, "ladder coefficient %d", (int)vq[order]);
+
+      maxOutErr = fmax(maxOutErr, lattice_error(kf, order, aRef));
+    }
+
+    printf("Q31 synthesis, |k| <= %g: %u filters (%u unstable in Q31), reflection error %.3g, "
+           "relative impulse response error %.3g\n", kMax[r], tested, unstable, maxKErr, maxOutErr);
+    if (kMax[r] <= 0.6)
+    {
+      CHECK(maxKErr < 1.0e-5, "|k| <= %g: reflection coefficient error %g", kMax[r], maxKErr);
+    }
+    CHECK(maxOutErr < 1.0e-3, "|k| <= %g: impulse response error %g", kMax[r], maxOutErr);
+  }
+
+  /* Unstable filters are rejected */
+  arm_fill_q31(0, aq, 4U);
+  aq[3] = (q31_t)0x80000000;
+  CHECK(arm_lpc_synthesis_init_q31(&S, 4U, aq, kq, vq, state, 1U) == ARM_MATH_ARGUMENT_ERROR, "k = -1 accepted");
+  CHECK(arm_lpc_synthesis_init_q31(&S, 0U, aq, kq, vq, state, 1U) == ARM_MATH_ARGUMENT_ERROR, "order 0 accepted");
+  CHECK(arm_lpc_synthesis_init_q31(&S, ARM_LPC_MAX_ORDER + 1U, aq, kq, vq, state, 1U) == ARM_MATH_ARGUMENT_ERROR,
+        "order %u accepted", ARM_LPC_MAX_ORDER + 1U);
+}
+
+/*
+  The rounding of the prediction coefficients to float32 alone makes some
+  filters unstable above order 14 when |k| <= 0.9, and their step-down is
+  ill-conditioned: only the documented range is required to succeed.
+ */
+static void test_synthesis_f32(void)
+{
+  double k[ARM_LPC_MAX_ORDER], a[ARM_LPC_MAX_ORDER], aRef[ARM_LPC_MAX_ORDER];
+  float32_t af[ARM_LPC_MAX_ORDER], kf[ARM_LPC_MAX_ORDER], vf[ARM_LPC_MAX_ORDER + 1];
+  float32_t state[ARM_LPC_MAX_ORDER + 1];
+  arm_iir_lattice_instance_f32 S;
+  double maxOutErr = 0.0;
+  uint32_t rejected = 0U, high = 0U, f, i;
+
+  for (f = 0U; f < NUM_FILTERS; f++)
+  {
+    uint32_t order = 1U + rand_u32(ARM_LPC_MAX_ORDER);
+    arm_status status;
+
+    random_filter(order, 0.9, k, a);
+    for (i = 0U; i < order; i++)
+    {
+      af[i] = (float32_t)a[i];
+      aRef[i] = (double)af[i];
+    }
+    status = arm_lpc_synthesis_init_f32(&S, (uint16_t)order, af, kf, vf, state, 1U);
+
+    if (order > 14U)
+    {
+      high++;
+      rejected += (status != ARM_MATH_SUCCESS) ? 1U : 0U;
+      continue;
+    }
+    CHECK(status == ARM_MATH_SUCCESS, "order %u: status %d", order, (int)status);
+    if (status == ARM_MATH_SUCCESS)
+    {
+      maxOutErr = fmax(maxOutErr, lattice_error(kf, order, aRef));
+    }
+  }
+
+  printf("f32 synthesis: relative impulse response error %.3g up to order 14, %u of %u filters rejected above\n",
+         maxOutErr, rejected, high);
+  CHECK(maxOutErr < 1.0e-3, "impulse response error %g", maxOutErr);
+}
+
+static void test_lsf(void)
+{
+  double k[ARM_LPC_MAX_ORDER], a[ARM_LPC_MAX_ORDER], ref[ARM_LPC_MAX_ORDER];
+  float32_t af[ARM_LPC_MAX_ORDER], lsf[ARM_LPC_MAX_ORDER];
+  q31_t aq[ARM_LPC_MAX_ORDER], lsfq[ARM_LPC_MAX_ORDER];
+  double maxErr = 0.0, maxErrQ31 = 0.0, maxDiff = 0.0;
+  uint32_t tested = 0U, testedQ31 = 0U, f, i;
+
+  for (f = 0U; f < 4U * NUM_FILTERS; f++)
+  {
+    uint32_t order = 2U * (1U + rand_u32(ARM_LPC_MAX_ORDER / 2U));
+    arm_status status, statusQ31;
+
+    random_filter(order, 0.9, k, a);
+
+    /* Roots closer than the search grid of the library cannot be separated */
+    if (!ref_lsf(a, order, ref) || (lsf_spacing(ref, order) < (2.0 * PI / 128.0)))
+    {
+      continue;
+    }
+    tested++;
+
+    for (i = 0U; i < order; i++)
+    {
+      af[i] = (float32_t)a[i];
+    }
+    status = arm_lpc_to_lsf_f32(af, lsf, (uint16_t)order);
+    CHECK(status == ARM_MATH_SUCCESS, "f32 order %u: status %d", order, (int)status);
+    if (status == ARM_MATH_SUCCESS)
+    {
+      for (i = 0U; i < order; i++)
+      {
+        maxErr = fmax(maxErr, fabs((double)lsf[i] - ref[i]));
+      }
+    }
+
+    if (!fits_q31(a, order))
+    {
+      continue;
+    }
+    testedQ31++;
+
+    for (i = 0U; i < order; i++)
+    {
+      aq[i] = to_q31(a[i]);
+    }
+    statusQ31 = arm_lpc_to_lsf_q31(aq, lsfq, (uint16_t)order);
+    CHECK(statusQ31 == status, "Q31 order %u: status %d, f32 status %d", order, (int)statusQ31, (int)status);
+    if ((statusQ31 == ARM_MATH_SUCCESS) && (status == ARM_MATH_SUCCESS))
+    {
+      for (i = 0U; i < order; i++)
+      {
+        double w = (double)lsfq[i] * PI / 2147483648.0;
+
+        CHECK((i == 0U) || (lsfq[i] > lsfq[i - 1U]), "Q31 order %u: LSF %u not above LSF %u", order, i, i - 1U);
+        maxErrQ31 = fmax(maxErrQ31, fabs(w - ref[i]));
+        maxDiff = fmax(maxDiff, fabs(w - (double)lsf[i]));
+      }
+    }
+  }
+
+  printf("LSF: %u filters (%u in Q31), error f32 %.3g, Q31 %.3g rad, Q31 against f32 %.3g rad\n",
+         tested, testedQ31, maxErr, maxErrQ31, maxDiff);
+  CHECK(maxErr < 3.0e-3, "f32 LSF error %g", maxErr);
+  CHECK(maxErrQ31 < 3.0e-3, "Q31 LSF error %g", maxErrQ31);
+  CHECK(maxDiff < 3.0e-3, "Q31 LSF differ from f32 by %g", maxDiff);
+
+  CHECK(arm_lpc_to_lsf_f32(af, lsf, 3U) == ARM_MATH_ARGUMENT_ERROR, "odd order accepted");
+  CHECK(arm_lpc_to_lsf_q31(aq, lsfq, ARM_LPC_MAX_ORDER + 2U) == ARM_MATH_ARGUMENT_ERROR, "order %u accepted",
+        ARM_LPC_MAX_ORDER + 2U);
+}
+
+/*
+  Order 4 filter whose difference polynomial is 2 x (x - cos(0.8 pi)) in
+  x = cos(w): its first root is pi/2, where the Q31 grid point 64 has
+  cos(w) = 0 exactly, and the polynomial goes from positive to 0 there and
+  then negative. The coefficients are multiples of 2^-20 so that it
+  evaluates to exactly 0 at that grid point.
+ */
+static void test_lsf_grid_root(void)
+{
+  const double w[4] = {0.25 * PI, 0.5 * PI, 0.65 * PI, 0.8 * PI};
+  int64_t f1[3], f2[3];
+  q31_t aq[4], lsfq[4];
+  uint32_t i;
+
+  /* f[0] T2(x) + f[1] T1(x) + f[2] / 2 = 2 x^2 - 1 + f[1] x + f[2] / 2 */
+  f1[0] = 1 << 20;
+  f1[1] = (int64_t)llround(-2.0 * (cos(w[0]) + cos(w[2])) * 1048576.0);
+  f1[2] = (int64_t)llround((4.0 * cos(w[0]) * cos(w[2]) + 2.0) * 1048576.0);
+  f2[0] = 1 << 20;
+  f2[1] = (int64_t)llround(-2.0 * cos(w[3]) * 1048576.0);
+  f2[2] = 2 << 20;
+
+  /* a(i) + a(P-1-i) = -(f1[i+1] + f1[i]) and a(i) - a(P-1-i) = f2[i] - f2[i+1] */
+  for (i = 0U; i < 2U; i++)
+  {
+    int64_t diff = f2[i] - f2[i + 1U];
+    int64_t sum;
+
+    if (((f1[i + 1U] + f1[i] + diff) & 1) != 0)
+    {
+      f1[i + 1U]++;
+    }
+    sum = -(f1[i + 1U] + f1[i]);
+    aq[i] = (q31_t)(((sum + diff) / 2) * 2048);
+    aq[3U - i] = (q31_t)(((sum - diff) / 2) * 2048);
+  }
+
+  CHECK(arm_cos_q31(0x20000000) == 0, "cos(pi/2) is %d", (int)arm_cos_q31(0x20000000));
+  CHECK(arm_lpc_to_lsf_q31(aq, lsfq, 4U) == ARM_MATH_SUCCESS, "grid root: conversion failed");
+  for (i = 0U; i < 4U; i++)
+  {
+    double err = fabs((double)lsfq[i] * PI / 2147483648.0 - w[i]);
+
+    CHECK(err < 3.0e-3, "grid root: LSF %u is %g instead of %g", i, (double)lsfq[i] * PI / 2147483648.0, w[i]);
+  }
+}
+
+/* Autocorrelation and Levinson Durbin in double precision */
+static void ref_analysis(const double *x, uint32_t len, uint32_t order, double *a)
+{
+  double r[ARM_LPC_MAX_ORDER + 1], prev[ARM_LPC_MAX_ORDER];
+  double e;
+  uint32_t m, j, n;
+
+  for (m = 0U; m <= order; m++)
+  {
+    r[m] = 0.0;
+    for (n = m; n < len; n++)
+    {
+      r[m] += x[n] * x[n - m];
+    }
+  }
+
+  e = r[0];
+  for (m = 0U; m < order; m++)
+  {
+    double acc = r[m + 1U];
+    double km;
+
+    for (j = 0U; j < m; j++)
+    {
+      acc -= a[j] * r[m - j];
+    }
+    km = acc / e;
+    memcpy(prev, a, m * sizeof(double));
+    for (j = 0U; j < m; j++)
+    {
+      a[j] = prev[j] - km * prev[m - 1U - j];
+    }
+    a[m] = km;
+    e *= 1.0 - km * km;
+  }
+}
+
+static void test_analysis(void)
+{
+  static const double ar[4] = {0.75, -0.5, 0.25, -0.125};
+  static float32_t scratch[2 * FFT_LEN];
+  static q31_t scratchQ31[FRAME_LEN + ARM_LPC_MAX_ORDER + 1];
+  float32_t xf[FRAME_LEN], win[FRAME_LEN], af[ARM_LPC_MAX_ORDER], lsf[ARM_LPC_MAX_ORDER], err;
+  q31_t xq[FRAME_LEN], winq[FRAME_LEN], aq[ARM_LPC_MAX_ORDER], lsfq[ARM_LPC_MAX_ORDER], errq;
+  double x[FRAME_LEN], xw[FRAME_LEN], a[ARM_LPC_MAX_ORDER];
+  arm_lpc_analysis_instance_f32 S;
+  arm_lpc_analysis_instance_q31 Sq;
+  arm_rfft_fast_instance_f32 rfft;
+  static const uint16_t orders[] = {4U, 10U, 16U};
+  uint32_t n, i, o;
+
+  /* AR(4) process, Hann window */
+  for (n = 0U; n < FRAME_LEN; n++)
+  {
+    double acc = 0.1 * rand_f64();
+
+    for (i = 0U; (i < 4U) && (i < n); i++)
+    {
+      acc += ar[i] * x[n - 1U - i];
+    }
+    x[n] = acc;
+  }
+  for (n = 0U; n < FRAME_LEN; n++)
+  {
+    double w = 0.5 - 0.5 * cos(2.0 * PI * ((double)n + 0.5) / (double)FRAME_LEN);
+
+    xf[n] = (float32_t)x[n];
+    xq[n] = to_q31(x[n] / 2.0);
+    win[n] = (float32_t)w;
+    winq[n] = to_q31(w);
+    xw[n] = (double)xf[n] * (double)win[n];
+  }
+  CHECK(arm_rfft_fast_init_f32(&rfft, FFT_LEN) == ARM_MATH_SUCCESS, "RFFT init");
+
+  for (o = 0U; o < (sizeof(orders) / sizeof(orders[0])); o++)
+  {
+    uint16_t order = orders[o];
+    double maxErr = 0.0, maxErrFft = 0.0, maxErrQ31 = 0.0;
+
+    ref_analysis(xw, FRAME_LEN, order, a);
+
+    CHECK(arm_lpc_analysis_init_f32(&S, order, FRAME_LEN, win, NULL, NULL, scratch) == ARM_MATH_SUCCESS, "init");
+    CHECK(arm_lpc_analysis_f32(&S, xf, af, lsf, &err) == ARM_MATH_SUCCESS, "order %u: direct analysis", order);
+    for (i = 0U; i < order; i++)
+    {
+      maxErr = fmax(maxErr, fabs((double)af[i] - a[i]));
+    }
+
+    CHECK(arm_lpc_analysis_init_f32(&S, order, FRAME_LEN, win, NULL, &rfft, scratch) == ARM_MATH_SUCCESS, "init");
+    CHECK(arm_lpc_analysis_f32(&S, xf, af, NULL, &err) == ARM_MATH_SUCCESS, "order %u: RFFT analysis", order);
+    for (i = 0U; i < order; i++)
+    {
+      maxErrFft = fmax(maxErrFft, fabs((double)af[i] - a[i]));
+    }
+
+    CHECK(arm_lpc_analysis_init_q31(&Sq, order, FRAME_LEN, winq, NULL, scratchQ31) == ARM_MATH_SUCCESS, "init");
+    CHECK(arm_lpc_analysis_q31(&Sq, xq, aq, lsfq, &errq) == ARM_MATH_SUCCESS, "order %u: Q31 analysis", order);
+    for (i = 0U; i < order; i++)
+    {
+      maxErrQ31 = fmax(maxErrQ31, fabs((double)aq[i] / 2147483648.0 - a[i]));
+    }
+
+    printf("Analysis order %u: coefficient error direct %.3g, RFFT %.3g, Q31 %.3g\n", order, maxErr, maxErrFft,
+           maxErrQ31);
+    CHECK(maxErr < 1.0e-3, "order %u: direct analysis error %g", order, maxErr);
+    CHECK(maxErrFft < 1.0e-3, "order %u: RFFT analysis error %g", order, maxErrFft);
+    CHECK(maxErrQ31 < 1.0e-3, "order %u: Q31 analysis error %g", order, maxErrQ31);
+  }
+
+  /* Argument checks */
+  CHECK(arm_lpc_analysis_init_f32(&S, 32U, FRAME_LEN, NULL, NULL, &rfft, scratch) == ARM_MATH_ARGUMENT_ERROR,
+        "RFFT shorter than frameLength + order accepted");
+  CHECK(arm_lpc_analysis_init_f32(&S, 0U, FRAME_LEN, NULL, NULL, NULL, scratch) == ARM_MATH_ARGUMENT_ERROR,
+        "order 0 accepted");
+  memset(xf, 0, sizeof(xf));
+  CHECK(arm_lpc_analysis_init_f32(&S, 4U, FRAME_LEN, NULL, NULL, NULL, scratch) == ARM_MATH_SUCCESS, "init");
+  CHECK(arm_lpc_analysis_f32(&S, xf, af, NULL, &err) == ARM_MATH_SINGULAR, "silent frame accepted");
+}
+
+int main(void)
+{
+  test_synthesis_q31();
+  test_synthesis_f32();
+  test_lsf();
+  test_lsf_grid_root();
+  test_analysis();
+
+  if (failures != 0)
+  {
+    printf("%d failures\n", failures);
+    return EXIT_FAILURE;
+  }
+
+  printf("All LPC tests passed\n");
+  return EXIT_SUCCESS;
+}
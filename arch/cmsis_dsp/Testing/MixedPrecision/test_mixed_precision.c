@@ -0,0 +1,438 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        test_mixed_precision.c
+ * Description:  Host tests of the f16 and bf16 storage kernels
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.16.1
+ *
+ * Target Processor: Host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+  The conversions are checked exhaustively against a reference decoding, and
+  against the compiler _Float16 type when the host has one. The kernels are
+  checked against double precision references computed on the same converted
+  operands, for sizes covering the unrolled loops and their tails.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arm_math.h"
+
+#define MAX_LEN      67
+#define MAX_TAPS     29
+#define MAX_BLOCK    19
+#define NUM_BLOCKS   5
+
+static int failures;
+
+#define CHECK(cond, ...)                          \
+  do                                              \
+  {                                               \
+    if (!(cond))                                  \
+    {                                             \
+      printf("FAIL %s:%d: ", __FILE__, __LINE__); \
+      printf(__VA_ARGS__);                        \
+      printf("\n");                               \
+      failures++;                                 \
+    }                                             \
+  } while (0)
+
+static uint32_t rngState = 0x12345678U;
+
+static float32_t rand_f32(void)
+{
+  rngState = rngState * 1664525U + 1013904223U;
+  return ((float32_t)(rngState >> 8) / 8388608.0f) - 1.0f;
+}
+
+static uint32_t f32_bits(float32_t f)
+{
+  uint32_t u;
+  memcpy(&u, &f, sizeof(u));
+  return u;
+}
+
+static float32_t bits_f32(uint32_t u)
+{
+  float32_t f;
+  memcpy(&f, &u, sizeof(f));
+  return f;
+}
+
+/* Reference f16 decoding */
+static double ref_fp16(fp16_t h)
+{
+  int expo = (h >> 10) & 0x1F;
+  int mant = h & 0x3FF;
+  double v;
+
+  if (expo == 0x1F)
+  {
+    v = (mant != 0) ? NAN : INFINITY;
+  }
+  else if (expo == 0)
+  {
+    v = ldexp((double)mant, -24);
+  }
+  else
+  {
+    v = ldexp((double)(mant | 0x400), expo - 25);
+  }
+
+  return ((h & 0x8000U) != 0U) ? -v : v;
+}
+
+static void test_fp16_conversions(void)
+{
+  uint32_t i;
+
+  /* Every f16 value decodes exactly and encodes back to itself */
+  for (i = 0; i < 0x10000U; i++)
+  {
+    fp16_t h = (fp16_t)i;
+    float32_t f = arm_fp16_to_f32(h);
+    double ref = ref_fp16(h);
+
+    if (isnan(ref))
+    {
+      CHECK(isnan(f), "0x%04x should decode to NaN", i);
+      CHECK(isnan(arm_fp16_to_f32(arm_f32_to_fp16(f))), "NaN 0x%04x should stay NaN", i);
+    }
+    else
+    {
+      CHECK((double)f == ref, "0x%04x decodes to %g instead of %g", i, (double)f, ref);
+      CHECK(arm_f32_to_fp16(f) == h, "0x%04x encodes back to 0x%04x", i, arm_f32_to_fp16(f));
+    }
+  }
+
+  /* Halfway between two consecutive f16 values rounds to the even one, just above rounds up */
+  for (i = 0; i < 0x7BFFU; i++)
+  {
+    double lo = ref_fp16((fp16_t)i);
+    double hi = ref_fp16((fp16_t)(i + 1U));
+    float32_t mid = (float32_t)((lo + hi) / 2.0);
+    fp16_t even = ((i & 1U) == 0U) ? (fp16_t)i : (fp16_t)(i + 1U);
+
+    CHECK(arm_f32_to_fp16(mid) == even, "tie after 0x%04x gives 0x%04x", i, arm_f32_to_fp16(mid));
+    CHECK(arm_f32_to_fp16(bits_f32(f32_bits(mid) + 1U)) == (fp16_t)(i + 1U), "above tie after 0x%04x", i);
+    CHECK(arm_f32_to_fp16(bits_f32(f32_bits(mid) - 1U)) == (fp16_t)i, "below tie after 0x%04x", i);
+  }
+
+  CHECK(arm_f32_to_fp16(65519.99f) == 0x7BFFU, "65519.99 should round to 65504");
+  CHECK(arm_f32_to_fp16(65520.0f) == 0x7C00U, "65520 should round to infinity");
+  CHECK(arm_f32_to_fp16(-1.0e10f) == 0xFC00U, "-1e10 should round to -infinity");
+  CHECK(arm_f32_to_fp16(1.0e-10f) == 0x0000U, "1e-10 should round to +0");
+  CHECK(arm_f32_to_fp16(-0.0f) == 0x8000U, "-0 should keep its sign");
+
+#if defined(__FLT16_MAX__)
+  /* Cross-check the rounding of random float32_t values with the compiler */
+  for (i = 0; i < 1000000U; i++)
+  {
+    float32_t f;
+    _Float16 c;
+    fp16_t ref;
+
+    /* Magnitudes from 2^-30, below the subnormals, to 2^17, above the f16 range */
+    rngState = rngState * 1664525U + 1013904223U;
+    f = bits_f32((rngState & 0x807FFFFFU) | ((97U + ((rngState >> 23) % 48U)) << 23));
+    c = (_Float16)f;
+    memcpy(&ref, &c, sizeof(ref));
+    CHECK(arm_f32_to_fp16(f) == ref, "%a gives 0x%04x instead of 0x%04x", (double)f, arm_f32_to_fp16(f), ref);
+  }
+#endif
+}
+
+static void test_bf16_conversions(void)
+{
+  uint32_t i;
+
+  for (i = 0; i < 0x10000U; i++)
+  {
+    bf16_t b = (bf16_t)i;
+    float32_t f = arm_bf16_to_f32(b);
+
+    CHECK(f32_bits(f) == (i << 16), "bf16 0x%04x decodes to 0x%08x", i, f32_bits(f));
+    if (!isnan(f))
+    {
+      CHECK(arm_f32_to_bf16(f) == b, "bf16 0x%04x encodes back to 0x%04x", i, arm_f32_to_bf16(f));
+    }
+  }
+
+  CHECK(arm_f32_to_bf16(bits_f32(0x3F808000U)) == 0x3F80U, "tie should round to even");
+  CHECK(arm_f32_to_bf16(bits_f32(0x3F818000U)) == 0x3F82U, "tie should round to even");
+  CHECK(arm_f32_to_bf16(bits_f32(0x3F808001U)) == 0x3F81U, "above tie should round up");
+  CHECK(isnan(arm_bf16_to_f32(arm_f32_to_bf16(bits_f32(0x7F800001U)))), "NaN should stay NaN");
+}
+
+static void test_vector_conversions(void)
+{
+  float32_t src[MAX_LEN], back[MAX_LEN];
+  fp16_t h[MAX_LEN];
+  bf16_t b[MAX_LEN];
+  uint32_t i;
+
+  for (i = 0; i < MAX_LEN; i++)
+  {
+    src[i] = 100.0f * rand_f32();
+  }
+
+  arm_float_to_fp16(src, h, MAX_LEN);
+  arm_fp16_to_float(h, back, MAX_LEN);
+  for (i = 0; i < MAX_LEN; i++)
+  {
+    CHECK(h[i] == arm_f32_to_fp16(src[i]), "arm_float_to_fp16[%u]", i);
+    CHECK(back[i] == arm_fp16_to_f32(h[i]), "arm_fp16_to_float[%u]", i);
+  }
+
+  arm_float_to_bf16(src, b, MAX_LEN);
+  arm_bf16_to_float(b, back, MAX_LEN);
+  for (i = 0; i < MAX_LEN; i++)
+  {
+    CHECK(b[i] == arm_f32_to_bf16(src[i]), "arm_float_to_bf16[%u]", i);
+    CHECK(back[i] == arm_bf16_to_f32(b[i]), "arm_bf16_to_float[%u]", i);
+  }
+}
+
+/* Relative tolerance of a float32_t accumulation of n products against a double reference */
+static int close_to(float32_t v, double ref, double absSum, uint32_t n)
+{
+  return fabs((double)v - ref) <= (absSum * (double)(n + 1U) * 1.2e-7) + 1e-30;
+}
+
+static void test_dot_prod(void)
+{
+  float32_t a[MAX_LEN], b[MAX_LEN];
+  fp16_t ah[MAX_LEN], bh[MAX_LEN];
+  bf16_t ab[MAX_LEN], bb[MAX_LEN];
+  uint32_t n, i;
+
+  for (i = 0; i < MAX_LEN; i++)
+  {
+    a[i] = rand_f32();
+    b[i] = rand_f32();
+  }
+  arm_float_to_fp16(a, ah, MAX_LEN);
+  arm_float_to_fp16(b, bh, MAX_LEN);
+  arm_float_to_bf16(a, ab, MAX_LEN);
+  arm_float_to_bf16(b, bb, MAX_LEN);
+
+  for (n = 0; n <= MAX_LEN; n++)
+  {
+    double refH = 0.0, refB = 0.0, absH = 0.0, absB = 0.0;
+    float32_t res;
+
+    for (i = 0; i < n; i++)
+    {
+      refH += ref_fp16(ah[i]) * ref_fp16(bh[i]);
+      absH += fabs(ref_fp16(ah[i]) * ref_fp16(bh[i]));
+      refB += (double)arm_bf16_to_f32(ab[i]) * (double)arm_bf16_to_f32(bb[i]);
+      absB += fabs((double)arm_bf16_to_f32(ab[i]) * (double)arm_bf16_to_f32(bb[i]));
+    }
+
+    arm_dot_prod_f16_f32(ah, bh, n, &res);
+    CHECK(close_to(res, refH, absH, n), "arm_dot_prod_f16_f32 n=%u: %g instead of %g", n, (double)res, refH);
+
+    arm_dot_prod_bf16_f32(ab, bb, n, &res);
+    CHECK(close_to(res, refB, absB, n), "arm_dot_prod_bf16_f32 n=%u: %g instead of %g", n, (double)res, refB);
+  }
+}
+
+static void test_mat_vec_mult(void)
+{
+  fp16_t wh[9 * 13];
+  bf16_t wb[9 * 13];
+  float32_t vec[13], out[9 + 1];
+  uint16_t rows, cols;
+  uint32_t i, r, c;
+
+  for (i = 0; i < 9 * 13; i++)
+  {
+    float32_t w = rand_f32();
+    wh[i] = arm_f32_to_fp16(w);
+    wb[i] = arm_f32_to_bf16(w);
+  }
+  for (i = 0; i < 13; i++)
+  {
+    vec[i] = rand_f32();
+  }
+
+  for (rows = 1; rows <= 9; rows++)
+  {
+    for (cols = 1; cols <= 13; cols += 3)
+    {
+      arm_matrix_instance_fp16 mh = { rows, cols, wh };
+      arm_matrix_instance_bf16 mb = { rows, cols, wb };
+
+      /* The element after the result must not be written */
+      out[rows] = 12345.0f;
+      arm_mat_vec_mult_f16_f32(&mh, vec, out);
+      CHECK(out[rows] == 12345.0f, "arm_mat_vec_mult_f16_f32 %ux%u writes past the result", rows, cols);
+      for (r = 0; r < rows; r++)
+      {
+        double ref = 0.0, absSum = 0.0;
+        for (c = 0; c < cols; c++)
+        {
+          ref += ref_fp16(wh[r * cols + c]) * (double)vec[c];
+          absSum += fabs(ref_fp16(wh[r * cols + c]) * (double)vec[c]);
+        }
+        CHECK(close_to(out[r], ref, absSum, cols), "arm_mat_vec_mult_f16_f32 %ux%u row %u", rows, cols, r);
+      }
+
+      arm_mat_vec_mult_bf16_f32(&mb, vec, out);
+      for (r = 0; r < rows; r++)
+      {
+        double ref = 0.0, absSum = 0.0;
+        for (c = 0; c < cols; c++)
+        {
+          ref += (double)arm_bf16_to_f32(wb[r * cols + c]) * (double)vec[c];
+          absSum += fabs((double)arm_bf16_to_f32(wb[r * cols + c]) * (double)vec[c]);
+        }
+        CHECK(close_to(out[r], ref, absSum, cols), "arm_mat_vec_mult_bf16_f32 %ux%u row %u", rows, cols, r);
+      }
+    }
+  }
+}
+
+static void test_fir(void)
+{
+  float32_t coeffs[MAX_TAPS];
+  fp16_t ch[MAX_TAPS];
+  bf16_t cb[MAX_TAPS];
+  float32_t src[MAX_BLOCK * NUM_BLOCKS];
+  float32_t dstH[MAX_BLOCK * NUM_BLOCKS], dstB[MAX_BLOCK * NUM_BLOCKS];
+  float32_t stateH[MAX_TAPS + MAX_BLOCK - 1], stateB[MAX_TAPS + MAX_BLOCK - 1];
+  uint16_t numTaps;
+  uint32_t blockSize, i, k;
+
+  for (i = 0; i < MAX_TAPS; i++)
+  {
+    coeffs[i] = rand_f32();
+  }
+  arm_float_to_fp16(coeffs, ch, MAX_TAPS);
+  arm_float_to_bf16(coeffs, cb, MAX_TAPS);
+  for (i = 0; i < MAX_BLOCK * NUM_BLOCKS; i++)
+  {
+    src[i] = rand_f32();
+  }
+
+  for (numTaps = 1; numTaps <= MAX_TAPS; numTaps += 4)
+  {
+    for (blockSize = 1; blockSize <= MAX_BLOCK; blockSize += 3)
+    {
+      arm_fir_instance_f16_f32 sh;
+      arm_fir_instance_bf16_f32 sb;
+
+      arm_fir_init_f16_f32(&sh, numTaps, ch, stateH, blockSize);
+      arm_fir_init_bf16_f32(&sb, numTaps, cb, stateB, blockSize);
+
+      /* Several blocks so that the state carried between calls is checked */
+      for (k = 0; k < NUM_BLOCKS; k++)
+      {
+        arm_fir_f16_f32(&sh, &src[k * blockSize], &dstH[k * blockSize], blockSize);
+        arm_fir_bf16_f32(&sb, &src[k * blockSize], &dstB[k * blockSize], blockSize);
+      }
+
+      /* The coefficients are in time reversed order: y[n] = sum c[numTaps-1-j] * x[n-j] */
+      for (i = 0; i < blockSize * NUM_BLOCKS; i++)
+      {
+        double refH = 0.0, refB = 0.0, absH = 0.0, absB = 0.0;
+        uint32_t j;
+
+        for (j = 0; (j < numTaps) && (j <= i); j++)
+        {
+          refH += ref_fp16(ch[numTaps - 1U - j]) * (double)src[i - j];
+          absH += fabs(ref_fp16(ch[numTaps - 1U - j]) * (double)src[i - j]);
+          refB += (double)arm_bf16_to_f32(cb[numTaps - 1U - j]) * (double)src[i - j];
+          absB += fabs((double)arm_bf16_to_f32(cb[numTaps - 1U - j]) * (double)src[i - j]);
+        }
+        CHECK(close_to(dstH[i], refH, absH, numTaps), "arm_fir_f16_f32 taps=%u block=%u y[%u]", numTaps, blockSize, i);
+        CHECK(close_to(dstB[i], refB, absB, numTaps), "arm_fir_bf16_f32 taps=%u block=%u y[%u]", numTaps, blockSize, i);
+      }
+    }
+  }
+}
+
+static void test_cmplx_mag(void)
+{
+  float32_t src[2 * MAX_LEN];
+  fp16_t sh[2 * MAX_LEN], dh[MAX_LEN + 1];
+  bf16_t sb[2 * MAX_LEN], db[MAX_LEN + 1];
+  uint32_t n, i;
+
+  for (i = 0; i < 2 * MAX_LEN; i++)
+  {
+    src[i] = 1000.0f * rand_f32();
+  }
+  /* Squares beyond the f16 range must not overflow */
+  src[0] = 40000.0f;
+  src[1] = -40000.0f;
+  arm_float_to_fp16(src, sh, 2 * MAX_LEN);
+  arm_float_to_bf16(src, sb, 2 * MAX_LEN);
+
+  for (n = 0; n <= MAX_LEN; n++)
+  {
+    dh[n] = 0x1234U;
+    db[n] = 0x1234U;
+    arm_cmplx_mag_f16_f32(sh, dh, n);
+    arm_cmplx_mag_bf16_f32(sb, db, n);
+    CHECK((dh[n] == 0x1234U) && (db[n] == 0x1234U), "arm_cmplx_mag n=%u writes past the result", n);
+
+    for (i = 0; i < n; i++)
+    {
+      double re = ref_fp16(sh[2 * i]), im = ref_fp16(sh[2 * i + 1]);
+      fp16_t refH = arm_f32_to_fp16((float32_t)sqrt(re * re + im * im));
+      double reb = (double)arm_bf16_to_f32(sb[2 * i]), imb = (double)arm_bf16_to_f32(sb[2 * i + 1]);
+      bf16_t refB = arm_f32_to_bf16((float32_t)sqrt(reb * reb + imb * imb));
+
+      /* float32_t intermediates may move the result by one f16 or bf16 unit at most */
+      CHECK(abs((int)dh[i] - (int)refH) <= 1, "arm_cmplx_mag_f16_f32 n=%u [%u]: 0x%04x instead of 0x%04x",
+            n, i, dh[i], refH);
+      CHECK(abs((int)db[i] - (int)refB) <= 1, "arm_cmplx_mag_bf16_f32 n=%u [%u]: 0x%04x instead of 0x%04x",
+            n, i, db[i], refB);
+    }
+  }
+
+  CHECK(dh[0] == arm_f32_to_fp16(56568.542f), "40000-40000j gives 0x%04x", dh[0]);
+}
+
+int main(void)
+{
+  test_fp16_conversions();
+  test_bf16_conversions();
+  test_vector_conversions();
+  test_dot_prod();
+  test_mat_vec_mult();
+  test_fir();
+  test_cmplx_mag();
+
+  if (failures != 0)
+  {
+    printf("%d failures\n", failures);
+    return EXIT_FAILURE;
+  }
+
+  printf("All mixed precision tests passed\n");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,277 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        test_spline.c
+ * Description:  Host tests of the cubic spline evaluation functions
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.16.1
+ *
+ * Target Processor: Host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+  The knots are random steps of a smooth function, for both spline types.
+  The tests check against arm_spline_f32 on the same sorted queries:
+  - the uniform resampling, within 1.1e-6,
+  - the unordered and single point evaluations, exactly,
+  and the Q31 spline against the floating-point spline of the same knots,
+  within 1.6e-7, inside and outside of the knot range.
+  Two knots give the straight line through them, without NaN, for both
+  types and in Q31.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arm_math.h"
+
+#define NUM_KNOTS        33U
+#define NUM_QUERIES      2000U
+#define MAX_ERR_UNIFORM  1.1e-6
+#define MAX_ERR_Q31      1.6e-7
+
+static int failures;
+
+#define CHECK(cond, ...)                          \
+  do                                              \
+  {                                               \
+    if (!(cond))                                  \
+    {                                             \
+      printf("FAIL %s:%d: ", __FILE__, __LINE__); \
+      printf(__VA_ARGS__);                        \
+      printf("\n");                               \
+      failures++;                                 \
+    }                                             \
+  } while (0)
+
+static const arm_spline_type types[2] = {ARM_SPLINE_NATURAL, ARM_SPLINE_PARABOLIC_RUNOUT};
+static const char * const typeNames[2] = {"natural", "parabolic runout"};
+
+static uint32_t rngState = 0x12345678U;
+
+/* Uniform in [0, 1) */
+static double rand_unit(void)
+{
+  rngState = rngState * 1664525U + 1013904223U;
+  return (double)(rngState >> 8) / 16777216.0;
+}
+
+static q31_t to_q31(double x)
+{
+  double v = round(x * 2147483648.0);
+
+  return (q31_t)((v > 2147483647.0) ? 2147483647.0 : ((v < -2147483648.0) ? -2147483648.0 : v));
+}
+
+/* Knots in [xMin, xMax], with steps between 0.5 and 1.5 times the mean one */
+static void random_knots(double xMin, double xMax, double amplitude, double *x, double *y, uint32_t n)
+{
+  double sum = 0.0;
+  uint32_t i;
+
+  x[0] = 0.0;
+  for (i = 1U; i < n; i++)
+  {
+    x[i] = x[i - 1U] + 0.5 + rand_unit();
+    sum = x[i];
+  }
+  for (i = 0U; i < n; i++)
+  {
+    x[i] = xMin + (xMax - xMin) * x[i] / sum;
+    y[i] = amplitude * (0.7 * sin(2.3 * x[i]) + 0.3 * cos(7.1 * x[i]));
+  }
+}
+
+static void test_float(void)
+{
+  static float32_t x[NUM_KNOTS], y[NUM_KNOTS], coeffs[3U * (NUM_KNOTS - 1U)], temp[2U * NUM_KNOTS - 1U];
+  static float32_t xq[NUM_QUERIES], xqShuffled[NUM_QUERIES], ref[NUM_QUERIES], out[NUM_QUERIES];
+  static uint32_t perm[NUM_QUERIES];
+  double xd[NUM_KNOTS], yd[NUM_KNOTS];
+  arm_spline_instance_f32 S;
+  uint32_t t, i, j, k, mismatches;
+  float32_t x0, dx;
+  double err, maxErr;
+
+  random_knots(-1.0, 3.0, 1.0, xd, yd, NUM_KNOTS);
+  for (i = 0U; i < NUM_KNOTS; i++)
+  {
+    x[i] = (float32_t)xd[i];
+    y[i] = (float32_t)yd[i];
+  }
+
+  for (t = 0U; t < 2U; t++)
+  {
+    arm_spline_init_f32(&S, types[t], x, y, NUM_KNOTS, coeffs, temp);
+
+    /* Uniform grid from before the first knot to after the last one */
+    x0 = x[0] - 0.05f;
+    dx = ((x[NUM_KNOTS - 1U] + 0.05f) - x0) / (float32_t)(NUM_QUERIES - 1U);
+    for (k = 0U; k < NUM_QUERIES; k++)
+    {
+      xq[k] = x0 + (float32_t)k * dx;
+    }
+    arm_spline_f32(&S, xq, ref, NUM_QUERIES);
+    arm_spline_resample_uniform_f32(&S, x0, dx, out, NUM_QUERIES);
+    maxErr = 0.0;
+    for (k = 0U; k < NUM_QUERIES; k++)
+    {
+      err = fabs((double)out[k] - (double)ref[k]);
+      maxErr = (err > maxErr) ? err : maxErr;
+    }
+    CHECK(maxErr <= MAX_ERR_UNIFORM, "%s: uniform resampling error %g", typeNames[t], maxErr);
+
+    /* The same queries in random order */
+    for (k = 0U; k < NUM_QUERIES; k++)
+    {
+      perm[k] = k;
+    }
+    for (k = NUM_QUERIES - 1U; k > 0U; k--)
+    {
+      j = (uint32_t)(rand_unit() * (double)(k + 1U));
+      i = perm[k];
+      perm[k] = perm[j];
+      perm[j] = i;
+    }
+    for (k = 0U; k < NUM_QUERIES; k++)
+    {
+      xqShuffled[k] = xq[perm[k]];
+    }
+    arm_spline_unsorted_f32(&S, xqShuffled, out, NUM_QUERIES);
+    mismatches = 0U;
+    for (k = 0U; k < NUM_QUERIES; k++)
+    {
+      mismatches += (out[k] != ref[perm[k]]) ? 1U : 0U;
+      mismatches += (arm_spline_lookup_f32(&S, xqShuffled[k]) != ref[perm[k]]) ? 1U : 0U;
+    }
+    CHECK(mismatches == 0U, "%s: %u unordered evaluations differ from the sorted ones", typeNames[t], mismatches);
+
+    printf("%s spline: uniform resampling error %.3g\n", typeNames[t], maxErr);
+  }
+}
+
+static void test_q31(void)
+{
+  static q31_t x[NUM_KNOTS], y[NUM_KNOTS], coeffs[5U * (NUM_KNOTS - 1U)], xq[NUM_QUERIES], out[NUM_QUERIES];
+  static float32_t xf[NUM_KNOTS], yf[NUM_KNOTS], coeffsF[3U * (NUM_KNOTS - 1U)];
+  static float32_t temp[7U * NUM_KNOTS - 4U];
+  double xd[NUM_KNOTS], yd[NUM_KNOTS];
+  arm_spline_instance_q31 S;
+  arm_spline_instance_f32 Sf;
+  uint32_t t, i, k;
+  float32_t xqf;
+  double err, maxErr;
+
+  random_knots(-0.9, 0.9, 0.8, xd, yd, NUM_KNOTS);
+  for (i = 0U; i < NUM_KNOTS; i++)
+  {
+    x[i] = to_q31(xd[i]);
+    y[i] = to_q31(yd[i]);
+  }
+  arm_q31_to_float(x, xf, NUM_KNOTS);
+  arm_q31_to_float(y, yf, NUM_KNOTS);
+
+  /* Random queries, some outside of the knots where the output is the boundary value */
+  for (k = 0U; k < NUM_QUERIES; k++)
+  {
+    xq[k] = to_q31(-0.95 + 1.9 * rand_unit());
+  }
+
+  for (t = 0U; t < 2U; t++)
+  {
+    arm_spline_init_q31(&S, types[t], x, y, NUM_KNOTS, coeffs, temp);
+    arm_spline_init_f32(&Sf, types[t], xf, yf, NUM_KNOTS, coeffsF, temp);
+    arm_spline_q31(&S, xq, out, NUM_QUERIES);
+
+    maxErr = 0.0;
+    for (k = 0U; k < NUM_QUERIES; k++)
+    {
+      xqf = (float32_t)xq[k] / 2147483648.0f;
+      xqf = (xqf < xf[0]) ? xf[0] : ((xqf > xf[NUM_KNOTS - 1U]) ? xf[NUM_KNOTS - 1U] : xqf);
+      err = fabs((double)out[k] / 2147483648.0 - (double)arm_spline_lookup_f32(&Sf, xqf));
+      maxErr = (err > maxErr) ? err : maxErr;
+    }
+    CHECK(maxErr <= MAX_ERR_Q31, "%s: Q31 error %g", typeNames[t], maxErr);
+
+    printf("%s spline: Q31 error against f32 %.3g\n", typeNames[t], maxErr);
+  }
+}
+
+static void test_two_knots(void)
+{
+  static const float32_t x[2] = {-0.5f, 0.75f};
+  static const float32_t y[2] = {0.25f, -0.5f};
+  static const float32_t xq[5] = {-0.5f, -0.2f, 0.1f, 0.5f, 0.75f};
+  float32_t coeffs[3], temp[3], out[5], lin;
+  q31_t xQ[2], yQ[2], coeffsQ[5], xqQ[5], outQ[5];
+  float32_t tempQ[10];
+  arm_spline_instance_f32 S;
+  arm_spline_instance_q31 SQ;
+  uint32_t t, k;
+
+  for (k = 0U; k < 2U; k++)
+  {
+    xQ[k] = to_q31((double)x[k]);
+    yQ[k] = to_q31((double)y[k]);
+  }
+  for (k = 0U; k < 5U; k++)
+  {
+    xqQ[k] = to_q31((double)xq[k]);
+  }
+
+  for (t = 0U; t < 2U; t++)
+  {
+    arm_spline_init_f32(&S, types[t], x, y, 2U, coeffs, temp);
+    CHECK((coeffs[1] == 0.0f) && (coeffs[2] == 0.0f), "%s, 2 knots: c %g, d %g", typeNames[t], (double)coeffs[1],
+          (double)coeffs[2]);
+    arm_spline_f32(&S, xq, out, 5U);
+    arm_spline_init_q31(&SQ, types[t], xQ, yQ, 2U, coeffsQ, tempQ);
+    arm_spline_q31(&SQ, xqQ, outQ, 5U);
+
+    for (k = 0U; k < 5U; k++)
+    {
+      lin = y[0] + (y[1] - y[0]) * (xq[k] - x[0]) / (x[1] - x[0]);
+      CHECK(fabsf(out[k] - lin) <= 1.0e-6f, "%s, 2 knots: S(%g) = %g instead of %g", typeNames[t], (double)xq[k],
+            (double)out[k], (double)lin);
+      CHECK(fabsf(arm_spline_lookup_f32(&S, xq[k]) - lin) <= 1.0e-6f, "%s, 2 knots: lookup at %g",
+            typeNames[t], (double)xq[k]);
+      CHECK(fabs((double)outQ[k] / 2147483648.0 - (double)lin) <= MAX_ERR_Q31, "%s, 2 knots: Q31 S(%g) = %g instead "
+            "of %g", typeNames[t], (double)xq[k], (double)outQ[k] / 2147483648.0, (double)lin);
+    }
+  }
+}
+
+int main(void)
+{
+  test_float();
+  test_q31();
+  test_two_knots();
+
+  if (failures != 0)
+  {
+    printf("%d failures\n", failures);
+    return EXIT_FAILURE;
+  }
+
+  printf("All spline tests passed\n");
+  return EXIT_SUCCESS;
+}
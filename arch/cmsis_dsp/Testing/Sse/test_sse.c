@@ -0,0 +1,359 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        test_sse.c
+ * Description:  Host tests of the x86 acceleration of the float kernels
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.16.1
+ *
+ * Target Processor: Host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+  The same program is built without acceleration, with ARM_MATH_SSE and with
+  ARM_MATH_AVX2, on the same random inputs. The scalar build writes its
+  outputs to the file given as argument, the accelerated builds read them and
+  check:
+  - FIR (state carried over blocks of different sizes), biquad DF2T cascade,
+    matrix multiplication, complex magnitude, CFFT and RFFT of every length
+    (radix-8 butterflies), bit-exact,
+  - the dot product within blockSize * eps * sum(|a[n] * b[n]|) of the scalar
+    one, as documented.
+  Every build also checks the dot product against a double precision sum.
+ */
+
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arm_math.h"
+
+#define MAX_BLOCK       4096U
+#define MAX_TAPS        64U
+#define MAX_STAGES      9U
+#define MAX_DIM         33U
+#define SKIP_TEST       77
+
+static int failures;
+
+#define CHECK(cond, ...)                          \
+  do                                              \
+  {                                               \
+    if (!(cond))                                  \
+    {                                             \
+      printf("FAIL %s:%d: ", __FILE__, __LINE__); \
+      printf(__VA_ARGS__);                        \
+      printf("\n");                               \
+      failures++;                                 \
+    }                                             \
+  } while (0)
+
+#if defined(ARM_MATH_AVX2)
+static const char * const variant = "AVX2";
+#elif defined(ARM_MATH_SSE)
+static const char * const variant = "SSE";
+#else
+static const char * const variant = "scalar";
+#endif
+
+static uint32_t rngState = 0x12345678U;
+
+/* Outputs of the scalar build */
+static FILE *pRef;
+
+static float32_t bufA[2U * MAX_BLOCK], bufB[2U * MAX_BLOCK], bufOut[2U * MAX_BLOCK], bufRef[2U * MAX_BLOCK];
+
+/* Uniform in [-1, 1) */
+static double rand_f64(void)
+{
+  rngState = rngState * 1664525U + 1013904223U;
+  return ((double)(rngState >> 8) / 8388608.0) - 1.0;
+}
+
+static void rand_fill(float32_t *p, uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0U; i < n; i++)
+  {
+    p[i] = (float32_t)rand_f64();
+  }
+}
+
+/* Writes the output (scalar build) or reads the scalar one into bufRef */
+static int exchange(const char *name, const float32_t *pOut, uint32_t n)
+{
+#if defined(ARM_MATH_SSE)
+  (void)pOut;
+  if (fread(bufRef, sizeof(float32_t), n, pRef) != n)
+  {
+    CHECK(0, "%s: the reference file is too short", name);
+    return 0;
+  }
+#else
+  CHECK(fwrite(pOut, sizeof(float32_t), n, pRef) == n, "%s: cannot write the reference", name);
+  memcpy(bufRef, pOut, n * sizeof(float32_t));
+#endif
+  return 1;
+}
+
+static void check_exact(const char *name, const float32_t *pOut, uint32_t n)
+{
+  uint32_t i, mismatches = 0U;
+
+  if (exchange(name, pOut, n) == 0)
+  {
+    return;
+  }
+  for (i = 0U; i < n; i++)
+  {
+    mismatches += (memcmp(&pOut[i], &bufRef[i], sizeof(float32_t)) != 0) ? 1U : 0U;
+  }
+  CHECK(mismatches == 0U, "%s: %u of %u outputs differ from the scalar ones", name, mismatches, n);
+}
+
+static void test_fir(void)
+{
+  static const uint32_t numTaps[] = {1U, 2U, 5U, 29U, 64U};
+  static const uint32_t blocks[] = {1U, 7U, 16U, 33U, 100U, 3U};
+  static float32_t coeffs[MAX_TAPS], state[MAX_TAPS + 100U - 1U];
+  arm_fir_instance_f32 S;
+  char name[64];
+  uint32_t t, b, offset;
+
+  for (t = 0U; t < sizeof(numTaps) / sizeof(numTaps[0]); t++)
+  {
+    rand_fill(coeffs, numTaps[t]);
+    rand_fill(bufA, 160U);
+    arm_fir_init_f32(&S, (uint16_t)numTaps[t], coeffs, state, 100U);
+
+    offset = 0U;
+    for (b = 0U; b < sizeof(blocks) / sizeof(blocks[0]); b++)
+    {
+      arm_fir_f32(&S, &bufA[offset], &bufOut[offset], blocks[b]);
+      offset += blocks[b];
+    }
+    snprintf(name, sizeof(name), "FIR %u taps", numTaps[t]);
+    check_exact(name, bufOut, offset);
+  }
+}
+
+static void test_biquad(void)
+{
+  static const uint32_t blocks[] = {5U, 64U, 31U};
+  static float32_t coeffs[5U * MAX_STAGES], state[2U * MAX_STAGES];
+  arm_biquad_cascade_df2T_instance_f32 S;
+  char name[64];
+  uint32_t numStages, s, b, offset;
+  double r, theta;
+
+  for (numStages = 1U; numStages <= MAX_STAGES; numStages++)
+  {
+    /* Stable sections: poles of radius up to 0.95 */
+    for (s = 0U; s < numStages; s++)
+    {
+      r = 0.5 + 0.45 * fabs(rand_f64());
+      theta = 3.14159 * fabs(rand_f64());
+      coeffs[5U * s] = (float32_t)(0.5 * rand_f64());
+      coeffs[5U * s + 1U] = (float32_t)(0.5 * rand_f64());
+      coeffs[5U * s + 2U] = (float32_t)(0.5 * rand_f64());
+      coeffs[5U * s + 3U] = (float32_t)(2.0 * r * cos(theta));
+      coeffs[5U * s + 4U] = (float32_t)(-r * r);
+    }
+    rand_fill(bufA, 100U);
+    arm_biquad_cascade_df2T_init_f32(&S, (uint8_t)numStages, coeffs, state);
+
+    offset = 0U;
+    for (b = 0U; b < sizeof(blocks) / sizeof(blocks[0]); b++)
+    {
+      arm_biquad_cascade_df2T_f32(&S, &bufA[offset], &bufOut[offset], blocks[b]);
+      offset += blocks[b];
+    }
+    snprintf(name, sizeof(name), "biquad DF2T %u stages", numStages);
+    check_exact(name, bufOut, offset);
+    check_exact(name, state, 2U * numStages);
+  }
+}
+
+static void test_mat_mult(void)
+{
+  static const uint16_t dims[][3] = {{1U, 1U, 1U}, {3U, 5U, 7U}, {8U, 8U, 8U}, {16U, 9U, 17U}, {33U, 20U, 31U},
+                                     {2U, 33U, 9U}};
+  arm_matrix_instance_f32 A, B, C;
+  char name[64];
+  uint32_t d;
+  arm_status status;
+
+  for (d = 0U; d < sizeof(dims) / sizeof(dims[0]); d++)
+  {
+    rand_fill(bufA, (uint32_t)dims[d][0] * dims[d][1]);
+    rand_fill(bufB, (uint32_t)dims[d][1] * dims[d][2]);
+    arm_mat_init_f32(&A, dims[d][0], dims[d][1], bufA);
+    arm_mat_init_f32(&B, dims[d][1], dims[d][2], bufB);
+    arm_mat_init_f32(&C, dims[d][0], dims[d][2], bufOut);
+
+    status = arm_mat_mult_f32(&A, &B, &C);
+    snprintf(name, sizeof(name), "mat mult %ux%u by %ux%u", dims[d][0], dims[d][1], dims[d][1], dims[d][2]);
+    CHECK(status == ARM_MATH_SUCCESS, "%s: status %d", name, (int)status);
+    check_exact(name, bufOut, (uint32_t)dims[d][0] * dims[d][2]);
+  }
+}
+
+static void test_cmplx_mag(void)
+{
+  static const uint32_t sizes[] = {1U, 3U, 4U, 8U, 9U, 15U, 16U, 1001U};
+  char name[64];
+  uint32_t i;
+
+  for (i = 0U; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+  {
+    rand_fill(bufA, 2U * sizes[i]);
+    arm_cmplx_mag_f32(bufA, bufOut, sizes[i]);
+    snprintf(name, sizeof(name), "cmplx mag %u", sizes[i]);
+    check_exact(name, bufOut, sizes[i]);
+  }
+}
+
+static void test_fft(void)
+{
+  arm_cfft_instance_f32 S;
+  arm_rfft_fast_instance_f32 R;
+  char name[64];
+  uint32_t len, ifft;
+  arm_status status;
+
+  for (len = 16U; len <= MAX_BLOCK; len *= 2U)
+  {
+    status = arm_cfft_init_f32(&S, (uint16_t)len);
+    CHECK(status == ARM_MATH_SUCCESS, "CFFT %u: init status %d", len, (int)status);
+    for (ifft = 0U; ifft < 2U; ifft++)
+    {
+      rand_fill(bufOut, 2U * len);
+      arm_cfft_f32(&S, bufOut, (uint8_t)ifft, 1U);
+      snprintf(name, sizeof(name), "%s %u", (ifft != 0U) ? "CIFFT" : "CFFT", len);
+      check_exact(name, bufOut, 2U * len);
+    }
+  }
+
+  for (len = 32U; len <= MAX_BLOCK; len *= 2U)
+  {
+    status = arm_rfft_fast_init_f32(&R, (uint16_t)len);
+    CHECK(status == ARM_MATH_SUCCESS, "RFFT %u: init status %d", len, (int)status);
+    for (ifft = 0U; ifft < 2U; ifft++)
+    {
+      rand_fill(bufA, len);
+      arm_rfft_fast_f32(&R, bufA, bufOut, (uint8_t)ifft);
+      snprintf(name, sizeof(name), "%s %u", (ifft != 0U) ? "RIFFT" : "RFFT", len);
+      check_exact(name, bufOut, len);
+    }
+  }
+}
+
+static void test_dot_prod(void)
+{
+  static const uint32_t sizes[] = {1U, 3U, 8U, 17U, 64U, 1000U, 4093U};
+  float32_t result;
+  double sum, sumAbs, bound, err, maxRatio = 0.0;
+  char name[64];
+  uint32_t i, n;
+
+  for (i = 0U; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+  {
+    n = sizes[i];
+    rand_fill(bufA, n);
+    rand_fill(bufB, n);
+    arm_dot_prod_f32(bufA, bufB, n, &result);
+
+    sum = 0.0;
+    sumAbs = 0.0;
+    for (n = 0U; n < sizes[i]; n++)
+    {
+      sum += (double)bufA[n] * (double)bufB[n];
+      sumAbs += fabs((double)bufA[n] * (double)bufB[n]);
+    }
+    n = sizes[i];
+    bound = (double)n * FLT_EPSILON * sumAbs;
+    snprintf(name, sizeof(name), "dot product %u", n);
+
+    err = fabs((double)result - sum);
+    CHECK(err <= bound, "%s: error %g against double, bound %g", name, err, bound);
+
+    if (exchange(name, &result, 1U) != 0)
+    {
+      /* Both sums are within the bound of the exact one */
+      err = fabs((double)result - (double)bufRef[0]);
+      CHECK(err <= 2.0 * bound, "%s: %g from the scalar result, bound %g", name, err, 2.0 * bound);
+      maxRatio = (err / bound > maxRatio) ? err / bound : maxRatio;
+    }
+  }
+
+  printf("%s dot product: largest difference to the scalar one %.3g of the bound\n", variant, maxRatio);
+}
+
+int main(int argc, char **argv)
+{
+  if (argc != 2)
+  {
+    fprintf(stderr, "usage: %s reference.bin\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+#if defined(ARM_MATH_AVX2)
+  if (!__builtin_cpu_supports("avx2"))
+  {
+    printf("No AVX2 on this host\n");
+    return SKIP_TEST;
+  }
+#endif
+
+#if defined(ARM_MATH_SSE)
+  pRef = fopen(argv[1], "rb");
+#else
+  pRef = fopen(argv[1], "wb");
+#endif
+  if (pRef == NULL)
+  {
+    fprintf(stderr, "%s: cannot open %s\n", argv[0], argv[1]);
+    return EXIT_FAILURE;
+  }
+
+  test_fir();
+  test_biquad();
+  test_mat_mult();
+  test_cmplx_mag();
+  test_fft();
+  test_dot_prod();
+
+#if defined(ARM_MATH_SSE)
+  CHECK(fgetc(pRef) == EOF, "the reference file is longer than the outputs");
+#endif
+  fclose(pRef);
+
+  if (failures != 0)
+  {
+    printf("%s: %d failures\n", variant, failures);
+    return EXIT_FAILURE;
+  }
+
+  printf("All %s tests passed\n", variant);
+  return EXIT_SUCCESS;
+}
@@ -249,6 +249,11 @@ The user can resort to the suspend/resume feature for two purposes and under the
       - When the high priority message processing is over, call the HAL_AES_RestoreContext() API with the already filled
         structure to restore the low priority suspended context
       - Call HAL_AES_Resume() API to restore the suspended process from the suspended endpoint
+  - Interleaving of messages between two processing calls, without suspension:
+      - When a processing call of a message is over, call HAL_AES_SaveIdleContext() API to save its context
+      - Process another message, or restore the context of another one with HAL_AES_RestoreIdleContext() API
+      - Call HAL_AES_RestoreIdleContext() API to continue the message with its next processing call or its tag
+        generation, the state staying idle
 
 ### Callback registration
 
@@ -447,6 +452,11 @@ static void AES_GCM_GMAC_CCM_DMAInCplt(hal_dma_handle_t *hdma);
 static void AES_GCM_GMAC_CCM_DMAOutCplt(hal_dma_handle_t *hdma);
 #endif /* USE_HAL_AES_DMA */
 #endif /* USE_HAL_AES_GCM_GMAC_ALGO or USE_HAL_AES_CCM_ALGO */
+
+#if defined(USE_HAL_AES_SUSPEND_RESUME) && (USE_HAL_AES_SUSPEND_RESUME == 1)
+static void AES_SaveContext(hal_aes_handle_t *haes, hal_aes_save_context_t *p_context);
+static hal_status_t AES_RestoreContext(hal_aes_handle_t *haes, const hal_aes_save_context_t *p_context);
+#endif /* USE_HAL_AES_SUSPEND_RESUME */
 /**
   * @}
   */
@@ -1143,6 +1153,8 @@ hal_aes_data_swapping_t HAL_AES_GetDataSwapping(const hal_aes_handle_t *haes)
   - HAL_AES_SaveContext()    :Allowing to save the context of the suspended process to start another high priority one
   - HAL_AES_RestoreContext() :Allowing to restore the saved context of the low prior process
   - HAL_AES_Resume()         :Allowing to resume the low prior process
+  - HAL_AES_SaveIdleContext()    :Allowing to save the context of a message between two of its processing calls
+  - HAL_AES_RestoreIdleContext() :Allowing to restore the saved context of a message to continue its processing
   */
 /**
   * @brief  Encrypt user data in polling mode.
@@ -2119,56 +2131,7 @@ hal_status_t HAL_AES_SaveContext(hal_aes_handle_t *haes, hal_aes_save_context_t
   }
 #endif /* USE_HAL_SECURE_CHECK_PARAM */
 
-#if (defined(USE_HAL_AES_GCM_GMAC_ALGO) && (USE_HAL_AES_GCM_GMAC_ALGO == 1)) \
-    || (defined(USE_HAL_AES_CCM_ALGO) && (USE_HAL_AES_CCM_ALGO == 1))
-  if ((haes->algorithm == AES_ALGORITHM_GCM_GMAC) || (haes->algorithm == AES_ALGORITHM_CCM))
-  {
-    p_context->SUSPxR[0] = AES_GET_INSTANCE(haes)->SUSP7R;
-    p_context->SUSPxR[1] = AES_GET_INSTANCE(haes)->SUSP6R;
-    p_context->SUSPxR[2] = AES_GET_INSTANCE(haes)->SUSP5R;
-    p_context->SUSPxR[3] = AES_GET_INSTANCE(haes)->SUSP4R;
-    p_context->SUSPxR[4] = AES_GET_INSTANCE(haes)->SUSP3R;
-    p_context->SUSPxR[5] = AES_GET_INSTANCE(haes)->SUSP2R;
-    p_context->SUSPxR[6] = AES_GET_INSTANCE(haes)->SUSP1R;
-    p_context->SUSPxR[7] = AES_GET_INSTANCE(haes)->SUSP0R;
-  }
-#endif /* USE_HAL_AES_GCM_GMAC_ALGO or USE_HAL_AES_CCM_ALGO */
-
-  if (haes->algorithm != AES_ALGORITHM_ECB)
-  {
-    /* Save Initialization Vector registers */
-    p_context->iv_buff[0] = AES_GET_INSTANCE(haes)->IVR3;
-    p_context->iv_buff[1] = AES_GET_INSTANCE(haes)->IVR2;
-    p_context->iv_buff[2] = AES_GET_INSTANCE(haes)->IVR1;
-    p_context->iv_buff[3] = AES_GET_INSTANCE(haes)->IVR0;
-  }
-
-  AES_DISABLE(haes);
-
-  /* Save the configuration register */
-  p_context->CR = AES_GET_INSTANCE(haes)->CR;
-  p_context->instance           = haes->instance;
-  p_context->previous_state     = haes->global_state;
-  p_context->algorithm          = haes->algorithm;
-  p_context->data_size_byte     = haes->data_size_byte;
-  p_context->data_size_sum_byte = haes->data_size_sum_byte;
-  p_context->p_in_buff          = haes->p_in_buff;
-  p_context->p_out_buff         = haes->p_out_buff;
-  p_context->block_count        = haes->block_count;
-#if (defined(USE_HAL_AES_GCM_GMAC_ALGO) && (USE_HAL_AES_GCM_GMAC_ALGO == 1)) \
-     || (defined(USE_HAL_AES_CCM_ALGO) && (USE_HAL_AES_CCM_ALGO == 1))
-  p_context->p_header           = haes->p_header;
-  p_context->header_size_byte   = haes->header_size_byte;
-#endif /* USE_HAL_AES_GCM_GMAC_ALGO or USE_HAL_AES_CCM_ALGO */
-  p_context->suspend_request    = haes->suspend_request;
-  p_context->p_key              = haes->p_key;
-
-#if defined(USE_HAL_AES_REGISTER_CALLBACKS) && (USE_HAL_AES_REGISTER_CALLBACKS == 1)
-  p_context->p_in_cplt_cb       = haes->p_in_cplt_cb;
-  p_context->p_out_cplt_cb      = haes->p_out_cplt_cb;
-  p_context->p_error_cb         = haes->p_error_cb;
-  p_context->p_suspend_cb       = haes->p_suspend_cb;
-#endif /* (USE_HAL_AES_REGISTER_CALLBACKS) */
+  AES_SaveContext(haes, p_context);
 
   haes->global_state = HAL_AES_STATE_IDLE;
 
@@ -2186,8 +2149,6 @@ hal_status_t HAL_AES_SaveContext(hal_aes_handle_t *haes, hal_aes_save_context_t
   */
 hal_status_t HAL_AES_RestoreContext(hal_aes_handle_t *haes, const hal_aes_save_context_t *p_context)
 {
-  uint32_t key_size;
-
   ASSERT_DBG_PARAM(haes != NULL);
   ASSERT_DBG_PARAM(p_context != NULL);
   ASSERT_DBG_PARAM(p_context->previous_state == HAL_AES_STATE_SUSPENDED);
@@ -2200,75 +2161,91 @@ hal_status_t HAL_AES_RestoreContext(hal_aes_handle_t *haes, const hal_aes_save_c
     return HAL_INVALID_PARAM;
   }
 #endif /* USE_HAL_SECURE_CHECK_PARAM */
-  AES_DISABLE(haes);
-
-  AES_GET_INSTANCE(haes)->CR = p_context->CR;
-
-  haes->instance           = p_context->instance;
-  haes->algorithm          = p_context->algorithm;
-  haes->data_size_byte     = p_context->data_size_byte;
-  haes->data_size_sum_byte = p_context->data_size_sum_byte;
-  haes->p_in_buff          = p_context->p_in_buff;
-  haes->p_out_buff         = p_context->p_out_buff;
-  haes->block_count        = p_context->block_count;
+  if (AES_RestoreContext(haes, p_context) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
 
-#if (defined(USE_HAL_AES_GCM_GMAC_ALGO) && (USE_HAL_AES_GCM_GMAC_ALGO == 1)) \
-     || (defined(USE_HAL_AES_CCM_ALGO) && (USE_HAL_AES_CCM_ALGO == 1))
-  haes->p_header           = p_context->p_header;
-  haes->header_size_byte   = p_context->header_size_byte;
-#endif /* USE_HAL_AES_GCM_GMAC_ALGO or USE_HAL_AES_CCM_ALGO */
-  haes->suspend_request    = p_context->suspend_request;
-  haes->p_key              = p_context->p_key;
+  haes->global_state = HAL_AES_STATE_SUSPENDED;
 
-#if defined(USE_HAL_AES_REGISTER_CALLBACKS) && (USE_HAL_AES_REGISTER_CALLBACKS == 1)
-  haes->p_in_cplt_cb       = p_context->p_in_cplt_cb;
-  haes->p_out_cplt_cb      = p_context->p_out_cplt_cb;
-  haes->p_error_cb         = p_context->p_error_cb;
-  haes->p_suspend_cb       = p_context->p_suspend_cb;
-#endif /* (USE_HAL_AES_REGISTER_CALLBACKS) */
+  return HAL_OK;
+}
 
-  key_size = READ_BIT(AES_GET_INSTANCE(haes)->CR, AES_CR_KEYSIZE);
+/**
+  * @brief  Save the context of the message processed between two of its processing calls.
+  * @param  haes      Pointer to a @ref hal_aes_handle_t structure
+  * @param  p_context Pointer to a @ref hal_aes_save_context_t structure where to store the parameters of the message
+  * @note   Unlike HAL_AES_SaveContext(), no processing is suspended: the message is continued with its next processing
+  *         call after HAL_AES_RestoreIdleContext().
+  * @retval HAL_INVALID_PARAM The provided save context pointer structure or the handle pointer is null
+  * @retval HAL_OK            AES message parameters are saved
+  */
+hal_status_t HAL_AES_SaveIdleContext(hal_aes_handle_t *haes, hal_aes_save_context_t *p_context)
+{
+  ASSERT_DBG_PARAM(haes != NULL);
+  ASSERT_DBG_PARAM(p_context != NULL);
+  ASSERT_DBG_STATE(haes->global_state, HAL_AES_STATE_IDLE);
 
-  if (haes->algorithm != AES_ALGORITHM_ECB)
+#if (defined(USE_HAL_CHECK_PARAM) && (USE_HAL_CHECK_PARAM == 1)) \
+     || (defined(USE_HAL_SECURE_CHECK_PARAM) && (USE_HAL_SECURE_CHECK_PARAM == 1))
+  if (p_context == NULL)
   {
-    AES_SetIV(haes, p_context->iv_buff);
+    return HAL_INVALID_PARAM;
   }
+#endif /* USE_HAL_CHECK_PARAM or USE_HAL_SECURE_CHECK_PARAM */
 
-  if (READ_BIT(AES_GET_INSTANCE(haes)->CR, AES_CR_KEYSEL) == 0U)
+#if defined(USE_HAL_SECURE_CHECK_PARAM) && (USE_HAL_SECURE_CHECK_PARAM == 1)
+  if (haes == NULL)
   {
-    AES_SetNormalKey(haes, (hal_aes_key_size_t)key_size, haes->p_key);
+    return HAL_INVALID_PARAM;
   }
+#endif /* USE_HAL_SECURE_CHECK_PARAM */
 
-#if defined(USE_HAL_AES_ECB_CBC_ALGO) && (USE_HAL_AES_ECB_CBC_ALGO == 1)
-  if ((READ_BIT(AES_GET_INSTANCE(haes)->CR, AES_CR_MODE) == AES_OPERATING_MODE_DECRYPT)
-      && ((haes->algorithm == AES_ALGORITHM_ECB) || (haes->algorithm == AES_ALGORITHM_CBC)))
-  {
-    if (AES_KeyDerivation(haes) != HAL_OK)
-    {
-      return HAL_ERROR;
-    }
+  AES_SaveContext(haes, p_context);
 
-    MODIFY_REG(AES_GET_INSTANCE(haes)->CR, AES_CR_MODE | AES_CR_KMOD, AES_OPERATING_MODE_DECRYPT);
+  return HAL_OK;
+}
+
+/**
+  * @brief  Restore the context of a message saved by HAL_AES_SaveIdleContext().
+  * @param  haes      Pointer to a @ref hal_aes_handle_t structure
+  * @param  p_context Pointer to a @ref hal_aes_save_context_t structure where the parameters of the message are stored
+  * @note   The state stays idle: the message is continued with its next processing call, or its tag generated.
+  * @retval HAL_INVALID_PARAM When the handle pointer is NULL.
+  * @retval HAL_ERROR         AES key derivation exceeds the dedicated timeout
+  * @retval HAL_OK            AES message parameters are restored
+  */
+hal_status_t HAL_AES_RestoreIdleContext(hal_aes_handle_t *haes, const hal_aes_save_context_t *p_context)
+{
+  ASSERT_DBG_PARAM(haes != NULL);
+  ASSERT_DBG_PARAM(p_context != NULL);
+  ASSERT_DBG_PARAM(p_context->previous_state == HAL_AES_STATE_IDLE);
+
+  ASSERT_DBG_STATE(haes->global_state, HAL_AES_STATE_IDLE);
+
+#if defined(USE_HAL_SECURE_CHECK_PARAM) && (USE_HAL_SECURE_CHECK_PARAM == 1)
+  if (haes == NULL)
+  {
+    return HAL_INVALID_PARAM;
+  }
+#endif /* USE_HAL_SECURE_CHECK_PARAM */
+  if (AES_RestoreContext(haes, p_context) != HAL_OK)
+  {
+    return HAL_ERROR;
   }
-#endif /* USE_HAL_AES_ECB_CBC_ALGO */
 
 #if (defined(USE_HAL_AES_GCM_GMAC_ALGO) && (USE_HAL_AES_GCM_GMAC_ALGO == 1)) \
      || (defined(USE_HAL_AES_CCM_ALGO) && (USE_HAL_AES_CCM_ALGO == 1))
-  if ((haes->algorithm == AES_ALGORITHM_GCM_GMAC) || (haes->algorithm == AES_ALGORITHM_CCM))
+  /* The peripheral is left enabled between the processing calls of the header and payload phases, as the tag
+     generation expects it */
+  if (((haes->algorithm == AES_ALGORITHM_GCM_GMAC) || (haes->algorithm == AES_ALGORITHM_CCM))
+      && ((READ_BIT(AES_GET_INSTANCE(haes)->CR, AES_CR_GCMPH) == AES_PHASE_HEADER)
+          || (READ_BIT(AES_GET_INSTANCE(haes)->CR, AES_CR_GCMPH) == AES_PHASE_PAYLOAD)))
   {
-    AES_GET_INSTANCE(haes)->SUSP7R = p_context->SUSPxR[0];
-    AES_GET_INSTANCE(haes)->SUSP6R = p_context->SUSPxR[1];
-    AES_GET_INSTANCE(haes)->SUSP5R = p_context->SUSPxR[2];
-    AES_GET_INSTANCE(haes)->SUSP4R = p_context->SUSPxR[3];
-    AES_GET_INSTANCE(haes)->SUSP3R = p_context->SUSPxR[4];
-    AES_GET_INSTANCE(haes)->SUSP2R = p_context->SUSPxR[5];
-    AES_GET_INSTANCE(haes)->SUSP1R = p_context->SUSPxR[6];
-    AES_GET_INSTANCE(haes)->SUSP0R = p_context->SUSPxR[7];
+    AES_ENABLE(haes);
   }
 #endif /* USE_HAL_AES_GCM_GMAC_ALGO or USE_HAL_AES_CCM_ALGO */
 
-  haes->global_state = HAL_AES_STATE_SUSPENDED;
-
   return HAL_OK;
 }
 #endif /* USE_HAL_AES_SUSPEND_RESUME */
@@ -3455,6 +3432,8 @@ This subsection provides a set of functions allowing to:
   - AES_GCM_GMAC_CCM_DMAInCplt()       :Allowing to manage the DMA input transfer complete callback for GCM_GMAC/CCM
   - AES_GCM_GMAC_CCM_DMAOutCplt()      :Allowing to manage the DMA output transfer complete callback for GCM_GMAC/CCM
   - AES_PaddingData_DMA()              :Allowing to perform the data padding for GCM_GMAC/CCM algorithms in DMA mode
+  - AES_SaveContext()                  :Allowing to save the registers and parameters of the AES processing
+  - AES_RestoreContext()               :Allowing to restore the saved registers and parameters of the AES processing
   */
 /**
   * @brief  Load the AES application key into key registers.
@@ -5216,6 +5195,148 @@ static void AES_GCM_GMAC_CCM_DMAOutCplt(hal_dma_handle_t *hdma)
 }
 #endif /* USE_HAL_AES_DMA */
 #endif /* USE_HAL_AES_GCM_GMAC_ALGO or USE_HAL_AES_CCM_ALGO */
+
+#if defined(USE_HAL_AES_SUSPEND_RESUME) && (USE_HAL_AES_SUSPEND_RESUME == 1)
+/**
+  * @brief  Save the registers and the handle parameters of the AES processing, and disable the peripheral.
+  * @param  haes      Pointer to a @ref hal_aes_handle_t structure
+  * @param  p_context Pointer to a @ref hal_aes_save_context_t structure where to store the parameters
+  */
+static void AES_SaveContext(hal_aes_handle_t *haes, hal_aes_save_context_t *p_context)
+{
+#if (defined(USE_HAL_AES_GCM_GMAC_ALGO) && (USE_HAL_AES_GCM_GMAC_ALGO == 1)) \
+    || (defined(USE_HAL_AES_CCM_ALGO) && (USE_HAL_AES_CCM_ALGO == 1))
+  if ((haes->algorithm == AES_ALGORITHM_GCM_GMAC) || (haes->algorithm == AES_ALGORITHM_CCM))
+  {
+    p_context->SUSPxR[0] = AES_GET_INSTANCE(haes)->SUSP7R;
+    p_context->SUSPxR[1] = AES_GET_INSTANCE(haes)->SUSP6R;
+    p_context->SUSPxR[2] = AES_GET_INSTANCE(haes)->SUSP5R;
+    p_context->SUSPxR[3] = AES_GET_INSTANCE(haes)->SUSP4R;
+    p_context->SUSPxR[4] = AES_GET_INSTANCE(haes)->SUSP3R;
+    p_context->SUSPxR[5] = AES_GET_INSTANCE(haes)->SUSP2R;
+    p_context->SUSPxR[6] = AES_GET_INSTANCE(haes)->SUSP1R;
+    p_context->SUSPxR[7] = AES_GET_INSTANCE(haes)->SUSP0R;
+  }
+#endif /* USE_HAL_AES_GCM_GMAC_ALGO or USE_HAL_AES_CCM_ALGO */
+
+  if (haes->algorithm != AES_ALGORITHM_ECB)
+  {
+    /* Save Initialization Vector registers */
+    p_context->iv_buff[0] = AES_GET_INSTANCE(haes)->IVR3;
+    p_context->iv_buff[1] = AES_GET_INSTANCE(haes)->IVR2;
+    p_context->iv_buff[2] = AES_GET_INSTANCE(haes)->IVR1;
+    p_context->iv_buff[3] = AES_GET_INSTANCE(haes)->IVR0;
+  }
+
+  AES_DISABLE(haes);
+
+  /* Save the configuration register */
+  p_context->CR = AES_GET_INSTANCE(haes)->CR;
+  p_context->instance           = haes->instance;
+  p_context->previous_state     = haes->global_state;
+  p_context->algorithm          = haes->algorithm;
+  p_context->data_size_byte     = haes->data_size_byte;
+  p_context->data_size_sum_byte = haes->data_size_sum_byte;
+  p_context->p_in_buff          = haes->p_in_buff;
+  p_context->p_out_buff         = haes->p_out_buff;
+  p_context->block_count        = haes->block_count;
+#if (defined(USE_HAL_AES_GCM_GMAC_ALGO) && (USE_HAL_AES_GCM_GMAC_ALGO == 1)) \
+     || (defined(USE_HAL_AES_CCM_ALGO) && (USE_HAL_AES_CCM_ALGO == 1))
+  p_context->p_header           = haes->p_header;
+  p_context->header_size_byte   = haes->header_size_byte;
+#endif /* USE_HAL_AES_GCM_GMAC_ALGO or USE_HAL_AES_CCM_ALGO */
+  p_context->suspend_request    = haes->suspend_request;
+  p_context->p_key              = haes->p_key;
+
+#if defined(USE_HAL_AES_REGISTER_CALLBACKS) && (USE_HAL_AES_REGISTER_CALLBACKS == 1)
+  p_context->p_in_cplt_cb       = haes->p_in_cplt_cb;
+  p_context->p_out_cplt_cb      = haes->p_out_cplt_cb;
+  p_context->p_error_cb         = haes->p_error_cb;
+  p_context->p_suspend_cb       = haes->p_suspend_cb;
+#endif /* (USE_HAL_AES_REGISTER_CALLBACKS) */
+}
+
+/**
+  * @brief  Restore the registers and the handle parameters of a saved AES processing.
+  * @param  haes      Pointer to a @ref hal_aes_handle_t structure
+  * @param  p_context Pointer to a @ref hal_aes_save_context_t structure where the parameters are stored
+  * @retval HAL_ERROR AES key derivation exceeds the dedicated timeout
+  * @retval HAL_OK    AES processing parameters are restored
+  */
+static hal_status_t AES_RestoreContext(hal_aes_handle_t *haes, const hal_aes_save_context_t *p_context)
+{
+  uint32_t key_size;
+
+  AES_DISABLE(haes);
+
+  AES_GET_INSTANCE(haes)->CR = p_context->CR;
+
+  haes->instance           = p_context->instance;
+  haes->algorithm          = p_context->algorithm;
+  haes->data_size_byte     = p_context->data_size_byte;
+  haes->data_size_sum_byte = p_context->data_size_sum_byte;
+  haes->p_in_buff          = p_context->p_in_buff;
+  haes->p_out_buff         = p_context->p_out_buff;
+  haes->block_count        = p_context->block_count;
+
+#if (defined(USE_HAL_AES_GCM_GMAC_ALGO) && (USE_HAL_AES_GCM_GMAC_ALGO == 1)) \
+     || (defined(USE_HAL_AES_CCM_ALGO) && (USE_HAL_AES_CCM_ALGO == 1))
+  haes->p_header           = p_context->p_header;
+  haes->header_size_byte   = p_context->header_size_byte;
+#endif /* USE_HAL_AES_GCM_GMAC_ALGO or USE_HAL_AES_CCM_ALGO */
+  haes->suspend_request    = p_context->suspend_request;
+  haes->p_key              = p_context->p_key;
+
+#if defined(USE_HAL_AES_REGISTER_CALLBACKS) && (USE_HAL_AES_REGISTER_CALLBACKS == 1)
+  haes->p_in_cplt_cb       = p_context->p_in_cplt_cb;
+  haes->p_out_cplt_cb      = p_context->p_out_cplt_cb;
+  haes->p_error_cb         = p_context->p_error_cb;
+  haes->p_suspend_cb       = p_context->p_suspend_cb;
+#endif /* (USE_HAL_AES_REGISTER_CALLBACKS) */
+
+  key_size = READ_BIT(AES_GET_INSTANCE(haes)->CR, AES_CR_KEYSIZE);
+
+  if (haes->algorithm != AES_ALGORITHM_ECB)
+  {
+    AES_SetIV(haes, p_context->iv_buff);
+  }
+
+  if (READ_BIT(AES_GET_INSTANCE(haes)->CR, AES_CR_KEYSEL) == 0U)
+  {
+    AES_SetNormalKey(haes, (hal_aes_key_size_t)key_size, haes->p_key);
+  }
+
+#if defined(USE_HAL_AES_ECB_CBC_ALGO) && (USE_HAL_AES_ECB_CBC_ALGO == 1)
+  if ((READ_BIT(AES_GET_INSTANCE(haes)->CR, AES_CR_MODE) == AES_OPERATING_MODE_DECRYPT)
+      && ((haes->algorithm == AES_ALGORITHM_ECB) || (haes->algorithm == AES_ALGORITHM_CBC)))
+  {
+    if (AES_KeyDerivation(haes) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+
+    MODIFY_REG(AES_GET_INSTANCE(haes)->CR, AES_CR_MODE | AES_CR_KMOD, AES_OPERATING_MODE_DECRYPT);
+  }
+#endif /* USE_HAL_AES_ECB_CBC_ALGO */
+
+#if (defined(USE_HAL_AES_GCM_GMAC_ALGO) && (USE_HAL_AES_GCM_GMAC_ALGO == 1)) \
+     || (defined(USE_HAL_AES_CCM_ALGO) && (USE_HAL_AES_CCM_ALGO == 1))
+  if ((haes->algorithm == AES_ALGORITHM_GCM_GMAC) || (haes->algorithm == AES_ALGORITHM_CCM))
+  {
+    AES_GET_INSTANCE(haes)->SUSP7R = p_context->SUSPxR[0];
+    AES_GET_INSTANCE(haes)->SUSP6R = p_context->SUSPxR[1];
+    AES_GET_INSTANCE(haes)->SUSP5R = p_context->SUSPxR[2];
+    AES_GET_INSTANCE(haes)->SUSP4R = p_context->SUSPxR[3];
+    AES_GET_INSTANCE(haes)->SUSP3R = p_context->SUSPxR[4];
+    AES_GET_INSTANCE(haes)->SUSP2R = p_context->SUSPxR[5];
+    AES_GET_INSTANCE(haes)->SUSP1R = p_context->SUSPxR[6];
+    AES_GET_INSTANCE(haes)->SUSP0R = p_context->SUSPxR[7];
+  }
+#endif /* USE_HAL_AES_GCM_GMAC_ALGO or USE_HAL_AES_CCM_ALGO */
+
+  return HAL_OK;
+}
+#endif /* USE_HAL_AES_SUSPEND_RESUME */
 /**
   * @}
   */
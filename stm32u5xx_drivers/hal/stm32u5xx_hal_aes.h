@@ -393,6 +393,8 @@ hal_status_t HAL_AES_RequestSuspend(hal_aes_handle_t *haes);
 hal_status_t HAL_AES_SaveContext(hal_aes_handle_t *haes, hal_aes_save_context_t *p_context);
 hal_status_t HAL_AES_RestoreContext(hal_aes_handle_t *haes, const hal_aes_save_context_t *p_context);
 hal_status_t HAL_AES_Resume(hal_aes_handle_t *haes);
+hal_status_t HAL_AES_SaveIdleContext(hal_aes_handle_t *haes, hal_aes_save_context_t *p_context);
+hal_status_t HAL_AES_RestoreIdleContext(hal_aes_handle_t *haes, const hal_aes_save_context_t *p_context);
 #endif /* defined (USE_HAL_AES_SUSPEND_RESUME) */
 /**
   * @}
@@ -63,11 +63,20 @@
     - The input reversibility mode is set to none
     - The output reversibility mode is set to none
 
-- For CRC IO operations, one operation mode is available within this driver: Polling mode IO operation
-  - Computing the CRC value of the input data buffer starting with the configured CRC initialization value
-    Using HAL_CRC_Calculate() function
-  - Computing the CRC value of the input data buffer starting with the previously computed CRC
-    Using HAL_CRC_Accumulate() function
+- For CRC IO operations, two operation modes are available within this driver:
+  - Polling mode IO operation
+    - Computing the CRC value of the input data buffer starting with the configured CRC initialization value
+      Using HAL_CRC_Calculate() function
+    - Computing the CRC value of the input data buffer starting with the previously computed CRC
+      Using HAL_CRC_Accumulate() function
+  - DMA mode IO operation, when USE_HAL_CRC_DMA is set to 1
+    - Link a DMA channel configured for memory to peripheral direct transfers with HAL_CRC_SetDMA()
+    - Start the calculation with HAL_CRC_Calculate_DMA() or HAL_CRC_Accumulate_DMA()
+    - The result is written and HAL_CRC_CalculateCpltCallback() is called once all the data are fed, or
+      HAL_CRC_ErrorCallback() is called on a DMA error
+    - The data are fed in blocks of at most 64 Kbytes, so any buffer size is supported
+    - While a DMA calculation is ongoing, the other calculation functions return HAL_BUSY: the software CRC utility,
+      configured with the same @ref hal_crc_config_t, can be used meanwhile
 
 - Deinitialize the CRC peripheral by calling the HAL_CRC_DeInit() API that performs these operations:
  - The reset of the CRC configuration to the default one by setting the following fields to their default values:
@@ -81,15 +90,17 @@
 
 ## Configuration inside the CRC driver
 
-Config defines               | Description               | Default value              | Note
----------------------------- | ------------------------- | -------------------------- | -----------------------------
-PRODUCT                      | from IDE                  | NA                         | Ex:STM32U5XX
-USE_ASSERT_DBG_PARAM         | from IDE                  | NA                         | Enable the parameters asserts
-USE_ASSERT_DBG_STATE         | from IDE                  | NA                         | Enable the state asserts
-USE_HAL_CHECK_PARAM          | from stm32u5xx_hal_conf.h | 0                          | Parameters runtime check
-USE_HAL_CRC_MODULE           | from stm32u5xx_hal_conf.h | 1                          | Enable the HAL CRC module
-USE_HAL_CRC_CLK_ENABLE_MODEL | from stm32u5xx_hal_conf.h | HAL_CLK_ENABLE_PERIPH_ONLY | Enable the HAL_CRC_CLK
-USE_HAL_CRC_USER_DATA        | from stm32u5xx_hal_conf.h | 0                          | Allows to use user data
+Config defines                 | Description               | Default value              | Note
+------------------------------ | ------------------------- | -------------------------- | -----------------------------
+PRODUCT                        | from IDE                  | NA                         | Ex:STM32U5XX
+USE_ASSERT_DBG_PARAM           | from IDE                  | NA                         | Enable the parameters asserts
+USE_ASSERT_DBG_STATE           | from IDE                  | NA                         | Enable the state asserts
+USE_HAL_CHECK_PARAM            | from stm32u5xx_hal_conf.h | 0                          | Parameters runtime check
+USE_HAL_CRC_MODULE             | from stm32u5xx_hal_conf.h | 1                          | Enable the HAL CRC module
+USE_HAL_CRC_CLK_ENABLE_MODEL   | from stm32u5xx_hal_conf.h | HAL_CLK_ENABLE_PERIPH_ONLY | Enable the HAL_CRC_CLK
+USE_HAL_CRC_USER_DATA          | from stm32u5xx_hal_conf.h | 0                          | Allows to use user data
+USE_HAL_CRC_DMA                | from stm32u5xx_hal_conf.h | 0                          | Enable the DMA mode
+USE_HAL_CRC_REGISTER_CALLBACKS | from stm32u5xx_hal_conf.h | 0                          | Enable the register callbacks
   */
 
 #if defined(USE_HAL_CRC_MODULE) && (USE_HAL_CRC_MODULE == 1U)
@@ -101,6 +112,10 @@ USE_HAL_CRC_USER_DATA        | from stm32u5xx_hal_conf.h | 0
 #define CRC_POLYSIZE_16B (16U) /*!< 16-bit polynomial */
 #define CRC_POLYSIZE_8B  (8U)  /*!< 8-bit polynomial  */
 #define CRC_POLYSIZE_7B  (7U)  /*!< 7-bit polynomial  */
+
+#if defined(USE_HAL_CRC_DMA) && (USE_HAL_CRC_DMA == 1U)
+#define CRC_DMA_BLOCK_MAX_BYTE (0xFFFFU) /*!< Largest block of a DMA direct transfer */
+#endif /* USE_HAL_CRC_DMA */
 /**
   * @}
   */
@@ -151,6 +166,13 @@ static hal_status_t CRC_CheckPolynomial(uint32_t poly_coefficient, hal_crc_polyn
 #endif /* USE_HAL_CHECK_PARAM */
 
 static void CRC_ResetConfig(hal_crc_handle_t *hcrc);
+
+#if defined(USE_HAL_CRC_DMA) && (USE_HAL_CRC_DMA == 1U)
+static hal_status_t CRC_StartFeedData_DMA(hal_crc_handle_t *hcrc, const uint8_t *p_data, uint32_t size_byte);
+static hal_status_t CRC_FeedNextBlock_DMA(hal_crc_handle_t *hcrc);
+static void CRC_DMAXferCplt(hal_dma_handle_t *hdma);
+static void CRC_DMAError(hal_dma_handle_t *hdma);
+#endif /* USE_HAL_CRC_DMA */
 /**
   * @}
   */
@@ -208,6 +230,14 @@ hal_status_t HAL_CRC_Init(hal_crc_handle_t *hcrc, hal_crc_t instance)
   hcrc->p_user_data = NULL;
 #endif /* (USE_HAL_CRC_USER_DATA) */
 
+#if defined(USE_HAL_CRC_DMA) && (USE_HAL_CRC_DMA == 1U)
+  hcrc->hdma = NULL;
+#if defined(USE_HAL_CRC_REGISTER_CALLBACKS) && (USE_HAL_CRC_REGISTER_CALLBACKS == 1U)
+  hcrc->p_cplt_cb  = HAL_CRC_CalculateCpltCallback;
+  hcrc->p_error_cb = HAL_CRC_ErrorCallback;
+#endif /* USE_HAL_CRC_REGISTER_CALLBACKS */
+#endif /* USE_HAL_CRC_DMA */
+
 #if defined(USE_HAL_CRC_CLK_ENABLE_MODEL) && (USE_HAL_CRC_CLK_ENABLE_MODEL > HAL_CLK_ENABLE_NO)
   HAL_RCC_CRC_EnableClock();
 #endif /* USE_HAL_CRC_CLK_ENABLE_MODEL */
@@ -542,6 +572,10 @@ This function allows the user to calculate the CRC of an input data buffer start
 - HAL_CRC_Accumulate() API:
 This function allows the user to calculate the CRC of an input data buffer starting with the previously computed CRC as
 the initialization value \n \n
+
+When USE_HAL_CRC_DMA is set to 1, HAL_CRC_Calculate_DMA() and HAL_CRC_Accumulate_DMA() do the same with the input data
+fed by the DMA channel linked with HAL_CRC_SetDMA(), the CPU being free until HAL_CRC_CalculateCpltCallback() is
+called. \n \n
   */
 
 /**
@@ -643,6 +677,119 @@ hal_status_t HAL_CRC_Accumulate(hal_crc_handle_t *hcrc, const void *p_data, uint
   return HAL_OK;
 }
 
+#if defined(USE_HAL_CRC_DMA) && (USE_HAL_CRC_DMA == 1U)
+/**
+  * @brief  Compute in DMA mode the 7, 8, 16, or 32-bit CRC value of a user data buffer starting with
+  *         hcrc->Instance->INIT as initialization value.
+  * @param   hcrc             Pointer to a @ref hal_crc_handle_t structure that is the object maintaining the specified
+  *                           CRC HAL context
+  * @param   p_data           Pointer to **const void** data buffer provided by the user, aligned on the data width of
+  *                           the DMA channel
+  * @param   size_byte        A **uint32_t** input data buffer length (number of bytes)
+  * @param   p_crc_result     A **uint32_t** Calculated CRC, written before HAL_CRC_CalculateCpltCallback() is called
+  * @warning The DMA channel must be configured for memory to peripheral direct transfers with source address
+  *          increment, fixed destination address and the same source and destination data width. The byte exchange
+  *          of the channel is set by this function so that the bytes are fed in the same order as HAL_CRC_Calculate()
+  *          does. The data width must not be smaller than the granularity of the input reverse mode.
+  * @note    The last bytes not filling a DMA access are fed by the CPU in the DMA interrupt context. When there are
+  *          not enough bytes for a DMA access, the calculation completes before this function returns.
+  * @retval  HAL_INVALID_PARAM Invalid param return when the provided data buffer pointer is null or when this buffer is
+  *                            empty
+  * @retval  HAL_BUSY          Another calculation process is ongoing
+  * @retval  HAL_ERROR         The DMA channel configuration does not match the data buffer or the DMA start failed
+  * @retval  HAL_OK            The CRC calculation is started
+  */
+hal_status_t HAL_CRC_Calculate_DMA(hal_crc_handle_t *hcrc, const void *p_data, uint32_t size_byte,
+                                   uint32_t *p_crc_result)
+{
+  ASSERT_DBG_PARAM(hcrc != NULL);
+
+  ASSERT_DBG_PARAM(p_data != NULL);
+
+  ASSERT_DBG_PARAM(IS_CRC_DATA_SIZE_VALID(hcrc, size_byte));
+
+  ASSERT_DBG_PARAM(p_crc_result != NULL);
+
+  ASSERT_DBG_PARAM(hcrc->hdma != NULL);
+
+  ASSERT_DBG_STATE(hcrc->global_state, HAL_CRC_STATE_IDLE);
+
+#if defined(USE_HAL_CHECK_PARAM) && (USE_HAL_CHECK_PARAM == 1)
+  if ((p_data == NULL) || (size_byte == 0U) || (p_crc_result == NULL))
+  {
+    return HAL_INVALID_PARAM;
+  }
+#endif /* USE_HAL_CHECK_PARAM */
+
+  HAL_CHECK_UPDATE_STATE(hcrc, global_state, HAL_CRC_STATE_IDLE, HAL_CRC_STATE_ACTIVE);
+
+  LL_CRC_ResetCRCCalculationUnit(CRC_GET_INSTANCE(hcrc));
+
+  hcrc->p_crc_result = p_crc_result;
+
+  if (CRC_StartFeedData_DMA(hcrc, (const uint8_t *)p_data, size_byte) != HAL_OK)
+  {
+    hcrc->global_state = HAL_CRC_STATE_IDLE;
+
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Compute in DMA mode the 7, 8, 16, or 32-bit CRC value of a user data buffer starting with the previously
+  *         computed CRC as the initialization value.
+  * @param   hcrc             Pointer to a @ref hal_crc_handle_t structure that is the object maintaining the specified
+  *                           CRC HAL context
+  * @param   p_data           Pointer to **const void** data buffer provided by the user, aligned on the data width of
+  *                           the DMA channel
+  * @param   size_byte        A **uint32_t** input data buffer length (number of bytes)
+  * @param   p_crc_result     A **uint32_t** Calculated CRC, written before HAL_CRC_CalculateCpltCallback() is called
+  * @warning The DMA channel requirements are the ones of HAL_CRC_Calculate_DMA().
+  * @retval  HAL_INVALID_PARAM Invalid param return when the provided data buffer pointer is null or when this buffer is
+  *                            empty
+  * @retval  HAL_BUSY          Another calculation process is ongoing
+  * @retval  HAL_ERROR         The DMA channel configuration does not match the data buffer or the DMA start failed
+  * @retval  HAL_OK            The CRC calculation is started
+  */
+hal_status_t HAL_CRC_Accumulate_DMA(hal_crc_handle_t *hcrc, const void *p_data, uint32_t size_byte,
+                                    uint32_t *p_crc_result)
+{
+  ASSERT_DBG_PARAM(hcrc != NULL);
+
+  ASSERT_DBG_PARAM(p_data != NULL);
+
+  ASSERT_DBG_PARAM(IS_CRC_DATA_SIZE_VALID(hcrc, size_byte));
+
+  ASSERT_DBG_PARAM(p_crc_result != NULL);
+
+  ASSERT_DBG_PARAM(hcrc->hdma != NULL);
+
+  ASSERT_DBG_STATE(hcrc->global_state, HAL_CRC_STATE_IDLE);
+
+#if defined(USE_HAL_CHECK_PARAM) && (USE_HAL_CHECK_PARAM == 1)
+  if ((p_data == NULL) || (size_byte == 0U) || (p_crc_result == NULL))
+  {
+    return HAL_INVALID_PARAM;
+  }
+#endif /* USE_HAL_CHECK_PARAM */
+
+  HAL_CHECK_UPDATE_STATE(hcrc, global_state, HAL_CRC_STATE_IDLE, HAL_CRC_STATE_ACTIVE);
+
+  hcrc->p_crc_result = p_crc_result;
+
+  if (CRC_StartFeedData_DMA(hcrc, (const uint8_t *)p_data, size_byte) != HAL_OK)
+  {
+    hcrc->global_state = HAL_CRC_STATE_IDLE;
+
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+#endif /* USE_HAL_CRC_DMA */
+
 /**
   * @}
   */
@@ -707,6 +854,135 @@ const void *HAL_CRC_GetUserData(const hal_crc_handle_t *hcrc)
   */
 #endif /* USE_HAL_CRC_USER_DATA == 1 */
 
+#if defined(USE_HAL_CRC_DMA) && (USE_HAL_CRC_DMA == 1U)
+/** @addtogroup CRC_Exported_Functions_Group6
+  * @{
+This subsection provides a set of functions allowing to use the CRC DMA mode:
+  - HAL_CRC_SetDMA()                        : Used to link the DMA channel feeding the CRC data register
+  - HAL_CRC_CalculateCpltCallback()         : Called when a DMA calculation is complete
+  - HAL_CRC_ErrorCallback()                 : Called when a DMA calculation fails
+  - HAL_CRC_RegisterCalculateCpltCallback() : Used to register the calculation complete callback, when
+                                              USE_HAL_CRC_REGISTER_CALLBACKS is set to 1
+  - HAL_CRC_RegisterErrorCallback()         : Used to register the error callback, when
+                                              USE_HAL_CRC_REGISTER_CALLBACKS is set to 1
+  */
+
+/**
+  * @brief  Link the DMA handle to the CRC handle.
+  * @param  hcrc              Pointer to a @ref hal_crc_handle_t structure
+  * @param  hdma              Pointer to a hal_dma_handle_t structure
+  * @retval HAL_INVALID_PARAM Invalid parameter when pointer to DMA handle is NULL
+  * @retval HAL_OK            CRC handle and DMA handle are successfully linked
+  */
+hal_status_t HAL_CRC_SetDMA(hal_crc_handle_t *hcrc, hal_dma_handle_t *hdma)
+{
+  ASSERT_DBG_PARAM(hcrc != NULL);
+
+  ASSERT_DBG_PARAM(hdma != NULL);
+
+  ASSERT_DBG_STATE(hcrc->global_state, HAL_CRC_STATE_IDLE);
+
+#if defined(USE_HAL_CHECK_PARAM) && (USE_HAL_CHECK_PARAM == 1)
+  if (hdma == NULL)
+  {
+    return HAL_INVALID_PARAM;
+  }
+#endif /* USE_HAL_CHECK_PARAM */
+
+  hcrc->hdma     = hdma;
+  hdma->p_parent = hcrc;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  CRC DMA calculation complete callback.
+  * @param  hcrc Pointer to a @ref hal_crc_handle_t structure
+  */
+__WEAK void HAL_CRC_CalculateCpltCallback(hal_crc_handle_t *hcrc)
+{
+  /* Prevent unused argument(s) compilation warning */
+  STM32_UNUSED(hcrc);
+
+  /* WARNING: This function must not be modified, when the callback is needed,
+    *          HAL_CRC_CalculateCpltCallback() can be implemented in the user file.
+    */
+}
+
+/**
+  * @brief  CRC DMA calculation error callback.
+  * @param  hcrc Pointer to a @ref hal_crc_handle_t structure
+  */
+__WEAK void HAL_CRC_ErrorCallback(hal_crc_handle_t *hcrc)
+{
+  /* Prevent unused argument(s) compilation warning */
+  STM32_UNUSED(hcrc);
+
+  /* WARNING: This function must not be modified, when the callback is needed,
+    *          HAL_CRC_ErrorCallback() can be implemented in the user file.
+    */
+}
+
+#if defined(USE_HAL_CRC_REGISTER_CALLBACKS) && (USE_HAL_CRC_REGISTER_CALLBACKS == 1U)
+/**
+  * @brief  Register a User CRC callback for the DMA calculation complete.
+  * @param  hcrc              Pointer to a @ref hal_crc_handle_t structure
+  * @param  p_callback        Pointer to the callback function
+  * @retval HAL_INVALID_PARAM p_callback pointer is NULL
+  * @retval HAL_OK            Register completed successfully
+  */
+hal_status_t HAL_CRC_RegisterCalculateCpltCallback(hal_crc_handle_t *hcrc, hal_crc_cb_t p_callback)
+{
+  ASSERT_DBG_PARAM(hcrc != NULL);
+
+  ASSERT_DBG_PARAM(p_callback != NULL);
+
+  ASSERT_DBG_STATE(hcrc->global_state, HAL_CRC_STATE_IDLE);
+
+#if defined(USE_HAL_CHECK_PARAM) && (USE_HAL_CHECK_PARAM == 1)
+  if (p_callback == NULL)
+  {
+    return HAL_INVALID_PARAM;
+  }
+#endif /* USE_HAL_CHECK_PARAM */
+
+  hcrc->p_cplt_cb = p_callback;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Register a User CRC callback for the DMA calculation error.
+  * @param  hcrc              Pointer to a @ref hal_crc_handle_t structure
+  * @param  p_callback        Pointer to the callback function
+  * @retval HAL_INVALID_PARAM p_callback pointer is NULL
+  * @retval HAL_OK            Register completed successfully
+  */
+hal_status_t HAL_CRC_RegisterErrorCallback(hal_crc_handle_t *hcrc, hal_crc_cb_t p_callback)
+{
+  ASSERT_DBG_PARAM(hcrc != NULL);
+
+  ASSERT_DBG_PARAM(p_callback != NULL);
+
+  ASSERT_DBG_STATE(hcrc->global_state, HAL_CRC_STATE_IDLE);
+
+#if defined(USE_HAL_CHECK_PARAM) && (USE_HAL_CHECK_PARAM == 1)
+  if (p_callback == NULL)
+  {
+    return HAL_INVALID_PARAM;
+  }
+#endif /* USE_HAL_CHECK_PARAM */
+
+  hcrc->p_error_cb = p_callback;
+
+  return HAL_OK;
+}
+#endif /* USE_HAL_CRC_REGISTER_CALLBACKS */
+/**
+  * @}
+  */
+#endif /* USE_HAL_CRC_DMA */
+
 /**
   * @}
   */
@@ -900,6 +1176,145 @@ static void CRC_ResetConfig(hal_crc_handle_t *hcrc)
   LL_CRC_SetDataReverseMode(p_crcx, LL_CRC_INDATA_REVERSE_NONE, LL_CRC_OUTDATA_REVERSE_NONE);
 }
 
+#if defined(USE_HAL_CRC_DMA) && (USE_HAL_CRC_DMA == 1U)
+/**
+  * @brief  Check the DMA channel configuration against the data buffer and start feeding it.
+  * @param  hcrc      Pointer to a @ref hal_crc_handle_t structure  that is the object maintaining the specified CRC
+  *                   HAL context
+  * @param  p_data    Pointer to the 8-bit input data buffer
+  * @param  size_byte Input data buffer length (number of bytes)
+  * @retval HAL_ERROR The DMA channel configuration does not match the data buffer or the DMA start failed
+  * @retval HAL_OK    The data feeding is started, or completed when shorter than a DMA access
+  */
+static hal_status_t CRC_StartFeedData_DMA(hal_crc_handle_t *hcrc, const uint8_t *p_data, uint32_t size_byte)
+{
+  hal_dma_direct_xfer_config_t xfer_config;
+  hal_dma_data_handling_config_t data_handling;
+  uint32_t src_width_byte;
+  uint32_t width_byte;
+  uint32_t reverse_mode;
+
+  HAL_DMA_GetConfigDirectXfer(hcrc->hdma, &xfer_config);
+
+  src_width_byte = (xfer_config.src_data_width == HAL_DMA_SRC_DATA_WIDTH_WORD) ? 4U :
+                   ((xfer_config.src_data_width == HAL_DMA_SRC_DATA_WIDTH_HALFWORD) ? 2U : 1U);
+  width_byte = (xfer_config.dest_data_width == HAL_DMA_DEST_DATA_WIDTH_WORD) ? 4U :
+               ((xfer_config.dest_data_width == HAL_DMA_DEST_DATA_WIDTH_HALFWORD) ? 2U : 1U);
+  reverse_mode = LL_CRC_GetInputDataReverseMode(CRC_GET_INSTANCE(hcrc));
+
+  /* No packing: each source access is one data register write. The data register writes must not split the input
+     reverse mode granularity */
+  if ((src_width_byte != width_byte)
+      || (((uint32_t)p_data & (width_byte - 1U)) != 0U)
+      || ((reverse_mode == LL_CRC_INDATA_REVERSE_HALFWORD) && (width_byte < 2U))
+      || ((reverse_mode == LL_CRC_INDATA_REVERSE_WORD) && (width_byte < 4U)))
+  {
+    return HAL_ERROR;
+  }
+
+  /* The first byte in memory is the most significant one of each data register write, as with HAL_CRC_Calculate() */
+  data_handling.src_byte_exchange      = HAL_DMA_SRC_BYTE_PRESERVED;
+  data_handling.dest_byte_exchange     = (width_byte > 1U) ? HAL_DMA_DEST_BYTE_EXCHANGED : HAL_DMA_DEST_BYTE_PRESERVED;
+  data_handling.dest_halfword_exchange = (width_byte > 2U) ? HAL_DMA_DEST_HALFWORD_EXCHANGED :
+                                         HAL_DMA_DEST_HALFWORD_PRESERVED;
+  data_handling.trunc_padd             = HAL_DMA_DEST_DATA_TRUNC_LEFT_PADD_ZERO;
+  data_handling.pack                   = HAL_DMA_DEST_DATA_PRESERVED;
+
+  if (HAL_DMA_SetConfigDirectXferDataHandling(hcrc->hdma, &data_handling) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  hcrc->p_buff          = p_data;
+  hcrc->xfer_count_byte = size_byte;
+  hcrc->dma_width_byte  = width_byte;
+
+  hcrc->hdma->p_xfer_cplt_cb  = CRC_DMAXferCplt;
+  hcrc->hdma->p_xfer_error_cb = CRC_DMAError;
+
+  return CRC_FeedNextBlock_DMA(hcrc);
+}
+
+/**
+  * @brief  Start the DMA transfer of the next block of data, or feed the last bytes and complete the calculation.
+  * @param  hcrc      Pointer to a @ref hal_crc_handle_t structure  that is the object maintaining the specified CRC
+  *                   HAL context
+  * @retval HAL_ERROR The DMA start failed
+  * @retval HAL_OK    The next block is started, or the calculation is complete
+  */
+static hal_status_t CRC_FeedNextBlock_DMA(hal_crc_handle_t *hcrc)
+{
+  uint32_t block_max_byte = CRC_DMA_BLOCK_MAX_BYTE & ~(hcrc->dma_width_byte - 1U);
+  uint32_t block_byte = hcrc->xfer_count_byte & ~(hcrc->dma_width_byte - 1U);
+  const uint8_t *p_block = hcrc->p_buff;
+
+  if (block_byte == 0U)
+  {
+    /* Last bytes not filling a DMA access */
+    *hcrc->p_crc_result = CRC_FeedData(hcrc, p_block, hcrc->xfer_count_byte);
+
+    hcrc->global_state = HAL_CRC_STATE_IDLE;
+
+#if defined(USE_HAL_CRC_REGISTER_CALLBACKS) && (USE_HAL_CRC_REGISTER_CALLBACKS == 1U)
+    hcrc->p_cplt_cb(hcrc);
+#else
+    HAL_CRC_CalculateCpltCallback(hcrc);
+#endif /* USE_HAL_CRC_REGISTER_CALLBACKS */
+
+    return HAL_OK;
+  }
+
+  if (block_byte > block_max_byte)
+  {
+    block_byte = block_max_byte;
+  }
+
+  /* Updated before the start, the block completion can occur at any time */
+  hcrc->p_buff          += block_byte;
+  hcrc->xfer_count_byte -= block_byte;
+
+  return HAL_DMA_StartPeriphXfer_IT_Opt(hcrc->hdma, (uint32_t)p_block, (uint32_t)&(CRC_GET_INSTANCE(hcrc)->DR),
+                                        block_byte, HAL_DMA_OPT_IT_NONE);
+}
+
+/**
+  * @brief  DMA CRC data transfer complete callback.
+  * @param  hdma Pointer to a hal_dma_handle_t structure
+  */
+static void CRC_DMAXferCplt(hal_dma_handle_t *hdma)
+{
+  hal_crc_handle_t *hcrc = (hal_crc_handle_t *)hdma->p_parent;
+
+  if (CRC_FeedNextBlock_DMA(hcrc) != HAL_OK)
+  {
+    hcrc->global_state = HAL_CRC_STATE_IDLE;
+
+#if defined(USE_HAL_CRC_REGISTER_CALLBACKS) && (USE_HAL_CRC_REGISTER_CALLBACKS == 1U)
+    hcrc->p_error_cb(hcrc);
+#else
+    HAL_CRC_ErrorCallback(hcrc);
+#endif /* USE_HAL_CRC_REGISTER_CALLBACKS */
+  }
+}
+
+/**
+  * @brief  DMA CRC data transfer error callback.
+  * @param  hdma Pointer to a hal_dma_handle_t structure
+  */
+static void CRC_DMAError(hal_dma_handle_t *hdma)
+{
+  hal_crc_handle_t *hcrc = (hal_crc_handle_t *)hdma->p_parent;
+
+  hcrc->global_state = HAL_CRC_STATE_IDLE;
+
+#if defined(USE_HAL_CRC_REGISTER_CALLBACKS) && (USE_HAL_CRC_REGISTER_CALLBACKS == 1U)
+  hcrc->p_error_cb(hcrc);
+#else
+  HAL_CRC_ErrorCallback(hcrc);
+#endif /* USE_HAL_CRC_REGISTER_CALLBACKS */
+}
+#endif /* USE_HAL_CRC_DMA */
+
 /**
   * @}
   */
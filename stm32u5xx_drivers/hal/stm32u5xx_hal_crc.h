@@ -94,6 +94,12 @@ typedef enum
 
 typedef struct hal_crc_handle_s hal_crc_handle_t; /*!< CRC Handle type Definition */
 
+#if defined(USE_HAL_CRC_DMA) && (USE_HAL_CRC_DMA == 1U)
+#if defined(USE_HAL_CRC_REGISTER_CALLBACKS) && (USE_HAL_CRC_REGISTER_CALLBACKS == 1U)
+typedef void (*hal_crc_cb_t)(hal_crc_handle_t *hcrc); /*!< HAL CRC Callback pointer definition */
+#endif /* USE_HAL_CRC_REGISTER_CALLBACKS */
+#endif /* USE_HAL_CRC_DMA */
+
 /*! CRC Handle Structure Definition */
 struct hal_crc_handle_s
 {
@@ -102,6 +108,18 @@ struct hal_crc_handle_s
 
   volatile hal_crc_state_t global_state; /*!< CRC state */
 
+#if defined(USE_HAL_CRC_DMA) && (USE_HAL_CRC_DMA == 1U)
+  hal_dma_handle_t         *hdma;             /*!< DMA handle feeding the CRC data register */
+  const uint8_t            *p_buff;           /*!< Next data to be fed to the CRC           */
+  uint32_t                 xfer_count_byte;   /*!< Number of bytes still to be fed          */
+  uint32_t                 dma_width_byte;    /*!< Data width of the DMA accesses           */
+  uint32_t                 *p_crc_result;     /*!< CRC result of the DMA calculation        */
+#if defined(USE_HAL_CRC_REGISTER_CALLBACKS) && (USE_HAL_CRC_REGISTER_CALLBACKS == 1U)
+  hal_crc_cb_t             p_cplt_cb;         /*!< CRC calculation complete callback        */
+  hal_crc_cb_t             p_error_cb;        /*!< CRC error callback                       */
+#endif /* USE_HAL_CRC_REGISTER_CALLBACKS */
+#endif /* USE_HAL_CRC_DMA */
+
 #if defined(USE_HAL_CRC_USER_DATA) && (USE_HAL_CRC_USER_DATA == 1)
   const void               *p_user_data;      /*!< User Data Pointer */
 #endif /* (USE_HAL_CRC_USER_DATA) */
@@ -224,6 +242,12 @@ uint32_t HAL_CRC_GetIndependentData(const hal_crc_handle_t *hcrc);
   */
 hal_status_t HAL_CRC_Accumulate(hal_crc_handle_t *hcrc, const void *p_data, uint32_t size_byte, uint32_t *p_crc_result);
 hal_status_t HAL_CRC_Calculate(hal_crc_handle_t *hcrc, const void *p_data, uint32_t size_byte, uint32_t *p_crc_result);
+#if defined(USE_HAL_CRC_DMA) && (USE_HAL_CRC_DMA == 1U)
+hal_status_t HAL_CRC_Accumulate_DMA(hal_crc_handle_t *hcrc, const void *p_data, uint32_t size_byte,
+                                    uint32_t *p_crc_result);
+hal_status_t HAL_CRC_Calculate_DMA(hal_crc_handle_t *hcrc, const void *p_data, uint32_t size_byte,
+                                   uint32_t *p_crc_result);
+#endif /* USE_HAL_CRC_DMA */
 /**
   * @}
   */
@@ -247,6 +271,24 @@ const void *HAL_CRC_GetUserData(const hal_crc_handle_t *hcrc);
   */
 #endif /* (USE_HAL_CRC_USER_DATA) */
 
+#if defined(USE_HAL_CRC_DMA) && (USE_HAL_CRC_DMA == 1U)
+/** @defgroup CRC_Exported_Functions_Group6 DMA link and callbacks functions
+  * @{
+  */
+hal_status_t HAL_CRC_SetDMA(hal_crc_handle_t *hcrc, hal_dma_handle_t *hdma);
+
+void HAL_CRC_CalculateCpltCallback(hal_crc_handle_t *hcrc);
+void HAL_CRC_ErrorCallback(hal_crc_handle_t *hcrc);
+
+#if defined(USE_HAL_CRC_REGISTER_CALLBACKS) && (USE_HAL_CRC_REGISTER_CALLBACKS == 1U)
+hal_status_t HAL_CRC_RegisterCalculateCpltCallback(hal_crc_handle_t *hcrc, hal_crc_cb_t p_callback);
+hal_status_t HAL_CRC_RegisterErrorCallback(hal_crc_handle_t *hcrc, hal_crc_cb_t p_callback);
+#endif /* USE_HAL_CRC_REGISTER_CALLBACKS */
+/**
+  * @}
+  */
+#endif /* USE_HAL_CRC_DMA */
+
 /**
   * @}
   */
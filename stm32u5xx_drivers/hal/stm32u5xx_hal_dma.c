@@ -277,6 +277,7 @@ data transfers between memory-mapped peripherals and/or memories via linked-list
 - Use HAL_DMA_RegisterXferAbortCallback() function to register transfer abort user callbacks.
 - Use HAL_DMA_RegisterXferSuspendCallback() function to register transfer suspend user callbacks.
 - Use HAL_DMA_RegisterXferErrorCallback() function to register transfer error user callbacks.
+- Use HAL_DMA_RegisterXferRestartCallback() function to register linked-list transfer restart user callbacks.
 
 - Use HAL_DMA_StartDirectXfer_IT() function to start the DMA transfer in direct mode after the enable of DMA
   default optional interrupts and the configuration of source address,destination address and the size of data
@@ -622,6 +623,8 @@ static void DMA_List_GetCLLRNodeInfo(const hal_dma_node_t *p_node, uint32_t *p_c
 static void DMA_List_FormatNode(hal_dma_node_t *p_node, uint32_t reg_idx, uint32_t reg_nbr, uint32_t format);
 
 static void DMA_List_ClearUnusedFields(hal_dma_node_t *p_node, uint32_t first_unused_field);
+
+static void *DMA_List_GetFirstPendingNode(const hal_dma_handle_t *hdma, const hal_q_t *p_q);
 #endif /* USE_HAL_DMA_LINKEDLIST */
 
 static void DMA_StartDirectXfer(hal_dma_handle_t *hdma, uint32_t src_addr, uint32_t dest_addr, uint32_t size_byte,
@@ -701,6 +704,8 @@ hal_status_t HAL_DMA_Init(hal_dma_handle_t *hdma, hal_dma_channel_t instance)
 
 #if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
   hdma->xfer_mode = HAL_DMA_XFER_MODE_DIRECT;
+  hdma->p_restart_node = NULL;
+  hdma->p_xfer_restart_cb = HAL_DMA_XferRestartCallback;
 #endif /* USE_HAL_DMA_LINKEDLIST */
 
   hdma->global_state = HAL_DMA_STATE_INIT;
@@ -2725,6 +2730,12 @@ This subsection provides a set of functions allowing to configure the DMA channe
 - Call the function HAL_DMA_StartLinkedListXfer_IT_Opt() to start linked-list DMA channel transfer in interrupt mode
   with customized optional interrupts configuration
 
+- Call the function HAL_DMA_AppendNodeWhileRunning() to link a new node after the tail of a running linked-list DMA
+  channel transfer
+
+- Call the function HAL_DMA_ReclaimCompletedNodes() to move the nodes already executed by a linked-list DMA channel
+  transfer into a free nodes pool
+
 - Call the function HAL_DMA_Abort() to abort any ongoing DMA channel transfer in blocking mode
 
 - Call the function HAL_DMA_Abort_IT() to abort any ongoing DMA channel transfer in interrupt mode
@@ -2987,6 +2998,120 @@ hal_status_t HAL_DMA_StartLinkedListXfer_IT_Opt(hal_dma_handle_t *hdma, const ha
 
   return HAL_OK;
 }
+
+/**
+  * @brief  Append a node at the tail of the queue of a running linked-list transfer.
+  * @param  hdma              Pointer to DMA channel handle
+  * @param  p_q               Pointer to the hal_q_t structure given to HAL_DMA_StartLinkedListXfer_IT_Opt()
+  * @param  p_new_node        Pointer to the node to append, filled with HAL_DMA_FillNodeConfig()
+  * @note   The transfer must be started in interrupt mode on a static, not circular, queue. The new node must be
+  *         located in the same 64 Kbytes memory region as the queue nodes.
+  * @note   When the channel has already loaded the tail node with its null link, it stops at the end of the tail
+  *         node whatever the node memory content. The new node is then recorded and the channel is restarted from
+  *         it in HAL_DMA_IRQHandler(), which calls the transfer restart callback instead of the transfer complete
+  *         callback: the transfer complete callback is only called at the end of the last node.
+  * @retval HAL_INVALID_PARAM Invalid parameter return when p_q or p_new_node pointer is NULL, or when p_new_node is
+  *                           not in the queue memory region
+  * @retval HAL_ERROR         The channel is not running anymore: reclaim the completed nodes with
+  *                           HAL_DMA_ReclaimCompletedNodes() and restart the queue
+  * @retval HAL_OK            Node successfully appended
+  */
+hal_status_t HAL_DMA_AppendNodeWhileRunning(hal_dma_handle_t *hdma, hal_q_t *p_q, hal_dma_node_t *p_new_node)
+{
+  uint32_t primask_bit;
+  hal_status_t status = HAL_OK;
+
+  ASSERT_DBG_PARAM(hdma != NULL);
+  ASSERT_DBG_PARAM(p_q != NULL);
+  ASSERT_DBG_PARAM(p_new_node != NULL);
+  ASSERT_DBG_PARAM(p_q->p_first_circular_node == NULL);
+
+#if defined (USE_HAL_CHECK_PARAM) && (USE_HAL_CHECK_PARAM == 1)
+  if ((p_q == NULL) || (p_new_node == NULL))
+  {
+    return HAL_INVALID_PARAM;
+  }
+
+  if ((p_q->p_head_node != NULL)
+      && (((uint32_t)p_new_node & DMA_CLBAR_LBA) != ((uint32_t)p_q->p_head_node & DMA_CLBAR_LBA)))
+  {
+    return HAL_INVALID_PARAM;
+  }
+#endif /* USE_HAL_CHECK_PARAM */
+
+  /* The new node ends the list */
+  p_new_node->regs[p_q->next_addr_offset / 4U] = 0U;
+
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+
+  if ((hdma->global_state != HAL_DMA_STATE_ACTIVE) || (p_q->p_head_node == NULL))
+  {
+    status = HAL_ERROR;
+  }
+  else
+  {
+    /* Link the new node to the tail node in memory */
+    (void)HAL_Q_InsertNode_Tail(p_q, p_new_node);
+    __DSB();
+
+    /* Nothing more to do when the nodes appended before are already waiting for a restart. Otherwise, a null link
+       in the channel means that the tail node was loaded before being linked: the channel stops after it, or has
+       already stopped, and must be restarted from the new node. */
+    if ((hdma->p_restart_node == NULL)
+        && ((LL_DMA_IsActiveFlag_IDLE(DMA_CHANNEL_GET_INSTANCE(hdma)) != 0U)
+            || ((LL_DMA_READ_REG((DMA_CHANNEL_GET_INSTANCE(hdma)), CLLR) & DMA_CLLR_LA) == 0U)))
+    {
+      hdma->p_restart_node = p_new_node;
+    }
+  }
+
+  __set_PRIMASK(primask_bit);
+
+  return status;
+}
+
+/**
+  * @brief  Move the nodes already executed by the channel from the head of the queue to a free nodes pool.
+  * @param  hdma     Pointer to DMA channel handle
+  * @param  p_q      Pointer to the hal_q_t structure given to HAL_DMA_StartLinkedListXfer_IT_Opt()
+  * @param  p_free_q Pointer to the hal_q_t structure of the free nodes pool, initialized with the same descriptor
+  *                  operations as p_q
+  * @note   The node in progress and the nodes after it stay in p_q. All the nodes are moved once the transfer is over.
+  *         Nodes are taken back from the pool with HAL_Q_RemoveNode_Head().
+  * @retval uint32_t Number of nodes moved to p_free_q
+  */
+uint32_t HAL_DMA_ReclaimCompletedNodes(hal_dma_handle_t *hdma, hal_q_t *p_q, hal_q_t *p_free_q)
+{
+  uint32_t primask_bit;
+  uint32_t node_nbr = 0U;
+  void     *p_node;
+  void     *p_first_pending;
+
+  ASSERT_DBG_PARAM(hdma != NULL);
+  ASSERT_DBG_PARAM(p_q != NULL);
+  ASSERT_DBG_PARAM(p_free_q != NULL);
+  ASSERT_DBG_PARAM(p_q->p_first_circular_node == NULL);
+
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+
+  p_first_pending = DMA_List_GetFirstPendingNode(hdma, p_q);
+
+  while ((p_q->p_head_node != NULL) && (p_q->p_head_node != p_first_pending))
+  {
+    p_node = p_q->p_head_node;
+
+    (void)HAL_Q_RemoveNode_Head(p_q);
+    (void)HAL_Q_InsertNode_Tail(p_free_q, p_node);
+
+    node_nbr++;
+  }
+
+  __set_PRIMASK(primask_bit);
+
+  return node_nbr;
+}
 #endif /* USE_HAL_DMA_LINKEDLIST */
 
 /**
@@ -3295,6 +3420,18 @@ void HAL_DMA_IRQHandler(hal_dma_handle_t *hdma)
     /* Check if there are remaining data */
     if (LL_DMA_IsActiveFlag_IDLE(DMA_CHANNEL_GET_INSTANCE(hdma)) != 0U)
     {
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+      /* Nodes appended after the channel fetched the end of the q: the transfer goes on */
+      if (hdma->p_restart_node != NULL)
+      {
+        DMA_StartLinkedListXfer(hdma, hdma->p_restart_node, (its & HAL_DMA_OPT_IT_DEFAULT));
+
+        hdma->p_xfer_restart_cb(hdma);
+
+        return;
+      }
+#endif /* USE_HAL_DMA_LINKEDLIST */
+
       LL_DMA_ClearFlag_HT(DMA_CHANNEL_GET_INSTANCE(hdma));
 
       LL_DMA_DisableIT(DMA_CHANNEL_GET_INSTANCE(hdma), LL_DMA_IT_ALL);
@@ -3356,6 +3493,8 @@ This subsection provides a set of functions allowing to register the DMA channel
 
 - Call the function HAL_DMA_RegisterXferErrorCallback() to register the DMA channel error callback
 
+- Call the function HAL_DMA_RegisterXferRestartCallback() to register the DMA channel linked-list restart callback
+
 - Call the function HAL_DMA_SetUserData() to set a user data in handle
 
 - Call the function HAL_DMA_GetUserData() to get a user data from handle
@@ -3481,6 +3620,32 @@ hal_status_t HAL_DMA_RegisterXferErrorCallback(hal_dma_handle_t *hdma, hal_dma_c
   return HAL_OK;
 }
 
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+/**
+  * @brief  Store the given callback into the DMA handle.
+  * @param  hdma              Pointer to DMA channel handle
+  * @param  callback          Specifies the linked-list transfer restart callback
+  * @retval HAL_INVALID_PARAM Invalid parameter return when callback pointer is NULL
+  * @retval HAL_OK            DMA channel restart transfer callback is successfully stored
+  */
+hal_status_t HAL_DMA_RegisterXferRestartCallback(hal_dma_handle_t *hdma, hal_dma_cb_t callback)
+{
+  ASSERT_DBG_PARAM(hdma != NULL);
+  ASSERT_DBG_PARAM(callback != NULL);
+
+#if defined (USE_HAL_CHECK_PARAM) && (USE_HAL_CHECK_PARAM == 1)
+  if (callback == NULL)
+  {
+    return HAL_INVALID_PARAM;
+  }
+#endif /* USE_HAL_CHECK_PARAM */
+
+  hdma->p_xfer_restart_cb = callback;
+
+  return HAL_OK;
+}
+#endif /* USE_HAL_DMA_LINKEDLIST */
+
 /**
   * @brief DMA channel half transfer complete default callback.
   * @param hdma Pointer to DMA channel handle
@@ -3546,6 +3711,23 @@ __WEAK void HAL_DMA_XferErrorCallback(hal_dma_handle_t *hdma)
                    HAL_DMA_RegisterXferErrorCallback() must be implemented in the user file */
 }
 
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+/**
+  * @brief DMA channel linked-list transfer restart default callback.
+  * @param hdma Pointer to DMA channel handle
+  * @note  Called when the channel reached the end of the q and was restarted from the nodes appended by
+  *        HAL_DMA_AppendNodeWhileRunning() after it had loaded the tail node. The transfer is still active.
+  */
+__WEAK void HAL_DMA_XferRestartCallback(hal_dma_handle_t *hdma)
+{
+  /* Prevent unused argument(s) compilation warning */
+  STM32_UNUSED(hdma);
+
+  /*! <b>NOTE:</b> This is a weak function and must not be modified, when the callback is needed, the
+                   HAL_DMA_RegisterXferRestartCallback() must be implemented in the user file */
+}
+#endif /* USE_HAL_DMA_LINKEDLIST */
+
 #if defined(USE_HAL_DMA_USER_DATA) && (USE_HAL_DMA_USER_DATA == 1)
 /**
   * @brief Store the user data into the DMA channel handle.
@@ -4418,6 +4600,62 @@ static void DMA_List_GetCLLRNodeInfo(const hal_dma_node_t *p_node, uint32_t *p_c
   }
 }
 
+/**
+  * @brief  Get the first node of the queue not completed by the channel.
+  * @param  hdma Pointer to DMA channel handle
+  * @param  p_q  Pointer to a hal_q_t structure that contains queue information
+  * @retval void* Node in progress or waiting for a restart, NULL when all the queue nodes are completed
+  */
+static void *DMA_List_GetFirstPendingNode(const hal_dma_handle_t *hdma, const hal_q_t *p_q)
+{
+  uint32_t current_node = (uint32_t)p_q->p_head_node;
+  uint32_t next_node;
+  uint32_t channel_link;
+
+  /* Transfer over */
+  if (hdma->global_state != HAL_DMA_STATE_ACTIVE)
+  {
+    return NULL;
+  }
+
+  /* Channel stopped, waiting for a restart from the transfer complete interrupt if nodes were appended */
+  if (LL_DMA_IsActiveFlag_IDLE(DMA_CHANNEL_GET_INSTANCE(hdma)) != 0U)
+  {
+    return hdma->p_restart_node;
+  }
+
+  /* The channel link register holds the link of the node in progress, as it was when the node was loaded. A null
+     link is the one of the tail node at that time, now followed by the node waiting for a restart if any. */
+  channel_link = LL_DMA_READ_REG((DMA_CHANNEL_GET_INSTANCE(hdma)), CLLR) & DMA_CLLR_LA;
+
+  if ((channel_link == 0U) && (hdma->p_restart_node == NULL))
+  {
+    return p_q->p_tail_node;
+  }
+
+  if (channel_link == 0U)
+  {
+    next_node = (uint32_t)hdma->p_restart_node;
+  }
+  else
+  {
+    next_node = LL_DMA_GetLinkedListBaseAddr(DMA_CHANNEL_GET_INSTANCE(hdma)) | channel_link;
+  }
+
+  while ((current_node != 0U) && (current_node != (uint32_t)p_q->p_tail_node))
+  {
+    if (p_q->p_get_node((uint32_t)p_q->p_head_node, current_node, p_q->next_addr_offset) == next_node)
+    {
+      return (void *)current_node;
+    }
+
+    current_node = p_q->p_get_node((uint32_t)p_q->p_head_node, current_node, p_q->next_addr_offset);
+  }
+
+  /* Node in progress not found: nothing is reclaimed */
+  return p_q->p_head_node;
+}
+
 /**
   * @brief Format the node according to unused registers.
   * @param p_node  Pointer to a DMA_NodeTypeDef structure that contains linked-list node registers configurations
@@ -4512,6 +4750,8 @@ static void DMA_StartLinkedListXfer(hal_dma_handle_t *hdma, const void *p_head_n
     update_bits |= LL_DMA_UPDATE_CBR2 | LL_DMA_UPDATE_CTR3;
   }
 
+  hdma->p_restart_node = NULL;
+
   LL_DMA_SetLinkedListBaseAddr(DMA_CHANNEL_GET_INSTANCE(hdma), (uint32_t)p_head_node);
 
   LL_DMA_ConfigLinkUpdate(DMA_CHANNEL_GET_INSTANCE(hdma), update_bits, ((uint32_t)p_head_node & DMA_CLLR_LA));
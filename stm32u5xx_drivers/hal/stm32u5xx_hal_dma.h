@@ -755,12 +755,18 @@ struct hal_dma_handle_s
 #if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
   volatile hal_dma_xfer_mode_t     xfer_mode;         /*!< DMA channel transfer mode                   */
   hal_dma_node_t                   *p_head_node;      /*!< DMA channel q                               */
+  hal_dma_node_t *volatile         p_restart_node;    /*!< DMA channel node appended after the channel
+                                                           fetched the end of the q, restarted from the
+                                                           transfer complete interrupt                   */
 #endif /* USE_HAL_DMA_LINKEDLIST */
   hal_dma_cb_t p_xfer_halfcplt_cb;                    /*!< DMA channel half transfer complete callback */
   hal_dma_cb_t p_xfer_cplt_cb;                        /*!< DMA channel transfer complete callback      */
   hal_dma_cb_t p_xfer_abort_cb;                       /*!< DMA channel transfer Abort callback         */
   hal_dma_cb_t p_xfer_suspend_cb;                     /*!< DMA channel transfer Suspend callback       */
   hal_dma_cb_t p_xfer_error_cb;                       /*!< DMA channel transfer error callback         */
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+  hal_dma_cb_t p_xfer_restart_cb;                     /*!< DMA channel transfer restart callback       */
+#endif /* USE_HAL_DMA_LINKEDLIST */
 #if defined(USE_HAL_DMA_USER_DATA) && (USE_HAL_DMA_USER_DATA == 1)
   const void                        *p_user_data;     /*!< DMA channel user data                       */
 #endif /* USE_HAL_DMA_USER_DATA */
@@ -949,6 +955,10 @@ hal_status_t HAL_DMA_StartDirectXfer_IT_Opt(hal_dma_handle_t *hdma, uint32_t src
 hal_status_t HAL_DMA_StartLinkedListXfer(hal_dma_handle_t *hdma, const hal_q_t *p_q);
 hal_status_t HAL_DMA_StartLinkedListXfer_IT(hal_dma_handle_t *hdma, const hal_q_t *p_q);
 hal_status_t HAL_DMA_StartLinkedListXfer_IT_Opt(hal_dma_handle_t *hdma, const hal_q_t *p_q, uint32_t interrupts);
+
+/* Running linked-list APIs */
+hal_status_t HAL_DMA_AppendNodeWhileRunning(hal_dma_handle_t *hdma, hal_q_t *p_q, hal_dma_node_t *p_new_node);
+uint32_t HAL_DMA_ReclaimCompletedNodes(hal_dma_handle_t *hdma, hal_q_t *p_q, hal_q_t *p_free_q);
 #endif /* USE_HAL_DMA_LINKEDLIST */
 
 /* Abort APIs */
@@ -978,6 +988,9 @@ hal_status_t HAL_DMA_RegisterXferCpltCallback(hal_dma_handle_t *hdma, hal_dma_cb
 hal_status_t HAL_DMA_RegisterXferAbortCallback(hal_dma_handle_t *hdma, hal_dma_cb_t callback);
 hal_status_t HAL_DMA_RegisterXferSuspendCallback(hal_dma_handle_t *hdma, hal_dma_cb_t callback);
 hal_status_t HAL_DMA_RegisterXferErrorCallback(hal_dma_handle_t *hdma, hal_dma_cb_t callback);
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+hal_status_t HAL_DMA_RegisterXferRestartCallback(hal_dma_handle_t *hdma, hal_dma_cb_t callback);
+#endif /* USE_HAL_DMA_LINKEDLIST */
 
 /* Callbacks APIs */
 void HAL_DMA_XferHalfCpltCallback(hal_dma_handle_t *hdma);
@@ -985,6 +998,9 @@ void HAL_DMA_XferCpltCallback(hal_dma_handle_t *hdma);
 void HAL_DMA_XferAbortCallback(hal_dma_handle_t *hdma);
 void HAL_DMA_XferSuspendCallback(hal_dma_handle_t *hdma);
 void HAL_DMA_XferErrorCallback(hal_dma_handle_t *hdma);
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+void HAL_DMA_XferRestartCallback(hal_dma_handle_t *hdma);
+#endif /* USE_HAL_DMA_LINKEDLIST */
 
 #if defined(USE_HAL_DMA_USER_DATA) && (USE_HAL_DMA_USER_DATA == 1)
 void HAL_DMA_SetUserData(hal_dma_handle_t *hdma, const void *p_user_data);
@@ -1067,8 +1083,16 @@ __STATIC_INLINE void HAL_DMA_SetNodeAddress(uint32_t head_node_addr, uint32_t pr
     update_bits |= LL_DMA_UPDATE_CBR2 | LL_DMA_UPDATE_CTR3;
   }
 
-  MODIFY_REG((*(uint32_t *)(prev_node_addr + node_addr_offset)), (update_bits | DMA_CLLR_LA),
-             (next_node_addr & DMA_CLLR_LA) | update_bits);
+  /* An unlinked node gets a null CLLR, so that it ends the list when it is inserted again as the tail */
+  if (next_node_addr == 0U)
+  {
+    CLEAR_BIT((*(uint32_t *)(prev_node_addr + node_addr_offset)), (update_bits | DMA_CLLR_LA));
+  }
+  else
+  {
+    MODIFY_REG((*(uint32_t *)(prev_node_addr + node_addr_offset)), (update_bits | DMA_CLLR_LA),
+               (next_node_addr & DMA_CLLR_LA) | update_bits);
+  }
 }
 
 /**
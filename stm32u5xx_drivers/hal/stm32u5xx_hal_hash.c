@@ -107,6 +107,11 @@ The HASH HAL driver can be used as follows:
        The key and the key size are entered in config API HAL_HASH_HMAC_SetConfig().
        API HAL_HASH_HMAC_Update_DMA() must be called to start hashing and update several input buffers.
        User must resort to HAL_HASH_HMAC_Finish() to retrieve as well the computed digest.
+     - Scatter-gather (USE_HAL_DMA_LINKEDLIST set to 1, input DMA channel in linked-list mode) :
+       The DMA nodes are given once with HAL_HASH_SetInDMANodes().
+       API HAL_HASH_UpdateV_DMA() or HAL_HASH_HMAC_UpdateV_DMA() feeds an array of segments as a single DMA
+       linked-list transfer, with one input completion callback. The segment sizes need not be multiple of 4 bytes.
+       User must resort to HAL_HASH_Finish() or HAL_HASH_HMAC_Finish() to retrieve the computed digest.
 
 6. Switch context:
  - Two APIs are available to suspend HASH or HMAC processing:
@@ -189,6 +194,11 @@ static void HASH_DMAAbort(hal_dma_handle_t *hdma);
 static void HASH_DMAError(hal_dma_handle_t *hdma);
 static hal_status_t HASH_SuspendDMA(hal_hash_handle_t *hhash);
 static hal_status_t HASH_ResumeDMA(hal_hash_handle_t *hhash);
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+static void HASH_DMAXferVCplt(hal_dma_handle_t *hdma);
+static hal_status_t HASH_CheckIOV(const hal_hash_handle_t *hhash, const hal_hash_iovec_t *p_iov, uint32_t iov_cnt);
+static hal_status_t HASH_StartV_DMA(hal_hash_handle_t *hhash, const hal_hash_iovec_t *p_iov, uint32_t iov_cnt);
+#endif /* USE_HAL_DMA_LINKEDLIST */
 #endif /* USE_HAL_HASH_DMA */
 
 static hal_status_t HASH_WriteKey(hal_hash_handle_t *hhash, const uint8_t *p_key, uint32_t key_size_byte);
@@ -213,6 +223,7 @@ static hal_status_t HASH_Write_Data(hal_hash_handle_t *hhash, const uint8_t *p_i
 #define HASH_TIMEOUT_MS                1000U         /*!< Time-out value in millisecond                         */
 #define HASH_BLOCK_SIZE_64B            64U           /*!< block Size equal to 64 bytes                          */
 #define HASH_BLOCK_SIZE_128B           128U          /*!< block Size equal to 128 bytes                         */
+#define HASH_SEGMENT_MAX_BYTE          0xFFFFU       /*!< Largest segment of a DMA linked-list transfer         */
 
 #define HASH_ALGO_MODE_HMAC            HASH_CR_MODE  /*!< HASH HMAC algorithm mode selected                     */
 
@@ -317,6 +328,12 @@ hal_status_t HAL_HASH_Init(hal_hash_handle_t *hhash, hal_hash_t instance)
   hhash->p_user_data = NULL;
 #endif /* USE_HAL_HASH_USER_DATA */
 
+#if defined(USE_HAL_HASH_DMA) && (USE_HAL_HASH_DMA == 1) \
+    && defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+  hhash->p_in_nodes  = NULL;
+  hhash->in_node_nbr = 0U;
+#endif /* USE_HAL_HASH_DMA && USE_HAL_DMA_LINKEDLIST */
+
   hhash->global_state = HAL_HASH_STATE_INIT;
 
   return HAL_OK;
@@ -864,6 +881,63 @@ hal_status_t HAL_HASH_Update_DMA(hal_hash_handle_t *hhash, const void *p_add_inp
 
   return HAL_OK;
 }
+
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+/**
+  * @brief  HASH update process in DMA mode with a list of input segments, as a single transfer.
+  * @param  hhash             Pointer to a hal_hash_handle_t structure.
+  * @param  p_iov             Pointer to the array of segments.
+  * @param  iov_cnt           Number of segments, up to the number of nodes given to HAL_HASH_SetInDMANodes().
+  * @note   The input DMA channel must be configured in linked-list mode with HAL_DMA_SetConfigLinkedListXfer().
+  *         The segments are fed back to back without copy and HAL_HASH_InputCpltCallback() is called once at the
+  *         end of the transfer, or before returning when all the bytes are kept for the next update.
+  * @note   The bytes of a segment not completing a word are joined to the head of the next segment, and the last
+  *         ones are kept for the next update or for HAL_HASH_Finish(), as done by HAL_HASH_Update_DMA().
+  * @note   Each segment holds up to 65535 bytes. The word multiple part of a segment must be aligned on the DMA
+  *         source data width of the nodes: a byte source width accepts segments of any address.
+  * @note   This transfer can not be suspended.
+  * @retval HAL_INVALID_PARAM Invalid parameter.
+  * @retval HAL_ERROR         Input DMA channel not in linked-list mode, nodes not set or DMA error.
+  * @retval HAL_BUSY          Process is already ongoing.
+  * @retval HAL_OK            The transfer of the segments has been started correctly.
+  */
+hal_status_t HAL_HASH_UpdateV_DMA(hal_hash_handle_t *hhash, const hal_hash_iovec_t *p_iov, uint32_t iov_cnt)
+{
+  ASSERT_DBG_PARAM(hhash != NULL);
+  ASSERT_DBG_PARAM(p_iov != NULL);
+  ASSERT_DBG_PARAM(iov_cnt != 0U);
+  ASSERT_DBG_STATE(hhash->global_state, (uint32_t)HAL_HASH_STATE_IDLE);
+
+#if defined(USE_HAL_CHECK_PARAM) && (USE_HAL_CHECK_PARAM == 1) \
+  || defined(USE_HAL_SECURE_CHECK_PARAM) && (USE_HAL_SECURE_CHECK_PARAM == 1)
+  if ((p_iov == NULL) || (iov_cnt == 0U) || (hhash == NULL))
+  {
+    return HAL_INVALID_PARAM;
+  }
+#endif /* USE_HAL_CHECK_PARAM || USE_HAL_SECURE_CHECK_PARAM */
+
+  if ((hhash->hdma_in == NULL) || (hhash->p_in_nodes == NULL)
+      || (hhash->hdma_in->xfer_mode != HAL_DMA_XFER_MODE_LINKEDLIST_LINEAR))
+  {
+    return HAL_ERROR;
+  }
+
+  if (HASH_CheckIOV(hhash, p_iov, iov_cnt) != HAL_OK)
+  {
+    return HAL_INVALID_PARAM;
+  }
+
+  HAL_CHECK_UPDATE_STATE(hhash, global_state, HAL_HASH_STATE_IDLE, HAL_HASH_STATE_ACTIVE);
+
+  if (hhash->phase == HASH_PHASE_READY)
+  {
+    MODIFY_REG(HASH_GET_INSTANCE(hhash)->CR, HASH_CR_INIT | HASH_CR_MODE, HASH_CR_INIT);
+    hhash->phase = HASH_PHASE_PROCESS;
+  }
+
+  return HASH_StartV_DMA(hhash, p_iov, iov_cnt);
+}
+#endif /* USE_HAL_DMA_LINKEDLIST */
 #endif /* USE_HAL_HASH_DMA */
 
 /**
@@ -1537,6 +1611,52 @@ hal_status_t HAL_HASH_HMAC_Update_DMA(hal_hash_handle_t *hhash, const void *p_ad
 
   return HAL_OK;
 }
+
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+/**
+  * @brief HASH HMAC update process in DMA mode with a list of input segments, as a single transfer.
+  * @param hhash              Pointer to a hal_hash_handle_t structure.
+  * @param p_iov              Pointer to the array of segments.
+  * @param iov_cnt            Number of segments, up to the number of nodes given to HAL_HASH_SetInDMANodes().
+  * @note  Same as HAL_HASH_UpdateV_DMA() for the message of the HMAC configured with HAL_HASH_HMAC_SetConfig().
+  *        Wrap-up of input buffers feeding and retrieval of digest is done by a call to HAL_HASH_HMAC_Finish().
+  * @retval HAL_INVALID_PARAM Invalid parameter.
+  * @retval HAL_ERROR         Input DMA channel not in linked-list mode, nodes not set or DMA error.
+  * @retval HAL_BUSY          Process is already ongoing.
+  * @retval HAL_OK            The transfer of the segments has been started correctly.
+  */
+hal_status_t HAL_HASH_HMAC_UpdateV_DMA(hal_hash_handle_t *hhash, const hal_hash_iovec_t *p_iov, uint32_t iov_cnt)
+{
+  ASSERT_DBG_PARAM(hhash != NULL);
+  ASSERT_DBG_PARAM(p_iov != NULL);
+  ASSERT_DBG_PARAM(iov_cnt != 0U);
+
+  ASSERT_DBG_STATE(hhash->global_state, (uint32_t)HAL_HASH_STATE_IDLE);
+
+#if defined(USE_HAL_CHECK_PARAM) && (USE_HAL_CHECK_PARAM == 1) \
+    || defined(USE_HAL_SECURE_CHECK_PARAM) && (USE_HAL_SECURE_CHECK_PARAM == 1)
+  if ((p_iov == NULL) || (iov_cnt == 0U) || (hhash == NULL))
+  {
+    return HAL_INVALID_PARAM;
+  }
+#endif /* USE_HAL_CHECK_PARAM || USE_HAL_SECURE_CHECK_PARAM */
+
+  if ((hhash->hdma_in == NULL) || (hhash->p_in_nodes == NULL)
+      || (hhash->hdma_in->xfer_mode != HAL_DMA_XFER_MODE_LINKEDLIST_LINEAR))
+  {
+    return HAL_ERROR;
+  }
+
+  if (HASH_CheckIOV(hhash, p_iov, iov_cnt) != HAL_OK)
+  {
+    return HAL_INVALID_PARAM;
+  }
+
+  HAL_CHECK_UPDATE_STATE(hhash, global_state, HAL_HASH_STATE_IDLE, HAL_HASH_STATE_ACTIVE);
+
+  return HASH_StartV_DMA(hhash, p_iov, iov_cnt);
+}
+#endif /* USE_HAL_DMA_LINKEDLIST */
 #endif /* USE_HAL_HASH_DMA */
 
 /**
@@ -1777,6 +1897,7 @@ The compilation define USE_HAL_HASH_REGISTER_CALLBACKS when set to 1 allows the
 - Use Function HAL_HASH_RegisterSuspendCpltCallback() to register a user suspend callback.
 - Use Function HAL_HASH_RegisterAbortCpltCallback() to register a user abort callback.
 - Use Function HAL_HASH_SetInDMA() to link the input FIFO HAL DMA handle into the HAL HASH handle.
+- Use Function HAL_HASH_SetInDMANodes() to give the input DMA nodes of the scatter-gather updates.
   */
 /**
   * @brief HASH interrupt request.
@@ -2075,6 +2196,78 @@ hal_status_t HAL_HASH_SetInDMA(hal_hash_handle_t *hhash, hal_dma_handle_t *hdma_
 
   return HAL_OK;
 }
+
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+/**
+  * @brief Set the input DMA nodes used by HAL_HASH_UpdateV_DMA() and HAL_HASH_HMAC_UpdateV_DMA().
+  * @param hhash         Pointer to a hal_hash_handle_t structure.
+  * @param p_nodes       Pointer to an array of HASH DMA nodes, one per segment of the largest update.
+  * @param node_nbr      Number of nodes of the array.
+  * @param p_node_config Pointer to the memory to HASH_DIN transfer configuration applied to all the nodes.
+  * @note  The nodes are configured once here: an update only fills their address and size and links them.
+  *        Their TC event is forced to the end of the linked-list.
+  * @note  The destination data width must be a word. A byte or half-word source width requires the packing of the
+  *        data handling, else each beat is padded into a word of DIN. The nodes must be placed in the same
+  *        64 Kbytes memory area, as required by the DMA linked-list.
+  * @retval HAL_INVALID_PARAM Invalid parameter.
+  * @retval HAL_ERROR         Invalid node configuration.
+  * @retval HAL_OK            The nodes have been correctly set.
+  */
+hal_status_t HAL_HASH_SetInDMANodes(hal_hash_handle_t *hhash, hal_hash_dma_node_t *p_nodes, uint32_t node_nbr,
+                                    const hal_dma_node_config_t *p_node_config)
+{
+  ASSERT_DBG_PARAM(hhash != NULL);
+  ASSERT_DBG_PARAM(p_nodes != NULL);
+  ASSERT_DBG_PARAM(node_nbr != 0U);
+  ASSERT_DBG_PARAM(p_node_config != NULL);
+
+  ASSERT_DBG_STATE(hhash->global_state, (uint32_t)HAL_HASH_STATE_INIT | (uint32_t)HAL_HASH_STATE_IDLE);
+
+#if defined (USE_HAL_CHECK_PARAM) && (USE_HAL_CHECK_PARAM == 1)
+  if ((hhash == NULL) || (p_nodes == NULL) || (node_nbr == 0U) || (p_node_config == NULL))
+  {
+    return HAL_INVALID_PARAM;
+  }
+#endif /* USE_HAL_CHECK_PARAM */
+
+  if ((p_node_config->xfer.dest_data_width != HAL_DMA_DEST_DATA_WIDTH_WORD)
+      || ((p_node_config->xfer.src_data_width != HAL_DMA_SRC_DATA_WIDTH_WORD)
+          && (p_node_config->data_handling.pack != HAL_DMA_DEST_DATA_PACKED_UNPACKED)))
+  {
+    return HAL_ERROR;
+  }
+
+  for (uint32_t i = 0U; i < node_nbr; i++)
+  {
+    if ((HAL_DMA_FillNodeConfig(&p_nodes[i].carry_node, p_node_config, HAL_DMA_NODE_LINEAR_ADDRESSING) != HAL_OK)
+        || (HAL_DMA_FillNodeConfig(&p_nodes[i].data_node, p_node_config, HAL_DMA_NODE_LINEAR_ADDRESSING) != HAL_OK))
+    {
+      return HAL_ERROR;
+    }
+    (void)HAL_DMA_FillNodeXferEventMode(&p_nodes[i].carry_node, HAL_DMA_LINKEDLIST_XFER_EVENT_Q);
+    (void)HAL_DMA_FillNodeXferEventMode(&p_nodes[i].data_node, HAL_DMA_LINKEDLIST_XFER_EVENT_Q);
+  }
+
+  if (p_node_config->xfer.src_data_width == HAL_DMA_SRC_DATA_WIDTH_BYTE)
+  {
+    hhash->in_src_width_byte = 1U;
+  }
+  else if (p_node_config->xfer.src_data_width == HAL_DMA_SRC_DATA_WIDTH_HALFWORD)
+  {
+    hhash->in_src_width_byte = 2U;
+  }
+  else
+  {
+    hhash->in_src_width_byte = 4U;
+  }
+
+  (void)HAL_Q_Init(&hhash->in_q, &HAL_DMA_LinearAddressing_DescOps);
+  hhash->p_in_nodes  = p_nodes;
+  hhash->in_node_nbr = node_nbr;
+
+  return HAL_OK;
+}
+#endif /* USE_HAL_DMA_LINKEDLIST */
 #endif /*USE_HAL_HASH_DMA*/
 /**
   * @}
@@ -2604,6 +2797,200 @@ static void HASH_DMAError(hal_dma_handle_t *hdma)
   HAL_HASH_ErrorCallback(hhash);
 #endif /* USE_HAL_HASH_REGISTER_CALLBACKS */
 }
+
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+/**
+  * @brief DMA HASH Input segments transfer completion callback.
+  * @param hdma DMA handle.
+  */
+static void HASH_DMAXferVCplt(hal_dma_handle_t *hdma)
+{
+  hal_hash_handle_t *hhash = (hal_hash_handle_t *)((hal_dma_handle_t *)hdma)->p_parent;
+
+  if (READ_BIT(HASH_GET_INSTANCE(hhash)->CR, HASH_CR_MODE) != 0U)
+  {
+    hhash->update_flag = 1U;
+  }
+  hhash->global_state = HAL_HASH_STATE_IDLE;
+
+#if defined (USE_HAL_HASH_REGISTER_CALLBACKS ) && (USE_HAL_HASH_REGISTER_CALLBACKS == 1)
+  hhash->p_input_cplt_callback(hhash);
+#else
+  HAL_HASH_InputCpltCallback(hhash);
+#endif /* USE_HAL_HASH_REGISTER_CALLBACKS */
+}
+
+/**
+  * @brief Check the segments of a DMA linked-list update against the input DMA nodes.
+  * @param hhash   Pointer to a hal_hash_handle_t structure.
+  * @param p_iov   Pointer to the array of segments.
+  * @param iov_cnt Number of segments.
+  * @retval HAL_INVALID_PARAM Too many segments, empty or too large segment, or misaligned word multiple part.
+  * @retval HAL_OK            The segments can be transferred.
+  */
+static hal_status_t HASH_CheckIOV(const hal_hash_handle_t *hhash, const hal_hash_iovec_t *p_iov, uint32_t iov_cnt)
+{
+  uint32_t carry_nbr = hhash->remain_bytes_number;
+  uint32_t head_size;
+
+  if (iov_cnt > hhash->in_node_nbr)
+  {
+    return HAL_INVALID_PARAM;
+  }
+
+  for (uint32_t i = 0U; i < iov_cnt; i++)
+  {
+    if ((p_iov[i].p_data == NULL) || (p_iov[i].size_byte == 0U) || (p_iov[i].size_byte > HASH_SEGMENT_MAX_BYTE))
+    {
+      return HAL_INVALID_PARAM;
+    }
+
+    /* The word multiple part starts after the bytes completing the carried ones */
+    head_size = (4U - carry_nbr) % 4U;
+    if ((p_iov[i].size_byte >= (head_size + 4U))
+        && ((((uint32_t)p_iov[i].p_data + head_size) % hhash->in_src_width_byte) != 0U))
+    {
+      return HAL_INVALID_PARAM;
+    }
+    carry_nbr = (carry_nbr + p_iov[i].size_byte) % 4U;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief Link the segments of an update into the input DMA linked-list and start it.
+  * @param hhash   Pointer to a hal_hash_handle_t structure.
+  * @param p_iov   Pointer to the array of segments, checked by HASH_CheckIOV().
+  * @param iov_cnt Number of segments.
+  * @note  Per segment, the carry node feeds the word made of the bytes carried from the previous segments and of
+  *        the segment head, then the data node feeds the word multiple part. The segment tail is carried forward.
+  * @retval HAL_ERROR DMA error.
+  * @retval HAL_OK    Transfer started, or all the bytes carried to the next update.
+  */
+static hal_status_t HASH_StartV_DMA(hal_hash_handle_t *hhash, const hal_hash_iovec_t *p_iov, uint32_t iov_cnt)
+{
+  hal_hash_dma_node_t *p_node;
+  const uint8_t *p_data;
+  uint32_t din_addr = (uint32_t) &(HASH_GET_INSTANCE(hhash)->DIN);
+  uint32_t carry_nbr = hhash->remain_bytes_number;
+  uint32_t carry = 0U;
+  uint32_t size_byte;
+  uint32_t data_size_byte;
+  uint32_t dma_size_byte = 0U;
+
+  for (uint32_t i = 0U; i < carry_nbr; i++)
+  {
+    carry |= ((uint32_t)hhash->remain_bytes[i] << (i * 8U));
+  }
+
+  /* Unlink the nodes of the previous update */
+  HAL_Q_DeInit(&hhash->in_q);
+  (void)HAL_Q_Init(&hhash->in_q, &HAL_DMA_LinearAddressing_DescOps);
+
+  for (uint32_t i = 0U; i < iov_cnt; i++)
+  {
+    p_node    = &hhash->p_in_nodes[i];
+    p_data    = (const uint8_t *)p_iov[i].p_data;
+    size_byte = p_iov[i].size_byte;
+
+    /* Complete the carried bytes with the segment head */
+    if (carry_nbr != 0U)
+    {
+      while ((carry_nbr < 4U) && (size_byte != 0U))
+      {
+        carry |= ((uint32_t)*p_data << (carry_nbr * 8U));
+        p_data++;
+        size_byte--;
+        carry_nbr++;
+      }
+
+      if (carry_nbr == 4U)
+      {
+        p_node->carry_word = carry;
+        (void)HAL_DMA_FillNodeData(&p_node->carry_node, (uint32_t)&p_node->carry_word, din_addr, 4U);
+        if (HAL_Q_InsertNode_Tail(&hhash->in_q, &p_node->carry_node) != HAL_OK)
+        {
+          hhash->global_state = HAL_HASH_STATE_IDLE;
+          return HAL_ERROR;
+        }
+        dma_size_byte += 4U;
+        carry          = 0U;
+        carry_nbr      = 0U;
+      }
+    }
+
+    data_size_byte = size_byte & ~3U;
+    if (data_size_byte != 0U)
+    {
+      (void)HAL_DMA_FillNodeData(&p_node->data_node, (uint32_t)p_data, din_addr, data_size_byte);
+      if (HAL_Q_InsertNode_Tail(&hhash->in_q, &p_node->data_node) != HAL_OK)
+      {
+        hhash->global_state = HAL_HASH_STATE_IDLE;
+        return HAL_ERROR;
+      }
+      dma_size_byte += data_size_byte;
+    }
+
+    /* Carry the segment tail */
+    for (uint32_t j = data_size_byte; j < size_byte; j++)
+    {
+      carry |= ((uint32_t)p_data[j] << (carry_nbr * 8U));
+      carry_nbr++;
+    }
+  }
+
+  hhash->p_input_buff          = (const uint8_t *)p_iov[0].p_data;
+  hhash->input_size_byte       = dma_size_byte + carry_nbr;
+  hhash->input_data_count_byte = dma_size_byte;
+
+  /* Keep the bytes not completing a word for the next update or the finish */
+  for (uint32_t i = 0U; i < carry_nbr; i++)
+  {
+    hhash->remain_bytes[i] = (uint8_t)(carry >> (i * 8U));
+  }
+  hhash->remain_bytes_number = (uint8_t)carry_nbr;
+
+  if (dma_size_byte != 0U)
+  {
+    hhash->dma_operation_active = 1U;
+
+    hhash->hdma_in->p_xfer_cplt_cb  = HASH_DMAXferVCplt;
+    hhash->hdma_in->p_xfer_error_cb = HASH_DMAError;
+    hhash->hdma_in->p_xfer_abort_cb = HASH_DMAAbort;
+
+    /* Intermediate transfer: no digest calculation at the end of the DMA transfer */
+    SET_BIT(HASH_GET_INSTANCE(hhash)->CR, HASH_CR_MDMAT);
+    MODIFY_REG(HASH_GET_INSTANCE(hhash)->STR, HASH_STR_NBLW, 0U);
+    SET_BIT(HASH_GET_INSTANCE(hhash)->CR, HASH_CR_DMAE);
+
+    if (HAL_DMA_StartLinkedListXfer_IT_Opt(hhash->hdma_in, &hhash->in_q, HAL_DMA_OPT_IT_NONE) != HAL_OK)
+    {
+#if defined(USE_HAL_HASH_GET_LAST_ERRORS) && (USE_HAL_HASH_GET_LAST_ERRORS == 1)
+      hhash->last_error_codes |= HAL_HASH_ERROR_DMA;
+#endif /* USE_HAL_HASH_GET_LAST_ERRORS */
+      hhash->global_state = HAL_HASH_STATE_IDLE;
+      return HAL_ERROR;
+    }
+  }
+  else
+  {
+    if (READ_BIT(HASH_GET_INSTANCE(hhash)->CR, HASH_CR_MODE) != 0U)
+    {
+      hhash->update_flag = 1U;
+    }
+    hhash->global_state = HAL_HASH_STATE_IDLE;
+
+#if defined (USE_HAL_HASH_REGISTER_CALLBACKS ) && (USE_HAL_HASH_REGISTER_CALLBACKS == 1)
+    hhash->p_input_cplt_callback(hhash);
+#else
+    HAL_HASH_InputCpltCallback(hhash);
+#endif /* USE_HAL_HASH_REGISTER_CALLBACKS */
+  }
+
+  return HAL_OK;
+}
+#endif /* USE_HAL_DMA_LINKEDLIST */
 #endif /* USE_HAL_HASH_DMA */
 
 /**
@@ -3568,6 +3955,14 @@ static hal_status_t HASH_SuspendDMA(hal_hash_handle_t *hhash)
   uint32_t remaining_words; /*remaining number in of source block to be transferred.*/
   uint32_t size_in_words;   /* number in word of source block to be transferred.*/
 
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+  /* The remaining words of a linked-list transfer can not be retrieved from the current block */
+  if (hhash->hdma_in->xfer_mode != HAL_DMA_XFER_MODE_DIRECT)
+  {
+    return HAL_ERROR;
+  }
+#endif /* USE_HAL_DMA_LINKEDLIST */
+
   /* Clear the DMAE bit to disable the DMA interface */
   CLEAR_BIT(HASH_GET_INSTANCE(hhash)->CR, HASH_CR_DMAE);
 
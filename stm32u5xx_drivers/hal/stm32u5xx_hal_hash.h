@@ -147,6 +147,24 @@ typedef struct
 
 typedef struct hal_hash_handle_s hal_hash_handle_t; /*!< HASH handle Structure type */
 
+#if defined(USE_HAL_HASH_DMA) && (USE_HAL_HASH_DMA == 1U) \
+    && defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+/*! HASH input segment, see HAL_HASH_UpdateV_DMA() */
+typedef struct
+{
+  const void *p_data;    /*!< Pointer to the segment data  */
+  uint32_t   size_byte;  /*!< Size of the segment in bytes */
+} hal_hash_iovec_t;
+
+/*! HASH input DMA node, one per segment of HAL_HASH_UpdateV_DMA() */
+typedef struct
+{
+  hal_dma_node_t carry_node;  /*!< DMA node of the word joining the previous bytes to the segment head */
+  hal_dma_node_t data_node;   /*!< DMA node of the word multiple part of the segment                   */
+  uint32_t       carry_word;  /*!< Word joining the previous bytes to the segment head                 */
+} hal_hash_dma_node_t;
+#endif /* USE_HAL_HASH_DMA && USE_HAL_DMA_LINKEDLIST */
+
 #if defined (USE_HAL_HASH_REGISTER_CALLBACKS) && (USE_HAL_HASH_REGISTER_CALLBACKS == 1)
 typedef void (*hal_hash_cb_t)(hal_hash_handle_t *hhash); /*!< HAL HASH Callback pointer definition */
 #endif /* USE_HAL_HASH_REGISTER_CALLBACKS */
@@ -242,6 +260,12 @@ struct hal_hash_handle_s
 
 #if defined(USE_HAL_HASH_DMA) && (USE_HAL_HASH_DMA == 1U)
   hal_dma_handle_t           *hdma_in;                 /*!< HASH In DMA handle parameters               */
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+  hal_q_t                     in_q;                    /*!< HASH In DMA linked-list of segments         */
+  hal_hash_dma_node_t        *p_in_nodes;              /*!< HASH In DMA nodes, one per segment          */
+  uint32_t                    in_node_nbr;             /*!< Number of HASH In DMA nodes                 */
+  uint32_t                    in_src_width_byte;       /*!< HASH In DMA nodes source data width         */
+#endif /* USE_HAL_DMA_LINKEDLIST */
 #endif /* USE_HAL_HASH_DMA */
 
 #if defined (USE_HAL_HASH_USER_DATA) && (USE_HAL_HASH_USER_DATA == 1)
@@ -303,6 +327,9 @@ hal_status_t HAL_HASH_Update_IT(hal_hash_handle_t *hhash, const void *p_add_inpu
 #if defined (USE_HAL_HASH_DMA) && (USE_HAL_HASH_DMA == 1)
 hal_status_t HAL_HASH_Update_DMA(hal_hash_handle_t *hhash, const void *p_add_input_buffer,
                                  uint32_t input_size_byte);
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+hal_status_t HAL_HASH_UpdateV_DMA(hal_hash_handle_t *hhash, const hal_hash_iovec_t *p_iov, uint32_t iov_cnt);
+#endif /* USE_HAL_DMA_LINKEDLIST */
 #endif /* USE_HAL_HASH_DMA */
 
 hal_status_t HAL_HASH_Finish(hal_hash_handle_t *hhash, void *p_output_buffer, uint32_t *p_output_size_byte,
@@ -341,6 +368,9 @@ hal_status_t HAL_HASH_HMAC_Update_IT(hal_hash_handle_t *hhash, const void *p_add
 #if defined (USE_HAL_HASH_DMA) && (USE_HAL_HASH_DMA == 1)
 hal_status_t HAL_HASH_HMAC_Update_DMA(hal_hash_handle_t *hhash, const void *p_add_input_buffer,
                                       uint32_t input_size_byte);
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+hal_status_t HAL_HASH_HMAC_UpdateV_DMA(hal_hash_handle_t *hhash, const hal_hash_iovec_t *p_iov, uint32_t iov_cnt);
+#endif /* USE_HAL_DMA_LINKEDLIST */
 #endif /* USE_HAL_HASH_DMA */
 
 hal_status_t HAL_HASH_HMAC_Finish(hal_hash_handle_t *hhash, void *p_output_buffer, uint32_t *p_output_size_byte,
@@ -378,6 +408,10 @@ hal_status_t HAL_HASH_RegisterAbortCpltCallback(hal_hash_handle_t *hhash, hal_ha
 
 #if defined (USE_HAL_HASH_DMA) && (USE_HAL_HASH_DMA == 1)
 hal_status_t HAL_HASH_SetInDMA(hal_hash_handle_t *hhash, hal_dma_handle_t *hdma_in);
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+hal_status_t HAL_HASH_SetInDMANodes(hal_hash_handle_t *hhash, hal_hash_dma_node_t *p_nodes, uint32_t node_nbr,
+                                    const hal_dma_node_config_t *p_node_config);
+#endif /* USE_HAL_DMA_LINKEDLIST */
 #endif /* USE_HAL_HASH_DMA */
 /**
   * @}
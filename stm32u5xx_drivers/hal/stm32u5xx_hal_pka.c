@@ -63,6 +63,8 @@ This file provides firmware functions to manage the following functionalities of
 - Use HAL_PKA_SetConfigModExp() function to configure the Modular exponentiation operating mode.
 - Use HAL_PKA_SetConfigModExpFast() function to configure the Modular exponentiation (fast) operating mode.
 - Use HAL_PKA_SetConfigModExpProtect() function to configure the Modular exponentiation (protected) operating mode.
+- Use HAL_PKA_UpdateModExp() function to load the operand and exponent of a Modular exponentiation, keeping the modulus
+  loaded by the previous one.
 - Use HAL_PKA_SetConfigAdd() function to configure the Arithmetic addition operating mode.
 - Use HAL_PKA_SetConfigSub() function to configure the Arithmetic subtraction operating mode.
 - Use HAL_PKA_SetConfigCmp() function to configure the Arithmetic comparison operating mode.
@@ -77,11 +79,15 @@ This file provides firmware functions to manage the following functionalities of
   mode.
 - Use HAL_PKA_ECDSA_SetConfigVerifSignature() function to configure the elliptic curves over prime fields verification
   operating mode.
+- Use HAL_PKA_ECDSA_UpdateVerifSignature() function to load the public key, signature and hash of a verification,
+  keeping the curve parameters loaded by the previous one.
 - Use HAL_PKA_RSA_SetConfigCRTExp() function to configure the RSA CRT exponentiation operating mode.
 - Use HAL_PKA_RSA_SetConfigSignature() function to configure the RSA signature operating mode.
 - Use HAL_PKA_RSA_SetConfigVerifSignature() function to configure the RSA verification operating mode.
 - Use HAL_PKA_ECC_SetConfigPointCheck() function to configure the Point on elliptic curve check operating mode.
 - Use HAL_PKA_ECC_SetConfigMul() function to configure the ECC scalar multiplication operating mode.
+- Use HAL_PKA_ECC_UpdateMul() function to load the scalar and point of an ECC scalar multiplication, keeping the curve
+  parameters loaded by the previous one.
 - Use HAL_PKA_ECC_SetConfigDoubleBaseLadder() function to configure the ECC double base ladder operating mode.
 - Use HAL_PKA_ECC_SetConfigProjectiveToAffine() function to configure the ECC projective to affine operating mode.
 - Use HAL_PKA_ECC_SetConfigCompleteAdd() function to configure the ECC complete addition operating mode.
@@ -315,6 +321,8 @@ This sub-section provides a set of functions allowing to configure the PKA opera
 - Call the function HAL_PKA_SetConfigModExp() to configure the Modular exponentiation operation.
 - Call the function HAL_PKA_SetConfigModExpFast() to configure the Modular exponentiation (fast) operation.
 - Call the function HAL_PKA_SetConfigModExpProtect() to configure the Modular exponentiation (protected) operation.
+- Call the function HAL_PKA_UpdateModExp() to load the operands of a Modular exponentiation sharing the modulus of the
+  previous one.
 
   PKA arithmetic configuration functions
 
@@ -341,11 +349,15 @@ This sub-section provides a set of functions allowing to configure the PKA opera
   operation.
 - Call the function HAL_PKA_ECDSA_SetConfigVerifSignature() to configure the elliptic curves over prime fields
   verification operation.
+- Call the function HAL_PKA_ECDSA_UpdateVerifSignature() to load the operands of a verification sharing the curve of
+  the previous one.
 
   PKA ECC configuration functions
 
 - Call the function HAL_PKA_ECC_SetConfigPointCheck() to configure the Point on elliptic curve check operation.
 - Call the function HAL_PKA_ECC_SetConfigMul() to configure the ECC scalar multiplication operation.
+- Call the function HAL_PKA_ECC_UpdateMul() to load the operands of an ECC scalar multiplication sharing the curve of
+  the previous one.
 - Call the function HAL_PKA_ECC_SetConfigDoubleBaseLadder() to configure the ECC double base ladder operation.
 - Call the function HAL_PKA_ECC_SetConfigProjectiveToAffine() to configure the ECC projective to affine operation.
 - Call the function HAL_PKA_ECC_SetConfigCompleteAdd() to configure the ECC complete addition operation.
@@ -415,6 +427,65 @@ hal_status_t HAL_PKA_SetConfigModExp(hal_pka_handle_t *hpka, const hal_pka_mod_e
   return HAL_OK;
 }
 
+/**
+  * @brief  Load the operand and exponent of a Modular exponentiation sharing the modulus of the previous one.
+  * @param  hpka              Pointer to @ref hal_pka_handle_t PKA handle.
+  * @param  p_config          Pointer to @ref hal_pka_mod_exp_config_t configuration structure. p_modulus is not read.
+  * @note   The modulus and operand size are the ones written by the last HAL_PKA_SetConfigModExp() call. Only
+  *         Modular exponentiations are to be performed since, the PKA RAM keeping the modulus between them.
+  * @retval HAL_INVALID_PARAM Invalid parameter return when p_config pointer is NULL.
+  * @retval HAL_ERROR         PKA is not enabled in Modular exponentiation mode.
+  * @retval HAL_OK            Modular exponentiation is successfully configured.
+  */
+hal_status_t HAL_PKA_UpdateModExp(hal_pka_handle_t *hpka, const hal_pka_mod_exp_config_t *p_config)
+{
+  ASSERT_DBG_PARAM(hpka != NULL);
+  ASSERT_DBG_PARAM(p_config != NULL);
+  ASSERT_DBG_PARAM(p_config->p_exponent != NULL);
+  ASSERT_DBG_PARAM(p_config->p_operand != NULL);
+  ASSERT_DBG_PARAM(p_config->exponent_size_byte != 0U);
+  ASSERT_DBG_PARAM(p_config->operand_size_byte != 0U);
+
+  ASSERT_DBG_STATE(hpka->global_state, HAL_PKA_STATE_INIT);
+
+#if (defined(USE_HAL_CHECK_PARAM) && (USE_HAL_CHECK_PARAM == 1)) \
+  || (defined(USE_HAL_SECURE_CHECK_PARAM) && (USE_HAL_SECURE_CHECK_PARAM == 1))
+  if ((p_config == NULL) || (p_config->p_exponent == NULL) || (p_config->p_operand == NULL) \
+      || (p_config->exponent_size_byte == 0U) || (p_config->operand_size_byte == 0U))
+  {
+    return HAL_INVALID_PARAM;
+  }
+#endif /* USE_HAL_CHECK_PARAM or USE_HAL_SECURE_CHECK_PARAM */
+
+#if defined(USE_HAL_SECURE_CHECK_PARAM) && (USE_HAL_SECURE_CHECK_PARAM == 1)
+  if (hpka == NULL)
+  {
+    return HAL_INVALID_PARAM;
+  }
+#endif /* USE_HAL_SECURE_CHECK_PARAM */
+
+  if ((LL_PKA_IsEnabled(PKA_GET_INSTANCE(hpka)) == 0U)
+      || (LL_PKA_GetMode(PKA_GET_INSTANCE(hpka)) != LL_PKA_MODE_MODULAR_EXP))
+  {
+    return HAL_ERROR;
+  }
+
+  PKA_RAM_WORD_ACCESS(hpka, PKA_MODULAR_EXP_IN_EXP_NB_BITS) = p_config->exponent_size_byte * 8UL;
+  PKA_Memcpy_u8_to_u32(&PKA_RAM_WORD_ACCESS(hpka, PKA_MODULAR_EXP_IN_EXPONENT_BASE),
+                       p_config->p_operand, p_config->operand_size_byte);
+  PKA_Memcpy_u8_to_u32(&PKA_RAM_WORD_ACCESS(hpka, PKA_MODULAR_EXP_IN_EXPONENT),
+                       p_config->p_exponent, p_config->exponent_size_byte);
+
+#if defined(USE_HAL_PKA_GET_LAST_ERRORS) && (USE_HAL_PKA_GET_LAST_ERRORS == 1)
+  hpka->last_error_codes = HAL_PKA_ERROR_NONE;
+#endif /* USE_HAL_PKA_GET_LAST_ERRORS */
+
+  hpka->operation    = PKA_OPERATION_NO_ERROR_OFFSET;
+  hpka->global_state = HAL_PKA_STATE_IDLE;
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Set the Modular exponentiation (fast) Mode configuration.
   * @param  hpka              Pointer to @ref hal_pka_handle_t PKA handle.
@@ -732,6 +803,77 @@ hal_status_t HAL_PKA_ECDSA_SetConfigVerifSignature(hal_pka_handle_t *hpka, const
   return HAL_OK;
 }
 
+/**
+  * @brief  Load the public key, signature and hash of a verification of a signature sharing the curve of the previous
+  *         one.
+  * @param  hpka              Pointer to @ref hal_pka_handle_t PKA handle.
+  * @param  p_config          Pointer to @ref hal_pka_ecdsa_verif_config_t configuration structure. Only the public key,
+  *                           signature and hash are read, with prime_order_size_byte and modulus_size_byte.
+  * @note   The curve parameters are the ones written by the last HAL_PKA_ECDSA_SetConfigVerifSignature() call. Only
+  *         verifications are to be performed since, the PKA RAM keeping the curve parameters between them.
+  * @retval HAL_INVALID_PARAM Invalid parameter return when p_config pointer is NULL.
+  * @retval HAL_ERROR         PKA is not enabled in ECDSA verification mode.
+  * @retval HAL_OK            The verification of signature validity is successfully configured.
+  */
+hal_status_t HAL_PKA_ECDSA_UpdateVerifSignature(hal_pka_handle_t *hpka, const hal_pka_ecdsa_verif_config_t *p_config)
+{
+  ASSERT_DBG_PARAM(hpka != NULL);
+  ASSERT_DBG_PARAM(p_config != NULL);
+  ASSERT_DBG_PARAM(p_config->p_r_sign != NULL);
+  ASSERT_DBG_PARAM(p_config->p_s_sign != NULL);
+  ASSERT_DBG_PARAM(p_config->p_hash != NULL);
+  ASSERT_DBG_PARAM(p_config->p_pub_key_curve_pt_x != NULL);
+  ASSERT_DBG_PARAM(p_config->p_pub_key_curve_pt_y != NULL);
+  ASSERT_DBG_PARAM(p_config->prime_order_size_byte != 0U);
+  ASSERT_DBG_PARAM(p_config->modulus_size_byte != 0U);
+
+  ASSERT_DBG_STATE(hpka->global_state, HAL_PKA_STATE_INIT);
+
+#if (defined(USE_HAL_CHECK_PARAM) && (USE_HAL_CHECK_PARAM == 1)) \
+  || (defined(USE_HAL_SECURE_CHECK_PARAM) && (USE_HAL_SECURE_CHECK_PARAM == 1))
+  if ((p_config == NULL) || (p_config->p_hash == NULL) || (p_config->p_r_sign == NULL)                       \
+      || (p_config->p_s_sign == NULL) || (p_config->p_pub_key_curve_pt_x == NULL)                            \
+      || (p_config->p_pub_key_curve_pt_y == NULL) || (p_config->prime_order_size_byte == 0U)                 \
+      || (p_config->modulus_size_byte == 0U))
+  {
+    return HAL_INVALID_PARAM;
+  }
+#endif /* USE_HAL_CHECK_PARAM or USE_HAL_SECURE_CHECK_PARAM */
+
+#if defined(USE_HAL_SECURE_CHECK_PARAM) && (USE_HAL_SECURE_CHECK_PARAM == 1)
+  if (hpka == NULL)
+  {
+    return HAL_INVALID_PARAM;
+  }
+#endif /* USE_HAL_SECURE_CHECK_PARAM */
+
+  if ((LL_PKA_IsEnabled(PKA_GET_INSTANCE(hpka)) == 0U)
+      || (LL_PKA_GetMode(PKA_GET_INSTANCE(hpka)) != LL_PKA_MODE_ECDSA_VERIFICATION))
+  {
+    return HAL_ERROR;
+  }
+
+  PKA_Memcpy_u8_to_u32(&PKA_RAM_WORD_ACCESS(hpka, PKA_ECDSA_VERIF_IN_PUBLIC_KEY_POINT_X),
+                       p_config->p_pub_key_curve_pt_x, p_config->modulus_size_byte);
+  PKA_Memcpy_u8_to_u32(&PKA_RAM_WORD_ACCESS(hpka, PKA_ECDSA_VERIF_IN_PUBLIC_KEY_POINT_Y),
+                       p_config->p_pub_key_curve_pt_y, p_config->modulus_size_byte);
+  PKA_Memcpy_u8_to_u32(&PKA_RAM_WORD_ACCESS(hpka, PKA_ECDSA_VERIF_IN_SIGNATURE_R), p_config->p_r_sign,
+                       p_config->prime_order_size_byte);
+  PKA_Memcpy_u8_to_u32(&PKA_RAM_WORD_ACCESS(hpka, PKA_ECDSA_VERIF_IN_SIGNATURE_S), p_config->p_s_sign,
+                       p_config->prime_order_size_byte);
+  PKA_Memcpy_u8_to_u32(&PKA_RAM_WORD_ACCESS(hpka, PKA_ECDSA_VERIF_IN_HASH_E), p_config->p_hash,
+                       p_config->prime_order_size_byte);
+
+#if defined(USE_HAL_PKA_GET_LAST_ERRORS) && (USE_HAL_PKA_GET_LAST_ERRORS == 1)
+  hpka->last_error_codes = HAL_PKA_ERROR_NONE;
+#endif /* USE_HAL_PKA_GET_LAST_ERRORS */
+
+  hpka->operation    = PKA_OPERATION_NO_ERROR_OFFSET;
+  hpka->global_state = HAL_PKA_STATE_IDLE;
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Set the RSA CRT exponentiation configuration.
   * @param  hpka              Pointer to @ref hal_pka_handle_t PKA handle.
@@ -1669,6 +1811,69 @@ hal_status_t HAL_PKA_ECC_SetConfigMul(hal_pka_handle_t *hpka, const hal_pka_ecc_
   return HAL_OK;
 }
 
+/**
+  * @brief  Load the scalar and point of an ECC scalar multiplication sharing the curve of the previous one.
+  * @param  hpka              Pointer to @ref hal_pka_handle_t PKA handle.
+  * @param  p_config          Pointer to @ref hal_pka_ecc_mul_config_t configuration structure. Only the scalar and
+  *                           point are read, with scalar_mul_size_byte and modulus_size_byte.
+  * @note   The curve parameters are the ones written by the last HAL_PKA_ECC_SetConfigMul() call. Only ECC scalar
+  *         multiplications are to be performed since, the PKA RAM keeping the curve parameters between them.
+  * @retval HAL_INVALID_PARAM Invalid parameter return when p_config pointer is NULL.
+  * @retval HAL_ERROR         PKA is not enabled in ECC scalar multiplication mode.
+  * @retval HAL_OK            ECC scalar multiplication is successfully configured.
+  */
+hal_status_t HAL_PKA_ECC_UpdateMul(hal_pka_handle_t *hpka, const hal_pka_ecc_mul_config_t *p_config)
+{
+  ASSERT_DBG_PARAM(hpka != NULL);
+  ASSERT_DBG_PARAM(p_config != NULL);
+  ASSERT_DBG_PARAM(p_config->p_scalar_mul != NULL);
+  ASSERT_DBG_PARAM(p_config->p_pt_x != NULL);
+  ASSERT_DBG_PARAM(p_config->p_pt_y != NULL);
+  ASSERT_DBG_PARAM(p_config->modulus_size_byte != 0U);
+  ASSERT_DBG_PARAM(p_config->scalar_mul_size_byte != 0U);
+
+  ASSERT_DBG_STATE(hpka->global_state, HAL_PKA_STATE_INIT);
+
+#if (defined(USE_HAL_CHECK_PARAM) && (USE_HAL_CHECK_PARAM == 1)) \
+  || (defined(USE_HAL_SECURE_CHECK_PARAM) && (USE_HAL_SECURE_CHECK_PARAM == 1))
+  if ((p_config == NULL) || (p_config->p_scalar_mul == NULL) || (p_config->p_pt_x == NULL)     \
+      || (p_config->p_pt_y == NULL) || (p_config->modulus_size_byte == 0U)                     \
+      || (p_config->scalar_mul_size_byte == 0U))
+  {
+    return HAL_INVALID_PARAM;
+  }
+#endif /* USE_HAL_CHECK_PARAM or USE_HAL_SECURE_CHECK_PARAM */
+
+#if defined(USE_HAL_SECURE_CHECK_PARAM) && (USE_HAL_SECURE_CHECK_PARAM == 1)
+  if (hpka == NULL)
+  {
+    return HAL_INVALID_PARAM;
+  }
+#endif /* USE_HAL_SECURE_CHECK_PARAM */
+
+  if ((LL_PKA_IsEnabled(PKA_GET_INSTANCE(hpka)) == 0U)
+      || (LL_PKA_GetMode(PKA_GET_INSTANCE(hpka)) != LL_PKA_MODE_ECC_MUL))
+  {
+    return HAL_ERROR;
+  }
+
+  PKA_Memcpy_u8_to_u32(&PKA_RAM_WORD_ACCESS(hpka, PKA_ECC_SCALAR_MUL_IN_K), p_config->p_scalar_mul,
+                       p_config->scalar_mul_size_byte);
+  PKA_Memcpy_u8_to_u32(&PKA_RAM_WORD_ACCESS(hpka, PKA_ECC_SCALAR_MUL_IN_INITIAL_POINT_X), p_config->p_pt_x,
+                       p_config->modulus_size_byte);
+  PKA_Memcpy_u8_to_u32(&PKA_RAM_WORD_ACCESS(hpka, PKA_ECC_SCALAR_MUL_IN_INITIAL_POINT_Y), p_config->p_pt_y,
+                       p_config->modulus_size_byte);
+
+#if defined(USE_HAL_PKA_GET_LAST_ERRORS) && (USE_HAL_PKA_GET_LAST_ERRORS == 1)
+  hpka->last_error_codes = HAL_PKA_ERROR_NONE;
+#endif /* USE_HAL_PKA_GET_LAST_ERRORS */
+
+  hpka->operation    = PKA_OPERATION_ECC_SCALAR_MUL_ERROR_OFFSET;
+  hpka->global_state = HAL_PKA_STATE_IDLE;
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Set ECC double base ladder Configuration.
   * @param  hpka              Pointer to @ref hal_pka_handle_t PKA handle.
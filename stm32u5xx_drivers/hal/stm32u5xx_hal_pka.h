@@ -438,6 +438,7 @@ void         HAL_PKA_DeInit(hal_pka_handle_t *hpka);
 hal_status_t HAL_PKA_SetConfigModExp(hal_pka_handle_t *hpka, const hal_pka_mod_exp_config_t *p_config);
 hal_status_t HAL_PKA_SetConfigModExpFast(hal_pka_handle_t *hpka, const hal_pka_mod_exp_fast_config_t *p_config);
 hal_status_t HAL_PKA_SetConfigModExpProtect(hal_pka_handle_t *hpka, const hal_pka_mod_exp_protect_config_t *p_config);
+hal_status_t HAL_PKA_UpdateModExp(hal_pka_handle_t *hpka, const hal_pka_mod_exp_config_t *p_config);
 hal_status_t HAL_PKA_SetConfigAdd(hal_pka_handle_t *hpka, const hal_pka_add_config_t *p_config);
 hal_status_t HAL_PKA_SetConfigSub(hal_pka_handle_t *hpka, const hal_pka_sub_config_t *p_config);
 hal_status_t HAL_PKA_SetConfigCmp(hal_pka_handle_t *hpka, const hal_pka_cmp_config_t *p_config);
@@ -456,9 +457,11 @@ hal_status_t HAL_PKA_RSA_SetConfigVerifSignature(hal_pka_handle_t *hpka, const h
 hal_status_t HAL_PKA_ECDSA_SetConfigSignature(hal_pka_handle_t *hpka, const hal_pka_ecdsa_signature_config_t *p_config);
 hal_status_t HAL_PKA_ECDSA_SetConfigVerifSignature(hal_pka_handle_t *hpka,
                                                    const hal_pka_ecdsa_verif_config_t *p_config);
+hal_status_t HAL_PKA_ECDSA_UpdateVerifSignature(hal_pka_handle_t *hpka, const hal_pka_ecdsa_verif_config_t *p_config);
 /* PKA ECC configuration functions */
 hal_status_t HAL_PKA_ECC_SetConfigPointCheck(hal_pka_handle_t *hpka, const hal_pka_point_check_config_t *p_config);
 hal_status_t HAL_PKA_ECC_SetConfigMul(hal_pka_handle_t *hpka, const hal_pka_ecc_mul_config_t *p_config);
+hal_status_t HAL_PKA_ECC_UpdateMul(hal_pka_handle_t *hpka, const hal_pka_ecc_mul_config_t *p_config);
 hal_status_t HAL_PKA_ECC_SetConfigDoubleBaseLadder(hal_pka_handle_t *hpka,
                                                    const hal_pka_ecc_double_base_ladder_config_t *p_config);
 hal_status_t HAL_PKA_ECC_SetConfigProjectiveToAffine(hal_pka_handle_t *hpka,
@@ -44,7 +44,7 @@ In order to build Q(s) compatible with different linked-list masters, this modul
 This module supports singly linked-list Q nodes.
 The behavior of this module is not granted when a Q is modified outside this module.
 
-This module provides 6 different set of APIs that allows to :
+This module provides 7 different set of APIs that allows to :
 
 1. Initialize and de-initialize the logical Q object :
    - Initialize the logical Q object thanks to a set of information provided by any HAL peripheral module that supports
@@ -126,6 +126,16 @@ This module provides 6 different set of APIs that allows to :
    - Clear a circular link from a Q.
      - This functionality is ensured by HAL_Q_ClearCircularLinkQ() function.
 
+7. Build and edit large Qs :
+   - Link a contiguous array of nodes at the tail of a Q in one pass thanks to HAL_Q_BuildFromArray() function.
+   - The nodes given as position to HAL_Q_InsertNode(), HAL_Q_InsertQ() and HAL_Q_SetCircularLinkQ() are searched in
+     the Q, as well as the node addresses checked in base offset addressing mode. These walks through the Q are skipped
+     when USE_HAL_Q_CHECK_NODES is set to 0: the application is then responsible of the nodes given to this module.
+   - Removing or replacing a node other than the head node requires its previous node, found by walking through the
+     singly linked Q. When USE_HAL_Q_SHADOW_INDEX is set to 1, HAL_Q_SetShadowIndex() associates to the Q a table
+     holding the previous node of each node of a node array, so that these nodes are removed or replaced in constant
+     time. Nodes out of the array are still searched in the Q.
+
 ## Configuration inside the Q module
 
 Config defines           | Description     | Default value | Note
@@ -134,6 +144,8 @@ USE_ASSERT_DBG_PARAM     | from IDE        |     None      | When defined, enabl
 USE_HAL_CHECK_PARAM      | from hal_conf.h |     0U        | It allows to use the run-time checks on parameters.
 USE_HAL_{PPP}_LINKEDLIST | from hal_conf.h |     0U        | It allows to use the PPP in linked-list mode.
 USE_HAL_Q_CIRCULAR_LINK  | from hal_ppp.h  |     0U        | It allows to use circular link queue.
+USE_HAL_Q_CHECK_NODES    | from hal_conf.h |     1U        | It allows to check the nodes by walking through the Q.
+USE_HAL_Q_SHADOW_INDEX   | from hal_conf.h |     0U        | It allows to index the previous node of a node array.
   */
 
 #if (defined(USE_HAL_Q_DIRECT_ADDR_MODE) && (USE_HAL_Q_DIRECT_ADDR_MODE == 1)) \
@@ -177,6 +189,9 @@ static void Q_UnlinkNodes(hal_q_t *p_q, uint32_t head_node_addr);
 static void Q_ResetInfo(hal_q_t *p_q);
 static hal_status_t Q_FindNode(const hal_q_t *p_q, uint32_t head_node_addr, uint32_t node_addr,
                                uint32_t *p_prev_node_addr);
+static hal_status_t Q_FindPrevNode(const hal_q_t *p_q, uint32_t node_addr, uint32_t *p_prev_node_addr);
+static void Q_SetPrevNode(const hal_q_t *p_q, uint32_t node_addr, uint32_t prev_node_addr);
+static void Q_SetPrevNodes(const hal_q_t *p_q, uint32_t node_addr, uint32_t prev_node_addr, uint32_t node_nbr);
 #if (USE_HAL_Q_BASE_OFFSET_ADDR_MODE) && (USE_HAL_Q_BASE_OFFSET_ADDR_MODE == 1)
 static void Q_FormatBaseOffsetNodes(const hal_q_t *p_q, uint32_t node, q_operation_t node_operation);
 static void Q_FormatBaseOffsetQ(const hal_q_t *p_dest_q, const hal_q_t *p_src_q, uint32_t node,
@@ -230,6 +245,9 @@ hal_status_t HAL_Q_Init(hal_q_t *p_q, const hal_q_desc_ops_t *p_desc_ops)
   p_q->node_nbr              = 0U;
   p_q->p_set_node            = p_desc_ops->p_set_node;
   p_q->p_get_node            = p_desc_ops->p_get_node;
+#if defined(USE_HAL_Q_SHADOW_INDEX) && (USE_HAL_Q_SHADOW_INDEX == 1U)
+  p_q->p_prev_index          = NULL;
+#endif /* USE_HAL_Q_SHADOW_INDEX */
 
   return HAL_OK;
 }
@@ -250,6 +268,57 @@ void HAL_Q_DeInit(hal_q_t *p_q)
 
   p_q->p_head_node = NULL;
 }
+
+#if defined(USE_HAL_Q_SHADOW_INDEX) && (USE_HAL_Q_SHADOW_INDEX == 1U)
+/**
+  * @brief  Associate a shadow index to the Q, holding the previous node of each node of a node array.
+  * @param  p_q               Pointer to a hal_q_t structure that contains Q information.
+  * @param  p_nodes           Pointer to the first node of the node array, NULL to remove the shadow index.
+  * @param  node_size_byte    Size in byte of a node of the array.
+  * @param  node_nbr          Number of nodes of the array.
+  * @param  p_prev_index      Pointer to a table of node_nbr entries, owned by the Q until the shadow index is removed.
+  * @note   The nodes of the array already in the Q are indexed. Then the index is updated by all the Q operations,
+  *         so that the nodes of the array are removed or replaced in constant time.
+  * @retval HAL_OK            In case of shadow index set successfully.
+  * @retval HAL_INVALID_PARAM In case of invalid parameter.
+  */
+hal_status_t HAL_Q_SetShadowIndex(hal_q_t *p_q, const void *p_nodes, uint32_t node_size_byte, uint32_t node_nbr,
+                                  void **p_prev_index)
+{
+  uint32_t idx;
+
+  ASSERT_DBG_PARAM(p_q != NULL);
+  ASSERT_DBG_PARAM((p_nodes == NULL) || ((p_prev_index != NULL) && (node_size_byte > p_q->next_addr_offset)));
+
+#if defined (USE_HAL_CHECK_PARAM) && (USE_HAL_CHECK_PARAM == 1)
+  if ((p_nodes != NULL) && ((p_prev_index == NULL) || (node_size_byte <= p_q->next_addr_offset)))
+  {
+    return HAL_INVALID_PARAM;
+  }
+#endif /* USE_HAL_CHECK_PARAM */
+
+  if (p_nodes == NULL)
+  {
+    p_q->p_prev_index = NULL;
+  }
+  else
+  {
+    for (idx = 0U; idx < node_nbr; idx++)
+    {
+      p_prev_index[idx] = NULL;
+    }
+
+    p_q->index_base_addr = (uint32_t)p_nodes;
+    p_q->index_node_size = node_size_byte;
+    p_q->index_node_nbr  = node_nbr;
+    p_q->p_prev_index    = p_prev_index;
+
+    Q_SetPrevNodes(p_q, (uint32_t)p_q->p_head_node, 0U, p_q->node_nbr);
+  }
+
+  return HAL_OK;
+}
+#endif /* USE_HAL_Q_SHADOW_INDEX */
 /**
   * @}
   */
@@ -308,6 +377,7 @@ hal_status_t HAL_Q_InsertNode(hal_q_t *p_q, const void *p_node, void *p_new_node
   {
     p_q->p_head_node = p_new_node;
     p_q->p_tail_node = p_new_node;
+    Q_SetPrevNode(p_q, new_node, 0U);
   }
   /* Not empty Q */
   else if (p_q->p_head_node != NULL)
@@ -337,6 +407,8 @@ hal_status_t HAL_Q_InsertNode(hal_q_t *p_q, const void *p_node, void *p_new_node
 #endif /* USE_HAL_Q_DIRECT_ADDR_MODE */
 
       p_q->p_head_node = p_new_node;
+      Q_SetPrevNode(p_q, new_node, 0U);
+      Q_SetPrevNode(p_q, head, new_node);
     }
     else
     {
@@ -355,20 +427,23 @@ hal_status_t HAL_Q_InsertNode(hal_q_t *p_q, const void *p_node, void *p_new_node
       {
         p_q->p_set_node(head, node, new_node, offset);
         p_q->p_tail_node = p_new_node;
+        Q_SetPrevNode(p_q, new_node, node);
       }
       /* Insert node at middle level */
       else
       {
+#if defined(USE_HAL_Q_CHECK_NODES) && (USE_HAL_Q_CHECK_NODES == 1U)
         /* Find node */
-        if (Q_FindNode(p_q, head, node, NULL) == HAL_OK)
-        {
-          p_q->p_set_node(head, new_node, p_q->p_get_node(head, node, offset), offset);
-          p_q->p_set_node(head, node, new_node, offset);
-        }
-        else
+        if (Q_FindNode(p_q, head, node, NULL) != HAL_OK)
         {
           return HAL_ERROR;
         }
+#endif /* USE_HAL_Q_CHECK_NODES */
+
+        Q_SetPrevNode(p_q, p_q->p_get_node(head, node, offset), new_node);
+        Q_SetPrevNode(p_q, new_node, node);
+        p_q->p_set_node(head, new_node, p_q->p_get_node(head, node, offset), offset);
+        p_q->p_set_node(head, node, new_node, offset);
       }
     }
   }
@@ -454,8 +529,11 @@ hal_status_t HAL_Q_InsertNode_Head(hal_q_t *p_q, void *p_new_node)
 #endif /* USE_HAL_Q_DIRECT_ADDR_MODE */
 
     p_q->p_head_node = p_new_node;
+    Q_SetPrevNode(p_q, head, new_node);
   }
 
+  Q_SetPrevNode(p_q, new_node, 0U);
+
   p_q->node_nbr++;
 
   return HAL_OK;
@@ -523,10 +601,101 @@ hal_status_t HAL_Q_InsertNode_Tail(hal_q_t *p_q, void *p_new_node)
     p_q->p_tail_node = p_new_node;
   }
 
+  Q_SetPrevNode(p_q, new_node, tail);
+
   p_q->node_nbr++;
 
   return HAL_OK;
 }
+
+/**
+  * @brief  Link a contiguous array of nodes at the tail of the Q, in the array order.
+  * @param  p_q               Pointer to a hal_q_t structure that contains Q information.
+  * @param  p_nodes           Pointer to the first node of the array.
+  * @param  node_size_byte    Size in byte of a node of the array.
+  * @param  node_nbr          Number of nodes of the array.
+  * @note   The nodes are linked in one pass, the link of the last node is cleared.
+  * @retval HAL_OK            In case of nodes inserted successfully in the tail of the Q.
+  * @retval HAL_ERROR         In case of nodes not inserted.
+  * @retval HAL_INVALID_PARAM In case of invalid parameter.
+  */
+hal_status_t HAL_Q_BuildFromArray(hal_q_t *p_q, void *p_nodes, uint32_t node_size_byte, uint32_t node_nbr)
+{
+  uint32_t head;
+  uint32_t tail;
+  uint32_t first_node;
+  uint32_t current_node;
+  uint32_t offset;
+  uint32_t node_idx;
+
+  ASSERT_DBG_PARAM(p_q != NULL);
+  ASSERT_DBG_PARAM(p_nodes != NULL);
+  ASSERT_DBG_PARAM(node_nbr != 0U);
+  ASSERT_DBG_PARAM(node_size_byte > p_q->next_addr_offset);
+#if defined(USE_HAL_Q_CIRCULAR_LINK) && (USE_HAL_Q_CIRCULAR_LINK == 1)
+  ASSERT_DBG_PARAM(p_q->p_first_circular_node == NULL);
+#endif /* USE_HAL_Q_CIRCULAR_LINK */
+
+#if defined (USE_HAL_CHECK_PARAM) && (USE_HAL_CHECK_PARAM == 1)
+  if ((p_nodes == NULL) || (node_nbr == 0U) || (node_size_byte <= p_q->next_addr_offset))
+  {
+    return HAL_INVALID_PARAM;
+  }
+#if defined(USE_HAL_Q_CIRCULAR_LINK) && (USE_HAL_Q_CIRCULAR_LINK == 1)
+  if (p_q->p_first_circular_node != NULL)
+  {
+    return HAL_INVALID_PARAM;
+  }
+#endif /* USE_HAL_Q_CIRCULAR_LINK */
+#endif /* USE_HAL_CHECK_PARAM */
+
+  first_node = (uint32_t)p_nodes;
+  tail       = (uint32_t)p_q->p_tail_node;
+  offset     = p_q->next_addr_offset;
+
+  /* Empty Q */
+  if (p_q->p_head_node == NULL)
+  {
+    p_q->p_head_node = p_nodes;
+  }
+#if (USE_HAL_Q_BASE_OFFSET_ADDR_MODE) && (USE_HAL_Q_BASE_OFFSET_ADDR_MODE == 1)
+  else if (p_q->addr_mode != HAL_Q_ADDRESSING_DIRECT)
+  {
+    /* Nodes are linked with a positive offset versus the head node */
+    if (Q_IsValidNodeAddr(p_q, (uint32_t)p_q->p_head_node, first_node, Q_CHECK_HEAD_NODE) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+#endif /* USE_HAL_Q_BASE_OFFSET_ADDR_MODE */
+  else
+  {
+    /* Nothing to do */
+  }
+
+  head = (uint32_t)p_q->p_head_node;
+
+  if (tail != 0U)
+  {
+    p_q->p_set_node(head, tail, first_node, offset);
+  }
+
+  current_node = first_node;
+  for (node_idx = 1U; node_idx < node_nbr; node_idx++)
+  {
+    p_q->p_set_node(head, current_node, current_node + node_size_byte, offset);
+    current_node += node_size_byte;
+  }
+
+  p_q->p_set_node(0U, current_node, 0U, offset);
+  p_q->p_tail_node = (void *)current_node;
+
+  p_q->node_nbr += node_nbr;
+
+  Q_SetPrevNodes(p_q, first_node, tail, node_nbr);
+
+  return HAL_OK;
+}
 /**
   * @}
   */
@@ -550,9 +719,8 @@ This section provides functions allowing to remove any existing node from a Q :
   */
 hal_status_t HAL_Q_RemoveNode(hal_q_t *p_q, const void *p_node)
 {
-  uint32_t prev;
+  uint32_t prev = 0U;
   uint32_t head;
-  uint32_t tail;
   uint32_t node;
   uint32_t offset;
 #if (USE_HAL_Q_BASE_OFFSET_ADDR_MODE) && (USE_HAL_Q_BASE_OFFSET_ADDR_MODE == 1)
@@ -580,7 +748,6 @@ hal_status_t HAL_Q_RemoveNode(hal_q_t *p_q, const void *p_node)
 #endif /* USE_HAL_CHECK_PARAM */
 
   head   = (uint32_t)p_q->p_head_node;
-  tail   = (uint32_t)p_q->p_tail_node;
   node   = (uint32_t)p_node;
   offset = p_q->next_addr_offset;
 
@@ -614,22 +781,12 @@ hal_status_t HAL_Q_RemoveNode(hal_q_t *p_q, const void *p_node)
       /* Set the new head node */
       p_q->p_head_node = (void *)(p_q->p_get_node(head, head, offset));
       p_q->p_set_node(0U, node, 0U, offset);
+      Q_SetPrevNode(p_q, (uint32_t)p_q->p_head_node, 0U);
     }
   }
   else
   {
-    /* Delete tail node */
-    if (p_node == p_q->p_tail_node)
-    {
-      prev = tail;
-    }
-    /* Delete middle node */
-    else
-    {
-      prev = node;
-    }
-
-    if (Q_FindNode(p_q, head, prev, &prev) != HAL_OK)
+    if (Q_FindPrevNode(p_q, node, &prev) != HAL_OK)
     {
       return HAL_ERROR;
     }
@@ -644,11 +801,14 @@ hal_status_t HAL_Q_RemoveNode(hal_q_t *p_q, const void *p_node)
     /* Delete middle node */
     else
     {
+      Q_SetPrevNode(p_q, p_q->p_get_node(head, node, offset), prev);
       p_q->p_set_node(head, prev, p_q->p_get_node(head, node, offset), offset);
       p_q->p_set_node(0U, node, 0U, offset);
     }
   }
 
+  Q_SetPrevNode(p_q, node, 0U);
+
   p_q->node_nbr--;
 
   return HAL_OK;
@@ -720,6 +880,8 @@ hal_status_t HAL_Q_RemoveNode_Head(hal_q_t *p_q)
     /* Set the new head node */
     p_q->p_head_node = (void *)(p_q->p_get_node(head, head, offset));
     p_q->p_set_node(0U, head, 0U, offset);
+    Q_SetPrevNode(p_q, (uint32_t)p_q->p_head_node, 0U);
+    Q_SetPrevNode(p_q, head, 0U);
   }
 
   p_q->node_nbr--;
@@ -737,7 +899,6 @@ hal_status_t HAL_Q_RemoveNode_Head(hal_q_t *p_q)
 hal_status_t HAL_Q_RemoveNode_Tail(hal_q_t *p_q)
 {
   uint32_t prev = 0U;
-  uint32_t head;
   uint32_t tail;
   uint32_t offset;
 
@@ -760,7 +921,6 @@ hal_status_t HAL_Q_RemoveNode_Tail(hal_q_t *p_q)
 #endif /* USE_HAL_Q_CIRCULAR_LINK */
 #endif /* USE_HAL_CHECK_PARAM */
 
-  head   = (uint32_t)p_q->p_head_node;
   tail   = (uint32_t)p_q->p_tail_node;
   offset = p_q->next_addr_offset;
 
@@ -770,7 +930,7 @@ hal_status_t HAL_Q_RemoveNode_Tail(hal_q_t *p_q)
   }
   else
   {
-    if (Q_FindNode(p_q, head, tail, &prev) != HAL_OK)
+    if (Q_FindPrevNode(p_q, tail, &prev) != HAL_OK)
     {
       return HAL_ERROR;
     }
@@ -780,6 +940,8 @@ hal_status_t HAL_Q_RemoveNode_Tail(hal_q_t *p_q)
     p_q->p_set_node(0U, prev, 0U, offset);
   }
 
+  Q_SetPrevNode(p_q, tail, 0U);
+
   p_q->node_nbr--;
 
   return HAL_OK;
@@ -808,9 +970,8 @@ This section provides functions allowing to replace any existing node in a Q :
   */
 hal_status_t HAL_Q_ReplaceNode(hal_q_t *p_q, const void *p_old_node, void *p_new_node)
 {
-  uint32_t prev;
+  uint32_t prev = 0U;
   uint32_t head;
-  uint32_t tail;
   uint32_t new_node;
   uint32_t old_node;
   uint32_t offset;
@@ -836,7 +997,6 @@ hal_status_t HAL_Q_ReplaceNode(hal_q_t *p_q, const void *p_old_node, void *p_new
 #endif /* USE_HAL_CHECK_PARAM */
 
   head     = (uint32_t)p_q->p_head_node;
-  tail     = (uint32_t)p_q->p_tail_node;
   new_node = (uint32_t)p_new_node;
   old_node = (uint32_t)p_old_node;
   offset   = p_q->next_addr_offset;
@@ -870,10 +1030,12 @@ hal_status_t HAL_Q_ReplaceNode(hal_q_t *p_q, const void *p_old_node, void *p_new
       }
 #endif /* USE_HAL_Q_DIRECT_ADDR_MODE */
 
+      Q_SetPrevNode(p_q, p_q->p_get_node(head, head, offset), new_node);
       p_q->p_set_node(0U, head, 0U, offset);
     }
 
     p_q->p_head_node = p_new_node;
+    Q_SetPrevNode(p_q, new_node, 0U);
   }
   else
   {
@@ -887,16 +1049,7 @@ hal_status_t HAL_Q_ReplaceNode(hal_q_t *p_q, const void *p_old_node, void *p_new
     }
 #endif /* USE_HAL_Q_BASE_OFFSET_ADDR_MODE */
 
-    if (p_old_node == p_q->p_tail_node)
-    {
-      prev = tail;
-    }
-    else
-    {
-      prev = old_node;
-    }
-
-    if (Q_FindNode(p_q, head, prev, &prev) != HAL_OK)
+    if (Q_FindPrevNode(p_q, old_node, &prev) != HAL_OK)
     {
       return HAL_ERROR;
     }
@@ -908,12 +1061,17 @@ hal_status_t HAL_Q_ReplaceNode(hal_q_t *p_q, const void *p_old_node, void *p_new
     }
     else
     {
+      Q_SetPrevNode(p_q, p_q->p_get_node(head, old_node, offset), new_node);
       p_q->p_set_node(head, new_node, p_q->p_get_node(head, old_node, offset), offset);
       p_q->p_set_node(head, prev, new_node, offset);
       p_q->p_set_node(0U, old_node, 0U, offset);
     }
+
+    Q_SetPrevNode(p_q, new_node, prev);
   }
 
+  Q_SetPrevNode(p_q, old_node, 0U);
+
   return HAL_OK;
 }
 
@@ -982,10 +1140,13 @@ hal_status_t HAL_Q_ReplaceNode_Head(hal_q_t *p_q, void *p_new_node)
     }
 #endif /* USE_HAL_Q_DIRECT_ADDR_MODE */
 
+    Q_SetPrevNode(p_q, p_q->p_get_node(head, head, offset), new_node);
     p_q->p_set_node(0U, head, 0U, offset);
   }
 
   p_q->p_head_node = p_new_node;
+  Q_SetPrevNode(p_q, new_node, 0U);
+  Q_SetPrevNode(p_q, head, 0U);
 
   return HAL_OK;
 }
@@ -1048,7 +1209,7 @@ hal_status_t HAL_Q_ReplaceNode_Tail(hal_q_t *p_q, void *p_new_node)
 #endif /* USE_HAL_Q_BASE_OFFSET_ADDR_MODE */
 
     /* Find the tail previous node */
-    if (Q_FindNode(p_q, head, tail, &prev) != HAL_OK)
+    if (Q_FindPrevNode(p_q, tail, &prev) != HAL_OK)
     {
       return HAL_ERROR;
     }
@@ -1057,6 +1218,8 @@ hal_status_t HAL_Q_ReplaceNode_Tail(hal_q_t *p_q, void *p_new_node)
   }
 
   p_q->p_tail_node = p_new_node;
+  Q_SetPrevNode(p_q, new_node, prev);
+  Q_SetPrevNode(p_q, tail, 0U);
 
   return HAL_OK;
 }
@@ -1129,6 +1292,7 @@ hal_status_t HAL_Q_InsertQ(hal_q_t *p_dest_q, hal_q_t *p_src_q, const void *p_no
   {
     p_dest_q->p_head_node = p_src_q->p_head_node;
     p_dest_q->p_tail_node = p_src_q->p_tail_node;
+    node_addr = 0U;
   }
   /* Not empty destination Q */
   else
@@ -1163,10 +1327,12 @@ hal_status_t HAL_Q_InsertQ(hal_q_t *p_dest_q, hal_q_t *p_src_q, const void *p_no
     }
     else
     {
+#if defined(USE_HAL_Q_CHECK_NODES) && (USE_HAL_Q_CHECK_NODES == 1U)
       if (Q_FindNode(p_dest_q, dest_head, node_addr, NULL) != HAL_OK)
       {
         return HAL_ERROR;
       }
+#endif /* USE_HAL_Q_CHECK_NODES */
 
 #if (USE_HAL_Q_BASE_OFFSET_ADDR_MODE) && (USE_HAL_Q_BASE_OFFSET_ADDR_MODE == 1)
       if (p_dest_q->addr_mode != HAL_Q_ADDRESSING_DIRECT)
@@ -1217,6 +1383,8 @@ hal_status_t HAL_Q_InsertQ(hal_q_t *p_dest_q, hal_q_t *p_src_q, const void *p_no
   /* Set destination Q node number */
   p_dest_q->node_nbr += p_src_q->node_nbr;
 
+  Q_SetPrevNodes(p_dest_q, src_head, node_addr, p_src_q->node_nbr);
+
   Q_ResetInfo(p_src_q);
   p_src_q->node_nbr = 0U;
 
@@ -1306,6 +1474,8 @@ hal_status_t HAL_Q_InsertQ_Head(hal_q_t *p_dest_q, hal_q_t *p_src_q)
   /* Set node number of new Q */
   p_dest_q->node_nbr += p_src_q->node_nbr;
 
+  Q_SetPrevNodes(p_dest_q, src_head, 0U, p_src_q->node_nbr);
+
   Q_ResetInfo(p_src_q);
   p_src_q->node_nbr = 0U;
 
@@ -1324,6 +1494,7 @@ hal_status_t HAL_Q_InsertQ_Tail(hal_q_t *p_dest_q, hal_q_t *p_src_q)
 {
   uint32_t src_head_addr;
   uint32_t dest_head_addr;
+  uint32_t dest_prev_addr;
 #if (USE_HAL_Q_DIRECT_ADDR_MODE) && (USE_HAL_Q_DIRECT_ADDR_MODE == 1)
   uint32_t dest_tail_addr;
   uint32_t offset;
@@ -1347,6 +1518,7 @@ hal_status_t HAL_Q_InsertQ_Tail(hal_q_t *p_dest_q, hal_q_t *p_src_q)
 
   src_head_addr  = (uint32_t)p_src_q->p_head_node;
   dest_head_addr = (uint32_t)p_dest_q->p_head_node;
+  dest_prev_addr = (uint32_t)p_dest_q->p_tail_node;
 #if (USE_HAL_Q_DIRECT_ADDR_MODE) && (USE_HAL_Q_DIRECT_ADDR_MODE == 1)
   dest_tail_addr = (uint32_t)p_dest_q->p_tail_node;
   offset         = p_dest_q->next_addr_offset;
@@ -1396,6 +1568,8 @@ hal_status_t HAL_Q_InsertQ_Tail(hal_q_t *p_dest_q, hal_q_t *p_src_q)
   /* Set node number of new Q */
   p_dest_q->node_nbr += p_src_q->node_nbr;
 
+  Q_SetPrevNodes(p_dest_q, src_head_addr, dest_prev_addr, p_src_q->node_nbr);
+
   Q_ResetInfo(p_src_q);
   p_src_q->node_nbr = 0U;
 
@@ -1445,18 +1619,18 @@ hal_status_t HAL_Q_SetCircularLinkQ(hal_q_t *p_q, void *p_node)
   node   = (uint32_t)p_node;
   offset = p_q->next_addr_offset;
 
-  if (Q_FindNode(p_q, head, node, NULL) == HAL_OK)
-  {
-    /* Link the tail node to the p_node */
-    p_q->p_set_node(head, tail, node, offset);
-
-    /* Update first circular node in Q */
-    p_q->p_first_circular_node = p_node;
-  }
-  else
+#if defined(USE_HAL_Q_CHECK_NODES) && (USE_HAL_Q_CHECK_NODES == 1U)
+  if (Q_FindNode(p_q, head, node, NULL) != HAL_OK)
   {
     return HAL_ERROR;
   }
+#endif /* USE_HAL_Q_CHECK_NODES */
+
+  /* Link the tail node to the p_node */
+  p_q->p_set_node(head, tail, node, offset);
+
+  /* Update first circular node in Q */
+  p_q->p_first_circular_node = p_node;
 
   return HAL_OK;
 }
@@ -1646,6 +1820,104 @@ static hal_status_t Q_FindNode(const hal_q_t *p_q, uint32_t head_node_addr, uint
   return HAL_OK;
 }
 
+/**
+  * @brief Find the previous node of a Q node other than the head node.
+  * @param p_q              Pointer to a hal_q_t structure that contains Q information.
+  * @param node_addr        Node address.
+  * @param p_prev_node_addr Pointer to previous Node address.
+  * @note  The shadow index is used when it holds a previous node linked to the node, the Q is walked otherwise.
+  * @retval HAL_OK          In case of previous node found.
+  * @retval HAL_ERROR       In case of node not found in the Q.
+  */
+static hal_status_t Q_FindPrevNode(const hal_q_t *p_q, uint32_t node_addr, uint32_t *p_prev_node_addr)
+{
+  uint32_t head_node_addr = (uint32_t)p_q->p_head_node;
+#if defined(USE_HAL_Q_SHADOW_INDEX) && (USE_HAL_Q_SHADOW_INDEX == 1U)
+  uint32_t node_offset    = node_addr - p_q->index_base_addr;
+  uint32_t prev_node_addr;
+
+  if ((p_q->p_prev_index != NULL) && (node_addr >= p_q->index_base_addr)
+      && ((node_offset / p_q->index_node_size) < p_q->index_node_nbr)
+      && ((node_offset % p_q->index_node_size) == 0U))
+  {
+    prev_node_addr = (uint32_t)p_q->p_prev_index[node_offset / p_q->index_node_size];
+
+    if ((prev_node_addr != 0U)
+        && (p_q->p_get_node(head_node_addr, prev_node_addr, p_q->next_addr_offset) == node_addr))
+    {
+      *p_prev_node_addr = prev_node_addr;
+
+      return HAL_OK;
+    }
+  }
+#endif /* USE_HAL_Q_SHADOW_INDEX */
+
+  return Q_FindNode(p_q, head_node_addr, node_addr, p_prev_node_addr);
+}
+
+/**
+  * @brief Set the previous node of a node in the shadow index.
+  * @param p_q            Pointer to a hal_q_t structure that contains Q information.
+  * @param node_addr      Node address, ignored when out of the indexed node array.
+  * @param prev_node_addr Previous node address, 0 for the head node or a node out of the Q.
+  */
+static void Q_SetPrevNode(const hal_q_t *p_q, uint32_t node_addr, uint32_t prev_node_addr)
+{
+#if defined(USE_HAL_Q_SHADOW_INDEX) && (USE_HAL_Q_SHADOW_INDEX == 1U)
+  uint32_t node_offset = node_addr - p_q->index_base_addr;
+
+  if ((p_q->p_prev_index != NULL) && (node_addr >= p_q->index_base_addr)
+      && ((node_offset / p_q->index_node_size) < p_q->index_node_nbr)
+      && ((node_offset % p_q->index_node_size) == 0U))
+  {
+    p_q->p_prev_index[node_offset / p_q->index_node_size] = (void *)prev_node_addr;
+  }
+#else
+  STM32_UNUSED(p_q);
+  STM32_UNUSED(node_addr);
+  STM32_UNUSED(prev_node_addr);
+#endif /* USE_HAL_Q_SHADOW_INDEX */
+}
+
+/**
+  * @brief Set the previous nodes of consecutive Q nodes in the shadow index, and of the node following them.
+  * @param p_q            Pointer to a hal_q_t structure that contains Q information.
+  * @param node_addr      First node address.
+  * @param prev_node_addr Previous node address of the first node, 0 for the head node.
+  * @param node_nbr       Number of consecutive nodes.
+  */
+static void Q_SetPrevNodes(const hal_q_t *p_q, uint32_t node_addr, uint32_t prev_node_addr, uint32_t node_nbr)
+{
+#if defined(USE_HAL_Q_SHADOW_INDEX) && (USE_HAL_Q_SHADOW_INDEX == 1U)
+  uint32_t head_node_addr = (uint32_t)p_q->p_head_node;
+  uint32_t current_addr   = node_addr;
+  uint32_t previous_addr  = prev_node_addr;
+  uint32_t node_idx;
+
+  if (p_q->p_prev_index == NULL)
+  {
+    return;
+  }
+
+  for (node_idx = 0U; node_idx < node_nbr; node_idx++)
+  {
+    Q_SetPrevNode(p_q, current_addr, previous_addr);
+    previous_addr = current_addr;
+    current_addr  = p_q->p_get_node(head_node_addr, previous_addr, p_q->next_addr_offset);
+  }
+
+  if ((node_nbr != 0U) && (previous_addr != (uint32_t)p_q->p_tail_node))
+  {
+    Q_SetPrevNode(p_q, current_addr, previous_addr);
+  }
+#else
+  STM32_UNUSED(p_q);
+  STM32_UNUSED(node_addr);
+  STM32_UNUSED(prev_node_addr);
+  STM32_UNUSED(node_nbr);
+#endif /* USE_HAL_Q_SHADOW_INDEX */
+}
+
 #if (USE_HAL_Q_BASE_OFFSET_ADDR_MODE) && (USE_HAL_Q_BASE_OFFSET_ADDR_MODE == 1)
 /**
   * @brief  Check the address of the node to be inserted into the Q is valid
@@ -1663,6 +1935,14 @@ static hal_status_t Q_IsValidNodeAddr(const hal_q_t *p_q, uint32_t start_node, u
   uint32_t offset       = p_q->next_addr_offset;
   uint32_t current_addr = start_node;
 
+#if defined(USE_HAL_Q_CHECK_NODES) && (USE_HAL_Q_CHECK_NODES == 0U)
+  /* Node addresses are not checked */
+  if (mode == Q_CHECK_ALL_NODES)
+  {
+    return HAL_OK;
+  }
+#endif /* USE_HAL_Q_CHECK_NODES */
+
   if (mode == Q_CHECK_HEAD_NODE)
   {
     if (current_addr >= node)
@@ -23,6 +23,15 @@
 extern "C" {
 #endif
 
+/* Q configuration default values ------------------------------------------------------------------------------------*/
+#ifndef USE_HAL_Q_CHECK_NODES
+#define USE_HAL_Q_CHECK_NODES  (1U) /*!< Walk the Q to check the nodes given as position are Q nodes */
+#endif /* USE_HAL_Q_CHECK_NODES */
+
+#ifndef USE_HAL_Q_SHADOW_INDEX
+#define USE_HAL_Q_SHADOW_INDEX (0U) /*!< Allow the Q to keep the previous node of each node of a node array */
+#endif /* USE_HAL_Q_SHADOW_INDEX */
+
 /** @addtogroup STM32U5xx_HAL_Driver
   * @{
   */
@@ -86,6 +95,16 @@ typedef struct
 
   uint32_t (* p_get_node)(uint32_t head, uint32_t node, uint32_t offset);            /*!< Specifies the Q get node address information provided by HAL PPP that supports linked-list feature */
 
+#if defined(USE_HAL_Q_SHADOW_INDEX) && (USE_HAL_Q_SHADOW_INDEX == 1U)
+  void     **p_prev_index;                                                           /*!< Specifies the previous node of each indexed node, NULL when the Q has no shadow index              */
+
+  uint32_t index_base_addr;                                                          /*!< Specifies the address of the first indexed node                                                    */
+
+  uint32_t index_node_size;                                                          /*!< Specifies the size in byte of an indexed node                                                      */
+
+  uint32_t index_node_nbr;                                                           /*!< Specifies the number of indexed nodes                                                              */
+#endif /* USE_HAL_Q_SHADOW_INDEX */
+
 } hal_q_t;
 /**
   * @}
@@ -101,6 +120,10 @@ typedef struct
   */
 hal_status_t HAL_Q_Init(hal_q_t *p_q, const hal_q_desc_ops_t *p_desc_ops);
 void         HAL_Q_DeInit(hal_q_t *p_q);
+#if defined(USE_HAL_Q_SHADOW_INDEX) && (USE_HAL_Q_SHADOW_INDEX == 1U)
+hal_status_t HAL_Q_SetShadowIndex(hal_q_t *p_q, const void *p_nodes, uint32_t node_size_byte, uint32_t node_nbr,
+                                  void **p_prev_index);
+#endif /* USE_HAL_Q_SHADOW_INDEX */
 /**
   * @}
   */
@@ -111,6 +134,7 @@ void         HAL_Q_DeInit(hal_q_t *p_q);
 hal_status_t HAL_Q_InsertNode(hal_q_t *p_q, const void *p_node, void *p_new_node);
 hal_status_t HAL_Q_InsertNode_Head(hal_q_t *p_q, void *p_new_node);
 hal_status_t HAL_Q_InsertNode_Tail(hal_q_t *p_q, void *p_new_node);
+hal_status_t HAL_Q_BuildFromArray(hal_q_t *p_q, void *p_nodes, uint32_t node_size_byte, uint32_t node_nbr);
 /**
   * @}
   */
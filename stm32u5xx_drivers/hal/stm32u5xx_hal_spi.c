@@ -674,6 +674,10 @@ hal_status_t HAL_SPI_Init(hal_spi_handle_t *hspi, hal_spi_t instance)
 #if defined (USE_HAL_SPI_DMA) && (USE_HAL_SPI_DMA == 1)
   hspi->hdma_tx              = (hal_dma_handle_t *) NULL;
   hspi->hdma_rx              = (hal_dma_handle_t *) NULL;
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+  hspi->p_tx_nodes           = (hal_dma_node_t *) NULL;
+  hspi->tx_node_nbr          = 0UL;
+#endif /* USE_HAL_DMA_LINKEDLIST */
 #endif /* USE_HAL_SPI_DMA  */
 
 #if defined(USE_HAL_SPI_USER_DATA) && (USE_HAL_SPI_USER_DATA == 1)
@@ -2257,6 +2261,54 @@ hal_status_t HAL_SPI_SetRxDMA(hal_spi_handle_t *hspi, hal_dma_handle_t *hdma)
 
   return HAL_OK;
 }
+
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+/**
+  * @brief Set the Transmit DMA nodes used by HAL_SPI_TransmitV_DMA().
+  * @param hspi Pointer to a \ref hal_spi_handle_t structure.
+  * @param p_nodes Pointer to an array of DMA nodes, one per segment of the largest transmission.
+  * @param node_nbr Number of nodes of the array.
+  * @param p_node_config Pointer to the memory to peripheral transfer configuration applied to all the nodes.
+  * @note  The nodes are configured once here: a transmission only fills their address and size and links them.
+  *        Their TC event is forced to the end of the linked-list.
+  * @note  The nodes must be placed in the same 64 Kbytes memory area, as required by the DMA linked-list.
+  * @retval HAL_OK The nodes have been correctly set.
+  * @retval HAL_INVALID_PARAM Invalid parameter.
+  * @retval HAL_ERROR Invalid node configuration.
+  */
+hal_status_t HAL_SPI_SetTxDMANodes(hal_spi_handle_t *hspi, hal_dma_node_t *p_nodes, uint32_t node_nbr,
+                                   const hal_dma_node_config_t *p_node_config)
+{
+  ASSERT_DBG_PARAM((hspi != NULL));
+  ASSERT_DBG_PARAM((p_nodes != NULL));
+  ASSERT_DBG_PARAM((node_nbr != 0UL));
+  ASSERT_DBG_PARAM((p_node_config != NULL));
+
+  ASSERT_DBG_STATE(hspi->global_state, (uint32_t)HAL_SPI_STATE_INIT | (uint32_t)HAL_SPI_STATE_IDLE);
+
+#if defined(USE_HAL_CHECK_PARAM) && (USE_HAL_CHECK_PARAM == 1)
+  if ((p_nodes == NULL) || (node_nbr == 0UL) || (p_node_config == NULL))
+  {
+    return HAL_INVALID_PARAM;
+  }
+#endif /* USE_HAL_CHECK_PARAM */
+
+  for (uint32_t i = 0UL; i < node_nbr; i++)
+  {
+    if (HAL_DMA_FillNodeConfig(&p_nodes[i], p_node_config, HAL_DMA_NODE_LINEAR_ADDRESSING) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+    (void)HAL_DMA_FillNodeXferEventMode(&p_nodes[i], HAL_DMA_LINKEDLIST_XFER_EVENT_Q);
+  }
+
+  (void)HAL_Q_Init(&hspi->tx_q, &HAL_DMA_LinearAddressing_DescOps);
+  hspi->p_tx_nodes  = p_nodes;
+  hspi->tx_node_nbr = node_nbr;
+
+  return HAL_OK;
+}
+#endif /* USE_HAL_DMA_LINKEDLIST */
 #endif /* USE_HAL_SPI_DMA  */
 /**
   * @}
@@ -3362,6 +3414,193 @@ hal_status_t HAL_SPI_Transmit_DMA(hal_spi_handle_t *hspi, const void *p_data, ui
   return status;
 }
 
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+/**
+  * @brief Transmit a list of segments in non-blocking mode with DMA, as a single transfer.
+  * @param hspi Pointer to a \ref hal_spi_handle_t structure which contains
+  *             the SPI instance.
+  * @param p_iov Pointer to the array of segments.
+  * @param iov_cnt Number of segments, up to the number of nodes given to HAL_SPI_SetTxDMANodes().
+  * @note  The Tx DMA channel must be configured in linked-list mode with HAL_DMA_SetConfigLinkedListXfer().
+  *        A node is linked per segment, so that the segments are sent back to back without copy, and
+  *        HAL_SPI_TxCpltCallback() is called once at the end of the transfer.
+  * @note  The size of each segment must be a multiple of the packet size (1, 2 or 4 bytes depending on the
+  *        data width) and of the DMA source data width of the nodes. As for HAL_SPI_Transmit_DMA(), the DMA source
+  *        data width can be larger than the packet size (packing) but not smaller.
+  * @retval HAL_OK            Operation started successfully.
+  * @retval HAL_BUSY          Concurrent process ongoing.
+  * @retval HAL_INVALID_PARAM Invalid parameter.
+  * @retval HAL_ERROR         Tx DMA channel not in linked-list mode, nodes not set, DMA source data width not
+  *                           allowed for the data width, or DMA error.
+  */
+hal_status_t HAL_SPI_TransmitV_DMA(hal_spi_handle_t *hspi, const hal_spi_iovec_t *p_iov, uint32_t iov_cnt)
+{
+  uint32_t data_width;
+  uint32_t mode;
+  uint32_t packet_shift;
+  uint32_t size_mask;
+  uint32_t size_byte = 0UL;
+  uint32_t txdr_addr;
+  hal_dma_node_config_t p_dma_tx_node_config;
+  hal_dma_node_type_t  p_node_type;
+
+  ASSERT_DBG_PARAM(hspi != NULL);
+  ASSERT_DBG_PARAM(p_iov != NULL);
+  ASSERT_DBG_PARAM((iov_cnt != 0UL) && (iov_cnt <= hspi->tx_node_nbr));
+#if defined(USE_HAL_CHECK_PARAM) && (USE_HAL_CHECK_PARAM == 1U)
+  if ((p_iov == NULL) || (iov_cnt == 0UL) || (iov_cnt > hspi->tx_node_nbr))
+  {
+    return HAL_INVALID_PARAM;
+  }
+#endif /* USE_HAL_CHECK_PARAM */
+
+  /* Check Direction parameter */
+  ASSERT_DBG_PARAM(IS_SPI_DIRECTION_TX_AVAILABLE(hspi->direction));
+
+  ASSERT_DBG_STATE(hspi->global_state, HAL_SPI_STATE_IDLE);
+
+  data_width = LL_SPI_GetDataWidth((SPI_TypeDef *)((uint32_t)hspi->instance));
+  mode       = LL_SPI_GetMode((SPI_TypeDef *)((uint32_t)hspi->instance));
+  if (data_width <= LL_SPI_DATA_WIDTH_8_BIT)
+  {
+    packet_shift = 0UL;
+  }
+  else if (data_width <= LL_SPI_DATA_WIDTH_16_BIT)
+  {
+    packet_shift = 1UL;
+  }
+  else
+  {
+    packet_shift = 2UL;
+  }
+
+  if ((hspi->hdma_tx == NULL) || (hspi->p_tx_nodes == NULL)
+      || (hspi->hdma_tx->xfer_mode != HAL_DMA_XFER_MODE_LINKEDLIST_LINEAR))
+  {
+    return HAL_ERROR;
+  }
+
+  /* All the nodes have the configuration given to HAL_SPI_SetTxDMANodes() */
+  HAL_DMA_GetNodeConfig(&hspi->p_tx_nodes[0], &p_dma_tx_node_config, &p_node_type);
+  size_mask = (1UL << packet_shift) - 1UL;
+  if (p_dma_tx_node_config.xfer.src_data_width == HAL_DMA_SRC_DATA_WIDTH_WORD)
+  {
+    size_mask |= 3UL;
+  }
+  else if (p_dma_tx_node_config.xfer.src_data_width == HAL_DMA_SRC_DATA_WIDTH_HALFWORD)
+  {
+    size_mask |= 1UL;
+  }
+  else
+  {
+    /* Any size of bytes */
+  }
+
+  for (uint32_t i = 0UL; i < iov_cnt; i++)
+  {
+    if ((p_iov[i].p_data == NULL) || (p_iov[i].size_byte == 0UL) || (p_iov[i].size_byte > 0xFFFFUL)
+        || ((p_iov[i].size_byte & size_mask) != 0UL))
+    {
+      return HAL_INVALID_PARAM;
+    }
+    size_byte += p_iov[i].size_byte;
+  }
+  /* Check the transfer size */
+  ASSERT_DBG_PARAM(IS_SPI_TRANSFER_SIZE((SPI_TypeDef *)((uint32_t)hspi->instance), (size_byte >> packet_shift)));
+
+  /* Critical section */
+  HAL_CHECK_UPDATE_STATE(hspi, global_state, HAL_SPI_STATE_IDLE, HAL_SPI_STATE_TX_ACTIVE);
+
+  /* Packing mode management is enabled by the DMA settings */
+  if (((data_width > LL_SPI_DATA_WIDTH_16_BIT)
+       && (p_dma_tx_node_config.xfer.src_data_width != HAL_DMA_SRC_DATA_WIDTH_WORD)
+       && (IS_SPI_FULL_INSTANCE(((SPI_TypeDef *)((uint32_t)hspi->instance)))))
+      || ((data_width > LL_SPI_DATA_WIDTH_8_BIT)
+          && (p_dma_tx_node_config.xfer.src_data_width == HAL_DMA_SRC_DATA_WIDTH_BYTE)))
+  {
+    /* Restriction the DMA data received is not allowed in this mode */
+#if defined(USE_HAL_SPI_GET_LAST_ERRORS) && (USE_HAL_SPI_GET_LAST_ERRORS == 1)
+    hspi->last_error_codes = HAL_SPI_ERROR_DMA;
+#endif /* USE_HAL_SPI_GET_LAST_ERRORS */
+    hspi->global_state = HAL_SPI_STATE_IDLE;
+    return HAL_ERROR;
+  }
+
+  /* Unlink the nodes of the previous transfer and link one node per segment */
+  HAL_Q_DeInit(&hspi->tx_q);
+  (void)HAL_Q_Init(&hspi->tx_q, &HAL_DMA_LinearAddressing_DescOps);
+  txdr_addr = (uint32_t) &((SPI_TypeDef *)((uint32_t)hspi->instance))->TXDR;
+  for (uint32_t i = 0UL; i < iov_cnt; i++)
+  {
+    (void)HAL_DMA_FillNodeData(&hspi->p_tx_nodes[i], (uint32_t)p_iov[i].p_data, txdr_addr, p_iov[i].size_byte);
+    if (HAL_Q_InsertNode_Tail(&hspi->tx_q, &hspi->p_tx_nodes[i]) != HAL_OK)
+    {
+      hspi->global_state = HAL_SPI_STATE_IDLE;
+      return HAL_ERROR;
+    }
+  }
+
+  /* Set the transaction information */
+  hspi->p_tx_buff         = (const uint8_t *)p_iov[0].p_data;
+  hspi->tx_xfer_size      = (uint16_t)(size_byte >> packet_shift);
+  hspi->tx_xfer_count     = (uint16_t)(size_byte >> packet_shift);
+#if defined(USE_HAL_SPI_GET_LAST_ERRORS) && (USE_HAL_SPI_GET_LAST_ERRORS == 1)
+  hspi->last_error_codes  = HAL_SPI_ERROR_NONE;
+#endif /* USE_HAL_SPI_GET_LAST_ERRORS */
+
+  /* Init field not used in handle to zero */
+  hspi->p_rx_buff         = NULL;
+  hspi->p_tx_isr          = NULL;
+  hspi->p_rx_isr          = NULL;
+  hspi->rx_xfer_size      = (uint16_t)0UL;
+  hspi->rx_xfer_count     = (uint16_t)0UL;
+
+  /* Configure communication direction : 1Line */
+  if (LL_SPI_IsHalfDuplexDirection((SPI_TypeDef *)((uint32_t)hspi->instance)) != 0UL)
+  {
+    LL_SPI_SetHalfDuplexDirection((SPI_TypeDef *)((uint32_t)hspi->instance), LL_SPI_HALF_DUPLEX_TX);
+  }
+  else
+  {
+    LL_SPI_SetTransferDirection((SPI_TypeDef *)((uint32_t)hspi->instance), LL_SPI_SIMPLEX_TX);
+  }
+
+  hspi->hdma_tx->p_xfer_halfcplt_cb = SPI_DMAHalfTransmitCplt;
+  hspi->hdma_tx->p_xfer_cplt_cb = SPI_DMATransmitCplt;
+  hspi->hdma_tx->p_xfer_error_cb = SPI_DMAError;
+
+  /* Clear TXDMAEN bit */
+  LL_SPI_DisableDMAReq_TX((SPI_TypeDef *)((uint32_t)hspi->instance));
+
+  /* Enable the Tx DMA Stream/Channel on the linked-list, without half transfer interrupt */
+  if (HAL_OK != HAL_DMA_StartLinkedListXfer_IT_Opt(hspi->hdma_tx, &hspi->tx_q, HAL_DMA_OPT_IT_NONE))
+  {
+#if defined(USE_HAL_SPI_GET_LAST_ERRORS) && (USE_HAL_SPI_GET_LAST_ERRORS == 1)
+    hspi->last_error_codes = HAL_SPI_ERROR_DMA;
+#endif /* USE_HAL_SPI_GET_LAST_ERRORS */
+    hspi->global_state = HAL_SPI_STATE_IDLE;
+    return HAL_ERROR;
+  }
+
+  /* Set the number of data at current transfer */
+  LL_SPI_SetTransferSize((SPI_TypeDef *)((uint32_t)hspi->instance), (size_byte >> packet_shift));
+
+  LL_SPI_EnableDMAReq_TX((SPI_TypeDef *)((uint32_t)hspi->instance));
+
+  LL_SPI_EnableIT((SPI_TypeDef *)((uint32_t)hspi->instance), LL_SPI_IT_UDR | LL_SPI_IT_TIFRE | LL_SPI_IT_MODF);
+
+  LL_SPI_Enable((SPI_TypeDef *)((uint32_t)hspi->instance));
+
+  if ((LL_SPI_IsEnabled_SelectedTrigger((SPI_TypeDef *)((uint32_t)hspi->instance)) == 0U)
+      && (mode == LL_SPI_MODE_MASTER))
+  {
+    LL_SPI_StartMasterTransfer((SPI_TypeDef *)((uint32_t)hspi->instance));
+  }
+
+  return HAL_OK;
+}
+#endif /* USE_HAL_DMA_LINKEDLIST */
+
 /**
   * @brief Receive an amount of data in non-blocking mode with DMA.
   * @param hspi Pointer to a \ref hal_spi_handle_t structure which contains
@@ -87,6 +87,18 @@ typedef enum
 /*! HAL SPI handler type */
 typedef struct hal_spi_handle_s hal_spi_handle_t;
 
+#if defined(USE_HAL_SPI_DMA) && (USE_HAL_SPI_DMA == 1) \
+    && defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+/**
+  * @brief HAL SPI transmit segment, see HAL_SPI_TransmitV_DMA()
+  */
+typedef struct
+{
+  const void *p_data;                                                     /*!< Pointer to the segment data        */
+  uint32_t   size_byte;                                                   /*!< Size of the segment in bytes       */
+} hal_spi_iovec_t;
+#endif /* USE_HAL_SPI_DMA && USE_HAL_DMA_LINKEDLIST */
+
 /**
   * @brief HAL SPI handle structure definition
   */
@@ -112,6 +124,11 @@ struct hal_spi_handle_s
 #if defined(USE_HAL_SPI_DMA) && (USE_HAL_SPI_DMA == 1)
   hal_dma_handle_t           *hdma_tx;                                    /*!< SPI Tx DMA Handle parameters       */
   hal_dma_handle_t           *hdma_rx;                                    /*!< SPI Rx DMA Handle parameters       */
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+  hal_q_t                    tx_q;                                        /*!< SPI Tx DMA linked-list of segments */
+  hal_dma_node_t             *p_tx_nodes;                                 /*!< SPI Tx DMA nodes, one per segment  */
+  uint32_t                   tx_node_nbr;                                 /*!< Number of SPI Tx DMA nodes         */
+#endif /* USE_HAL_DMA_LINKEDLIST */
 #endif /* USE_HAL_SPI_DMA */
 #if defined(USE_HAL_SPI_USER_DATA) && (USE_HAL_SPI_USER_DATA == 1)
   const void                 *p_user_data;                                /*!< User Data Pointer                  */
@@ -775,6 +792,10 @@ const void *HAL_SPI_GetUserData(const hal_spi_handle_t *hspi);
 #if defined (USE_HAL_SPI_DMA) && (USE_HAL_SPI_DMA == 1)
 hal_status_t HAL_SPI_SetTxDMA(hal_spi_handle_t *hspi, hal_dma_handle_t *hdma);
 hal_status_t HAL_SPI_SetRxDMA(hal_spi_handle_t *hspi, hal_dma_handle_t *hdma);
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+hal_status_t HAL_SPI_SetTxDMANodes(hal_spi_handle_t *hspi, hal_dma_node_t *p_nodes, uint32_t node_nbr,
+                                   const hal_dma_node_config_t *p_node_config);
+#endif /* USE_HAL_DMA_LINKEDLIST */
 #endif /* USE_HAL_SPI_DMA */
 /**
   * @}
@@ -795,6 +816,9 @@ hal_status_t HAL_SPI_TransmitReceive_IT(hal_spi_handle_t *hspi, const void *p_tx
 
 #if defined(USE_HAL_SPI_DMA) && (USE_HAL_SPI_DMA == 1)
 hal_status_t HAL_SPI_Transmit_DMA(hal_spi_handle_t *hspi, const void *p_data, uint32_t count_packet);
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+hal_status_t HAL_SPI_TransmitV_DMA(hal_spi_handle_t *hspi, const hal_spi_iovec_t *p_iov, uint32_t iov_cnt);
+#endif /* USE_HAL_DMA_LINKEDLIST */
 hal_status_t HAL_SPI_Receive_DMA(hal_spi_handle_t *hspi, void *p_data, uint32_t count_packet);
 hal_status_t HAL_SPI_TransmitReceive_DMA(hal_spi_handle_t *hspi, const void *p_tx_data, void *p_rx_data,
                                          uint32_t count_packet);
@@ -98,6 +98,7 @@
   TxFifoEmptyCallback         | HAL_UART_TxFifoEmptyCallback()       | HAL_UART_RegisterTxFifoEmptyCallback()
   LINBreakCallback            | HAL_UART_LINBreakCallback()          | HAL_UART_RegisterLINBreakCallback()
   ClearToSendCallback         | HAL_UART_ClearToSendCallback()       | HAL_UART_RegisterClearToSendCallback()
+  RxStreamCallback            | HAL_UART_RxStreamCallback()          | HAL_UART_RegisterRxStreamCallback()
 
   If one needs to unregister a callback, register the default callback via the registration function.
 
@@ -161,6 +162,13 @@ USE_ASSERT_DBG_STATE            | PreProcessor env |         NA        | Enable
 /*! UART RX FIFO depth */
 #define UART_TX_FIFO_DEPTH 8U
 
+#if defined(USE_HAL_UART_DMA) && (USE_HAL_UART_DMA == 1)
+/*! Tx DMA channel started on the buffer given to UART_Start_Transmit_DMA() */
+#define UART_DMA_TX_BUFFER                  0U
+/*! Tx DMA channel started on the linked-list of the Tx nodes, built by HAL_UART_TransmitV_DMA() */
+#define UART_DMA_TX_NODES                   1U
+#endif /* USE_HAL_UART_DMA */
+
 /**
   * @}
   */
@@ -695,10 +703,13 @@ static void UART_DMARxAbortCallback(hal_dma_handle_t *hdma);
 static void UART_DMATxOnlyAbortCallback(hal_dma_handle_t *hdma);
 static void UART_DMARxOnlyAbortCallback(hal_dma_handle_t *hdma);
 static void UART_DMAAbortOnSuccessCallback(hal_dma_handle_t *hdma);
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+static void UART_RxStreamUpdate(hal_uart_handle_t *huart, hal_uart_rx_event_types_t rx_event);
+#endif /* USE_HAL_DMA_LINKEDLIST */
 static hal_status_t UART_Start_Receive_DMA(hal_uart_handle_t *huart, uint8_t *p_data, uint32_t size,
                                            hal_uart_rx_modes_t rx_mode, uint32_t interrupts);
 static hal_status_t UART_Start_Transmit_DMA(hal_uart_handle_t *huart, const uint8_t *p_data, uint32_t size,
-                                            uint32_t interrupts);
+                                            uint32_t interrupts, uint32_t xfer_source);
 #endif /* USE_HAL_UART_DMA */
 static void UART_TxISR_8BIT_FIFOEN(hal_uart_handle_t *huart);
 static void UART_TxISR_16BIT_FIFOEN(hal_uart_handle_t *huart);
@@ -790,6 +801,10 @@ hal_status_t HAL_UART_Init(hal_uart_handle_t *huart, hal_uart_t instance)
 #if defined (USE_HAL_UART_DMA) && (USE_HAL_UART_DMA == 1)
   huart->hdma_tx = NULL;
   huart->hdma_rx = NULL;
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+  huart->p_tx_nodes = NULL;
+  huart->tx_node_nbr = 0U;
+#endif /* USE_HAL_DMA_LINKEDLIST */
 #endif /* USE_HAL_UART_DMA */
 
 #if defined (USE_HAL_UART_USER_DATA) && (USE_HAL_UART_USER_DATA == 1)
@@ -3866,6 +3881,7 @@ hal_uart_am_idle_frame_status_t HAL_UART_AM_IsEnabledIdle(const hal_uart_handle_
   A set of functions is provided to use the DMA feature:
     - HAL_UART_SetTxDMA(): Link a DMA instance to the Tx channel
     - HAL_UART_SetRxDMA(): Link a DMA instance to the Rx channel
+    - HAL_UART_SetTxDMANodes(): Provide the Tx DMA nodes used by HAL_UART_TransmitV_DMA()
   */
 #if defined (USE_HAL_UART_DMA) && (USE_HAL_UART_DMA == 1)
 /**
@@ -3923,6 +3939,55 @@ hal_status_t HAL_UART_SetRxDMA(hal_uart_handle_t *huart, hal_dma_handle_t *hdma_
 
   return HAL_OK;
 }
+
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+/**
+  * @brief Set the Tx DMA nodes used by HAL_UART_TransmitV_DMA().
+  * @param huart Pointer to a \ref hal_uart_handle_t structure which contains the UART instance.
+  * @param p_nodes Pointer to an array of DMA nodes, one per segment of the largest transmission.
+  * @param node_nbr Number of nodes of the array.
+  * @param p_node_config Pointer to the memory to peripheral transfer configuration applied to all the nodes.
+  * @note  The nodes are configured once here: a transmission only fills their address and size and links them.
+  *        The TC event of the nodes is forced to the end of the linked-list, so that a transmission completes
+  *        with one callback.
+  * @note  The nodes must be placed in the same 64 Kbytes memory area, as required by the DMA linked-list.
+  * @retval HAL_OK The nodes have been correctly set.
+  * @retval HAL_INVALID_PARAM p_nodes or p_node_config is NULL, or node_nbr is 0.
+  */
+hal_status_t HAL_UART_SetTxDMANodes(hal_uart_handle_t *huart, hal_dma_node_t *p_nodes, uint32_t node_nbr,
+                                    const hal_dma_node_config_t *p_node_config)
+{
+  ASSERT_DBG_PARAM(huart != NULL);
+  ASSERT_DBG_PARAM(p_nodes != NULL);
+  ASSERT_DBG_PARAM(node_nbr != 0U);
+  ASSERT_DBG_PARAM(p_node_config != NULL);
+
+  ASSERT_DBG_STATE(huart->global_state, HAL_UART_STATE_CONFIGURED | HAL_UART_STATE_INIT);
+  ASSERT_DBG_STATE(huart->tx_state, (uint32_t)(HAL_UART_TX_STATE_IDLE | HAL_UART_TX_STATE_RESET));
+
+#if defined(USE_HAL_CHECK_PARAM) && (USE_HAL_CHECK_PARAM == 1)
+  if ((p_nodes == NULL) || (node_nbr == 0U) || (p_node_config == NULL))
+  {
+    return HAL_INVALID_PARAM;
+  }
+#endif /* USE_HAL_CHECK_PARAM */
+
+  for (uint32_t i = 0U; i < node_nbr; i++)
+  {
+    if (HAL_DMA_FillNodeConfig(&p_nodes[i], p_node_config, HAL_DMA_NODE_LINEAR_ADDRESSING) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+    (void)HAL_DMA_FillNodeXferEventMode(&p_nodes[i], HAL_DMA_LINKEDLIST_XFER_EVENT_Q);
+  }
+
+  (void)HAL_Q_Init(&huart->tx_q, &HAL_DMA_LinearAddressing_DescOps);
+  huart->p_tx_nodes = p_nodes;
+  huart->tx_node_nbr = node_nbr;
+
+  return HAL_OK;
+}
+#endif /* USE_HAL_DMA_LINKEDLIST */
 #endif /* USE_HAL_UART_DMA */
 
 /**
@@ -3947,6 +4012,7 @@ hal_status_t HAL_UART_SetRxDMA(hal_uart_handle_t *huart, hal_dma_handle_t *hdma_
     - HAL_UART_RegisterTxFifoEmptyCallback(): Set the Tx Fifo empty callback
     - HAL_UART_RegisterClearToSendCallback(): Set the clear to send callback
     - HAL_UART_RegisterLINBreakCallback(): Set the LIN break callback
+    - HAL_UART_RegisterRxStreamCallback(): Set the reception stream callback
   */
 #if defined(USE_HAL_UART_REGISTER_CALLBACKS) && (USE_HAL_UART_REGISTER_CALLBACKS == 1)
 
@@ -4286,6 +4352,37 @@ hal_status_t HAL_UART_RegisterLINBreakCallback(hal_uart_handle_t *huart, hal_uar
   return HAL_OK;
 }
 
+#if defined (USE_HAL_UART_DMA) && (USE_HAL_UART_DMA == 1) \
+    && defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+/**
+  * @brief  Register the UART Rx Stream Callback
+  * @param  huart Pointer to a \ref hal_uart_handle_t structure which contains the UART instance.
+  * @param  p_callback pointer to the Rx Stream Callback function
+  * @retval HAL_OK The function has been registered.
+  * @retval HAL_INVALID_PARAM p_callback is NULL.
+  */
+hal_status_t HAL_UART_RegisterRxStreamCallback(hal_uart_handle_t *huart, hal_uart_rx_stream_cb_t p_callback)
+{
+  ASSERT_DBG_PARAM(huart != NULL);
+  ASSERT_DBG_PARAM(p_callback != NULL);
+
+  ASSERT_DBG_STATE(huart->global_state, (uint32_t)(HAL_UART_STATE_CONFIGURED | HAL_UART_STATE_INIT));
+  ASSERT_DBG_STATE(huart->rx_state, (uint32_t)(HAL_UART_RX_STATE_IDLE | HAL_UART_RX_STATE_RESET));
+  ASSERT_DBG_STATE(huart->tx_state, (uint32_t)(HAL_UART_TX_STATE_IDLE | HAL_UART_TX_STATE_RESET));
+
+#if defined(USE_HAL_CHECK_PARAM) && (USE_HAL_CHECK_PARAM == 1)
+  if (p_callback == NULL)
+  {
+    return HAL_INVALID_PARAM;
+  }
+#endif /* USE_HAL_CHECK_PARAM */
+
+  huart->p_rx_stream_callback = p_callback;
+
+  return HAL_OK;
+}
+#endif /* USE_HAL_UART_DMA && USE_HAL_DMA_LINKEDLIST */
+
 #endif /* USE_HAL_UART_REGISTER_CALLBACKS */
 /**
   * @}
@@ -4322,6 +4419,7 @@ hal_status_t HAL_UART_RegisterLINBreakCallback(hal_uart_handle_t *huart, hal_uar
   Non-Blocking mode API's with DMA are :
     - HAL_UART_Transmit_DMA()
     - HAL_UART_Transmit_DMA_Opt()
+    - HAL_UART_TransmitV_DMA(): send several segments, Tx DMA channel in linked-list mode
     - HAL_UART_Receive_DMA()
     - HAL_UART_Receive_DMA_Opt()
     - HAL_UART_Pause_DMA()
@@ -4721,7 +4819,8 @@ hal_status_t HAL_UART_Transmit_DMA(hal_uart_handle_t *huart, const void *p_data,
 
   HAL_CHECK_UPDATE_STATE(huart, tx_state, HAL_UART_TX_STATE_IDLE, HAL_UART_TX_STATE_ACTIVE);
 
-  return UART_Start_Transmit_DMA(huart, (const uint8_t *)p_data, size_byte, HAL_UART_OPT_DMA_TX_IT_HT);
+  return UART_Start_Transmit_DMA(huart, (const uint8_t *)p_data, size_byte, HAL_UART_OPT_DMA_TX_IT_HT,
+                                 UART_DMA_TX_BUFFER);
 }
 
 /**
@@ -4762,8 +4861,122 @@ hal_status_t HAL_UART_Transmit_DMA_Opt(hal_uart_handle_t *huart, const void *p_d
 
   HAL_CHECK_UPDATE_STATE(huart, tx_state, HAL_UART_TX_STATE_IDLE, HAL_UART_TX_STATE_ACTIVE);
 
-  return UART_Start_Transmit_DMA(huart, (const uint8_t *)p_data, size_byte, interrupts);
+  return UART_Start_Transmit_DMA(huart, (const uint8_t *)p_data, size_byte, interrupts, UART_DMA_TX_BUFFER);
+}
+
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+/**
+  * @brief Send a list of segments in DMA mode, as a single transmission.
+  * @param huart              Pointer to a \ref hal_uart_handle_t structure which contains the UART instance.
+  * @param p_iov              Pointer to the array of segments.
+  * @param iov_cnt            Number of segments, up to the number of nodes given to HAL_UART_SetTxDMANodes().
+  * @note  The Tx DMA channel must be configured in linked-list mode with HAL_DMA_SetConfigLinkedListXfer().
+  *        A node is linked per segment, so that the segments are sent back to back without copy, and
+  *        HAL_UART_TxCpltCallback() is called once at the end of the last one.
+  * @note  The size of each segment must be a multiple of the DMA source data width of the nodes.
+  * @warning When UART parity is not enabled (PCE bit from the CR1 register = 0), and Word Length is configured to
+  *          9 bits (M1-M0 from the CR1 register = 01), the data elements are u16: the size of each segment must be
+  *          even, and the DMA source data width of the nodes cannot be a byte.
+  * @retval HAL_OK            Operation completed successfully.
+  * @retval HAL_BUSY          Concurrent process ongoing.
+  * @retval HAL_INVALID_PARAM Invalid parameter, or segment size not allowed by the data elements and DMA width.
+  * @retval HAL_ERROR         TX DMA handler not set in linked-list mode, nodes not set, byte DMA source for 9-bit
+  *                           data elements or Error during instance enabling.
+  */
+hal_status_t HAL_UART_TransmitV_DMA(hal_uart_handle_t *huart, const hal_uart_iovec_t *p_iov, uint32_t iov_cnt)
+{
+  uint32_t size_byte = 0U;
+  uint32_t size_mask = 0U;
+  uint32_t frame_16_bits = 0U;
+  uint32_t reg_temp;
+  uint32_t tdr_addr;
+  hal_dma_node_config_t node_config;
+  hal_dma_node_type_t node_type;
+
+  ASSERT_DBG_PARAM(huart != NULL);
+  ASSERT_DBG_PARAM(p_iov != NULL);
+  ASSERT_DBG_PARAM((iov_cnt != 0U) && (iov_cnt <= huart->tx_node_nbr));
+  ASSERT_DBG_PARAM(huart->hdma_tx != NULL);
+
+  ASSERT_DBG_STATE(huart->global_state, HAL_UART_STATE_CONFIGURED);
+  ASSERT_DBG_STATE(huart->tx_state, HAL_UART_TX_STATE_IDLE);
+
+#if defined(USE_HAL_CHECK_PARAM) && (USE_HAL_CHECK_PARAM == 1)
+  if ((p_iov == NULL) || (iov_cnt == 0U) || (iov_cnt > huart->tx_node_nbr))
+  {
+    return HAL_INVALID_PARAM;
+  }
+#endif /* USE_HAL_CHECK_PARAM */
+
+  if ((huart->hdma_tx == NULL) || (huart->p_tx_nodes == NULL)
+      || (huart->hdma_tx->xfer_mode != HAL_DMA_XFER_MODE_LINKEDLIST_LINEAR))
+  {
+    return HAL_ERROR;
+  }
+
+  /* 9-bit frames without parity are u16 data elements */
+  reg_temp = LL_USART_READ_REG(UART_GET_INSTANCE(huart), CR1);
+  if (((reg_temp & USART_CR1_M) == LL_USART_DATAWIDTH_9_BIT) && ((reg_temp & USART_CR1_PCE) == LL_USART_PARITY_NONE))
+  {
+    frame_16_bits = 1U;
+    size_mask = 1U;
+  }
+
+  /* All the nodes have the configuration given to HAL_UART_SetTxDMANodes() */
+  HAL_DMA_GetNodeConfig(&huart->p_tx_nodes[0], &node_config, &node_type);
+  if (node_config.xfer.src_data_width == HAL_DMA_SRC_DATA_WIDTH_WORD)
+  {
+    size_mask |= 3U;
+  }
+  else if (node_config.xfer.src_data_width == HAL_DMA_SRC_DATA_WIDTH_HALFWORD)
+  {
+    size_mask |= 1U;
+  }
+  else
+  {
+    /* Any size of bytes */
+  }
+
+  for (uint32_t i = 0U; i < iov_cnt; i++)
+  {
+    if ((p_iov[i].p_data == NULL) || (p_iov[i].size_byte == 0U) || (p_iov[i].size_byte > 0xFFFFU)
+        || ((p_iov[i].size_byte & size_mask) != 0U))
+    {
+      return HAL_INVALID_PARAM;
+    }
+  }
+
+  HAL_CHECK_UPDATE_STATE(huart, tx_state, HAL_UART_TX_STATE_IDLE, HAL_UART_TX_STATE_ACTIVE);
+
+  /* A byte source would send each half of the u16 data elements as a frame */
+  if ((frame_16_bits != 0U) && (node_config.xfer.src_data_width == HAL_DMA_SRC_DATA_WIDTH_BYTE))
+  {
+#if defined (USE_HAL_UART_GET_LAST_ERRORS) && (USE_HAL_UART_GET_LAST_ERRORS == 1)
+    huart->last_transmission_error_codes = HAL_UART_TRANSMIT_ERROR_DMA;
+#endif /* USE_HAL_UART_GET_LAST_ERRORS */
+    huart->tx_state = HAL_UART_TX_STATE_IDLE;
+    return HAL_ERROR;
+  }
+
+  /* Unlink the nodes of the previous transmission and link one node per segment */
+  HAL_Q_DeInit(&huart->tx_q);
+  (void)HAL_Q_Init(&huart->tx_q, &HAL_DMA_LinearAddressing_DescOps);
+  tdr_addr = (uint32_t)&(UART_GET_INSTANCE(huart)->TDR);
+  for (uint32_t i = 0U; i < iov_cnt; i++)
+  {
+    (void)HAL_DMA_FillNodeData(&huart->p_tx_nodes[i], (uint32_t)p_iov[i].p_data, tdr_addr, p_iov[i].size_byte);
+    if (HAL_Q_InsertNode_Tail(&huart->tx_q, &huart->p_tx_nodes[i]) != HAL_OK)
+    {
+      huart->tx_state = HAL_UART_TX_STATE_IDLE;
+      return HAL_ERROR;
+    }
+    size_byte += p_iov[i].size_byte;
+  }
+
+  return UART_Start_Transmit_DMA(huart, (const uint8_t *)p_iov[0].p_data, size_byte, HAL_UART_OPT_DMA_TX_IT_NONE,
+                                 UART_DMA_TX_NODES);
 }
+#endif /* USE_HAL_DMA_LINKEDLIST */
 
 /**
   * @brief Receive an amount of data in DMA mode.
@@ -5750,7 +5963,7 @@ void HAL_UART_IRQHandler(hal_uart_handle_t *huart)
     hal_uart_rx_event_types_t rx_type = HAL_UART_RX_EVENT_TC;
     uint32_t it_to_clear = 0U;
 
-    if ((reception_type == HAL_UART_RX_TO_IDLE)
+    if (((reception_type == HAL_UART_RX_TO_IDLE) || (reception_type == HAL_UART_RX_STREAM))
         && ((isr_flags & LL_USART_ISR_IDLE) != 0U)
         && ((cr1_its & LL_USART_CR1_IDLEIE) != 0U))
     {
@@ -5781,6 +5994,14 @@ void HAL_UART_IRQHandler(hal_uart_handle_t *huart)
     if (rx_type != HAL_UART_RX_EVENT_TC)
     {
 #if defined (USE_HAL_UART_DMA) && (USE_HAL_UART_DMA == 1U)
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+      if (reception_type == HAL_UART_RX_STREAM)
+      {
+        /* The reception goes on: report the data received since the last event */
+        UART_RxStreamUpdate(huart, rx_type);
+        return;
+      }
+#endif /* USE_HAL_DMA_LINKEDLIST */
       if (LL_USART_IsEnabledDMAReq_RX(p_uartx) != 0U)
       {
         uint32_t nb_remaining_rx_data =
@@ -5960,6 +6181,14 @@ void HAL_UART_IRQHandler(hal_uart_handle_t *huart)
       - HAL_UART_ReceiveUntilCM_DMA(): in DMA mode
       - HAL_UART_ReceiveUntilCM_DMA_Opt(): in DMA mode, with Optional interrupts selection
 
+  A continuous reception method is provided, when the Rx DMA channel is in linked-list circular mode
+  (see HAL_DMA_SetConfigPeriphLinkedListCircularXfer()):
+    - HAL_UART_StartRxStream_DMA(): receive without interruption in a circular buffer. The new data are
+      reported in place as (offset, size) spans by HAL_UART_RxStreamCallback() on IDLE, half and full buffer events.
+    - HAL_UART_ConsumeRx(): release the oldest reported bytes once processed.
+    - HAL_UART_GetRxStreamCount(): get the number of reported bytes not yet consumed.
+    - The reception is stopped by HAL_UART_AbortReceive() or HAL_UART_AbortReceive_IT().
+
   To send break character in LIN mode:
     - HAL_UART_SendLINBreak()
 
@@ -6923,6 +7152,125 @@ hal_status_t HAL_UART_ReceiveUntilCM_DMA_Opt(hal_uart_handle_t *huart, void *p_d
                                  interrupts));
 }
 
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+/**
+  * @brief Start a continuous reception in DMA mode in a circular buffer.
+  * @param huart              Pointer to a \ref hal_uart_handle_t structure which contains the UART instance.
+  * @param p_data             Pointer to the circular reception buffer.
+  * @param size_byte          Size of the circular reception buffer in bytes, up to 65535.
+  * @note  The Rx DMA channel must have been configured in linked-list circular mode with
+  *        HAL_DMA_SetConfigPeriphLinkedListCircularXfer(): its node is updated with the buffer and the UART
+  *        data register, then the DMA loops on it without any software restart.
+  * @note  The new data are reported in place by HAL_UART_RxStreamCallback() with their offset in the buffer
+  *        and their size, on IDLE, half buffer (HAL_UART_RX_EVENT_HT) and full buffer (HAL_UART_RX_EVENT_TC)
+  *        events. The callback is called twice when the new data wrap around the end of the buffer.
+  * @note  The DMA has no flow control: it keeps writing and the reported data remain valid only until it comes
+  *        back over them, size_byte bytes after they were received. HAL_UART_ConsumeRx() does not hold the DMA
+  *        back, it only releases the data for the overrun detection. When the reported data not yet consumed
+  *        are overwritten, or when the DMA completed a whole lap of the buffer between two events, the data not
+  *        consumed are dropped and HAL_UART_RECEIVE_ERROR_STREAM_OVR is set in the last error codes.
+  * @note  A whole lap is detected from the half and full buffer events, provided they are not delayed by more
+  *        than one lap of the buffer: the DMA flags of the events missed meanwhile are merged.
+  * @note  The reception is stopped by HAL_UART_AbortReceive() or HAL_UART_AbortReceive_IT().
+  * @warning The 9 bits data width without parity is not supported.
+  * @retval HAL_OK            Operation completed successfully.
+  * @retval HAL_BUSY          Concurrent process ongoing.
+  * @retval HAL_INVALID_PARAM Invalid parameter.
+  * @retval HAL_ERROR         DMA handler not in linked-list circular mode or Error during instance enabling.
+  */
+hal_status_t HAL_UART_StartRxStream_DMA(hal_uart_handle_t *huart, void *p_data, uint32_t size_byte)
+{
+  ASSERT_DBG_PARAM(huart != NULL);
+  ASSERT_DBG_PARAM(p_data != NULL);
+  ASSERT_DBG_PARAM(size_byte != 0);
+  ASSERT_DBG_PARAM(size_byte <= 0xFFFFU);
+  ASSERT_DBG_PARAM(huart->hdma_rx != NULL);
+  ASSERT_DBG_PARAM(LL_USART_GetDataWidth(UART_GET_INSTANCE(huart)) != LL_USART_DATAWIDTH_9_BIT);
+  ASSERT_DBG_STATE(huart->global_state, HAL_UART_STATE_CONFIGURED);
+  ASSERT_DBG_STATE(huart->rx_state, HAL_UART_RX_STATE_IDLE);
+
+#if defined(USE_HAL_CHECK_PARAM) && (USE_HAL_CHECK_PARAM == 1)
+  /* The DMA block data length is 16 bits */
+  if ((p_data == NULL) || (size_byte == 0U) || (size_byte > 0xFFFFU))
+  {
+    return HAL_INVALID_PARAM;
+  }
+#endif /* USE_HAL_CHECK_PARAM */
+
+  if ((huart->hdma_rx == NULL) || (huart->hdma_rx->xfer_mode != HAL_DMA_XFER_MODE_LINKEDLIST_CIRCULAR))
+  {
+    return HAL_ERROR;
+  }
+
+  HAL_CHECK_UPDATE_STATE(huart, rx_state, HAL_UART_RX_STATE_IDLE, HAL_UART_RX_STATE_ACTIVE);
+
+  huart->reception_type = HAL_UART_RX_STREAM;
+  huart->rx_stream_wr_byte = 0U;
+  huart->rx_stream_rd_byte = 0U;
+  huart->rx_stream_count_byte = 0U;
+  huart->rx_stream_evt_nbr = 0U;
+  huart->rx_stream_wr_cross_nbr = 0U;
+
+  /* IDLE interrupt as in the reception to IDLE mode, half and full buffer DMA interrupts */
+  return (UART_Start_Receive_DMA(huart, (uint8_t *)p_data, size_byte, HAL_UART_RX_TO_IDLE,
+                                 HAL_UART_OPT_DMA_RX_IT_HT));
+}
+
+/**
+  * @brief Release the oldest bytes reported by the reception stream.
+  * @param huart              Pointer to a \ref hal_uart_handle_t structure which contains the UART instance.
+  * @param size_byte          Number of bytes processed by the application.
+  * @note  This function can be called from HAL_UART_RxStreamCallback().
+  * @retval HAL_OK            Operation completed successfully.
+  * @retval HAL_INVALID_PARAM size_byte greater than the number of bytes reported and not consumed.
+  */
+hal_status_t HAL_UART_ConsumeRx(hal_uart_handle_t *huart, uint32_t size_byte)
+{
+  uint32_t primask_bit;
+  uint32_t rd;
+
+  ASSERT_DBG_PARAM(huart != NULL);
+  ASSERT_DBG_PARAM(size_byte <= huart->rx_stream_count_byte);
+
+  /* Enter critical section: the reception stream is updated under interrupt */
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+
+#if defined(USE_HAL_CHECK_PARAM) && (USE_HAL_CHECK_PARAM == 1)
+  if (size_byte > huart->rx_stream_count_byte)
+  {
+    __set_PRIMASK(primask_bit);
+    return HAL_INVALID_PARAM;
+  }
+#endif /* USE_HAL_CHECK_PARAM */
+
+  rd = huart->rx_stream_rd_byte + size_byte;
+  if (rd >= huart->rx_xfer_size)
+  {
+    rd -= huart->rx_xfer_size;
+  }
+  huart->rx_stream_rd_byte = rd;
+  huart->rx_stream_count_byte -= size_byte;
+
+  /* Exit critical section */
+  __set_PRIMASK(primask_bit);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief Return the number of bytes reported by the reception stream and not consumed.
+  * @param huart Pointer to a \ref hal_uart_handle_t structure which contains the UART instance.
+  * @retval uint32_t Number of bytes, starting at the offset of the oldest span not consumed.
+  */
+uint32_t HAL_UART_GetRxStreamCount(const hal_uart_handle_t *huart)
+{
+  ASSERT_DBG_PARAM(huart != NULL);
+
+  return huart->rx_stream_count_byte;
+}
+#endif /* USE_HAL_DMA_LINKEDLIST */
+
 /**
   * @}
   */
@@ -7290,6 +7638,30 @@ __WEAK void HAL_UART_ClearToSendCallback(hal_uart_handle_t *huart)
    */
 }
 
+#if defined (USE_HAL_UART_DMA) && (USE_HAL_UART_DMA == 1) \
+    && defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+/**
+  * @brief Rx stream callback, new data available in the reception stream buffer.
+  * @param huart Pointer to a \ref hal_uart_handle_t structure which contains the UART instance.
+  * @param offset_byte offset of the new data in the reception stream buffer
+  * @param size_byte number of new bytes, contiguous from offset_byte
+  * @param rx_event event which triggered the callback
+  */
+__WEAK void HAL_UART_RxStreamCallback(hal_uart_handle_t *huart, uint32_t offset_byte, uint32_t size_byte,
+                                      hal_uart_rx_event_types_t rx_event)
+{
+  /* Prevent unused argument(s) compilation warning */
+  STM32_UNUSED(huart);
+  STM32_UNUSED(offset_byte);
+  STM32_UNUSED(size_byte);
+  STM32_UNUSED(rx_event);
+
+  /** @warning This function must not be modified, when the callback is needed,
+               the HAL_UART_RxStreamCallback can be implemented in the user file.
+   */
+}
+#endif /* USE_HAL_UART_DMA && USE_HAL_DMA_LINKEDLIST */
+
 /**
   * @}
   */
@@ -7320,6 +7692,10 @@ void UART_InitCallbacksToDefault(hal_uart_handle_t *huart)
   huart->p_tx_fifo_empty_callback       = HAL_UART_TxFifoEmptyCallback;      /* Legacy weak TxFifoEmptyCallback       */
   huart->p_clear_to_send_callback       = HAL_UART_ClearToSendCallback;      /* Legacy weak ClearToSendCallback       */
   huart->p_lin_break_callback           = HAL_UART_LINBreakCallback;         /* Legacy weak LINBreakCallback          */
+#if defined (USE_HAL_UART_DMA) && (USE_HAL_UART_DMA == 1) \
+    && defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+  huart->p_rx_stream_callback           = HAL_UART_RxStreamCallback;         /* Legacy weak RxStreamCallback          */
+#endif /* USE_HAL_UART_DMA && USE_HAL_DMA_LINKEDLIST */
 }
 #endif /* USE_HAL_UART_REGISTER_CALLBACKS */
 
@@ -7929,6 +8305,8 @@ hal_status_t UART_Start_Receive_DMA(hal_uart_handle_t *huart, uint8_t *p_data, u
   * @param  p_data Pointer to data buffer (u8 or u16 data elements).
   * @param  size  Amount of data elements (u8 or u16) to be received.
   * @param  interrupts List of optional interruptions to activate.
+  * @param  xfer_source UART_DMA_TX_BUFFER to transfer p_data, UART_DMA_TX_NODES to run the Tx nodes linked in tx_q,
+  *                     p_data being then the first segment.
   * @note   This function could be called by all HAL UART API providing transmission in DMA mode.
   * @note   When calling this function, parameters validity is considered as already checked,
   *         i.e. Rx State, buffer address, ...
@@ -7937,10 +8315,11 @@ hal_status_t UART_Start_Receive_DMA(hal_uart_handle_t *huart, uint8_t *p_data, u
   * @retval HAL_ERROR DMA did not start.
   */
 hal_status_t UART_Start_Transmit_DMA(hal_uart_handle_t *huart, const uint8_t *p_data, uint32_t size,
-                                     uint32_t interrupts)
+                                     uint32_t interrupts, uint32_t xfer_source)
 {
   USART_TypeDef *p_uartx;
   uint32_t interrupts_dma;
+  hal_status_t status;
 
   p_uartx = UART_GET_INSTANCE(huart);
   huart->p_tx_buff     = p_data;
@@ -7981,8 +8360,20 @@ hal_status_t UART_Start_Transmit_DMA(hal_uart_handle_t *huart, const uint8_t *p_
 
     huart->hdma_tx->p_xfer_error_cb = UART_DMAError;
 
-    if (HAL_DMA_StartPeriphXfer_IT_Opt(huart->hdma_tx, (uint32_t)huart->p_tx_buff, (uint32_t)&p_uartx->TDR,
-                                       size, interrupts_dma) != HAL_OK)
+#if defined(USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+    if (xfer_source == UART_DMA_TX_NODES)
+    {
+      status = HAL_DMA_StartLinkedListXfer_IT_Opt(huart->hdma_tx, &huart->tx_q, interrupts_dma);
+    }
+    else
+#else
+    (void)xfer_source;
+#endif /* USE_HAL_DMA_LINKEDLIST */
+    {
+      status = HAL_DMA_StartPeriphXfer_IT_Opt(huart->hdma_tx, (uint32_t)huart->p_tx_buff, (uint32_t)&p_uartx->TDR,
+                                              size, interrupts_dma);
+    }
+    if (status != HAL_OK)
     {
       huart->tx_state = HAL_UART_TX_STATE_IDLE;
 #if defined (USE_HAL_UART_GET_LAST_ERRORS) && (USE_HAL_UART_GET_LAST_ERRORS == 1)
@@ -8041,7 +8432,7 @@ static void UART_EndRxTransfer(hal_uart_handle_t *huart)
   LL_USART_DisableIT_CR3(p_uartx, (LL_USART_CR3_EIE | LL_USART_CR3_RXFTIE));
 
   /* In case of reception waiting for IDLE event, disable also the IDLE IE interrupt source */
-  if (huart->reception_type == HAL_UART_RX_TO_IDLE)
+  if ((huart->reception_type == HAL_UART_RX_TO_IDLE) || (huart->reception_type == HAL_UART_RX_STREAM))
   {
     LL_USART_DisableIT_IDLE(p_uartx);
     LL_USART_ClearFlag_IDLE(p_uartx);
@@ -8083,7 +8474,7 @@ static void UART_DMATransmitCplt(hal_dma_handle_t *hdma)
   USART_TypeDef *p_uartx = UART_GET_INSTANCE(huart);
 
 #if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
-  if (hdma->xfer_mode == HAL_DMA_XFER_MODE_DIRECT)
+  if (hdma->xfer_mode != HAL_DMA_XFER_MODE_LINKEDLIST_CIRCULAR)
 #endif /* USE_HAL_DMA_LINKEDLIST */
   {
     huart->tx_xfer_count = 0U;
@@ -8132,7 +8523,13 @@ static void UART_DMAReceiveCplt(hal_dma_handle_t *hdma)
   USART_TypeDef *p_uartx = UART_GET_INSTANCE(huart);
 
 #if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
-  if (hdma->xfer_mode == HAL_DMA_XFER_MODE_DIRECT)
+  if (huart->reception_type == HAL_UART_RX_STREAM)
+  {
+    UART_RxStreamUpdate(huart, HAL_UART_RX_EVENT_TC);
+    return;
+  }
+
+  if (hdma->xfer_mode != HAL_DMA_XFER_MODE_LINKEDLIST_CIRCULAR)
 #endif /* USE_HAL_DMA_LINKEDLIST */
   {
     huart->rx_xfer_count = 0U;
@@ -8177,6 +8574,14 @@ static void UART_DMARxHalfCplt(hal_dma_handle_t *hdma)
 {
   hal_uart_handle_t *huart = (hal_uart_handle_t *)(hdma->p_parent);
 
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+  if (huart->reception_type == HAL_UART_RX_STREAM)
+  {
+    UART_RxStreamUpdate(huart, HAL_UART_RX_EVENT_HT);
+    return;
+  }
+
+#endif /* USE_HAL_DMA_LINKEDLIST */
 #if defined(USE_HAL_UART_REGISTER_CALLBACKS) && (USE_HAL_UART_REGISTER_CALLBACKS == 1)
   huart->p_rx_half_cplt_callback(huart);
 #else
@@ -8449,6 +8854,116 @@ static void UART_DMAAbortOnSuccessCallback(hal_dma_handle_t *hdma)
   HAL_UART_RxCpltCallback(huart, (rx_size - nb_remaining_rx_data), rx_type);
 #endif /* USE_HAL_UART_REGISTER_CALLBACKS */
 }
+
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+/**
+  * @brief Report the data received by the reception stream since the last event.
+  * @param huart Pointer to a \ref hal_uart_handle_t structure which contains the UART instance.
+  * @param rx_event event which triggered the update
+  * @note  The write position is computed from the DMA remaining data counter, so that an event handled late
+  *        also reports the data received after it. The new data are reported as one span, or two when they
+  *        wrap around the end of the buffer.
+  * @note  The position alone cannot tell a whole lap of the DMA from no data. The half and full buffer events,
+  *        handled or still pending in the DMA flags, are counted and compared with the number of half and full
+  *        buffer boundaries passed by the reported position: more events than boundaries means that the DMA
+  *        passed the reported position.
+  */
+static void UART_RxStreamUpdate(hal_uart_handle_t *huart, hal_uart_rx_event_types_t rx_event)
+{
+  uint32_t primask_bit;
+  uint32_t size = huart->rx_xfer_size;
+  uint32_t half = size / 2U;
+  DMA_Channel_TypeDef *p_dma_channel = (DMA_Channel_TypeDef *)(uint32_t)huart->hdma_rx->instance;
+  uint32_t evt_nbr;
+  uint32_t wr;
+  uint32_t pos;
+  uint32_t end;
+  uint32_t new_size;
+  uint32_t first_size;
+
+  /* Enter critical section: the reception stream is updated from the UART and the DMA interrupts */
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+
+  if ((rx_event == HAL_UART_RX_EVENT_HT) || (rx_event == HAL_UART_RX_EVENT_TC))
+  {
+    huart->rx_stream_evt_nbr++;
+  }
+
+  /* Events pending before the position is read: the DMA may set a flag after the read, never before its boundary */
+  evt_nbr = huart->rx_stream_evt_nbr + LL_DMA_IsActiveFlag_HT(p_dma_channel) + LL_DMA_IsActiveFlag_TC(p_dma_channel);
+
+  wr = huart->rx_stream_wr_byte;
+  pos = size - LL_DMA_GetBlkDataLength(p_dma_channel);
+  if (pos >= size)
+  {
+    pos = 0U;
+  }
+  new_size = (pos >= wr) ? (pos - wr) : ((size - wr) + pos);
+
+  /* Half and full buffer boundaries passed from wr to wr + new_size */
+  end = wr + new_size;
+  if (((wr < half) && (end >= half)) || (end >= (size + half)))
+  {
+    huart->rx_stream_wr_cross_nbr++;
+  }
+  if (end >= size)
+  {
+    huart->rx_stream_wr_cross_nbr++;
+  }
+
+  /* Fewer events than boundaries is an event not raised yet */
+  if ((int32_t)(evt_nbr - huart->rx_stream_wr_cross_nbr) > 0)
+  {
+    /* The DMA completed a whole lap since the last update: all the data not consumed have been overwritten.
+       The pending events are counted when handled. */
+    huart->rx_stream_rd_byte = wr;
+    huart->rx_stream_count_byte = 0U;
+    huart->rx_stream_wr_cross_nbr = evt_nbr;
+#if defined (USE_HAL_UART_GET_LAST_ERRORS) && (USE_HAL_UART_GET_LAST_ERRORS == 1)
+    huart->last_reception_error_codes |= HAL_UART_RECEIVE_ERROR_STREAM_OVR;
+#endif /* USE_HAL_UART_GET_LAST_ERRORS */
+  }
+  else if ((huart->rx_stream_count_byte + new_size) > size)
+  {
+    /* The unconsumed data have been overwritten: drop them */
+    huart->rx_stream_rd_byte = wr;
+    huart->rx_stream_count_byte = 0U;
+#if defined (USE_HAL_UART_GET_LAST_ERRORS) && (USE_HAL_UART_GET_LAST_ERRORS == 1)
+    huart->last_reception_error_codes |= HAL_UART_RECEIVE_ERROR_STREAM_OVR;
+#endif /* USE_HAL_UART_GET_LAST_ERRORS */
+  }
+  else
+  {
+    /* No overrun */
+  }
+  huart->rx_stream_count_byte += new_size;
+  huart->rx_stream_wr_byte = pos;
+
+  /* Exit critical section */
+  __set_PRIMASK(primask_bit);
+
+  if (new_size == 0U)
+  {
+    return;
+  }
+
+  first_size = ((wr + new_size) > size) ? (size - wr) : new_size;
+#if defined(USE_HAL_UART_REGISTER_CALLBACKS) && (USE_HAL_UART_REGISTER_CALLBACKS == 1)
+  huart->p_rx_stream_callback(huart, wr, first_size, rx_event);
+  if (first_size != new_size)
+  {
+    huart->p_rx_stream_callback(huart, 0U, new_size - first_size, rx_event);
+  }
+#else
+  HAL_UART_RxStreamCallback(huart, wr, first_size, rx_event);
+  if (first_size != new_size)
+  {
+    HAL_UART_RxStreamCallback(huart, 0U, new_size - first_size, rx_event);
+  }
+#endif /* USE_HAL_UART_REGISTER_CALLBACKS */
+}
+#endif /* USE_HAL_DMA_LINKEDLIST */
 #endif /* USE_HAL_UART_DMA */
 
 /**
@@ -381,6 +381,8 @@ typedef enum
   HAL_UART_RX_TO_RTO                = 2U,
   /*! Reception till completion or Character Match(CM) event */
   HAL_UART_RX_TO_CHAR_MATCH         = 3U,
+  /*! Continuous reception in a circular buffer, see HAL_UART_StartRxStream_DMA() */
+  HAL_UART_RX_STREAM                = 4U,
 } hal_uart_rx_modes_t;
 
 /**
@@ -396,6 +398,8 @@ typedef enum
   HAL_UART_RX_EVENT_RTO                = 2U,
   /*! RxEvent linked to Character Match event */
   HAL_UART_RX_EVENT_CHAR_MATCH              = 3U,
+  /*! RxEvent linked to Half Transfer event, reception stream only */
+  HAL_UART_RX_EVENT_HT                     = 4U,
 } hal_uart_rx_event_types_t;
 
 /** @defgroup UART_FIFO_Mode UART FIFO Mode Definition
@@ -747,6 +751,19 @@ typedef enum
 /*! HAL UART handler type */
 typedef struct hal_uart_handle_s hal_uart_handle_t;
 
+#if defined (USE_HAL_UART_DMA) && (USE_HAL_UART_DMA == 1) \
+    && defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+/*! HAL UART transmit segment, see HAL_UART_TransmitV_DMA() */
+typedef struct
+{
+  /*! Pointer to the segment data */
+  const void *p_data;
+
+  /*! Size of the segment in bytes */
+  uint32_t size_byte;
+} hal_uart_iovec_t;
+#endif /* USE_HAL_UART_DMA && USE_HAL_DMA_LINKEDLIST */
+
 #if defined(USE_HAL_UART_REGISTER_CALLBACKS) && (USE_HAL_UART_REGISTER_CALLBACKS == 1)
 /*! HAL UART Generic UART callback Type */
 typedef void (* hal_uart_cb_t)(hal_uart_handle_t *huart);
@@ -754,6 +771,13 @@ typedef void (* hal_uart_cb_t)(hal_uart_handle_t *huart);
 /*! HAL UART Reception Complete Callback Pointer Type */
 typedef void (* hal_uart_rx_cplt_cb_t)(hal_uart_handle_t *huart, uint32_t size_byte,
                                        hal_uart_rx_event_types_t rx_event);
+
+#if defined (USE_HAL_UART_DMA) && (USE_HAL_UART_DMA == 1) \
+    && defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+/*! HAL UART Reception Stream Callback Pointer Type */
+typedef void (* hal_uart_rx_stream_cb_t)(hal_uart_handle_t *huart, uint32_t offset_byte, uint32_t size_byte,
+                                         hal_uart_rx_event_types_t rx_event);
+#endif /* USE_HAL_UART_DMA && USE_HAL_DMA_LINKEDLIST */
 #endif /* USE_HAL_UART_REGISTER_CALLBACKS */
 
 /**
@@ -810,6 +834,32 @@ struct hal_uart_handle_s
   /*! USART Rx DMA Handle parameters      */
   hal_dma_handle_t *hdma_rx;
 
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+  /*! Tx DMA linked-list of the segments of HAL_UART_TransmitV_DMA() */
+  hal_q_t tx_q;
+
+  /*! Tx DMA nodes, one per segment */
+  hal_dma_node_t *p_tx_nodes;
+
+  /*! Number of Tx DMA nodes */
+  uint32_t tx_node_nbr;
+
+  /*! Reception stream: offset of the next byte to be reported */
+  volatile uint32_t rx_stream_wr_byte;
+
+  /*! Reception stream: offset of the next byte to be consumed */
+  volatile uint32_t rx_stream_rd_byte;
+
+  /*! Reception stream: number of bytes reported and not consumed */
+  volatile uint32_t rx_stream_count_byte;
+
+  /*! Reception stream: number of half and full buffer DMA events */
+  volatile uint32_t rx_stream_evt_nbr;
+
+  /*! Reception stream: number of half and full buffer boundaries passed by the reported data */
+  volatile uint32_t rx_stream_wr_cross_nbr;
+
+#endif /* USE_HAL_DMA_LINKEDLIST */
 #endif /* USE_HAL_UART_DMA */
   /*! USART state information related to global Handle management */
   volatile hal_uart_state_t global_state;
@@ -857,6 +907,12 @@ struct hal_uart_handle_s
   /*! USART LIN Break Callback         */
   hal_uart_cb_t p_lin_break_callback;
 
+#if defined (USE_HAL_UART_DMA) && (USE_HAL_UART_DMA == 1) \
+    && defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+  /*! USART Rx Stream Callback               */
+  hal_uart_rx_stream_cb_t p_rx_stream_callback;
+
+#endif /* USE_HAL_UART_DMA && USE_HAL_DMA_LINKEDLIST */
 #endif /* USE_HAL_UART_REGISTER_CALLBACKS */
 #if defined(USE_HAL_MUTEX) && (USE_HAL_MUTEX == 1)
   /*! USART OS semaphore */
@@ -1063,6 +1119,11 @@ typedef struct
 
 /*! Receiver Timeout error on RX */
 #define HAL_UART_RECEIVE_ERROR_RTO      (0x1UL << 5U)
+
+#if defined (USE_HAL_UART_DMA) && (USE_HAL_UART_DMA == 1U)
+/*! Reception stream overrun: data overwritten before being consumed */
+#define HAL_UART_RECEIVE_ERROR_STREAM_OVR (0x1UL << 6U)
+#endif /* USE_HAL_UART_DMA */
 /**
   * @}
   */
@@ -1377,6 +1438,10 @@ hal_uart_am_idle_frame_status_t HAL_UART_AM_IsEnabledIdle(const hal_uart_handle_
 #if defined (USE_HAL_UART_DMA) && (USE_HAL_UART_DMA == 1)
 hal_status_t HAL_UART_SetTxDMA(hal_uart_handle_t *huart, hal_dma_handle_t *hdma_tx);
 hal_status_t HAL_UART_SetRxDMA(hal_uart_handle_t *huart, hal_dma_handle_t *hdma_rx);
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+hal_status_t HAL_UART_SetTxDMANodes(hal_uart_handle_t *huart, hal_dma_node_t *p_nodes, uint32_t node_nbr,
+                                    const hal_dma_node_config_t *p_node_config);
+#endif /* USE_HAL_DMA_LINKEDLIST */
 #endif /* USE_HAL_UART_DMA */
 
 /**
@@ -1404,6 +1469,11 @@ hal_status_t HAL_UART_RegisterClearToSendCallback(hal_uart_handle_t *huart, hal_
 
 hal_status_t HAL_UART_RegisterLINBreakCallback(hal_uart_handle_t *huart, hal_uart_cb_t p_callback);
 
+#if defined (USE_HAL_UART_DMA) && (USE_HAL_UART_DMA == 1) \
+    && defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+hal_status_t HAL_UART_RegisterRxStreamCallback(hal_uart_handle_t *huart, hal_uart_rx_stream_cb_t p_callback);
+#endif /* USE_HAL_UART_DMA && USE_HAL_DMA_LINKEDLIST */
+
 #endif /* USE_HAL_UART_REGISTER_CALLBACKS */
 
 /**
@@ -1427,6 +1497,9 @@ hal_status_t HAL_UART_Transmit_DMA(hal_uart_handle_t *huart, const void *p_data,
 hal_status_t HAL_UART_Receive_DMA(hal_uart_handle_t *huart, void *p_data, uint32_t size_byte);
 hal_status_t HAL_UART_Transmit_DMA_Opt(hal_uart_handle_t *huart, const void *p_data, uint32_t size_byte,
                                        uint32_t interrupts);
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+hal_status_t HAL_UART_TransmitV_DMA(hal_uart_handle_t *huart, const hal_uart_iovec_t *p_iov, uint32_t iov_cnt);
+#endif /* USE_HAL_DMA_LINKEDLIST */
 hal_status_t HAL_UART_Receive_DMA_Opt(hal_uart_handle_t *huart, void *p_data, uint32_t size_byte, uint32_t interrupts);
 hal_status_t HAL_UART_Pause_DMA(hal_uart_handle_t *huart);
 hal_status_t HAL_UART_PauseReceive_DMA(hal_uart_handle_t *huart);
@@ -1491,6 +1564,12 @@ hal_status_t HAL_UART_ReceiveUntilTMO_DMA_Opt(hal_uart_handle_t *huart, void *p_
                                               uint32_t char_timeout_bit, uint32_t interrupts);
 hal_status_t HAL_UART_ReceiveUntilCM_DMA_Opt(hal_uart_handle_t *huart, void *p_data, uint32_t size_byte,
                                              uint8_t character, uint32_t interrupts);
+
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+hal_status_t HAL_UART_StartRxStream_DMA(hal_uart_handle_t *huart, void *p_data, uint32_t size_byte);
+hal_status_t HAL_UART_ConsumeRx(hal_uart_handle_t *huart, uint32_t size_byte);
+uint32_t HAL_UART_GetRxStreamCount(const hal_uart_handle_t *huart);
+#endif /* USE_HAL_DMA_LINKEDLIST */
 #endif /* USE_HAL_UART_DMA */
 
 /**
@@ -1564,6 +1643,12 @@ void HAL_UART_TxFifoEmptyCallback(hal_uart_handle_t *huart);
 void HAL_UART_LINBreakCallback(hal_uart_handle_t *huart);
 void HAL_UART_ClearToSendCallback(hal_uart_handle_t *huart);
 
+#if defined (USE_HAL_UART_DMA) && (USE_HAL_UART_DMA == 1) \
+    && defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+void HAL_UART_RxStreamCallback(hal_uart_handle_t *huart, uint32_t offset_byte, uint32_t size_byte,
+                               hal_uart_rx_event_types_t rx_event);
+#endif /* USE_HAL_UART_DMA && USE_HAL_DMA_LINKEDLIST */
+
 /**
   * @}
   */
@@ -137,6 +137,8 @@ extern "C" {
 #define USE_HAL_CRC_MODULE                      1U
 #define USE_HAL_CRC_CLK_ENABLE_MODEL            HAL_CLK_ENABLE_NO
 #define USE_HAL_CRC_USER_DATA                   0U
+#define USE_HAL_CRC_REGISTER_CALLBACKS          0U
+#define USE_HAL_CRC_DMA                         1U
 
 /* ########################## HAL_CRS Config #################################### */
 #define USE_HAL_CRS_MODULE                      1U
@@ -400,6 +402,10 @@ extern "C" {
 /* ########################## HAL_PWR Config #################################### */
 #define USE_HAL_PWR_MODULE                      1U
 
+/* ########################## HAL_Q Config ###################################### */
+#define USE_HAL_Q_CHECK_NODES                   1U
+#define USE_HAL_Q_SHADOW_INDEX                  0U
+
 /* ########################## HAL_RAMCFG Config ################################# */
 #define USE_HAL_RAMCFG_MODULE                   1U
 
@@ -0,0 +1,304 @@
+/**
+  ******************************************************************************
+  * @file    bench_hal_q.c
+  * @brief   Host microbenchmark of the HAL Q node operations
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ * Queues of 16, 256 and 4096 nodes in direct addressing, built once per configuration of the Q module
+ * (USE_HAL_Q_CHECK_NODES, USE_HAL_Q_SHADOW_INDEX, set by CMakeLists.txt):
+ * - middle-insert build: each node inserted after a node already in the Q,
+ * - random removal: all the nodes removed in a random order,
+ * - tail-insert build against HAL_Q_BuildFromArray().
+ * Each queue is checked against a reference list, and the link reads of the operations are counted: they do not
+ * depend on the host, and are bounded per node when the configuration leaves out the walks. The times are the best
+ * of several runs on the host clock. The HAL is compiled with the instrumentation of the model, so they compare the
+ * configurations with each other, not with the target.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "host_test.h"
+#include "stm32_hal.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define NODE_MAX          4096U
+#define RUN_OPS           (4U * NODE_MAX)      /*!< Node operations of the runs of a size, the best one kept */
+#define LIST_END          0xFFFFFFFFU
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t next;                      /*!< Address of the next node, 0 at the tail */
+  uint32_t data;
+} bench_node_t;
+
+typedef struct
+{
+  double best_us;
+  uint64_t link_read_nbr;
+} bench_result_t;
+
+/* Private variables ---------------------------------------------------------*/
+static hal_q_t Q;
+static bench_node_t Nodes[NODE_MAX];
+static uint32_t RefNext[NODE_MAX];     /*!< Reference list: index of the next node, LIST_END at the tail */
+static uint32_t RefHead;
+static uint32_t Order[NODE_MAX];
+static uint64_t LinkReadNbr;
+#if defined(USE_HAL_Q_SHADOW_INDEX) && (USE_HAL_Q_SHADOW_INDEX == 1U)
+static void *PrevIndex[NODE_MAX];
+#endif /* USE_HAL_Q_SHADOW_INDEX */
+
+/* Private functions ---------------------------------------------------------*/
+static void Bench_GetNodeInfo(uint32_t *p_offset, hal_q_addressing_mode_t *p_addressing_mode)
+{
+  *p_offset = offsetof(bench_node_t, next);
+  *p_addressing_mode = HAL_Q_ADDRESSING_DIRECT;
+}
+
+static void Bench_SetNode(uint32_t head, uint32_t prev, uint32_t next, uint32_t offset)
+{
+  (void)head;
+  *(uint32_t *)(uintptr_t)(prev + offset) = next;
+}
+
+static uint32_t Bench_GetNode(uint32_t head, uint32_t node, uint32_t offset)
+{
+  (void)head;
+  LinkReadNbr++;
+  return *(uint32_t *)(uintptr_t)(node + offset);
+}
+
+static const hal_q_desc_ops_t BenchOps = {Bench_GetNodeInfo, Bench_SetNode, Bench_GetNode};
+
+static double Now(void)
+{
+  struct timespec now;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &now);
+  return ((double)now.tv_sec * 1e6) + ((double)now.tv_nsec / 1e3);
+}
+
+static void Reset(uint32_t node_nbr)
+{
+  HAL_Q_DeInit(&Q);
+  (void)HAL_Q_Init(&Q, &BenchOps);
+#if defined(USE_HAL_Q_SHADOW_INDEX) && (USE_HAL_Q_SHADOW_INDEX == 1U)
+  (void)HAL_Q_SetShadowIndex(&Q, Nodes, sizeof(bench_node_t), node_nbr, PrevIndex);
+#else
+  (void)node_nbr;
+#endif /* USE_HAL_Q_SHADOW_INDEX */
+  RefHead = LIST_END;
+}
+
+/* Walk the Q and the reference list together */
+static void CheckQ(const char *p_step, uint32_t node_nbr)
+{
+  uint32_t node = (uint32_t)(uintptr_t)Q.p_head_node;
+  uint32_t ref = RefHead;
+  uint32_t walked = 0U;
+
+  CHECK(Q.node_nbr == node_nbr, "%s: %u node(s) instead of %u", p_step, (unsigned int)Q.node_nbr,
+        (unsigned int)node_nbr);
+  while ((ref != LIST_END) && (walked <= node_nbr))
+  {
+    if (node != (uint32_t)(uintptr_t)&Nodes[ref])
+    {
+      CHECK(0, "%s: node %u at position %u", p_step, (unsigned int)ref, (unsigned int)walked);
+      return;
+    }
+    node = ((const bench_node_t *)(uintptr_t)node)->next;
+    ref = RefNext[ref];
+    walked++;
+  }
+  CHECK((walked == node_nbr) && (node == 0U), "%s: %u node(s) walked", p_step, (unsigned int)walked);
+}
+
+/* Node i inserted after node (i - 1) / 2, so mostly in the middle of the Q */
+static void BuildMiddle(uint32_t node_nbr)
+{
+  (void)HAL_Q_InsertNode_Tail(&Q, &Nodes[0]);
+  for (uint32_t i = 1U; i < node_nbr; i++)
+  {
+    (void)HAL_Q_InsertNode(&Q, &Nodes[(i - 1U) / 2U], &Nodes[i]);
+  }
+}
+
+static void BuildMiddleRef(uint32_t node_nbr)
+{
+  RefHead = 0U;
+  RefNext[0] = LIST_END;
+  for (uint32_t i = 1U; i < node_nbr; i++)
+  {
+    const uint32_t prev = (i - 1U) / 2U;
+
+    RefNext[i] = RefNext[prev];
+    RefNext[prev] = i;
+  }
+}
+
+static void RemoveRandom(uint32_t node_nbr)
+{
+  for (uint32_t i = 0U; i < node_nbr; i++)
+  {
+    (void)HAL_Q_RemoveNode(&Q, &Nodes[Order[i]]);
+  }
+}
+
+static void BuildTail(uint32_t node_nbr)
+{
+  for (uint32_t i = 0U; i < node_nbr; i++)
+  {
+    (void)HAL_Q_InsertNode_Tail(&Q, &Nodes[i]);
+  }
+}
+
+static void BuildArray(uint32_t node_nbr)
+{
+  (void)HAL_Q_BuildFromArray(&Q, Nodes, sizeof(bench_node_t), node_nbr);
+}
+
+static void BuildTailRef(uint32_t node_nbr)
+{
+  RefHead = 0U;
+  for (uint32_t i = 0U; i < node_nbr; i++)
+  {
+    RefNext[i] = ((i + 1U) < node_nbr) ? (i + 1U) : LIST_END;
+  }
+}
+
+/* Best time of the runs of p_build, and its link reads, each run on an emptied Q checked after the build */
+static bench_result_t RunBuild(const char *p_step, uint32_t node_nbr, void (*p_build)(uint32_t),
+                               void (*p_build_ref)(uint32_t))
+{
+  const uint32_t run_nbr = RUN_OPS / node_nbr;
+  bench_result_t result = {0.0, 0U};
+
+  for (uint32_t run = 0U; run < run_nbr; run++)
+  {
+    double start;
+    double elapsed;
+
+    Reset(node_nbr);
+    LinkReadNbr = 0U;
+    start = Now();
+    p_build(node_nbr);
+    elapsed = Now() - start;
+    result.link_read_nbr = LinkReadNbr;
+    if ((run == 0U) || (elapsed < result.best_us))
+    {
+      result.best_us = elapsed;
+    }
+  }
+  p_build_ref(node_nbr);
+  CheckQ(p_step, node_nbr);
+  return result;
+}
+
+static bench_result_t RunRemoval(uint32_t node_nbr)
+{
+  const uint32_t run_nbr = RUN_OPS / node_nbr;
+  bench_result_t result = {0.0, 0U};
+
+  /* Same random order for every configuration */
+  srand(45);
+  for (uint32_t i = 0U; i < node_nbr; i++)
+  {
+    const uint32_t j = (uint32_t)rand() % (i + 1U);
+
+    Order[i] = Order[j];
+    Order[j] = i;
+  }
+
+  for (uint32_t run = 0U; run < run_nbr; run++)
+  {
+    double start;
+    double elapsed;
+
+    Reset(node_nbr);
+    BuildMiddle(node_nbr);
+    if (run == 0U)
+    {
+      /* Half of the nodes removed, the rest checked against the reference */
+      BuildMiddleRef(node_nbr);
+      RemoveRandom(node_nbr / 2U);
+      for (uint32_t i = 0U; i < (node_nbr / 2U); i++)
+      {
+        uint32_t *p_link = &RefHead;
+
+        while (*p_link != Order[i])
+        {
+          p_link = &RefNext[*p_link];
+        }
+        *p_link = RefNext[Order[i]];
+      }
+      CheckQ("random removal", node_nbr - (node_nbr / 2U));
+      Reset(node_nbr);
+      BuildMiddle(node_nbr);
+    }
+    LinkReadNbr = 0U;
+    start = Now();
+    RemoveRandom(node_nbr);
+    elapsed = Now() - start;
+    result.link_read_nbr = LinkReadNbr;
+    if ((run == 0U) || (elapsed < result.best_us))
+    {
+      result.best_us = elapsed;
+    }
+  }
+  CHECK((Q.node_nbr == 0U) && (Q.p_head_node == NULL), "random removal: %u node(s) left",
+        (unsigned int)Q.node_nbr);
+  return result;
+}
+
+/* Exported functions --------------------------------------------------------*/
+int main(void)
+{
+  static const uint32_t sizes[] = {16U, 256U, NODE_MAX};
+
+  HOST_TEST_Init();
+  printf("USE_HAL_Q_CHECK_NODES %u, USE_HAL_Q_SHADOW_INDEX %u: time in us (link reads per node)\n",
+         (unsigned int)USE_HAL_Q_CHECK_NODES, (unsigned int)USE_HAL_Q_SHADOW_INDEX);
+  for (uint32_t s = 0U; s < (sizeof(sizes) / sizeof(sizes[0])); s++)
+  {
+    const uint32_t node_nbr = sizes[s];
+    const bench_result_t middle = RunBuild("middle-insert build", node_nbr, BuildMiddle, BuildMiddleRef);
+    const bench_result_t removal = RunRemoval(node_nbr);
+    const bench_result_t tail = RunBuild("tail-insert build", node_nbr, BuildTail, BuildTailRef);
+    const bench_result_t array = RunBuild("HAL_Q_BuildFromArray", node_nbr, BuildArray, BuildTailRef);
+
+    printf("%4u nodes: middle-insert build %9.1f (%7.1f), random removal %9.1f (%7.1f), "
+           "tail-insert build %7.1f (%4.1f), BuildFromArray %7.1f (%4.1f)\n", (unsigned int)node_nbr,
+           middle.best_us, (double)middle.link_read_nbr / node_nbr, removal.best_us,
+           (double)removal.link_read_nbr / node_nbr, tail.best_us, (double)tail.link_read_nbr / node_nbr,
+           array.best_us, (double)array.link_read_nbr / node_nbr);
+
+    /* The walks left out by the configuration: a bounded number of link reads per node, whatever the Q size */
+#if defined(USE_HAL_Q_CHECK_NODES) && (USE_HAL_Q_CHECK_NODES == 0U)
+    CHECK(middle.link_read_nbr <= (3U * node_nbr), "%u nodes: %llu link reads for the middle-insert build",
+          (unsigned int)node_nbr, (unsigned long long)middle.link_read_nbr);
+#endif /* USE_HAL_Q_CHECK_NODES */
+#if defined(USE_HAL_Q_SHADOW_INDEX) && (USE_HAL_Q_SHADOW_INDEX == 1U)
+    CHECK(removal.link_read_nbr <= (4U * node_nbr), "%u nodes: %llu link reads for the random removal",
+          (unsigned int)node_nbr, (unsigned long long)removal.link_read_nbr);
+#endif /* USE_HAL_Q_SHADOW_INDEX */
+  }
+
+  return HOST_TEST_Report();
+}
@@ -0,0 +1,830 @@
+/**
+  ******************************************************************************
+  * @file    host_aes.c
+  * @brief   Host model of the AES coprocessor
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ * Modeled:
+ * - the AES-128 and AES-256 ciphers, in the ECB, CBC, CTR and GCM chaining modes, encryption and decryption;
+ * - the key derivation of the ECB and CBC decryption (MODE = 01), required before a decryption (MODE = 10): without
+ *   it, the decryption gives wrong data, as on the device when the key registers hold the encryption key;
+ * - the GCM phases: init (hash subkey, EN cleared at the end), header, payload (NPBLB padding bytes excluded from the
+ *   tag in encryption) and final (tag from the length block). The hash subkey and the running hash are kept in
+ *   SUSP4R..SUSP7R and SUSP0R..SUSP3R, so that a context saved and restored through these registers continues;
+ * - the input and output FIFOs of one block, the data swapping of DINR and DOUTR (except for the length block and the
+ *   tag of the final phase), the chaining value in IVR0..IVR3 after each block;
+ * - CCF in SR and ISR, RDERR and WRERR with RWEIF, KEYVALID once the key registers of the key size are written, IER,
+ *   ICR, the interrupt line and the DMA requests of the input and output phases, IPRST, the write-only key registers;
+ * - a block computed in BLOCK_CYCLES (128-bit key) or BLOCK_CYCLES_256 (256-bit key) cycles.
+ * Not modeled: CCM (its blocks complete with a null output), the SAES instance, the key modes other than normal,
+ * the shared and hardware keys, KEYPROT, the key and RNG errors, BUSY.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_model_internal.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define BLOCK_CYCLES         52U     /*!< Block with a 128-bit key      */
+#define BLOCK_CYCLES_256     74U     /*!< Block with a 256-bit key      */
+#define DERIVATION_CYCLES    80U     /*!< Key derivation                */
+#define INIT_CYCLES          60U     /*!< GCM hash subkey               */
+#define REQUEST_IN           87U     /*!< GPDMA1 request AES_IN         */
+#define REQUEST_OUT          88U     /*!< GPDMA1 request AES_OUT        */
+
+#define MODE_ENCRYPT         0U
+#define MODE_DERIVATION      1U
+#define MODE_DECRYPT         2U
+#define CHMOD_ECB            0U
+#define CHMOD_CBC            1U
+#define CHMOD_CTR            2U
+#define CHMOD_GCM            3U
+#define PHASE_INIT           0U
+#define PHASE_HEADER         1U
+#define PHASE_PAYLOAD        2U
+#define PHASE_FINAL          3U
+
+#define OP_NONE              0U
+#define OP_BLOCK             1U
+#define OP_DERIVATION        2U
+#define OP_INIT              3U
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t in[4];                      /*!< Input FIFO, swapped            */
+  uint32_t in_level;
+  uint32_t out[4];                     /*!< Output FIFO, before swapping   */
+  uint32_t out_level;
+  uint32_t out_index;
+  uint32_t op;                         /*!< Computation in progress        */
+  uint64_t done_at;                    /*!< End of the computation         */
+  uint32_t key[8];                     /*!< KEYR0..KEYR7, write-only       */
+  uint32_t key_words;                  /*!< Key registers written, by bit  */
+  uint32_t derived;                    /*!< Key derivation done            */
+  uint32_t flags;                      /*!< ISR CCF and RWEIF              */
+  uint32_t errors;                     /*!< SR RDERR and WRERR             */
+  host_model_aes_stats_t stats;
+} aes_state_t;
+
+/* Private variables ---------------------------------------------------------*/
+static aes_state_t Aes;
+
+static const uint8_t Sbox[256] =
+{
+  0x63, 0x7C, 0x77, 0x7B, 0xF2, 0x6B, 0x6F, 0xC5, 0x30, 0x01, 0x67, 0x2B, 0xFE, 0xD7, 0xAB, 0x76,
+  0xCA, 0x82, 0xC9, 0x7D, 0xFA, 0x59, 0x47, 0xF0, 0xAD, 0xD4, 0xA2, 0xAF, 0x9C, 0xA4, 0x72, 0xC0,
+  0xB7, 0xFD, 0x93, 0x26, 0x36, 0x3F, 0xF7, 0xCC, 0x34, 0xA5, 0xE5, 0xF1, 0x71, 0xD8, 0x31, 0x15,
+  0x04, 0xC7, 0x23, 0xC3, 0x18, 0x96, 0x05, 0x9A, 0x07, 0x12, 0x80, 0xE2, 0xEB, 0x27, 0xB2, 0x75,
+  0x09, 0x83, 0x2C, 0x1A, 0x1B, 0x6E, 0x5A, 0xA0, 0x52, 0x3B, 0xD6, 0xB3, 0x29, 0xE3, 0x2F, 0x84,
+  0x53, 0xD1, 0x00, 0xED, 0x20, 0xFC, 0xB1, 0x5B, 0x6A, 0xCB, 0xBE, 0x39, 0x4A, 0x4C, 0x58, 0xCF,
+  0xD0, 0xEF, 0xAA, 0xFB, 0x43, 0x4D, 0x33, 0x85, 0x45, 0xF9, 0x02, 0x7F, 0x50, 0x3C, 0x9F, 0xA8,
+  0x51, 0xA3, 0x40, 0x8F, 0x92, 0x9D, 0x38, 0xF5, 0xBC, 0xB6, 0xDA, 0x21, 0x10, 0xFF, 0xF3, 0xD2,
+  0xCD, 0x0C, 0x13, 0xEC, 0x5F, 0x97, 0x44, 0x17, 0xC4, 0xA7, 0x7E, 0x3D, 0x64, 0x5D, 0x19, 0x73,
+  0x60, 0x81, 0x4F, 0xDC, 0x22, 0x2A, 0x90, 0x88, 0x46, 0xEE, 0xB8, 0x14, 0xDE, 0x5E, 0x0B, 0xDB,
+  0xE0, 0x32, 0x3A, 0x0A, 0x49, 0x06, 0x24, 0x5C, 0xC2, 0xD3, 0xAC, 0x62, 0x91, 0x95, 0xE4, 0x79,
+  0xE7, 0xC8, 0x37, 0x6D, 0x8D, 0xD5, 0x4E, 0xA9, 0x6C, 0x56, 0xF4, 0xEA, 0x65, 0x7A, 0xAE, 0x08,
+  0xBA, 0x78, 0x25, 0x2E, 0x1C, 0xA6, 0xB4, 0xC6, 0xE8, 0xDD, 0x74, 0x1F, 0x4B, 0xBD, 0x8B, 0x8A,
+  0x70, 0x3E, 0xB5, 0x66, 0x48, 0x03, 0xF6, 0x0E, 0x61, 0x35, 0x57, 0xB9, 0x86, 0xC1, 0x1D, 0x9E,
+  0xE1, 0xF8, 0x98, 0x11, 0x69, 0xD9, 0x8E, 0x94, 0x9B, 0x1E, 0x87, 0xE9, 0xCE, 0x55, 0x28, 0xDF,
+  0x8C, 0xA1, 0x89, 0x0D, 0xBF, 0xE6, 0x42, 0x68, 0x41, 0x99, 0x2D, 0x0F, 0xB0, 0x54, 0xBB, 0x16,
+};
+
+/* Private functions ---------------------------------------------------------*/
+static host_model_periph_t AesPeriph;
+
+static AES_TypeDef *Regs(void)
+{
+  return (AES_TypeDef *)AesPeriph.base;
+}
+
+static uint32_t Field(uint32_t cr, uint32_t mask, uint32_t pos)
+{
+  return (cr & mask) >> pos;
+}
+
+static uint32_t Chmod(void)
+{
+  /* CHMOD[2] selects CCM, which is not modeled */
+  return ((Regs()->CR & AES_CR_CHMOD_2) != 0U) ? 0xFFU : Field(Regs()->CR, AES_CR_CHMOD, AES_CR_CHMOD_Pos);
+}
+
+static uint32_t Key256(void)
+{
+  return ((Regs()->CR & AES_CR_KEYSIZE) != 0U) ? 1U : 0U;
+}
+
+static uint32_t KeyValid(void)
+{
+  const uint32_t needed = (Key256() != 0U) ? 0xFFU : 0x0FU;
+
+  return ((Aes.key_words & needed) == needed) ? 1U : 0U;
+}
+
+/* Data swapping of DINR and DOUTR, its own inverse */
+static uint32_t Swap(uint32_t word)
+{
+  uint32_t result = 0U;
+
+  switch (Field(Regs()->CR, AES_CR_DATATYPE, AES_CR_DATATYPE_Pos))
+  {
+    case 1U:
+      result = (word << 16U) | (word >> 16U);
+      break;
+    case 2U:
+      result = __builtin_bswap32(word);
+      break;
+    case 3U:
+      for (uint32_t i = 0U; i < 32U; i++)
+      {
+        result |= ((word >> i) & 1U) << (31U - i);
+      }
+      break;
+    default:
+      result = word;
+      break;
+  }
+  return result;
+}
+
+static uint8_t Xtime(uint8_t value)
+{
+  return (uint8_t)((value << 1U) ^ (((value & 0x80U) != 0U) ? 0x1BU : 0x00U));
+}
+
+static uint8_t Mul(uint8_t a, uint8_t b)
+{
+  uint8_t result = 0U;
+
+  while (b != 0U)
+  {
+    if ((b & 1U) != 0U)
+    {
+      result ^= a;
+    }
+    a = Xtime(a);
+    b >>= 1U;
+  }
+  return result;
+}
+
+/* Round keys of the key registers, KEYR7 (256-bit) or KEYR3 (128-bit) holding the first word */
+static uint32_t ExpandKey(uint8_t round_keys[15][16])
+{
+  const uint32_t nk = (Key256() != 0U) ? 8U : 4U;
+  const uint32_t nr = nk + 6U;
+  uint8_t w[60][4];
+  uint8_t rcon = 1U;
+
+  for (uint32_t i = 0U; i < nk; i++)
+  {
+    const uint32_t word = Aes.key[nk - 1U - i];
+
+    for (uint32_t j = 0U; j < 4U; j++)
+    {
+      w[i][j] = (uint8_t)(word >> (24U - (8U * j)));
+    }
+  }
+  for (uint32_t i = nk; i < (4U * (nr + 1U)); i++)
+  {
+    uint8_t t[4] = {w[i - 1U][0], w[i - 1U][1], w[i - 1U][2], w[i - 1U][3]};
+
+    if ((i % nk) == 0U)
+    {
+      const uint8_t first = t[0];
+
+      t[0] = (uint8_t)(Sbox[t[1]] ^ rcon);
+      t[1] = Sbox[t[2]];
+      t[2] = Sbox[t[3]];
+      t[3] = Sbox[first];
+      rcon = Xtime(rcon);
+    }
+    else if ((nk == 8U) && ((i % nk) == 4U))
+    {
+      for (uint32_t j = 0U; j < 4U; j++)
+      {
+        t[j] = Sbox[t[j]];
+      }
+    }
+    else
+    {
+      /* Copy of the previous word */
+    }
+    for (uint32_t j = 0U; j < 4U; j++)
+    {
+      w[i][j] = w[i - nk][j] ^ t[j];
+    }
+  }
+  for (uint32_t r = 0U; r <= nr; r++)
+  {
+    for (uint32_t j = 0U; j < 16U; j++)
+    {
+      round_keys[r][j] = w[(4U * r) + (j / 4U)][j % 4U];
+    }
+  }
+  return nr;
+}
+
+static void Encrypt(uint8_t block[16])
+{
+  uint8_t keys[15][16];
+  const uint32_t nr = ExpandKey(keys);
+
+  for (uint32_t j = 0U; j < 16U; j++)
+  {
+    block[j] ^= keys[0][j];
+  }
+  for (uint32_t r = 1U; r <= nr; r++)
+  {
+    uint8_t s[16];
+
+    /* SubBytes and ShiftRows */
+    for (uint32_t j = 0U; j < 16U; j++)
+    {
+      s[j] = Sbox[block[((j + (4U * (j % 4U))) % 16U)]];
+    }
+    /* MixColumns, but in the last round */
+    for (uint32_t c = 0U; c < 4U; c++)
+    {
+      uint8_t *p_col = &s[4U * c];
+      const uint8_t a0 = p_col[0];
+      const uint8_t a1 = p_col[1];
+      const uint8_t a2 = p_col[2];
+      const uint8_t a3 = p_col[3];
+
+      if (r < nr)
+      {
+        p_col[0] = (uint8_t)(Xtime(a0) ^ Xtime(a1) ^ a1 ^ a2 ^ a3);
+        p_col[1] = (uint8_t)(a0 ^ Xtime(a1) ^ Xtime(a2) ^ a2 ^ a3);
+        p_col[2] = (uint8_t)(a0 ^ a1 ^ Xtime(a2) ^ Xtime(a3) ^ a3);
+        p_col[3] = (uint8_t)(Xtime(a0) ^ a0 ^ a1 ^ a2 ^ Xtime(a3));
+      }
+    }
+    for (uint32_t j = 0U; j < 16U; j++)
+    {
+      block[j] = s[j] ^ keys[r][j];
+    }
+  }
+}
+
+static void Decrypt(uint8_t block[16])
+{
+  uint8_t inv_sbox[256];
+  uint8_t keys[15][16];
+  const uint32_t nr = ExpandKey(keys);
+
+  for (uint32_t i = 0U; i < 256U; i++)
+  {
+    inv_sbox[Sbox[i]] = (uint8_t)i;
+  }
+  if (Aes.derived == 0U)
+  {
+    /* The key registers are taken as the decryption key */
+    for (uint32_t j = 0U; j < 16U; j++)
+    {
+      keys[nr][j] = keys[0][j];
+    }
+  }
+  for (uint32_t j = 0U; j < 16U; j++)
+  {
+    block[j] ^= keys[nr][j];
+  }
+  for (uint32_t r = nr; r > 0U; r--)
+  {
+    uint8_t s[16];
+
+    /* InvShiftRows and InvSubBytes */
+    for (uint32_t j = 0U; j < 16U; j++)
+    {
+      s[(j + (4U * (j % 4U))) % 16U] = inv_sbox[block[j]];
+    }
+    for (uint32_t j = 0U; j < 16U; j++)
+    {
+      block[j] = s[j] ^ keys[r - 1U][j];
+    }
+    /* InvMixColumns, but after the first round */
+    for (uint32_t c = 0U; (r > 1U) && (c < 4U); c++)
+    {
+      uint8_t *p_col = &block[4U * c];
+      const uint8_t a0 = p_col[0];
+      const uint8_t a1 = p_col[1];
+      const uint8_t a2 = p_col[2];
+      const uint8_t a3 = p_col[3];
+
+      p_col[0] = (uint8_t)(Mul(a0, 14U) ^ Mul(a1, 11U) ^ Mul(a2, 13U) ^ Mul(a3, 9U));
+      p_col[1] = (uint8_t)(Mul(a0, 9U) ^ Mul(a1, 14U) ^ Mul(a2, 11U) ^ Mul(a3, 13U));
+      p_col[2] = (uint8_t)(Mul(a0, 13U) ^ Mul(a1, 9U) ^ Mul(a2, 14U) ^ Mul(a3, 11U));
+      p_col[3] = (uint8_t)(Mul(a0, 11U) ^ Mul(a1, 13U) ^ Mul(a2, 9U) ^ Mul(a3, 14U));
+    }
+  }
+}
+
+static void ToBytes(const uint32_t words[4], uint8_t block[16])
+{
+  for (uint32_t j = 0U; j < 16U; j++)
+  {
+    block[j] = (uint8_t)(words[j / 4U] >> (24U - (8U * (j % 4U))));
+  }
+}
+
+static void ToWords(const uint8_t block[16], uint32_t words[4])
+{
+  for (uint32_t i = 0U; i < 4U; i++)
+  {
+    words[i] = ((uint32_t)block[4U * i] << 24U) | ((uint32_t)block[(4U * i) + 1U] << 16U)
+               | ((uint32_t)block[(4U * i) + 2U] << 8U) | (uint32_t)block[(4U * i) + 3U];
+  }
+}
+
+/* IVR3 holds the first word of the chaining block */
+static void GetIv(uint8_t block[16])
+{
+  const uint32_t words[4] = {Regs()->IVR3, Regs()->IVR2, Regs()->IVR1, Regs()->IVR0};
+
+  ToBytes(words, block);
+}
+
+static void SetIv(const uint8_t block[16])
+{
+  uint32_t words[4];
+
+  ToWords(block, words);
+  Regs()->IVR3 = words[0];
+  Regs()->IVR2 = words[1];
+  Regs()->IVR1 = words[2];
+  Regs()->IVR0 = words[3];
+}
+
+/* GCM registers: running hash in SUSP0R..SUSP3R, hash subkey in SUSP4R..SUSP7R, first word first */
+static void GetSusp(uint32_t first, uint8_t block[16])
+{
+  const volatile uint32_t *p_susp = &Regs()->SUSP0R;
+  const uint32_t words[4] = {p_susp[first], p_susp[first + 1U], p_susp[first + 2U], p_susp[first + 3U]};
+
+  ToBytes(words, block);
+}
+
+static void SetSusp(uint32_t first, const uint8_t block[16])
+{
+  volatile uint32_t *p_susp = &Regs()->SUSP0R;
+  uint32_t words[4];
+
+  ToWords(block, words);
+  for (uint32_t i = 0U; i < 4U; i++)
+  {
+    p_susp[first + i] = words[i];
+  }
+}
+
+/* X = (X ^ data) . H in GF(2^128) */
+static void Ghash(const uint8_t data[16])
+{
+  uint8_t x[16];
+  uint8_t h[16];
+  uint8_t z[16] = {0};
+
+  GetSusp(0U, x);
+  GetSusp(4U, h);
+  for (uint32_t j = 0U; j < 16U; j++)
+  {
+    x[j] ^= data[j];
+  }
+  for (uint32_t i = 0U; i < 128U; i++)
+  {
+    uint32_t lsb;
+
+    if (((x[i / 8U] >> (7U - (i % 8U))) & 1U) != 0U)
+    {
+      for (uint32_t j = 0U; j < 16U; j++)
+      {
+        z[j] ^= h[j];
+      }
+    }
+    lsb = h[15] & 1U;
+    for (uint32_t j = 15U; j > 0U; j--)
+    {
+      h[j] = (uint8_t)((h[j] >> 1U) | (h[j - 1U] << 7U));
+    }
+    h[0] >>= 1U;
+    if (lsb != 0U)
+    {
+      h[0] ^= 0xE1U;
+    }
+  }
+  SetSusp(0U, z);
+}
+
+static void IncrementCounter(void)
+{
+  Regs()->IVR0 = Regs()->IVR0 + 1U;
+}
+
+/* Computation of the block of the input FIFO; returns 1 when the block gives an output */
+static uint32_t ComputeBlock(void)
+{
+  const uint32_t mode = Field(Regs()->CR, AES_CR_MODE, AES_CR_MODE_Pos);
+  const uint32_t phase = Field(Regs()->CR, AES_CR_GCMPH, AES_CR_GCMPH_Pos);
+  uint8_t in[16];
+  uint8_t out[16] = {0};
+  uint8_t chain[16];
+  uint32_t output = 1U;
+
+  ToBytes(Aes.in, in);
+  (void)memcpy(out, in, sizeof(out));
+  switch (Chmod())
+  {
+    case CHMOD_ECB:
+      if (mode == MODE_DECRYPT)
+      {
+        Decrypt(out);
+      }
+      else
+      {
+        Encrypt(out);
+      }
+      break;
+    case CHMOD_CBC:
+      GetIv(chain);
+      if (mode == MODE_DECRYPT)
+      {
+        Decrypt(out);
+        for (uint32_t j = 0U; j < 16U; j++)
+        {
+          out[j] ^= chain[j];
+        }
+        SetIv(in);
+      }
+      else
+      {
+        for (uint32_t j = 0U; j < 16U; j++)
+        {
+          out[j] ^= chain[j];
+        }
+        Encrypt(out);
+        SetIv(out);
+      }
+      break;
+    case CHMOD_CTR:
+      GetIv(chain);
+      Encrypt(chain);
+      for (uint32_t j = 0U; j < 16U; j++)
+      {
+        out[j] ^= chain[j];
+      }
+      IncrementCounter();
+      break;
+    case CHMOD_GCM:
+      if (phase == PHASE_HEADER)
+      {
+        Ghash(in);
+        output = 0U;
+      }
+      else if (phase == PHASE_PAYLOAD)
+      {
+        GetIv(chain);
+        Encrypt(chain);
+        for (uint32_t j = 0U; j < 16U; j++)
+        {
+          out[j] ^= chain[j];
+        }
+        IncrementCounter();
+        if (mode == MODE_DECRYPT)
+        {
+          Ghash(in);
+        }
+        else
+        {
+          /* The padding bytes of the last block are not part of the ciphertext */
+          const uint32_t padding = Field(Regs()->CR, AES_CR_NPBLB, AES_CR_NPBLB_Pos);
+          uint8_t cipher[16];
+
+          (void)memcpy(cipher, out, sizeof(cipher));
+          for (uint32_t j = 16U - padding; j < 16U; j++)
+          {
+            cipher[j] = 0U;
+          }
+          Ghash(cipher);
+        }
+      }
+      else
+      {
+        /* Final phase: the tag is E(J0) ^ GHASH, J0 being the initialization vector with the counter 1 */
+        Ghash(in);
+        GetIv(chain);
+        chain[12] = 0U;
+        chain[13] = 0U;
+        chain[14] = 0U;
+        chain[15] = 1U;
+        Encrypt(chain);
+        GetSusp(0U, out);
+        for (uint32_t j = 0U; j < 16U; j++)
+        {
+          out[j] ^= chain[j];
+        }
+      }
+      break;
+    default:
+      (void)memset(out, 0, sizeof(out));
+      break;
+  }
+  ToWords(out, Aes.out);
+  Aes.stats.block_nbr++;
+  return output;
+}
+
+static uint32_t Phase(uint32_t cr)
+{
+  return Field(cr, AES_CR_GCMPH, AES_CR_GCMPH_Pos);
+}
+
+/* The length block and the tag of the GCM final phase are not swapped */
+static uint32_t Unswapped(void)
+{
+  return ((Chmod() == CHMOD_GCM) && (Phase(Regs()->CR) == PHASE_FINAL)) ? 1U : 0U;
+}
+
+static uint32_t Status(void)
+{
+  return (((Aes.flags & AES_ISR_CCF) != 0U) ? AES_SR_CCF : 0U) | Aes.errors
+         | ((KeyValid() != 0U) ? AES_SR_KEYVALID : 0U);
+}
+
+static void Abort(void)
+{
+  Aes.in_level = 0U;
+  Aes.out_level = 0U;
+  Aes.out_index = 0U;
+  Aes.op = OP_NONE;
+  Aes.done_at = HOST_MODEL_NO_EVENT;
+}
+
+static void Start(uint32_t op, uint32_t cycles)
+{
+  Aes.op = op;
+  Aes.done_at = host_model_now + cycles;
+}
+
+static void ReadWriteError(uint32_t error)
+{
+  Aes.errors |= error;
+  Aes.flags |= AES_ISR_RWEIF;
+  Aes.stats.error_nbr++;
+}
+
+static void Update(void)
+{
+  AES_TypeDef *p_regs = Regs();
+  const uint32_t cr = p_regs->CR;
+  uint32_t accepting = 0U;
+
+  /* The input FIFO takes a block once the output of the previous one is read */
+  if (((cr & AES_CR_EN) != 0U) && (Aes.op == OP_NONE) && (Aes.in_level < 4U) && (Aes.out_level == 0U))
+  {
+    accepting = ((Chmod() == CHMOD_GCM) && (Phase(cr) == PHASE_INIT)) ? 0U : 1U;
+  }
+  p_regs->SR = Status();
+  p_regs->ISR = Aes.flags;
+  host_model_dma_request(REQUEST_IN, ((accepting != 0U) && ((cr & AES_CR_DMAINEN) != 0U)) ? 1U : 0U);
+  host_model_dma_request(REQUEST_OUT, ((Aes.out_level != 0U) && ((cr & AES_CR_DMAOUTEN) != 0U)) ? 1U : 0U);
+  host_model_irq_set_level(AES_IRQn, ((p_regs->IER & Aes.flags) != 0U) ? 1U : 0U);
+  host_model_schedule(&AesPeriph, Aes.done_at);
+}
+
+static void ResetState(void)
+{
+  AES_TypeDef *p_regs = Regs();
+
+  Abort();
+  (void)memset(Aes.key, 0, sizeof(Aes.key));
+  Aes.key_words = 0U;
+  Aes.derived = 0U;
+  Aes.flags = 0U;
+  Aes.errors = 0U;
+  p_regs->DINR = 0U;
+  p_regs->DOUTR = 0U;
+  p_regs->IVR0 = 0U;
+  p_regs->IVR1 = 0U;
+  p_regs->IVR2 = 0U;
+  p_regs->IVR3 = 0U;
+  for (volatile uint32_t *p_susp = &p_regs->SUSP0R; p_susp <= &p_regs->SUSP7R; p_susp++)
+  {
+    *p_susp = 0U;
+  }
+  p_regs->IER = 0U;
+  p_regs->ICR = 0U;
+}
+
+/* Peripheral callbacks ------------------------------------------------------*/
+static void Aes_Read(host_model_periph_t *p_periph, uint32_t offset, uint32_t size)
+{
+  AES_TypeDef *p_regs = Regs();
+  const uint32_t word = offset & ~3U;
+  (void)p_periph;
+  (void)size;
+
+  if (word == offsetof(AES_TypeDef, DOUTR))
+  {
+    uint32_t value = 0U;
+
+    if (Aes.out_level != 0U)
+    {
+      value = (Unswapped() != 0U) ? Aes.out[Aes.out_index] : Swap(Aes.out[Aes.out_index]);
+      Aes.out_index++;
+      Aes.out_level--;
+    }
+    else
+    {
+      ReadWriteError(AES_SR_RDERR);
+    }
+    Update();
+    p_regs->DOUTR = value;
+  }
+  else
+  {
+    /* SR and ISR are kept up to date, the other registers read as written */
+  }
+}
+
+static void Aes_Write(host_model_periph_t *p_periph, uint32_t offset, uint32_t size, uint32_t value,
+                      uint32_t old_word)
+{
+  AES_TypeDef *p_regs = Regs();
+  const uint32_t word = offset & ~3U;
+  (void)p_periph;
+  (void)size;
+  (void)value;
+
+  if (word == offsetof(AES_TypeDef, CR))
+  {
+    const uint32_t cr = p_regs->CR;
+
+    if ((cr & AES_CR_IPRST) != 0U)
+    {
+      ResetState();
+    }
+    else
+    {
+      if (((cr ^ old_word) & AES_CR_KEYSIZE) != 0U)
+      {
+        Aes.key_words = 0U;
+        Aes.derived = 0U;
+      }
+      if (((old_word & AES_CR_EN) != 0U) && ((cr & AES_CR_EN) == 0U))
+      {
+        Abort();
+      }
+      else if (((old_word & AES_CR_EN) == 0U) && ((cr & AES_CR_EN) != 0U))
+      {
+        if (Field(cr, AES_CR_MODE, AES_CR_MODE_Pos) == MODE_DERIVATION)
+        {
+          Start(OP_DERIVATION, DERIVATION_CYCLES);
+        }
+        else if ((Chmod() == CHMOD_GCM) && (Phase(cr) == PHASE_INIT))
+        {
+          Start(OP_INIT, INIT_CYCLES);
+        }
+        else
+        {
+          /* Waits for the input */
+        }
+      }
+      else
+      {
+        /* No enable change */
+      }
+    }
+  }
+  else if (word == offsetof(AES_TypeDef, DINR))
+  {
+    const uint32_t data = p_regs->DINR;
+
+    p_regs->DINR = 0U;
+    if ((p_regs->CR & AES_CR_EN) == 0U)
+    {
+      /* Ignored while disabled */
+    }
+    else if ((Aes.op != OP_NONE) || (Aes.out_level != 0U) || (Aes.in_level == 4U))
+    {
+      ReadWriteError(AES_SR_WRERR);
+    }
+    else
+    {
+      Aes.in[Aes.in_level] = (Unswapped() != 0U) ? data : Swap(data);
+      Aes.in_level++;
+      if (Aes.in_level == 4U)
+      {
+        Start(OP_BLOCK, (Key256() != 0U) ? BLOCK_CYCLES_256 : BLOCK_CYCLES);
+      }
+    }
+  }
+  else if (((word >= offsetof(AES_TypeDef, KEYR0)) && (word <= offsetof(AES_TypeDef, KEYR3)))
+           || ((word >= offsetof(AES_TypeDef, KEYR4)) && (word <= offsetof(AES_TypeDef, KEYR7))))
+  {
+    /* Write-only: KEYR0..KEYR3 at 0x10, KEYR4..KEYR7 at 0x30 */
+    const uint32_t index = (word < offsetof(AES_TypeDef, IVR0)) ? ((word - offsetof(AES_TypeDef, KEYR0)) / 4U)
+                           : (4U + ((word - offsetof(AES_TypeDef, KEYR4)) / 4U));
+
+    Aes.key[index] = *host_model_reg(&AesPeriph, word);
+    *host_model_reg(&AesPeriph, word) = 0U;
+    Aes.key_words |= 1UL << index;
+    Aes.derived = 0U;
+  }
+  else if (word == offsetof(AES_TypeDef, ICR))
+  {
+    const uint32_t clear = p_regs->ICR & (AES_ICR_CCF | AES_ICR_RWEIF | AES_ICR_KEIF | AES_ICR_RNGEIF);
+
+    Aes.flags &= ~clear;
+    if ((clear & AES_ICR_RWEIF) != 0U)
+    {
+      Aes.errors = 0U;
+    }
+    p_regs->ICR = 0U;
+  }
+  else if ((word == offsetof(AES_TypeDef, SR)) || (word == offsetof(AES_TypeDef, ISR))
+           || (word == offsetof(AES_TypeDef, DOUTR)))
+  {
+    *host_model_reg(&AesPeriph, word) = old_word;
+  }
+  else
+  {
+    /* IVR0..IVR3, SUSP0R..SUSP7R and IER hold what is written */
+  }
+  Update();
+}
+
+static void Aes_Event(host_model_periph_t *p_periph)
+{
+  (void)p_periph;
+
+  if (Aes.done_at <= host_model_now)
+  {
+    const uint32_t op = Aes.op;
+    uint8_t block[16] = {0};
+
+    Aes.op = OP_NONE;
+    Aes.done_at = HOST_MODEL_NO_EVENT;
+    if (op == OP_BLOCK)
+    {
+      if (ComputeBlock() != 0U)
+      {
+        Aes.out_level = 4U;
+        Aes.out_index = 0U;
+      }
+      Aes.in_level = 0U;
+    }
+    else if (op == OP_DERIVATION)
+    {
+      Aes.derived = 1U;
+      Aes.stats.derivation_nbr++;
+      Regs()->CR &= ~AES_CR_EN;
+    }
+    else
+    {
+      /* GCM init phase: hash subkey H = E(0), running hash cleared */
+      Encrypt(block);
+      SetSusp(4U, block);
+      (void)memset(block, 0, sizeof(block));
+      SetSusp(0U, block);
+      Regs()->CR &= ~AES_CR_EN;
+    }
+    Aes.flags |= AES_ISR_CCF;
+  }
+  Update();
+}
+
+static void Aes_Reset(host_model_periph_t *p_periph)
+{
+  (void)p_periph;
+
+  ResetState();
+  Regs()->CR = 0U;
+  (void)memset(&Aes.stats, 0, sizeof(Aes.stats));
+  Update();
+}
+
+static const host_model_periph_ops_t AesOps = {Aes_Read, Aes_Write, Aes_Event, Aes_Reset};
+static host_model_periph_t AesPeriph = {"AES", AES_BASE_NS, 0x400U, HOST_MODEL_AHB_CYCLES, &AesOps,
+                                        HOST_MODEL_NO_EVENT, &Aes};
+
+/* Exported functions --------------------------------------------------------*/
+void host_model_aes_register(void)
+{
+  host_model_register(&AesPeriph);
+}
+
+void HOST_MODEL_AES_GetStats(host_model_aes_stats_t *p_stats)
+{
+  host_model_sync();
+  *p_stats = Aes.stats;
+}
@@ -0,0 +1,185 @@
+/**
+  ******************************************************************************
+  * @file    host_crc.c
+  * @brief   Host model of the CRC calculation unit
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ * Modeled: bit-serial calculation of the 8, 16 and 32-bit writes of DR, most significant bit first, for the
+ * polynomial sizes 7, 8, 16 and 32, the input bit reversal by byte, half-word or word (on the write size when it is
+ * smaller), the output bit reversal on the polynomial size, INIT loaded by CR.RESET, and IDR.
+ * The writes are counted by size for the tests of the DMA feeding.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_model_internal.h"
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t crc;                        /*!< Calculation register, right aligned on the polynomial size */
+  host_model_crc_stats_t stats;
+} crc_state_t;
+
+/* Private variables ---------------------------------------------------------*/
+static crc_state_t Crc;
+
+/* Private functions ---------------------------------------------------------*/
+static host_model_periph_t CrcPeriph;
+
+static CRC_TypeDef *Regs(void)
+{
+  return (CRC_TypeDef *)CrcPeriph.base;
+}
+
+static uint32_t PolyBits(void)
+{
+  static const uint32_t bits[4] = {32U, 16U, 8U, 7U};
+
+  return bits[(Regs()->CR & CRC_CR_POLYSIZE) >> CRC_CR_POLYSIZE_Pos];
+}
+
+static uint32_t PolyMask(void)
+{
+  const uint32_t bits = PolyBits();
+
+  return (bits == 32U) ? 0xFFFFFFFFU : ((1UL << bits) - 1U);
+}
+
+static uint32_t Reflect(uint32_t value, uint32_t bit_nbr)
+{
+  uint32_t result = 0U;
+
+  for (uint32_t i = 0U; i < bit_nbr; i++)
+  {
+    result = (result << 1U) | ((value >> i) & 1U);
+  }
+  return result;
+}
+
+static uint32_t Output(void)
+{
+  return ((Regs()->CR & CRC_CR_REV_OUT) != 0U) ? Reflect(Crc.crc, PolyBits()) : Crc.crc;
+}
+
+static void Feed(uint32_t value, uint32_t size)
+{
+  static const uint32_t reverse_bits[4] = {0U, 8U, 16U, 32U};
+  const uint32_t data_bits = 8U * size;
+  const uint32_t poly_bits = PolyBits();
+  const uint32_t poly = Regs()->POL & PolyMask();
+  uint32_t unit = reverse_bits[(Regs()->CR & CRC_CR_REV_IN) >> CRC_CR_REV_IN_Pos];
+  uint32_t data = (data_bits == 32U) ? value : (value & ((1UL << data_bits) - 1U));
+
+  /* Bit reversal by unit, on the write size when it is smaller */
+  if (unit != 0U)
+  {
+    uint32_t reversed = 0U;
+
+    unit = (unit < data_bits) ? unit : data_bits;
+    for (uint32_t shift = 0U; shift < data_bits; shift += unit)
+    {
+      const uint32_t mask = (unit == 32U) ? 0xFFFFFFFFU : ((1UL << unit) - 1U);
+
+      reversed |= Reflect((data >> shift) & mask, unit) << shift;
+    }
+    data = reversed;
+  }
+
+  for (uint32_t i = data_bits; i > 0U; i--)
+  {
+    const uint32_t top = ((Crc.crc >> (poly_bits - 1U)) ^ (data >> (i - 1U))) & 1U;
+
+    Crc.crc = (Crc.crc << 1U) & PolyMask();
+    if (top != 0U)
+    {
+      Crc.crc ^= poly;
+    }
+  }
+  Crc.stats.write_nbr[(size == 1U) ? 0U : ((size == 2U) ? 1U : 2U)]++;
+  Crc.stats.byte_nbr += size;
+}
+
+/* Peripheral callbacks ------------------------------------------------------*/
+static void Crc_Read(host_model_periph_t *p_periph, uint32_t offset, uint32_t size)
+{
+  (void)p_periph;
+  (void)size;
+
+  if ((offset & ~3U) == offsetof(CRC_TypeDef, DR))
+  {
+    Regs()->DR = Output();
+  }
+}
+
+static void Crc_Write(host_model_periph_t *p_periph, uint32_t offset, uint32_t size, uint32_t value,
+                      uint32_t old_word)
+{
+  CRC_TypeDef *p_regs = Regs();
+  const uint32_t word = offset & ~3U;
+  (void)p_periph;
+  (void)old_word;
+
+  if (word == offsetof(CRC_TypeDef, DR))
+  {
+    Feed(value, size);
+  }
+  else if (word == offsetof(CRC_TypeDef, CR))
+  {
+    if ((p_regs->CR & CRC_CR_RESET) != 0U)
+    {
+      p_regs->CR &= ~CRC_CR_RESET;
+      Crc.crc = p_regs->INIT & PolyMask();
+      Crc.stats.reset_nbr++;
+    }
+  }
+  else
+  {
+    /* IDR, INIT and POL hold what is written */
+  }
+  p_regs->DR = Output();
+}
+
+static void Crc_Event(host_model_periph_t *p_periph)
+{
+  (void)p_periph;
+}
+
+static void Crc_Reset(host_model_periph_t *p_periph)
+{
+  CRC_TypeDef *p_regs = Regs();
+  (void)p_periph;
+
+  p_regs->INIT = 0xFFFFFFFFU;
+  p_regs->POL = 0x04C11DB7U;
+  Crc.crc = 0xFFFFFFFFU;
+  (void)memset(&Crc.stats, 0, sizeof(Crc.stats));
+  p_regs->DR = Output();
+}
+
+static const host_model_periph_ops_t CrcOps = {Crc_Read, Crc_Write, Crc_Event, Crc_Reset};
+static host_model_periph_t CrcPeriph = {"CRC", CRC_BASE_NS, 0x400U, HOST_MODEL_AHB_CYCLES, &CrcOps,
+                                        HOST_MODEL_NO_EVENT, &Crc};
+
+/* Exported functions --------------------------------------------------------*/
+void host_model_crc_register(void)
+{
+  host_model_register(&CrcPeriph);
+}
+
+void HOST_MODEL_CRC_GetStats(host_model_crc_stats_t *p_stats)
+{
+  host_model_sync();
+  *p_stats = Crc.stats;
+}
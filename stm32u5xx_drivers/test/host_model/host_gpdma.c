@@ -0,0 +1,713 @@
+/**
+  ******************************************************************************
+  * @file    host_gpdma.c
+  * @brief   Host model of the GPDMA1 controller
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ * Modeled:
+ * - channels 0 to 11 linear and 12 to 15 2D (repeated blocks, burst and block address offsets);
+ * - software requests and the peripheral request lines (REQSEL), source or destination (DREQ) requested;
+ * - data width conversion (PAM truncation, padding, sign extension and packing) and the byte exchanges SBX, DBX, DHX;
+ * - linked-list items fetched in the order CTR1, CTR2, CBR1, CSAR, CDAR, CTR3, CBR2, CLLR for the update bits of
+ *   CLLR, from CLBAR.LBA and CLLR.LA, the channel fetching first when enabled with BNDT = 0; link step mode;
+ * - half and complete transfer events by TCEM, suspend, reset, MISR, the user setting, transfer and link errors;
+ * - an arbiter granting one burst at a time to the ready channel of highest CCR.PRIO, round robin between equal
+ *   priorities, each beat costing HOST_MODEL_AHB_CYCLES.
+ * Not modeled: triggers, secure and privileged attributes, ports.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_model_internal.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define CHANNEL_NBR          16U
+#define CHANNEL_2D_FIRST     12U
+#define CHANNEL_OFFSET(n)    (0x50U + ((n) * 0x80U))
+#define REQUEST_NBR          128U
+#define FIFO_SIZE            64U
+#define FETCH_MAX_NBR        64U     /*!< Link-only items followed in a row before a link error */
+#define CSR_FLAGS            (DMA_CSR_TCF | DMA_CSR_HTF | DMA_CSR_DTEF | DMA_CSR_ULEF | DMA_CSR_USEF \
+                              | DMA_CSR_SUSPF | DMA_CSR_TOF)
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t running;                  /*!< Enabled and not suspended */
+  uint8_t fifo[FIFO_SIZE];
+  uint32_t fifo_level;
+  uint32_t block_size;               /*!< BNDT at the block start   */
+  uint32_t half_done;
+  host_model_dma_channel_stats_t stats;
+} channel_t;
+
+typedef struct
+{
+  channel_t channels[CHANNEL_NBR];
+  uint8_t requests[REQUEST_NBR];
+  uint32_t last_granted;
+  host_model_dma_fetch_t *p_fetch_log;
+  uint32_t fetch_log_size;
+  uint32_t fetch_nbr;
+} gpdma_state_t;
+
+/* Private variables ---------------------------------------------------------*/
+static gpdma_state_t Gpdma;
+
+/* Private functions ---------------------------------------------------------*/
+static host_model_periph_t GpdmaPeriph;
+
+static DMA_Channel_TypeDef *Channel(uint32_t n)
+{
+  return (DMA_Channel_TypeDef *)(GpdmaPeriph.base + CHANNEL_OFFSET(n));
+}
+
+static IRQn_Type ChannelIrq(uint32_t n)
+{
+  return (n < 8U) ? (IRQn_Type)((uint32_t)GPDMA1_CH0_IRQn + n) : (IRQn_Type)((uint32_t)GPDMA1_CH8_IRQn + (n - 8U));
+}
+
+static void UpdateIrq(uint32_t n)
+{
+  const DMA_Channel_TypeDef *p_ch = Channel(n);
+
+  host_model_irq_set_level(ChannelIrq(n), ((p_ch->CSR & p_ch->CCR & CSR_FLAGS) != 0U) ? 1U : 0U);
+}
+
+static void SetFlags(uint32_t n, uint32_t flags)
+{
+  Channel(n)->CSR |= flags;
+  UpdateIrq(n);
+}
+
+/* The channel becomes idle: disabled by hardware */
+static void Stop(uint32_t n)
+{
+  DMA_Channel_TypeDef *p_ch = Channel(n);
+
+  Gpdma.channels[n].running = 0U;
+  Gpdma.channels[n].fifo_level = 0U;
+  p_ch->CCR &= ~DMA_CCR_EN;
+  p_ch->CSR |= DMA_CSR_IDLEF;
+  UpdateIrq(n);
+}
+
+static void Error(uint32_t n, uint32_t flag)
+{
+  Stop(n);
+  SetFlags(n, flag);
+}
+
+static void Kick(void)
+{
+  if (GpdmaPeriph.next_event == HOST_MODEL_NO_EVENT)
+  {
+    host_model_schedule(&GpdmaPeriph, host_model_now + 1U);
+  }
+}
+
+static uint32_t Width(uint32_t log2)
+{
+  return 1UL << log2;
+}
+
+static uint32_t SettingsValid(uint32_t n)
+{
+  const DMA_Channel_TypeDef *p_ch = Channel(n);
+  const uint32_t sdw = (p_ch->CTR1 & DMA_CTR1_SDW_LOG2) >> DMA_CTR1_SDW_LOG2_Pos;
+  const uint32_t ddw = (p_ch->CTR1 & DMA_CTR1_DDW_LOG2) >> DMA_CTR1_DDW_LOG2_Pos;
+  const uint32_t bndt = p_ch->CBR1 & DMA_CBR1_BNDT;
+
+  if ((sdw > 2U) || (ddw > 2U))
+  {
+    return 0U;
+  }
+  if (((bndt % Width(sdw)) != 0U) || ((p_ch->CSAR % Width(sdw)) != 0U) || ((p_ch->CDAR % Width(ddw)) != 0U))
+  {
+    return 0U;
+  }
+  if ((n < CHANNEL_2D_FIRST) && ((p_ch->CBR1 & DMA_CBR1_BRC) != 0U))
+  {
+    return 0U;
+  }
+  return 1U;
+}
+
+static void BeginBlock(uint32_t n)
+{
+  Gpdma.channels[n].block_size = Channel(n)->CBR1 & DMA_CBR1_BNDT;
+  Gpdma.channels[n].half_done = 0U;
+}
+
+/* Load the next linked-list item, return the number of words read, 0 on a link error */
+static uint32_t Fetch(uint32_t n)
+{
+  static const uint32_t update_bits[] =
+  {
+    DMA_CLLR_UT1, DMA_CLLR_UT2, DMA_CLLR_UB1, DMA_CLLR_USA, DMA_CLLR_UDA, DMA_CLLR_UT3, DMA_CLLR_UB2, DMA_CLLR_ULL
+  };
+  DMA_Channel_TypeDef *p_ch = Channel(n);
+  volatile uint32_t *const p_regs[] =
+  {
+    &p_ch->CTR1, &p_ch->CTR2, &p_ch->CBR1, &p_ch->CSAR, &p_ch->CDAR, &p_ch->CTR3, &p_ch->CBR2, &p_ch->CLLR
+  };
+  const uint32_t cllr = p_ch->CLLR;
+  uint32_t address = (p_ch->CLBAR & DMA_CLBAR_LBA) | (cllr & DMA_CLLR_LA);
+  uint32_t word_nbr = 0U;
+
+  if (Gpdma.fetch_nbr < Gpdma.fetch_log_size)
+  {
+    Gpdma.p_fetch_log[Gpdma.fetch_nbr].channel = n;
+    Gpdma.p_fetch_log[Gpdma.fetch_nbr].address = address;
+    Gpdma.p_fetch_log[Gpdma.fetch_nbr].cllr = cllr;
+  }
+  Gpdma.fetch_nbr++;
+  Gpdma.channels[n].stats.node_fetch_nbr++;
+
+  if ((cllr & DMA_CLLR_ULL) == 0U)
+  {
+    p_ch->CLLR = 0U;
+  }
+  for (uint32_t i = 0U; i < (sizeof(update_bits) / sizeof(update_bits[0])); i++)
+  {
+    uint32_t value;
+
+    if ((n < CHANNEL_2D_FIRST) && ((update_bits[i] == DMA_CLLR_UT3) || (update_bits[i] == DMA_CLLR_UB2)))
+    {
+      continue;
+    }
+    if ((cllr & update_bits[i]) != 0U)
+    {
+      if (host_model_bus_read(address, 4U, &value) == 0U)
+      {
+        return 0U;
+      }
+      *p_regs[i] = value;
+      address += 4U;
+      word_nbr++;
+      host_model_stats.dma_beat_nbr++;
+    }
+  }
+  return word_nbr;
+}
+
+/* Fetch until an item with data, or the end of the list. Return 0 when the channel stopped on an error */
+static uint32_t FetchData(uint32_t n, uint32_t *p_cycles)
+{
+  DMA_Channel_TypeDef *p_ch = Channel(n);
+
+  for (uint32_t i = 0U; i < FETCH_MAX_NBR; i++)
+  {
+    const uint32_t word_nbr = Fetch(n);
+
+    if (word_nbr == 0U)
+    {
+      Error(n, DMA_CSR_ULEF);
+      return 0U;
+    }
+    *p_cycles += word_nbr * HOST_MODEL_AHB_CYCLES;
+    if (((p_ch->CBR1 & DMA_CBR1_BNDT) != 0U) || ((p_ch->CLLR & ~DMA_CLLR_LA) == 0U))
+    {
+      return 1U;
+    }
+  }
+  Error(n, DMA_CSR_ULEF);
+  return 0U;
+}
+
+static void Start(uint32_t n)
+{
+  DMA_Channel_TypeDef *p_ch = Channel(n);
+  uint32_t cycles = 0U;
+
+  p_ch->CSR &= ~DMA_CSR_IDLEF;
+  Gpdma.channels[n].fifo_level = 0U;
+
+  if ((p_ch->CBR1 & DMA_CBR1_BNDT) == 0U)
+  {
+    if ((p_ch->CLLR & ~DMA_CLLR_LA) == 0U)
+    {
+      Error(n, DMA_CSR_USEF);
+      return;
+    }
+    if (FetchData(n, &cycles) == 0U)
+    {
+      return;
+    }
+    if ((p_ch->CBR1 & DMA_CBR1_BNDT) == 0U)
+    {
+      Stop(n);
+      return;
+    }
+  }
+  if (SettingsValid(n) == 0U)
+  {
+    Error(n, DMA_CSR_USEF);
+    return;
+  }
+  BeginBlock(n);
+  Gpdma.channels[n].running = ((p_ch->CCR & DMA_CCR_SUSP) == 0U) ? 1U : 0U;
+  Kick();
+}
+
+static uint32_t ChannelReady(uint32_t n)
+{
+  const DMA_Channel_TypeDef *p_ch = Channel(n);
+  const uint32_t ctr2 = p_ch->CTR2;
+
+  if (Gpdma.channels[n].running == 0U)
+  {
+    return 0U;
+  }
+  if ((ctr2 & DMA_CTR2_SWREQ) != 0U)
+  {
+    return 1U;
+  }
+  return Gpdma.requests[(ctr2 & DMA_CTR2_REQSEL) % REQUEST_NBR];
+}
+
+static uint32_t Arbitrate(void)
+{
+  uint32_t best = CHANNEL_NBR;
+  uint32_t best_prio = 0U;
+
+  for (uint32_t i = 1U; i <= CHANNEL_NBR; i++)
+  {
+    const uint32_t n = (Gpdma.last_granted + i) % CHANNEL_NBR;
+
+    if (ChannelReady(n) != 0U)
+    {
+      const uint32_t prio = (Channel(n)->CCR & DMA_CCR_PRIO) >> DMA_CCR_PRIO_Pos;
+
+      if ((best == CHANNEL_NBR) || (prio > best_prio))
+      {
+        best = n;
+        best_prio = prio;
+      }
+    }
+  }
+  return best;
+}
+
+static uint32_t SignExtend(uint32_t value, uint32_t width)
+{
+  const uint32_t shift = 32U - (width * 8U);
+
+  return (uint32_t)(((int32_t)(value << shift)) >> shift);
+}
+
+/* Read a source beat into the FIFO, converted to the destination width unless packed. 0 on a bus error */
+static uint32_t ReadSourceBeat(uint32_t n)
+{
+  DMA_Channel_TypeDef *p_ch = Channel(n);
+  channel_t *p_state = &Gpdma.channels[n];
+  const uint32_t ctr1 = p_ch->CTR1;
+  const uint32_t sdw = Width((ctr1 & DMA_CTR1_SDW_LOG2) >> DMA_CTR1_SDW_LOG2_Pos);
+  const uint32_t ddw = Width((ctr1 & DMA_CTR1_DDW_LOG2) >> DMA_CTR1_DDW_LOG2_Pos);
+  const uint32_t pam = (ctr1 & DMA_CTR1_PAM) >> DMA_CTR1_PAM_Pos;
+  uint32_t value;
+  uint32_t push_size = sdw;
+
+  if (host_model_bus_read(p_ch->CSAR, sdw, &value) == 0U)
+  {
+    return 0U;
+  }
+  host_model_stats.dma_beat_nbr++;
+
+  if (((ctr1 & DMA_CTR1_SBX) != 0U) && (sdw == 4U))
+  {
+    value = (value & 0xFF0000FFUL) | ((value & 0x0000FF00UL) << 8U) | ((value & 0x00FF0000UL) >> 8U);
+  }
+  if ((sdw != ddw) && ((pam & 2U) == 0U))
+  {
+    push_size = ddw;
+    if (sdw > ddw)
+    {
+      /* Right aligned keeps the least significant bytes, left aligned the most significant ones */
+      value = ((pam & 1U) == 0U) ? value : (value >> ((sdw - ddw) * 8U));
+    }
+    else
+    {
+      value = ((pam & 1U) == 0U) ? value : SignExtend(value, sdw);
+    }
+  }
+  (void)memcpy(&p_state->fifo[p_state->fifo_level], &value, push_size);
+  p_state->fifo_level += push_size;
+
+  if ((ctr1 & DMA_CTR1_SINC) != 0U)
+  {
+    p_ch->CSAR += sdw;
+  }
+  p_ch->CBR1 = (p_ch->CBR1 & ~DMA_CBR1_BNDT) | ((p_ch->CBR1 & DMA_CBR1_BNDT) - sdw);
+  return 1U;
+}
+
+/* Write a destination beat from the FIFO, padded with zeros when the block ends short. 0 on a bus error */
+static uint32_t WriteDestBeat(uint32_t n)
+{
+  DMA_Channel_TypeDef *p_ch = Channel(n);
+  channel_t *p_state = &Gpdma.channels[n];
+  const uint32_t ctr1 = p_ch->CTR1;
+  const uint32_t ddw = Width((ctr1 & DMA_CTR1_DDW_LOG2) >> DMA_CTR1_DDW_LOG2_Pos);
+  const uint32_t size = (p_state->fifo_level < ddw) ? p_state->fifo_level : ddw;
+  uint32_t value = 0U;
+
+  (void)memcpy(&value, p_state->fifo, size);
+  p_state->fifo_level -= size;
+  (void)memmove(p_state->fifo, &p_state->fifo[size], p_state->fifo_level);
+
+  if (((ctr1 & DMA_CTR1_DBX) != 0U) && (ddw >= 2U))
+  {
+    value = ((value & 0xFF00FF00UL) >> 8U) | ((value & 0x00FF00FFUL) << 8U);
+  }
+  if (((ctr1 & DMA_CTR1_DHX) != 0U) && (ddw == 4U))
+  {
+    value = (value >> 16U) | (value << 16U);
+  }
+  if (host_model_bus_write(p_ch->CDAR, ddw, value) == 0U)
+  {
+    return 0U;
+  }
+  host_model_stats.dma_beat_nbr++;
+  host_model_stats.dma_byte_nbr += ddw;
+  p_state->stats.byte_nbr += ddw;
+
+  if ((ctr1 & DMA_CTR1_DINC) != 0U)
+  {
+    p_ch->CDAR += ddw;
+  }
+  return 1U;
+}
+
+static void AddOffset(volatile uint32_t *p_address, uint32_t offset, uint32_t decrement)
+{
+  *p_address = (decrement != 0U) ? (*p_address - offset) : (*p_address + offset);
+}
+
+/* End of a block: repeat it, load the next item or stop. Return the cycles of the item fetches */
+static uint32_t EndBlock(uint32_t n)
+{
+  DMA_Channel_TypeDef *p_ch = Channel(n);
+  const uint32_t tcem = (p_ch->CTR2 & DMA_CTR2_TCEM) >> DMA_CTR2_TCEM_Pos;
+  const uint32_t cbr1 = p_ch->CBR1;
+  uint32_t cycles = 0U;
+
+  if ((n >= CHANNEL_2D_FIRST) && ((cbr1 & DMA_CBR1_BRC) != 0U))
+  {
+    /* Next block of the repeated block */
+    p_ch->CBR1 = (cbr1 - (1UL << DMA_CBR1_BRC_Pos)) | Gpdma.channels[n].block_size;
+    AddOffset(&p_ch->CSAR, p_ch->CBR2 & DMA_CBR2_BRSAO, cbr1 & DMA_CBR1_BRSDEC);
+    AddOffset(&p_ch->CDAR, (p_ch->CBR2 & DMA_CBR2_BRDAO) >> DMA_CBR2_BRDAO_Pos, cbr1 & DMA_CBR1_BRDDEC);
+    Gpdma.channels[n].half_done = 0U;
+    if (tcem == 0U)
+    {
+      SetFlags(n, DMA_CSR_TCF);
+    }
+    return 0U;
+  }
+
+  if ((tcem != 3U) || ((p_ch->CLLR & ~DMA_CLLR_LA) == 0U))
+  {
+    SetFlags(n, DMA_CSR_TCF);
+  }
+  if ((p_ch->CLLR & ~DMA_CLLR_LA) == 0U)
+  {
+    Stop(n);
+    return 0U;
+  }
+  if (FetchData(n, &cycles) == 0U)
+  {
+    return cycles;
+  }
+  if (((p_ch->CCR & DMA_CCR_LSM) != 0U) || ((p_ch->CBR1 & DMA_CBR1_BNDT) == 0U))
+  {
+    Stop(n);
+    return cycles;
+  }
+  if (SettingsValid(n) == 0U)
+  {
+    Error(n, DMA_CSR_USEF);
+    return cycles;
+  }
+  BeginBlock(n);
+  return cycles;
+}
+
+/* Transfer a burst of the channel granted, return its cycles */
+static uint32_t Service(uint32_t n)
+{
+  DMA_Channel_TypeDef *p_ch = Channel(n);
+  channel_t *p_state = &Gpdma.channels[n];
+  const uint32_t ctr1 = p_ch->CTR1;
+  const uint32_t ddw = Width((ctr1 & DMA_CTR1_DDW_LOG2) >> DMA_CTR1_DDW_LOG2_Pos);
+  const uint32_t dest_request = ((p_ch->CTR2 & DMA_CTR2_SWREQ) == 0U) && ((p_ch->CTR2 & DMA_CTR2_DREQ) != 0U);
+  uint32_t beat_nbr = 0U;
+  uint32_t cycles;
+
+  p_state->stats.burst_nbr++;
+  if (p_state->stats.burst_nbr == 1U)
+  {
+    p_state->stats.first_cycle = host_model_now;
+  }
+  p_state->stats.last_cycle = host_model_now;
+
+  if (dest_request != 0U)
+  {
+    /* A destination burst, the source read as needed */
+    const uint32_t burst = ((ctr1 & DMA_CTR1_DBL_1) >> DMA_CTR1_DBL_1_Pos) + 1U;
+
+    for (uint32_t beat = 0U; beat < burst; beat++)
+    {
+      while ((p_state->fifo_level < ddw) && ((p_ch->CBR1 & DMA_CBR1_BNDT) != 0U))
+      {
+        if (ReadSourceBeat(n) == 0U)
+        {
+          Error(n, DMA_CSR_DTEF);
+          return beat_nbr * HOST_MODEL_AHB_CYCLES;
+        }
+        beat_nbr++;
+      }
+      if (p_state->fifo_level == 0U)
+      {
+        break;
+      }
+      if (WriteDestBeat(n) == 0U)
+      {
+        Error(n, DMA_CSR_DTEF);
+        return beat_nbr * HOST_MODEL_AHB_CYCLES;
+      }
+      beat_nbr++;
+    }
+  }
+  else
+  {
+    /* A source burst, the destination written as the FIFO fills */
+    const uint32_t burst = ((ctr1 & DMA_CTR1_SBL_1) >> DMA_CTR1_SBL_1_Pos) + 1U;
+
+    for (uint32_t beat = 0U; (beat < burst) && ((p_ch->CBR1 & DMA_CBR1_BNDT) != 0U); beat++)
+    {
+      if (ReadSourceBeat(n) == 0U)
+      {
+        Error(n, DMA_CSR_DTEF);
+        return beat_nbr * HOST_MODEL_AHB_CYCLES;
+      }
+      beat_nbr++;
+      while ((p_state->fifo_level >= ddw)
+             || ((p_state->fifo_level != 0U) && ((p_ch->CBR1 & DMA_CBR1_BNDT) == 0U)))
+      {
+        if (WriteDestBeat(n) == 0U)
+        {
+          Error(n, DMA_CSR_DTEF);
+          return beat_nbr * HOST_MODEL_AHB_CYCLES;
+        }
+        beat_nbr++;
+      }
+    }
+  }
+  cycles = beat_nbr * HOST_MODEL_AHB_CYCLES;
+
+  if ((n >= CHANNEL_2D_FIRST) && ((p_ch->CBR1 & DMA_CBR1_BNDT) != 0U))
+  {
+    AddOffset(&p_ch->CSAR, p_ch->CTR3 & DMA_CTR3_SAO, p_ch->CBR1 & DMA_CBR1_SDEC);
+    AddOffset(&p_ch->CDAR, (p_ch->CTR3 & DMA_CTR3_DAO) >> DMA_CTR3_DAO_Pos, p_ch->CBR1 & DMA_CBR1_DDEC);
+  }
+
+  if ((p_state->half_done == 0U) && (p_state->fifo_level == 0U)
+      && ((p_state->block_size - (p_ch->CBR1 & DMA_CBR1_BNDT)) >= (p_state->block_size / 2U)))
+  {
+    const uint32_t tcem = (p_ch->CTR2 & DMA_CTR2_TCEM) >> DMA_CTR2_TCEM_Pos;
+
+    p_state->half_done = 1U;
+    if ((tcem != 3U) || ((p_ch->CLLR & ~DMA_CLLR_LA) == 0U))
+    {
+      SetFlags(n, DMA_CSR_HTF);
+    }
+  }
+  if (((p_ch->CBR1 & DMA_CBR1_BNDT) == 0U) && (p_state->fifo_level == 0U) && (p_state->running != 0U))
+  {
+    cycles += EndBlock(n);
+  }
+  return cycles;
+}
+
+/* Peripheral callbacks ------------------------------------------------------*/
+static void Gpdma_Read(host_model_periph_t *p_periph, uint32_t offset, uint32_t size)
+{
+  (void)size;
+  if ((offset & ~3U) == offsetof(DMA_TypeDef, MISR))
+  {
+    uint32_t misr = 0U;
+
+    for (uint32_t n = 0U; n < CHANNEL_NBR; n++)
+    {
+      const DMA_Channel_TypeDef *p_ch = Channel(n);
+
+      misr |= ((p_ch->CSR & p_ch->CCR & CSR_FLAGS) != 0U) ? (1UL << n) : 0U;
+    }
+    *host_model_reg(p_periph, offsetof(DMA_TypeDef, MISR)) = misr;
+  }
+}
+
+static void Gpdma_Write(host_model_periph_t *p_periph, uint32_t offset, uint32_t size, uint32_t value,
+                        uint32_t old_word)
+{
+  const uint32_t word = offset & ~3U;
+  uint32_t n;
+  uint32_t reg;
+  DMA_Channel_TypeDef *p_ch;
+  (void)size;
+  (void)value;
+
+  if (word < CHANNEL_OFFSET(0U))
+  {
+    if ((word == offsetof(DMA_TypeDef, MISR)) || (word == offsetof(DMA_TypeDef, SMISR)))
+    {
+      *host_model_reg(p_periph, word) = old_word;
+    }
+    return;
+  }
+  n = (word - CHANNEL_OFFSET(0U)) / 0x80U;
+  if (n >= CHANNEL_NBR)
+  {
+    return;
+  }
+  p_ch = Channel(n);
+  reg = (word - CHANNEL_OFFSET(0U)) % 0x80U;
+
+  if (reg == offsetof(DMA_Channel_TypeDef, CFCR))
+  {
+    p_ch->CSR &= ~(p_ch->CFCR & CSR_FLAGS);
+    p_ch->CFCR = 0U;
+    UpdateIrq(n);
+  }
+  else if (reg == offsetof(DMA_Channel_TypeDef, CSR))
+  {
+    p_ch->CSR = old_word;
+  }
+  else if (reg == offsetof(DMA_Channel_TypeDef, CCR))
+  {
+    const uint32_t ccr = p_ch->CCR;
+
+    if ((ccr & DMA_CCR_RESET) != 0U)
+    {
+      p_ch->CCR = ccr & ~(DMA_CCR_RESET | DMA_CCR_EN | DMA_CCR_SUSP);
+      Stop(n);
+      return;
+    }
+    if ((old_word & DMA_CCR_EN) != 0U)
+    {
+      /* EN is cleared by hardware only */
+      p_ch->CCR = ccr | DMA_CCR_EN;
+      if (((ccr & DMA_CCR_SUSP) != 0U) && (Gpdma.channels[n].running != 0U))
+      {
+        Gpdma.channels[n].running = 0U;
+        p_ch->CSR |= DMA_CSR_IDLEF;
+        SetFlags(n, DMA_CSR_SUSPF);
+      }
+      else if (((ccr & DMA_CCR_SUSP) == 0U) && ((old_word & DMA_CCR_SUSP) != 0U))
+      {
+        Gpdma.channels[n].running = 1U;
+        p_ch->CSR &= ~DMA_CSR_IDLEF;
+        Kick();
+      }
+      else
+      {
+        UpdateIrq(n);
+      }
+    }
+    else if ((ccr & DMA_CCR_EN) != 0U)
+    {
+      Start(n);
+    }
+    else
+    {
+      UpdateIrq(n);
+    }
+  }
+  else
+  {
+    /* Transfer and link registers hold what is written */
+  }
+}
+
+static void Gpdma_Event(host_model_periph_t *p_periph)
+{
+  const uint32_t n = Arbitrate();
+
+  if (n == CHANNEL_NBR)
+  {
+    return;
+  }
+  Gpdma.last_granted = n;
+  host_model_schedule(p_periph, host_model_now + Service(n) + 1U);
+}
+
+static void Gpdma_Reset(host_model_periph_t *p_periph)
+{
+  (void)p_periph;
+  (void)memset(&Gpdma.channels, 0, sizeof(Gpdma.channels));
+  (void)memset(&Gpdma.requests, 0, sizeof(Gpdma.requests));
+  Gpdma.last_granted = CHANNEL_NBR - 1U;
+  Gpdma.fetch_nbr = 0U;
+  Gpdma.p_fetch_log = NULL;
+  Gpdma.fetch_log_size = 0U;
+  for (uint32_t n = 0U; n < CHANNEL_NBR; n++)
+  {
+    Channel(n)->CSR = DMA_CSR_IDLEF;
+  }
+}
+
+static const host_model_periph_ops_t GpdmaOps = {Gpdma_Read, Gpdma_Write, Gpdma_Event, Gpdma_Reset};
+static host_model_periph_t GpdmaPeriph = {"GPDMA1", GPDMA1_BASE_NS, 0x1000U, HOST_MODEL_AHB_CYCLES, &GpdmaOps,
+                                          HOST_MODEL_NO_EVENT, NULL};
+
+/* Exported functions --------------------------------------------------------*/
+void host_model_gpdma_register(void)
+{
+  host_model_register(&GpdmaPeriph);
+}
+
+void host_model_dma_request(uint32_t request, uint32_t level)
+{
+  const uint8_t new_level = (level != 0U) ? 1U : 0U;
+
+  if (request >= REQUEST_NBR)
+  {
+    return;
+  }
+  if ((new_level != 0U) && (Gpdma.requests[request] == 0U))
+  {
+    Kick();
+  }
+  Gpdma.requests[request] = new_level;
+}
+
+void HOST_MODEL_DMA_GetChannelStats(uint32_t channel, host_model_dma_channel_stats_t *p_stats)
+{
+  host_model_sync();
+  *p_stats = Gpdma.channels[channel % CHANNEL_NBR].stats;
+}
+
+void HOST_MODEL_DMA_SetFetchLog(host_model_dma_fetch_t *p_log, uint32_t size)
+{
+  Gpdma.p_fetch_log = p_log;
+  Gpdma.fetch_log_size = size;
+  Gpdma.fetch_nbr = 0U;
+}
+
+uint32_t HOST_MODEL_DMA_GetFetchNbr(void)
+{
+  host_model_sync();
+  return Gpdma.fetch_nbr;
+}
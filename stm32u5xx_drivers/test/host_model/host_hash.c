@@ -0,0 +1,470 @@
+/**
+  ******************************************************************************
+  * @file    host_hash.c
+  * @brief   Host model of the HASH processor
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ * Modeled:
+ * - SHA-224 and SHA-256, the message restarted by CR.INIT which latches ALGO, MODE and LKEY;
+ * - the data swapping of DIN (32-bit, half-word, byte, bit), the last word of a message held until the next DIN
+ *   write or STR.DCAL, which takes its first NBLW bits (all of them when NBLW is 0);
+ * - the three HMAC steps: key, message and key again, each ended by DCAL, the key hashed first when LKEY is set;
+ * - the digest in HR0..HR7 and HRA0..HRA4, DCIS at the end of a hash or of the last HMAC step, DINIS at each block
+ *   taken and at the end of the first two HMAC steps, cleared by writing 0 or by INIT, DMAS, IMR and the interrupt
+ *   line, the DMA request HASH_IN while CR.DMAE is set.
+ * The words are processed at their write: BUSY stays cleared and the digest is ready at the DCAL write.
+ * Not modeled: SHA-1 and MD5 (their digest is zero), the context swap registers, NBWE, NBWP, DINNE, the digest
+ * calculation started by the end of a DMA transfer when MDMAT is cleared, HMAC keys of more than KEY_MAX_BYTE bytes.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_model_internal.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define REQUEST_IN           89U     /*!< GPDMA1 request HASH_IN        */
+#define BLOCK_BYTE           64U
+#define KEY_MAX_BYTE         256U
+#define CR_ALGO_SHA224       HASH_CR_ALGO_1
+#define CR_ALGO_SHA256       HASH_CR_ALGO
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t h[8];
+  uint8_t block[BLOCK_BYTE];
+  uint32_t block_byte;
+  uint64_t total_byte;
+} sha256_t;
+
+typedef enum
+{
+  STEP_HASH,                           /*!< Message of a hash           */
+  STEP_HMAC_KEY,                       /*!< HMAC inner key              */
+  STEP_HMAC_MESSAGE,                   /*!< HMAC message                */
+  STEP_HMAC_OUTER_KEY,                 /*!< HMAC outer key              */
+  STEP_DONE                            /*!< Digest computed             */
+} step_t;
+
+typedef struct
+{
+  uint32_t cr;                         /*!< ALGO, MODE and LKEY latched by INIT */
+  step_t step;
+  sha256_t sha;
+  uint32_t last_word;                  /*!< Last word written, swapped  */
+  uint32_t last_valid;
+  uint8_t key[KEY_MAX_BYTE];
+  uint32_t key_byte;
+  uint32_t flags;                      /*!< DINIS, DCIS                 */
+  host_model_hash_stats_t stats;
+} hash_state_t;
+
+/* Private variables ---------------------------------------------------------*/
+static hash_state_t Hash;
+
+static const uint32_t K256[64] =
+{
+  0x428A2F98U, 0x71374491U, 0xB5C0FBCFU, 0xE9B5DBA5U, 0x3956C25BU, 0x59F111F1U, 0x923F82A4U, 0xAB1C5ED5U,
+  0xD807AA98U, 0x12835B01U, 0x243185BEU, 0x550C7DC3U, 0x72BE5D74U, 0x80DEB1FEU, 0x9BDC06A7U, 0xC19BF174U,
+  0xE49B69C1U, 0xEFBE4786U, 0x0FC19DC6U, 0x240CA1CCU, 0x2DE92C6FU, 0x4A7484AAU, 0x5CB0A9DCU, 0x76F988DAU,
+  0x983E5152U, 0xA831C66DU, 0xB00327C8U, 0xBF597FC7U, 0xC6E00BF3U, 0xD5A79147U, 0x06CA6351U, 0x14292967U,
+  0x27B70A85U, 0x2E1B2138U, 0x4D2C6DFCU, 0x53380D13U, 0x650A7354U, 0x766A0ABBU, 0x81C2C92EU, 0x92722C85U,
+  0xA2BFE8A1U, 0xA81A664BU, 0xC24B8B70U, 0xC76C51A3U, 0xD192E819U, 0xD6990624U, 0xF40E3585U, 0x106AA070U,
+  0x19A4C116U, 0x1E376C08U, 0x2748774CU, 0x34B0BCB5U, 0x391C0CB3U, 0x4ED8AA4AU, 0x5B9CCA4FU, 0x682E6FF3U,
+  0x748F82EEU, 0x78A5636FU, 0x84C87814U, 0x8CC70208U, 0x90BEFFFAU, 0xA4506CEBU, 0xBEF9A3F7U, 0xC67178F2U
+};
+
+/* Private functions ---------------------------------------------------------*/
+static host_model_periph_t HashPeriph;
+
+static HASH_TypeDef *Regs(void)
+{
+  return (HASH_TypeDef *)HashPeriph.base;
+}
+
+static uint32_t Ror(uint32_t x, uint32_t n)
+{
+  return (x >> n) | (x << (32U - n));
+}
+
+static void Sha256Block(sha256_t *p_sha, const uint8_t *p_block)
+{
+  uint32_t w[64];
+  uint32_t v[8];
+
+  for (uint32_t i = 0U; i < 16U; i++)
+  {
+    w[i] = ((uint32_t)p_block[4U * i] << 24U) | ((uint32_t)p_block[(4U * i) + 1U] << 16U)
+           | ((uint32_t)p_block[(4U * i) + 2U] << 8U) | p_block[(4U * i) + 3U];
+  }
+  for (uint32_t i = 16U; i < 64U; i++)
+  {
+    const uint32_t s0 = Ror(w[i - 15U], 7U) ^ Ror(w[i - 15U], 18U) ^ (w[i - 15U] >> 3U);
+    const uint32_t s1 = Ror(w[i - 2U], 17U) ^ Ror(w[i - 2U], 19U) ^ (w[i - 2U] >> 10U);
+
+    w[i] = w[i - 16U] + s0 + w[i - 7U] + s1;
+  }
+  (void)memcpy(v, p_sha->h, sizeof(v));
+  for (uint32_t i = 0U; i < 64U; i++)
+  {
+    const uint32_t t1 = v[7] + (Ror(v[4], 6U) ^ Ror(v[4], 11U) ^ Ror(v[4], 25U)) + ((v[4] & v[5]) ^ (~v[4] & v[6]))
+                        + K256[i] + w[i];
+    const uint32_t t2 = (Ror(v[0], 2U) ^ Ror(v[0], 13U) ^ Ror(v[0], 22U))
+                        + ((v[0] & v[1]) ^ (v[0] & v[2]) ^ (v[1] & v[2]));
+
+    (void)memmove(&v[1], &v[0], 7U * sizeof(v[0]));
+    v[4] += t1;
+    v[0] = t1 + t2;
+  }
+  for (uint32_t i = 0U; i < 8U; i++)
+  {
+    p_sha->h[i] += v[i];
+  }
+}
+
+static void Sha256Init(sha256_t *p_sha, uint32_t algo)
+{
+  static const uint32_t iv224[8] =
+  {
+    0xC1059ED8U, 0x367CD507U, 0x3070DD17U, 0xF70E5939U, 0xFFC00B31U, 0x68581511U, 0x64F98FA7U, 0xBEFA4FA4U
+  };
+  static const uint32_t iv256[8] =
+  {
+    0x6A09E667U, 0xBB67AE85U, 0x3C6EF372U, 0xA54FF53AU, 0x510E527FU, 0x9B05688CU, 0x1F83D9ABU, 0x5BE0CD19U
+  };
+
+  (void)memcpy(p_sha->h, (algo == CR_ALGO_SHA224) ? iv224 : iv256, sizeof(p_sha->h));
+  p_sha->block_byte = 0U;
+  p_sha->total_byte = 0U;
+}
+
+static void Sha256Update(sha256_t *p_sha, const uint8_t *p_data, uint32_t size)
+{
+  for (uint32_t i = 0U; i < size; i++)
+  {
+    p_sha->block[p_sha->block_byte] = p_data[i];
+    p_sha->block_byte++;
+    if (p_sha->block_byte == BLOCK_BYTE)
+    {
+      Sha256Block(p_sha, p_sha->block);
+      p_sha->block_byte = 0U;
+    }
+  }
+  p_sha->total_byte += size;
+}
+
+/* Padding and length, the digest left in h */
+static void Sha256Final(sha256_t *p_sha)
+{
+  const uint64_t bit_nbr = 8U * p_sha->total_byte;
+  const uint8_t one = 0x80U;
+  const uint8_t zero = 0U;
+  uint8_t length[8];
+
+  Sha256Update(p_sha, &one, 1U);
+  while (p_sha->block_byte != (BLOCK_BYTE - 8U))
+  {
+    Sha256Update(p_sha, &zero, 1U);
+  }
+  for (uint32_t i = 0U; i < 8U; i++)
+  {
+    length[i] = (uint8_t)(bit_nbr >> (56U - (8U * i)));
+  }
+  Sha256Update(p_sha, length, 8U);
+}
+
+static uint32_t Algo(void)
+{
+  return Hash.cr & HASH_CR_ALGO;
+}
+
+static uint32_t DigestWords(void)
+{
+  return (Algo() == CR_ALGO_SHA224) ? 7U : 8U;
+}
+
+static void DigestBytes(const sha256_t *p_sha, uint8_t *p_digest)
+{
+  for (uint32_t i = 0U; i < (4U * DigestWords()); i++)
+  {
+    p_digest[i] = (uint8_t)(p_sha->h[i / 4U] >> (24U - (8U * (i % 4U))));
+  }
+}
+
+/* Word as fed to the core, most significant byte first, from the DIN write and the data type */
+static uint32_t Swap(uint32_t value)
+{
+  uint32_t swapped = 0U;
+
+  switch ((Regs()->CR & HASH_CR_DATATYPE) >> HASH_CR_DATATYPE_Pos)
+  {
+    case 1U:
+      swapped = (value << 16U) | (value >> 16U);
+      break;
+    case 2U:
+      swapped = __builtin_bswap32(value);
+      break;
+    case 3U:
+      for (uint32_t i = 0U; i < 32U; i++)
+      {
+        swapped |= ((value >> i) & 1U) << (31U - i);
+      }
+      break;
+    default:
+      swapped = value;
+      break;
+  }
+  return swapped;
+}
+
+static void FeedBytes(const uint8_t *p_data, uint32_t size)
+{
+  if ((Hash.step == STEP_HMAC_KEY) || (Hash.step == STEP_HMAC_OUTER_KEY))
+  {
+    for (uint32_t i = 0U; (i < size) && (Hash.key_byte < KEY_MAX_BYTE); i++)
+    {
+      Hash.key[Hash.key_byte] = p_data[i];
+      Hash.key_byte++;
+    }
+  }
+  else if (Hash.step != STEP_DONE)
+  {
+    const uint32_t block_byte = Hash.sha.block_byte;
+
+    Sha256Update(&Hash.sha, p_data, size);
+    if ((block_byte + size) >= BLOCK_BYTE)
+    {
+      Hash.flags |= HASH_SR_DINIS;
+    }
+  }
+  else
+  {
+    /* Words after the digest are ignored until INIT */
+  }
+  Hash.stats.byte_nbr += size;
+}
+
+static void FeedLastWord(uint32_t bit_nbr)
+{
+  uint8_t bytes[4];
+  const uint32_t byte_nbr = (bit_nbr == 0U) ? 4U : ((bit_nbr + 7U) / 8U);
+
+  if (Hash.last_valid == 0U)
+  {
+    return;
+  }
+  for (uint32_t i = 0U; i < 4U; i++)
+  {
+    bytes[i] = (uint8_t)(Hash.last_word >> (24U - (8U * i)));
+  }
+  Hash.last_valid = 0U;
+  FeedBytes(bytes, byte_nbr);
+}
+
+/* Key of the HMAC block size, hashed first when longer than a block, XORed with the pad byte */
+static void StartKeyedHash(uint8_t pad)
+{
+  uint8_t block[BLOCK_BYTE];
+  sha256_t key_sha;
+
+  (void)memset(block, 0, sizeof(block));
+  if ((Hash.cr & HASH_CR_LKEY) != 0U)
+  {
+    Sha256Init(&key_sha, Algo());
+    Sha256Update(&key_sha, Hash.key, Hash.key_byte);
+    Sha256Final(&key_sha);
+    DigestBytes(&key_sha, block);
+  }
+  else
+  {
+    (void)memcpy(block, Hash.key, (Hash.key_byte < BLOCK_BYTE) ? Hash.key_byte : BLOCK_BYTE);
+  }
+  for (uint32_t i = 0U; i < BLOCK_BYTE; i++)
+  {
+    block[i] ^= pad;
+  }
+  Sha256Init(&Hash.sha, Algo());
+  Sha256Update(&Hash.sha, block, BLOCK_BYTE);
+  Hash.key_byte = 0U;
+}
+
+static void SetDigest(void)
+{
+  HASH_TypeDef *p_regs = Regs();
+
+  (void)memset((void *)p_regs->HR, 0, sizeof(p_regs->HR));
+  if ((Algo() == CR_ALGO_SHA224) || (Algo() == CR_ALGO_SHA256))
+  {
+    for (uint32_t i = 0U; i < DigestWords(); i++)
+    {
+      p_regs->HR[i] = Hash.sha.h[i];
+    }
+  }
+  for (uint32_t i = 0U; i < 5U; i++)
+  {
+    p_regs->HRA[i] = p_regs->HR[i];
+  }
+  Hash.flags |= HASH_SR_DCIS;
+  Hash.stats.digest_nbr++;
+}
+
+/* End of the current step, started by DCAL */
+static void Calculate(uint32_t nblw)
+{
+  uint8_t inner[32];
+
+  FeedLastWord(nblw);
+  switch (Hash.step)
+  {
+    case STEP_HASH:
+      Sha256Final(&Hash.sha);
+      SetDigest();
+      Hash.step = STEP_DONE;
+      break;
+    case STEP_HMAC_KEY:
+      StartKeyedHash(0x36U);
+      Hash.flags |= HASH_SR_DINIS;
+      Hash.step = STEP_HMAC_MESSAGE;
+      break;
+    case STEP_HMAC_MESSAGE:
+      Sha256Final(&Hash.sha);
+      Hash.flags |= HASH_SR_DINIS;
+      Hash.step = STEP_HMAC_OUTER_KEY;
+      break;
+    case STEP_HMAC_OUTER_KEY:
+      DigestBytes(&Hash.sha, inner);
+      StartKeyedHash(0x5CU);
+      Sha256Update(&Hash.sha, inner, 4U * DigestWords());
+      Sha256Final(&Hash.sha);
+      SetDigest();
+      Hash.step = STEP_DONE;
+      break;
+    default:
+      break;
+  }
+}
+
+static void Init(void)
+{
+  Hash.cr = Regs()->CR & (HASH_CR_ALGO | HASH_CR_MODE | HASH_CR_LKEY);
+  Hash.step = ((Hash.cr & HASH_CR_MODE) != 0U) ? STEP_HMAC_KEY : STEP_HASH;
+  Sha256Init(&Hash.sha, Algo());
+  Hash.last_valid = 0U;
+  Hash.key_byte = 0U;
+  Hash.flags &= ~(HASH_SR_DINIS | HASH_SR_DCIS);
+}
+
+static void Update(void)
+{
+  HASH_TypeDef *p_regs = Regs();
+  const uint32_t dmae = p_regs->CR & HASH_CR_DMAE;
+
+  p_regs->SR = Hash.flags | ((dmae != 0U) ? HASH_SR_DMAS : 0U);
+  host_model_dma_request(REQUEST_IN, (dmae != 0U) ? 1U : 0U);
+  host_model_irq_set_level(HASH_IRQn, ((p_regs->IMR & Hash.flags) != 0U) ? 1U : 0U);
+}
+
+/* Peripheral callbacks ------------------------------------------------------*/
+static void Hash_Read(host_model_periph_t *p_periph, uint32_t offset, uint32_t size)
+{
+  (void)p_periph;
+  (void)offset;
+  (void)size;
+}
+
+static void Hash_Write(host_model_periph_t *p_periph, uint32_t offset, uint32_t size, uint32_t value,
+                       uint32_t old_word)
+{
+  HASH_TypeDef *p_regs = Regs();
+  const uint32_t word = offset & ~3U;
+  (void)p_periph;
+  (void)size;
+  (void)value;
+
+  if (word == offsetof(HASH_TypeDef, CR))
+  {
+    if ((p_regs->CR & HASH_CR_INIT) != 0U)
+    {
+      p_regs->CR &= ~HASH_CR_INIT;
+      Init();
+    }
+  }
+  else if (word == offsetof(HASH_TypeDef, DIN))
+  {
+    FeedLastWord(0U);
+    Hash.last_word = Swap(p_regs->DIN);
+    Hash.last_valid = 1U;
+    Hash.stats.din_write_nbr++;
+  }
+  else if (word == offsetof(HASH_TypeDef, STR))
+  {
+    const uint32_t str = p_regs->STR;
+
+    /* DCAL reads 0 once the calculation is started */
+    p_regs->STR = str & HASH_STR_NBLW;
+    if ((str & HASH_STR_DCAL) != 0U)
+    {
+      Calculate(str & HASH_STR_NBLW);
+    }
+  }
+  else if (word == offsetof(HASH_TypeDef, SR))
+  {
+    /* DINIS and DCIS cleared by writing 0, the other bits are read-only */
+    Hash.flags &= p_regs->SR | ~(HASH_SR_DINIS | HASH_SR_DCIS);
+  }
+  else if ((word >= offsetof(HASH_TypeDef, HRA)) && (word < offsetof(HASH_TypeDef, IMR)))
+  {
+    *host_model_reg(&HashPeriph, word) = old_word;
+  }
+  else if (word >= offsetof(HASH_TypeDef, HR))
+  {
+    *host_model_reg(&HashPeriph, word) = old_word;
+  }
+  else
+  {
+    /* IMR and the context swap registers hold what is written */
+  }
+  Update();
+}
+
+static void Hash_Event(host_model_periph_t *p_periph)
+{
+  (void)p_periph;
+}
+
+static void Hash_Reset(host_model_periph_t *p_periph)
+{
+  (void)p_periph;
+
+  (void)memset(&Hash, 0, sizeof(Hash));
+  (void)memset((void *)Regs(), 0, HashPeriph.size);
+  Init();
+  Update();
+}
+
+static const host_model_periph_ops_t HashOps = {Hash_Read, Hash_Write, Hash_Event, Hash_Reset};
+static host_model_periph_t HashPeriph = {"HASH", HASH_BASE_NS, 0x400U, HOST_MODEL_AHB_CYCLES, &HashOps,
+                                         HOST_MODEL_NO_EVENT, &Hash};
+
+/* Exported functions --------------------------------------------------------*/
+void host_model_hash_register(void)
+{
+  host_model_register(&HashPeriph);
+}
+
+void HOST_MODEL_HASH_GetStats(host_model_hash_stats_t *p_stats)
+{
+  host_model_sync();
+  *p_stats = Hash.stats;
+}
@@ -0,0 +1,1163 @@
+/**
+  ******************************************************************************
+  * @file    host_model.c
+  * @brief   Core of the host model: access hooks, virtual clock, NVIC, SysTick, RCC and GPIO
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ * The hooks are called before the access. A read hook updates the register in memory before the CPU reads it. A write
+ * hook saves the register and leaves the access pending: its effect is applied with the written value at the next
+ * hook or model call, which is the next point where the CPU state can be observed.
+ *
+ * Each hook first applies the pending write, then advances the clock by the cost of the access, runs the peripheral
+ * events due and takes the pending interrupts. The handlers run nested in the hook, their own accesses going through
+ * the same path.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+
+#include "host_model_internal.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define PERIPH_REGION_BASE       0x40000000UL   /*!< Non-secure peripherals                  */
+#define PERIPH_REGION_SIZE       0x08000000UL
+#define CORE_REGION_BASE         0xE0000000UL   /*!< Private peripheral bus                  */
+#define CORE_REGION_SIZE         0x00100000UL
+#define PAGE_SHIFT               10U            /*!< Smallest register block: 1 Kbyte        */
+
+#define PERIPH_MAX_NBR           48U
+#define EXC_SYSTICK              15U
+#define EXC_NBR                  (16U + 128U)   /*!< Exceptions, then the device interrupts  */
+#define EXC_WORD_NBR             ((EXC_NBR + 63U) / 64U)
+#define EXC_ENTRY_CYCLES         12U
+#define EXC_EXIT_CYCLES          10U
+#define RAM_ACCESS_CYCLES        1U
+#define MIN_RAM_ADDRESS          0x00010000UL   /*!< Lower addresses are bus errors          */
+
+/* System control space offsets */
+#define SCS_BASE_ADDR            0xE000E000UL
+#define SCS_SYSTICK_CTRL         0x010U
+#define SCS_SYSTICK_LOAD         0x014U
+#define SCS_SYSTICK_VAL          0x018U
+#define SCS_NVIC_ISER            0x100U
+#define SCS_NVIC_ICER            0x180U
+#define SCS_NVIC_ISPR            0x200U
+#define SCS_NVIC_ICPR            0x280U
+#define SCS_NVIC_IABR            0x300U
+#define SCS_NVIC_IPR             0x400U
+#define SCS_NVIC_IPR_END         0x480U
+#define SCS_SCB_ICSR             0xD04U
+#define SCS_SCB_AIRCR            0xD0CU
+#define SCS_SCB_SHPR             0xD18U
+#define SCS_NVIC_STIR            0xF00U
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+  host_model_periph_t *p_periph;
+  uint32_t offset;
+  uint32_t size;
+  uint32_t old_word;
+} pending_write_t;
+
+typedef struct
+{
+  uint32_t primask;
+  uint32_t basepri;
+  uint32_t exclusive;                     /*!< Exclusive monitor open         */
+  uint32_t no_dispatch;                   /*!< Exclusive store in progress    */
+  uint32_t active_nbr;
+  uint32_t active[EXC_NBR];               /*!< Stack of the active exceptions */
+  uint64_t handler_start;
+} cpu_state_t;
+
+typedef struct
+{
+  uint64_t enabled[EXC_WORD_NBR];
+  uint64_t latched[EXC_WORD_NBR];         /*!< Pending set by software or a pulse */
+  uint64_t level[EXC_WORD_NBR];           /*!< Interrupt lines of the peripherals  */
+  uint64_t active[EXC_WORD_NBR];
+  uint8_t priority[EXC_NBR];
+  uint32_t prigroup;
+  uint32_t count[EXC_NBR];
+  uint32_t unhandled_nbr;
+} nvic_state_t;
+
+typedef struct
+{
+  uint32_t ctrl;
+  uint32_t load;
+  uint32_t count_flag;
+  uint64_t start;                         /*!< Cycle of the last reload */
+} systick_state_t;
+
+/* Private variables ---------------------------------------------------------*/
+uint64_t host_model_now;
+host_model_stats_t host_model_stats;
+
+static host_model_periph_t *PeriphPages[PERIPH_REGION_SIZE >> PAGE_SHIFT];
+static host_model_periph_t *CorePages[CORE_REGION_SIZE >> PAGE_SHIFT];
+static host_model_periph_t *Periphs[PERIPH_MAX_NBR];
+static uint32_t PeriphNbr;
+static uint64_t NextEvent = HOST_MODEL_NO_EVENT;
+static pending_write_t Pending;
+static cpu_state_t Cpu;
+static nvic_state_t Nvic;
+static systick_state_t SysTickState;
+static uint32_t Mapped;
+
+/* Private functions prototypes ----------------------------------------------*/
+static void Default_Handler(void);
+
+/* Handlers ------------------------------------------------------------------*/
+/* The tests define the handlers they use, as the application does. An interrupt without handler is disabled and
+   counted, see HOST_MODEL_GetUnhandledIrq() */
+void HAL_IncTick(void);
+__attribute__((weak)) void SysTick_Handler(void)
+{
+  HAL_IncTick();
+}
+
+void GPDMA1_Channel0_IRQHandler(void) __attribute__((weak, alias("Default_Handler")));
+void GPDMA1_Channel1_IRQHandler(void) __attribute__((weak, alias("Default_Handler")));
+void GPDMA1_Channel2_IRQHandler(void) __attribute__((weak, alias("Default_Handler")));
+void GPDMA1_Channel3_IRQHandler(void) __attribute__((weak, alias("Default_Handler")));
+void GPDMA1_Channel4_IRQHandler(void) __attribute__((weak, alias("Default_Handler")));
+void GPDMA1_Channel5_IRQHandler(void) __attribute__((weak, alias("Default_Handler")));
+void GPDMA1_Channel6_IRQHandler(void) __attribute__((weak, alias("Default_Handler")));
+void GPDMA1_Channel7_IRQHandler(void) __attribute__((weak, alias("Default_Handler")));
+void GPDMA1_Channel8_IRQHandler(void) __attribute__((weak, alias("Default_Handler")));
+void GPDMA1_Channel9_IRQHandler(void) __attribute__((weak, alias("Default_Handler")));
+void GPDMA1_Channel10_IRQHandler(void) __attribute__((weak, alias("Default_Handler")));
+void GPDMA1_Channel11_IRQHandler(void) __attribute__((weak, alias("Default_Handler")));
+void GPDMA1_Channel12_IRQHandler(void) __attribute__((weak, alias("Default_Handler")));
+void GPDMA1_Channel13_IRQHandler(void) __attribute__((weak, alias("Default_Handler")));
+void GPDMA1_Channel14_IRQHandler(void) __attribute__((weak, alias("Default_Handler")));
+void GPDMA1_Channel15_IRQHandler(void) __attribute__((weak, alias("Default_Handler")));
+void SPI1_IRQHandler(void) __attribute__((weak, alias("Default_Handler")));
+void SPI2_IRQHandler(void) __attribute__((weak, alias("Default_Handler")));
+void SPI3_IRQHandler(void) __attribute__((weak, alias("Default_Handler")));
+void USART1_IRQHandler(void) __attribute__((weak, alias("Default_Handler")));
+void USART2_IRQHandler(void) __attribute__((weak, alias("Default_Handler")));
+void USART3_IRQHandler(void) __attribute__((weak, alias("Default_Handler")));
+void UART4_IRQHandler(void) __attribute__((weak, alias("Default_Handler")));
+void UART5_IRQHandler(void) __attribute__((weak, alias("Default_Handler")));
+void LPUART1_IRQHandler(void) __attribute__((weak, alias("Default_Handler")));
+void RNG_IRQHandler(void) __attribute__((weak, alias("Default_Handler")));
+void AES_IRQHandler(void) __attribute__((weak, alias("Default_Handler")));
+
+static void (*const Handlers[EXC_NBR])(void) =
+{
+  [EXC_SYSTICK]                    = SysTick_Handler,
+  [16U + (uint32_t)GPDMA1_CH0_IRQn]  = GPDMA1_Channel0_IRQHandler,
+  [16U + (uint32_t)GPDMA1_CH1_IRQn]  = GPDMA1_Channel1_IRQHandler,
+  [16U + (uint32_t)GPDMA1_CH2_IRQn]  = GPDMA1_Channel2_IRQHandler,
+  [16U + (uint32_t)GPDMA1_CH3_IRQn]  = GPDMA1_Channel3_IRQHandler,
+  [16U + (uint32_t)GPDMA1_CH4_IRQn]  = GPDMA1_Channel4_IRQHandler,
+  [16U + (uint32_t)GPDMA1_CH5_IRQn]  = GPDMA1_Channel5_IRQHandler,
+  [16U + (uint32_t)GPDMA1_CH6_IRQn]  = GPDMA1_Channel6_IRQHandler,
+  [16U + (uint32_t)GPDMA1_CH7_IRQn]  = GPDMA1_Channel7_IRQHandler,
+  [16U + (uint32_t)GPDMA1_CH8_IRQn]  = GPDMA1_Channel8_IRQHandler,
+  [16U + (uint32_t)GPDMA1_CH9_IRQn]  = GPDMA1_Channel9_IRQHandler,
+  [16U + (uint32_t)GPDMA1_CH10_IRQn] = GPDMA1_Channel10_IRQHandler,
+  [16U + (uint32_t)GPDMA1_CH11_IRQn] = GPDMA1_Channel11_IRQHandler,
+  [16U + (uint32_t)GPDMA1_CH12_IRQn] = GPDMA1_Channel12_IRQHandler,
+  [16U + (uint32_t)GPDMA1_CH13_IRQn] = GPDMA1_Channel13_IRQHandler,
+  [16U + (uint32_t)GPDMA1_CH14_IRQn] = GPDMA1_Channel14_IRQHandler,
+  [16U + (uint32_t)GPDMA1_CH15_IRQn] = GPDMA1_Channel15_IRQHandler,
+  [16U + (uint32_t)SPI1_IRQn]        = SPI1_IRQHandler,
+  [16U + (uint32_t)SPI2_IRQn]        = SPI2_IRQHandler,
+  [16U + (uint32_t)SPI3_IRQn]        = SPI3_IRQHandler,
+  [16U + (uint32_t)USART1_IRQn]      = USART1_IRQHandler,
+  [16U + (uint32_t)USART2_IRQn]      = USART2_IRQHandler,
+  [16U + (uint32_t)USART3_IRQn]      = USART3_IRQHandler,
+  [16U + (uint32_t)UART4_IRQn]       = UART4_IRQHandler,
+  [16U + (uint32_t)UART5_IRQn]       = UART5_IRQHandler,
+  [16U + (uint32_t)LPUART1_IRQn]     = LPUART1_IRQHandler,
+  [16U + (uint32_t)RNG_IRQn]         = RNG_IRQHandler,
+  [16U + (uint32_t)AES_IRQn]         = AES_IRQHandler,
+};
+
+/* Private functions ---------------------------------------------------------*/
+static uint32_t TestBit(const uint64_t *p_bits, uint32_t index)
+{
+  return (uint32_t)(p_bits[index / 64U] >> (index % 64U)) & 1U;
+}
+
+static void SetBit(uint64_t *p_bits, uint32_t index, uint32_t value)
+{
+  if (value != 0U)
+  {
+    p_bits[index / 64U] |= (1ULL << (index % 64U));
+  }
+  else
+  {
+    p_bits[index / 64U] &= ~(1ULL << (index % 64U));
+  }
+}
+
+static host_model_periph_t *Lookup(uintptr_t address)
+{
+  if ((address >= PERIPH_REGION_BASE) && (address < (PERIPH_REGION_BASE + PERIPH_REGION_SIZE)))
+  {
+    return PeriphPages[(address - PERIPH_REGION_BASE) >> PAGE_SHIFT];
+  }
+  if ((address >= CORE_REGION_BASE) && (address < (CORE_REGION_BASE + CORE_REGION_SIZE)))
+  {
+    return CorePages[(address - CORE_REGION_BASE) >> PAGE_SHIFT];
+  }
+  return NULL;
+}
+
+static void *MapRegion(uintptr_t base, size_t size)
+{
+  void *p_region = mmap((void *)base, size, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED_NOREPLACE, -1, 0);
+
+  if (p_region != (void *)base)
+  {
+    (void)fprintf(stderr, "host model: cannot map the registers at 0x%08lx\n", (unsigned long)base);
+    exit(2);
+  }
+  return p_region;
+}
+
+/* Apply the write left pending by the last hook */
+static void CommitPending(void)
+{
+  host_model_periph_t *p_periph = Pending.p_periph;
+  uint32_t value = 0U;
+
+  if (p_periph == NULL)
+  {
+    return;
+  }
+  Pending.p_periph = NULL;
+  (void)memcpy(&value, (const void *)(p_periph->base + Pending.offset), Pending.size);
+  if (p_periph->p_ops->write != NULL)
+  {
+    p_periph->p_ops->write(p_periph, Pending.offset, Pending.size, value, Pending.old_word);
+  }
+}
+
+static void RunDueEvents(void)
+{
+  uint64_t next = HOST_MODEL_NO_EVENT;
+
+  for (uint32_t i = 0U; i < PeriphNbr; i++)
+  {
+    host_model_periph_t *p_periph = Periphs[i];
+
+    if (p_periph->next_event <= host_model_now)
+    {
+      p_periph->next_event = HOST_MODEL_NO_EVENT;
+      p_periph->p_ops->event(p_periph);
+    }
+  }
+  for (uint32_t i = 0U; i < PeriphNbr; i++)
+  {
+    if (Periphs[i]->next_event < next)
+    {
+      next = Periphs[i]->next_event;
+    }
+  }
+  NextEvent = next;
+}
+
+/* Advance the clock, running the peripheral events on the way */
+static void AdvanceClock(uint64_t cycle_nbr)
+{
+  const uint64_t target = host_model_now + cycle_nbr;
+
+  while (NextEvent <= target)
+  {
+    if (NextEvent > host_model_now)
+    {
+      host_model_now = NextEvent;
+    }
+    RunDueEvents();
+  }
+  host_model_now = target;
+}
+
+static uint32_t GroupPriority(uint32_t priority)
+{
+  const uint32_t sub_bits = (Nvic.prigroup >= (8U - __NVIC_PRIO_BITS)) ? (Nvic.prigroup + 1U) : 0U;
+
+  return (sub_bits >= 8U) ? 0U : (priority & (0xFFU << sub_bits) & 0xFFU);
+}
+
+/* Priority under which an exception preempts, 256 in thread mode without masking */
+static uint32_t ExecutionPriority(void)
+{
+  uint32_t priority = 256U;
+
+  if (Cpu.active_nbr != 0U)
+  {
+    priority = GroupPriority(Nvic.priority[Cpu.active[Cpu.active_nbr - 1U]]);
+  }
+  if ((Cpu.basepri != 0U) && (GroupPriority(Cpu.basepri) < priority))
+  {
+    priority = GroupPriority(Cpu.basepri);
+  }
+  if (Cpu.primask != 0U)
+  {
+    priority = 0U;
+  }
+  return priority;
+}
+
+static uint32_t IsPending(uint32_t exception)
+{
+  return TestBit(Nvic.latched, exception)
+         | (TestBit(Nvic.level, exception) & (TestBit(Nvic.active, exception) ^ 1U));
+}
+
+/* Highest priority pending and enabled exception, EXC_NBR when none */
+static uint32_t HighestPending(void)
+{
+  uint32_t best = EXC_NBR;
+
+  for (uint32_t w = 0U; w < EXC_WORD_NBR; w++)
+  {
+    uint64_t candidates = (Nvic.latched[w] | (Nvic.level[w] & ~Nvic.active[w])) & Nvic.enabled[w];
+
+    while (candidates != 0U)
+    {
+      const uint32_t exception = (w * 64U) + (uint32_t)__builtin_ctzll(candidates);
+
+      candidates &= candidates - 1U;
+      if ((best == EXC_NBR) || (Nvic.priority[exception] < Nvic.priority[best]))
+      {
+        best = exception;
+      }
+    }
+  }
+  return best;
+}
+
+static void Dispatch(void)
+{
+  if (Cpu.no_dispatch != 0U)
+  {
+    return;
+  }
+  for (;;)
+  {
+    const uint32_t exception = HighestPending();
+
+    if ((exception == EXC_NBR) || (GroupPriority(Nvic.priority[exception]) >= ExecutionPriority()))
+    {
+      return;
+    }
+
+    SetBit(Nvic.latched, exception, 0U);
+    SetBit(Nvic.active, exception, 1U);
+    if (Cpu.active_nbr == 0U)
+    {
+      Cpu.handler_start = host_model_now;
+    }
+    Cpu.active[Cpu.active_nbr] = exception;
+    Cpu.active_nbr++;
+    Cpu.exclusive = 0U;
+    Nvic.count[exception]++;
+    host_model_stats.irq_nbr++;
+    AdvanceClock(EXC_ENTRY_CYCLES);
+
+    if (Handlers[exception] != NULL)
+    {
+      Handlers[exception]();
+    }
+    else
+    {
+      Default_Handler();
+    }
+
+    CommitPending();
+    AdvanceClock(EXC_EXIT_CYCLES);
+    Cpu.active_nbr--;
+    SetBit(Nvic.active, exception, 0U);
+    Cpu.exclusive = 0U;
+    if (Cpu.active_nbr == 0U)
+    {
+      host_model_stats.irq_cycle_nbr += host_model_now - Cpu.handler_start;
+    }
+  }
+}
+
+static void Default_Handler(void)
+{
+  const uint32_t exception = Cpu.active[Cpu.active_nbr - 1U];
+
+  (void)fprintf(stderr, "host model: no handler for the exception %u, disabled\n", exception);
+  SetBit(Nvic.enabled, exception, 0U);
+  Nvic.unhandled_nbr++;
+}
+
+/* Volatile access of the CPU */
+static void Access(uintptr_t address, uint32_t size, uint32_t write)
+{
+  host_model_periph_t *p_periph;
+  uint32_t offset;
+
+  CommitPending();
+  p_periph = Lookup(address);
+  if (p_periph == NULL)
+  {
+    host_model_stats.cpu_ram_access_nbr++;
+    AdvanceClock(RAM_ACCESS_CYCLES);
+    Dispatch();
+    return;
+  }
+
+  host_model_stats.cpu_reg_access_nbr++;
+  AdvanceClock(p_periph->access_cycles);
+  Dispatch();
+
+  offset = (uint32_t)(address - p_periph->base);
+  if (write == 0U)
+  {
+    if (p_periph->p_ops->read != NULL)
+    {
+      p_periph->p_ops->read(p_periph, offset, size);
+    }
+  }
+  else
+  {
+    Pending.p_periph = p_periph;
+    Pending.offset = offset;
+    Pending.size = size;
+    Pending.old_word = *host_model_reg(p_periph, offset & ~3U);
+  }
+}
+
+/* SysTick -------------------------------------------------------------------*/
+static uint64_t SysTickPeriod(void)
+{
+  const uint64_t period = (uint64_t)SysTickState.load + 1U;
+
+  return ((SysTickState.ctrl & SysTick_CTRL_CLKSOURCE_Msk) != 0U) ? period : (period * 8U);
+}
+
+static uint64_t SysTickNext(void)
+{
+  const uint64_t period = SysTickPeriod();
+
+  return SysTickState.start + ((((host_model_now - SysTickState.start) / period) + 1U) * period);
+}
+
+static void SysTickRestart(host_model_periph_t *p_periph)
+{
+  SysTickState.start = host_model_now;
+  if (((SysTickState.ctrl & SysTick_CTRL_ENABLE_Msk) != 0U) && (SysTickState.load != 0U))
+  {
+    host_model_schedule(p_periph, SysTickNext());
+  }
+  else
+  {
+    p_periph->next_event = HOST_MODEL_NO_EVENT;
+  }
+}
+
+/* System control space: SysTick, NVIC and SCB -------------------------------*/
+static void Scs_Read(host_model_periph_t *p_periph, uint32_t offset, uint32_t size)
+{
+  const uint32_t word = offset & ~3U;
+  volatile uint32_t *p_reg = host_model_reg(p_periph, word);
+  (void)size;
+
+  if (word == SCS_SYSTICK_CTRL)
+  {
+    *p_reg = SysTickState.ctrl | ((SysTickState.count_flag != 0U) ? SysTick_CTRL_COUNTFLAG_Msk : 0U);
+    SysTickState.count_flag = 0U;
+  }
+  else if (word == SCS_SYSTICK_VAL)
+  {
+    const uint64_t period = SysTickPeriod();
+    const uint64_t elapsed = (host_model_now - SysTickState.start) % period;
+    const uint64_t divider = ((SysTickState.ctrl & SysTick_CTRL_CLKSOURCE_Msk) != 0U) ? 1U : 8U;
+
+    *p_reg = (uint32_t)((period - 1U - elapsed) / divider);
+  }
+  else if (((word >= SCS_NVIC_ISER) && (word < (SCS_NVIC_ISER + 0x40U)))
+           || ((word >= SCS_NVIC_ICER) && (word < (SCS_NVIC_ICER + 0x40U)))
+           || ((word >= SCS_NVIC_ISPR) && (word < (SCS_NVIC_ISPR + 0x40U)))
+           || ((word >= SCS_NVIC_ICPR) && (word < (SCS_NVIC_ICPR + 0x40U)))
+           || ((word >= SCS_NVIC_IABR) && (word < (SCS_NVIC_IABR + 0x40U))))
+  {
+    const uint32_t first = 16U + (((word & 0x3FU) / 4U) * 32U);
+    uint32_t value = 0U;
+
+    for (uint32_t i = 0U; (i < 32U) && ((first + i) < EXC_NBR); i++)
+    {
+      uint32_t bit;
+
+      if (word >= SCS_NVIC_IABR)
+      {
+        bit = TestBit(Nvic.active, first + i);
+      }
+      else if (word >= SCS_NVIC_ISPR)
+      {
+        bit = IsPending(first + i);
+      }
+      else
+      {
+        bit = TestBit(Nvic.enabled, first + i);
+      }
+      value |= bit << i;
+    }
+    *p_reg = value;
+  }
+  else if (word == SCS_SCB_ICSR)
+  {
+    *p_reg = ((Cpu.active_nbr != 0U) ? Cpu.active[Cpu.active_nbr - 1U] : 0U)
+             | ((IsPending(EXC_SYSTICK) != 0U) ? SCB_ICSR_PENDSTSET_Msk : 0U);
+  }
+  else if (word == SCS_SCB_AIRCR)
+  {
+    *p_reg = (0xFA05UL << SCB_AIRCR_VECTKEYSTAT_Pos) | (Nvic.prigroup << SCB_AIRCR_PRIGROUP_Pos);
+  }
+  else
+  {
+    /* Other registers read as written */
+  }
+}
+
+static void Scs_WriteBits(uint32_t word, uint32_t base, uint32_t value, uint64_t *p_bits, uint32_t set)
+{
+  const uint32_t first = 16U + (((word - base) / 4U) * 32U);
+
+  for (uint32_t i = 0U; (i < 32U) && ((first + i) < EXC_NBR); i++)
+  {
+    if ((value & (1UL << i)) != 0U)
+    {
+      SetBit(p_bits, first + i, set);
+    }
+  }
+}
+
+static void Scs_Write(host_model_periph_t *p_periph, uint32_t offset, uint32_t size, uint32_t value,
+                      uint32_t old_word)
+{
+  const uint32_t word = offset & ~3U;
+  volatile uint32_t *p_reg = host_model_reg(p_periph, word);
+  const uint32_t word_value = *p_reg;
+
+  if (word == SCS_SYSTICK_CTRL)
+  {
+    const uint32_t enabling = ((SysTickState.ctrl & SysTick_CTRL_ENABLE_Msk) == 0U)
+                              && ((word_value & SysTick_CTRL_ENABLE_Msk) != 0U);
+
+    SysTickState.ctrl = word_value & (SysTick_CTRL_ENABLE_Msk | SysTick_CTRL_TICKINT_Msk
+                                      | SysTick_CTRL_CLKSOURCE_Msk);
+    if ((enabling != 0U) || ((SysTickState.ctrl & SysTick_CTRL_ENABLE_Msk) == 0U))
+    {
+      SysTickRestart(p_periph);
+    }
+  }
+  else if (word == SCS_SYSTICK_LOAD)
+  {
+    SysTickState.load = word_value & SysTick_LOAD_RELOAD_Msk;
+  }
+  else if (word == SCS_SYSTICK_VAL)
+  {
+    SysTickState.count_flag = 0U;
+    SysTickRestart(p_periph);
+  }
+  else if ((word >= SCS_NVIC_ISER) && (word < (SCS_NVIC_ISER + 0x40U)))
+  {
+    Scs_WriteBits(word, SCS_NVIC_ISER, word_value, Nvic.enabled, 1U);
+  }
+  else if ((word >= SCS_NVIC_ICER) && (word < (SCS_NVIC_ICER + 0x40U)))
+  {
+    Scs_WriteBits(word, SCS_NVIC_ICER, word_value, Nvic.enabled, 0U);
+  }
+  else if ((word >= SCS_NVIC_ISPR) && (word < (SCS_NVIC_ISPR + 0x40U)))
+  {
+    Scs_WriteBits(word, SCS_NVIC_ISPR, word_value, Nvic.latched, 1U);
+  }
+  else if ((word >= SCS_NVIC_ICPR) && (word < (SCS_NVIC_ICPR + 0x40U)))
+  {
+    Scs_WriteBits(word, SCS_NVIC_ICPR, word_value, Nvic.latched, 0U);
+  }
+  else if ((word >= SCS_NVIC_IPR) && (word < SCS_NVIC_IPR_END))
+  {
+    for (uint32_t i = 0U; i < 4U; i++)
+    {
+      Nvic.priority[16U + (word - SCS_NVIC_IPR) + i] = (uint8_t)((word_value >> (i * 8U)) & 0xF0U);
+    }
+  }
+  else if ((word >= SCS_SCB_SHPR) && (word < (SCS_SCB_SHPR + 12U)))
+  {
+    for (uint32_t i = 0U; i < 4U; i++)
+    {
+      Nvic.priority[4U + (word - SCS_SCB_SHPR) + i] = (uint8_t)((word_value >> (i * 8U)) & 0xF0U);
+    }
+  }
+  else if (word == SCS_SCB_ICSR)
+  {
+    if ((value & SCB_ICSR_PENDSTSET_Msk) != 0U)
+    {
+      SetBit(Nvic.latched, EXC_SYSTICK, 1U);
+    }
+    if ((value & SCB_ICSR_PENDSTCLR_Msk) != 0U)
+    {
+      SetBit(Nvic.latched, EXC_SYSTICK, 0U);
+    }
+  }
+  else if (word == SCS_SCB_AIRCR)
+  {
+    if ((word_value >> SCB_AIRCR_VECTKEY_Pos) == 0x05FAU)
+    {
+      Nvic.prigroup = (word_value & SCB_AIRCR_PRIGROUP_Msk) >> SCB_AIRCR_PRIGROUP_Pos;
+    }
+  }
+  else if (word == SCS_NVIC_STIR)
+  {
+    if ((16U + (word_value & 0x1FFU)) < EXC_NBR)
+    {
+      SetBit(Nvic.latched, 16U + (word_value & 0x1FFU), 1U);
+    }
+  }
+  else
+  {
+    /* Other registers hold what is written */
+  }
+  (void)size;
+  (void)old_word;
+}
+
+static void Scs_Event(host_model_periph_t *p_periph)
+{
+  SysTickState.count_flag = 1U;
+  if ((SysTickState.ctrl & SysTick_CTRL_TICKINT_Msk) != 0U)
+  {
+    SetBit(Nvic.latched, EXC_SYSTICK, 1U);
+  }
+  host_model_schedule(p_periph, SysTickNext());
+}
+
+static void Scs_Reset(host_model_periph_t *p_periph)
+{
+  (void)memset(&SysTickState, 0, sizeof(SysTickState));
+  (void)memset(&Nvic, 0, sizeof(Nvic));
+  SetBit(Nvic.enabled, EXC_SYSTICK, 1U);
+  *host_model_reg(p_periph, 0xD00U) = 0x410FD214UL;   /* CPUID of a Cortex-M33 r0p4 */
+}
+
+static const host_model_periph_ops_t ScsOps = {Scs_Read, Scs_Write, Scs_Event, Scs_Reset};
+static host_model_periph_t Scs = {"SCS", SCS_BASE_ADDR, 0x1000U, 1U, &ScsOps, HOST_MODEL_NO_EVENT, NULL};
+
+/* RCC: the clocks are ready as soon as enabled and the system clock switch is immediate -------------------------*/
+static void Rcc_Write(host_model_periph_t *p_periph, uint32_t offset, uint32_t size, uint32_t value,
+                      uint32_t old_word)
+{
+  const uint32_t word = offset & ~3U;
+  volatile uint32_t *p_reg = host_model_reg(p_periph, word);
+  uint32_t reg = *p_reg;
+  (void)size;
+  (void)value;
+  (void)old_word;
+
+  if (word == offsetof(RCC_TypeDef, CR))
+  {
+    static const uint32_t on_ready[][2] =
+    {
+      {RCC_CR_MSISON, RCC_CR_MSISRDY}, {RCC_CR_MSIKON, RCC_CR_MSIKRDY}, {RCC_CR_HSION, RCC_CR_HSIRDY},
+      {RCC_CR_HSI48ON, RCC_CR_HSI48RDY}, {RCC_CR_HSEON, RCC_CR_HSERDY}, {RCC_CR_PLL1ON, RCC_CR_PLL1RDY},
+      {RCC_CR_PLL2ON, RCC_CR_PLL2RDY}, {RCC_CR_PLL3ON, RCC_CR_PLL3RDY},
+    };
+
+    for (uint32_t i = 0U; i < (sizeof(on_ready) / sizeof(on_ready[0])); i++)
+    {
+      reg = ((reg & on_ready[i][0]) != 0U) ? (reg | on_ready[i][1]) : (reg & ~on_ready[i][1]);
+    }
+    *p_reg = reg;
+  }
+  else if (word == offsetof(RCC_TypeDef, CFGR1))
+  {
+    *p_reg = (reg & ~RCC_CFGR1_SWS) | ((reg & RCC_CFGR1_SW) << RCC_CFGR1_SWS_Pos);
+  }
+  else if (word == offsetof(RCC_TypeDef, BDCR))
+  {
+    reg = ((reg & RCC_BDCR_LSEON) != 0U) ? (reg | RCC_BDCR_LSERDY) : (reg & ~RCC_BDCR_LSERDY);
+    *p_reg = ((reg & RCC_BDCR_LSION) != 0U) ? (reg | RCC_BDCR_LSIRDY) : (reg & ~RCC_BDCR_LSIRDY);
+  }
+  else
+  {
+    /* Enable and reset registers hold what is written: the peripherals are not gated by their clock */
+  }
+}
+
+static void Rcc_Event(host_model_periph_t *p_periph)
+{
+  (void)p_periph;
+}
+
+static void Rcc_Reset(host_model_periph_t *p_periph)
+{
+  *host_model_reg(p_periph, offsetof(RCC_TypeDef, CR)) = RCC_CR_MSISON | RCC_CR_MSISRDY | RCC_CR_MSIKON
+                                                          | RCC_CR_MSIKRDY;
+  *host_model_reg(p_periph, offsetof(RCC_TypeDef, ICSCR1)) = (4UL << RCC_ICSCR1_MSISRANGE_Pos)
+                                                              | (4UL << RCC_ICSCR1_MSIKRANGE_Pos);
+  *host_model_reg(p_periph, offsetof(RCC_TypeDef, CSR)) = (4UL << RCC_CSR_MSISSRANGE_Pos)
+                                                           | (4UL << RCC_CSR_MSIKSRANGE_Pos);
+}
+
+static const host_model_periph_ops_t RccOps = {NULL, Rcc_Write, Rcc_Event, Rcc_Reset};
+static host_model_periph_t Rcc = {"RCC", RCC_BASE_NS, 0x400U, HOST_MODEL_AHB_CYCLES, &RccOps, HOST_MODEL_NO_EVENT,
+                                  NULL};
+
+/* GPIO: the set and reset registers act on the output data register, which is read back as input ---------------*/
+static void Gpio_Read(host_model_periph_t *p_periph, uint32_t offset, uint32_t size)
+{
+  (void)size;
+  if ((offset & ~3U) == offsetof(GPIO_TypeDef, IDR))
+  {
+    *host_model_reg(p_periph, offsetof(GPIO_TypeDef, IDR)) = *host_model_reg(p_periph, offsetof(GPIO_TypeDef, ODR));
+  }
+}
+
+static void Gpio_Write(host_model_periph_t *p_periph, uint32_t offset, uint32_t size, uint32_t value,
+                       uint32_t old_word)
+{
+  const uint32_t word = offset & ~3U;
+  volatile uint32_t *p_odr = host_model_reg(p_periph, offsetof(GPIO_TypeDef, ODR));
+  const uint32_t word_value = *host_model_reg(p_periph, word);
+  (void)size;
+  (void)value;
+  (void)old_word;
+
+  if (word == offsetof(GPIO_TypeDef, BSRR))
+  {
+    *p_odr = (*p_odr | (word_value & 0xFFFFU)) & ~(word_value >> 16U);
+    *host_model_reg(p_periph, word) = 0U;
+  }
+  else if (word == offsetof(GPIO_TypeDef, BRR))
+  {
+    *p_odr &= ~(word_value & 0xFFFFU);
+    *host_model_reg(p_periph, word) = 0U;
+  }
+  else
+  {
+    /* Configuration registers hold what is written */
+  }
+}
+
+static const host_model_periph_ops_t GpioOps = {Gpio_Read, Gpio_Write, Rcc_Event, NULL};
+static host_model_periph_t Gpios[] =
+{
+  {"GPIOA", GPIOA_BASE_NS, 0x400U, HOST_MODEL_AHB_CYCLES, &GpioOps, HOST_MODEL_NO_EVENT, NULL},
+  {"GPIOB", GPIOB_BASE_NS, 0x400U, HOST_MODEL_AHB_CYCLES, &GpioOps, HOST_MODEL_NO_EVENT, NULL},
+  {"GPIOC", GPIOC_BASE_NS, 0x400U, HOST_MODEL_AHB_CYCLES, &GpioOps, HOST_MODEL_NO_EVENT, NULL},
+  {"GPIOD", GPIOD_BASE_NS, 0x400U, HOST_MODEL_AHB_CYCLES, &GpioOps, HOST_MODEL_NO_EVENT, NULL},
+  {"GPIOE", GPIOE_BASE_NS, 0x400U, HOST_MODEL_AHB_CYCLES, &GpioOps, HOST_MODEL_NO_EVENT, NULL},
+  {"GPIOF", GPIOF_BASE_NS, 0x400U, HOST_MODEL_AHB_CYCLES, &GpioOps, HOST_MODEL_NO_EVENT, NULL},
+  {"GPIOG", GPIOG_BASE_NS, 0x400U, HOST_MODEL_AHB_CYCLES, &GpioOps, HOST_MODEL_NO_EVENT, NULL},
+  {"GPIOH", GPIOH_BASE_NS, 0x400U, HOST_MODEL_AHB_CYCLES, &GpioOps, HOST_MODEL_NO_EVENT, NULL},
+  {"GPIOI", GPIOI_BASE_NS, 0x400U, HOST_MODEL_AHB_CYCLES, &GpioOps, HOST_MODEL_NO_EVENT, NULL},
+};
+
+/* Registers of the other system peripherals used by the HAL, held as written */
+static const host_model_periph_ops_t PlainOps = {NULL, NULL, Rcc_Event, NULL};
+static host_model_periph_t PlainPeriphs[] =
+{
+  {"PWR", PWR_BASE_NS, 0x400U, HOST_MODEL_AHB_CYCLES, &PlainOps, HOST_MODEL_NO_EVENT, NULL},
+  {"FLASH", FLASH_R_BASE_NS, 0x400U, HOST_MODEL_AHB_CYCLES, &PlainOps, HOST_MODEL_NO_EVENT, NULL},
+  {"DBGMCU", DBGMCU_BASE, 0x400U, HOST_MODEL_APB_CYCLES, &PlainOps, HOST_MODEL_NO_EVENT, NULL},
+};
+
+/* Exported functions for the peripheral models ------------------------------*/
+void host_model_register(host_model_periph_t *p_periph)
+{
+  for (uintptr_t address = p_periph->base; address < (p_periph->base + p_periph->size);
+       address += (1UL << PAGE_SHIFT))
+  {
+    if ((address >= PERIPH_REGION_BASE) && (address < (PERIPH_REGION_BASE + PERIPH_REGION_SIZE)))
+    {
+      PeriphPages[(address - PERIPH_REGION_BASE) >> PAGE_SHIFT] = p_periph;
+    }
+    else
+    {
+      CorePages[(address - CORE_REGION_BASE) >> PAGE_SHIFT] = p_periph;
+    }
+  }
+  p_periph->next_event = HOST_MODEL_NO_EVENT;
+  Periphs[PeriphNbr] = p_periph;
+  PeriphNbr++;
+  if (p_periph->p_ops->reset != NULL)
+  {
+    p_periph->p_ops->reset(p_periph);
+  }
+}
+
+void host_model_schedule(host_model_periph_t *p_periph, uint64_t cycle)
+{
+  p_periph->next_event = cycle;
+  if (cycle < NextEvent)
+  {
+    NextEvent = cycle;
+  }
+}
+
+void host_model_sync(void)
+{
+  CommitPending();
+}
+
+void host_model_irq_set_level(IRQn_Type irqn, uint32_t level)
+{
+  SetBit(Nvic.level, 16U + (uint32_t)irqn, (level != 0U) ? 1U : 0U);
+}
+
+uint32_t host_model_bus_read(uint32_t address, uint32_t size, uint32_t *p_value)
+{
+  host_model_periph_t *p_periph = Lookup(address);
+
+  *p_value = 0U;
+  if (address < MIN_RAM_ADDRESS)
+  {
+    return 0U;
+  }
+  if (p_periph != NULL)
+  {
+    if (p_periph->p_ops->read != NULL)
+    {
+      p_periph->p_ops->read(p_periph, address - (uint32_t)p_periph->base, size);
+    }
+  }
+  else if (((address >= PERIPH_REGION_BASE) && (address < (PERIPH_REGION_BASE + PERIPH_REGION_SIZE)))
+           || (address >= CORE_REGION_BASE))
+  {
+    return 0U;
+  }
+  else
+  {
+    /* Memory */
+  }
+  (void)memcpy(p_value, (const void *)(uintptr_t)address, size);
+  return 1U;
+}
+
+uint32_t host_model_bus_write(uint32_t address, uint32_t size, uint32_t value)
+{
+  host_model_periph_t *p_periph = Lookup(address);
+
+  if (address < MIN_RAM_ADDRESS)
+  {
+    return 0U;
+  }
+  if (p_periph != NULL)
+  {
+    const uint32_t offset = address - (uint32_t)p_periph->base;
+    const uint32_t old_word = *host_model_reg(p_periph, offset & ~3U);
+
+    (void)memcpy((void *)(uintptr_t)address, &value, size);
+    if (p_periph->p_ops->write != NULL)
+    {
+      p_periph->p_ops->write(p_periph, offset, size, value, old_word);
+    }
+    return 1U;
+  }
+  if (((address >= PERIPH_REGION_BASE) && (address < (PERIPH_REGION_BASE + PERIPH_REGION_SIZE)))
+      || (address >= CORE_REGION_BASE))
+  {
+    return 0U;
+  }
+  (void)memcpy((void *)(uintptr_t)address, &value, size);
+  return 1U;
+}
+
+/* Core state of the CPU (host_model_cmsis.h) --------------------------------*/
+uint32_t host_model_cpu_get_primask(void)
+{
+  CommitPending();
+  return Cpu.primask;
+}
+
+void host_model_cpu_set_primask(uint32_t primask)
+{
+  CommitPending();
+  Cpu.primask = primask & 1U;
+  Dispatch();
+}
+
+uint32_t host_model_cpu_get_basepri(void)
+{
+  CommitPending();
+  return Cpu.basepri;
+}
+
+void host_model_cpu_set_basepri(uint32_t basepri)
+{
+  CommitPending();
+  Cpu.basepri = basepri & 0xFFU;
+  Dispatch();
+}
+
+uint32_t host_model_cpu_get_ipsr(void)
+{
+  CommitPending();
+  return (Cpu.active_nbr != 0U) ? Cpu.active[Cpu.active_nbr - 1U] : 0U;
+}
+
+void host_model_cpu_wait(void)
+{
+  CommitPending();
+  /* Woken up by an enabled interrupt pending, even when masked */
+  if ((HighestPending() == EXC_NBR) && (NextEvent != HOST_MODEL_NO_EVENT))
+  {
+    AdvanceClock(NextEvent - host_model_now);
+  }
+  AdvanceClock(1U);
+  Dispatch();
+}
+
+void host_model_cpu_nop(void)
+{
+  CommitPending();
+  AdvanceClock(1U);
+  Dispatch();
+}
+
+void host_model_cpu_load_exclusive(void)
+{
+  Cpu.exclusive = 1U;
+}
+
+uint32_t host_model_cpu_store_exclusive_begin(void)
+{
+  CommitPending();
+  if (Cpu.exclusive == 0U)
+  {
+    return 0U;
+  }
+  /* The store does not let an interrupt in */
+  Cpu.no_dispatch++;
+  return 1U;
+}
+
+void host_model_cpu_store_exclusive_end(void)
+{
+  CommitPending();
+  Cpu.no_dispatch--;
+  Cpu.exclusive = 0U;
+}
+
+void host_model_cpu_clear_exclusive(void)
+{
+  Cpu.exclusive = 0U;
+}
+
+/* Hooks of the volatile accesses, called by the code compiled with -fsanitize=thread -------------------------------*/
+void __tsan_volatile_read1(void *p_address);
+void __tsan_volatile_read2(void *p_address);
+void __tsan_volatile_read4(void *p_address);
+void __tsan_volatile_read8(void *p_address);
+void __tsan_volatile_read16(void *p_address);
+void __tsan_volatile_write1(void *p_address);
+void __tsan_volatile_write2(void *p_address);
+void __tsan_volatile_write4(void *p_address);
+void __tsan_volatile_write8(void *p_address);
+void __tsan_volatile_write16(void *p_address);
+
+void __tsan_volatile_read1(void *p_address)
+{
+  Access((uintptr_t)p_address, 1U, 0U);
+}
+
+void __tsan_volatile_read2(void *p_address)
+{
+  Access((uintptr_t)p_address, 2U, 0U);
+}
+
+void __tsan_volatile_read4(void *p_address)
+{
+  Access((uintptr_t)p_address, 4U, 0U);
+}
+
+void __tsan_volatile_read8(void *p_address)
+{
+  Access((uintptr_t)p_address, 4U, 0U);
+}
+
+void __tsan_volatile_read16(void *p_address)
+{
+  Access((uintptr_t)p_address, 4U, 0U);
+}
+
+void __tsan_volatile_write1(void *p_address)
+{
+  Access((uintptr_t)p_address, 1U, 1U);
+}
+
+void __tsan_volatile_write2(void *p_address)
+{
+  Access((uintptr_t)p_address, 2U, 1U);
+}
+
+void __tsan_volatile_write4(void *p_address)
+{
+  Access((uintptr_t)p_address, 4U, 1U);
+}
+
+void __tsan_volatile_write8(void *p_address)
+{
+  Access((uintptr_t)p_address, 4U, 1U);
+}
+
+void __tsan_volatile_write16(void *p_address)
+{
+  Access((uintptr_t)p_address, 4U, 1U);
+}
+
+/* The other entry points of the thread sanitizer run time have nothing to do */
+#define TSAN_NOP(name)   void name(void *p_address); void name(void *p_address) { (void)p_address; }
+TSAN_NOP(__tsan_read1)
+TSAN_NOP(__tsan_read2)
+TSAN_NOP(__tsan_read4)
+TSAN_NOP(__tsan_read8)
+TSAN_NOP(__tsan_read16)
+TSAN_NOP(__tsan_write1)
+TSAN_NOP(__tsan_write2)
+TSAN_NOP(__tsan_write4)
+TSAN_NOP(__tsan_write8)
+TSAN_NOP(__tsan_write16)
+TSAN_NOP(__tsan_unaligned_read2)
+TSAN_NOP(__tsan_unaligned_read4)
+TSAN_NOP(__tsan_unaligned_read8)
+TSAN_NOP(__tsan_unaligned_read16)
+TSAN_NOP(__tsan_unaligned_write2)
+TSAN_NOP(__tsan_unaligned_write4)
+TSAN_NOP(__tsan_unaligned_write8)
+TSAN_NOP(__tsan_unaligned_write16)
+TSAN_NOP(__tsan_func_entry)
+
+void __tsan_init(void);
+void __tsan_func_exit(void);
+void __tsan_read_range(void *p_address, unsigned long size);
+void __tsan_write_range(void *p_address, unsigned long size);
+void __tsan_atomic_thread_fence(int order);
+void __tsan_atomic_signal_fence(int order);
+
+void __tsan_init(void)
+{
+}
+
+void __tsan_func_exit(void)
+{
+}
+
+void __tsan_read_range(void *p_address, unsigned long size)
+{
+  (void)p_address;
+  (void)size;
+}
+
+void __tsan_write_range(void *p_address, unsigned long size)
+{
+  (void)p_address;
+  (void)size;
+}
+
+void __tsan_atomic_thread_fence(int order)
+{
+  (void)order;
+}
+
+void __tsan_atomic_signal_fence(int order)
+{
+  (void)order;
+}
+
+/* Exported functions --------------------------------------------------------*/
+void HOST_MODEL_Init(void)
+{
+  if (Mapped != 0U)
+  {
+    (void)munmap((void *)PERIPH_REGION_BASE, PERIPH_REGION_SIZE);
+    (void)munmap((void *)CORE_REGION_BASE, CORE_REGION_SIZE);
+  }
+  (void)MapRegion(PERIPH_REGION_BASE, PERIPH_REGION_SIZE);
+  (void)MapRegion(CORE_REGION_BASE, CORE_REGION_SIZE);
+  Mapped = 1U;
+
+  (void)memset(PeriphPages, 0, sizeof(PeriphPages));
+  (void)memset(CorePages, 0, sizeof(CorePages));
+  (void)memset(&Cpu, 0, sizeof(Cpu));
+  (void)memset(&Pending, 0, sizeof(Pending));
+  (void)memset(&host_model_stats, 0, sizeof(host_model_stats));
+  PeriphNbr = 0U;
+  NextEvent = HOST_MODEL_NO_EVENT;
+  host_model_now = 0U;
+
+  host_model_register(&Scs);
+  host_model_register(&Rcc);
+  for (uint32_t i = 0U; i < (sizeof(Gpios) / sizeof(Gpios[0])); i++)
+  {
+    host_model_register(&Gpios[i]);
+  }
+  for (uint32_t i = 0U; i < (sizeof(PlainPeriphs) / sizeof(PlainPeriphs[0])); i++)
+  {
+    host_model_register(&PlainPeriphs[i]);
+  }
+  host_model_gpdma_register();
+  host_model_usart_register();
+  host_model_spi_register();
+  host_model_crc_register();
+  host_model_rng_register();
+  host_model_aes_register();
+  host_model_hash_register();
+}
+
+void HOST_MODEL_Run(uint64_t cycle_nbr)
+{
+  const uint64_t target = host_model_now + cycle_nbr;
+
+  CommitPending();
+  Dispatch();
+  while (host_model_now < target)
+  {
+    const uint64_t next = (NextEvent < target) ? NextEvent : target;
+
+    AdvanceClock((next > host_model_now) ? (next - host_model_now) : 0U);
+    Dispatch();
+  }
+}
+
+uint64_t HOST_MODEL_GetCycles(void)
+{
+  CommitPending();
+  return host_model_now;
+}
+
+void HOST_MODEL_GetStats(host_model_stats_t *p_stats)
+{
+  CommitPending();
+  *p_stats = host_model_stats;
+}
+
+uint32_t HOST_MODEL_GetUnhandledIrq(void)
+{
+  return Nvic.unhandled_nbr;
+}
+
+uint32_t HOST_MODEL_GetIrqCount(IRQn_Type irqn)
+{
+  return Nvic.count[16 + (int32_t)irqn];
+}
@@ -0,0 +1,148 @@
+/**
+  ******************************************************************************
+  * @file    host_model.h
+  * @brief   Host model of the STM32U5 peripherals used by the HAL host tests
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ * The HAL and LL sources are compiled unmodified for the host with -fsanitize=thread, which makes the compiler call
+ * a hook before each volatile access. The model defines these hooks instead of the thread sanitizer run time:
+ * - the peripheral register blocks are mapped at their device addresses and each access to them goes to the model
+ *   of the peripheral (GPDMA, USART/LPUART, SPI, CRC, RNG, AES, HASH, NVIC, SysTick, and RCC and GPIO as plain
+ *   registers);
+ * - each volatile access costs CPU cycles on a virtual clock, which runs the peripherals (frame and beat timing,
+ *   SysTick) and takes the pending interrupts before the access, in priority order.
+ * The interrupts are therefore taken at the volatile accesses, where the HAL shares its state with the handlers.
+ * The CPU time is only the bus accesses: the rest of the code takes no cycle.
+ * The kernel clocks are the CPU clock and the peripherals are not gated by their RCC enable bits. What each
+ * peripheral model leaves out is listed at the top of its file.
+ *
+ * The DMA addresses are 32 bits: the tests are linked without PIE and use static buffers and DMA nodes.
+ */
+
+#ifndef HOST_MODEL_H
+#define HOST_MODEL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+#include "stm32u5xx.h"
+
+/* Exported constants --------------------------------------------------------*/
+/** CPU clock of the model, the MSIS frequency after reset */
+#define HOST_MODEL_CPU_FREQ_HZ             4000000UL
+
+/* Exported types ------------------------------------------------------------*/
+/** Bus accesses and activity counted by the model since HOST_MODEL_Init() */
+typedef struct
+{
+  uint64_t cpu_reg_access_nbr;  /*!< CPU accesses to the peripheral registers                    */
+  uint64_t cpu_ram_access_nbr;  /*!< CPU volatile accesses to the memory                         */
+  uint64_t dma_beat_nbr;        /*!< DMA single accesses, source and destination                 */
+  uint64_t dma_byte_nbr;        /*!< Bytes written by the DMA channels to their destinations     */
+  uint64_t irq_nbr;             /*!< Exception and interrupt handlers run                        */
+  uint64_t irq_cycle_nbr;       /*!< CPU cycles spent in the handlers, nested ones counted once  */
+} host_model_stats_t;
+
+/** Activity of a GPDMA channel */
+typedef struct
+{
+  uint64_t byte_nbr;            /*!< Bytes written to the destination                            */
+  uint64_t burst_nbr;           /*!< Bursts granted by the arbiter                               */
+  uint64_t first_cycle;         /*!< Cycle of the first burst                                    */
+  uint64_t last_cycle;          /*!< Cycle of the last burst                                     */
+  uint32_t node_fetch_nbr;      /*!< Linked-list items loaded                                    */
+} host_model_dma_channel_stats_t;
+
+/** One linked-list item fetch of a GPDMA channel */
+typedef struct
+{
+  uint32_t channel;             /*!< Channel index                                               */
+  uint32_t address;             /*!< Address of the item                                         */
+  uint32_t cllr;                /*!< Link register value that pointed to the item                */
+} host_model_dma_fetch_t;
+
+/** Data register writes of the CRC */
+typedef struct
+{
+  uint32_t write_nbr[3];        /*!< Writes of 8, 16 and 32 bits                                 */
+  uint32_t byte_nbr;            /*!< Bytes fed to the calculation                                */
+  uint32_t reset_nbr;           /*!< Calculation unit resets (CR.RESET)                          */
+} host_model_crc_stats_t;
+
+/** Computations of the AES */
+typedef struct
+{
+  uint32_t block_nbr;           /*!< Blocks computed, GCM length blocks included                 */
+  uint32_t derivation_nbr;      /*!< Key derivations                                             */
+  uint32_t error_nbr;           /*!< Read and write errors (RDERR, WRERR)                        */
+} host_model_aes_stats_t;
+
+/** Data input and digests of the HASH */
+typedef struct
+{
+  uint32_t din_write_nbr;       /*!< DIN writes, CPU and DMA                                     */
+  uint32_t byte_nbr;            /*!< Bytes fed to the core, last words cut to NBLW               */
+  uint32_t digest_nbr;          /*!< Digests computed (DCIS set)                                 */
+} host_model_hash_stats_t;
+
+/** SPI slave: returns the frame shifted in on MISO for the frame shifted out on MOSI */
+typedef uint32_t (*host_model_spi_slave_t)(void *p_context, uint32_t mosi_frame);
+
+/* Exported functions --------------------------------------------------------*/
+/* Model control */
+void HOST_MODEL_Init(void);
+void HOST_MODEL_Run(uint64_t cycle_nbr);
+uint64_t HOST_MODEL_GetCycles(void);
+void HOST_MODEL_GetStats(host_model_stats_t *p_stats);
+uint32_t HOST_MODEL_GetUnhandledIrq(void);
+uint32_t HOST_MODEL_GetIrqCount(IRQn_Type irqn);
+
+/* GPDMA */
+void HOST_MODEL_DMA_GetChannelStats(uint32_t channel, host_model_dma_channel_stats_t *p_stats);
+void HOST_MODEL_DMA_SetFetchLog(host_model_dma_fetch_t *p_log, uint32_t size);
+uint32_t HOST_MODEL_DMA_GetFetchNbr(void);
+
+/* USART/LPUART */
+void HOST_MODEL_UART_SetLoopback(USART_TypeDef *p_uart, uint32_t enable);
+void HOST_MODEL_UART_Feed(USART_TypeDef *p_uart, const uint8_t *p_data, uint32_t size, uint32_t gap_frame_nbr);
+uint32_t HOST_MODEL_UART_GetTx(USART_TypeDef *p_uart, uint8_t *p_data, uint32_t size);
+uint64_t HOST_MODEL_UART_GetFrameCycles(USART_TypeDef *p_uart);
+
+/* SPI */
+void HOST_MODEL_SPI_SetSlave(SPI_TypeDef *p_spi, host_model_spi_slave_t slave, void *p_context);
+uint32_t HOST_MODEL_SPI_GetTx(SPI_TypeDef *p_spi, uint32_t *p_frames, uint32_t size);
+
+/* CRC */
+void HOST_MODEL_CRC_GetStats(host_model_crc_stats_t *p_stats);
+
+/* RNG */
+void HOST_MODEL_RNG_SetSeed(uint32_t seed);
+void HOST_MODEL_RNG_InjectSeedError(void);
+
+/* AES */
+void HOST_MODEL_AES_GetStats(host_model_aes_stats_t *p_stats);
+
+/* HASH */
+void HOST_MODEL_HASH_GetStats(host_model_hash_stats_t *p_stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_MODEL_H */
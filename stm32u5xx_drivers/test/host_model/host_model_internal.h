@@ -0,0 +1,103 @@
+/**
+  ******************************************************************************
+  * @file    host_model_internal.h
+  * @brief   Interface between the core of the host model and the peripheral models
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef HOST_MODEL_INTERNAL_H
+#define HOST_MODEL_INTERNAL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "host_model.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define HOST_MODEL_NO_EVENT      UINT64_MAX  /*!< next_event of a peripheral without scheduled event */
+#define HOST_MODEL_AHB_CYCLES    2U          /*!< Cycles of a register access on AHB                 */
+#define HOST_MODEL_APB_CYCLES    4U          /*!< Cycles of a register access on APB                 */
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct host_model_periph host_model_periph_t;
+
+/** Behaviour of a peripheral. The registers are in the mapped memory at the peripheral address */
+typedef struct
+{
+  /** Called before a read of the register at offset: updates its value in memory */
+  void (*read)(host_model_periph_t *p_periph, uint32_t offset, uint32_t size);
+  /** Called after a write of size bytes at offset, value being the data written and old_word the register word before
+      the write: applies the effects and restores the read-only bits */
+  void (*write)(host_model_periph_t *p_periph, uint32_t offset, uint32_t size, uint32_t value, uint32_t old_word);
+  /** Called when the cycle counter reaches next_event */
+  void (*event)(host_model_periph_t *p_periph);
+  /** Called by HOST_MODEL_Init() to set the reset state */
+  void (*reset)(host_model_periph_t *p_periph);
+} host_model_periph_ops_t;
+
+struct host_model_periph
+{
+  const char *p_name;
+  uintptr_t base;                       /*!< Address of the register block   */
+  uint32_t size;                        /*!< Size of the register block      */
+  uint32_t access_cycles;               /*!< Cycles of a CPU register access */
+  const host_model_periph_ops_t *p_ops;
+  uint64_t next_event;                  /*!< Cycle of the next event         */
+  void *p_state;                        /*!< State of the peripheral model   */
+};
+
+/* Exported variables --------------------------------------------------------*/
+extern uint64_t host_model_now;                 /*!< Cycle counter */
+extern host_model_stats_t host_model_stats;
+
+/* Exported functions --------------------------------------------------------*/
+/* Core */
+void host_model_register(host_model_periph_t *p_periph);
+void host_model_schedule(host_model_periph_t *p_periph, uint64_t cycle);
+/* Apply the last CPU register write, before a test function looks at the peripheral state */
+void host_model_sync(void);
+void host_model_irq_set_level(IRQn_Type irqn, uint32_t level);
+
+/* Bus accesses of a master other than the CPU; return 0 on a bus error */
+uint32_t host_model_bus_read(uint32_t address, uint32_t size, uint32_t *p_value);
+uint32_t host_model_bus_write(uint32_t address, uint32_t size, uint32_t value);
+
+/* Peripheral request lines of the GPDMA */
+void host_model_dma_request(uint32_t request, uint32_t level);
+
+/* Register block of a peripheral */
+static inline volatile uint32_t *host_model_reg(const host_model_periph_t *p_periph, uint32_t offset)
+{
+  return (volatile uint32_t *)(p_periph->base + offset);
+}
+
+/* Peripheral models */
+void host_model_gpdma_register(void);
+void host_model_usart_register(void);
+void host_model_spi_register(void);
+void host_model_crc_register(void);
+void host_model_rng_register(void);
+void host_model_aes_register(void);
+void host_model_hash_register(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_MODEL_INTERNAL_H */
@@ -0,0 +1,253 @@
+/**
+  ******************************************************************************
+  * @file    host_rng.c
+  * @brief   Host model of the RNG
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ * Modeled: the conditioning reset (CONDRST read as 1 until the reset is done), a FIFO of 4 words filled while RNGEN
+ * is set, the first word after START_CYCLES and the next ones every WORD_CYCLES, DRDY, the seed error injected by the
+ * test (SECS and SEIS, FIFO flushed, recovered by a conditioning reset), SEIS and CEIS cleared by writing 0, the
+ * interrupt line and CONFIGLOCK. The numbers come from a seeded xorshift generator, reproducible from one run to the
+ * other.
+ * Not modeled: clock errors, health tests, the noise source and configuration values.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_model_internal.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define FIFO_DEPTH           4U
+#define START_CYCLES         256U    /*!< From RNGEN set to the first word  */
+#define WORD_CYCLES          64U     /*!< Between two words                 */
+#define CONDRST_CYCLES       4U      /*!< From CONDRST cleared to its end: 2 AHB and 2 RNG clock cycles */
+#define CR_LOCKED            (~(RNG_CR_RNGEN | RNG_CR_IE))
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t fifo[FIFO_DEPTH];
+  uint32_t level;
+  uint32_t flags;                      /*!< SECS, CEIS, SEIS            */
+  uint64_t word_at;                    /*!< Next word in the FIFO       */
+  uint64_t condrst_at;                 /*!< End of the conditioning reset */
+  uint64_t seed;
+} rng_state_t;
+
+/* Private variables ---------------------------------------------------------*/
+static rng_state_t Rng;
+
+/* Private functions ---------------------------------------------------------*/
+static host_model_periph_t RngPeriph;
+
+static RNG_TypeDef *Regs(void)
+{
+  return (RNG_TypeDef *)RngPeriph.base;
+}
+
+static uint32_t NextRandom(void)
+{
+  Rng.seed ^= Rng.seed << 13U;
+  Rng.seed ^= Rng.seed >> 7U;
+  Rng.seed ^= Rng.seed << 17U;
+  return (uint32_t)(Rng.seed >> 16U);
+}
+
+static uint32_t Generating(void)
+{
+  return (((Regs()->CR & (RNG_CR_RNGEN | RNG_CR_CONDRST)) == RNG_CR_RNGEN)
+          && (Rng.condrst_at == HOST_MODEL_NO_EVENT) && ((Rng.flags & RNG_SR_SECS) == 0U)) ? 1U : 0U;
+}
+
+static uint32_t Status(void)
+{
+  return Rng.flags | ((Rng.level != 0U) ? RNG_SR_DRDY : 0U);
+}
+
+static void Update(void)
+{
+  const uint32_t sr = Status();
+  uint32_t level = 0U;
+
+  if ((Generating() == 0U) || (Rng.level == FIFO_DEPTH))
+  {
+    Rng.word_at = HOST_MODEL_NO_EVENT;
+  }
+  else if (Rng.word_at == HOST_MODEL_NO_EVENT)
+  {
+    Rng.word_at = host_model_now + WORD_CYCLES;
+  }
+  else
+  {
+    /* Word on the way */
+  }
+  if ((Regs()->CR & RNG_CR_IE) != 0U)
+  {
+    level = ((sr & (RNG_SR_DRDY | RNG_SR_CEIS | RNG_SR_SEIS)) != 0U) ? 1U : 0U;
+  }
+  host_model_irq_set_level(RNG_IRQn, level);
+  Regs()->SR = sr;
+  host_model_schedule(&RngPeriph, (Rng.word_at < Rng.condrst_at) ? Rng.word_at : Rng.condrst_at);
+}
+
+/* Peripheral callbacks ------------------------------------------------------*/
+static void Rng_Read(host_model_periph_t *p_periph, uint32_t offset, uint32_t size)
+{
+  RNG_TypeDef *p_regs = Regs();
+  const uint32_t word = offset & ~3U;
+  (void)p_periph;
+  (void)size;
+
+  if (word == offsetof(RNG_TypeDef, SR))
+  {
+    p_regs->SR = Status();
+  }
+  else if (word == offsetof(RNG_TypeDef, DR))
+  {
+    if (Rng.level != 0U)
+    {
+      p_regs->DR = Rng.fifo[0];
+      Rng.level--;
+      (void)memmove(&Rng.fifo[0], &Rng.fifo[1], Rng.level * sizeof(Rng.fifo[0]));
+    }
+    else
+    {
+      p_regs->DR = 0U;
+    }
+    Update();
+  }
+  else
+  {
+    /* Other registers read as written */
+  }
+}
+
+static void Rng_Write(host_model_periph_t *p_periph, uint32_t offset, uint32_t size, uint32_t value,
+                      uint32_t old_word)
+{
+  RNG_TypeDef *p_regs = Regs();
+  const uint32_t word = offset & ~3U;
+  (void)p_periph;
+  (void)size;
+  (void)value;
+
+  if (word == offsetof(RNG_TypeDef, CR))
+  {
+    uint32_t cr = p_regs->CR;
+
+    if ((old_word & RNG_CR_CONFIGLOCK) != 0U)
+    {
+      cr = (old_word & CR_LOCKED) | (cr & ~CR_LOCKED);
+    }
+    if (((old_word & RNG_CR_CONDRST) == 0U) && ((cr & RNG_CR_CONDRST) != 0U))
+    {
+      /* Conditioning reset: the FIFO is flushed */
+      Rng.level = 0U;
+      Rng.condrst_at = HOST_MODEL_NO_EVENT;
+    }
+    else if (((old_word & RNG_CR_CONDRST) != 0U) && ((cr & RNG_CR_CONDRST) == 0U))
+    {
+      /* CONDRST reads 1 until the end of the reset */
+      cr |= RNG_CR_CONDRST;
+      Rng.condrst_at = host_model_now + CONDRST_CYCLES;
+    }
+    else
+    {
+      /* No conditioning reset change */
+    }
+    if (((old_word & RNG_CR_RNGEN) != 0U) && ((cr & RNG_CR_RNGEN) == 0U))
+    {
+      Rng.level = 0U;
+    }
+    if (((old_word & RNG_CR_RNGEN) == 0U) && ((cr & RNG_CR_RNGEN) != 0U))
+    {
+      Rng.word_at = host_model_now + START_CYCLES;
+    }
+    p_regs->CR = cr;
+  }
+  else if (word == offsetof(RNG_TypeDef, SR))
+  {
+    /* CEIS and SEIS cleared by writing 0, the other bits are read-only */
+    Rng.flags &= p_regs->SR | ~(RNG_SR_CEIS | RNG_SR_SEIS);
+  }
+  else if (word == offsetof(RNG_TypeDef, DR))
+  {
+    p_regs->DR = old_word;
+  }
+  else
+  {
+    /* NSCR and HTCR hold what is written */
+  }
+  Update();
+}
+
+static void Rng_Event(host_model_periph_t *p_periph)
+{
+  (void)p_periph;
+
+  if (Rng.condrst_at <= host_model_now)
+  {
+    Rng.condrst_at = HOST_MODEL_NO_EVENT;
+    Regs()->CR &= ~RNG_CR_CONDRST;
+    Rng.flags &= ~RNG_SR_SECS;
+    Rng.word_at = HOST_MODEL_NO_EVENT;
+  }
+  if (Rng.word_at <= host_model_now)
+  {
+    Rng.word_at = HOST_MODEL_NO_EVENT;
+    if ((Generating() != 0U) && (Rng.level < FIFO_DEPTH))
+    {
+      Rng.fifo[Rng.level] = NextRandom();
+      Rng.level++;
+    }
+  }
+  Update();
+}
+
+static void Rng_Reset(host_model_periph_t *p_periph)
+{
+  (void)p_periph;
+
+  Rng.level = 0U;
+  Rng.flags = 0U;
+  Rng.word_at = HOST_MODEL_NO_EVENT;
+  Rng.condrst_at = HOST_MODEL_NO_EVENT;
+  Rng.seed = 0x2545F4914F6CDD1DULL;
+  Regs()->CR = 0U;
+  Update();
+}
+
+static const host_model_periph_ops_t RngOps = {Rng_Read, Rng_Write, Rng_Event, Rng_Reset};
+static host_model_periph_t RngPeriph = {"RNG", RNG_BASE_NS, 0x400U, HOST_MODEL_AHB_CYCLES, &RngOps,
+                                        HOST_MODEL_NO_EVENT, &Rng};
+
+/* Exported functions --------------------------------------------------------*/
+void host_model_rng_register(void)
+{
+  host_model_register(&RngPeriph);
+}
+
+void HOST_MODEL_RNG_SetSeed(uint32_t seed)
+{
+  host_model_sync();
+  Rng.seed = ((uint64_t)seed << 32U) | 0x9E3779B9U;
+}
+
+void HOST_MODEL_RNG_InjectSeedError(void)
+{
+  host_model_sync();
+  Rng.flags |= RNG_SR_SECS | RNG_SR_SEIS;
+  Rng.level = 0U;
+  Update();
+}
@@ -0,0 +1,520 @@
+/**
+  ******************************************************************************
+  * @file    host_spi.c
+  * @brief   Host model of the SPI instances
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ * Modeled, master mode only:
+ * - frame timing from DSIZE, MBR and BPASS, the kernel clock being the CPU clock;
+ * - the transmit and receive FIFOs of 16 bytes (SPI1, SPI2) or 8 bytes (SPI3), packed accesses to TXDR and RXDR,
+ *   packets of FTHLV + 1 frames, TXP, RXP, DXP, TXC, RXPLVL, RXWNE;
+ * - TSIZE and CTSIZE, EOT and TXTF, CSTART cleared at the end of the transfer, suspend by CSUSP or by MASRX on a full
+ *   receive FIFO, OVR on a full receive FIFO, the communication modes of COMM and HDDIR;
+ * - the interrupt line and the DMA requests of the transmitter and the receiver;
+ * - the bus: the frames sent are captured, and looped back to the receiver or answered by a slave function of the
+ *   test.
+ * Not modeled: slave mode, NSS management and MODF, TI mode, CRC, underrun, MIDI and MSSI delays, autonomous mode.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "host_model_internal.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define FIFO_MAX_SIZE        16U
+#define CAPTURE_SIZE         65536U    /*!< Frames */
+#define SR_FLAGS             (SPI_SR_EOT | SPI_SR_TXTF | SPI_SR_UDR | SPI_SR_OVR | SPI_SR_CRCE | SPI_SR_TIFRE \
+                              | SPI_SR_MODF | SPI_SR_SUSP)
+#define IER_ALL              (SPI_IER_RXPIE | SPI_IER_TXPIE | SPI_IER_DXPIE | SPI_IER_EOTIE | SPI_IER_TXTFIE \
+                              | SPI_IER_UDRIE | SPI_IER_OVRIE | SPI_IER_CRCEIE | SPI_IER_TIFREIE | SPI_IER_MODFIE)
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+  host_model_periph_t periph;
+  IRQn_Type irqn;
+  uint32_t request_rx;
+  uint32_t request_tx;
+  uint32_t fifo_size;                  /*!< Bytes of each FIFO                     */
+
+  uint8_t tx_fifo[FIFO_MAX_SIZE];
+  uint32_t tx_level;                   /*!< Bytes                                  */
+  uint8_t rx_fifo[FIFO_MAX_SIZE];
+  uint32_t rx_level;                   /*!< Bytes                                  */
+  uint32_t flags;                      /*!< Sticky SR flags                        */
+
+  uint32_t shift;                      /*!< Frame on MOSI                          */
+  uint64_t shift_at;                   /*!< End of the frame being shifted         */
+  uint32_t written_nbr;                /*!< Frames written to TXDR in the transfer */
+  uint32_t sent_nbr;                   /*!< Frames shifted in the transfer         */
+  uint32_t suspend;                    /*!< CSUSP pending                          */
+
+  host_model_spi_slave_t slave;
+  void *p_slave_context;
+  uint32_t capture[CAPTURE_SIZE];
+  uint32_t capture_nbr;
+} spi_t;
+
+/* Private functions ---------------------------------------------------------*/
+static const host_model_periph_ops_t SpiOps;
+static spi_t Spis[3];
+
+static SPI_TypeDef *Regs(const spi_t *p_spi)
+{
+  return (SPI_TypeDef *)p_spi->periph.base;
+}
+
+static spi_t *Find(const SPI_TypeDef *p_regs)
+{
+  for (uint32_t i = 0U; i < (sizeof(Spis) / sizeof(Spis[0])); i++)
+  {
+    if (Spis[i].periph.base == (uintptr_t)p_regs)
+    {
+      return &Spis[i];
+    }
+  }
+  (void)fprintf(stderr, "host model: no SPI at %p\n", (const void *)p_regs);
+  exit(2);
+}
+
+static uint32_t FrameBits(const spi_t *p_spi)
+{
+  return ((Regs(p_spi)->CFG1 & SPI_CFG1_DSIZE) >> SPI_CFG1_DSIZE_Pos) + 1U;
+}
+
+/* Bytes of a frame in the FIFOs */
+static uint32_t FrameBytes(const spi_t *p_spi)
+{
+  const uint32_t bits = FrameBits(p_spi);
+
+  return (bits <= 8U) ? 1U : ((bits <= 16U) ? 2U : 4U);
+}
+
+static uint32_t PacketBytes(const spi_t *p_spi)
+{
+  return (((Regs(p_spi)->CFG1 & SPI_CFG1_FTHLV) >> SPI_CFG1_FTHLV_Pos) + 1U) * FrameBytes(p_spi);
+}
+
+static uint32_t FrameMask(const spi_t *p_spi)
+{
+  const uint32_t bits = FrameBits(p_spi);
+
+  return (bits >= 32U) ? 0xFFFFFFFFU : ((1UL << bits) - 1U);
+}
+
+static uint64_t FrameCycles(const spi_t *p_spi)
+{
+  const uint32_t cfg1 = Regs(p_spi)->CFG1;
+  const uint64_t divider = ((cfg1 & SPI_CFG1_BPASS) != 0U) ? 1U
+                           : (2ULL << ((cfg1 & SPI_CFG1_MBR) >> SPI_CFG1_MBR_Pos));
+
+  return (uint64_t)FrameBits(p_spi) * divider;
+}
+
+static uint32_t TransferSize(const spi_t *p_spi)
+{
+  return (Regs(p_spi)->CR2 & SPI_CR2_TSIZE) >> SPI_CR2_TSIZE_Pos;
+}
+
+/* Transmitter and receiver used by COMM, and by HDDIR in half duplex */
+static uint32_t TxUsed(const spi_t *p_spi)
+{
+  const SPI_TypeDef *p_regs = Regs(p_spi);
+  const uint32_t comm = p_regs->CFG2 & SPI_CFG2_COMM;
+
+  if (comm == SPI_CFG2_COMM)
+  {
+    return ((p_regs->CR1 & SPI_CR1_HDDIR) != 0U) ? 1U : 0U;
+  }
+  return (comm != SPI_CFG2_COMM_1) ? 1U : 0U;
+}
+
+static uint32_t RxUsed(const spi_t *p_spi)
+{
+  const SPI_TypeDef *p_regs = Regs(p_spi);
+  const uint32_t comm = p_regs->CFG2 & SPI_CFG2_COMM;
+
+  if (comm == SPI_CFG2_COMM)
+  {
+    return ((p_regs->CR1 & SPI_CR1_HDDIR) == 0U) ? 1U : 0U;
+  }
+  return (comm != SPI_CFG2_COMM_0) ? 1U : 0U;
+}
+
+static uint32_t Running(const spi_t *p_spi)
+{
+  const SPI_TypeDef *p_regs = Regs(p_spi);
+
+  return (((p_regs->CR1 & (SPI_CR1_SPE | SPI_CR1_CSTART)) == (SPI_CR1_SPE | SPI_CR1_CSTART))
+          && ((p_regs->CFG2 & SPI_CFG2_MASTER) != 0U)) ? 1U : 0U;
+}
+
+static uint32_t TxTransferFilled(const spi_t *p_spi)
+{
+  const uint32_t tsize = TransferSize(p_spi);
+
+  return ((tsize != 0U) && (p_spi->written_nbr >= tsize)) ? 1U : 0U;
+}
+
+static uint32_t Status(const spi_t *p_spi)
+{
+  const uint32_t frame_bytes = FrameBytes(p_spi);
+  const uint32_t packet_bytes = PacketBytes(p_spi);
+  const uint32_t tsize = TransferSize(p_spi);
+  uint32_t sr = p_spi->flags;
+
+  if (((p_spi->fifo_size - p_spi->tx_level) >= packet_bytes) && (TxTransferFilled(p_spi) == 0U))
+  {
+    sr |= SPI_SR_TXP;
+  }
+  sr |= (p_spi->rx_level >= packet_bytes) ? SPI_SR_RXP : 0U;
+  sr |= ((sr & (SPI_SR_TXP | SPI_SR_RXP)) == (SPI_SR_TXP | SPI_SR_RXP)) ? SPI_SR_DXP : 0U;
+  sr |= ((p_spi->tx_level == 0U) && (p_spi->shift_at == HOST_MODEL_NO_EVENT)) ? SPI_SR_TXC : 0U;
+  if (p_spi->rx_level >= 4U)
+  {
+    sr |= SPI_SR_RXWNE;
+  }
+  else if (frame_bytes < 4U)
+  {
+    sr |= ((p_spi->rx_level / frame_bytes) << SPI_SR_RXPLVL_Pos) & SPI_SR_RXPLVL;
+  }
+  else
+  {
+    /* No partial word with frames of 32 bits */
+  }
+  if (tsize > p_spi->sent_nbr)
+  {
+    sr |= (tsize - p_spi->sent_nbr) << SPI_SR_CTSIZE_Pos;
+  }
+  return sr;
+}
+
+static void UpdateLines(spi_t *p_spi)
+{
+  const SPI_TypeDef *p_regs = Regs(p_spi);
+  const uint32_t sr = Status(p_spi);
+  const uint32_t ier = p_regs->IER;
+  const uint32_t cfg1 = p_regs->CFG1;
+  const uint32_t enabled = ((p_regs->CR1 & SPI_CR1_SPE) != 0U) ? 1U : 0U;
+  uint32_t level = ((sr & ier & IER_ALL) != 0U) ? 1U : 0U;
+  uint32_t rx_ready;
+
+  /* The suspension interrupts through EOTIE */
+  level |= (((sr & SPI_SR_SUSP) != 0U) && ((ier & SPI_IER_EOTIE) != 0U)) ? 1U : 0U;
+  host_model_irq_set_level(p_spi->irqn, level);
+
+  /* The receiver also requests the DMA for the last frames, less than a packet, after the end of transfer */
+  rx_ready = (((sr & SPI_SR_RXP) != 0U) || (((sr & SPI_SR_EOT) != 0U) && (p_spi->rx_level != 0U))) ? 1U : 0U;
+  host_model_dma_request(p_spi->request_tx, ((enabled != 0U) && ((cfg1 & SPI_CFG1_TXDMAEN) != 0U)
+                                             && ((sr & SPI_SR_TXP) != 0U)) ? 1U : 0U);
+  host_model_dma_request(p_spi->request_rx, ((enabled != 0U) && ((cfg1 & SPI_CFG1_RXDMAEN) != 0U)
+                                             && (rx_ready != 0U)) ? 1U : 0U);
+}
+
+static void PushBytes(uint8_t *p_fifo, uint32_t *p_level, uint32_t value, uint32_t byte_nbr)
+{
+  for (uint32_t i = 0U; i < byte_nbr; i++)
+  {
+    p_fifo[*p_level] = (uint8_t)(value >> (8U * i));
+    (*p_level)++;
+  }
+}
+
+static uint32_t PopBytes(uint8_t *p_fifo, uint32_t *p_level, uint32_t byte_nbr)
+{
+  uint32_t value = 0U;
+
+  for (uint32_t i = 0U; i < byte_nbr; i++)
+  {
+    value |= (uint32_t)p_fifo[i] << (8U * i);
+  }
+  *p_level -= byte_nbr;
+  (void)memmove(&p_fifo[0], &p_fifo[byte_nbr], *p_level);
+  return value;
+}
+
+static void Suspend(spi_t *p_spi)
+{
+  p_spi->suspend = 0U;
+  p_spi->flags |= SPI_SR_SUSP;
+  Regs(p_spi)->CR1 &= ~SPI_CR1_CSTART;
+}
+
+/* Start shifting a frame when the master has one to send, or clocks the receiver alone */
+static void StartFrame(spi_t *p_spi)
+{
+  const uint32_t frame_bytes = FrameBytes(p_spi);
+  const uint32_t tsize = TransferSize(p_spi);
+
+  if ((p_spi->shift_at != HOST_MODEL_NO_EVENT) || (Running(p_spi) == 0U)
+      || ((tsize != 0U) && (p_spi->sent_nbr >= tsize)))
+  {
+    return;
+  }
+  if (p_spi->suspend != 0U)
+  {
+    Suspend(p_spi);
+    return;
+  }
+  if (TxUsed(p_spi) != 0U)
+  {
+    if (p_spi->tx_level < frame_bytes)
+    {
+      return;
+    }
+    p_spi->shift = PopBytes(p_spi->tx_fifo, &p_spi->tx_level, frame_bytes) & FrameMask(p_spi);
+  }
+  else
+  {
+    if (((Regs(p_spi)->CR1 & SPI_CR1_MASRX) != 0U) && ((p_spi->rx_level + frame_bytes) > p_spi->fifo_size))
+    {
+      Suspend(p_spi);
+      return;
+    }
+    p_spi->shift = 0U;
+  }
+  p_spi->shift_at = host_model_now + FrameCycles(p_spi);
+}
+
+static void EndFrame(spi_t *p_spi)
+{
+  const uint32_t frame_bytes = FrameBytes(p_spi);
+  const uint32_t mosi = p_spi->shift;
+  uint32_t miso;
+
+  p_spi->shift_at = HOST_MODEL_NO_EVENT;
+  miso = (p_spi->slave != NULL) ? p_spi->slave(p_spi->p_slave_context, mosi) : mosi;
+  if ((TxUsed(p_spi) != 0U) && (p_spi->capture_nbr < CAPTURE_SIZE))
+  {
+    p_spi->capture[p_spi->capture_nbr] = mosi;
+    p_spi->capture_nbr++;
+  }
+  if (RxUsed(p_spi) != 0U)
+  {
+    if ((p_spi->rx_level + frame_bytes) <= p_spi->fifo_size)
+    {
+      PushBytes(p_spi->rx_fifo, &p_spi->rx_level, miso & FrameMask(p_spi), frame_bytes);
+    }
+    else
+    {
+      p_spi->flags |= SPI_SR_OVR;
+    }
+  }
+  p_spi->sent_nbr++;
+  if ((TransferSize(p_spi) != 0U) && (p_spi->sent_nbr == TransferSize(p_spi)))
+  {
+    p_spi->flags |= SPI_SR_EOT;
+    Regs(p_spi)->CR1 &= ~SPI_CR1_CSTART;
+  }
+}
+
+/* SPE cleared: the FIFOs are flushed and the transfer stops */
+static void Stop(spi_t *p_spi)
+{
+  p_spi->tx_level = 0U;
+  p_spi->rx_level = 0U;
+  p_spi->shift_at = HOST_MODEL_NO_EVENT;
+  p_spi->written_nbr = 0U;
+  p_spi->sent_nbr = 0U;
+  p_spi->suspend = 0U;
+  Regs(p_spi)->CR1 &= ~SPI_CR1_CSTART;
+}
+
+/* Peripheral callbacks ------------------------------------------------------*/
+static void Spi_Read(host_model_periph_t *p_periph, uint32_t offset, uint32_t size)
+{
+  spi_t *p_spi = (spi_t *)p_periph->p_state;
+  SPI_TypeDef *p_regs = Regs(p_spi);
+  const uint32_t word = offset & ~3U;
+
+  if (word == offsetof(SPI_TypeDef, SR))
+  {
+    p_regs->SR = Status(p_spi);
+  }
+  else if (word == offsetof(SPI_TypeDef, RXDR))
+  {
+    const uint32_t frame_bytes = FrameBytes(p_spi);
+    const uint32_t frame_nbr = (size > frame_bytes) ? (size / frame_bytes) : 1U;
+    uint32_t value = 0U;
+
+    /* A read of several frames pops them all, the first one in the low bits */
+    for (uint32_t i = 0U; (i < frame_nbr) && (p_spi->rx_level >= frame_bytes); i++)
+    {
+      value |= PopBytes(p_spi->rx_fifo, &p_spi->rx_level, frame_bytes) << (8U * frame_bytes * i);
+    }
+    p_regs->RXDR = value;
+    StartFrame(p_spi);
+    UpdateLines(p_spi);
+    host_model_schedule(&p_spi->periph, p_spi->shift_at);
+  }
+  else
+  {
+    /* Other registers read as written */
+  }
+}
+
+static void Spi_Write(host_model_periph_t *p_periph, uint32_t offset, uint32_t size, uint32_t value,
+                      uint32_t old_word)
+{
+  spi_t *p_spi = (spi_t *)p_periph->p_state;
+  SPI_TypeDef *p_regs = Regs(p_spi);
+  const uint32_t word = offset & ~3U;
+  const uint32_t word_value = *host_model_reg(p_periph, word);
+
+  if (word == offsetof(SPI_TypeDef, CR1))
+  {
+    if ((word_value & SPI_CR1_SPE) == 0U)
+    {
+      if ((old_word & SPI_CR1_SPE) != 0U)
+      {
+        Stop(p_spi);
+      }
+      p_regs->CR1 &= ~SPI_CR1_CSTART;
+    }
+    else if ((old_word & SPI_CR1_SPE) == 0U)
+    {
+      p_spi->written_nbr = 0U;
+      p_spi->sent_nbr = 0U;
+    }
+    else
+    {
+      /* Enabled already */
+    }
+    if ((word_value & SPI_CR1_CSUSP) != 0U)
+    {
+      p_regs->CR1 &= ~SPI_CR1_CSUSP;
+      if ((old_word & SPI_CR1_CSTART) != 0U)
+      {
+        p_spi->suspend = 1U;
+        if (p_spi->shift_at == HOST_MODEL_NO_EVENT)
+        {
+          Suspend(p_spi);
+        }
+      }
+    }
+  }
+  else if (word == offsetof(SPI_TypeDef, TXDR))
+  {
+    const uint32_t frame_bytes = FrameBytes(p_spi);
+    const uint32_t frame_nbr = (size > frame_bytes) ? (size / frame_bytes) : 1U;
+
+    /* A write of several frames pushes them all, the first one from the low bits */
+    for (uint32_t i = 0U; (i < frame_nbr) && ((p_regs->CR1 & SPI_CR1_SPE) != 0U); i++)
+    {
+      if ((p_spi->tx_level + frame_bytes) <= p_spi->fifo_size)
+      {
+        PushBytes(p_spi->tx_fifo, &p_spi->tx_level, value >> (8U * frame_bytes * i), frame_bytes);
+        p_spi->written_nbr++;
+      }
+    }
+    if (TxTransferFilled(p_spi) != 0U)
+    {
+      p_spi->flags |= SPI_SR_TXTF;
+    }
+  }
+  else if (word == offsetof(SPI_TypeDef, IFCR))
+  {
+    p_spi->flags &= ~(word_value & SR_FLAGS);
+    p_regs->IFCR = 0U;
+  }
+  else if ((word == offsetof(SPI_TypeDef, SR)) || (word == offsetof(SPI_TypeDef, RXDR)))
+  {
+    *host_model_reg(p_periph, word) = old_word;
+  }
+  else
+  {
+    /* Configuration registers hold what is written */
+  }
+  StartFrame(p_spi);
+  UpdateLines(p_spi);
+  host_model_schedule(&p_spi->periph, p_spi->shift_at);
+}
+
+static void Spi_Event(host_model_periph_t *p_periph)
+{
+  spi_t *p_spi = (spi_t *)p_periph->p_state;
+
+  if (p_spi->shift_at <= host_model_now)
+  {
+    EndFrame(p_spi);
+  }
+  StartFrame(p_spi);
+  UpdateLines(p_spi);
+  host_model_schedule(&p_spi->periph, p_spi->shift_at);
+}
+
+static void Spi_Reset(host_model_periph_t *p_periph)
+{
+  spi_t *p_spi = (spi_t *)p_periph->p_state;
+
+  Stop(p_spi);
+  p_spi->flags = 0U;
+  p_spi->slave = NULL;
+  p_spi->p_slave_context = NULL;
+  p_spi->capture_nbr = 0U;
+  Regs(p_spi)->SR = Status(p_spi);
+}
+
+static const host_model_periph_ops_t SpiOps = {Spi_Read, Spi_Write, Spi_Event, Spi_Reset};
+
+static void Register(uint32_t index, const char *p_name, uintptr_t base, uint32_t fifo_size, IRQn_Type irqn,
+                     uint32_t request_rx)
+{
+  spi_t *p_spi = &Spis[index];
+
+  p_spi->periph.p_name = p_name;
+  p_spi->periph.base = base;
+  p_spi->periph.size = 0x400U;
+  p_spi->periph.access_cycles = HOST_MODEL_APB_CYCLES;
+  p_spi->periph.p_ops = &SpiOps;
+  p_spi->periph.p_state = p_spi;
+  p_spi->fifo_size = fifo_size;
+  p_spi->irqn = irqn;
+  p_spi->request_rx = request_rx;
+  p_spi->request_tx = request_rx + 1U;
+  host_model_register(&p_spi->periph);
+}
+
+/* Exported functions --------------------------------------------------------*/
+void host_model_spi_register(void)
+{
+  Register(0U, "SPI1", SPI1_BASE_NS, 16U, SPI1_IRQn, 6U);
+  Register(1U, "SPI2", SPI2_BASE_NS, 16U, SPI2_IRQn, 8U);
+  Register(2U, "SPI3", SPI3_BASE_NS, 8U, SPI3_IRQn, 10U);
+}
+
+void HOST_MODEL_SPI_SetSlave(SPI_TypeDef *p_spi, host_model_spi_slave_t slave, void *p_context)
+{
+  spi_t *p_model = Find(p_spi);
+
+  host_model_sync();
+  p_model->slave = slave;
+  p_model->p_slave_context = p_context;
+}
+
+uint32_t HOST_MODEL_SPI_GetTx(SPI_TypeDef *p_spi, uint32_t *p_frames, uint32_t size)
+{
+  spi_t *p_model = Find(p_spi);
+  uint32_t nbr;
+
+  host_model_sync();
+  nbr = (p_model->capture_nbr < size) ? p_model->capture_nbr : size;
+  (void)memcpy(p_frames, p_model->capture, nbr * sizeof(p_frames[0]));
+  (void)memmove(p_model->capture, &p_model->capture[nbr], (p_model->capture_nbr - nbr) * sizeof(p_frames[0]));
+  p_model->capture_nbr -= nbr;
+  return nbr;
+}
@@ -0,0 +1,486 @@
+/**
+  ******************************************************************************
+  * @file    host_usart.c
+  * @brief   Host model of the USART, UART and LPUART instances
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ * Modeled:
+ * - frame timing from BRR, PRESC, OVER8, the word length and the stop bits, LPUART divider included, the kernel clock
+ *   being the CPU clock;
+ * - the transmit and receive FIFOs of 8 data (1 when FIFOEN = 0), the shift registers, TXE/TXFNF, TC, TXFE, TXFT,
+ *   RXNE/RXFNE, RXFF, RXFT, IDLE after a frame time of idle line, ORE (OVRDIS), TEACK, REACK, ICR and RQR;
+ * - the interrupt line and the DMA requests of the transmitter and the receiver;
+ * - the line: the transmitted frames are captured, and looped back to the receiver or replaced by the frames fed by
+ *   the test.
+ * Not modeled: parity, framing and noise errors, receiver timeout, synchronous, smartcard, IrDA and LIN modes,
+ * hardware flow control, autonomous mode, wake up.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "host_model_internal.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define FIFO_DEPTH           8U
+#define LINE_SIZE            8192U     /*!< Frames fed and not received yet */
+#define CAPTURE_SIZE         65536U
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+  uint16_t data;
+  uint16_t gap_frame_nbr;              /*!< Idle frames before this one */
+} line_frame_t;
+
+typedef struct
+{
+  host_model_periph_t periph;
+  uint32_t lpuart;
+  IRQn_Type irqn;
+  uint32_t request_rx;
+  uint32_t request_tx;
+
+  uint16_t tx_fifo[FIFO_DEPTH];
+  uint32_t tx_level;
+  uint16_t tx_shift;
+  uint64_t tx_at;                      /*!< End of the frame being sent                     */
+  uint32_t tc;
+
+  uint16_t rx_fifo[FIFO_DEPTH];
+  uint32_t rx_level;
+  uint32_t flags;                      /*!< Sticky ISR flags: ORE, IDLE                     */
+  uint64_t rx_at;                      /*!< End of the frame being received from the line   */
+  uint64_t idle_at;
+
+  uint32_t loopback;
+  line_frame_t line[LINE_SIZE];
+  uint32_t line_head;
+  uint32_t line_nbr;
+
+  uint8_t capture[CAPTURE_SIZE];
+  uint32_t capture_nbr;
+} usart_t;
+
+/* Private functions ---------------------------------------------------------*/
+static const host_model_periph_ops_t UsartOps;
+static usart_t Usarts[6];
+
+static USART_TypeDef *Regs(const usart_t *p_usart)
+{
+  return (USART_TypeDef *)p_usart->periph.base;
+}
+
+static usart_t *Find(const USART_TypeDef *p_regs)
+{
+  for (uint32_t i = 0U; i < (sizeof(Usarts) / sizeof(Usarts[0])); i++)
+  {
+    if (Usarts[i].periph.base == (uintptr_t)p_regs)
+    {
+      return &Usarts[i];
+    }
+  }
+  (void)fprintf(stderr, "host model: no USART at %p\n", (const void *)p_regs);
+  exit(2);
+}
+
+static uint32_t Depth(const usart_t *p_usart)
+{
+  return ((Regs(p_usart)->CR1 & USART_CR1_FIFOEN) != 0U) ? FIFO_DEPTH : 1U;
+}
+
+static uint32_t Threshold(uint32_t config)
+{
+  static const uint32_t thresholds[8] = {1U, 2U, 4U, 6U, 7U, 8U, 8U, 8U};
+
+  return thresholds[config & 7U];
+}
+
+static uint32_t Enabled(const usart_t *p_usart, uint32_t cr1_bit)
+{
+  const uint32_t cr1 = Regs(p_usart)->CR1;
+
+  return (((cr1 & USART_CR1_UE) != 0U) && ((cr1 & cr1_bit) != 0U)) ? 1U : 0U;
+}
+
+/* Cycles of a frame: start, data (parity included) and stop bits */
+static uint64_t FrameCycles(const usart_t *p_usart)
+{
+  static const uint32_t prescalers[16] = {1U, 2U, 4U, 6U, 8U, 10U, 12U, 16U, 32U, 64U, 128U, 256U, 256U, 256U, 256U,
+                                          256U};
+  static const uint32_t stop_half_bits[4] = {2U, 1U, 4U, 3U};
+  const USART_TypeDef *p_regs = Regs(p_usart);
+  const uint32_t cr1 = p_regs->CR1;
+  const uint32_t brr = p_regs->BRR & 0xFFFFFU;
+  const uint32_t m = ((cr1 & USART_CR1_M1) != 0U) ? 2U : (((cr1 & USART_CR1_M0) != 0U) ? 1U : 0U);
+  const uint32_t data_bits = (m == 2U) ? 7U : ((m == 1U) ? 9U : 8U);
+  const uint64_t half_bits = (2U * (1U + data_bits)) + stop_half_bits[(p_regs->CR2 & USART_CR2_STOP) >> USART_CR2_STOP_Pos];
+  const uint64_t prescaler = prescalers[p_regs->PRESC & USART_PRESC_PRESCALER];
+  uint64_t cycles;
+
+  if (p_usart->lpuart != 0U)
+  {
+    /* Bit time of BRR / 256 kernel clock cycles */
+    cycles = (half_bits * prescaler * brr) / 512U;
+  }
+  else if ((cr1 & USART_CR1_OVER8) != 0U)
+  {
+    /* Bit time of USARTDIV / 2 */
+    cycles = (half_bits * prescaler * ((brr & 0xFFF0U) | ((brr & 7U) << 1U))) / 4U;
+  }
+  else
+  {
+    cycles = (half_bits * prescaler * (brr & 0xFFFFU)) / 2U;
+  }
+  return (cycles != 0U) ? cycles : 1U;
+}
+
+static uint32_t Status(const usart_t *p_usart)
+{
+  const USART_TypeDef *p_regs = Regs(p_usart);
+  const uint32_t depth = Depth(p_usart);
+  uint32_t isr = p_usart->flags;
+
+  isr |= (p_usart->tx_level < depth) ? USART_ISR_TXE_TXFNF : 0U;
+  isr |= (p_usart->tc != 0U) ? USART_ISR_TC : 0U;
+  isr |= (p_usart->rx_level != 0U) ? USART_ISR_RXNE_RXFNE : 0U;
+  if (depth == FIFO_DEPTH)
+  {
+    isr |= (p_usart->tx_level == 0U) ? USART_ISR_TXFE : 0U;
+    isr |= (p_usart->rx_level == FIFO_DEPTH) ? USART_ISR_RXFF : 0U;
+    isr |= (p_usart->rx_level >= Threshold((p_regs->CR3 & USART_CR3_RXFTCFG) >> USART_CR3_RXFTCFG_Pos))
+           ? USART_ISR_RXFT : 0U;
+    isr |= ((FIFO_DEPTH - p_usart->tx_level) >= Threshold((p_regs->CR3 & USART_CR3_TXFTCFG) >> USART_CR3_TXFTCFG_Pos))
+           ? USART_ISR_TXFT : 0U;
+  }
+  isr |= (Enabled(p_usart, USART_CR1_TE) != 0U) ? USART_ISR_TEACK : 0U;
+  isr |= (Enabled(p_usart, USART_CR1_RE) != 0U) ? USART_ISR_REACK : 0U;
+  return isr;
+}
+
+static void UpdateLines(usart_t *p_usart)
+{
+  const USART_TypeDef *p_regs = Regs(p_usart);
+  const uint32_t isr = Status(p_usart);
+  const uint32_t cr1 = p_regs->CR1;
+  const uint32_t cr3 = p_regs->CR3;
+  uint32_t level = 0U;
+
+  level |= (((cr1 & USART_CR1_IDLEIE) != 0U) && ((isr & USART_ISR_IDLE) != 0U)) ? 1U : 0U;
+  level |= (((cr1 & USART_CR1_RXNEIE_RXFNEIE) != 0U) && ((isr & (USART_ISR_RXNE_RXFNE | USART_ISR_ORE)) != 0U))
+           ? 1U : 0U;
+  level |= (((cr1 & USART_CR1_TCIE) != 0U) && ((isr & USART_ISR_TC) != 0U)) ? 1U : 0U;
+  level |= (((cr1 & USART_CR1_TXEIE_TXFNFIE) != 0U) && ((isr & USART_ISR_TXE_TXFNF) != 0U)) ? 1U : 0U;
+  level |= (((cr1 & USART_CR1_TXFEIE) != 0U) && ((isr & USART_ISR_TXFE) != 0U)) ? 1U : 0U;
+  level |= (((cr1 & USART_CR1_RXFFIE) != 0U) && ((isr & USART_ISR_RXFF) != 0U)) ? 1U : 0U;
+  level |= (((cr3 & USART_CR3_EIE) != 0U) && ((isr & (USART_ISR_ORE | USART_ISR_FE | USART_ISR_NE)) != 0U))
+           ? 1U : 0U;
+  level |= (((cr3 & USART_CR3_RXFTIE) != 0U) && ((isr & USART_ISR_RXFT) != 0U)) ? 1U : 0U;
+  level |= (((cr3 & USART_CR3_TXFTIE) != 0U) && ((isr & USART_ISR_TXFT) != 0U)) ? 1U : 0U;
+  host_model_irq_set_level(p_usart->irqn, level);
+
+  host_model_dma_request(p_usart->request_tx, (((cr3 & USART_CR3_DMAT) != 0U) && (Enabled(p_usart, USART_CR1_TE) != 0U)
+                                               && ((isr & USART_ISR_TXE_TXFNF) != 0U)) ? 1U : 0U);
+  host_model_dma_request(p_usart->request_rx, (((cr3 & USART_CR3_DMAR) != 0U) && (Enabled(p_usart, USART_CR1_RE) != 0U)
+                                               && (p_usart->rx_level != 0U)) ? 1U : 0U);
+}
+
+static void Reschedule(usart_t *p_usart)
+{
+  uint64_t next = p_usart->tx_at;
+
+  next = (p_usart->rx_at < next) ? p_usart->rx_at : next;
+  next = (p_usart->idle_at < next) ? p_usart->idle_at : next;
+  host_model_schedule(&p_usart->periph, next);
+}
+
+static void StartTx(usart_t *p_usart)
+{
+  if ((p_usart->tx_at != HOST_MODEL_NO_EVENT) || (p_usart->tx_level == 0U) || (Enabled(p_usart, USART_CR1_TE) == 0U))
+  {
+    return;
+  }
+  p_usart->tx_shift = p_usart->tx_fifo[0];
+  p_usart->tx_level--;
+  (void)memmove(&p_usart->tx_fifo[0], &p_usart->tx_fifo[1], p_usart->tx_level * sizeof(p_usart->tx_fifo[0]));
+  p_usart->tx_at = host_model_now + FrameCycles(p_usart);
+}
+
+static void StartLine(usart_t *p_usart)
+{
+  if ((p_usart->rx_at == HOST_MODEL_NO_EVENT) && (p_usart->line_nbr != 0U))
+  {
+    p_usart->rx_at = host_model_now
+                     + ((1U + (uint64_t)p_usart->line[p_usart->line_head].gap_frame_nbr) * FrameCycles(p_usart));
+  }
+}
+
+static void Receive(usart_t *p_usart, uint16_t data)
+{
+  const USART_TypeDef *p_regs = Regs(p_usart);
+
+  if (Enabled(p_usart, USART_CR1_RE) == 0U)
+  {
+    return;
+  }
+  if (p_usart->rx_level < Depth(p_usart))
+  {
+    p_usart->rx_fifo[p_usart->rx_level] = data;
+    p_usart->rx_level++;
+  }
+  else if ((p_regs->CR3 & USART_CR3_OVRDIS) == 0U)
+  {
+    p_usart->flags |= USART_ISR_ORE;
+  }
+  else
+  {
+    /* Data lost without flag */
+  }
+  p_usart->idle_at = host_model_now + FrameCycles(p_usart);
+}
+
+static void Stop(usart_t *p_usart)
+{
+  p_usart->tx_level = 0U;
+  p_usart->rx_level = 0U;
+  p_usart->flags = 0U;
+  p_usart->tc = 1U;
+  p_usart->tx_at = HOST_MODEL_NO_EVENT;
+  p_usart->idle_at = HOST_MODEL_NO_EVENT;
+}
+
+/* Peripheral callbacks ------------------------------------------------------*/
+static void Usart_Read(host_model_periph_t *p_periph, uint32_t offset, uint32_t size)
+{
+  usart_t *p_usart = (usart_t *)p_periph->p_state;
+  USART_TypeDef *p_regs = Regs(p_usart);
+  const uint32_t word = offset & ~3U;
+  (void)size;
+
+  if (word == offsetof(USART_TypeDef, ISR))
+  {
+    p_regs->ISR = Status(p_usart);
+  }
+  else if (word == offsetof(USART_TypeDef, RDR))
+  {
+    if (p_usart->rx_level != 0U)
+    {
+      p_regs->RDR = p_usart->rx_fifo[0];
+      p_usart->rx_level--;
+      (void)memmove(&p_usart->rx_fifo[0], &p_usart->rx_fifo[1], p_usart->rx_level * sizeof(p_usart->rx_fifo[0]));
+      UpdateLines(p_usart);
+    }
+  }
+  else
+  {
+    /* Other registers read as written */
+  }
+}
+
+static void Usart_Write(host_model_periph_t *p_periph, uint32_t offset, uint32_t size, uint32_t value,
+                        uint32_t old_word)
+{
+  usart_t *p_usart = (usart_t *)p_periph->p_state;
+  USART_TypeDef *p_regs = Regs(p_usart);
+  const uint32_t word = offset & ~3U;
+  const uint32_t word_value = *host_model_reg(p_periph, word);
+  (void)size;
+  (void)value;
+
+  if (word == offsetof(USART_TypeDef, CR1))
+  {
+    if (((old_word & USART_CR1_UE) != 0U) && ((word_value & USART_CR1_UE) == 0U))
+    {
+      Stop(p_usart);
+    }
+  }
+  else if (word == offsetof(USART_TypeDef, TDR))
+  {
+    if (p_usart->tx_level < Depth(p_usart))
+    {
+      p_usart->tx_fifo[p_usart->tx_level] = (uint16_t)(word_value & 0x1FFU);
+      p_usart->tx_level++;
+    }
+    p_usart->tc = 0U;
+  }
+  else if (word == offsetof(USART_TypeDef, ICR))
+  {
+    p_usart->flags &= ~(word_value & (USART_ICR_ORECF | USART_ICR_IDLECF));
+    if ((word_value & USART_ICR_TCCF) != 0U)
+    {
+      p_usart->tc = 0U;
+    }
+    p_regs->ICR = 0U;
+  }
+  else if (word == offsetof(USART_TypeDef, RQR))
+  {
+    if ((word_value & USART_RQR_RXFRQ) != 0U)
+    {
+      p_usart->rx_level = 0U;
+    }
+    if ((word_value & USART_RQR_TXFRQ) != 0U)
+    {
+      p_usart->tx_level = 0U;
+    }
+    p_regs->RQR = 0U;
+  }
+  else if ((word == offsetof(USART_TypeDef, ISR)) || (word == offsetof(USART_TypeDef, RDR)))
+  {
+    *host_model_reg(p_periph, word) = old_word;
+  }
+  else
+  {
+    /* Configuration registers hold what is written */
+  }
+  StartTx(p_usart);
+  UpdateLines(p_usart);
+  Reschedule(p_usart);
+}
+
+static void Usart_Event(host_model_periph_t *p_periph)
+{
+  usart_t *p_usart = (usart_t *)p_periph->p_state;
+
+  if (p_usart->rx_at <= host_model_now)
+  {
+    const line_frame_t frame = p_usart->line[p_usart->line_head];
+
+    p_usart->rx_at = HOST_MODEL_NO_EVENT;
+    p_usart->line_head = (p_usart->line_head + 1U) % LINE_SIZE;
+    p_usart->line_nbr--;
+    Receive(p_usart, frame.data);
+    StartLine(p_usart);
+  }
+  if (p_usart->tx_at <= host_model_now)
+  {
+    p_usart->tx_at = HOST_MODEL_NO_EVENT;
+    if (p_usart->capture_nbr < CAPTURE_SIZE)
+    {
+      p_usart->capture[p_usart->capture_nbr] = (uint8_t)p_usart->tx_shift;
+      p_usart->capture_nbr++;
+    }
+    if (p_usart->loopback != 0U)
+    {
+      Receive(p_usart, p_usart->tx_shift);
+    }
+    StartTx(p_usart);
+    if (p_usart->tx_at == HOST_MODEL_NO_EVENT)
+    {
+      p_usart->tc = 1U;
+    }
+  }
+  if (p_usart->idle_at <= host_model_now)
+  {
+    p_usart->idle_at = HOST_MODEL_NO_EVENT;
+    if (Enabled(p_usart, USART_CR1_RE) != 0U)
+    {
+      p_usart->flags |= USART_ISR_IDLE;
+    }
+  }
+  UpdateLines(p_usart);
+  Reschedule(p_usart);
+}
+
+static void Usart_Reset(host_model_periph_t *p_periph)
+{
+  usart_t *p_usart = (usart_t *)p_periph->p_state;
+
+  Stop(p_usart);
+  p_usart->rx_at = HOST_MODEL_NO_EVENT;
+  p_usart->line_head = 0U;
+  p_usart->line_nbr = 0U;
+  p_usart->capture_nbr = 0U;
+  p_usart->loopback = 1U;
+  Regs(p_usart)->ISR = Status(p_usart);
+}
+
+static const host_model_periph_ops_t UsartOps = {Usart_Read, Usart_Write, Usart_Event, Usart_Reset};
+
+static void Register(uint32_t index, const char *p_name, uintptr_t base, uint32_t access_cycles, uint32_t lpuart,
+                     IRQn_Type irqn, uint32_t request_rx)
+{
+  usart_t *p_usart = &Usarts[index];
+
+  p_usart->periph.p_name = p_name;
+  p_usart->periph.base = base;
+  p_usart->periph.size = 0x400U;
+  p_usart->periph.access_cycles = access_cycles;
+  p_usart->periph.p_ops = &UsartOps;
+  p_usart->periph.p_state = p_usart;
+  p_usart->lpuart = lpuart;
+  p_usart->irqn = irqn;
+  p_usart->request_rx = request_rx;
+  p_usart->request_tx = request_rx + 1U;
+  host_model_register(&p_usart->periph);
+}
+
+/* Exported functions --------------------------------------------------------*/
+void host_model_usart_register(void)
+{
+  Register(0U, "USART1", USART1_BASE_NS, HOST_MODEL_APB_CYCLES, 0U, USART1_IRQn, 24U);
+  Register(1U, "USART2", USART2_BASE_NS, HOST_MODEL_APB_CYCLES, 0U, USART2_IRQn, 26U);
+  Register(2U, "USART3", USART3_BASE_NS, HOST_MODEL_APB_CYCLES, 0U, USART3_IRQn, 28U);
+  Register(3U, "UART4", UART4_BASE_NS, HOST_MODEL_APB_CYCLES, 0U, UART4_IRQn, 30U);
+  Register(4U, "UART5", UART5_BASE_NS, HOST_MODEL_APB_CYCLES, 0U, UART5_IRQn, 32U);
+  Register(5U, "LPUART1", LPUART1_BASE_NS, HOST_MODEL_APB_CYCLES, 1U, LPUART1_IRQn, 34U);
+}
+
+void HOST_MODEL_UART_SetLoopback(USART_TypeDef *p_uart, uint32_t enable)
+{
+  host_model_sync();
+  Find(p_uart)->loopback = enable;
+}
+
+void HOST_MODEL_UART_Feed(USART_TypeDef *p_uart, const uint8_t *p_data, uint32_t size, uint32_t gap_frame_nbr)
+{
+  usart_t *p_usart = Find(p_uart);
+
+  host_model_sync();
+  if ((p_usart->line_nbr + size) > LINE_SIZE)
+  {
+    (void)fprintf(stderr, "host model: more than %u frames fed to %s\n", LINE_SIZE, p_usart->periph.p_name);
+    exit(2);
+  }
+  for (uint32_t i = 0U; i < size; i++)
+  {
+    line_frame_t *p_frame = &p_usart->line[(p_usart->line_head + p_usart->line_nbr) % LINE_SIZE];
+
+    p_frame->data = p_data[i];
+    p_frame->gap_frame_nbr = (i == 0U) ? (uint16_t)gap_frame_nbr : 0U;
+    p_usart->line_nbr++;
+  }
+  StartLine(p_usart);
+  Reschedule(p_usart);
+}
+
+uint32_t HOST_MODEL_UART_GetTx(USART_TypeDef *p_uart, uint8_t *p_data, uint32_t size)
+{
+  usart_t *p_usart = Find(p_uart);
+  uint32_t nbr;
+
+  host_model_sync();
+  nbr = (p_usart->capture_nbr < size) ? p_usart->capture_nbr : size;
+  (void)memcpy(p_data, p_usart->capture, nbr);
+  (void)memmove(p_usart->capture, &p_usart->capture[nbr], p_usart->capture_nbr - nbr);
+  p_usart->capture_nbr -= nbr;
+  return nbr;
+}
+
+uint64_t HOST_MODEL_UART_GetFrameCycles(USART_TypeDef *p_uart)
+{
+  host_model_sync();
+  return FrameCycles(Find(p_uart));
+}
@@ -0,0 +1,31 @@
+/**
+  ******************************************************************************
+  * @file    core_cm33.h
+  * @brief   Host build of the Cortex-M33 core header
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ * Found before the CMSIS one in the include path of the host build: the core intrinsics are defined by the host
+ * model (host_model_cmsis.h) instead of the ARM inline assembly of cmsis_gcc.h, then the CMSIS header is included
+ * as is for the core register definitions and the NVIC and SysTick functions.
+ */
+
+#ifndef HOST_MODEL_CORE_CM33_H
+#define HOST_MODEL_CORE_CM33_H
+
+#include "host_model_cmsis.h"
+
+#include_next "core_cm33.h"
+
+#endif /* HOST_MODEL_CORE_CM33_H */
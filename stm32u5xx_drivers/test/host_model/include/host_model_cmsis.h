@@ -0,0 +1,331 @@
+/**
+  ******************************************************************************
+  * @file    host_model_cmsis.h
+  * @brief   CMSIS-Core compiler definitions and intrinsics of the host build
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ * Replaces cmsis_gcc.h, whose guard is defined here so that cmsis_compiler.h does not include it.
+ * The instructions acting on the core state (PRIMASK, BASEPRI, WFI, exclusive accesses) go to the host model, which
+ * dispatches the interrupts when they are unmasked. The data processing ones are plain C.
+ */
+
+#ifndef HOST_MODEL_CMSIS_H
+#define HOST_MODEL_CMSIS_H
+
+#include <stdint.h>
+
+/* cmsis_gcc.h and its M-profile part are replaced by this file */
+#define __CMSIS_GCC_H
+#define __CMSIS_GCC_M_H
+
+/* Compiler specific defines -------------------------------------------------*/
+#ifndef __has_builtin
+#define __has_builtin(x)                       (0)
+#endif
+#define __ASM                                  __asm
+#define __INLINE                               inline
+#define __STATIC_INLINE                        static inline
+#define __STATIC_FORCEINLINE                   __attribute__((always_inline)) static inline
+#define __NO_RETURN                            __attribute__((__noreturn__))
+#define CMSIS_DEPRECATED                       __attribute__((deprecated))
+#define __USED                                 __attribute__((used))
+#define __WEAK                                 __attribute__((weak))
+#define __PACKED                               __attribute__((packed, aligned(1)))
+#define __PACKED_STRUCT                        struct __attribute__((packed, aligned(1)))
+#define __PACKED_UNION                         union __attribute__((packed, aligned(1)))
+#define __UNALIGNED_UINT16_WRITE(addr, val)    __builtin_memcpy((void *)(addr), &(uint16_t){(uint16_t)(val)}, 2U)
+#define __UNALIGNED_UINT16_READ(addr)          host_model_unaligned_read16((const void *)(addr))
+#define __UNALIGNED_UINT32_WRITE(addr, val)    __builtin_memcpy((void *)(addr), &(uint32_t){(uint32_t)(val)}, 4U)
+#define __UNALIGNED_UINT32_READ(addr)          host_model_unaligned_read32((const void *)(addr))
+#define __ALIGNED(x)                           __attribute__((aligned(x)))
+#define __RESTRICT                             __restrict
+#define __COMPILER_BARRIER()                   __asm volatile("" ::: "memory")
+#define __NO_INIT                              __attribute__((section(".noinit")))
+#define __ALIAS(x)                             __attribute__((alias(x)))
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Core state, implemented by the host model ---------------------------------*/
+uint32_t host_model_cpu_get_primask(void);
+void host_model_cpu_set_primask(uint32_t primask);
+uint32_t host_model_cpu_get_basepri(void);
+void host_model_cpu_set_basepri(uint32_t basepri);
+uint32_t host_model_cpu_get_ipsr(void);
+void host_model_cpu_wait(void);
+void host_model_cpu_nop(void);
+void host_model_cpu_load_exclusive(void);
+uint32_t host_model_cpu_store_exclusive_begin(void);
+void host_model_cpu_store_exclusive_end(void);
+void host_model_cpu_clear_exclusive(void);
+
+static inline uint16_t host_model_unaligned_read16(const void *addr)
+{
+  uint16_t value;
+  __builtin_memcpy(&value, addr, 2U);
+  return value;
+}
+
+static inline uint32_t host_model_unaligned_read32(const void *addr)
+{
+  uint32_t value;
+  __builtin_memcpy(&value, addr, 4U);
+  return value;
+}
+
+/* Core instruction access ---------------------------------------------------*/
+#define __NOP()                                host_model_cpu_nop()
+#define __WFI()                                host_model_cpu_wait()
+#define __WFE()                                host_model_cpu_wait()
+#define __SEV()                                ((void)0)
+#define __ISB()                                __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __DSB()                                __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __DMB()                                __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __BKPT(value)                          __builtin_trap()
+#define __REV(value)                           __builtin_bswap32(value)
+#define __REV16(value)                         host_model_rev16(value)
+#define __REVSH(value)                         ((int16_t)__builtin_bswap16((uint16_t)(value)))
+#define __CLZ(value)                           host_model_clz(value)
+#define __SSAT(value, sat)                     host_model_ssat((value), (sat))
+#define __USAT(value, sat)                     host_model_usat((value), (sat))
+
+static inline uint32_t host_model_rev16(uint32_t value)
+{
+  return ((value & 0xFF00FF00UL) >> 8U) | ((value & 0x00FF00FFUL) << 8U);
+}
+
+static inline uint32_t __ROR(uint32_t op1, uint32_t op2)
+{
+  op2 %= 32U;
+  return (op2 == 0U) ? op1 : ((op1 >> op2) | (op1 << (32U - op2)));
+}
+
+static inline uint32_t __RBIT(uint32_t value)
+{
+  uint32_t result = 0U;
+
+  for (uint32_t i = 0U; i < 32U; i++)
+  {
+    result = (result << 1U) | ((value >> i) & 1U);
+  }
+  return result;
+}
+
+static inline uint8_t host_model_clz(uint32_t value)
+{
+  return (value == 0U) ? 32U : (uint8_t)__builtin_clz(value);
+}
+
+static inline int32_t host_model_ssat(int32_t value, uint32_t sat)
+{
+  const int32_t max = (int32_t)((1U << (sat - 1U)) - 1U);
+  const int32_t min = -1 - max;
+
+  return (value > max) ? max : ((value < min) ? min : value);
+}
+
+static inline uint32_t host_model_usat(int32_t value, uint32_t sat)
+{
+  const uint32_t max = (1U << sat) - 1U;
+
+  return (value > (int32_t)max) ? max : ((value < 0) ? 0U : (uint32_t)value);
+}
+
+static inline uint32_t __RRX(uint32_t value)
+{
+  return value >> 1U;
+}
+
+/* Exclusive accesses: an interrupt taken between the load and the store makes the store fail */
+static inline uint8_t __LDREXB(volatile uint8_t *addr)
+{
+  uint8_t value = *addr;
+
+  host_model_cpu_load_exclusive();
+  return value;
+}
+
+static inline uint16_t __LDREXH(volatile uint16_t *addr)
+{
+  uint16_t value = *addr;
+
+  host_model_cpu_load_exclusive();
+  return value;
+}
+
+static inline uint32_t __LDREXW(volatile uint32_t *addr)
+{
+  uint32_t value = *addr;
+
+  host_model_cpu_load_exclusive();
+  return value;
+}
+
+static inline uint32_t __STREXB(uint8_t value, volatile uint8_t *addr)
+{
+  if (host_model_cpu_store_exclusive_begin() == 0U)
+  {
+    return 1U;
+  }
+  *addr = value;
+  host_model_cpu_store_exclusive_end();
+  return 0U;
+}
+
+static inline uint32_t __STREXH(uint16_t value, volatile uint16_t *addr)
+{
+  if (host_model_cpu_store_exclusive_begin() == 0U)
+  {
+    return 1U;
+  }
+  *addr = value;
+  host_model_cpu_store_exclusive_end();
+  return 0U;
+}
+
+static inline uint32_t __STREXW(uint32_t value, volatile uint32_t *addr)
+{
+  if (host_model_cpu_store_exclusive_begin() == 0U)
+  {
+    return 1U;
+  }
+  *addr = value;
+  host_model_cpu_store_exclusive_end();
+  return 0U;
+}
+
+#define __CLREX()                              host_model_cpu_clear_exclusive()
+#define __LDAEXB(ptr)                          __LDREXB(ptr)
+#define __LDAEXH(ptr)                          __LDREXH(ptr)
+#define __LDAEX(ptr)                           __LDREXW(ptr)
+#define __STLEXB(value, ptr)                   __STREXB((value), (ptr))
+#define __STLEXH(value, ptr)                   __STREXH((value), (ptr))
+#define __STLEX(value, ptr)                    __STREXW((value), (ptr))
+#define __LDAB(ptr)                            (*(ptr))
+#define __LDAH(ptr)                            (*(ptr))
+#define __LDA(ptr)                             (*(ptr))
+#define __STLB(value, ptr)                     ((void)(*(ptr) = (value)))
+#define __STLH(value, ptr)                     ((void)(*(ptr) = (value)))
+#define __STL(value, ptr)                      ((void)(*(ptr) = (value)))
+
+/* Core register access ------------------------------------------------------*/
+#define __enable_irq()                         host_model_cpu_set_primask(0U)
+#define __disable_irq()                        host_model_cpu_set_primask(1U)
+#define __get_PRIMASK()                        host_model_cpu_get_primask()
+#define __set_PRIMASK(primask)                 host_model_cpu_set_primask(primask)
+#define __get_BASEPRI()                        host_model_cpu_get_basepri()
+#define __set_BASEPRI(basepri)                 host_model_cpu_set_basepri(basepri)
+#define __get_IPSR()                           host_model_cpu_get_ipsr()
+
+static inline void __set_BASEPRI_MAX(uint32_t basepri)
+{
+  uint32_t current = host_model_cpu_get_basepri();
+
+  if ((basepri != 0U) && ((current == 0U) || (basepri < current)))
+  {
+    host_model_cpu_set_basepri(basepri);
+  }
+}
+
+/* Registers without effect in the model */
+static inline uint32_t __get_CONTROL(void)
+{
+  return 0U;
+}
+
+static inline void __set_CONTROL(uint32_t control)
+{
+  (void)control;
+}
+
+static inline uint32_t __get_APSR(void)
+{
+  return 0U;
+}
+
+static inline uint32_t __get_xPSR(void)
+{
+  return host_model_cpu_get_ipsr();
+}
+
+static inline uint32_t __get_PSP(void)
+{
+  return 0U;
+}
+
+static inline void __set_PSP(uint32_t top_of_proc_stack)
+{
+  (void)top_of_proc_stack;
+}
+
+static inline uint32_t __get_MSP(void)
+{
+  return 0U;
+}
+
+static inline void __set_MSP(uint32_t top_of_main_stack)
+{
+  (void)top_of_main_stack;
+}
+
+static inline uint32_t __get_PSPLIM(void)
+{
+  return 0U;
+}
+
+static inline void __set_PSPLIM(uint32_t proc_stack_ptr_limit)
+{
+  (void)proc_stack_ptr_limit;
+}
+
+static inline uint32_t __get_MSPLIM(void)
+{
+  return 0U;
+}
+
+static inline void __set_MSPLIM(uint32_t main_stack_ptr_limit)
+{
+  (void)main_stack_ptr_limit;
+}
+
+static inline uint32_t __get_FAULTMASK(void)
+{
+  return 0U;
+}
+
+static inline void __set_FAULTMASK(uint32_t fault_mask)
+{
+  (void)fault_mask;
+}
+
+#define __enable_fault_irq()                   ((void)0)
+#define __disable_fault_irq()                  ((void)0)
+
+static inline uint32_t __get_FPSCR(void)
+{
+  return 0U;
+}
+
+static inline void __set_FPSCR(uint32_t fpscr)
+{
+  (void)fpscr;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_MODEL_CMSIS_H */
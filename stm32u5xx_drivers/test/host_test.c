@@ -0,0 +1,75 @@
+/**
+  ******************************************************************************
+  * @file    host_test.c
+  * @brief   Checks shared by the HAL host tests
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_test.h"
+#include "host_model.h"
+#include "stm32_hal.h"
+
+/* Exported variables --------------------------------------------------------*/
+int Failures;
+
+/* Exported functions --------------------------------------------------------*/
+void assert_dbg_param_failed(uint8_t *file, uint32_t line)
+{
+  printf("FAIL %s:%u: parameter assertion\n", (const char *)file, (unsigned int)line);
+  Failures++;
+}
+
+void assert_dbg_state_failed(uint8_t *file, uint32_t line)
+{
+  printf("FAIL %s:%u: state assertion\n", (const char *)file, (unsigned int)line);
+  Failures++;
+}
+
+void HOST_TEST_Init(void)
+{
+  HOST_MODEL_Init();
+  if (HAL_Init() != HAL_OK)
+  {
+    printf("FAIL %s:%d: HAL_Init\n", __FILE__, __LINE__);
+    Failures++;
+  }
+}
+
+uint32_t HOST_TEST_Wait(const volatile uint32_t *p_flag, uint32_t timeout_ms)
+{
+  const uint32_t tickstart = HAL_GetTick();
+
+  /* Each read of the flag advances the virtual clock, which runs the peripherals and takes the interrupts */
+  while ((*p_flag == 0U) && ((HAL_GetTick() - tickstart) < timeout_ms))
+  {
+  }
+  return *p_flag;
+}
+
+int HOST_TEST_Report(void)
+{
+  if (HOST_MODEL_GetUnhandledIrq() != 0U)
+  {
+    printf("FAIL %s:%d: %u interrupt(s) without handler\n", __FILE__, __LINE__,
+           (unsigned int)HOST_MODEL_GetUnhandledIrq());
+    Failures++;
+  }
+  if (Failures != 0)
+  {
+    printf("%d check(s) failed\n", Failures);
+    return 1;
+  }
+  printf("all checks passed\n");
+  return 0;
+}
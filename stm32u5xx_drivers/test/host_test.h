@@ -0,0 +1,50 @@
+/**
+  ******************************************************************************
+  * @file    host_test.h
+  * @brief   Checks shared by the HAL host tests
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+
+/* Exported macros -----------------------------------------------------------*/
+#define CHECK(cond, ...)                                      \
+  do                                                          \
+  {                                                           \
+    if (!(cond))                                              \
+    {                                                         \
+      printf("FAIL %s:%d: ", __FILE__, __LINE__);             \
+      printf(__VA_ARGS__);                                    \
+      printf("\n");                                           \
+      Failures++;                                             \
+    }                                                         \
+  } while (0)
+
+/* Exported variables --------------------------------------------------------*/
+/* Failed checks, the failed HAL assertions included */
+extern int Failures;
+
+/* Exported functions --------------------------------------------------------*/
+/* Reset the model and the HAL, with the SysTick running at 1 kHz */
+void HOST_TEST_Init(void);
+/* Wait until *p_flag is not 0 or timeout_ms of virtual time elapse; return *p_flag */
+uint32_t HOST_TEST_Wait(const volatile uint32_t *p_flag, uint32_t timeout_ms);
+/* Print the result and return the exit code of the test */
+int HOST_TEST_Report(void);
+
+#endif /* HOST_TEST_H */
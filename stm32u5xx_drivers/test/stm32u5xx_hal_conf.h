@@ -0,0 +1,149 @@
+/**
+  ******************************************************************************
+  * @file    stm32u5xx_hal_conf.h
+  * @brief   HAL configuration of the host tests.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef  STM32U5XX_HAL_CONF_H
+#define  STM32U5XX_HAL_CONF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Only the modules of the peripherals modeled on the host are selected. The options a test varies are set by the
+   test build when they are defined before this file. */
+
+/* ########################### System Configuration ############################# */
+#define  TICK_INT_PRIORITY                      ((1UL << __NVIC_PRIO_BITS) - 1UL)  /*!< tick interrupt priority (lowest by default) */
+#define  USE_HAL_FLASH_PREFETCH                 0U     /*!< Enable Flash prefetch */
+
+/* ########################## HAL MUTEX usage activation  ####################### */
+#define USE_HAL_MUTEX                           0U
+
+/* ########################## HAL API parameters check  ##################### */
+#define USE_HAL_CHECK_PARAM                     1U
+#define USE_HAL_SECURE_CHECK_PARAM              0U
+
+/* ########################## State transition   ################################ */
+#define USE_HAL_CHECK_PROCESS_STATE             0U
+
+/* ########################## HAL_AES Config #################################### */
+#define USE_HAL_AES_MODULE                      1U
+#define USE_HAL_AES_CLK_ENABLE_MODEL            HAL_CLK_ENABLE_PERIPH_ONLY
+#define USE_HAL_AES_USER_DATA                   0U
+#define USE_HAL_AES_REGISTER_CALLBACKS          0U
+#define USE_HAL_AES_GET_LAST_ERRORS             1U
+#define USE_HAL_AES_DMA                         1U
+#define USE_HAL_AES_SUSPEND_RESUME              1U
+#define USE_HAL_AES_ECB_CBC_ALGO                1U
+#define USE_HAL_AES_CTR_ALGO                    1U
+#define USE_HAL_AES_GCM_GMAC_ALGO               1U
+#define USE_HAL_AES_CCM_ALGO                    1U
+
+/* ########################## HAL_CORTEX Config ################################# */
+#define USE_HAL_CORTEX_MODULE                   1U
+
+/* ########################## HAL_CRC Config #################################### */
+#define USE_HAL_CRC_MODULE                      1U
+#define USE_HAL_CRC_CLK_ENABLE_MODEL            HAL_CLK_ENABLE_PERIPH_ONLY
+#define USE_HAL_CRC_USER_DATA                   0U
+#define USE_HAL_CRC_REGISTER_CALLBACKS          0U
+#define USE_HAL_CRC_DMA                         1U
+
+/* ########################## HAL_DMA Config #################################### */
+#define USE_HAL_DMA_MODULE                      1U
+#define USE_HAL_DMA_CLK_ENABLE_MODEL            HAL_CLK_ENABLE_PERIPH_ONLY
+#define USE_HAL_DMA_USER_DATA                   0U
+#define USE_HAL_DMA_GET_LAST_ERRORS             1U
+#ifndef USE_HAL_DMA_LINKEDLIST
+#define USE_HAL_DMA_LINKEDLIST                  1U
+#endif /* USE_HAL_DMA_LINKEDLIST */
+
+/* ########################## HAL_GPIO Config ################################### */
+#define USE_HAL_GPIO_MODULE                     1U
+#define USE_HAL_GPIO_CLK_ENABLE_MODEL           HAL_CLK_ENABLE_PERIPH_ONLY
+#define USE_HAL_GPIO_HSLV                       0U
+
+/* ########################## HAL_HASH Config ################################### */
+#define USE_HAL_HASH_MODULE                     1U
+#define USE_HAL_HASH_CLK_ENABLE_MODEL           HAL_CLK_ENABLE_PERIPH_ONLY
+#define USE_HAL_HASH_REGISTER_CALLBACKS         0U
+#define USE_HAL_HASH_USER_DATA                  0U
+#define USE_HAL_HASH_GET_LAST_ERRORS            1U
+#define USE_HAL_HASH_DMA                        1U
+
+/* ########################## HAL_I2C Config #################################### */
+/* No model of the I2C: its HAL is not built, the tests of the utilities using it define the functions they call */
+#define USE_HAL_I2C_MODULE                      1U
+#define USE_HAL_I2C_CLK_ENABLE_MODEL            HAL_CLK_ENABLE_NO
+#define USE_HAL_I2C_REGISTER_CALLBACKS          0U
+#define USE_HAL_I2C_USER_DATA                   0U
+#define USE_HAL_I2C_GET_LAST_ERRORS             0U
+#define USE_HAL_I2C_DMA                         1U
+
+/* ########################## HAL_PKA Config #################################### */
+/* No model of the PKA: its HAL is not built, the tests of the utilities using it define the functions they call */
+#define USE_HAL_PKA_MODULE                      1U
+#define USE_HAL_PKA_CLK_ENABLE_MODEL            HAL_CLK_ENABLE_NO
+#define USE_HAL_PKA_REGISTER_CALLBACKS          0U
+#define USE_HAL_PKA_USER_DATA                   0U
+#define USE_HAL_PKA_GET_LAST_ERRORS             0U
+
+/* ########################## HAL_PWR Config #################################### */
+#define USE_HAL_PWR_MODULE                      1U
+
+/* ########################## HAL_Q Config ###################################### */
+#ifndef USE_HAL_Q_CHECK_NODES
+#define USE_HAL_Q_CHECK_NODES                   1U
+#endif /* USE_HAL_Q_CHECK_NODES */
+#ifndef USE_HAL_Q_SHADOW_INDEX
+#define USE_HAL_Q_SHADOW_INDEX                  0U
+#endif /* USE_HAL_Q_SHADOW_INDEX */
+
+/* ########################## HAL_RCC Config #################################### */
+#define USE_HAL_RCC_MODULE                      1U
+
+/* ########################## HAL_RNG Config #################################### */
+#define USE_HAL_RNG_MODULE                      1U
+#define USE_HAL_RNG_CLK_ENABLE_MODEL            HAL_CLK_ENABLE_PERIPH_ONLY
+#define USE_HAL_RNG_REGISTER_CALLBACKS          0U
+#define USE_HAL_RNG_USER_DATA                   0U
+#define USE_HAL_RNG_GET_LAST_ERRORS             1U
+
+/* ########################## HAL_SPI Config #################################### */
+#define USE_HAL_SPI_MODULE                      1U
+#define USE_HAL_SPI_CLK_ENABLE_MODEL            HAL_CLK_ENABLE_PERIPH_ONLY
+#define USE_HAL_SPI_REGISTER_CALLBACKS          0U
+#define USE_HAL_SPI_USER_DATA                   0U
+#define USE_HAL_SPI_GET_LAST_ERRORS             1U
+#define USE_HAL_SPI_DMA                         1U
+#define USE_HAL_SPI_CRC                         0U
+
+/* ########################## HAL_UART Config ################################### */
+#define USE_HAL_UART_MODULE                     1U
+#define USE_HAL_UART_CLK_ENABLE_MODEL           HAL_CLK_ENABLE_PERIPH_ONLY
+#ifndef USE_HAL_UART_REGISTER_CALLBACKS
+#define USE_HAL_UART_REGISTER_CALLBACKS         0U
+#endif /* USE_HAL_UART_REGISTER_CALLBACKS */
+#define USE_HAL_UART_USER_DATA                  0U
+#define USE_HAL_UART_GET_LAST_ERRORS            1U
+#define USE_HAL_UART_DMA                        1U
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /*  STM32U5XX_HAL_CONF_H */
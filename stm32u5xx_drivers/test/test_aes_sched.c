@@ -0,0 +1,480 @@
+/**
+  ******************************************************************************
+  * @file    test_aes_sched.c
+  * @brief   Host tests of the HAL AES context switches and of the AES scheduler on the AES and GPDMA models
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ * AES with byte swapping, the DMA in and out on GPDMA1 channels 2 and 3:
+ * - known answers of the model: ECB AES-128 and AES-256 of FIPS-197, CBC and CTR of SP 800-38A, GCM test case 4 of
+ *   the GCM specification (header of 20 bytes, message of 60 bytes, tag),
+ * - suspension of an interrupt CBC encryption: HAL_AES_SaveContext() and HAL_AES_RestoreContext() around another
+ *   message: IDLE after the save, SUSPENDED after the restore, and the resumed message is the one-shot message,
+ * - HAL_AES_SaveIdleContext() and HAL_AES_RestoreIdleContext() between two calls of a CBC decryption around a CTR
+ *   message, and of a GCM encryption before its tag,
+ * - scheduler: CBC, CTR and GCM sessions of two priorities cut in chunks, the outputs and the tag equal to the
+ *   one-shot results, context switches, no read or write error of the peripheral,
+ * - scheduler validations: misaligned buffers, ECB job of a partial block, and a GCM job after the partial block
+ *   which ends the message, accepted again after the tag.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#define _POSIX_C_SOURCE 200809L
+#include <string.h>
+
+#include "host_model.h"
+#include "host_test.h"
+#include "stm32_hal.h"
+#include "stm32_utils_aes_sched.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define DATA_SIZE         512U
+#define GCM_SIZE          60U
+#define CHUNK_SIZE        64U
+
+/* Private variables ---------------------------------------------------------*/
+static hal_aes_handle_t hAes;
+static hal_dma_handle_t hDmaIn;
+static hal_dma_handle_t hDmaOut;
+static stm32_utils_aes_sched_t Sched;
+static volatile uint32_t CpltNbr;
+static volatile uint32_t SuspendNbr;
+static volatile uint32_t ErrorNbr;
+static volatile uint32_t JobNbr;
+
+static uint8_t Plain[DATA_SIZE] __attribute__((aligned(4)));
+static uint8_t Cipher[DATA_SIZE] __attribute__((aligned(4)));
+static uint8_t Cipher2[DATA_SIZE] __attribute__((aligned(4)));
+static uint8_t Output[DATA_SIZE + 4U] __attribute__((aligned(4)));
+static uint8_t Output2[DATA_SIZE] __attribute__((aligned(4)));
+
+/* FIPS-197 appendix C */
+static const uint32_t Key256[8] =
+{
+  0x00010203U, 0x04050607U, 0x08090a0bU, 0x0c0d0e0fU, 0x10111213U, 0x14151617U, 0x18191a1bU, 0x1c1d1e1fU
+};
+static const uint8_t FipsPlain[16] __attribute__((aligned(4))) =
+{
+  0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff
+};
+static const uint8_t FipsCipher128[16] =
+{
+  0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30, 0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a
+};
+static const uint8_t FipsCipher256[16] =
+{
+  0x8e, 0xa2, 0xb7, 0xca, 0x51, 0x67, 0x45, 0xbf, 0xea, 0xfc, 0x49, 0x90, 0x4b, 0x49, 0x60, 0x89
+};
+
+/* SP 800-38A F.2.1 and F.5.1, first block */
+static const uint32_t NistKey[4] = {0x2b7e1516U, 0x28aed2a6U, 0xabf71588U, 0x09cf4f3cU};
+static const uint32_t CbcIv[4] = {0x00010203U, 0x04050607U, 0x08090a0bU, 0x0c0d0e0fU};
+static const uint32_t CtrIv[4] = {0xf0f1f2f3U, 0xf4f5f6f7U, 0xf8f9fafbU, 0xfcfdfeffU};
+static const uint8_t NistPlain[16] =
+{
+  0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96, 0xe9, 0x3d, 0x7e, 0x11, 0x73, 0x93, 0x17, 0x2a
+};
+static const uint8_t CbcCipher[16] =
+{
+  0x76, 0x49, 0xab, 0xac, 0x81, 0x19, 0xb2, 0x46, 0xce, 0xe9, 0x8e, 0x9b, 0x12, 0xe9, 0x19, 0x7d
+};
+static const uint8_t CtrCipher[16] =
+{
+  0x87, 0x4d, 0x61, 0x91, 0xb6, 0x20, 0xe3, 0x26, 0x1b, 0xef, 0x68, 0x64, 0x99, 0x0d, 0xb6, 0xce
+};
+
+/* GCM specification, test case 4: the counter of the first block of the message is 2 */
+static const uint32_t GcmKey[4] = {0xfeffe992U, 0x8665731cU, 0x6d6a8f94U, 0x67308308U};
+static uint32_t GcmIv[4] = {0xcafebabeU, 0xfacedbadU, 0xdecaf888U, 0x00000002U};
+static uint8_t GcmHeader[20] __attribute__((aligned(4))) =
+{
+  0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef, 0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef,
+  0xab, 0xad, 0xda, 0xd2
+};
+static const uint8_t GcmPlain[GCM_SIZE] __attribute__((aligned(4))) =
+{
+  0xd9, 0x31, 0x32, 0x25, 0xf8, 0x84, 0x06, 0xe5, 0xa5, 0x59, 0x09, 0xc5, 0xaf, 0xf5, 0x26, 0x9a,
+  0x86, 0xa7, 0xa9, 0x53, 0x15, 0x34, 0xf7, 0xda, 0x2e, 0x4c, 0x30, 0x3d, 0x8a, 0x31, 0x8a, 0x72,
+  0x1c, 0x3c, 0x0c, 0x95, 0x95, 0x68, 0x09, 0x53, 0x2f, 0xcf, 0x0e, 0x24, 0x49, 0xa6, 0xb5, 0x25,
+  0xb1, 0x6a, 0xed, 0xf5, 0xaa, 0x0d, 0xe6, 0x57, 0xba, 0x63, 0x7b, 0x39
+};
+static const uint8_t GcmCipher[GCM_SIZE] =
+{
+  0x42, 0x83, 0x1e, 0xc2, 0x21, 0x77, 0x74, 0x24, 0x4b, 0x72, 0x21, 0xb7, 0x84, 0xd0, 0xd4, 0x9c,
+  0xe3, 0xaa, 0x21, 0x2f, 0x2c, 0x02, 0xa4, 0xe0, 0x35, 0xc1, 0x7e, 0x23, 0x29, 0xac, 0xa1, 0x2e,
+  0x21, 0xd5, 0x14, 0xb2, 0x54, 0x66, 0x93, 0x1c, 0x7d, 0x8f, 0x6a, 0x5a, 0xac, 0x84, 0xaa, 0x05,
+  0x1b, 0xa3, 0x0b, 0x39, 0x6a, 0x0a, 0xac, 0x97, 0x3d, 0x58, 0xe0, 0x91
+};
+/* The tag is read without swapping: big-endian words */
+static const uint32_t GcmTag[4] = {0x5bc94fbcU, 0x3221a5dbU, 0x94fae95aU, 0xe7121a47U};
+
+/* Handlers and callbacks ----------------------------------------------------*/
+void AES_IRQHandler(void)
+{
+  HAL_AES_IRQHandler(&hAes);
+}
+
+void GPDMA1_Channel2_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&hDmaIn);
+}
+
+void GPDMA1_Channel3_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&hDmaOut);
+}
+
+void HAL_AES_OutCpltCallback(hal_aes_handle_t *haes)
+{
+  CpltNbr++;
+  STM32_UTILS_AES_SCHED_OutCpltCallback(haes);
+}
+
+void HAL_AES_ErrorCallback(hal_aes_handle_t *haes)
+{
+  ErrorNbr++;
+  STM32_UTILS_AES_SCHED_ErrorCallback(haes);
+}
+
+void HAL_AES_SuspendCallback(hal_aes_handle_t *haes)
+{
+  (void)haes;
+  SuspendNbr++;
+}
+
+static void JobCallback(stm32_utils_aes_sched_job_t *p_job)
+{
+  (void)p_job;
+  JobNbr++;
+}
+
+/* Private functions ---------------------------------------------------------*/
+static void Start(void)
+{
+  hal_dma_direct_xfer_config_t dma_config =
+  {
+    HAL_GPDMA1_REQUEST_AES_IN, HAL_DMA_DIRECTION_MEMORY_TO_PERIPH, HAL_DMA_SRC_ADDR_INCREMENTED,
+    HAL_DMA_DEST_ADDR_FIXED, HAL_DMA_SRC_DATA_WIDTH_WORD, HAL_DMA_DEST_DATA_WIDTH_WORD,
+    HAL_DMA_PRIORITY_LOW_WEIGHT_HIGH
+  };
+
+  HOST_TEST_Init();
+  CHECK(HAL_AES_Init(&hAes, HAL_AES) == HAL_OK, "HAL_AES_Init");
+
+  CHECK(HAL_DMA_Init(&hDmaIn, HAL_GPDMA1_CH2) == HAL_OK, "HAL_DMA_Init in");
+  CHECK(HAL_DMA_SetConfigDirectXfer(&hDmaIn, &dma_config) == HAL_OK, "DMA in configuration");
+  CHECK(HAL_AES_SetInDMA(&hAes, &hDmaIn) == HAL_OK, "HAL_AES_SetInDMA");
+
+  dma_config.request = HAL_GPDMA1_REQUEST_AES_OUT;
+  dma_config.direction = HAL_DMA_DIRECTION_PERIPH_TO_MEMORY;
+  dma_config.src_inc = HAL_DMA_SRC_ADDR_FIXED;
+  dma_config.dest_inc = HAL_DMA_DEST_ADDR_INCREMENTED;
+  CHECK(HAL_DMA_Init(&hDmaOut, HAL_GPDMA1_CH3) == HAL_OK, "HAL_DMA_Init out");
+  CHECK(HAL_DMA_SetConfigDirectXfer(&hDmaOut, &dma_config) == HAL_OK, "DMA out configuration");
+  CHECK(HAL_AES_SetOutDMA(&hAes, &hDmaOut) == HAL_OK, "HAL_AES_SetOutDMA");
+
+  HAL_CORTEX_NVIC_EnableIRQ(AES_IRQn);
+  HAL_CORTEX_NVIC_EnableIRQ(GPDMA1_CH2_IRQn);
+  HAL_CORTEX_NVIC_EnableIRQ(GPDMA1_CH3_IRQn);
+
+  CpltNbr = 0U;
+  SuspendNbr = 0U;
+  ErrorNbr = 0U;
+  JobNbr = 0U;
+  (void)memset(Output, 0, sizeof(Output));
+  (void)memset(Output2, 0, sizeof(Output2));
+}
+
+static void SetGcm(void)
+{
+  const hal_aes_gcm_config_t config = {GcmIv, (uint32_t *)(void *)GcmHeader, sizeof(GcmHeader)};
+
+  CHECK(HAL_AES_GCM_GMAC_SetConfig(&hAes, &config) == HAL_OK, "HAL_AES_GCM_GMAC_SetConfig");
+  CHECK(HAL_AES_SetNormalKey(&hAes, HAL_AES_KEY_SIZE_128BIT, GcmKey) == HAL_OK, "HAL_AES_SetNormalKey");
+  CHECK(HAL_AES_SetDataSwapping(&hAes, HAL_AES_DATA_SWAPPING_BYTE) == HAL_OK, "HAL_AES_SetDataSwapping");
+}
+
+static void SetEcb(hal_aes_key_size_t key_size)
+{
+  CHECK(HAL_AES_ECB_SetConfig(&hAes) == HAL_OK, "HAL_AES_ECB_SetConfig");
+  CHECK(HAL_AES_SetNormalKey(&hAes, key_size, Key256) == HAL_OK, "HAL_AES_SetNormalKey");
+  CHECK(HAL_AES_SetDataSwapping(&hAes, HAL_AES_DATA_SWAPPING_BYTE) == HAL_OK, "HAL_AES_SetDataSwapping");
+}
+
+static void SetCipher(uint32_t ctr, const uint32_t *p_iv)
+{
+  CHECK(((ctr != 0U) ? HAL_AES_CTR_SetConfig(&hAes, p_iv) : HAL_AES_CBC_SetConfig(&hAes, p_iv)) == HAL_OK,
+        "%s configuration", (ctr != 0U) ? "CTR" : "CBC");
+  CHECK(HAL_AES_SetNormalKey(&hAes, HAL_AES_KEY_SIZE_128BIT, NistKey) == HAL_OK, "HAL_AES_SetNormalKey");
+  CHECK(HAL_AES_SetDataSwapping(&hAes, HAL_AES_DATA_SWAPPING_BYTE) == HAL_OK, "HAL_AES_SetDataSwapping");
+}
+
+static void CheckBytes(const char *p_name, const uint8_t *p_data, const uint8_t *p_expected, uint32_t size)
+{
+  for (uint32_t i = 0U; i < size; i++)
+  {
+    if (p_data[i] != p_expected[i])
+    {
+      CHECK(0, "%s: byte %u is 0x%02X instead of 0x%02X", p_name, (unsigned int)i, (unsigned int)p_data[i],
+            (unsigned int)p_expected[i]);
+      break;
+    }
+  }
+}
+
+static void CheckTag(const char *p_name, const uint32_t *p_tag)
+{
+  for (uint32_t i = 0U; i < 4U; i++)
+  {
+    CHECK(p_tag[i] == GcmTag[i], "%s: tag word %u is 0x%08X instead of 0x%08X", p_name, (unsigned int)i,
+          (unsigned int)p_tag[i], (unsigned int)GcmTag[i]);
+  }
+}
+
+/* HOST_TEST_Wait() for a count of jobs */
+static void WaitJobs(uint32_t nbr, uint32_t timeout_ms)
+{
+  const uint32_t tickstart = HAL_GetTick();
+
+  while ((JobNbr < nbr) && ((HAL_GetTick() - tickstart) < timeout_ms))
+  {
+  }
+}
+
+static void TestKnownAnswers(void)
+{
+  host_model_aes_stats_t stats;
+  uint32_t tag[4];
+
+  /* ECB: each message starts with its configuration, the decryption derives the key first */
+  Start();
+  SetEcb(HAL_AES_KEY_SIZE_128BIT);
+  CHECK(HAL_AES_Encrypt(&hAes, FipsPlain, 16U, Output, 10U) == HAL_OK, "ECB AES-128 encryption");
+  CheckBytes("ECB AES-128", Output, FipsCipher128, 16U);
+  SetEcb(HAL_AES_KEY_SIZE_128BIT);
+  CHECK(HAL_AES_Decrypt(&hAes, FipsCipher128, 16U, Output, 10U) == HAL_OK, "ECB AES-128 decryption");
+  CheckBytes("ECB AES-128 decryption", Output, FipsPlain, 16U);
+
+  SetEcb(HAL_AES_KEY_SIZE_256BIT);
+  CHECK(HAL_AES_Encrypt(&hAes, FipsPlain, 16U, Output, 10U) == HAL_OK, "ECB AES-256 encryption");
+  CheckBytes("ECB AES-256", Output, FipsCipher256, 16U);
+  SetEcb(HAL_AES_KEY_SIZE_256BIT);
+  CHECK(HAL_AES_Decrypt(&hAes, FipsCipher256, 16U, Output, 10U) == HAL_OK, "ECB AES-256 decryption");
+  CheckBytes("ECB AES-256 decryption", Output, FipsPlain, 16U);
+  HOST_MODEL_AES_GetStats(&stats);
+  CHECK(stats.derivation_nbr == 2U, "%u key derivation(s)", (unsigned int)stats.derivation_nbr);
+
+  /* CBC and CTR on the whole buffer: the first block is the known one */
+  (void)memcpy(Plain, NistPlain, sizeof(NistPlain));
+  SetCipher(0U, CbcIv);
+  CHECK(HAL_AES_Encrypt(&hAes, Plain, DATA_SIZE, Cipher, 100U) == HAL_OK, "CBC encryption");
+  CheckBytes("CBC", Cipher, CbcCipher, 16U);
+  SetCipher(1U, CtrIv);
+  CHECK(HAL_AES_Encrypt(&hAes, Plain, DATA_SIZE, Cipher2, 100U) == HAL_OK, "CTR encryption");
+  CheckBytes("CTR", Cipher2, CtrCipher, 16U);
+
+  /* GCM: header of 20 bytes and message of 60 bytes, the last block padded by the HAL */
+  SetGcm();
+  CHECK(HAL_AES_Encrypt(&hAes, GcmPlain, GCM_SIZE, Output, 100U) == HAL_OK, "GCM encryption");
+  CheckBytes("GCM", Output, GcmCipher, GCM_SIZE);
+  CHECK(HAL_AES_GCM_GenerateAuthTAG(&hAes, tag, 10U) == HAL_OK, "GCM tag");
+  CheckTag("GCM", tag);
+
+  HOST_MODEL_AES_GetStats(&stats);
+  CHECK(stats.error_nbr == 0U, "%u read or write error(s)", (unsigned int)stats.error_nbr);
+}
+
+static void TestSuspend(void)
+{
+  hal_aes_save_context_t context;
+
+  Start();
+  SetCipher(0U, CbcIv);
+  CHECK(HAL_AES_Encrypt_IT(&hAes, Plain, DATA_SIZE, Output) == HAL_OK, "CBC interrupt encryption");
+  CHECK(HAL_AES_RequestSuspend(&hAes) == HAL_OK, "HAL_AES_RequestSuspend");
+  CHECK(HOST_TEST_Wait(&SuspendNbr, 100U) == 1U, "no suspension");
+  CHECK(HAL_AES_GetState(&hAes) == HAL_AES_STATE_SUSPENDED, "state 0x%08X", (unsigned int)HAL_AES_GetState(&hAes));
+  CHECK(CpltNbr == 0U, "completion before the suspension");
+
+  /* Another message between the save and the restore */
+  CHECK(HAL_AES_SaveContext(&hAes, &context) == HAL_OK, "HAL_AES_SaveContext");
+  CHECK(HAL_AES_GetState(&hAes) == HAL_AES_STATE_IDLE, "state 0x%08X after the save",
+        (unsigned int)HAL_AES_GetState(&hAes));
+  SetCipher(1U, CtrIv);
+  CHECK(HAL_AES_Encrypt(&hAes, Plain, DATA_SIZE, Output2, 100U) == HAL_OK, "CTR encryption while suspended");
+  CheckBytes("CTR while suspended", Output2, Cipher2, DATA_SIZE);
+  CHECK(HAL_AES_RestoreContext(&hAes, &context) == HAL_OK, "HAL_AES_RestoreContext");
+  CHECK(HAL_AES_GetState(&hAes) == HAL_AES_STATE_SUSPENDED, "state 0x%08X after the restore",
+        (unsigned int)HAL_AES_GetState(&hAes));
+
+  CHECK(HAL_AES_Resume(&hAes) == HAL_OK, "HAL_AES_Resume");
+  CHECK(HOST_TEST_Wait(&CpltNbr, 100U) == 1U, "no completion");
+  CheckBytes("CBC resumed", Output, Cipher, DATA_SIZE);
+  CHECK(ErrorNbr == 0U, "%u error(s)", (unsigned int)ErrorNbr);
+}
+
+static void TestIdleContext(void)
+{
+  const uint32_t half = DATA_SIZE / 2U;
+  hal_aes_save_context_t context;
+  uint32_t tag[4];
+
+  /* CBC decryption in two calls around a CTR message */
+  Start();
+  SetCipher(0U, CbcIv);
+  CHECK(HAL_AES_Decrypt(&hAes, Cipher, (uint16_t)half, Output, 100U) == HAL_OK, "first CBC decryption");
+  CHECK(HAL_AES_SaveIdleContext(&hAes, &context) == HAL_OK, "HAL_AES_SaveIdleContext");
+  CHECK(HAL_AES_GetState(&hAes) == HAL_AES_STATE_IDLE, "state 0x%08X after the save",
+        (unsigned int)HAL_AES_GetState(&hAes));
+  SetCipher(1U, CtrIv);
+  CHECK(HAL_AES_Encrypt(&hAes, Plain, DATA_SIZE, Output2, 100U) == HAL_OK, "CTR encryption between the calls");
+  CheckBytes("CTR between the calls", Output2, Cipher2, DATA_SIZE);
+  CHECK(HAL_AES_RestoreIdleContext(&hAes, &context) == HAL_OK, "HAL_AES_RestoreIdleContext");
+  CHECK(HAL_AES_GetState(&hAes) == HAL_AES_STATE_IDLE, "state 0x%08X after the restore",
+        (unsigned int)HAL_AES_GetState(&hAes));
+  CHECK(HAL_AES_Decrypt(&hAes, &Cipher[half], (uint16_t)half, &Output[half], 100U) == HAL_OK, "second CBC decryption");
+  CheckBytes("CBC decryption in two calls", Output, Plain, DATA_SIZE);
+
+  /* GCM: the tag after a restore needs the peripheral enabled again */
+  SetGcm();
+  CHECK(HAL_AES_Encrypt(&hAes, GcmPlain, 32U, Output, 100U) == HAL_OK, "first GCM encryption");
+  CHECK(HAL_AES_SaveIdleContext(&hAes, &context) == HAL_OK, "GCM HAL_AES_SaveIdleContext");
+  SetCipher(1U, CtrIv);
+  CHECK(HAL_AES_Encrypt(&hAes, Plain, DATA_SIZE, Output2, 100U) == HAL_OK, "CTR encryption in the GCM message");
+  CHECK(HAL_AES_RestoreIdleContext(&hAes, &context) == HAL_OK, "GCM HAL_AES_RestoreIdleContext");
+  CHECK(HAL_AES_Encrypt(&hAes, &GcmPlain[32], GCM_SIZE - 32U, &Output[32], 100U) == HAL_OK, "second GCM encryption");
+  CheckBytes("GCM in two calls", Output, GcmCipher, GCM_SIZE);
+  CHECK(HAL_AES_GCM_GenerateAuthTAG(&hAes, tag, 10U) == HAL_OK, "GCM tag after the restore");
+  CheckTag("GCM in two calls", tag);
+}
+
+static void TestScheduler(void)
+{
+  const stm32_utils_aes_sched_session_config_t cbc_config =
+  {
+    .algo = STM32_UTILS_AES_SCHED_ALGO_CBC, .dir = STM32_UTILS_AES_SCHED_ENCRYPT,
+    .key_size = HAL_AES_KEY_SIZE_128BIT, .p_key = NistKey, .p_init_vect = CbcIv,
+    .data_swapping = HAL_AES_DATA_SWAPPING_BYTE
+  };
+  const stm32_utils_aes_sched_session_config_t ctr_config =
+  {
+    .algo = STM32_UTILS_AES_SCHED_ALGO_CTR, .dir = STM32_UTILS_AES_SCHED_ENCRYPT,
+    .key_size = HAL_AES_KEY_SIZE_128BIT, .p_key = NistKey, .p_init_vect = CtrIv,
+    .data_swapping = HAL_AES_DATA_SWAPPING_BYTE
+  };
+  const hal_aes_gcm_config_t gcm = {GcmIv, (uint32_t *)(void *)GcmHeader, sizeof(GcmHeader)};
+  const stm32_utils_aes_sched_session_config_t gcm_config =
+  {
+    .algo = STM32_UTILS_AES_SCHED_ALGO_GCM_GMAC, .dir = STM32_UTILS_AES_SCHED_ENCRYPT,
+    .key_size = HAL_AES_KEY_SIZE_128BIT, .p_key = GcmKey, .p_gcm_config = &gcm,
+    .data_swapping = HAL_AES_DATA_SWAPPING_BYTE
+  };
+  static stm32_utils_aes_sched_session_t cbc;
+  static stm32_utils_aes_sched_session_t ctr;
+  static stm32_utils_aes_sched_session_t gcm_session;
+  static stm32_utils_aes_sched_job_t jobs[6];
+  static uint8_t gcm_output[GCM_SIZE + 4U] __attribute__((aligned(4)));
+  static const uint8_t ecb_input[32] __attribute__((aligned(4))) = {0};
+  host_model_aes_stats_t stats;
+  uint32_t tag[4];
+
+  Start();
+  CHECK(STM32_UTILS_AES_SCHED_Init(&Sched, &hAes, CHUNK_SIZE) == STM32_UTILS_AES_SCHED_OK, "scheduler init");
+  CHECK(STM32_UTILS_AES_SCHED_OpenSession(&Sched, &cbc, &cbc_config, 1U) == STM32_UTILS_AES_SCHED_OK, "CBC session");
+  CHECK(STM32_UTILS_AES_SCHED_OpenSession(&Sched, &ctr, &ctr_config, 1U) == STM32_UTILS_AES_SCHED_OK, "CTR session");
+  CHECK(STM32_UTILS_AES_SCHED_OpenSession(&Sched, &gcm_session, &gcm_config, 0U) == STM32_UTILS_AES_SCHED_OK,
+        "GCM session");
+
+  /* Two jobs per session: the GCM message ends with its partial block */
+  CHECK(STM32_UTILS_AES_SCHED_Submit(&cbc, &jobs[0], Plain, Output, 256U, JobCallback) == STM32_UTILS_AES_SCHED_OK,
+        "CBC job 1");
+  CHECK(STM32_UTILS_AES_SCHED_Submit(&ctr, &jobs[1], Plain, Output2, 256U, JobCallback) == STM32_UTILS_AES_SCHED_OK,
+        "CTR job 1");
+  CHECK(STM32_UTILS_AES_SCHED_Submit(&gcm_session, &jobs[2], GcmPlain, gcm_output, 48U, JobCallback)
+        == STM32_UTILS_AES_SCHED_OK, "GCM job 1");
+  CHECK(STM32_UTILS_AES_SCHED_Submit(&cbc, &jobs[3], &Plain[256], &Output[256], DATA_SIZE - 256U, JobCallback)
+        == STM32_UTILS_AES_SCHED_OK, "CBC job 2");
+  CHECK(STM32_UTILS_AES_SCHED_Submit(&ctr, &jobs[4], &Plain[256], &Output2[256], DATA_SIZE - 256U, JobCallback)
+        == STM32_UTILS_AES_SCHED_OK, "CTR job 2");
+  CHECK(STM32_UTILS_AES_SCHED_Submit(&gcm_session, &jobs[5], &GcmPlain[48], &gcm_output[48], GCM_SIZE - 48U,
+                                     JobCallback) == STM32_UTILS_AES_SCHED_OK, "GCM job 2");
+
+  /* Nothing after the partial block until the tag, and the job in progress left as it is */
+  CHECK(STM32_UTILS_AES_SCHED_Submit(&gcm_session, &jobs[0], GcmPlain, gcm_output, 16U, NULL)
+        == STM32_UTILS_AES_SCHED_INVALID_PARAM, "GCM job after the partial block");
+
+  WaitJobs(6U, 1000U);
+  CHECK(JobNbr == 6U, "%u job(s) completed out of 6", (unsigned int)JobNbr);
+  for (uint32_t i = 0U; i < 6U; i++)
+  {
+    CHECK(jobs[i].status == STM32_UTILS_AES_SCHED_OK, "job %u status 0x%08X", (unsigned int)i,
+          (unsigned int)jobs[i].status);
+  }
+  CheckBytes("scheduled CBC", Output, Cipher, DATA_SIZE);
+  CheckBytes("scheduled CTR", Output2, Cipher2, DATA_SIZE);
+  CheckBytes("scheduled GCM", gcm_output, GcmCipher, GCM_SIZE);
+  CHECK(STM32_UTILS_AES_SCHED_GetSwitchCount(&Sched) != 0U, "no context switch");
+  CHECK(STM32_UTILS_AES_SCHED_GetChunkCount(&Sched) >= ((2U * DATA_SIZE) / CHUNK_SIZE), "%u chunk(s)",
+        (unsigned int)STM32_UTILS_AES_SCHED_GetChunkCount(&Sched));
+
+  CHECK(STM32_UTILS_AES_SCHED_GenerateAuthTag(&gcm_session, tag, 10U) == STM32_UTILS_AES_SCHED_OK, "GCM tag");
+  CheckTag("scheduled GCM", tag);
+
+  /* The next message of the session is accepted after the tag */
+  JobNbr = 0U;
+  CHECK(STM32_UTILS_AES_SCHED_Submit(&gcm_session, &jobs[0], GcmPlain, gcm_output, 16U, JobCallback)
+        == STM32_UTILS_AES_SCHED_OK, "GCM job after the tag");
+  CHECK(HOST_TEST_Wait(&JobNbr, 100U) == 1U, "no completion of the next message");
+  CHECK(STM32_UTILS_AES_SCHED_GenerateAuthTag(&gcm_session, tag, 10U) == STM32_UTILS_AES_SCHED_OK,
+        "tag of the next message");
+
+  /* Validations */
+  CHECK(STM32_UTILS_AES_SCHED_Submit(&cbc, &jobs[1], &Plain[1], Output, 16U, NULL)
+        == STM32_UTILS_AES_SCHED_INVALID_PARAM, "misaligned input");
+  CHECK(STM32_UTILS_AES_SCHED_Submit(&cbc, &jobs[1], Plain, &Output[2], 16U, NULL)
+        == STM32_UTILS_AES_SCHED_INVALID_PARAM, "misaligned output");
+  CHECK(STM32_UTILS_AES_SCHED_CloseSession(&cbc) == STM32_UTILS_AES_SCHED_OK, "CBC session close");
+  {
+    const stm32_utils_aes_sched_session_config_t ecb_config =
+    {
+      .algo = STM32_UTILS_AES_SCHED_ALGO_ECB, .dir = STM32_UTILS_AES_SCHED_ENCRYPT,
+      .key_size = HAL_AES_KEY_SIZE_128BIT, .p_key = NistKey, .data_swapping = HAL_AES_DATA_SWAPPING_BYTE
+    };
+
+    CHECK(STM32_UTILS_AES_SCHED_OpenSession(&Sched, &cbc, &ecb_config, 1U) == STM32_UTILS_AES_SCHED_OK,
+          "ECB session");
+    CHECK(STM32_UTILS_AES_SCHED_Submit(&cbc, &jobs[1], ecb_input, Output, 20U, NULL)
+          == STM32_UTILS_AES_SCHED_INVALID_PARAM, "ECB job of a partial block");
+  }
+
+  HOST_MODEL_AES_GetStats(&stats);
+  CHECK(stats.error_nbr == 0U, "%u read or write error(s)", (unsigned int)stats.error_nbr);
+  CHECK(ErrorNbr == 0U, "%u error(s)", (unsigned int)ErrorNbr);
+}
+
+/* Exported functions --------------------------------------------------------*/
+int main(void)
+{
+  for (uint32_t i = 16U; i < DATA_SIZE; i++)
+  {
+    Plain[i] = (uint8_t)((i * 13U) + (i >> 8U));
+  }
+
+  TestKnownAnswers();
+  TestSuspend();
+  TestIdleContext();
+  TestScheduler();
+
+  return HOST_TEST_Report();
+}
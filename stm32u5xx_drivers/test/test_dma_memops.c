@@ -0,0 +1,247 @@
+/**
+  ******************************************************************************
+  * @file    test_dma_memops.c
+  * @brief   Host tests of the DMA memory operations utility on the GPDMA model
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ * The service on GPDMA1 channels 0 and 1, four nodes each, so that a part is four blocks of
+ * STM32_UTILS_DMA_MEMOPS_BLOCK_MAX_BYTE bytes, or four rows:
+ * - ordering: requests on one channel complete in submission order, with their data;
+ * - fairness: a small copy and a 2D copy submitted after a large copy complete before it, two large copies on one
+ *   channel share it part by part;
+ * - CPU fallback: the requests below the threshold complete before the submission returns, counted apart from the
+ *   DMA ones;
+ * - threshold: a 2D request of more than 4 GB is not taken for a small one.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#define _POSIX_C_SOURCE 200809L
+#include <string.h>
+
+#include "host_model.h"
+#include "host_test.h"
+#include "stm32_hal.h"
+#include "stm32_utils_dma_memops.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define CHANNEL_NBR       2U
+#define NODE_NBR          4U
+#define PART_SIZE         (NODE_NBR * STM32_UTILS_DMA_MEMOPS_BLOCK_MAX_BYTE)
+#define LARGE_SIZE        (4U * PART_SIZE)
+#define SMALL_SIZE        1024U
+#define ORDER_REQ_NBR     8U
+#define ORDER_REQ_SIZE    256U
+#define ROW_SIZE          64U
+#define ROW_NBR           NODE_NBR
+#define THRESHOLD         64U
+#define REQ_NBR           16U
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t order;                     /*!< Rank of the completion, from 1 */
+  uint64_t cycle;                     /*!< Cycle of the completion        */
+} completion_t;
+
+/* Private variables ---------------------------------------------------------*/
+static stm32_utils_dma_memops_t Ops;
+static stm32_utils_dma_memops_chan_t Channels[CHANNEL_NBR];
+static hal_dma_handle_t hDma[CHANNEL_NBR];
+static hal_dma_node_t Nodes[CHANNEL_NBR][NODE_NBR];
+static stm32_utils_dma_memops_req_t Reqs[REQ_NBR];
+static completion_t Completions[REQ_NBR];
+static volatile uint32_t CompletionNbr;
+static uint8_t Src[LARGE_SIZE] __attribute__((aligned(4)));
+static uint8_t DestA[LARGE_SIZE] __attribute__((aligned(4)));
+static uint8_t DestB[LARGE_SIZE] __attribute__((aligned(4)));
+static uint8_t DestSmall[SMALL_SIZE] __attribute__((aligned(4)));
+
+/* Handlers and callbacks ----------------------------------------------------*/
+void GPDMA1_Channel0_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&hDma[0]);
+}
+
+void GPDMA1_Channel1_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&hDma[1]);
+}
+
+static void Completed(stm32_utils_dma_memops_req_t *p_req)
+{
+  const uint32_t i = (uint32_t)(p_req - Reqs);
+
+  CompletionNbr++;
+  Completions[i].order = CompletionNbr;
+  Completions[i].cycle = HOST_MODEL_GetCycles();
+}
+
+/* Private functions ---------------------------------------------------------*/
+static uint32_t WaitCompletions(uint32_t completion_nbr, uint32_t timeout_ms)
+{
+  const uint32_t tickstart = HAL_GetTick();
+
+  while ((CompletionNbr < completion_nbr) && ((HAL_GetTick() - tickstart) < timeout_ms))
+  {
+  }
+  return CompletionNbr;
+}
+
+static void Start(uint32_t channel_nbr, uint32_t threshold)
+{
+  hal_dma_node_config_t node_config;
+
+  HOST_TEST_Init();
+  (void)memset(&node_config, 0, sizeof(node_config));
+  node_config.xfer.priority = HAL_DMA_PRIORITY_LOW_WEIGHT_HIGH;
+  node_config.src_burst_length_byte = 4U;
+  node_config.dest_burst_length_byte = 4U;
+  CHECK(STM32_UTILS_DMA_MEMOPS_Init(&Ops, &node_config, threshold) == STM32_UTILS_DMA_MEMOPS_OK, "init");
+  for (uint32_t i = 0U; i < channel_nbr; i++)
+  {
+    CHECK(HAL_DMA_Init(&hDma[i], (i == 0U) ? HAL_GPDMA1_CH0 : HAL_GPDMA1_CH1) == HAL_OK, "HAL_DMA_Init %u",
+          (unsigned int)i);
+    HAL_CORTEX_NVIC_EnableIRQ((i == 0U) ? GPDMA1_CH0_IRQn : GPDMA1_CH1_IRQn);
+    CHECK(STM32_UTILS_DMA_MEMOPS_AddChannel(&Ops, &Channels[i], &hDma[i], Nodes[i], NODE_NBR)
+          == STM32_UTILS_DMA_MEMOPS_OK, "channel %u", (unsigned int)i);
+  }
+
+  (void)memset(Reqs, 0, sizeof(Reqs));
+  (void)memset(Completions, 0, sizeof(Completions));
+  CompletionNbr = 0U;
+  (void)memset(DestA, 0, sizeof(DestA));
+  (void)memset(DestB, 0, sizeof(DestB));
+  (void)memset(DestSmall, 0, sizeof(DestSmall));
+}
+
+static void CheckCounts(uint32_t dma_count, uint32_t cpu_count)
+{
+  uint32_t dma;
+  uint32_t cpu;
+
+  CHECK(STM32_UTILS_DMA_MEMOPS_GetCompletedCount(&Ops, &dma, &cpu) == STM32_UTILS_DMA_MEMOPS_OK, "counts");
+  CHECK((dma == dma_count) && (cpu == cpu_count), "%u by DMA and %u by the CPU instead of %u and %u",
+        (unsigned int)dma, (unsigned int)cpu, (unsigned int)dma_count, (unsigned int)cpu_count);
+}
+
+static void TestOrder(void)
+{
+  Start(1U, THRESHOLD);
+  for (uint32_t i = 0U; i < ORDER_REQ_NBR; i++)
+  {
+    CHECK(STM32_UTILS_DMA_MEMOPS_Memcpy(&Ops, &Reqs[i], &DestA[i * ORDER_REQ_SIZE], &Src[i * ORDER_REQ_SIZE],
+                                        ORDER_REQ_SIZE, Completed) == STM32_UTILS_DMA_MEMOPS_OK, "request %u",
+          (unsigned int)i);
+  }
+  CHECK(STM32_UTILS_DMA_MEMOPS_GetCount(&Ops) == (ORDER_REQ_NBR - 1U), "%u request(s) waiting",
+        (unsigned int)STM32_UTILS_DMA_MEMOPS_GetCount(&Ops));
+  CHECK(WaitCompletions(ORDER_REQ_NBR, 100U) == ORDER_REQ_NBR, "%u request(s) completed",
+        (unsigned int)CompletionNbr);
+  for (uint32_t i = 0U; i < ORDER_REQ_NBR; i++)
+  {
+    CHECK(Completions[i].order == (i + 1U), "request %u completed at rank %u", (unsigned int)i,
+          (unsigned int)Completions[i].order);
+  }
+  CHECK(memcmp(DestA, Src, ORDER_REQ_NBR * ORDER_REQ_SIZE) == 0, "data");
+  CheckCounts(ORDER_REQ_NBR, 0U);
+}
+
+static void TestFairness(void)
+{
+  uint64_t submitted;
+  uint64_t a;
+  uint64_t b;
+
+  /* The large copy takes both channels, the small copy and the 2D copy take the next free channels before its
+     third part */
+  Start(CHANNEL_NBR, THRESHOLD);
+  (void)STM32_UTILS_DMA_MEMOPS_Memcpy(&Ops, &Reqs[0], DestA, Src, LARGE_SIZE, Completed);
+  (void)STM32_UTILS_DMA_MEMOPS_Memcpy(&Ops, &Reqs[1], DestSmall, Src, SMALL_SIZE, Completed);
+  (void)STM32_UTILS_DMA_MEMOPS_Memcpy2D(&Ops, &Reqs[2], DestB, 2U * ROW_SIZE, Src, 3U * ROW_SIZE, ROW_SIZE, ROW_NBR,
+                                        Completed);
+  CHECK(WaitCompletions(3U, 1000U) == 3U, "%u request(s) completed", (unsigned int)CompletionNbr);
+  CHECK((Completions[1].order == 1U) && (Completions[2].order == 2U) && (Completions[0].order == 3U),
+        "small, 2D and large copies completed at ranks %u, %u and %u", (unsigned int)Completions[1].order,
+        (unsigned int)Completions[2].order, (unsigned int)Completions[0].order);
+  CHECK(memcmp(DestA, Src, LARGE_SIZE) == 0, "data of the large copy");
+  CHECK(memcmp(DestSmall, Src, SMALL_SIZE) == 0, "data of the small copy");
+  for (uint32_t row = 0U; row < ROW_NBR; row++)
+  {
+    CHECK(memcmp(&DestB[row * 2U * ROW_SIZE], &Src[row * 3U * ROW_SIZE], ROW_SIZE) == 0, "row %u", (unsigned int)row);
+    CHECK(DestB[(row * 2U * ROW_SIZE) + ROW_SIZE] == 0U, "after the row %u", (unsigned int)row);
+  }
+  CheckCounts(3U, 0U);
+
+  /* Two large copies on one channel: parts A, A, B, A, B, A, B, B */
+  Start(1U, THRESHOLD);
+  (void)STM32_UTILS_DMA_MEMOPS_Memcpy(&Ops, &Reqs[0], DestA, Src, LARGE_SIZE, Completed);
+  (void)STM32_UTILS_DMA_MEMOPS_Memcpy(&Ops, &Reqs[1], DestB, Src, LARGE_SIZE, Completed);
+  submitted = HOST_MODEL_GetCycles();
+  CHECK(WaitCompletions(2U, 1000U) == 2U, "%u request(s) completed", (unsigned int)CompletionNbr);
+  a = Completions[0].cycle - submitted;
+  b = Completions[1].cycle - submitted;
+  /* A after 6 parts of 8, its first two started before B was queued, instead of 4 if it held the channel */
+  CHECK((Completions[0].order == 1U) && ((a * 8U) >= (b * 5U)), "A completed after %llu cycles, B after %llu",
+        (unsigned long long)a, (unsigned long long)b);
+  CHECK((memcmp(DestA, Src, LARGE_SIZE) == 0) && (memcmp(DestB, Src, LARGE_SIZE) == 0), "data");
+}
+
+static void TestCpuFallback(void)
+{
+  Start(CHANNEL_NBR, THRESHOLD);
+  CHECK(STM32_UTILS_DMA_MEMOPS_Memcpy(&Ops, &Reqs[0], DestSmall, Src, THRESHOLD - 1U, Completed)
+        == STM32_UTILS_DMA_MEMOPS_OK, "small copy");
+  CHECK((CompletionNbr == 1U) && (Reqs[0].status == STM32_UTILS_DMA_MEMOPS_OK), "small copy not done at once");
+  CHECK(STM32_UTILS_DMA_MEMOPS_Memset(&Ops, &Reqs[1], &DestSmall[THRESHOLD], 0xA5U, 16U, Completed)
+        == STM32_UTILS_DMA_MEMOPS_OK, "small fill");
+  CHECK(CompletionNbr == 2U, "small fill not done at once");
+  CHECK(memcmp(DestSmall, Src, THRESHOLD - 1U) == 0, "data of the small copy");
+  CHECK((DestSmall[THRESHOLD] == 0xA5U) && (DestSmall[THRESHOLD + 15U] == 0xA5U), "data of the small fill");
+
+  /* At the threshold: by DMA */
+  CHECK(STM32_UTILS_DMA_MEMOPS_Memset(&Ops, &Reqs[2], DestA, 0x5AU, THRESHOLD, Completed)
+        == STM32_UTILS_DMA_MEMOPS_OK, "fill");
+  CHECK(Reqs[2].status == STM32_UTILS_DMA_MEMOPS_BUSY, "fill at the threshold done by the CPU");
+  CHECK(WaitCompletions(3U, 100U) == 3U, "fill not completed");
+  CHECK((DestA[0] == 0x5AU) && (DestA[THRESHOLD - 1U] == 0x5AU) && (DestA[THRESHOLD] == 0U), "data of the fill");
+  CheckCounts(1U, 2U);
+}
+
+/* Last test: the request is left on the channels */
+static void TestThresholdOverflow(void)
+{
+  /* 65535 bytes * 65538 rows = 0x1_0000_FFFE bytes, 0xFFFE on 32 bits */
+  Start(CHANNEL_NBR, 0x10000U);
+  CHECK(STM32_UTILS_DMA_MEMOPS_Memcpy2D(&Ops, &Reqs[0], DestA, 0U, Src, 0U, 0xFFFFU, 0x10002U, Completed)
+        == STM32_UTILS_DMA_MEMOPS_OK, "2D copy");
+  CHECK(Reqs[0].status == STM32_UTILS_DMA_MEMOPS_BUSY, "2D copy of 4 GB executed by the CPU");
+  CheckCounts(0U, 0U);
+}
+
+/* Exported functions --------------------------------------------------------*/
+int main(void)
+{
+  for (uint32_t i = 0U; i < LARGE_SIZE; i++)
+  {
+    Src[i] = (uint8_t)((i * 7U) + (i >> 8U) + 1U);
+  }
+
+  TestOrder();
+  TestFairness();
+  TestCpuFallback();
+  TestThresholdOverflow();
+
+  return HOST_TEST_Report();
+}
@@ -0,0 +1,332 @@
+/**
+  ******************************************************************************
+  * @file    test_hal_crc.c
+  * @brief   Host tests of the HAL CRC driver on the CRC model
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ * The check values of the usual CRCs on "123456789", computed by HAL_CRC_Calculate() on the model, then random
+ * buffers of every valid length up to 64 bytes and at every alignment, compared with the software CRC utility
+ * (utils/crc_sw) for each polynomial size and input reverse mode.
+ * DMA calculation of a buffer of more than two 64-Kbyte blocks with 8, 16 and 32-bit accesses, and its accumulation
+ * in two parts: the CRC of the software utility (the byte and half-word exchanges of the channel feed the bytes in
+ * memory order), the data register writes of the DMA width, the last bytes written by the CPU, and one block
+ * transfer, so one channel interrupt, per 0xFFFF bytes rounded down to the width.
+ * DMA calculation with the byte, half-word and word input reversals at each DMA width they allow: the CRC of the
+ * software utility with the same reversal, the last bytes not filling a DMA access fed by the CPU, and the widths
+ * splitting the reversal unit refused with HAL_ERROR before any data is fed.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#define _POSIX_C_SOURCE 200809L
+#include <stdlib.h>
+#include <string.h>
+
+#include "host_model.h"
+#include "host_test.h"
+#include "stm32_hal.h"
+#include "stm32_utils_crc_sw.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define RANDOM_MAX    64U
+#define DMA_SIZE      140003U     /*!< More than two blocks, with 1, 2 or 3 bytes left after the last DMA access */
+#define BLOCK_MAX     0xFFFFU     /*!< Largest DMA block of the driver, rounded down to the width */
+#define REVERSE_SIZE  1003U       /*!< 1 and 3 bytes left after the last 2 and 4-byte DMA accesses */
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+  const char *p_name;
+  hal_crc_config_t config;
+  uint32_t check;                      /*!< CRC of "123456789", before the final XOR of the standard */
+} crc_check_t;
+
+/* Private variables ---------------------------------------------------------*/
+static hal_crc_handle_t hCrc;
+static stm32_utils_crc_sw_t CrcSw;
+static uint8_t Buffer[RANDOM_MAX + 4U];
+static hal_dma_handle_t hDma;
+static uint32_t DmaData[(DMA_SIZE + 3U) / 4U];
+static volatile uint32_t CpltNbr;
+static volatile uint32_t ErrorNbr;
+
+static const crc_check_t Checks[] =
+{
+  {"CRC-32/MPEG-2", {0x04C11DB7U, HAL_CRC_POLY_SIZE_32B, 0xFFFFFFFFU, HAL_CRC_INDATA_REVERSE_NONE,
+                     HAL_CRC_OUTDATA_REVERSE_NONE}, 0x0376E6E7U},
+  {"CRC-32", {0x04C11DB7U, HAL_CRC_POLY_SIZE_32B, 0xFFFFFFFFU, HAL_CRC_INDATA_REVERSE_BYTE,
+              HAL_CRC_OUTDATA_REVERSE_BIT}, ~0xCBF43926U},
+  {"CRC-16/IBM-3740", {0x1021U, HAL_CRC_POLY_SIZE_16B, 0xFFFFU, HAL_CRC_INDATA_REVERSE_NONE,
+                       HAL_CRC_OUTDATA_REVERSE_NONE}, 0x29B1U},
+  {"CRC-16/ARC", {0x8005U, HAL_CRC_POLY_SIZE_16B, 0x0000U, HAL_CRC_INDATA_REVERSE_BYTE,
+                  HAL_CRC_OUTDATA_REVERSE_BIT}, 0xBB3DU},
+  {"CRC-8/SMBUS", {0x07U, HAL_CRC_POLY_SIZE_8B, 0x00U, HAL_CRC_INDATA_REVERSE_NONE,
+                   HAL_CRC_OUTDATA_REVERSE_NONE}, 0xF4U},
+  {"CRC-7/MMC", {0x09U, HAL_CRC_POLY_SIZE_7B, 0x00U, HAL_CRC_INDATA_REVERSE_NONE,
+                 HAL_CRC_OUTDATA_REVERSE_NONE}, 0x75U},
+};
+
+/* Handlers and callbacks ----------------------------------------------------*/
+void GPDMA1_Channel0_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&hDma);
+}
+
+void HAL_CRC_CalculateCpltCallback(hal_crc_handle_t *hcrc)
+{
+  (void)hcrc;
+  CpltNbr++;
+}
+
+void HAL_CRC_ErrorCallback(hal_crc_handle_t *hcrc)
+{
+  (void)hcrc;
+  ErrorNbr++;
+}
+
+/* Private functions ---------------------------------------------------------*/
+/* Model reset, CRC configuration fed by a channel of width_byte accesses */
+static void StartDma(uint32_t width_byte, const hal_crc_config_t *p_config)
+{
+  const hal_dma_src_data_width_t src_width = (width_byte == 4U) ? HAL_DMA_SRC_DATA_WIDTH_WORD :
+                                             ((width_byte == 2U) ? HAL_DMA_SRC_DATA_WIDTH_HALFWORD :
+                                              HAL_DMA_SRC_DATA_WIDTH_BYTE);
+  const hal_dma_dest_data_width_t dest_width = (width_byte == 4U) ? HAL_DMA_DEST_DATA_WIDTH_WORD :
+                                               ((width_byte == 2U) ? HAL_DMA_DEST_DATA_WIDTH_HALFWORD :
+                                                HAL_DMA_DEST_DATA_WIDTH_BYTE);
+  const hal_dma_direct_xfer_config_t config =
+  {
+    HAL_DMA_REQUEST_SW, HAL_DMA_DIRECTION_MEMORY_TO_MEMORY, HAL_DMA_SRC_ADDR_INCREMENTED, HAL_DMA_DEST_ADDR_FIXED,
+    src_width, dest_width, HAL_DMA_PRIORITY_LOW_WEIGHT_HIGH
+  };
+
+  HOST_TEST_Init();
+  CHECK(HAL_CRC_Init(&hCrc, HAL_CRC) == HAL_OK, "HAL_CRC_Init");
+  CHECK(HAL_CRC_SetConfig(&hCrc, p_config) == HAL_OK, "configuration");
+  (void)STM32_UTILS_CRC_SW_Init(&CrcSw, p_config);
+  CHECK(HAL_DMA_Init(&hDma, HAL_GPDMA1_CH0) == HAL_OK, "HAL_DMA_Init");
+  CHECK(HAL_DMA_SetConfigDirectXfer(&hDma, &config) == HAL_OK, "DMA configuration");
+  CHECK(HAL_CRC_SetDMA(&hCrc, &hDma) == HAL_OK, "HAL_CRC_SetDMA");
+  HAL_CORTEX_NVIC_EnableIRQ(GPDMA1_CH0_IRQn);
+  CpltNbr = 0U;
+  ErrorNbr = 0U;
+}
+
+/* Blocks of the DMA for size_byte: the driver splits at 0xFFFF bytes rounded down to the width */
+static uint32_t BlockNbr(uint32_t size_byte, uint32_t width_byte)
+{
+  const uint32_t dma_byte = size_byte & ~(width_byte - 1U);
+  const uint32_t block_max = BLOCK_MAX & ~(width_byte - 1U);
+
+  return (dma_byte + block_max - 1U) / block_max;
+}
+
+static void TestCheckValues(void)
+{
+  static const char digits[] = "123456789";
+
+  for (uint32_t i = 0U; i < (sizeof(Checks) / sizeof(Checks[0])); i++)
+  {
+    uint32_t crc = 0U;
+
+    CHECK(HAL_CRC_SetConfig(&hCrc, &Checks[i].config) == HAL_OK, "%s: configuration", Checks[i].p_name);
+    CHECK(HAL_CRC_Calculate(&hCrc, digits, 9U, &crc) == HAL_OK, "%s: calculation", Checks[i].p_name);
+    CHECK(crc == Checks[i].check, "%s: 0x%08X instead of 0x%08X", Checks[i].p_name, (unsigned int)crc,
+          (unsigned int)Checks[i].check);
+  }
+}
+
+static void TestRandom(void)
+{
+  static const hal_crc_input_data_reverse_mode_t reverse[] =
+  {
+    HAL_CRC_INDATA_REVERSE_NONE, HAL_CRC_INDATA_REVERSE_BYTE, HAL_CRC_INDATA_REVERSE_HALFWORD,
+    HAL_CRC_INDATA_REVERSE_WORD
+  };
+  /* The size is a multiple of the reverse unit */
+  static const uint32_t unit[] = {1U, 1U, 2U, 4U};
+
+  srand(45);
+  for (uint32_t i = 0U; i < (sizeof(Checks) / sizeof(Checks[0])); i++)
+  {
+    for (uint32_t r = 0U; r < (sizeof(reverse) / sizeof(reverse[0])); r++)
+    {
+      hal_crc_config_t config = Checks[i].config;
+
+      config.input_data_reverse_mode = reverse[r];
+      (void)HAL_CRC_SetConfig(&hCrc, &config);
+      (void)STM32_UTILS_CRC_SW_Init(&CrcSw, &config);
+      for (uint32_t size = unit[r]; size <= RANDOM_MAX; size += unit[r])
+      {
+        const uint32_t offset = (size / unit[r]) % 4U;
+        uint32_t hw = 0U;
+        uint32_t sw = 0U;
+
+        for (uint32_t j = 0U; j < sizeof(Buffer); j++)
+        {
+          Buffer[j] = (uint8_t)rand();
+        }
+        (void)HAL_CRC_Calculate(&hCrc, &Buffer[offset], size, &hw);
+        (void)STM32_UTILS_CRC_SW_Calculate(&CrcSw, &Buffer[offset], size, &sw);
+        CHECK(hw == sw, "%s, reverse %u, %u bytes at +%u: 0x%08X instead of 0x%08X", Checks[i].p_name,
+              (unsigned int)r, (unsigned int)size, (unsigned int)offset, (unsigned int)hw, (unsigned int)sw);
+      }
+    }
+  }
+}
+
+/* CRC-32/MPEG-2: no reversal, so the byte order matters */
+static void TestDma(void)
+{
+  static const uint32_t widths[] = {1U, 2U, 4U};
+  const uint8_t *const p_data = (const uint8_t *)DmaData;
+  const uint32_t half = ((DMA_SIZE / 2U) + 3U) & ~3U;
+
+  for (uint32_t i = 0U; i < sizeof(DmaData); i++)
+  {
+    ((uint8_t *)DmaData)[i] = (uint8_t)((i * 13U) + (i >> 9U));
+  }
+
+  for (uint32_t w = 0U; w < (sizeof(widths) / sizeof(widths[0])); w++)
+  {
+    const uint32_t width = widths[w];
+    const uint32_t tail = DMA_SIZE & (width - 1U);
+    host_model_crc_stats_t stats;
+    uint32_t hw = 0U;
+    uint32_t sw = 0U;
+
+    StartDma(width, &Checks[0].config);
+    (void)STM32_UTILS_CRC_SW_Calculate(&CrcSw, p_data, DMA_SIZE, &sw);
+    CHECK(HAL_CRC_Calculate_DMA(&hCrc, p_data, DMA_SIZE, &hw) == HAL_OK, "%u-byte DMA calculation",
+          (unsigned int)width);
+    CHECK(HOST_TEST_Wait(&CpltNbr, 1000U) == 1U, "%u-byte DMA calculation: no completion", (unsigned int)width);
+    CHECK(ErrorNbr == 0U, "%u error(s)", (unsigned int)ErrorNbr);
+    CHECK(hw == sw, "%u-byte DMA calculation: 0x%08X instead of 0x%08X", (unsigned int)width, (unsigned int)hw,
+          (unsigned int)sw);
+
+    /* One data register write per DMA access, the last bytes by the CPU in smaller writes */
+    HOST_MODEL_CRC_GetStats(&stats);
+    CHECK(stats.byte_nbr == DMA_SIZE, "%u bytes fed", (unsigned int)stats.byte_nbr);
+    CHECK(stats.write_nbr[w] == (DMA_SIZE / width), "%u-byte DMA calculation: %u writes of %u bytes",
+          (unsigned int)width, (unsigned int)stats.write_nbr[w], (unsigned int)width);
+    CHECK((stats.write_nbr[0] + (2U * stats.write_nbr[1]) + (4U * stats.write_nbr[2])) == DMA_SIZE,
+          "%u-byte DMA calculation: %u, %u and %u writes", (unsigned int)width, (unsigned int)stats.write_nbr[0],
+          (unsigned int)stats.write_nbr[1], (unsigned int)stats.write_nbr[2]);
+    CHECK((tail == 0U) || (stats.write_nbr[(tail == 1U) ? 0U : 1U] != 0U), "%u last byte(s) not written",
+          (unsigned int)tail);
+    CHECK(HOST_MODEL_GetIrqCount(GPDMA1_CH0_IRQn) == BlockNbr(DMA_SIZE, width),
+          "%u-byte DMA calculation: %u block(s) instead of %u", (unsigned int)width,
+          (unsigned int)HOST_MODEL_GetIrqCount(GPDMA1_CH0_IRQn), (unsigned int)BlockNbr(DMA_SIZE, width));
+
+    /* The same CRC in two parts, the second one accumulated from the first */
+    StartDma(width, &Checks[0].config);
+    CHECK(HAL_CRC_Calculate_DMA(&hCrc, p_data, half, &hw) == HAL_OK, "%u-byte DMA calculation",
+          (unsigned int)width);
+    CHECK(HOST_TEST_Wait(&CpltNbr, 1000U) == 1U, "%u-byte DMA calculation: no completion", (unsigned int)width);
+    CpltNbr = 0U;
+    CHECK(HAL_CRC_Accumulate_DMA(&hCrc, &p_data[half], DMA_SIZE - half, &hw) == HAL_OK,
+          "%u-byte DMA accumulation", (unsigned int)width);
+    CHECK(HOST_TEST_Wait(&CpltNbr, 1000U) == 1U, "%u-byte DMA accumulation: no completion", (unsigned int)width);
+    CHECK(hw == sw, "%u-byte DMA accumulation: 0x%08X instead of 0x%08X", (unsigned int)width, (unsigned int)hw,
+          (unsigned int)sw);
+    CHECK(HOST_MODEL_GetIrqCount(GPDMA1_CH0_IRQn) == (BlockNbr(half, width) + BlockNbr(DMA_SIZE - half, width)),
+          "%u-byte DMA accumulation: %u block(s)", (unsigned int)width,
+          (unsigned int)HOST_MODEL_GetIrqCount(GPDMA1_CH0_IRQn));
+  }
+}
+
+static void TestDmaReverse(void)
+{
+  static const struct
+  {
+    hal_crc_input_data_reverse_mode_t reverse;
+    uint32_t width_byte;
+    hal_status_t status;
+  } cases[] =
+  {
+    {HAL_CRC_INDATA_REVERSE_BYTE, 1U, HAL_OK},
+    {HAL_CRC_INDATA_REVERSE_BYTE, 2U, HAL_OK},
+    {HAL_CRC_INDATA_REVERSE_BYTE, 4U, HAL_OK},
+    {HAL_CRC_INDATA_REVERSE_HALFWORD, 1U, HAL_ERROR},
+    {HAL_CRC_INDATA_REVERSE_HALFWORD, 2U, HAL_OK},
+    {HAL_CRC_INDATA_REVERSE_HALFWORD, 4U, HAL_OK},
+    {HAL_CRC_INDATA_REVERSE_WORD, 1U, HAL_ERROR},
+    {HAL_CRC_INDATA_REVERSE_WORD, 2U, HAL_ERROR},
+    {HAL_CRC_INDATA_REVERSE_WORD, 4U, HAL_OK},
+  };
+  /* The size is a multiple of the reverse unit */
+  static const uint32_t unit[] = {1U, 1U, 2U, 4U};
+  const uint8_t *const p_data = (const uint8_t *)DmaData;
+
+  for (uint32_t c = 0U; c < (sizeof(cases) / sizeof(cases[0])); c++)
+  {
+    const uint32_t r = (cases[c].reverse == HAL_CRC_INDATA_REVERSE_BYTE) ? 1U :
+                       ((cases[c].reverse == HAL_CRC_INDATA_REVERSE_HALFWORD) ? 2U : 3U);
+    const uint32_t width = cases[c].width_byte;
+    const uint32_t size = REVERSE_SIZE & ~(unit[r] - 1U);
+    const uint32_t tail = size & (width - 1U);
+    hal_crc_config_t config = Checks[0].config;
+    host_model_crc_stats_t stats;
+    uint32_t hw = 0U;
+    uint32_t sw = 0U;
+
+    config.input_data_reverse_mode = cases[c].reverse;
+    StartDma(width, &config);
+    (void)STM32_UTILS_CRC_SW_Calculate(&CrcSw, p_data, size, &sw);
+    CHECK(HAL_CRC_Calculate_DMA(&hCrc, p_data, size, &hw) == cases[c].status,
+          "reverse %u, %u-byte DMA calculation: unexpected status", (unsigned int)r, (unsigned int)width);
+    HOST_MODEL_CRC_GetStats(&stats);
+
+    if (cases[c].status != HAL_OK)
+    {
+      CHECK(stats.byte_nbr == 0U, "reverse %u, %u-byte DMA refused: %u bytes fed", (unsigned int)r,
+            (unsigned int)width, (unsigned int)stats.byte_nbr);
+      CHECK(HAL_CRC_GetState(&hCrc) == HAL_CRC_STATE_IDLE, "reverse %u, %u-byte DMA refused: state %d",
+            (unsigned int)r, (unsigned int)width, (int)HAL_CRC_GetState(&hCrc));
+      CHECK(CpltNbr == 0U, "reverse %u, %u-byte DMA refused: completion", (unsigned int)r, (unsigned int)width);
+      continue;
+    }
+
+    CHECK(HOST_TEST_Wait(&CpltNbr, 1000U) == 1U, "reverse %u, %u-byte DMA calculation: no completion",
+          (unsigned int)r, (unsigned int)width);
+    CHECK(ErrorNbr == 0U, "%u error(s)", (unsigned int)ErrorNbr);
+    CHECK(hw == sw, "reverse %u, %u-byte DMA calculation: 0x%08X instead of 0x%08X", (unsigned int)r,
+          (unsigned int)width, (unsigned int)hw, (unsigned int)sw);
+
+    /* The DMA accesses, then the last bytes by the CPU */
+    HOST_MODEL_CRC_GetStats(&stats);
+    CHECK(stats.byte_nbr == size, "reverse %u, %u-byte DMA calculation: %u bytes fed", (unsigned int)r,
+          (unsigned int)width, (unsigned int)stats.byte_nbr);
+    CHECK(stats.write_nbr[(width == 4U) ? 2U : (width - 1U)] == (size / width),
+          "reverse %u, %u-byte DMA calculation: %u writes of %u bytes", (unsigned int)r, (unsigned int)width,
+          (unsigned int)stats.write_nbr[(width == 4U) ? 2U : (width - 1U)], (unsigned int)width);
+    CHECK((tail == 0U) || (stats.write_nbr[(tail == 1U) ? 0U : 1U] != 0U),
+          "reverse %u, %u-byte DMA calculation: %u last byte(s) not written", (unsigned int)r, (unsigned int)width,
+          (unsigned int)tail);
+  }
+}
+
+/* Exported functions --------------------------------------------------------*/
+int main(void)
+{
+  HOST_TEST_Init();
+  CHECK(HAL_CRC_Init(&hCrc, HAL_CRC) == HAL_OK, "HAL_CRC_Init");
+
+  TestCheckValues();
+  TestRandom();
+  TestDma();
+  TestDmaReverse();
+
+  return HOST_TEST_Report();
+}
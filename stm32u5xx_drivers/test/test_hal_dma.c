@@ -0,0 +1,320 @@
+/**
+  ******************************************************************************
+  * @file    test_hal_dma.c
+  * @brief   Host tests of the HAL DMA driver on the GPDMA model
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ * Memory to memory transfers on GPDMA1:
+ * - direct transfer by words, polled: the data and the single accesses of the channel,
+ * - direct transfer by half-words with interrupts: half and full completion callbacks,
+ * - linked-list transfer of three nodes with interrupts: the data of each node, the nodes loaded in the order of the
+ *   queue by the channel, one completion callback,
+ * - nodes appended to a running linked-list transfer, before and after the channel loaded the tail node with its
+ *   null link: the channel loads each node once and in order, restarted from the appended node in the second case
+ *   with the restart callback and not the completion callback,
+ * - random append and reclaim interleavings: the same, and only the nodes whose data is written are reclaimed.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#define _POSIX_C_SOURCE 200809L
+#include <stdlib.h>
+#include <string.h>
+
+#include "host_model.h"
+#include "host_test.h"
+#include "stm32_hal.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define DATA_SIZE         4096U
+#define NODE_NBR          3U
+#define NODE_SIZE         256U
+#define APPEND_NODE_NBR   8U
+#define APPEND_RUN_NBR    200U
+#define APPEND_DELAY_MAX  600U        /*!< Cycles between two appends, about two nodes */
+
+/* Private variables ---------------------------------------------------------*/
+static hal_dma_handle_t hDma;
+static uint8_t Src[DATA_SIZE] __attribute__((aligned(4)));
+static uint8_t Dest[DATA_SIZE] __attribute__((aligned(4)));
+static hal_dma_node_t Nodes[APPEND_NODE_NBR];
+static hal_q_t Q;
+static hal_q_t FreeQ;
+static host_model_dma_fetch_t Fetches[16];
+static volatile uint32_t HalfCpltNbr;
+static volatile uint32_t CpltNbr;
+static volatile uint32_t RestartNbr;
+static volatile uint32_t ErrorNbr;
+
+/* Handlers and callbacks ----------------------------------------------------*/
+void GPDMA1_Channel0_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&hDma);
+}
+
+void HAL_DMA_XferHalfCpltCallback(hal_dma_handle_t *hdma)
+{
+  (void)hdma;
+  HalfCpltNbr++;
+}
+
+void HAL_DMA_XferCpltCallback(hal_dma_handle_t *hdma)
+{
+  (void)hdma;
+  CpltNbr++;
+}
+
+void HAL_DMA_XferErrorCallback(hal_dma_handle_t *hdma)
+{
+  (void)hdma;
+  ErrorNbr++;
+}
+
+void HAL_DMA_XferRestartCallback(hal_dma_handle_t *hdma)
+{
+  (void)hdma;
+  RestartNbr++;
+}
+
+/* Private functions ---------------------------------------------------------*/
+static hal_dma_direct_xfer_config_t Config(hal_dma_src_data_width_t src_width, hal_dma_dest_data_width_t dest_width)
+{
+  const hal_dma_direct_xfer_config_t config =
+  {
+    HAL_DMA_REQUEST_SW, HAL_DMA_DIRECTION_MEMORY_TO_MEMORY, HAL_DMA_SRC_ADDR_INCREMENTED,
+    HAL_DMA_DEST_ADDR_INCREMENTED, src_width, dest_width, HAL_DMA_PRIORITY_LOW_WEIGHT_HIGH
+  };
+
+  return config;
+}
+
+static void Start(void)
+{
+  HOST_TEST_Init();
+  CHECK(HAL_DMA_Init(&hDma, HAL_GPDMA1_CH0) == HAL_OK, "HAL_DMA_Init");
+  HAL_CORTEX_NVIC_EnableIRQ(GPDMA1_CH0_IRQn);
+  HalfCpltNbr = 0U;
+  CpltNbr = 0U;
+  RestartNbr = 0U;
+  ErrorNbr = 0U;
+  (void)memset(Dest, 0, sizeof(Dest));
+}
+
+/* Node i copies the block i to the block i, queue of the first node_nbr nodes started */
+static void StartAppend(uint32_t node_nbr)
+{
+  const hal_dma_direct_xfer_config_t config = Config(HAL_DMA_SRC_DATA_WIDTH_WORD, HAL_DMA_DEST_DATA_WIDTH_WORD);
+  const hal_dma_linkedlist_xfer_config_t ll_config =
+  {
+    HAL_DMA_PRIORITY_LOW_WEIGHT_HIGH, HAL_DMA_PORT0, HAL_DMA_LINKEDLIST_XFER_EVENT_Q
+  };
+
+  Start();
+  (void)HAL_DMA_SetConfigLinkedListXfer(&hDma, &ll_config);
+  (void)HAL_Q_Init(&Q, &HAL_DMA_LinearAddressing_DescOps);
+  (void)HAL_Q_Init(&FreeQ, &HAL_DMA_LinearAddressing_DescOps);
+  for (uint32_t i = 0U; i < APPEND_NODE_NBR; i++)
+  {
+    (void)HAL_DMA_FillNodeDirectXfer(&Nodes[i], &config, HAL_DMA_NODE_LINEAR_ADDRESSING);
+    (void)HAL_DMA_FillNodeData(&Nodes[i], (uint32_t)&Src[i * NODE_SIZE], (uint32_t)&Dest[i * NODE_SIZE], NODE_SIZE);
+  }
+  for (uint32_t i = 0U; i < node_nbr; i++)
+  {
+    (void)HAL_Q_InsertNode_Tail(&Q, &Nodes[i]);
+  }
+  HOST_MODEL_DMA_SetFetchLog(Fetches, 16U);
+  CHECK(HAL_DMA_StartLinkedListXfer_IT(&hDma, &Q) == HAL_OK, "start");
+}
+
+/* Each of the first node_nbr nodes loaded once and in order, its data written, one completion */
+static uint32_t CheckAppend(uint32_t node_nbr)
+{
+  const uint32_t failures = (uint32_t)Failures;
+  uint32_t fetch_nbr;
+
+  CHECK(HOST_TEST_Wait(&CpltNbr, 10U) == 1U, "no completion");
+  fetch_nbr = HOST_MODEL_DMA_GetFetchNbr();
+  CHECK(ErrorNbr == 0U, "%u error(s)", (unsigned int)ErrorNbr);
+  CHECK(fetch_nbr == node_nbr, "%u node(s) loaded for %u", (unsigned int)fetch_nbr, (unsigned int)node_nbr);
+  for (uint32_t i = 0U; (i < fetch_nbr) && (i < node_nbr); i++)
+  {
+    CHECK(Fetches[i].address == (uint32_t)&Nodes[i], "load %u: node at 0x%08X instead of 0x%08X",
+          (unsigned int)i, (unsigned int)Fetches[i].address, (unsigned int)(uint32_t)&Nodes[i]);
+  }
+  CHECK(memcmp(Dest, Src, node_nbr * NODE_SIZE) == 0, "data of %u nodes", (unsigned int)node_nbr);
+  CHECK(Dest[node_nbr * NODE_SIZE] == 0U, "data after the %u nodes", (unsigned int)node_nbr);
+  HOST_MODEL_DMA_SetFetchLog(NULL, 0U);
+
+  return ((uint32_t)Failures == failures) ? 1U : 0U;
+}
+
+static void TestDirectPolling(void)
+{
+  const hal_dma_direct_xfer_config_t config = Config(HAL_DMA_SRC_DATA_WIDTH_WORD, HAL_DMA_DEST_DATA_WIDTH_WORD);
+  host_model_dma_channel_stats_t channel;
+  host_model_stats_t stats;
+
+  Start();
+  CHECK(HAL_DMA_SetConfigDirectXfer(&hDma, &config) == HAL_OK, "configuration");
+  CHECK(HAL_DMA_StartDirectXfer(&hDma, (uint32_t)Src, (uint32_t)Dest, DATA_SIZE) == HAL_OK, "start");
+  CHECK(HAL_DMA_PollForXfer(&hDma, HAL_DMA_XFER_FULL_COMPLETE, 10U) == HAL_OK, "poll");
+  CHECK(memcmp(Dest, Src, DATA_SIZE) == 0, "data");
+
+  HOST_MODEL_DMA_GetChannelStats(0U, &channel);
+  HOST_MODEL_GetStats(&stats);
+  CHECK(channel.byte_nbr == DATA_SIZE, "%llu bytes written", (unsigned long long)channel.byte_nbr);
+  CHECK(stats.dma_beat_nbr == (2U * DATA_SIZE / 4U), "%llu single accesses for %u words",
+        (unsigned long long)stats.dma_beat_nbr, (unsigned int)(DATA_SIZE / 4U));
+}
+
+static void TestDirectInterrupt(void)
+{
+  const hal_dma_direct_xfer_config_t config = Config(HAL_DMA_SRC_DATA_WIDTH_HALFWORD,
+                                                     HAL_DMA_DEST_DATA_WIDTH_HALFWORD);
+
+  Start();
+  CHECK(HAL_DMA_SetConfigDirectXfer(&hDma, &config) == HAL_OK, "configuration");
+  CHECK(HAL_DMA_StartDirectXfer_IT(&hDma, (uint32_t)Src, (uint32_t)Dest, DATA_SIZE) == HAL_OK, "start");
+  CHECK(HOST_TEST_Wait(&CpltNbr, 10U) == 1U, "no completion");
+  CHECK(HalfCpltNbr == 1U, "%u half completion(s)", (unsigned int)HalfCpltNbr);
+  CHECK(ErrorNbr == 0U, "%u error(s)", (unsigned int)ErrorNbr);
+  CHECK(memcmp(Dest, Src, DATA_SIZE) == 0, "data");
+  CHECK(HAL_DMA_GetState(&hDma) == HAL_DMA_STATE_IDLE, "state %d", (int)HAL_DMA_GetState(&hDma));
+}
+
+static void TestLinkedList(void)
+{
+  const hal_dma_direct_xfer_config_t config = Config(HAL_DMA_SRC_DATA_WIDTH_WORD, HAL_DMA_DEST_DATA_WIDTH_WORD);
+  const hal_dma_linkedlist_xfer_config_t ll_config =
+  {
+    HAL_DMA_PRIORITY_LOW_WEIGHT_HIGH, HAL_DMA_PORT0, HAL_DMA_LINKEDLIST_XFER_EVENT_Q
+  };
+  uint32_t fetch_nbr;
+
+  Start();
+  CHECK(HAL_DMA_SetConfigLinkedListXfer(&hDma, &ll_config) == HAL_OK, "configuration");
+  CHECK(HAL_Q_Init(&Q, &HAL_DMA_LinearAddressing_DescOps) == HAL_OK, "queue");
+  for (uint32_t i = 0U; i < NODE_NBR; i++)
+  {
+    /* Node i copies the block i to the block 2 * i: the order of the nodes shows in the destination */
+    CHECK(HAL_DMA_FillNodeDirectXfer(&Nodes[i], &config, HAL_DMA_NODE_LINEAR_ADDRESSING) == HAL_OK, "node %u",
+          (unsigned int)i);
+    CHECK(HAL_DMA_FillNodeData(&Nodes[i], (uint32_t)&Src[i * NODE_SIZE], (uint32_t)&Dest[2U * i * NODE_SIZE],
+                               NODE_SIZE) == HAL_OK, "node %u data", (unsigned int)i);
+    CHECK(HAL_Q_InsertNode_Tail(&Q, &Nodes[i]) == HAL_OK, "node %u insertion", (unsigned int)i);
+  }
+  HOST_MODEL_DMA_SetFetchLog(Fetches, 16U);
+
+  CHECK(HAL_DMA_StartLinkedListXfer_IT(&hDma, &Q) == HAL_OK, "start");
+  CHECK(HOST_TEST_Wait(&CpltNbr, 10U) == 1U, "no completion");
+  CHECK(ErrorNbr == 0U, "%u error(s)", (unsigned int)ErrorNbr);
+  for (uint32_t i = 0U; i < NODE_NBR; i++)
+  {
+    CHECK(memcmp(&Dest[2U * i * NODE_SIZE], &Src[i * NODE_SIZE], NODE_SIZE) == 0, "data of node %u",
+          (unsigned int)i);
+  }
+
+  /* The HAL writes the address of the head in CLLR: the channel loads every node, in the order of the queue */
+  fetch_nbr = HOST_MODEL_DMA_GetFetchNbr();
+  CHECK(fetch_nbr == NODE_NBR, "%u node(s) loaded by the channel", (unsigned int)fetch_nbr);
+  for (uint32_t i = 0U; (i < fetch_nbr) && (i < NODE_NBR); i++)
+  {
+    CHECK(Fetches[i].address == (uint32_t)&Nodes[i], "load %u: node at 0x%08X instead of 0x%08X",
+          (unsigned int)i, (unsigned int)Fetches[i].address, (unsigned int)(uint32_t)&Nodes[i]);
+  }
+  HOST_MODEL_DMA_SetFetchLog(NULL, 0U);
+}
+
+static void TestAppend(void)
+{
+  /* Appended while the channel runs the head node: its link to the second node is loaded, the second node is
+     linked to the new node before the channel loads it */
+  StartAppend(2U);
+  CHECK(HAL_DMA_AppendNodeWhileRunning(&hDma, &Q, &Nodes[2]) == HAL_OK, "append");
+  (void)CheckAppend(3U);
+  CHECK(RestartNbr == 0U, "%u restart(s) with the node linked in time", (unsigned int)RestartNbr);
+
+  /* Appended once the channel has loaded the head node and its null link: restart from the new node, the
+     completion callback only at the end of the new node */
+  StartAppend(1U);
+  CHECK(HAL_DMA_AppendNodeWhileRunning(&hDma, &Q, &Nodes[1]) == HAL_OK, "append");
+  CHECK(HAL_DMA_AppendNodeWhileRunning(&hDma, &Q, &Nodes[2]) == HAL_OK, "append behind the restart node");
+  (void)CheckAppend(3U);
+  CHECK(RestartNbr == 1U, "%u restart(s) for a node appended after the tail was loaded", (unsigned int)RestartNbr);
+
+  /* Too late: the transfer is over */
+  StartAppend(1U);
+  CHECK(HOST_TEST_Wait(&CpltNbr, 10U) == 1U, "no completion");
+  CHECK(HAL_DMA_AppendNodeWhileRunning(&hDma, &Q, &Nodes[1]) == HAL_ERROR, "append after the completion");
+}
+
+static void TestAppendRandom(void)
+{
+  uint32_t run_failures = 0U;
+  uint32_t restart_nbr = 0U;
+
+  srand(45);
+  for (uint32_t run = 0U; run < APPEND_RUN_NBR; run++)
+  {
+    uint32_t node_nbr = 1U;
+    uint32_t reclaimed_nbr = 0U;
+
+    StartAppend(1U);
+    while (node_nbr < APPEND_NODE_NBR)
+    {
+      HOST_MODEL_Run((uint64_t)((uint32_t)rand() % APPEND_DELAY_MAX));
+      if (HAL_DMA_AppendNodeWhileRunning(&hDma, &Q, &Nodes[node_nbr]) != HAL_OK)
+      {
+        CHECK(CpltNbr == 1U, "run %u: append refused before the completion", (unsigned int)run);
+        break;
+      }
+      node_nbr++;
+
+      /* The reclaimed nodes are the first ones of the queue, with their data written */
+      reclaimed_nbr += HAL_DMA_ReclaimCompletedNodes(&hDma, &Q, &FreeQ);
+      CHECK(memcmp(Dest, Src, reclaimed_nbr * NODE_SIZE) == 0, "run %u: %u node(s) reclaimed before their end",
+            (unsigned int)run, (unsigned int)reclaimed_nbr);
+    }
+    if ((CheckAppend(node_nbr) == 0U) && (run_failures++ == 0U))
+    {
+      (void)printf("run %u: %u node(s) appended, %u restart(s)\n", (unsigned int)run, (unsigned int)node_nbr,
+                   (unsigned int)RestartNbr);
+    }
+    reclaimed_nbr += HAL_DMA_ReclaimCompletedNodes(&hDma, &Q, &FreeQ);
+    CHECK(reclaimed_nbr == node_nbr, "run %u: %u node(s) reclaimed for %u", (unsigned int)run,
+          (unsigned int)reclaimed_nbr, (unsigned int)node_nbr);
+    restart_nbr += RestartNbr;
+  }
+
+  /* Both cases of the race are covered */
+  CHECK((restart_nbr != 0U) && (restart_nbr < (APPEND_RUN_NBR * (APPEND_NODE_NBR - 1U))),
+        "%u restart(s) in %u runs", (unsigned int)restart_nbr, (unsigned int)APPEND_RUN_NBR);
+}
+
+/* Exported functions --------------------------------------------------------*/
+int main(void)
+{
+  for (uint32_t i = 0U; i < DATA_SIZE; i++)
+  {
+    Src[i] = (uint8_t)((i * 31U) + (i >> 8U));
+  }
+
+  TestDirectPolling();
+  TestDirectInterrupt();
+  TestLinkedList();
+  TestAppend();
+  TestAppendRandom();
+
+  return HOST_TEST_Report();
+}
@@ -0,0 +1,482 @@
+/**
+  ******************************************************************************
+  * @file    test_hal_hash.c
+  * @brief   Host tests of the HAL HASH driver on the HASH and GPDMA models
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ * HASH with byte swapping, input on GPDMA1 channel 0 in linked-list mode with NODE_NBR nodes, packing the bytes of
+ * the source into the words of DIN (nodes without packing refused):
+ * - model: SHA-224 and SHA-256 FIPS 180-2 digests and RFC 4231 HMAC-SHA-256 by the polling functions;
+ * - HAL_HASH_UpdateV_DMA(): messages cut in random segments copied at random addresses, fed by several updates then
+ *   HAL_HASH_Finish(), give the digest of HAL_HASH_Compute() on the whole message, with one input callback per
+ *   update, the bytes fed once and a DIN write per word only;
+ * - an update of less than a word: no DMA transfer, callback before returning, the bytes kept for the next one;
+ * - word source width: segments with the word multiple part aligned accepted, a misaligned one refused;
+ * - refused lists: more segments than nodes, empty, too large or NULL segment, nothing fed to the HASH;
+ * - HAL_HASH_HMAC_UpdateV_DMA(): RFC 4231 test cases 2 and 6 (key longer than a block), and random segments against
+ *   HAL_HASH_HMAC_Compute().
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#define _POSIX_C_SOURCE 200809L
+#include <string.h>
+
+#include "host_model.h"
+#include "host_test.h"
+#include "stm32_hal.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define NODE_NBR          6U
+#define MSG_SIZE          4096U
+#define POOL_SIZE         (2U * MSG_SIZE)
+#define SEGMENT_MAX       300U
+#define DIGEST_SIZE       32U
+#define TIMEOUT_MS        100U
+
+/* Private variables ---------------------------------------------------------*/
+static hal_hash_handle_t hHash;
+static hal_dma_handle_t hDmaIn;
+static hal_hash_dma_node_t Nodes[NODE_NBR];
+static uint8_t Msg[MSG_SIZE];
+static uint8_t Pool[POOL_SIZE] __attribute__((aligned(4)));
+static uint8_t Digest[DIGEST_SIZE] __attribute__((aligned(4)));
+static uint8_t Expected[DIGEST_SIZE] __attribute__((aligned(4)));
+static uint32_t PoolUsed;
+static uint32_t Seed;
+static volatile uint32_t InputCplt;
+static volatile uint32_t InputCpltNbr;
+static volatile uint32_t DigestCpltNbr;
+static volatile uint32_t ErrorNbr;
+
+static const uint8_t Sha256Abc[DIGEST_SIZE] =
+{
+  0xBAU, 0x78U, 0x16U, 0xBFU, 0x8FU, 0x01U, 0xCFU, 0xEAU, 0x41U, 0x41U, 0x40U, 0xDEU, 0x5DU, 0xAEU, 0x22U, 0x23U,
+  0xB0U, 0x03U, 0x61U, 0xA3U, 0x96U, 0x17U, 0x7AU, 0x9CU, 0xB4U, 0x10U, 0xFFU, 0x61U, 0xF2U, 0x00U, 0x15U, 0xADU
+};
+static const uint8_t Sha256TwoBlocks[DIGEST_SIZE] =
+{
+  0x24U, 0x8DU, 0x6AU, 0x61U, 0xD2U, 0x06U, 0x38U, 0xB8U, 0xE5U, 0xC0U, 0x26U, 0x93U, 0x0CU, 0x3EU, 0x60U, 0x39U,
+  0xA3U, 0x3CU, 0xE4U, 0x59U, 0x64U, 0xFFU, 0x21U, 0x67U, 0xF6U, 0xECU, 0xEDU, 0xD4U, 0x19U, 0xDBU, 0x06U, 0xC1U
+};
+static const uint8_t Sha224Abc[28] =
+{
+  0x23U, 0x09U, 0x7DU, 0x22U, 0x34U, 0x05U, 0xD8U, 0x22U, 0x86U, 0x42U, 0xA4U, 0x77U, 0xBDU, 0xA2U,
+  0x55U, 0xB3U, 0x2AU, 0xADU, 0xBCU, 0xE4U, 0xBDU, 0xA0U, 0xB3U, 0xF7U, 0xE3U, 0x6CU, 0x9DU, 0xA7U
+};
+static const uint8_t HmacCase2[DIGEST_SIZE] =
+{
+  0x5BU, 0xDCU, 0xC1U, 0x46U, 0xBFU, 0x60U, 0x75U, 0x4EU, 0x6AU, 0x04U, 0x24U, 0x26U, 0x08U, 0x95U, 0x75U, 0xC7U,
+  0x5AU, 0x00U, 0x3FU, 0x08U, 0x9DU, 0x27U, 0x39U, 0x83U, 0x9DU, 0xECU, 0x58U, 0xB9U, 0x64U, 0xECU, 0x38U, 0x43U
+};
+static const uint8_t HmacCase6[DIGEST_SIZE] =
+{
+  0x60U, 0xE4U, 0x31U, 0x59U, 0x1EU, 0xE0U, 0xB6U, 0x7FU, 0x0DU, 0x8AU, 0x26U, 0xAAU, 0xCBU, 0xF5U, 0xB7U, 0x7FU,
+  0x8EU, 0x0BU, 0xC6U, 0x21U, 0x37U, 0x28U, 0xC5U, 0x14U, 0x05U, 0x46U, 0x04U, 0x0FU, 0x0EU, 0xE3U, 0x7FU, 0x54U
+};
+
+/* Handlers and callbacks ----------------------------------------------------*/
+void GPDMA1_Channel0_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&hDmaIn);
+}
+
+void HAL_HASH_InputCpltCallback(hal_hash_handle_t *hhash)
+{
+  (void)hhash;
+  InputCpltNbr++;
+  InputCplt = 1U;
+}
+
+void HAL_HASH_DigestCpltCallback(hal_hash_handle_t *hhash)
+{
+  (void)hhash;
+  DigestCpltNbr++;
+}
+
+void HAL_HASH_ErrorCallback(hal_hash_handle_t *hhash)
+{
+  (void)hhash;
+  ErrorNbr++;
+}
+
+/* Private functions ---------------------------------------------------------*/
+static uint32_t Random(uint32_t range)
+{
+  Seed = (Seed * 1103515245U) + 12345U;
+  return (Seed >> 8U) % range;
+}
+
+static void Start(hal_hash_algo_t algorithm, hal_dma_src_data_width_t src_width)
+{
+  const hal_dma_linkedlist_xfer_config_t ll_config =
+  {
+    HAL_DMA_PRIORITY_LOW_WEIGHT_HIGH, HAL_DMA_PORT0, HAL_DMA_LINKEDLIST_XFER_EVENT_Q
+  };
+  const hal_hash_config_t config = {HAL_HASH_DATA_SWAP_BYTE, algorithm};
+  hal_dma_node_config_t node_config;
+
+  HOST_TEST_Init();
+  CHECK(HAL_HASH_Init(&hHash, HAL_HASH) == HAL_OK, "HAL_HASH_Init");
+  CHECK(HAL_HASH_SetConfig(&hHash, &config) == HAL_OK, "HAL_HASH_SetConfig");
+
+  CHECK(HAL_DMA_Init(&hDmaIn, HAL_GPDMA1_CH0) == HAL_OK, "HAL_DMA_Init");
+  CHECK(HAL_DMA_SetConfigLinkedListXfer(&hDmaIn, &ll_config) == HAL_OK, "DMA linked-list configuration");
+  (void)memset(&node_config, 0, sizeof(node_config));
+  node_config.xfer.request = HAL_GPDMA1_REQUEST_HASH_IN;
+  node_config.xfer.direction = HAL_DMA_DIRECTION_MEMORY_TO_PERIPH;
+  node_config.xfer.src_inc = HAL_DMA_SRC_ADDR_INCREMENTED;
+  node_config.xfer.dest_inc = HAL_DMA_DEST_ADDR_FIXED;
+  node_config.xfer.src_data_width = src_width;
+  node_config.xfer.dest_data_width = HAL_DMA_DEST_DATA_WIDTH_WORD;
+  node_config.xfer.priority = HAL_DMA_PRIORITY_LOW_WEIGHT_HIGH;
+  node_config.src_burst_length_byte = 4U;
+  node_config.dest_burst_length_byte = 4U;
+  CHECK(HAL_HASH_SetInDMA(&hHash, &hDmaIn) == HAL_OK, "HAL_HASH_SetInDMA");
+  if (src_width != HAL_DMA_SRC_DATA_WIDTH_WORD)
+  {
+    /* Without packing, each byte would be padded into a word of DIN */
+    CHECK(HAL_HASH_SetInDMANodes(&hHash, Nodes, NODE_NBR, &node_config) == HAL_ERROR, "nodes without packing");
+    node_config.data_handling.pack = HAL_DMA_DEST_DATA_PACKED_UNPACKED;
+  }
+  CHECK(HAL_HASH_SetInDMANodes(&hHash, Nodes, NODE_NBR, &node_config) == HAL_OK, "HAL_HASH_SetInDMANodes");
+  HAL_CORTEX_NVIC_EnableIRQ(GPDMA1_CH0_IRQn);
+
+  InputCplt = 0U;
+  InputCpltNbr = 0U;
+  DigestCpltNbr = 0U;
+  ErrorNbr = 0U;
+  PoolUsed = 0U;
+}
+
+/* Copy of size bytes of the message in the pool, at an address such that addr % 4 = align % 4 */
+static const uint8_t *Place(uint32_t offset, uint32_t size, uint32_t align)
+{
+  uint8_t *p_seg;
+
+  PoolUsed = (PoolUsed + 4U) & ~3U;
+  PoolUsed += align % 4U;
+  if ((PoolUsed + size) > POOL_SIZE)
+  {
+    PoolUsed = align % 4U;
+  }
+  p_seg = &Pool[PoolUsed];
+  (void)memcpy(p_seg, &Msg[offset], size);
+  PoolUsed += size;
+  return p_seg;
+}
+
+static void CheckDigest(const uint8_t *p_digest, const uint8_t *p_expected, uint32_t size, const char *p_name)
+{
+  for (uint32_t i = 0U; i < size; i++)
+  {
+    if (p_digest[i] != p_expected[i])
+    {
+      CHECK(0, "%s: digest byte %u 0x%02X instead of 0x%02X", p_name, (unsigned int)i, (unsigned int)p_digest[i],
+            (unsigned int)p_expected[i]);
+      break;
+    }
+  }
+}
+
+/* Feed size bytes of the message from offset with UpdateV updates of up to NODE_NBR random segments */
+static void FeedV(uint32_t offset, uint32_t size, uint32_t hmac)
+{
+  hal_hash_iovec_t iov[NODE_NBR];
+  uint32_t done = 0U;
+  uint32_t update_nbr = 0U;
+  uint32_t input_cplt_nbr = InputCpltNbr;
+  hal_status_t status;
+
+  while (done < size)
+  {
+    uint32_t iov_cnt = 1U + Random(NODE_NBR);
+    uint32_t i;
+
+    for (i = 0U; (i < iov_cnt) && (done < size); i++)
+    {
+      /* Short segments now and then, to carry bytes across segments and updates */
+      uint32_t seg = (Random(4U) == 0U) ? (1U + Random(5U)) : (1U + Random(SEGMENT_MAX));
+
+      seg = (seg < (size - done)) ? seg : (size - done);
+      iov[i].p_data = Place(offset + done, seg, Random(4U));
+      iov[i].size_byte = seg;
+      done += seg;
+    }
+    iov_cnt = i;
+
+    InputCplt = 0U;
+    status = (hmac != 0U) ? HAL_HASH_HMAC_UpdateV_DMA(&hHash, iov, iov_cnt) : HAL_HASH_UpdateV_DMA(&hHash, iov, iov_cnt);
+    CHECK(status == HAL_OK, "update %u of %u segment(s): status %d", (unsigned int)update_nbr, (unsigned int)iov_cnt,
+          (int)status);
+    CHECK(HOST_TEST_Wait(&InputCplt, TIMEOUT_MS) != 0U, "input callback of the update %u", (unsigned int)update_nbr);
+    CHECK(HAL_HASH_GetState(&hHash) == HAL_HASH_STATE_IDLE, "state after the update %u", (unsigned int)update_nbr);
+    update_nbr++;
+  }
+  input_cplt_nbr = InputCpltNbr - input_cplt_nbr;
+  CHECK(input_cplt_nbr == update_nbr, "%u input callback(s) for %u update(s)", (unsigned int)input_cplt_nbr,
+        (unsigned int)update_nbr);
+}
+
+static void TestModel(void)
+{
+  static const char two_blocks[] = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+  static uint8_t key6[131];
+  static const char msg6[] = "Test Using Larger Than Block-Size Key - Hash Key First";
+  hal_hash_hmac_config_t hmac_config = {HAL_HASH_DATA_SWAP_BYTE, HAL_HASH_ALGO_SHA256, NULL, 0U};
+  uint32_t size;
+
+  Start(HAL_HASH_ALGO_SHA256, HAL_DMA_SRC_DATA_WIDTH_BYTE);
+  CHECK(HAL_HASH_Compute(&hHash, "abc", 3U, Digest, &size, TIMEOUT_MS) == HAL_OK, "SHA-256 of abc");
+  CHECK(size == DIGEST_SIZE, "SHA-256 digest of %u bytes", (unsigned int)size);
+  CheckDigest(Digest, Sha256Abc, DIGEST_SIZE, "SHA-256 of abc");
+  CHECK(HAL_HASH_Compute(&hHash, two_blocks, sizeof(two_blocks) - 1U, Digest, &size, TIMEOUT_MS) == HAL_OK,
+        "SHA-256 of two blocks");
+  CheckDigest(Digest, Sha256TwoBlocks, DIGEST_SIZE, "SHA-256 of two blocks");
+
+  Start(HAL_HASH_ALGO_SHA224, HAL_DMA_SRC_DATA_WIDTH_BYTE);
+  CHECK(HAL_HASH_Compute(&hHash, "abc", 3U, Digest, &size, TIMEOUT_MS) == HAL_OK, "SHA-224 of abc");
+  CHECK(size == 28U, "SHA-224 digest of %u bytes", (unsigned int)size);
+  CheckDigest(Digest, Sha224Abc, 28U, "SHA-224 of abc");
+
+  Start(HAL_HASH_ALGO_SHA256, HAL_DMA_SRC_DATA_WIDTH_BYTE);
+  hmac_config.p_key = (uint8_t *)"Jefe";
+  hmac_config.key_size_byte = 4U;
+  CHECK(HAL_HASH_HMAC_SetConfig(&hHash, &hmac_config) == HAL_OK, "HMAC configuration");
+  CHECK(HAL_HASH_HMAC_Compute(&hHash, "what do ya want for nothing?", 28U, Digest, &size, TIMEOUT_MS) == HAL_OK,
+        "HMAC test case 2");
+  CheckDigest(Digest, HmacCase2, DIGEST_SIZE, "HMAC test case 2");
+
+  (void)memset(key6, 0xAA, sizeof(key6));
+  hmac_config.p_key = key6;
+  hmac_config.key_size_byte = sizeof(key6);
+  CHECK(HAL_HASH_HMAC_SetConfig(&hHash, &hmac_config) == HAL_OK, "HMAC configuration, long key");
+  CHECK(HAL_HASH_HMAC_Compute(&hHash, msg6, sizeof(msg6) - 1U, Digest, &size, TIMEOUT_MS) == HAL_OK,
+        "HMAC test case 6");
+  CheckDigest(Digest, HmacCase6, DIGEST_SIZE, "HMAC test case 6");
+}
+
+static void TestUpdateV(void)
+{
+  static const uint32_t sizes[] = {1U, 3U, 4U, 63U, 64U, 65U, 1000U, MSG_SIZE};
+  host_model_hash_stats_t before;
+  host_model_hash_stats_t after;
+  uint32_t size;
+
+  for (uint32_t n = 0U; n < (sizeof(sizes) / sizeof(sizes[0])); n++)
+  {
+    for (uint32_t run = 0U; run < 4U; run++)
+    {
+      const uint32_t msg_size = sizes[n];
+
+      Seed = (n * 16U) + run + 1U;
+      Start(HAL_HASH_ALGO_SHA256, HAL_DMA_SRC_DATA_WIDTH_BYTE);
+      CHECK(HAL_HASH_Compute(&hHash, Msg, msg_size, Expected, &size, TIMEOUT_MS) == HAL_OK, "reference digest");
+
+      HOST_MODEL_HASH_GetStats(&before);
+      FeedV(0U, msg_size, 0U);
+      CHECK(HAL_HASH_Finish(&hHash, Digest, &size, TIMEOUT_MS) == HAL_OK, "HAL_HASH_Finish");
+      HOST_MODEL_HASH_GetStats(&after);
+
+      CheckDigest(Digest, Expected, DIGEST_SIZE, "segmented message");
+      CHECK((after.byte_nbr - before.byte_nbr) == msg_size, "%u bytes fed for a message of %u",
+            (unsigned int)(after.byte_nbr - before.byte_nbr), (unsigned int)msg_size);
+      CHECK((after.din_write_nbr - before.din_write_nbr) == ((msg_size + 3U) / 4U),
+            "%u DIN writes for a message of %u bytes", (unsigned int)(after.din_write_nbr - before.din_write_nbr),
+            (unsigned int)msg_size);
+      CHECK((DigestCpltNbr == 0U) && (ErrorNbr == 0U), "%u digest and %u error callback(s)",
+            (unsigned int)DigestCpltNbr, (unsigned int)ErrorNbr);
+    }
+  }
+}
+
+static void TestCarryOnly(void)
+{
+  hal_hash_iovec_t iov[2];
+  uint32_t size;
+  host_model_dma_channel_stats_t dma;
+
+  Start(HAL_HASH_ALGO_SHA256, HAL_DMA_SRC_DATA_WIDTH_BYTE);
+  CHECK(HAL_HASH_Compute(&hHash, Msg, 9U, Expected, &size, TIMEOUT_MS) == HAL_OK, "reference digest");
+
+  /* 1 + 2 bytes: all kept, the callback is called before returning */
+  iov[0].p_data = Place(0U, 1U, 1U);
+  iov[0].size_byte = 1U;
+  iov[1].p_data = Place(1U, 2U, 3U);
+  iov[1].size_byte = 2U;
+  CHECK(HAL_HASH_UpdateV_DMA(&hHash, iov, 2U) == HAL_OK, "update of 3 bytes");
+  CHECK(InputCpltNbr == 1U, "input callback of the update of 3 bytes not called before returning");
+  HOST_MODEL_DMA_GetChannelStats(0U, &dma);
+  CHECK(dma.byte_nbr == 0U, "%u bytes transferred by the DMA", (unsigned int)dma.byte_nbr);
+
+  /* 6 bytes: one word made of the 3 kept and 1 new, 5 kept, of which 4 make the next word */
+  iov[0].p_data = Place(3U, 6U, 2U);
+  iov[0].size_byte = 6U;
+  InputCplt = 0U;
+  CHECK(HAL_HASH_UpdateV_DMA(&hHash, iov, 1U) == HAL_OK, "update of 6 bytes");
+  CHECK(HOST_TEST_Wait(&InputCplt, TIMEOUT_MS) != 0U, "input callback of the update of 6 bytes");
+  CHECK(HAL_HASH_Finish(&hHash, Digest, &size, TIMEOUT_MS) == HAL_OK, "HAL_HASH_Finish");
+  CheckDigest(Digest, Expected, DIGEST_SIZE, "message of 9 bytes");
+}
+
+static void TestWordWidth(void)
+{
+  hal_hash_iovec_t iov[3];
+  host_model_hash_stats_t before;
+  host_model_hash_stats_t after;
+  uint32_t size;
+
+  Start(HAL_HASH_ALGO_SHA256, HAL_DMA_SRC_DATA_WIDTH_WORD);
+  CHECK(HAL_HASH_Compute(&hHash, Msg, 203U, Expected, &size, TIMEOUT_MS) == HAL_OK, "reference digest");
+
+  /* Carries of 0, 2 and 3 bytes: the word multiple parts start at 0, 2 and 1 byte(s) from the segment address */
+  iov[0].p_data = Place(0U, 50U, 0U);
+  iov[0].size_byte = 50U;
+  iov[1].p_data = Place(50U, 77U, 2U);
+  iov[1].size_byte = 77U;
+  iov[2].p_data = Place(127U, 76U, 3U);
+  iov[2].size_byte = 76U;
+
+  /* The third segment one byte off: its word multiple part is not aligned */
+  HOST_MODEL_HASH_GetStats(&before);
+  iov[2].p_data = (const uint8_t *)iov[2].p_data + 1U;
+  CHECK(HAL_HASH_UpdateV_DMA(&hHash, iov, 3U) == HAL_INVALID_PARAM, "misaligned segment accepted");
+  HOST_MODEL_HASH_GetStats(&after);
+  CHECK(after.din_write_nbr == before.din_write_nbr, "%u words fed by a refused update",
+        (unsigned int)(after.din_write_nbr - before.din_write_nbr));
+  CHECK(HAL_HASH_GetState(&hHash) == HAL_HASH_STATE_IDLE, "state after a refused update");
+  CHECK(InputCpltNbr == 0U, "input callback of a refused update");
+
+  iov[2].p_data = Place(127U, 76U, 3U);
+  CHECK(HAL_HASH_UpdateV_DMA(&hHash, iov, 3U) == HAL_OK, "aligned segments");
+  CHECK(HOST_TEST_Wait(&InputCplt, TIMEOUT_MS) != 0U, "input callback");
+  CHECK(HAL_HASH_Finish(&hHash, Digest, &size, TIMEOUT_MS) == HAL_OK, "HAL_HASH_Finish");
+  CheckDigest(Digest, Expected, DIGEST_SIZE, "segments of word source width");
+}
+
+static void TestRefused(void)
+{
+  static const uint8_t large[0x10000U] __attribute__((aligned(4)));
+  hal_hash_iovec_t iov[NODE_NBR + 1U];
+  host_model_hash_stats_t before;
+  host_model_hash_stats_t after;
+  uint32_t size;
+
+  Start(HAL_HASH_ALGO_SHA256, HAL_DMA_SRC_DATA_WIDTH_BYTE);
+  CHECK(HAL_HASH_Compute(&hHash, Msg, 100U, Expected, &size, TIMEOUT_MS) == HAL_OK, "reference digest");
+  HOST_MODEL_HASH_GetStats(&before);
+  for (uint32_t i = 0U; i <= NODE_NBR; i++)
+  {
+    iov[i].p_data = &Msg[i];
+    iov[i].size_byte = 1U;
+  }
+  CHECK(HAL_HASH_UpdateV_DMA(&hHash, iov, NODE_NBR + 1U) == HAL_INVALID_PARAM, "more segments than nodes");
+  iov[1].size_byte = 0U;
+  CHECK(HAL_HASH_UpdateV_DMA(&hHash, iov, 2U) == HAL_INVALID_PARAM, "empty segment");
+  iov[1].p_data = large;
+  iov[1].size_byte = sizeof(large);
+  CHECK(HAL_HASH_UpdateV_DMA(&hHash, iov, 2U) == HAL_INVALID_PARAM, "segment of 65536 bytes");
+  iov[1].p_data = NULL;
+  iov[1].size_byte = 1U;
+  CHECK(HAL_HASH_UpdateV_DMA(&hHash, iov, 2U) == HAL_INVALID_PARAM, "NULL segment");
+  HOST_MODEL_HASH_GetStats(&after);
+  CHECK(after.din_write_nbr == before.din_write_nbr, "%u words fed by the refused updates",
+        (unsigned int)(after.din_write_nbr - before.din_write_nbr));
+  CHECK(InputCpltNbr == 0U, "%u input callback(s) of refused updates", (unsigned int)InputCpltNbr);
+
+  /* The message is not affected */
+  Seed = 99U;
+  FeedV(0U, 100U, 0U);
+  CHECK(HAL_HASH_Finish(&hHash, Digest, &size, TIMEOUT_MS) == HAL_OK, "HAL_HASH_Finish");
+  CheckDigest(Digest, Expected, DIGEST_SIZE, "message after refused updates");
+}
+
+static void TestHmac(void)
+{
+  static const char msg2[] = "what do ya want for nothing?";
+  static uint8_t key6[131];
+  static const char msg6[] = "Test Using Larger Than Block-Size Key - Hash Key First";
+  static const uint32_t key_sizes[] = {4U, 32U, 61U, 64U, 131U};
+  hal_hash_hmac_config_t hmac_config = {HAL_HASH_DATA_SWAP_BYTE, HAL_HASH_ALGO_SHA256, (uint8_t *)"Jefe", 4U};
+  hal_hash_iovec_t iov[4];
+  uint32_t size;
+
+  /* Test case 2 in segments of 5, 1, 13 and 9 bytes */
+  Start(HAL_HASH_ALGO_SHA256, HAL_DMA_SRC_DATA_WIDTH_BYTE);
+  (void)memcpy(Msg, msg2, sizeof(msg2) - 1U);
+  iov[0].p_data = Place(0U, 5U, 0U);
+  iov[0].size_byte = 5U;
+  iov[1].p_data = Place(5U, 1U, 3U);
+  iov[1].size_byte = 1U;
+  iov[2].p_data = Place(6U, 13U, 1U);
+  iov[2].size_byte = 13U;
+  iov[3].p_data = Place(19U, 9U, 2U);
+  iov[3].size_byte = 9U;
+  CHECK(HAL_HASH_HMAC_SetConfig(&hHash, &hmac_config) == HAL_OK, "HMAC configuration");
+  CHECK(HAL_HASH_HMAC_UpdateV_DMA(&hHash, iov, 4U) == HAL_OK, "HMAC update");
+  CHECK(HOST_TEST_Wait(&InputCplt, TIMEOUT_MS) != 0U, "input callback of the HMAC update");
+  CHECK(HAL_HASH_HMAC_Finish(&hHash, Digest, &size, TIMEOUT_MS) == HAL_OK, "HAL_HASH_HMAC_Finish");
+  CheckDigest(Digest, HmacCase2, DIGEST_SIZE, "HMAC test case 2");
+
+  /* Test case 6, key of 131 bytes, in two updates */
+  (void)memset(key6, 0xAA, sizeof(key6));
+  (void)memcpy(Msg, msg6, sizeof(msg6) - 1U);
+  hmac_config.p_key = key6;
+  hmac_config.key_size_byte = sizeof(key6);
+  CHECK(HAL_HASH_HMAC_SetConfig(&hHash, &hmac_config) == HAL_OK, "HMAC configuration, long key");
+  Seed = 6U;
+  FeedV(0U, 30U, 1U);
+  FeedV(30U, sizeof(msg6) - 31U, 1U);
+  CHECK(HAL_HASH_HMAC_Finish(&hHash, Digest, &size, TIMEOUT_MS) == HAL_OK, "HAL_HASH_HMAC_Finish, long key");
+  CheckDigest(Digest, HmacCase6, DIGEST_SIZE, "HMAC test case 6");
+
+  /* Random messages against HAL_HASH_HMAC_Compute() */
+  for (uint32_t i = 0U; i < MSG_SIZE; i++)
+  {
+    Msg[i] = (uint8_t)((i * 131U) + (i >> 7U) + 5U);
+  }
+  for (uint32_t k = 0U; k < (sizeof(key_sizes) / sizeof(key_sizes[0])); k++)
+  {
+    const uint32_t msg_size = 200U + (k * 517U);
+
+    hmac_config.key_size_byte = key_sizes[k];
+    CHECK(HAL_HASH_HMAC_SetConfig(&hHash, &hmac_config) == HAL_OK, "HMAC configuration");
+    CHECK(HAL_HASH_HMAC_Compute(&hHash, Msg, msg_size, Expected, &size, TIMEOUT_MS) == HAL_OK, "reference HMAC");
+    CHECK(HAL_HASH_HMAC_SetConfig(&hHash, &hmac_config) == HAL_OK, "HMAC configuration");
+    Seed = 1000U + k;
+    FeedV(0U, msg_size, 1U);
+    CHECK(HAL_HASH_HMAC_Finish(&hHash, Digest, &size, TIMEOUT_MS) == HAL_OK, "HAL_HASH_HMAC_Finish");
+    CheckDigest(Digest, Expected, DIGEST_SIZE, "segmented HMAC");
+  }
+  CHECK((DigestCpltNbr == 0U) && (ErrorNbr == 0U), "%u digest and %u error callback(s)", (unsigned int)DigestCpltNbr,
+        (unsigned int)ErrorNbr);
+}
+
+/* Exported functions --------------------------------------------------------*/
+int main(void)
+{
+  for (uint32_t i = 0U; i < MSG_SIZE; i++)
+  {
+    Msg[i] = (uint8_t)((i * 7U) + (i >> 8U) + 1U);
+  }
+
+  TestModel();
+  TestUpdateV();
+  TestCarryOnly();
+  TestWordWidth();
+  TestRefused();
+  TestHmac();
+
+  return HOST_TEST_Report();
+}
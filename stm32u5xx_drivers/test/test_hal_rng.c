@@ -0,0 +1,154 @@
+/**
+  ******************************************************************************
+  * @file    test_hal_rng.c
+  * @brief   Host tests of the HAL RNG driver on the RNG model
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ * The model produces a word every 64 cycles after a start of 256 cycles, from a seeded generator:
+ * - polling generation: the words are the sequence of the seed, no word lost or read twice, at the model rate,
+ * - interrupt generation: same sequence, completion callback from the RNG interrupt,
+ * - seed error during a polling generation: HAL_ERROR and the seed error code, recovered by
+ *   HAL_RNG_RecoverSeedError() through the conditioning reset, then a generation succeeds,
+ * - seed error during an interrupt generation: error callback and error state.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#define _POSIX_C_SOURCE 200809L
+#include <string.h>
+
+#include "host_model.h"
+#include "host_test.h"
+#include "stm32_hal.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define WORD_NBR          64U
+#define START_CYCLES      256U        /*!< Rate of the model, see host_model/host_rng.c */
+#define WORD_CYCLES       64U
+
+/* Private variables ---------------------------------------------------------*/
+static hal_rng_handle_t hRng;
+static uint32_t Words[WORD_NBR];
+static uint32_t Reference[WORD_NBR];
+static volatile uint32_t CpltNbr;
+static volatile uint32_t ErrorNbr;
+
+/* Handlers and callbacks ----------------------------------------------------*/
+void RNG_IRQHandler(void)
+{
+  HAL_RNG_IRQHandler(&hRng);
+}
+
+void HAL_RNG_GenerationCpltCallback(hal_rng_handle_t *hrng)
+{
+  (void)hrng;
+  CpltNbr++;
+}
+
+void HAL_RNG_ErrorCallback(hal_rng_handle_t *hrng)
+{
+  (void)hrng;
+  ErrorNbr++;
+}
+
+/* Private functions ---------------------------------------------------------*/
+static void Start(void)
+{
+  HOST_TEST_Init();
+  CHECK(HAL_RNG_Init(&hRng, HAL_RNG) == HAL_OK, "HAL_RNG_Init");
+  CHECK(HAL_RNG_SetCandidateNISTConfig(&hRng) == HAL_OK, "configuration");
+  HAL_CORTEX_NVIC_EnableIRQ(RNG_IRQn);
+  CpltNbr = 0U;
+  ErrorNbr = 0U;
+}
+
+/* The sequence of the seed: generated once by polling, each test compares with it */
+static void TestPolling(void)
+{
+  uint64_t start;
+  uint64_t elapsed;
+
+  Start();
+  HOST_MODEL_RNG_SetSeed(45U);
+  start = HOST_MODEL_GetCycles();
+  CHECK(HAL_RNG_GenerateRandomNumber(&hRng, Reference, WORD_NBR, 10U) == HAL_OK, "polling generation");
+  elapsed = HOST_MODEL_GetCycles() - start;
+  CHECK(elapsed >= (START_CYCLES + ((WORD_NBR - 1U) * WORD_CYCLES)), "%llu cycles, faster than the RNG",
+        (unsigned long long)elapsed);
+  for (uint32_t i = 0U; i < WORD_NBR; i++)
+  {
+    for (uint32_t j = 0U; j < i; j++)
+    {
+      CHECK(Reference[i] != Reference[j], "words %u and %u equal", (unsigned int)j, (unsigned int)i);
+    }
+  }
+
+  /* Same seed, same sequence */
+  Start();
+  HOST_MODEL_RNG_SetSeed(45U);
+  CHECK(HAL_RNG_GenerateRandomNumber(&hRng, Words, WORD_NBR, 10U) == HAL_OK, "polling generation");
+  CHECK(memcmp(Words, Reference, sizeof(Words)) == 0, "sequence not reproduced");
+}
+
+static void TestInterrupt(void)
+{
+  Start();
+  HOST_MODEL_RNG_SetSeed(45U);
+  (void)memset(Words, 0, sizeof(Words));
+  CHECK(HAL_RNG_GenerateRandomNumber_IT(&hRng, Words, WORD_NBR) == HAL_OK, "interrupt generation");
+  CHECK(HOST_TEST_Wait(&CpltNbr, 10U) == 1U, "no completion");
+  CHECK(ErrorNbr == 0U, "%u error callback(s)", (unsigned int)ErrorNbr);
+  CHECK(memcmp(Words, Reference, sizeof(Words)) == 0, "sequence lost or reordered");
+  CHECK(HAL_RNG_GetState(&hRng) == HAL_RNG_STATE_IDLE, "state %d", (int)HAL_RNG_GetState(&hRng));
+  CHECK(HOST_MODEL_GetIrqCount(RNG_IRQn) != 0U, "no RNG interrupt");
+}
+
+static void TestSeedErrorPolling(void)
+{
+  Start();
+  HOST_MODEL_RNG_InjectSeedError();
+  CHECK(HAL_RNG_GenerateRandomNumber(&hRng, Words, WORD_NBR, 10U) == HAL_ERROR, "seed error not reported");
+  CHECK(HAL_RNG_GetLastErrorCodes(&hRng) == HAL_RNG_ERROR_SEED, "error codes 0x%X",
+        (unsigned int)HAL_RNG_GetLastErrorCodes(&hRng));
+  CHECK(HAL_RNG_GetState(&hRng) == HAL_RNG_STATE_ERROR, "state %d", (int)HAL_RNG_GetState(&hRng));
+
+  CHECK(HAL_RNG_RecoverSeedError(&hRng) == HAL_OK, "recovery");
+  CHECK(HAL_RNG_GetState(&hRng) == HAL_RNG_STATE_IDLE, "state %d after the recovery", (int)HAL_RNG_GetState(&hRng));
+  CHECK(HAL_RNG_GenerateRandomNumber(&hRng, Words, WORD_NBR, 10U) == HAL_OK, "generation after the recovery");
+}
+
+static void TestSeedErrorInterrupt(void)
+{
+  Start();
+  CHECK(HAL_RNG_GenerateRandomNumber_IT(&hRng, Words, WORD_NBR) == HAL_OK, "interrupt generation");
+  HOST_MODEL_Run(START_CYCLES + (4U * WORD_CYCLES));
+  HOST_MODEL_RNG_InjectSeedError();
+  CHECK(HOST_TEST_Wait(&ErrorNbr, 10U) == 1U, "no error callback");
+  CHECK(CpltNbr == 0U, "completion after a seed error");
+  CHECK(HAL_RNG_GetState(&hRng) == HAL_RNG_STATE_ERROR, "state %d", (int)HAL_RNG_GetState(&hRng));
+  CHECK((HAL_RNG_GetLastErrorCodes(&hRng) & HAL_RNG_ERROR_SEED) != 0U, "error codes 0x%X",
+        (unsigned int)HAL_RNG_GetLastErrorCodes(&hRng));
+  CHECK(HAL_RNG_RecoverSeedError(&hRng) == HAL_OK, "recovery");
+}
+
+/* Exported functions --------------------------------------------------------*/
+int main(void)
+{
+  TestPolling();
+  TestInterrupt();
+  TestSeedErrorPolling();
+  TestSeedErrorInterrupt();
+
+  return HOST_TEST_Report();
+}
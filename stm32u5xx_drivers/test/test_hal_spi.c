@@ -0,0 +1,304 @@
+/**
+  ******************************************************************************
+  * @file    test_hal_spi.c
+  * @brief   Host tests of the HAL SPI driver on the SPI and GPDMA models
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ * SPI1 master, full duplex, kernel clock divided by 8, the slave of the model answering the complement of each frame:
+ * - polling transfers of 8-bit and 16-bit frames: the frames on MOSI, the answers received,
+ * - interrupt transfer: completion callback from the SPI interrupt,
+ * - DMA transfer: the data, a duration of one frame time per frame, and the CPU time in the handlers bounded by the
+ *   completion interrupts,
+ * - scatter-gather DMA transmission of 16-bit frames: one node per segment loaded in order, the segments back to back
+ *   on MOSI, the packet count, one completion callback, and the DMA widths refused for 16-bit frames.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#define _POSIX_C_SOURCE 200809L
+#include <string.h>
+
+#include "host_model.h"
+#include "host_test.h"
+#include "stm32_hal.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define DATA_SIZE         1024U
+#define FRAME_CYCLES      64U         /*!< 8 bits at the kernel clock divided by 8 */
+#define TX_NODE_NBR       4U
+
+/* Private variables ---------------------------------------------------------*/
+static hal_spi_handle_t hSpi;
+static hal_dma_handle_t hDmaTx;
+static hal_dma_handle_t hDmaRx;
+static uint8_t TxData[DATA_SIZE];
+static uint8_t RxData[DATA_SIZE];
+static uint32_t Mosi[DATA_SIZE];
+static hal_dma_node_t TxNodes[TX_NODE_NBR];
+static host_model_dma_fetch_t Fetches[8];
+static volatile uint32_t CpltNbr;
+static volatile uint32_t TxCpltNbr;
+static volatile uint32_t ErrorNbr;
+
+/* Handlers and callbacks ----------------------------------------------------*/
+void SPI1_IRQHandler(void)
+{
+  HAL_SPI_IRQHandler(&hSpi);
+}
+
+void GPDMA1_Channel2_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&hDmaTx);
+}
+
+void GPDMA1_Channel3_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&hDmaRx);
+}
+
+void HAL_SPI_TxRxCpltCallback(hal_spi_handle_t *hspi)
+{
+  (void)hspi;
+  CpltNbr++;
+}
+
+void HAL_SPI_TxCpltCallback(hal_spi_handle_t *hspi)
+{
+  (void)hspi;
+  TxCpltNbr++;
+}
+
+void HAL_SPI_ErrorCallback(hal_spi_handle_t *hspi)
+{
+  (void)hspi;
+  ErrorNbr++;
+}
+
+static uint32_t Slave(void *p_context, uint32_t mosi_frame)
+{
+  (void)p_context;
+  return ~mosi_frame;
+}
+
+/* Private functions ---------------------------------------------------------*/
+static void Start(hal_spi_data_width_t data_width)
+{
+  const hal_spi_config_t config =
+  {
+    HAL_SPI_MODE_MASTER, HAL_SPI_DIRECTION_FULL_DUPLEX, data_width, HAL_SPI_CLOCK_POLARITY_LOW,
+    HAL_SPI_CLOCK_PHASE_1_EDGE, HAL_SPI_BAUD_RATE_PRESCALER_8, HAL_SPI_MSB_FIRST, HAL_SPI_NSS_PIN_MGMT_INTERNAL
+  };
+  hal_dma_direct_xfer_config_t dma_config =
+  {
+    HAL_GPDMA1_REQUEST_SPI1_TX, HAL_DMA_DIRECTION_MEMORY_TO_PERIPH, HAL_DMA_SRC_ADDR_INCREMENTED,
+    HAL_DMA_DEST_ADDR_FIXED, HAL_DMA_SRC_DATA_WIDTH_BYTE, HAL_DMA_DEST_DATA_WIDTH_BYTE,
+    HAL_DMA_PRIORITY_LOW_WEIGHT_HIGH
+  };
+
+  HOST_TEST_Init();
+  CHECK(HAL_SPI_Init(&hSpi, HAL_SPI1) == HAL_OK, "HAL_SPI_Init");
+  CHECK(HAL_SPI_SetConfig(&hSpi, &config) == HAL_OK, "HAL_SPI_SetConfig");
+
+  CHECK(HAL_DMA_Init(&hDmaTx, HAL_GPDMA1_CH2) == HAL_OK, "HAL_DMA_Init Tx");
+  CHECK(HAL_DMA_SetConfigDirectXfer(&hDmaTx, &dma_config) == HAL_OK, "Tx DMA configuration");
+  CHECK(HAL_SPI_SetTxDMA(&hSpi, &hDmaTx) == HAL_OK, "HAL_SPI_SetTxDMA");
+
+  dma_config.request = HAL_GPDMA1_REQUEST_SPI1_RX;
+  dma_config.direction = HAL_DMA_DIRECTION_PERIPH_TO_MEMORY;
+  dma_config.src_inc = HAL_DMA_SRC_ADDR_FIXED;
+  dma_config.dest_inc = HAL_DMA_DEST_ADDR_INCREMENTED;
+  CHECK(HAL_DMA_Init(&hDmaRx, HAL_GPDMA1_CH3) == HAL_OK, "HAL_DMA_Init Rx");
+  CHECK(HAL_DMA_SetConfigDirectXfer(&hDmaRx, &dma_config) == HAL_OK, "Rx DMA configuration");
+  CHECK(HAL_SPI_SetRxDMA(&hSpi, &hDmaRx) == HAL_OK, "HAL_SPI_SetRxDMA");
+
+  HAL_CORTEX_NVIC_EnableIRQ(SPI1_IRQn);
+  HAL_CORTEX_NVIC_EnableIRQ(GPDMA1_CH2_IRQn);
+  HAL_CORTEX_NVIC_EnableIRQ(GPDMA1_CH3_IRQn);
+  HOST_MODEL_SPI_SetSlave(SPI1, Slave, NULL);
+
+  CpltNbr = 0U;
+  TxCpltNbr = 0U;
+  ErrorNbr = 0U;
+  (void)memset(RxData, 0, sizeof(RxData));
+}
+
+/* Tx channel in linked-list mode with the nodes of HAL_SPI_TransmitV_DMA() */
+static void StartTransmitV(hal_dma_src_data_width_t src_width)
+{
+  const hal_dma_linkedlist_xfer_config_t ll_config =
+  {
+    HAL_DMA_PRIORITY_LOW_WEIGHT_HIGH, HAL_DMA_PORT0, HAL_DMA_LINKEDLIST_XFER_EVENT_Q
+  };
+  hal_dma_node_config_t node_config;
+
+  Start(HAL_SPI_DATA_WIDTH_16_BIT);
+  (void)memset(&node_config, 0, sizeof(node_config));
+  node_config.xfer.request = HAL_GPDMA1_REQUEST_SPI1_TX;
+  node_config.xfer.direction = HAL_DMA_DIRECTION_MEMORY_TO_PERIPH;
+  node_config.xfer.src_inc = HAL_DMA_SRC_ADDR_INCREMENTED;
+  node_config.xfer.dest_inc = HAL_DMA_DEST_ADDR_FIXED;
+  node_config.xfer.src_data_width = src_width;
+  node_config.xfer.dest_data_width = HAL_DMA_DEST_DATA_WIDTH_HALFWORD;
+  node_config.xfer.priority = HAL_DMA_PRIORITY_LOW_WEIGHT_HIGH;
+  /* Single beats: the SPI requests the DMA for a packet of one frame */
+  node_config.src_burst_length_byte = 1U;
+  node_config.dest_burst_length_byte = 1U;
+  CHECK(HAL_DMA_SetConfigLinkedListXfer(&hDmaTx, &ll_config) == HAL_OK, "Tx DMA linked-list configuration");
+  CHECK(HAL_SPI_SetTxDMANodes(&hSpi, TxNodes, TX_NODE_NBR, &node_config) == HAL_OK, "HAL_SPI_SetTxDMANodes");
+}
+
+static void CheckTransfer(uint32_t size)
+{
+  CHECK(HOST_MODEL_SPI_GetTx(SPI1, Mosi, DATA_SIZE) == size, "frames on MOSI");
+  for (uint32_t i = 0U; i < size; i++)
+  {
+    CHECK(Mosi[i] == TxData[i], "MOSI frame %u: 0x%02X instead of 0x%02X", (unsigned int)i, (unsigned int)Mosi[i],
+          (unsigned int)TxData[i]);
+    CHECK(RxData[i] == (uint8_t)~TxData[i], "MISO frame %u: 0x%02X instead of 0x%02X", (unsigned int)i,
+          (unsigned int)RxData[i], (unsigned int)(uint8_t)~TxData[i]);
+  }
+  CHECK(ErrorNbr == 0U, "%u error(s)", (unsigned int)ErrorNbr);
+  CHECK(HAL_SPI_GetLastErrorsCodes(&hSpi) == HAL_SPI_ERROR_NONE, "error codes 0x%X",
+        (unsigned int)HAL_SPI_GetLastErrorsCodes(&hSpi));
+}
+
+static void TestPolling(void)
+{
+  const uint32_t size = 64U;
+  uint16_t tx16[8];
+  uint16_t rx16[8];
+
+  Start(HAL_SPI_DATA_WIDTH_8_BIT);
+  CHECK(HAL_SPI_TransmitReceive(&hSpi, TxData, RxData, size, 100U) == HAL_OK, "polling transfer");
+  CheckTransfer(size);
+
+  /* 16-bit frames: two bytes per FIFO access */
+  Start(HAL_SPI_DATA_WIDTH_16_BIT);
+  for (uint32_t i = 0U; i < 8U; i++)
+  {
+    tx16[i] = (uint16_t)(0x1234U * (i + 1U));
+  }
+  CHECK(HAL_SPI_TransmitReceive(&hSpi, tx16, rx16, 8U, 100U) == HAL_OK, "16-bit polling transfer");
+  CHECK(HOST_MODEL_SPI_GetTx(SPI1, Mosi, DATA_SIZE) == 8U, "16-bit frames on MOSI");
+  for (uint32_t i = 0U; i < 8U; i++)
+  {
+    CHECK(Mosi[i] == tx16[i], "MOSI frame %u: 0x%04X instead of 0x%04X", (unsigned int)i, (unsigned int)Mosi[i],
+          (unsigned int)tx16[i]);
+    CHECK(rx16[i] == (uint16_t)~tx16[i], "MISO frame %u: 0x%04X", (unsigned int)i, (unsigned int)rx16[i]);
+  }
+}
+
+static void TestInterrupt(void)
+{
+  const uint32_t size = 64U;
+
+  Start(HAL_SPI_DATA_WIDTH_8_BIT);
+  CHECK(HAL_SPI_TransmitReceive_IT(&hSpi, TxData, RxData, size) == HAL_OK, "interrupt transfer");
+  CHECK(HOST_TEST_Wait(&CpltNbr, 100U) == 1U, "no completion");
+  CheckTransfer(size);
+  CHECK(HOST_MODEL_GetIrqCount(SPI1_IRQn) != 0U, "no SPI interrupt");
+}
+
+static void TestDma(void)
+{
+  host_model_stats_t stats;
+  uint64_t start;
+  uint64_t elapsed;
+
+  Start(HAL_SPI_DATA_WIDTH_8_BIT);
+  start = HOST_MODEL_GetCycles();
+  CHECK(HAL_SPI_TransmitReceive_DMA(&hSpi, TxData, RxData, DATA_SIZE) == HAL_OK, "DMA transfer");
+  CHECK(HOST_TEST_Wait(&CpltNbr, 1000U) == 1U, "no completion");
+  elapsed = HOST_MODEL_GetCycles() - start;
+  CheckTransfer(DATA_SIZE);
+
+  /* The bus is the bottleneck: the DMA keeps the FIFO filled */
+  CHECK((elapsed >= (DATA_SIZE * FRAME_CYCLES)) && (elapsed <= ((DATA_SIZE + 8U) * FRAME_CYCLES)),
+        "%u frames in %llu cycles", (unsigned int)DATA_SIZE, (unsigned long long)elapsed);
+  HOST_MODEL_GetStats(&stats);
+  CHECK(stats.irq_cycle_nbr < (elapsed / 10U), "%llu cycles in the handlers for %llu cycles",
+        (unsigned long long)stats.irq_cycle_nbr, (unsigned long long)elapsed);
+}
+
+static void TestTransmitV(void)
+{
+  static const uint16_t header[2] = {0xA55AU, 0x0102U};
+  static const uint16_t trailer[1] = {0xBEEFU};
+  const uint16_t *const payload = (const uint16_t *)(const void *)TxData;
+  const hal_spi_iovec_t iov[3] =
+  {
+    {header, sizeof(header)}, {payload, 8U * sizeof(uint16_t)}, {trailer, sizeof(trailer)}
+  };
+  const uint16_t *const segments[3] = {header, payload, trailer};
+  const uint32_t frame_nbrs[3] = {2U, 8U, 1U};
+  uint32_t frame = 0U;
+  uint32_t fetch_nbr;
+
+  StartTransmitV(HAL_DMA_SRC_DATA_WIDTH_HALFWORD);
+  HOST_MODEL_DMA_SetFetchLog(Fetches, 8U);
+  CHECK(HAL_SPI_TransmitV_DMA(&hSpi, iov, 3U) == HAL_OK, "scatter-gather transmission");
+  CHECK(hSpi.tx_xfer_count == 11U, "count of %u for 11 packets", (unsigned int)hSpi.tx_xfer_count);
+  CHECK(HOST_TEST_Wait(&TxCpltNbr, 100U) == 1U, "no completion");
+  CHECK(ErrorNbr == 0U, "%u error(s)", (unsigned int)ErrorNbr);
+
+  /* The segments back to back on MOSI */
+  CHECK(HOST_MODEL_SPI_GetTx(SPI1, Mosi, DATA_SIZE) == 11U, "frames on MOSI");
+  for (uint32_t i = 0U; i < 3U; i++)
+  {
+    for (uint32_t j = 0U; j < frame_nbrs[i]; j++)
+    {
+      CHECK(Mosi[frame] == segments[i][j], "segment %u frame %u: 0x%04X instead of 0x%04X", (unsigned int)i,
+            (unsigned int)j, (unsigned int)Mosi[frame], (unsigned int)segments[i][j]);
+      frame++;
+    }
+  }
+
+  /* One node per segment, loaded in order */
+  fetch_nbr = HOST_MODEL_DMA_GetFetchNbr();
+  CHECK(fetch_nbr == 3U, "%u node(s) loaded for 3 segments", (unsigned int)fetch_nbr);
+  for (uint32_t i = 0U; (i < fetch_nbr) && (i < 3U); i++)
+  {
+    CHECK(Fetches[i].address == (uint32_t)&TxNodes[i], "load %u: node at 0x%08X", (unsigned int)i,
+          (unsigned int)Fetches[i].address);
+  }
+  HOST_MODEL_DMA_SetFetchLog(NULL, 0U);
+
+  /* Word source: the packing of two 16-bit frames per word, and segments of whole words */
+  StartTransmitV(HAL_DMA_SRC_DATA_WIDTH_WORD);
+  CHECK(HAL_SPI_TransmitV_DMA(&hSpi, iov, 3U) == HAL_INVALID_PARAM, "segment of one half-word with a word source");
+
+  /* Byte source: two DMA accesses per 16-bit frame, refused as by HAL_SPI_Transmit_DMA() */
+  StartTransmitV(HAL_DMA_SRC_DATA_WIDTH_BYTE);
+  CHECK(HAL_SPI_TransmitV_DMA(&hSpi, iov, 3U) == HAL_ERROR, "byte source for 16-bit frames");
+  CHECK(HAL_SPI_GetLastErrorsCodes(&hSpi) == HAL_SPI_ERROR_DMA, "error codes 0x%X",
+        (unsigned int)HAL_SPI_GetLastErrorsCodes(&hSpi));
+  CHECK(HAL_SPI_GetState(&hSpi) == HAL_SPI_STATE_IDLE, "state %d", (int)HAL_SPI_GetState(&hSpi));
+  CHECK(HOST_MODEL_SPI_GetTx(SPI1, Mosi, DATA_SIZE) == 0U, "frames on MOSI");
+}
+
+/* Exported functions --------------------------------------------------------*/
+int main(void)
+{
+  for (uint32_t i = 0U; i < DATA_SIZE; i++)
+  {
+    TxData[i] = (uint8_t)((i * 13U) + (i >> 8U));
+  }
+
+  TestPolling();
+  TestInterrupt();
+  TestDma();
+  TestTransmitV();
+
+  return HOST_TEST_Report();
+}
@@ -0,0 +1,503 @@
+/**
+  ******************************************************************************
+  * @file    test_hal_uart.c
+  * @brief   Host tests of the HAL UART driver on the USART and GPDMA models
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ * USART1 at 115200 bauds, 8N1, the transmitter looped back to the receiver unless the test feeds the line:
+ * - polling transmission: the frames on the line, at the baud rate,
+ * - interrupt transmission and reception in loopback,
+ * - DMA transmission and reception in loopback: the data, a duration of one frame time per byte, and the CPU time
+ *   in the handlers bounded by the completion interrupts,
+ * - reception to idle by DMA of a burst fed on the line: completion on the idle line with the burst size,
+ * - scatter-gather DMA transmission: one node per segment loaded in order, the segments back to back on the line,
+ *   one completion callback on the TC interrupt of the linear linked-list, the segment sizes refused for the DMA
+ *   source width, and the byte source refused for 9-bit frames without parity,
+ * - DMA transmission on a circular linked-list channel: one completion callback per lap, the transmission running
+ *   until it is aborted,
+ * - reception stream in a circular buffer of 64 bytes: the spans reported on the half buffer, full buffer and idle
+ *   events, the data reported across the end of the buffer, the count after partial consumption, the unconsumed
+ *   data dropped when overwritten, and a whole lap received with the interrupts masked reported as an overrun.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#define _POSIX_C_SOURCE 200809L
+#include <string.h>
+
+#include "host_model.h"
+#include "host_test.h"
+#include "stm32_hal.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define BAUD_RATE         115200U
+#define DATA_SIZE         1024U
+#define BURST_SIZE        100U
+#define TX_NODE_NBR       4U
+#define LAP_SIZE          16U
+#define RING_SIZE         64U
+#define SPAN_NBR          16U
+
+/* Private variables ---------------------------------------------------------*/
+static hal_uart_handle_t hUart;
+static hal_dma_handle_t hDmaTx;
+static hal_dma_handle_t hDmaRx;
+static uint8_t TxData[DATA_SIZE];
+static uint8_t RxData[DATA_SIZE];
+static uint8_t Line[DATA_SIZE];
+static hal_dma_node_t TxNodes[TX_NODE_NBR];
+static hal_dma_node_t CircularNode;
+static host_model_dma_fetch_t Fetches[8];
+static hal_dma_node_t RxNode;
+static uint8_t Ring[RING_SIZE];
+static uint8_t Stream[DATA_SIZE];
+static uint32_t StreamSize;
+static struct
+{
+  uint32_t offset;
+  uint32_t size;
+  hal_uart_rx_event_types_t event;
+} Spans[SPAN_NBR];
+static uint32_t SpanNbr;
+static volatile uint32_t IdleNbr;
+static volatile uint32_t TxCpltNbr;
+static volatile uint32_t RxCpltNbr;
+static volatile uint32_t RxSize;
+static volatile uint32_t RxEvent;
+static volatile uint32_t ErrorNbr;
+
+/* Handlers and callbacks ----------------------------------------------------*/
+void USART1_IRQHandler(void)
+{
+  HAL_UART_IRQHandler(&hUart);
+}
+
+void GPDMA1_Channel0_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&hDmaTx);
+}
+
+void GPDMA1_Channel1_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&hDmaRx);
+}
+
+void HAL_UART_TxCpltCallback(hal_uart_handle_t *huart)
+{
+  (void)huart;
+  TxCpltNbr++;
+}
+
+void HAL_UART_RxCpltCallback(hal_uart_handle_t *huart, uint32_t size_byte, hal_uart_rx_event_types_t rx_event)
+{
+  (void)huart;
+  RxSize = size_byte;
+  RxEvent = (uint32_t)rx_event;
+  RxCpltNbr++;
+}
+
+void HAL_UART_RxStreamCallback(hal_uart_handle_t *huart, uint32_t offset_byte, uint32_t size_byte,
+                               hal_uart_rx_event_types_t rx_event)
+{
+  (void)huart;
+  /* The data are copied before the DMA comes back over them */
+  if ((StreamSize + size_byte) <= sizeof(Stream))
+  {
+    (void)memcpy(&Stream[StreamSize], &Ring[offset_byte], size_byte);
+  }
+  StreamSize += size_byte;
+  if (SpanNbr < SPAN_NBR)
+  {
+    Spans[SpanNbr].offset = offset_byte;
+    Spans[SpanNbr].size = size_byte;
+    Spans[SpanNbr].event = rx_event;
+  }
+  SpanNbr++;
+  if (rx_event == HAL_UART_RX_EVENT_IDLE)
+  {
+    IdleNbr++;
+  }
+}
+
+void HAL_UART_ErrorCallback(hal_uart_handle_t *huart)
+{
+  (void)huart;
+  ErrorNbr++;
+}
+
+/* Private functions ---------------------------------------------------------*/
+static void Start(void)
+{
+  const hal_uart_config_t config =
+  {
+    BAUD_RATE, HAL_UART_PRESCALER_DIV1, HAL_UART_WORD_LENGTH_8_BIT, HAL_UART_STOP_BIT_1, HAL_UART_PARITY_NONE,
+    HAL_UART_DIRECTION_TX_RX, HAL_UART_HW_CONTROL_NONE, HAL_UART_OVERSAMPLING_16, HAL_UART_ONE_BIT_SAMPLE_DISABLE
+  };
+  hal_dma_direct_xfer_config_t dma_config =
+  {
+    HAL_GPDMA1_REQUEST_USART1_TX, HAL_DMA_DIRECTION_MEMORY_TO_PERIPH, HAL_DMA_SRC_ADDR_INCREMENTED,
+    HAL_DMA_DEST_ADDR_FIXED, HAL_DMA_SRC_DATA_WIDTH_BYTE, HAL_DMA_DEST_DATA_WIDTH_BYTE,
+    HAL_DMA_PRIORITY_LOW_WEIGHT_HIGH
+  };
+
+  HOST_TEST_Init();
+  CHECK(HAL_UART_Init(&hUart, HAL_UART1) == HAL_OK, "HAL_UART_Init");
+  CHECK(HAL_UART_SetConfig(&hUart, &config) == HAL_OK, "HAL_UART_SetConfig");
+
+  CHECK(HAL_DMA_Init(&hDmaTx, HAL_GPDMA1_CH0) == HAL_OK, "HAL_DMA_Init Tx");
+  CHECK(HAL_DMA_SetConfigDirectXfer(&hDmaTx, &dma_config) == HAL_OK, "Tx DMA configuration");
+  CHECK(HAL_UART_SetTxDMA(&hUart, &hDmaTx) == HAL_OK, "HAL_UART_SetTxDMA");
+
+  dma_config.request = HAL_GPDMA1_REQUEST_USART1_RX;
+  dma_config.direction = HAL_DMA_DIRECTION_PERIPH_TO_MEMORY;
+  dma_config.src_inc = HAL_DMA_SRC_ADDR_FIXED;
+  dma_config.dest_inc = HAL_DMA_DEST_ADDR_INCREMENTED;
+  CHECK(HAL_DMA_Init(&hDmaRx, HAL_GPDMA1_CH1) == HAL_OK, "HAL_DMA_Init Rx");
+  CHECK(HAL_DMA_SetConfigDirectXfer(&hDmaRx, &dma_config) == HAL_OK, "Rx DMA configuration");
+  CHECK(HAL_UART_SetRxDMA(&hUart, &hDmaRx) == HAL_OK, "HAL_UART_SetRxDMA");
+
+  HAL_CORTEX_NVIC_EnableIRQ(USART1_IRQn);
+  HAL_CORTEX_NVIC_EnableIRQ(GPDMA1_CH0_IRQn);
+  HAL_CORTEX_NVIC_EnableIRQ(GPDMA1_CH1_IRQn);
+  HOST_MODEL_UART_SetLoopback(USART1, 1U);
+
+  TxCpltNbr = 0U;
+  RxCpltNbr = 0U;
+  RxSize = 0U;
+  RxEvent = 0U;
+  ErrorNbr = 0U;
+  (void)memset(RxData, 0, sizeof(RxData));
+}
+
+static void TestPolling(void)
+{
+  const uint32_t size = 16U;
+  uint64_t start;
+  uint64_t elapsed;
+  uint64_t frame;
+
+  Start();
+  frame = HOST_MODEL_UART_GetFrameCycles(USART1);
+  CHECK((frame >= ((10U * HOST_MODEL_CPU_FREQ_HZ) / (BAUD_RATE + (BAUD_RATE / 50U))))
+        && (frame <= ((10U * HOST_MODEL_CPU_FREQ_HZ) / (BAUD_RATE - (BAUD_RATE / 50U)))),
+        "frame of %llu cycles for %u bauds", (unsigned long long)frame, (unsigned int)BAUD_RATE);
+
+  start = HOST_MODEL_GetCycles();
+  CHECK(HAL_UART_Transmit(&hUart, TxData, size, 100U) == HAL_OK, "polling transmission");
+  elapsed = HOST_MODEL_GetCycles() - start;
+  /* The function returns on TC, after the last stop bit */
+  CHECK(elapsed >= (size * frame), "%u bytes in %llu cycles", (unsigned int)size, (unsigned long long)elapsed);
+  CHECK(HOST_MODEL_UART_GetTx(USART1, Line, sizeof(Line)) == size, "frames on the line");
+  CHECK(memcmp(Line, TxData, size) == 0, "data on the line");
+}
+
+static void TestInterrupt(void)
+{
+  const uint32_t size = 64U;
+
+  Start();
+  CHECK(HAL_UART_Receive_IT(&hUart, RxData, size) == HAL_OK, "interrupt reception");
+  CHECK(HAL_UART_Transmit_IT(&hUart, TxData, size) == HAL_OK, "interrupt transmission");
+  CHECK(HOST_TEST_Wait(&RxCpltNbr, 100U) == 1U, "no reception completion");
+  CHECK(TxCpltNbr == 1U, "%u transmission completion(s)", (unsigned int)TxCpltNbr);
+  CHECK((RxSize == size) && (RxEvent == (uint32_t)HAL_UART_RX_EVENT_TC), "%u bytes, event %u",
+        (unsigned int)RxSize, (unsigned int)RxEvent);
+  CHECK(memcmp(RxData, TxData, size) == 0, "data received");
+  CHECK(ErrorNbr == 0U, "%u error(s)", (unsigned int)ErrorNbr);
+}
+
+static void TestDma(void)
+{
+  host_model_stats_t stats;
+  uint64_t start;
+  uint64_t elapsed;
+  uint64_t frame;
+
+  Start();
+  frame = HOST_MODEL_UART_GetFrameCycles(USART1);
+  start = HOST_MODEL_GetCycles();
+  CHECK(HAL_UART_Receive_DMA(&hUart, RxData, DATA_SIZE) == HAL_OK, "DMA reception");
+  CHECK(HAL_UART_Transmit_DMA(&hUart, TxData, DATA_SIZE) == HAL_OK, "DMA transmission");
+  CHECK(HOST_TEST_Wait(&RxCpltNbr, 1000U) == 1U, "no reception completion");
+  elapsed = HOST_MODEL_GetCycles() - start;
+  CHECK(TxCpltNbr == 1U, "%u transmission completion(s)", (unsigned int)TxCpltNbr);
+  CHECK(RxSize == DATA_SIZE, "%u bytes received", (unsigned int)RxSize);
+  CHECK(memcmp(RxData, TxData, DATA_SIZE) == 0, "data received");
+  CHECK(ErrorNbr == 0U, "%u error(s)", (unsigned int)ErrorNbr);
+
+  /* The line is the bottleneck: one frame time per byte, plus the last frame received and the completions */
+  CHECK((elapsed >= (DATA_SIZE * frame)) && (elapsed <= (((DATA_SIZE + 2U) * frame))),
+        "%u bytes in %llu cycles, %llu per frame", (unsigned int)DATA_SIZE, (unsigned long long)elapsed,
+        (unsigned long long)frame);
+  /* The bytes are moved by the DMA: the CPU only runs the completion and half completion handlers */
+  HOST_MODEL_GetStats(&stats);
+  CHECK(stats.dma_byte_nbr >= (2U * DATA_SIZE), "%llu bytes moved by the DMA",
+        (unsigned long long)stats.dma_byte_nbr);
+  CHECK(stats.irq_cycle_nbr < (elapsed / 10U), "%llu cycles in the handlers for %llu cycles",
+        (unsigned long long)stats.irq_cycle_nbr, (unsigned long long)elapsed);
+}
+
+static void TestToIdleDma(void)
+{
+  Start();
+  HOST_MODEL_UART_SetLoopback(USART1, 0U);
+  CHECK(HAL_UART_ReceiveToIdle_DMA(&hUart, RxData, DATA_SIZE) == HAL_OK, "reception to idle");
+  HOST_MODEL_UART_Feed(USART1, TxData, BURST_SIZE, 4U);
+  CHECK(HOST_TEST_Wait(&RxCpltNbr, 100U) == 1U, "no completion on idle");
+  CHECK((RxSize == BURST_SIZE) && (RxEvent == (uint32_t)HAL_UART_RX_EVENT_IDLE), "%u bytes, event %u",
+        (unsigned int)RxSize, (unsigned int)RxEvent);
+  CHECK(memcmp(RxData, TxData, BURST_SIZE) == 0, "data received");
+  CHECK(ErrorNbr == 0U, "%u error(s)", (unsigned int)ErrorNbr);
+}
+
+/* Tx channel in linked-list mode with the nodes of HAL_UART_TransmitV_DMA() */
+static void StartTransmitV(hal_dma_src_data_width_t src_width)
+{
+  const hal_dma_linkedlist_xfer_config_t ll_config =
+  {
+    HAL_DMA_PRIORITY_LOW_WEIGHT_HIGH, HAL_DMA_PORT0, HAL_DMA_LINKEDLIST_XFER_EVENT_Q
+  };
+  hal_dma_node_config_t node_config;
+
+  Start();
+  (void)memset(&node_config, 0, sizeof(node_config));
+  node_config.xfer.request = HAL_GPDMA1_REQUEST_USART1_TX;
+  node_config.xfer.direction = HAL_DMA_DIRECTION_MEMORY_TO_PERIPH;
+  node_config.xfer.src_inc = HAL_DMA_SRC_ADDR_INCREMENTED;
+  node_config.xfer.dest_inc = HAL_DMA_DEST_ADDR_FIXED;
+  node_config.xfer.src_data_width = src_width;
+  node_config.xfer.dest_data_width = HAL_DMA_DEST_DATA_WIDTH_BYTE;
+  node_config.xfer.priority = HAL_DMA_PRIORITY_LOW_WEIGHT_HIGH;
+  node_config.src_burst_length_byte = 1U;
+  node_config.dest_burst_length_byte = 1U;
+  CHECK(HAL_DMA_SetConfigLinkedListXfer(&hDmaTx, &ll_config) == HAL_OK, "Tx DMA linked-list configuration");
+  CHECK(HAL_UART_SetTxDMANodes(&hUart, TxNodes, TX_NODE_NBR, &node_config) == HAL_OK, "HAL_UART_SetTxDMANodes");
+}
+
+static void TestTransmitV(void)
+{
+  static const uint8_t header[3] = {'A', 'T', '+'};
+  static const uint8_t trailer[2] = {'\r', '\n'};
+  const hal_uart_iovec_t iov[3] = {{header, sizeof(header)}, {TxData, BURST_SIZE}, {trailer, sizeof(trailer)}};
+  const hal_uart_iovec_t even_iov[2] = {{TxData, 8U}, {&TxData[8], 6U}};
+  uint32_t size;
+  uint32_t fetch_nbr;
+
+  StartTransmitV(HAL_DMA_SRC_DATA_WIDTH_BYTE);
+  HOST_MODEL_UART_SetLoopback(USART1, 0U);
+  HOST_MODEL_DMA_SetFetchLog(Fetches, 8U);
+  CHECK(HAL_UART_TransmitV_DMA(&hUart, iov, 3U) == HAL_OK, "scatter-gather transmission");
+  CHECK(HOST_TEST_Wait(&TxCpltNbr, 100U) == 1U, "no completion");
+  CHECK(HAL_UART_GetTxState(&hUart) == HAL_UART_TX_STATE_IDLE, "Tx state %d", (int)HAL_UART_GetTxState(&hUart));
+  CHECK(ErrorNbr == 0U, "%u error(s)", (unsigned int)ErrorNbr);
+
+  /* The segments back to back on the line */
+  size = HOST_MODEL_UART_GetTx(USART1, Line, sizeof(Line));
+  CHECK(size == (sizeof(header) + BURST_SIZE + sizeof(trailer)), "%u frames on the line", (unsigned int)size);
+  CHECK(memcmp(Line, header, sizeof(header)) == 0, "header on the line");
+  CHECK(memcmp(&Line[sizeof(header)], TxData, BURST_SIZE) == 0, "payload on the line");
+  CHECK(memcmp(&Line[sizeof(header) + BURST_SIZE], trailer, sizeof(trailer)) == 0, "trailer on the line");
+
+  /* One node per segment, loaded in order */
+  fetch_nbr = HOST_MODEL_DMA_GetFetchNbr();
+  CHECK(fetch_nbr == 3U, "%u node(s) loaded for 3 segments", (unsigned int)fetch_nbr);
+  for (uint32_t i = 0U; (i < fetch_nbr) && (i < 3U); i++)
+  {
+    CHECK(Fetches[i].address == (uint32_t)&TxNodes[i], "load %u: node at 0x%08X", (unsigned int)i,
+          (unsigned int)Fetches[i].address);
+  }
+  HOST_MODEL_DMA_SetFetchLog(NULL, 0U);
+
+  /* Half-word source: segments of whole half-words */
+  StartTransmitV(HAL_DMA_SRC_DATA_WIDTH_HALFWORD);
+  CHECK(HAL_UART_TransmitV_DMA(&hUart, iov, 3U) == HAL_INVALID_PARAM, "segment of 3 bytes with a half-word source");
+  CHECK(HAL_UART_GetTxState(&hUart) == HAL_UART_TX_STATE_IDLE, "Tx state %d", (int)HAL_UART_GetTxState(&hUart));
+
+  /* 9-bit frames without parity: u16 data elements */
+  StartTransmitV(HAL_DMA_SRC_DATA_WIDTH_HALFWORD);
+  CHECK(HAL_UART_SetWordLength(&hUart, HAL_UART_WORD_LENGTH_9_BIT) == HAL_OK, "9-bit frames");
+  CHECK(HAL_UART_TransmitV_DMA(&hUart, iov, 3U) == HAL_INVALID_PARAM, "odd segment with 9-bit frames");
+  StartTransmitV(HAL_DMA_SRC_DATA_WIDTH_BYTE);
+  CHECK(HAL_UART_SetWordLength(&hUart, HAL_UART_WORD_LENGTH_9_BIT) == HAL_OK, "9-bit frames");
+  CHECK(HAL_UART_TransmitV_DMA(&hUart, even_iov, 2U) == HAL_ERROR, "byte source for 9-bit frames");
+  CHECK(HAL_UART_GetLastErrorCodes(&hUart) == HAL_UART_TRANSMIT_ERROR_DMA, "error codes 0x%X",
+        (unsigned int)HAL_UART_GetLastErrorCodes(&hUart));
+  CHECK(HAL_UART_GetTxState(&hUart) == HAL_UART_TX_STATE_IDLE, "Tx state %d", (int)HAL_UART_GetTxState(&hUart));
+  CHECK(HOST_MODEL_UART_GetTx(USART1, Line, sizeof(Line)) == 0U, "frames on the line");
+}
+
+static void TestCircularTransmit(void)
+{
+  const hal_dma_direct_xfer_config_t dma_config =
+  {
+    HAL_GPDMA1_REQUEST_USART1_TX, HAL_DMA_DIRECTION_MEMORY_TO_PERIPH, HAL_DMA_SRC_ADDR_INCREMENTED,
+    HAL_DMA_DEST_ADDR_FIXED, HAL_DMA_SRC_DATA_WIDTH_BYTE, HAL_DMA_DEST_DATA_WIDTH_BYTE,
+    HAL_DMA_PRIORITY_LOW_WEIGHT_HIGH
+  };
+  uint32_t size;
+
+  Start();
+  HOST_MODEL_UART_SetLoopback(USART1, 0U);
+  CHECK(HAL_DMA_SetConfigPeriphLinkedListCircularXfer(&hDmaTx, &CircularNode, &dma_config) == HAL_OK,
+        "Tx DMA circular configuration");
+  CHECK(HAL_UART_Transmit_DMA(&hUart, TxData, LAP_SIZE) == HAL_OK, "circular DMA transmission");
+
+  /* A completion per lap, without the end of the transmission */
+  {
+    const uint32_t tickstart = HAL_GetTick();
+
+    while ((TxCpltNbr < 3U) && ((HAL_GetTick() - tickstart) < 100U))
+    {
+    }
+  }
+  CHECK(TxCpltNbr >= 3U, "%u lap completion(s)", (unsigned int)TxCpltNbr);
+  CHECK(HAL_UART_GetTxState(&hUart) == HAL_UART_TX_STATE_ACTIVE, "Tx state %d", (int)HAL_UART_GetTxState(&hUart));
+  CHECK(HAL_UART_AbortTransmit(&hUart) == HAL_OK, "HAL_UART_AbortTransmit");
+  CHECK(HAL_UART_GetTxState(&hUart) == HAL_UART_TX_STATE_IDLE, "Tx state %d", (int)HAL_UART_GetTxState(&hUart));
+
+  size = HOST_MODEL_UART_GetTx(USART1, Line, sizeof(Line));
+  /* The last two bytes moved by the DMA were in TDR and in the shift register at the abort */
+  CHECK(size >= ((3U * LAP_SIZE) - 2U), "%u frames on the line for 3 laps", (unsigned int)size);
+  for (uint32_t i = 0U; i < size; i++)
+  {
+    if (Line[i] != TxData[i % LAP_SIZE])
+    {
+      CHECK(0, "frame %u: 0x%02X instead of 0x%02X", (unsigned int)i, (unsigned int)Line[i],
+            (unsigned int)TxData[i % LAP_SIZE]);
+      break;
+    }
+  }
+  CHECK(ErrorNbr == 0U, "%u error(s)", (unsigned int)ErrorNbr);
+}
+
+/* Reception stream on a circular Rx channel, the line fed by the test */
+static void StartRxStream(void)
+{
+  const hal_dma_direct_xfer_config_t dma_config =
+  {
+    HAL_GPDMA1_REQUEST_USART1_RX, HAL_DMA_DIRECTION_PERIPH_TO_MEMORY, HAL_DMA_SRC_ADDR_FIXED,
+    HAL_DMA_DEST_ADDR_INCREMENTED, HAL_DMA_SRC_DATA_WIDTH_BYTE, HAL_DMA_DEST_DATA_WIDTH_BYTE,
+    HAL_DMA_PRIORITY_LOW_WEIGHT_HIGH
+  };
+
+  Start();
+  HOST_MODEL_UART_SetLoopback(USART1, 0U);
+  CHECK(HAL_DMA_SetConfigPeriphLinkedListCircularXfer(&hDmaRx, &RxNode, &dma_config) == HAL_OK,
+        "Rx DMA circular configuration");
+  CHECK(HAL_UART_StartRxStream_DMA(&hUart, Ring, RING_SIZE) == HAL_OK, "HAL_UART_StartRxStream_DMA");
+  StreamSize = 0U;
+  SpanNbr = 0U;
+  IdleNbr = 0U;
+}
+
+/* Feeds a burst, waits for its idle event and checks the data reported for it */
+static void FeedStream(uint32_t start, uint32_t size)
+{
+  const uint32_t idle_nbr = IdleNbr;
+  const uint32_t tickstart = HAL_GetTick();
+
+  HOST_MODEL_UART_Feed(USART1, &TxData[start], size, 4U);
+  while ((IdleNbr == idle_nbr) && ((HAL_GetTick() - tickstart) < 100U))
+  {
+  }
+  CHECK(IdleNbr == (idle_nbr + 1U), "no idle event for the burst of %u bytes", (unsigned int)size);
+  CHECK(StreamSize == (start + size), "%u bytes reported instead of %u", (unsigned int)StreamSize,
+        (unsigned int)(start + size));
+  CHECK(memcmp(&Stream[start], &TxData[start], size) == 0, "data of the burst of %u bytes", (unsigned int)size);
+}
+
+static void CheckSpan(uint32_t index, uint32_t offset, uint32_t size, hal_uart_rx_event_types_t event)
+{
+  CHECK((Spans[index].offset == offset) && (Spans[index].size == size) && (Spans[index].event == event),
+        "span %u: offset %u, %u bytes, event %u instead of %u, %u, %u", (unsigned int)index,
+        (unsigned int)Spans[index].offset, (unsigned int)Spans[index].size, (unsigned int)Spans[index].event,
+        (unsigned int)offset, (unsigned int)size, (unsigned int)event);
+}
+
+static void TestRxStream(void)
+{
+  uint32_t count;
+
+  StartRxStream();
+
+  /* 40 bytes: half buffer event, then idle */
+  FeedStream(0U, 40U);
+  CHECK(SpanNbr == 2U, "%u span(s)", (unsigned int)SpanNbr);
+  CheckSpan(0U, 0U, 32U, HAL_UART_RX_EVENT_HT);
+  CheckSpan(1U, 32U, 8U, HAL_UART_RX_EVENT_IDLE);
+  CHECK(HAL_UART_GetRxStreamCount(&hUart) == 40U, "count %u", (unsigned int)HAL_UART_GetRxStreamCount(&hUart));
+
+  /* Partial consumption */
+  CHECK(HAL_UART_ConsumeRx(&hUart, 30U) == HAL_OK, "HAL_UART_ConsumeRx");
+  CHECK(HAL_UART_GetRxStreamCount(&hUart) == 10U, "count %u", (unsigned int)HAL_UART_GetRxStreamCount(&hUart));
+
+  /* 40 bytes across the end of the buffer: full buffer event, then idle from the start of the buffer */
+  FeedStream(40U, 40U);
+  CHECK(SpanNbr == 4U, "%u span(s)", (unsigned int)SpanNbr);
+  CheckSpan(2U, 40U, 24U, HAL_UART_RX_EVENT_TC);
+  CheckSpan(3U, 0U, 16U, HAL_UART_RX_EVENT_IDLE);
+  CHECK(HAL_UART_GetRxStreamCount(&hUart) == 50U, "count %u", (unsigned int)HAL_UART_GetRxStreamCount(&hUart));
+  CHECK(HAL_UART_GetLastErrorCodes(&hUart) == 0U, "error codes 0x%X", (unsigned int)HAL_UART_GetLastErrorCodes(&hUart));
+
+  /* Consumption across the end of the buffer, then a second lap */
+  CHECK(HAL_UART_ConsumeRx(&hUart, 50U) == HAL_OK, "HAL_UART_ConsumeRx");
+  CHECK(HAL_UART_GetRxStreamCount(&hUart) == 0U, "count %u", (unsigned int)HAL_UART_GetRxStreamCount(&hUart));
+  FeedStream(80U, 50U);
+  CHECK(HAL_UART_GetRxStreamCount(&hUart) == 50U, "count %u", (unsigned int)HAL_UART_GetRxStreamCount(&hUart));
+  CHECK(HAL_UART_GetLastErrorCodes(&hUart) == 0U, "error codes 0x%X", (unsigned int)HAL_UART_GetLastErrorCodes(&hUart));
+
+  /* Overrun: 50 bytes not consumed and 31 new bytes, the oldest ones overwritten */
+  FeedStream(130U, 31U);
+  count = HAL_UART_GetRxStreamCount(&hUart);
+  CHECK(count == 31U, "count %u after the overrun", (unsigned int)count);
+  CHECK(HAL_UART_GetLastErrorCodes(&hUart) == HAL_UART_RECEIVE_ERROR_STREAM_OVR, "error codes 0x%X",
+        (unsigned int)HAL_UART_GetLastErrorCodes(&hUart));
+  CHECK(ErrorNbr == 0U, "%u error(s)", (unsigned int)ErrorNbr);
+  CHECK(HAL_UART_AbortReceive(&hUart) == HAL_OK, "HAL_UART_AbortReceive");
+
+  /* A whole lap and more while the interrupts are masked: the flags of the missed events are merged */
+  StartRxStream();
+  HAL_CORTEX_NVIC_DisableIRQ(USART1_IRQn);
+  HAL_CORTEX_NVIC_DisableIRQ(GPDMA1_CH1_IRQn);
+  HOST_MODEL_UART_Feed(USART1, TxData, 100U, 4U);
+  HOST_MODEL_Run(110U * HOST_MODEL_UART_GetFrameCycles(USART1));
+  CHECK(SpanNbr == 0U, "%u span(s) reported with the interrupts masked", (unsigned int)SpanNbr);
+  HAL_CORTEX_NVIC_EnableIRQ(GPDMA1_CH1_IRQn);
+  HAL_CORTEX_NVIC_EnableIRQ(USART1_IRQn);
+  HOST_MODEL_Run(100U);
+  count = HAL_UART_GetRxStreamCount(&hUart);
+  CHECK((count != 0U) && (count <= RING_SIZE), "count %u after a whole lap", (unsigned int)count);
+  CHECK(HAL_UART_GetLastErrorCodes(&hUart) == HAL_UART_RECEIVE_ERROR_STREAM_OVR, "error codes 0x%X after a whole lap",
+        (unsigned int)HAL_UART_GetLastErrorCodes(&hUart));
+  CHECK(HAL_UART_AbortReceive(&hUart) == HAL_OK, "HAL_UART_AbortReceive");
+}
+
+/* Exported functions --------------------------------------------------------*/
+int main(void)
+{
+  for (uint32_t i = 0U; i < DATA_SIZE; i++)
+  {
+    TxData[i] = (uint8_t)((i * 7U) + (i >> 8U));
+  }
+
+  TestPolling();
+  TestInterrupt();
+  TestDma();
+  TestToIdleDma();
+  TestTransmitV();
+  TestCircularTransmit();
+  TestRxStream();
+
+  return HOST_TEST_Report();
+}
@@ -0,0 +1,379 @@
+/**
+  ******************************************************************************
+  * @file    test_i2c_batch.c
+  * @brief   Host tests of the I2C command list engine on a mocked I2C HAL
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ * The model has no I2C: the memory read and write functions of the I2C HAL are defined here and start an access on a
+ * device of 256 8-bit registers, which the test completes or fails in place of the I2C interrupt. The ticks of the
+ * engine are given by the test.
+ * - sequencing of a list: write, delay, poll and read, each access started from the completion of the previous one,
+ *   the delay and the poll interval counted in ticks, the data written and read, one completion callback,
+ * - poll retries exhausted: the completion with timeout after retry + 1 reads,
+ * - error of an access, at its start or from the I2C error callback: the completion with error, the rest of the list
+ *   not run,
+ * - periodic list in DMA mode: an execution every period ticks counted from the start of the previous one, the
+ *   start refused while a list runs, an execution longer than the period started again at once, and the stop.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#define _POSIX_C_SOURCE 200809L
+#include <string.h>
+
+#include "host_model.h"
+#include "host_test.h"
+#include "stm32_hal.h"
+#include "stm32_utils_i2c_batch.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define DEV_ADDR          0xA0U
+#define REG_CTRL          0x01U
+#define REG_STATUS        0x10U
+#define REG_DATA          0x20U
+#define STATUS_READY      0x01U
+#define LOG_SIZE          16U
+
+/* Private types -------------------------------------------------------------*/
+/** Register access started by the engine */
+typedef struct
+{
+  uint32_t write;               /*!< 1 for a write, 0 for a read                                 */
+  uint32_t dma;                 /*!< 1 when started by the DMA variant                           */
+  uint32_t reg;                 /*!< Register address                                            */
+  uint32_t size_byte;           /*!< Number of bytes                                             */
+} access_t;
+
+/* Private variables ---------------------------------------------------------*/
+static hal_i2c_handle_t hI2c;
+static stm32_utils_i2c_batch_t Batch;
+static uint8_t Regs[256];
+static uint32_t StatusReadNbr;
+static uint32_t StatusReadyRead;  /*!< Status read returning the ready bit first, 0 for never */
+static hal_status_t StartStatus;
+static access_t Log[LOG_SIZE];
+static uint32_t LogNbr;
+static uint32_t Pending;
+static void *p_PendingData;
+static uint32_t CbNbr;
+static stm32_utils_i2c_batch_status_t CbStatus;
+
+static const uint8_t CtrlValue[2] = {0x5AU, 0xC3U};
+static uint8_t DataRead[4];
+
+/* Mocked I2C HAL ------------------------------------------------------------*/
+static hal_status_t Access(uint32_t write, uint32_t dma, uint32_t device_addr, uint32_t memory_addr,
+                           hal_i2c_mem_addr_size_t memory_addr_size, const void *p_data, uint32_t size_byte)
+{
+  CHECK(Pending == 0U, "access started before the completion of the previous one");
+  CHECK((device_addr == DEV_ADDR) && (memory_addr_size == HAL_I2C_MEM_ADDR_8BIT), "device 0x%X",
+        (unsigned int)device_addr);
+  if (StartStatus != HAL_OK)
+  {
+    return StartStatus;
+  }
+  if (LogNbr < LOG_SIZE)
+  {
+    Log[LogNbr].write = write;
+    Log[LogNbr].dma = dma;
+    Log[LogNbr].reg = memory_addr;
+    Log[LogNbr].size_byte = size_byte;
+  }
+  LogNbr++;
+  Pending = 1U;
+  p_PendingData = (void *)(uintptr_t)p_data;
+  return HAL_OK;
+}
+
+hal_status_t HAL_I2C_MASTER_MemWrite_IT(hal_i2c_handle_t *hi2c, uint32_t device_addr, uint32_t memory_addr,
+                                        hal_i2c_mem_addr_size_t memory_addr_size, const void *p_data,
+                                        uint32_t size_byte)
+{
+  (void)hi2c;
+  return Access(1U, 0U, device_addr, memory_addr, memory_addr_size, p_data, size_byte);
+}
+
+hal_status_t HAL_I2C_MASTER_MemRead_IT(hal_i2c_handle_t *hi2c, uint32_t device_addr, uint32_t memory_addr,
+                                       hal_i2c_mem_addr_size_t memory_addr_size, void *p_data, uint32_t size_byte)
+{
+  (void)hi2c;
+  return Access(0U, 0U, device_addr, memory_addr, memory_addr_size, p_data, size_byte);
+}
+
+hal_status_t HAL_I2C_MASTER_MemWrite_DMA(hal_i2c_handle_t *hi2c, uint32_t device_addr, uint32_t memory_addr,
+                                         hal_i2c_mem_addr_size_t memory_addr_size, const void *p_data,
+                                         uint32_t size_byte)
+{
+  (void)hi2c;
+  return Access(1U, 1U, device_addr, memory_addr, memory_addr_size, p_data, size_byte);
+}
+
+hal_status_t HAL_I2C_MASTER_MemRead_DMA(hal_i2c_handle_t *hi2c, uint32_t device_addr, uint32_t memory_addr,
+                                        hal_i2c_mem_addr_size_t memory_addr_size, void *p_data, uint32_t size_byte)
+{
+  (void)hi2c;
+  return Access(0U, 1U, device_addr, memory_addr, memory_addr_size, p_data, size_byte);
+}
+
+/* Handlers and callbacks ----------------------------------------------------*/
+static void BatchCb(stm32_utils_i2c_batch_t *p_batch, stm32_utils_i2c_batch_status_t status)
+{
+  (void)p_batch;
+  CbNbr++;
+  CbStatus = status;
+}
+
+/* Private functions ---------------------------------------------------------*/
+static void Start(stm32_utils_i2c_batch_mode_t mode)
+{
+  HOST_TEST_Init();
+  CHECK(STM32_UTILS_I2C_BATCH_Init(&Batch, &hI2c, mode) == STM32_UTILS_I2C_BATCH_OK, "STM32_UTILS_I2C_BATCH_Init");
+  (void)memset(Regs, 0, sizeof(Regs));
+  (void)memset(Log, 0, sizeof(Log));
+  (void)memset(DataRead, 0, sizeof(DataRead));
+  for (uint32_t i = 0U; i < sizeof(DataRead); i++)
+  {
+    Regs[REG_DATA + i] = (uint8_t)(0x11U * (i + 1U));
+  }
+  StatusReadNbr = 0U;
+  StatusReadyRead = 0U;
+  StartStatus = HAL_OK;
+  LogNbr = 0U;
+  Pending = 0U;
+  CbNbr = 0U;
+  CbStatus = STM32_UTILS_I2C_BATCH_BUSY;
+}
+
+/* Completes the access in progress on the device, as the I2C interrupt would */
+static void Complete(void)
+{
+  const access_t *p_access = &Log[LogNbr - 1U];
+  uint8_t *p_data = (uint8_t *)p_PendingData;
+
+  CHECK(Pending == 1U, "no access to complete");
+  Pending = 0U;
+  for (uint32_t i = 0U; i < p_access->size_byte; i++)
+  {
+    if (p_access->write != 0U)
+    {
+      Regs[p_access->reg + i] = p_data[i];
+    }
+    else
+    {
+      p_data[i] = Regs[p_access->reg + i];
+    }
+  }
+  if ((p_access->write == 0U) && (p_access->reg == REG_STATUS))
+  {
+    StatusReadNbr++;
+    p_data[0] = ((StatusReadyRead != 0U) && (StatusReadNbr >= StatusReadyRead)) ? STATUS_READY : 0U;
+  }
+  STM32_UTILS_I2C_BATCH_XferCpltCallback(&hI2c);
+}
+
+static void Fail(void)
+{
+  CHECK(Pending == 1U, "no access to fail");
+  Pending = 0U;
+  STM32_UTILS_I2C_BATCH_ErrorCallback(&hI2c);
+}
+
+/* Gives tick_nbr ticks and returns the number of them after which an access was pending, 0 for none */
+static uint32_t Tick(uint32_t tick_nbr)
+{
+  for (uint32_t i = 1U; i <= tick_nbr; i++)
+  {
+    STM32_UTILS_I2C_BATCH_IncTick();
+    if (Pending != 0U)
+    {
+      return i;
+    }
+  }
+  return 0U;
+}
+
+static void CheckAccess(uint32_t index, uint32_t write, uint32_t reg, uint32_t size_byte)
+{
+  CHECK(LogNbr > index, "access %u not started", (unsigned int)index);
+  CHECK((Log[index].write == write) && (Log[index].reg == reg) && (Log[index].size_byte == size_byte),
+        "access %u: %s of %u bytes at 0x%02X instead of %s of %u bytes at 0x%02X", (unsigned int)index,
+        (Log[index].write != 0U) ? "write" : "read", (unsigned int)Log[index].size_byte, (unsigned int)Log[index].reg,
+        (write != 0U) ? "write" : "read", (unsigned int)size_byte, (unsigned int)reg);
+}
+
+static void TestSequence(void)
+{
+  const stm32_utils_i2c_batch_cmd_t cmds[] =
+  {
+    STM32_UTILS_I2C_BATCH_WRITE_REG(DEV_ADDR, REG_CTRL, CtrlValue, sizeof(CtrlValue)),
+    STM32_UTILS_I2C_BATCH_DELAY(3U),
+    STM32_UTILS_I2C_BATCH_POLL(DEV_ADDR, REG_STATUS, STATUS_READY, STATUS_READY, 2U, 5U),
+    STM32_UTILS_I2C_BATCH_READ_REG(DEV_ADDR, REG_DATA, DataRead, sizeof(DataRead)),
+  };
+
+  Start(STM32_UTILS_I2C_BATCH_MODE_IT);
+  StatusReadyRead = 3U;
+  CHECK(STM32_UTILS_I2C_BATCH_Start(&Batch, cmds, 4U, 0U, BatchCb) == STM32_UTILS_I2C_BATCH_OK,
+        "STM32_UTILS_I2C_BATCH_Start");
+  CheckAccess(0U, 1U, REG_CTRL, sizeof(CtrlValue));
+  Complete();
+  CHECK((Regs[REG_CTRL] == CtrlValue[0]) && (Regs[REG_CTRL + 1U] == CtrlValue[1]), "registers written");
+
+  /* Delay of 3 ticks, then a poll read every 2 ticks until the third one */
+  CHECK(Tick(10U) == 3U, "delay");
+  CheckAccess(1U, 0U, REG_STATUS, 1U);
+  Complete();
+  CHECK(Tick(10U) == 2U, "first poll interval");
+  CheckAccess(2U, 0U, REG_STATUS, 1U);
+  Complete();
+  CHECK(Tick(10U) == 2U, "second poll interval");
+  CheckAccess(3U, 0U, REG_STATUS, 1U);
+  Complete();
+
+  /* The read follows the last poll read at once */
+  CheckAccess(4U, 0U, REG_DATA, sizeof(DataRead));
+  CHECK(CbNbr == 0U, "completion before the end of the list");
+  Complete();
+  CHECK((CbNbr == 1U) && (CbStatus == STM32_UTILS_I2C_BATCH_OK), "%u completion(s), status 0x%X",
+        (unsigned int)CbNbr, (unsigned int)CbStatus);
+  CHECK(memcmp(DataRead, &Regs[REG_DATA], sizeof(DataRead)) == 0, "registers read");
+  CHECK(LogNbr == 5U, "%u accesses", (unsigned int)LogNbr);
+  CHECK(STM32_UTILS_I2C_BATCH_IsRunning(&Batch) == 0U, "still running");
+  CHECK((STM32_UTILS_I2C_BATCH_GetRunCount(&Batch) == 1U) && (STM32_UTILS_I2C_BATCH_GetErrorCount(&Batch) == 0U),
+        "%u run(s), %u error(s)", (unsigned int)STM32_UTILS_I2C_BATCH_GetRunCount(&Batch),
+        (unsigned int)STM32_UTILS_I2C_BATCH_GetErrorCount(&Batch));
+  CHECK(Tick(10U) == 0U, "access after the end of the list");
+}
+
+static void TestPollTimeout(void)
+{
+  const stm32_utils_i2c_batch_cmd_t cmds[] =
+  {
+    STM32_UTILS_I2C_BATCH_POLL(DEV_ADDR, REG_STATUS, STATUS_READY, STATUS_READY, 0U, 2U),
+    STM32_UTILS_I2C_BATCH_READ_REG(DEV_ADDR, REG_DATA, DataRead, sizeof(DataRead)),
+  };
+
+  /* Without interval, the reads follow one another */
+  Start(STM32_UTILS_I2C_BATCH_MODE_IT);
+  CHECK(STM32_UTILS_I2C_BATCH_Start(&Batch, cmds, 2U, 0U, BatchCb) == STM32_UTILS_I2C_BATCH_OK,
+        "STM32_UTILS_I2C_BATCH_Start");
+  for (uint32_t i = 0U; (i < 3U) && (Pending != 0U); i++)
+  {
+    CheckAccess(i, 0U, REG_STATUS, 1U);
+    Complete();
+  }
+  CHECK(Pending == 0U, "read after the retries");
+  CHECK((CbNbr == 1U) && (CbStatus == STM32_UTILS_I2C_BATCH_TIMEOUT), "%u completion(s), status 0x%X",
+        (unsigned int)CbNbr, (unsigned int)CbStatus);
+  CHECK(LogNbr == 3U, "%u reads", (unsigned int)LogNbr);
+  CHECK(STM32_UTILS_I2C_BATCH_GetErrorCount(&Batch) == 1U, "%u error(s)",
+        (unsigned int)STM32_UTILS_I2C_BATCH_GetErrorCount(&Batch));
+  CHECK(STM32_UTILS_I2C_BATCH_IsRunning(&Batch) == 0U, "still running");
+}
+
+static void TestError(void)
+{
+  const stm32_utils_i2c_batch_cmd_t cmds[] =
+  {
+    STM32_UTILS_I2C_BATCH_WRITE_REG(DEV_ADDR, REG_CTRL, CtrlValue, sizeof(CtrlValue)),
+    STM32_UTILS_I2C_BATCH_READ_REG(DEV_ADDR, REG_DATA, DataRead, sizeof(DataRead)),
+  };
+
+  /* Error reported by the I2C interrupt */
+  Start(STM32_UTILS_I2C_BATCH_MODE_IT);
+  CHECK(STM32_UTILS_I2C_BATCH_Start(&Batch, cmds, 2U, 0U, BatchCb) == STM32_UTILS_I2C_BATCH_OK,
+        "STM32_UTILS_I2C_BATCH_Start");
+  Fail();
+  CHECK((CbNbr == 1U) && (CbStatus == STM32_UTILS_I2C_BATCH_ERROR), "%u completion(s), status 0x%X",
+        (unsigned int)CbNbr, (unsigned int)CbStatus);
+  CHECK((LogNbr == 1U) && (Pending == 0U), "%u access(es) after the error", (unsigned int)LogNbr);
+  CHECK(STM32_UTILS_I2C_BATCH_IsRunning(&Batch) == 0U, "still running");
+
+  /* Access refused by the HAL: the list ends before the Start returns */
+  StartStatus = HAL_BUSY;
+  CHECK(STM32_UTILS_I2C_BATCH_Start(&Batch, cmds, 2U, 0U, BatchCb) == STM32_UTILS_I2C_BATCH_OK,
+        "STM32_UTILS_I2C_BATCH_Start");
+  CHECK((CbNbr == 2U) && (CbStatus == STM32_UTILS_I2C_BATCH_ERROR), "%u completion(s), status 0x%X",
+        (unsigned int)CbNbr, (unsigned int)CbStatus);
+  CHECK(STM32_UTILS_I2C_BATCH_GetErrorCount(&Batch) == 2U, "%u error(s)",
+        (unsigned int)STM32_UTILS_I2C_BATCH_GetErrorCount(&Batch));
+  CHECK(STM32_UTILS_I2C_BATCH_IsRunning(&Batch) == 0U, "still running");
+}
+
+static void TestPeriodic(void)
+{
+  const stm32_utils_i2c_batch_cmd_t cmds[] =
+  {
+    STM32_UTILS_I2C_BATCH_READ_REG(DEV_ADDR, REG_DATA, DataRead, sizeof(DataRead)),
+  };
+  const stm32_utils_i2c_batch_cmd_t long_cmds[] =
+  {
+    STM32_UTILS_I2C_BATCH_DELAY(3U),
+    STM32_UTILS_I2C_BATCH_READ_REG(DEV_ADDR, REG_DATA, DataRead, sizeof(DataRead)),
+  };
+
+  Start(STM32_UTILS_I2C_BATCH_MODE_DMA);
+  CHECK(STM32_UTILS_I2C_BATCH_Start(&Batch, cmds, 1U, 5U, BatchCb) == STM32_UTILS_I2C_BATCH_OK,
+        "STM32_UTILS_I2C_BATCH_Start");
+  CHECK(STM32_UTILS_I2C_BATCH_Start(&Batch, cmds, 1U, 5U, BatchCb) == STM32_UTILS_I2C_BATCH_BUSY,
+        "second start accepted");
+  CheckAccess(0U, 0U, REG_DATA, sizeof(DataRead));
+  CHECK(Log[0].dma == 1U, "access not started in DMA mode");
+
+  /* The period counts from the start of the execution: the tick during the access is part of it */
+  STM32_UTILS_I2C_BATCH_IncTick();
+  CHECK(LogNbr == 1U, "access started during the first one");
+  Complete();
+  CHECK((CbNbr == 1U) && (CbStatus == STM32_UTILS_I2C_BATCH_OK), "%u completion(s)", (unsigned int)CbNbr);
+  CHECK(STM32_UTILS_I2C_BATCH_IsRunning(&Batch) == 1U, "not running between two executions");
+  CHECK(Tick(10U) == 4U, "second execution");
+  Complete();
+  CHECK(Tick(10U) == 5U, "third execution");
+  Complete();
+  CHECK((CbNbr == 3U) && (STM32_UTILS_I2C_BATCH_GetRunCount(&Batch) == 3U), "%u completion(s), %u run(s)",
+        (unsigned int)CbNbr, (unsigned int)STM32_UTILS_I2C_BATCH_GetRunCount(&Batch));
+
+  /* Stop between two executions */
+  STM32_UTILS_I2C_BATCH_Stop(&Batch);
+  CHECK(STM32_UTILS_I2C_BATCH_IsRunning(&Batch) == 0U, "running after the stop");
+  CHECK(Tick(20U) == 0U, "execution after the stop");
+
+  /* Executions of 3 ticks and more with a period of 2: the next one starts with the completion */
+  Start(STM32_UTILS_I2C_BATCH_MODE_DMA);
+  CHECK(STM32_UTILS_I2C_BATCH_Start(&Batch, long_cmds, 2U, 2U, BatchCb) == STM32_UTILS_I2C_BATCH_OK,
+        "STM32_UTILS_I2C_BATCH_Start");
+  CHECK(Tick(10U) == 3U, "delay");
+  Complete();
+  CHECK((CbNbr == 1U) && (Pending == 0U) && (STM32_UTILS_I2C_BATCH_IsRunning(&Batch) == 1U),
+        "second execution not started");
+  CHECK(Tick(10U) == 3U, "delay of the second execution");
+
+  /* Stop during an execution: it completes, and no other one starts */
+  STM32_UTILS_I2C_BATCH_Stop(&Batch);
+  Complete();
+  CHECK((CbNbr == 2U) && (CbStatus == STM32_UTILS_I2C_BATCH_OK), "%u completion(s)", (unsigned int)CbNbr);
+  CHECK(STM32_UTILS_I2C_BATCH_IsRunning(&Batch) == 0U, "running after the stop");
+  CHECK(Tick(20U) == 0U, "execution after the stop");
+}
+
+/* Exported functions --------------------------------------------------------*/
+int main(void)
+{
+  TestSequence();
+  TestPollTimeout();
+  TestError();
+  TestPeriodic();
+
+  return HOST_TEST_Report();
+}
@@ -0,0 +1,653 @@
+/**
+  ******************************************************************************
+  * @file    test_pka_queue.c
+  * @brief   Host tests of the PKA job queue on a mocked PKA HAL
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ * The model has no PKA: the configuration, compute and result functions of the PKA HAL used by the queue are defined
+ * here. They log the parameter loads and start an operation, which the test completes or fails in place of the PKA
+ * interrupt. The results are derived from the operands (a signature is valid when r and the hash start with the same
+ * byte), the arithmetic and the PKA RAM are not modeled.
+ * - order: jobs of the three operations run one at a time in their submission order, the next one started from the
+ *   completion of the previous one, the results read into the jobs and one callback per job;
+ * - reuse of the parameters: a batch of verifications on a curve loads it once, a job submitted meanwhile runs after
+ *   the batch, a change of operation or of curve, or the same curve at another address, loads all the parameters,
+ *   and without reuse_params every job loads them;
+ * - errors: a configuration or a start refused by the HAL ends the job before the submission returns, a PKA error
+ *   aborts the operation and a multiplication result in error ends the job with error; after a configuration, start
+ *   or PKA error the next job loads all its parameters; invalid parameters are refused;
+ * - callbacks: a job without callback, a job submitted from the callback of another one;
+ * - counters: jobs, errors, loads and reuses, the time of the operation in progress counted in busy_ms.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#define _POSIX_C_SOURCE 200809L
+#include <string.h>
+
+#include "host_model.h"
+#include "host_test.h"
+#include "stm32_hal.h"
+#include "stm32_utils_pka_queue.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define SIZE              8U
+#define JOB_NBR           8U
+#define LOG_SIZE          16U
+
+/* Private types -------------------------------------------------------------*/
+/** Parameter load of a job */
+typedef struct
+{
+  stm32_utils_pka_queue_op_t op; /*!< Operation                                             */
+  uint32_t update;               /*!< 1 for the operands only, 0 for all the parameters     */
+  const void *p_config;          /*!< Configuration given to the HAL                        */
+} load_t;
+
+/** Curve parameters */
+typedef struct
+{
+  uint8_t modulus[SIZE];
+  uint8_t coeff_a[SIZE];
+  uint8_t coeff_b[SIZE];
+  uint8_t base_pt_x[SIZE];
+  uint8_t base_pt_y[SIZE];
+  uint8_t prime_order[SIZE];
+} curve_t;
+
+/* Private variables ---------------------------------------------------------*/
+static hal_pka_handle_t hPka;
+static stm32_utils_pka_queue_t Queue;
+static stm32_utils_pka_queue_job_t Jobs[JOB_NBR];
+static hal_pka_ecdsa_verif_config_t Verif[JOB_NBR];
+static hal_pka_ecc_mul_config_t Mul[JOB_NBR];
+static hal_pka_mod_exp_config_t Exp[JOB_NBR];
+static hal_pka_ecc_mul_result_t MulResult[JOB_NBR];
+static curve_t Curves[3];  /*!< Curve 2 is a copy of curve 1 */
+static uint8_t Operands[JOB_NBR][SIZE];
+static uint8_t Hashes[JOB_NBR][SIZE];
+static uint8_t Signs[JOB_NBR][SIZE];
+static uint8_t ResultX[JOB_NBR][SIZE];
+static uint8_t ResultY[JOB_NBR][SIZE];
+
+static load_t Log[LOG_SIZE];
+static uint32_t LogNbr;
+static hal_status_t ConfigStatus;
+static hal_status_t ComputeStatus;
+static uint32_t MulError;
+static const void *p_Loaded;
+static uint32_t Pending;
+static uint32_t AbortNbr;
+static uint32_t Done[LOG_SIZE];
+static uint32_t DoneNbr;
+static stm32_utils_pka_queue_job_t *p_ChainJob;
+
+/* Mocked PKA HAL ------------------------------------------------------------*/
+static hal_status_t Load(stm32_utils_pka_queue_op_t op, uint32_t update, const void *p_config)
+{
+  CHECK(Pending == 0U, "parameters loaded during an operation");
+  if (LogNbr < LOG_SIZE)
+  {
+    Log[LogNbr].op = op;
+    Log[LogNbr].update = update;
+    Log[LogNbr].p_config = p_config;
+  }
+  LogNbr++;
+  if (ConfigStatus != HAL_OK)
+  {
+    p_Loaded = NULL;
+    return ConfigStatus;
+  }
+  p_Loaded = p_config;
+  return HAL_OK;
+}
+
+hal_status_t HAL_PKA_ECDSA_SetConfigVerifSignature(hal_pka_handle_t *hpka,
+                                                   const hal_pka_ecdsa_verif_config_t *p_config)
+{
+  (void)hpka;
+  return Load(STM32_UTILS_PKA_QUEUE_ECDSA_VERIF, 0U, p_config);
+}
+
+hal_status_t HAL_PKA_ECDSA_UpdateVerifSignature(hal_pka_handle_t *hpka, const hal_pka_ecdsa_verif_config_t *p_config)
+{
+  (void)hpka;
+  return Load(STM32_UTILS_PKA_QUEUE_ECDSA_VERIF, 1U, p_config);
+}
+
+hal_status_t HAL_PKA_ECC_SetConfigMul(hal_pka_handle_t *hpka, const hal_pka_ecc_mul_config_t *p_config)
+{
+  (void)hpka;
+  return Load(STM32_UTILS_PKA_QUEUE_ECC_MUL, 0U, p_config);
+}
+
+hal_status_t HAL_PKA_ECC_UpdateMul(hal_pka_handle_t *hpka, const hal_pka_ecc_mul_config_t *p_config)
+{
+  (void)hpka;
+  return Load(STM32_UTILS_PKA_QUEUE_ECC_MUL, 1U, p_config);
+}
+
+hal_status_t HAL_PKA_SetConfigModExp(hal_pka_handle_t *hpka, const hal_pka_mod_exp_config_t *p_config)
+{
+  (void)hpka;
+  return Load(STM32_UTILS_PKA_QUEUE_MOD_EXP, 0U, p_config);
+}
+
+hal_status_t HAL_PKA_UpdateModExp(hal_pka_handle_t *hpka, const hal_pka_mod_exp_config_t *p_config)
+{
+  (void)hpka;
+  return Load(STM32_UTILS_PKA_QUEUE_MOD_EXP, 1U, p_config);
+}
+
+hal_status_t HAL_PKA_Compute_IT(hal_pka_handle_t *hpka)
+{
+  (void)hpka;
+  CHECK(Pending == 0U, "operation started during another one");
+  CHECK(p_Loaded != NULL, "operation started without parameters");
+  if (ComputeStatus != HAL_OK)
+  {
+    return ComputeStatus;
+  }
+  Pending = 1U;
+  return HAL_OK;
+}
+
+hal_status_t HAL_PKA_Abort(hal_pka_handle_t *hpka)
+{
+  (void)hpka;
+  AbortNbr++;
+  Pending = 0U;
+  p_Loaded = NULL;
+  return HAL_OK;
+}
+
+hal_pka_ecdsa_signature_status_t HAL_PKA_ECDSA_IsValidVerifSignature(const hal_pka_handle_t *hpka)
+{
+  const hal_pka_ecdsa_verif_config_t *p_config = (const hal_pka_ecdsa_verif_config_t *)p_Loaded;
+
+  (void)hpka;
+  return (p_config->p_r_sign[0] == p_config->p_hash[0]) ? PKA_ECDSA_SIGNATURE_VALID : PKA_ECDSA_SIGNATURE_NOT_VALID;
+}
+
+uint32_t HAL_PKA_ECC_GetResultMul(hal_pka_handle_t *hpka, hal_pka_ecc_mul_result_t *p_result)
+{
+  const hal_pka_ecc_mul_config_t *p_config = (const hal_pka_ecc_mul_config_t *)p_Loaded;
+
+  (void)hpka;
+  if (MulError != 0U)
+  {
+    return 0U;
+  }
+  for (uint32_t i = 0U; i < p_config->modulus_size_byte; i++)
+  {
+    p_result->p_pt_x[i] = (uint8_t)(p_config->p_scalar_mul[i] ^ p_config->p_pt_x[i]);
+    p_result->p_pt_y[i] = (uint8_t)(p_config->p_scalar_mul[i] ^ p_config->p_pt_y[i]);
+  }
+  return p_config->modulus_size_byte;
+}
+
+uint32_t HAL_PKA_GetResultModExp(hal_pka_handle_t *hpka, uint8_t *p_result)
+{
+  const hal_pka_mod_exp_config_t *p_config = (const hal_pka_mod_exp_config_t *)p_Loaded;
+
+  (void)hpka;
+  for (uint32_t i = 0U; i < p_config->operand_size_byte; i++)
+  {
+    p_result[i] = (uint8_t)(p_config->p_operand[i] ^ p_config->p_exponent[0]);
+  }
+  return p_config->operand_size_byte;
+}
+
+/* Handlers and callbacks ----------------------------------------------------*/
+static void JobCb(stm32_utils_pka_queue_job_t *p_job)
+{
+  CHECK(p_job->status != STM32_UTILS_PKA_QUEUE_BUSY, "job %u busy in its callback", (unsigned int)(p_job - Jobs));
+  if (DoneNbr < LOG_SIZE)
+  {
+    Done[DoneNbr] = (uint32_t)(p_job - Jobs);
+  }
+  DoneNbr++;
+  if (p_ChainJob != NULL)
+  {
+    stm32_utils_pka_queue_job_t *p_next = p_ChainJob;
+
+    p_ChainJob = NULL;
+    CHECK(STM32_UTILS_PKA_QUEUE_SubmitModExp(&Queue, p_next, &Exp[p_next - Jobs], Operands[p_next - Jobs], JobCb)
+          == STM32_UTILS_PKA_QUEUE_OK, "submission from a callback");
+  }
+}
+
+/* Private functions ---------------------------------------------------------*/
+static void Start(uint32_t reuse_params)
+{
+  HOST_TEST_Init();
+  (void)memset(&hPka, 0, sizeof(hPka));
+  hPka.instance = HAL_PKA1;
+  CHECK(STM32_UTILS_PKA_QUEUE_Init(&Queue, &hPka, reuse_params) == STM32_UTILS_PKA_QUEUE_OK,
+        "STM32_UTILS_PKA_QUEUE_Init");
+  (void)memset(Jobs, 0, sizeof(Jobs));
+  (void)memset(Log, 0, sizeof(Log));
+  (void)memset(ResultX, 0, sizeof(ResultX));
+  (void)memset(ResultY, 0, sizeof(ResultY));
+  LogNbr = 0U;
+  ConfigStatus = HAL_OK;
+  ComputeStatus = HAL_OK;
+  MulError = 0U;
+  p_Loaded = NULL;
+  Pending = 0U;
+  AbortNbr = 0U;
+  DoneNbr = 0U;
+  p_ChainJob = NULL;
+}
+
+/* Fills the configurations of job on a curve, its signature valid or not */
+static void SetJob(uint32_t job, uint32_t curve, uint32_t valid)
+{
+  const curve_t *p_curve = &Curves[curve];
+
+  Verif[job].prime_order_size_byte = SIZE;
+  Verif[job].modulus_size_byte = SIZE;
+  Verif[job].coeff_sign = 1U;
+  Verif[job].p_coeff = p_curve->coeff_a;
+  Verif[job].p_modulus = p_curve->modulus;
+  Verif[job].p_base_pt_x = p_curve->base_pt_x;
+  Verif[job].p_base_pt_y = p_curve->base_pt_y;
+  Verif[job].p_pub_key_curve_pt_x = Operands[job];
+  Verif[job].p_pub_key_curve_pt_y = Operands[job];
+  Verif[job].p_r_sign = Signs[job];
+  Verif[job].p_s_sign = Signs[job];
+  Verif[job].p_hash = Hashes[job];
+  Verif[job].p_prime_order = p_curve->prime_order;
+  Signs[job][0] = (valid != 0U) ? Hashes[job][0] : (uint8_t)(Hashes[job][0] + 1U);
+
+  Mul[job].prime_order_size_byte = SIZE;
+  Mul[job].scalar_mul_size_byte = SIZE;
+  Mul[job].modulus_size_byte = SIZE;
+  Mul[job].coeff_sign = 1U;
+  Mul[job].p_coeff_a = p_curve->coeff_a;
+  Mul[job].p_coeff_b = p_curve->coeff_b;
+  Mul[job].p_modulus = p_curve->modulus;
+  Mul[job].p_pt_x = p_curve->base_pt_x;
+  Mul[job].p_pt_y = p_curve->base_pt_y;
+  Mul[job].p_scalar_mul = Operands[job];
+  Mul[job].p_prime_order = p_curve->prime_order;
+  MulResult[job].p_pt_x = ResultX[job];
+  MulResult[job].p_pt_y = ResultY[job];
+
+  Exp[job].exponent_size_byte = 1U;
+  Exp[job].operand_size_byte = SIZE;
+  Exp[job].p_exponent = &Hashes[job][0];
+  Exp[job].p_operand = Operands[job];
+  Exp[job].p_modulus = p_curve->modulus;
+}
+
+/* Completes the operation in progress, as the PKA interrupt would */
+static void Complete(void)
+{
+  CHECK(Pending == 1U, "no operation to complete");
+  Pending = 0U;
+  STM32_UTILS_PKA_QUEUE_OperationCpltCallback(&hPka);
+}
+
+static void Fail(void)
+{
+  CHECK(Pending == 1U, "no operation to fail");
+  Pending = 0U;
+  STM32_UTILS_PKA_QUEUE_ErrorCallback(&hPka);
+}
+
+static void CheckLoad(uint32_t index, stm32_utils_pka_queue_op_t op, uint32_t update, const void *p_config)
+{
+  CHECK(LogNbr > index, "load %u not done", (unsigned int)index);
+  CHECK((Log[index].op == op) && (Log[index].update == update) && (Log[index].p_config == p_config),
+        "load %u: operation %u %s instead of operation %u %s", (unsigned int)index, (unsigned int)Log[index].op,
+        (Log[index].update != 0U) ? "updated" : "loaded", (unsigned int)op, (update != 0U) ? "updated" : "loaded");
+}
+
+static void CheckJob(uint32_t job, stm32_utils_pka_queue_status_t status)
+{
+  CHECK(Jobs[job].status == status, "job %u: status 0x%X instead of 0x%X", (unsigned int)job,
+        (unsigned int)Jobs[job].status, (unsigned int)status);
+}
+
+static void CheckDone(const uint32_t *p_jobs, uint32_t job_nbr)
+{
+  CHECK(DoneNbr == job_nbr, "%u callback(s) instead of %u", (unsigned int)DoneNbr, (unsigned int)job_nbr);
+  for (uint32_t i = 0U; (i < job_nbr) && (i < DoneNbr); i++)
+  {
+    CHECK(Done[i] == p_jobs[i], "callback %u of job %u instead of job %u", (unsigned int)i, (unsigned int)Done[i],
+          (unsigned int)p_jobs[i]);
+  }
+}
+
+static void CheckStats(uint32_t job_count, uint32_t error_count, uint32_t load_count, uint32_t reuse_count)
+{
+  stm32_utils_pka_queue_stats_t stats;
+
+  STM32_UTILS_PKA_QUEUE_GetStats(&Queue, &stats);
+  CHECK((stats.job_count == job_count) && (stats.error_count == error_count) && (stats.load_count == load_count)
+        && (stats.reuse_count == reuse_count),
+        "%u job(s), %u error(s), %u load(s), %u reuse(s) instead of %u, %u, %u, %u", (unsigned int)stats.job_count,
+        (unsigned int)stats.error_count, (unsigned int)stats.load_count, (unsigned int)stats.reuse_count,
+        (unsigned int)job_count, (unsigned int)error_count, (unsigned int)load_count, (unsigned int)reuse_count);
+}
+
+static void TestOrder(void)
+{
+  static const uint32_t order[] = {0U, 1U, 2U};
+
+  Start(0U);
+  for (uint32_t i = 0U; i < 3U; i++)
+  {
+    SetJob(i, 0U, 1U);
+  }
+  CHECK(STM32_UTILS_PKA_QUEUE_SubmitModExp(&Queue, &Jobs[0], &Exp[0], ResultX[0], JobCb) == STM32_UTILS_PKA_QUEUE_OK,
+        "STM32_UTILS_PKA_QUEUE_SubmitModExp");
+  CHECK(STM32_UTILS_PKA_QUEUE_SubmitECCMul(&Queue, &Jobs[1], &Mul[1], &MulResult[1], JobCb)
+        == STM32_UTILS_PKA_QUEUE_OK, "STM32_UTILS_PKA_QUEUE_SubmitECCMul");
+  CHECK(STM32_UTILS_PKA_QUEUE_SubmitECDSAVerif(&Queue, &Jobs[2], &Verif[2], JobCb) == STM32_UTILS_PKA_QUEUE_OK,
+        "STM32_UTILS_PKA_QUEUE_SubmitECDSAVerif");
+
+  /* Only the first job is started */
+  CHECK((LogNbr == 1U) && (Pending == 1U), "%u load(s) before the first completion", (unsigned int)LogNbr);
+  CheckLoad(0U, STM32_UTILS_PKA_QUEUE_MOD_EXP, 0U, &Exp[0]);
+  CHECK(STM32_UTILS_PKA_QUEUE_IsIdle(&Queue) == 0U, "idle with jobs pending");
+  CheckJob(1U, STM32_UTILS_PKA_QUEUE_BUSY);
+
+  Complete();
+  CheckJob(0U, STM32_UTILS_PKA_QUEUE_OK);
+  CHECK(Jobs[0].result_size_byte == SIZE, "exponentiation result of %u bytes", (unsigned int)Jobs[0].result_size_byte);
+  CHECK(ResultX[0][1] == (uint8_t)(Operands[0][1] ^ Hashes[0][0]), "exponentiation result not read");
+  CheckLoad(1U, STM32_UTILS_PKA_QUEUE_ECC_MUL, 0U, &Mul[1]);
+
+  Complete();
+  CheckJob(1U, STM32_UTILS_PKA_QUEUE_OK);
+  CHECK(Jobs[1].result_size_byte == SIZE, "multiplication result of %u bytes", (unsigned int)Jobs[1].result_size_byte);
+  CHECK((ResultX[1][2] == (uint8_t)(Operands[1][2] ^ Curves[0].base_pt_x[2]))
+        && (ResultY[1][2] == (uint8_t)(Operands[1][2] ^ Curves[0].base_pt_y[2])), "multiplication result not read");
+  CheckLoad(2U, STM32_UTILS_PKA_QUEUE_ECDSA_VERIF, 0U, &Verif[2]);
+
+  Complete();
+  CheckJob(2U, STM32_UTILS_PKA_QUEUE_OK);
+  CHECK(Jobs[2].signature == PKA_ECDSA_SIGNATURE_VALID, "valid signature reported not valid");
+
+  CheckDone(order, 3U);
+  CHECK((LogNbr == 3U) && (Pending == 0U), "%u load(s) after the last job", (unsigned int)LogNbr);
+  CHECK(STM32_UTILS_PKA_QUEUE_IsIdle(&Queue) == 1U, "not idle after the last job");
+  CheckStats(3U, 0U, 3U, 0U);
+}
+
+static void TestReuse(void)
+{
+  static const uint32_t order[] = {0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U};
+
+  /* Batch of 4 verifications on curve 0, an exponentiation submitted during the batch, then curve 1, curve 1 again,
+     and the copy of curve 1 */
+  Start(1U);
+  for (uint32_t i = 0U; i < 4U; i++)
+  {
+    SetJob(i, 0U, i % 2U);
+  }
+  SetJob(4U, 0U, 1U);
+  SetJob(5U, 1U, 1U);
+  SetJob(6U, 1U, 0U);
+  SetJob(7U, 2U, 1U);
+  CHECK(STM32_UTILS_PKA_QUEUE_SubmitECDSAVerifBatch(&Queue, &Jobs[0], &Verif[0], 4U, JobCb)
+        == STM32_UTILS_PKA_QUEUE_OK, "STM32_UTILS_PKA_QUEUE_SubmitECDSAVerifBatch");
+  CHECK(STM32_UTILS_PKA_QUEUE_SubmitModExp(&Queue, &Jobs[4], &Exp[4], ResultX[4], JobCb) == STM32_UTILS_PKA_QUEUE_OK,
+        "STM32_UTILS_PKA_QUEUE_SubmitModExp");
+  for (uint32_t i = 5U; i < 8U; i++)
+  {
+    CHECK(STM32_UTILS_PKA_QUEUE_SubmitECDSAVerif(&Queue, &Jobs[i], &Verif[i], JobCb) == STM32_UTILS_PKA_QUEUE_OK,
+          "STM32_UTILS_PKA_QUEUE_SubmitECDSAVerif");
+  }
+  for (uint32_t i = 0U; (i < 8U) && (Pending != 0U); i++)
+  {
+    Complete();
+  }
+  CheckDone(order, 8U);
+  CheckLoad(0U, STM32_UTILS_PKA_QUEUE_ECDSA_VERIF, 0U, &Verif[0]);
+  CheckLoad(1U, STM32_UTILS_PKA_QUEUE_ECDSA_VERIF, 1U, &Verif[1]);
+  CheckLoad(2U, STM32_UTILS_PKA_QUEUE_ECDSA_VERIF, 1U, &Verif[2]);
+  CheckLoad(3U, STM32_UTILS_PKA_QUEUE_ECDSA_VERIF, 1U, &Verif[3]);
+  CheckLoad(4U, STM32_UTILS_PKA_QUEUE_MOD_EXP, 0U, &Exp[4]);
+  CheckLoad(5U, STM32_UTILS_PKA_QUEUE_ECDSA_VERIF, 0U, &Verif[5]);
+  CheckLoad(6U, STM32_UTILS_PKA_QUEUE_ECDSA_VERIF, 1U, &Verif[6]);
+  CheckLoad(7U, STM32_UTILS_PKA_QUEUE_ECDSA_VERIF, 0U, &Verif[7]);
+  for (uint32_t i = 0U; i < 4U; i++)
+  {
+    CHECK(Jobs[i].signature == (((i % 2U) != 0U) ? PKA_ECDSA_SIGNATURE_VALID : PKA_ECDSA_SIGNATURE_NOT_VALID),
+          "signature %u of the batch", (unsigned int)i);
+  }
+  CHECK((Jobs[5].signature == PKA_ECDSA_SIGNATURE_VALID) && (Jobs[6].signature == PKA_ECDSA_SIGNATURE_NOT_VALID),
+        "signatures on curve 1");
+  CheckStats(8U, 0U, 4U, 4U);
+
+  /* Multiplications and exponentiations sharing their curve or modulus */
+  Start(1U);
+  for (uint32_t i = 0U; i < 4U; i++)
+  {
+    SetJob(i, 0U, 1U);
+  }
+  CHECK(STM32_UTILS_PKA_QUEUE_SubmitECCMul(&Queue, &Jobs[0], &Mul[0], &MulResult[0], JobCb)
+        == STM32_UTILS_PKA_QUEUE_OK, "STM32_UTILS_PKA_QUEUE_SubmitECCMul");
+  CHECK(STM32_UTILS_PKA_QUEUE_SubmitECCMul(&Queue, &Jobs[1], &Mul[1], &MulResult[1], JobCb)
+        == STM32_UTILS_PKA_QUEUE_OK, "STM32_UTILS_PKA_QUEUE_SubmitECCMul");
+  CHECK(STM32_UTILS_PKA_QUEUE_SubmitModExp(&Queue, &Jobs[2], &Exp[2], ResultX[2], JobCb) == STM32_UTILS_PKA_QUEUE_OK,
+        "STM32_UTILS_PKA_QUEUE_SubmitModExp");
+  CHECK(STM32_UTILS_PKA_QUEUE_SubmitModExp(&Queue, &Jobs[3], &Exp[3], ResultX[3], JobCb) == STM32_UTILS_PKA_QUEUE_OK,
+        "STM32_UTILS_PKA_QUEUE_SubmitModExp");
+  for (uint32_t i = 0U; (i < 4U) && (Pending != 0U); i++)
+  {
+    Complete();
+  }
+  CheckDone(order, 4U);
+  CheckLoad(0U, STM32_UTILS_PKA_QUEUE_ECC_MUL, 0U, &Mul[0]);
+  CheckLoad(1U, STM32_UTILS_PKA_QUEUE_ECC_MUL, 1U, &Mul[1]);
+  CheckLoad(2U, STM32_UTILS_PKA_QUEUE_MOD_EXP, 0U, &Exp[2]);
+  CheckLoad(3U, STM32_UTILS_PKA_QUEUE_MOD_EXP, 1U, &Exp[3]);
+  CHECK(ResultX[1][0] == (uint8_t)(Operands[1][0] ^ Curves[0].base_pt_x[0]), "result of the updated multiplication");
+  CheckStats(4U, 0U, 2U, 2U);
+
+  /* Without reuse_params, each job of a batch loads the curve */
+  Start(0U);
+  CHECK(STM32_UTILS_PKA_QUEUE_SubmitECDSAVerifBatch(&Queue, &Jobs[0], &Verif[0], 3U, JobCb)
+        == STM32_UTILS_PKA_QUEUE_OK, "STM32_UTILS_PKA_QUEUE_SubmitECDSAVerifBatch");
+  for (uint32_t i = 0U; (i < 3U) && (Pending != 0U); i++)
+  {
+    Complete();
+  }
+  CheckDone(order, 3U);
+  for (uint32_t i = 0U; i < 3U; i++)
+  {
+    CheckLoad(i, STM32_UTILS_PKA_QUEUE_ECDSA_VERIF, 0U, &Verif[i]);
+  }
+  CheckStats(3U, 0U, 3U, 0U);
+}
+
+static void TestErrors(void)
+{
+  static const uint32_t order[] = {0U, 1U, 2U, 3U, 4U, 5U};
+
+  Start(1U);
+  for (uint32_t i = 0U; i < 6U; i++)
+  {
+    SetJob(i, 0U, 1U);
+  }
+
+  /* Configuration refused: the job ends before the submission returns */
+  ConfigStatus = HAL_ERROR;
+  CHECK(STM32_UTILS_PKA_QUEUE_SubmitECDSAVerif(&Queue, &Jobs[0], &Verif[0], JobCb) == STM32_UTILS_PKA_QUEUE_OK,
+        "STM32_UTILS_PKA_QUEUE_SubmitECDSAVerif");
+  CheckJob(0U, STM32_UTILS_PKA_QUEUE_ERROR);
+  CHECK((DoneNbr == 1U) && (Pending == 0U), "job with its configuration refused not ended");
+  CHECK(STM32_UTILS_PKA_QUEUE_IsIdle(&Queue) == 1U, "not idle after a refused configuration");
+  ConfigStatus = HAL_OK;
+
+  /* The next job loads all the parameters */
+  CHECK(STM32_UTILS_PKA_QUEUE_SubmitECDSAVerif(&Queue, &Jobs[1], &Verif[1], JobCb) == STM32_UTILS_PKA_QUEUE_OK,
+        "STM32_UTILS_PKA_QUEUE_SubmitECDSAVerif");
+  CheckLoad(1U, STM32_UTILS_PKA_QUEUE_ECDSA_VERIF, 0U, &Verif[1]);
+  Complete();
+  CheckJob(1U, STM32_UTILS_PKA_QUEUE_OK);
+
+  /* Start refused: the operation is aborted, the job ends before the submission returns */
+  ComputeStatus = HAL_BUSY;
+  CHECK(STM32_UTILS_PKA_QUEUE_SubmitECDSAVerif(&Queue, &Jobs[2], &Verif[2], JobCb) == STM32_UTILS_PKA_QUEUE_OK,
+        "STM32_UTILS_PKA_QUEUE_SubmitECDSAVerif");
+  CheckLoad(2U, STM32_UTILS_PKA_QUEUE_ECDSA_VERIF, 1U, &Verif[2]);
+  CheckJob(2U, STM32_UTILS_PKA_QUEUE_ERROR);
+  CHECK(AbortNbr == 1U, "%u abort(s) after a refused start", (unsigned int)AbortNbr);
+  ComputeStatus = HAL_OK;
+
+  /* PKA error with a job waiting: the operation is aborted and the waiting job loads all the parameters */
+  CHECK(STM32_UTILS_PKA_QUEUE_SubmitECDSAVerif(&Queue, &Jobs[3], &Verif[3], JobCb) == STM32_UTILS_PKA_QUEUE_OK,
+        "STM32_UTILS_PKA_QUEUE_SubmitECDSAVerif");
+  CHECK(STM32_UTILS_PKA_QUEUE_SubmitECDSAVerif(&Queue, &Jobs[4], &Verif[4], JobCb) == STM32_UTILS_PKA_QUEUE_OK,
+        "STM32_UTILS_PKA_QUEUE_SubmitECDSAVerif");
+  CheckLoad(3U, STM32_UTILS_PKA_QUEUE_ECDSA_VERIF, 0U, &Verif[3]);
+  Fail();
+  CheckJob(3U, STM32_UTILS_PKA_QUEUE_ERROR);
+  CHECK(AbortNbr == 2U, "%u abort(s) after a PKA error", (unsigned int)AbortNbr);
+  CheckLoad(4U, STM32_UTILS_PKA_QUEUE_ECDSA_VERIF, 0U, &Verif[4]);
+  CheckJob(4U, STM32_UTILS_PKA_QUEUE_BUSY);
+  Complete();
+  CheckJob(4U, STM32_UTILS_PKA_QUEUE_OK);
+
+  /* Multiplication result in error */
+  MulError = 1U;
+  CHECK(STM32_UTILS_PKA_QUEUE_SubmitECCMul(&Queue, &Jobs[5], &Mul[5], &MulResult[5], JobCb)
+        == STM32_UTILS_PKA_QUEUE_OK, "STM32_UTILS_PKA_QUEUE_SubmitECCMul");
+  Complete();
+  CheckJob(5U, STM32_UTILS_PKA_QUEUE_ERROR);
+  CHECK(Jobs[5].result_size_byte == 0U, "multiplication in error with a result of %u bytes",
+        (unsigned int)Jobs[5].result_size_byte);
+
+  CheckDone(order, 6U);
+  CheckStats(6U, 4U, 4U, 1U);
+  CHECK(STM32_UTILS_PKA_QUEUE_IsIdle(&Queue) == 1U, "not idle after the last job");
+
+  /* Invalid parameters: nothing queued */
+  MulResult[6].p_pt_x = NULL;
+  MulResult[6].p_pt_y = ResultY[6];
+  CHECK(STM32_UTILS_PKA_QUEUE_Init(NULL, &hPka, 1U) == STM32_UTILS_PKA_QUEUE_INVALID_PARAM, "NULL queue");
+  CHECK(STM32_UTILS_PKA_QUEUE_Init(&Queue, NULL, 1U) == STM32_UTILS_PKA_QUEUE_INVALID_PARAM, "NULL PKA");
+  CHECK(STM32_UTILS_PKA_QUEUE_SubmitECDSAVerif(&Queue, NULL, &Verif[0], JobCb) == STM32_UTILS_PKA_QUEUE_INVALID_PARAM,
+        "NULL job");
+  CHECK(STM32_UTILS_PKA_QUEUE_SubmitECDSAVerif(&Queue, &Jobs[6], NULL, JobCb) == STM32_UTILS_PKA_QUEUE_INVALID_PARAM,
+        "NULL configuration");
+  CHECK(STM32_UTILS_PKA_QUEUE_SubmitECDSAVerifBatch(&Queue, &Jobs[6], &Verif[6], 0U, JobCb)
+        == STM32_UTILS_PKA_QUEUE_INVALID_PARAM, "empty batch");
+  CHECK(STM32_UTILS_PKA_QUEUE_SubmitECCMul(&Queue, &Jobs[6], &Mul[6], &MulResult[6], JobCb)
+        == STM32_UTILS_PKA_QUEUE_INVALID_PARAM, "NULL coordinate of the result");
+  CHECK(STM32_UTILS_PKA_QUEUE_SubmitModExp(&Queue, &Jobs[6], &Exp[6], NULL, JobCb)
+        == STM32_UTILS_PKA_QUEUE_INVALID_PARAM, "NULL result");
+  CHECK((LogNbr == 6U) && (DoneNbr == 6U) && (Pending == 0U), "invalid submission queued");
+  CheckStats(6U, 4U, 4U, 1U);
+}
+
+static void TestCallbacks(void)
+{
+  static const uint32_t order[] = {1U, 2U};
+
+  Start(1U);
+  for (uint32_t i = 0U; i < 3U; i++)
+  {
+    SetJob(i, 0U, 1U);
+  }
+
+  /* Job without callback */
+  Jobs[0].p_user_data = &Queue;
+  CHECK(STM32_UTILS_PKA_QUEUE_SubmitModExp(&Queue, &Jobs[0], &Exp[0], ResultX[0], NULL) == STM32_UTILS_PKA_QUEUE_OK,
+        "STM32_UTILS_PKA_QUEUE_SubmitModExp");
+  Complete();
+  CheckJob(0U, STM32_UTILS_PKA_QUEUE_OK);
+  CHECK(Jobs[0].p_user_data == &Queue, "user data modified");
+
+  /* Job submitted from the callback of another one: started after it, from the same completion */
+  p_ChainJob = &Jobs[2];
+  CHECK(STM32_UTILS_PKA_QUEUE_SubmitModExp(&Queue, &Jobs[1], &Exp[1], ResultX[1], JobCb) == STM32_UTILS_PKA_QUEUE_OK,
+        "STM32_UTILS_PKA_QUEUE_SubmitModExp");
+  Complete();
+  CHECK(Pending == 1U, "job submitted from a callback not started");
+  CheckLoad(2U, STM32_UTILS_PKA_QUEUE_MOD_EXP, 1U, &Exp[2]);
+  Complete();
+  CheckJob(2U, STM32_UTILS_PKA_QUEUE_OK);
+  CheckDone(order, 2U);
+  CHECK(STM32_UTILS_PKA_QUEUE_IsIdle(&Queue) == 1U, "not idle after the last job");
+}
+
+static void TestStats(void)
+{
+  static const volatile uint32_t never = 0U;
+  stm32_utils_pka_queue_stats_t stats;
+
+  Start(1U);
+  SetJob(0U, 0U, 1U);
+  STM32_UTILS_PKA_QUEUE_ResetStats(&Queue);
+  (void)HOST_TEST_Wait(&never, 5U);
+  CHECK(STM32_UTILS_PKA_QUEUE_SubmitModExp(&Queue, &Jobs[0], &Exp[0], ResultX[0], JobCb) == STM32_UTILS_PKA_QUEUE_OK,
+        "STM32_UTILS_PKA_QUEUE_SubmitModExp");
+
+  /* The operation in progress is counted up to now */
+  (void)HOST_TEST_Wait(&never, 10U);
+  STM32_UTILS_PKA_QUEUE_GetStats(&Queue, &stats);
+  CHECK((stats.busy_ms >= 10U) && (stats.busy_ms <= 11U), "busy for %u ms during an operation of 10 ms",
+        (unsigned int)stats.busy_ms);
+  Complete();
+  (void)HOST_TEST_Wait(&never, 10U);
+  STM32_UTILS_PKA_QUEUE_GetStats(&Queue, &stats);
+  CHECK((stats.busy_ms >= 10U) && (stats.busy_ms <= 11U), "busy for %u ms after an operation of 10 ms",
+        (unsigned int)stats.busy_ms);
+  CHECK((stats.elapsed_ms >= 25U) && (stats.elapsed_ms <= 27U), "%u ms elapsed instead of 25",
+        (unsigned int)stats.elapsed_ms);
+  CHECK(stats.job_count == 1U, "%u job(s)", (unsigned int)stats.job_count);
+
+  STM32_UTILS_PKA_QUEUE_ResetStats(&Queue);
+  STM32_UTILS_PKA_QUEUE_GetStats(&Queue, &stats);
+  CHECK((stats.job_count == 0U) && (stats.busy_ms == 0U) && (stats.elapsed_ms <= 1U), "counters not reset");
+}
+
+/* Exported functions --------------------------------------------------------*/
+int main(void)
+{
+  for (uint32_t c = 0U; c < 3U; c++)
+  {
+    for (uint32_t i = 0U; i < SIZE; i++)
+    {
+      Curves[c].modulus[i] = (uint8_t)(0xF0U + i + ((c != 0U) ? 1U : 0U));
+      Curves[c].coeff_a[i] = (uint8_t)(0x10U + i);
+      Curves[c].coeff_b[i] = (uint8_t)(0x20U + i);
+      Curves[c].base_pt_x[i] = (uint8_t)(0x30U + i + ((c != 0U) ? 1U : 0U));
+      Curves[c].base_pt_y[i] = (uint8_t)(0x40U + i);
+      Curves[c].prime_order[i] = (uint8_t)(0xE0U + i);
+    }
+  }
+  for (uint32_t j = 0U; j < JOB_NBR; j++)
+  {
+    for (uint32_t i = 0U; i < SIZE; i++)
+    {
+      Operands[j][i] = (uint8_t)((j * 37U) + (i * 11U) + 1U);
+      Hashes[j][i] = (uint8_t)((j * 53U) + (i * 7U) + 3U);
+    }
+  }
+
+  TestOrder();
+  TestReuse();
+  TestErrors();
+  TestCallbacks();
+  TestStats();
+
+  return HOST_TEST_Report();
+}
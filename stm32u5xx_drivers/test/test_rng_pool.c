@@ -0,0 +1,259 @@
+/**
+  ******************************************************************************
+  * @file    test_rng_pool.c
+  * @brief   Host tests of the RNG entropy pool utility on the RNG model
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ * A ring of 16 words refilled 5 words at a time, so that the refills stop at the end of the ring and at the tail.
+ * The words of the seed are first generated by polling. The RNG being disabled between two refills, the words left
+ * in its FIFO are lost, so the words served must be a subsequence of the sequence of the seed:
+ * - fill: the pool fills up to the size of the ring, from the interrupt only,
+ * - drain: requests of 1 to 100 bytes, larger than the pool, each served from the pool then from the refills, the
+ *   bytes being those of the next words of the sequence, no word served twice nor out of order,
+ * - timeout: an exhausted pool with no time to wait,
+ * - seed error during a refill: its words are discarded, the seed is recovered and the pool fills again, still in
+ *   the order of the sequence,
+ * - stop: the words left are served, then the requests fail.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#define _POSIX_C_SOURCE 200809L
+#include <string.h>
+
+#include "host_model.h"
+#include "host_test.h"
+#include "stm32_hal.h"
+#include "stm32_utils_rng_pool.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define POOL_WORD         16U
+#define REFILL_WORD       5U
+#define SEED              45U
+#define REFERENCE_NBR     4096U
+#define START_CYCLES      256U        /*!< Rate of the model, see host_model/host_rng.c */
+#define WORD_CYCLES       64U
+
+/* Private variables ---------------------------------------------------------*/
+static hal_rng_handle_t hRng;
+static stm32_utils_rng_pool_t Pool;
+static uint32_t Ring[POOL_WORD];
+static uint32_t Reference[REFERENCE_NBR];
+static uint32_t NextIdx;                    /*!< Index in Reference of the next word which can be served */
+static uint32_t WordNbr;                    /*!< Words served since the start */
+
+/* Handlers and callbacks ----------------------------------------------------*/
+void RNG_IRQHandler(void)
+{
+  HAL_RNG_IRQHandler(&hRng);
+}
+
+void HAL_RNG_GenerationCpltCallback(hal_rng_handle_t *hrng)
+{
+  STM32_UTILS_RNG_POOL_GenerationCpltCallback(hrng);
+}
+
+void HAL_RNG_ErrorCallback(hal_rng_handle_t *hrng)
+{
+  STM32_UTILS_RNG_POOL_ErrorCallback(hrng);
+}
+
+/* Private functions ---------------------------------------------------------*/
+static void Start(void)
+{
+  HOST_TEST_Init();
+  CHECK(HAL_RNG_Init(&hRng, HAL_RNG) == HAL_OK, "HAL_RNG_Init");
+  CHECK(HAL_RNG_SetCandidateNISTConfig(&hRng) == HAL_OK, "configuration");
+  HAL_CORTEX_NVIC_EnableIRQ(RNG_IRQn);
+  HOST_MODEL_RNG_SetSeed(SEED);
+}
+
+static void StartPool(void)
+{
+  Start();
+  CHECK(STM32_UTILS_RNG_POOL_Init(&Pool, &hRng, Ring, POOL_WORD, REFILL_WORD) == STM32_UTILS_RNG_POOL_OK,
+        "pool init");
+  NextIdx = 0U;
+  WordNbr = 0U;
+}
+
+/* Wait until the pool holds level words, return 1 when it does */
+static uint32_t WaitLevel(uint32_t level, uint32_t timeout_ms)
+{
+  const uint32_t tickstart = HAL_GetTick();
+
+  while (STM32_UTILS_RNG_POOL_GetLevel(&Pool) < level)
+  {
+    if ((HAL_GetTick() - tickstart) >= timeout_ms)
+    {
+      return 0U;
+    }
+  }
+  return 1U;
+}
+
+/* Check that the bytes are those of the next words of the sequence, a word per 4 bytes, the last one truncated */
+static void CheckServed(const uint8_t *p_data, uint32_t size_byte)
+{
+  for (uint32_t offset = 0U; offset < size_byte; offset += 4U)
+  {
+    const uint32_t nbr = ((size_byte - offset) < 4U) ? (size_byte - offset) : 4U;
+
+    while ((NextIdx < REFERENCE_NBR) && (memcmp(&Reference[NextIdx], &p_data[offset], nbr) != 0))
+    {
+      NextIdx++;
+    }
+    if (NextIdx == REFERENCE_NBR)
+    {
+      CHECK(0, "word %u: not a word of the sequence after the ones served", (unsigned int)WordNbr);
+      return;
+    }
+    NextIdx++;
+    WordNbr++;
+  }
+}
+
+/* The words of the seed */
+static void TestReference(void)
+{
+  Start();
+  CHECK(HAL_RNG_GenerateRandomNumber(&hRng, Reference, REFERENCE_NBR, 100U) == HAL_OK, "polling generation");
+}
+
+static void TestFill(void)
+{
+  stm32_utils_rng_pool_stats_t stats;
+
+  StartPool();
+  CHECK(STM32_UTILS_RNG_POOL_GetLevel(&Pool) == 0U, "words before the first refill");
+  CHECK(WaitLevel(POOL_WORD, 10U) == 1U, "pool not filled: %u words",
+        (unsigned int)STM32_UTILS_RNG_POOL_GetLevel(&Pool));
+
+  /* Full: no more refill */
+  HOST_MODEL_Run(START_CYCLES + (4U * REFILL_WORD * WORD_CYCLES));
+  STM32_UTILS_RNG_POOL_GetStats(&Pool, &stats);
+  CHECK(stats.level_word == POOL_WORD, "level %u", (unsigned int)stats.level_word);
+  CHECK(stats.generated_word == POOL_WORD, "%u words generated", (unsigned int)stats.generated_word);
+  CHECK((stats.served_byte == 0U) && (stats.wait_count == 0U), "served %u bytes, %u waits",
+        (unsigned int)stats.served_byte, (unsigned int)stats.wait_count);
+  CHECK(HAL_RNG_GetState(&hRng) == HAL_RNG_STATE_IDLE, "state %d", (int)HAL_RNG_GetState(&hRng));
+  CHECK(HOST_MODEL_GetIrqCount(RNG_IRQn) != 0U, "no RNG interrupt");
+}
+
+static void TestDrain(void)
+{
+  static const uint32_t sizes[] = {1U, 3U, 4U, 5U, 8U, 13U, 2U, 100U, 7U, 64U, 33U, 4U, 100U, 1U, 90U};
+  uint8_t data[100];
+  stm32_utils_rng_pool_stats_t stats;
+  uint32_t total_byte = 0U;
+  uint32_t total_word = 0U;
+
+  StartPool();
+  CHECK(WaitLevel(POOL_WORD, 10U) == 1U, "pool not filled");
+
+  for (uint32_t i = 0U; i < (sizeof(sizes) / sizeof(sizes[0])); i++)
+  {
+    (void)memset(data, 0, sizeof(data));
+    CHECK(STM32_UTILS_RNG_POOL_Get(&Pool, data, sizes[i], 10U) == STM32_UTILS_RNG_POOL_OK, "request %u of %u bytes",
+          (unsigned int)i, (unsigned int)sizes[i]);
+    CheckServed(data, sizes[i]);
+    total_byte += sizes[i];
+    total_word += (sizes[i] + 3U) / 4U;
+  }
+
+  STM32_UTILS_RNG_POOL_GetStats(&Pool, &stats);
+  CHECK(WordNbr == total_word, "%u words served, expected %u", (unsigned int)WordNbr, (unsigned int)total_word);
+  CHECK(stats.served_byte == total_byte, "%u bytes served, expected %u", (unsigned int)stats.served_byte,
+        (unsigned int)total_byte);
+  CHECK(stats.generated_word >= total_word, "%u words generated for %u served", (unsigned int)stats.generated_word,
+        (unsigned int)total_word);
+  CHECK(stats.generated_word == (total_word + stats.level_word), "%u words generated, %u served, %u in the pool",
+        (unsigned int)stats.generated_word, (unsigned int)total_word, (unsigned int)stats.level_word);
+  CHECK(stats.wait_count >= 2U, "%u waits for the requests of 100 bytes", (unsigned int)stats.wait_count);
+  CHECK(stats.min_level_word == 0U, "low watermark %u", (unsigned int)stats.min_level_word);
+  CHECK((stats.seed_error_count == 0U) && (stats.clock_error_count == 0U), "errors");
+
+  /* Refilled after the drain */
+  CHECK(WaitLevel(POOL_WORD, 10U) == 1U, "pool not refilled");
+  (void)memset(data, 0, sizeof(data));
+  CHECK(STM32_UTILS_RNG_POOL_Get(&Pool, data, POOL_WORD * 4U, 0U) == STM32_UTILS_RNG_POOL_OK, "full pool served");
+  CheckServed(data, POOL_WORD * 4U);
+}
+
+static void TestTimeout(void)
+{
+  uint8_t data[POOL_WORD * 4U];
+
+  StartPool();
+  CHECK(WaitLevel(POOL_WORD, 10U) == 1U, "pool not filled");
+  CHECK(STM32_UTILS_RNG_POOL_Get(&Pool, data, sizeof(data), 0U) == STM32_UTILS_RNG_POOL_OK, "pool served");
+  CHECK(STM32_UTILS_RNG_POOL_Get(&Pool, data, 4U, 0U) == STM32_UTILS_RNG_POOL_TIMEOUT, "exhausted pool served");
+  CHECK(STM32_UTILS_RNG_POOL_Get(&Pool, data, 4U, 10U) == STM32_UTILS_RNG_POOL_OK, "request after a refill");
+  CHECK(STM32_UTILS_RNG_POOL_Get(&Pool, NULL, 4U, 10U) == STM32_UTILS_RNG_POOL_INVALID_PARAM, "NULL buffer");
+  CHECK(STM32_UTILS_RNG_POOL_Get(&Pool, data, 0U, 10U) == STM32_UTILS_RNG_POOL_INVALID_PARAM, "no byte");
+}
+
+static void TestSeedError(void)
+{
+  uint8_t data[POOL_WORD * 4U];
+  stm32_utils_rng_pool_stats_t stats;
+
+  StartPool();
+
+  /* During the first refill, after its first words */
+  HOST_MODEL_Run(START_CYCLES + (2U * WORD_CYCLES));
+  CHECK(STM32_UTILS_RNG_POOL_GetLevel(&Pool) == 0U, "refill completed too early");
+  HOST_MODEL_RNG_InjectSeedError();
+  CHECK(WaitLevel(POOL_WORD, 10U) == 1U, "pool not filled after the seed error");
+
+  STM32_UTILS_RNG_POOL_GetStats(&Pool, &stats);
+  CHECK(stats.seed_error_count == 1U, "%u seed errors", (unsigned int)stats.seed_error_count);
+  CHECK(stats.generated_word == POOL_WORD, "%u words generated, the discarded ones are not",
+        (unsigned int)stats.generated_word);
+  CHECK(HAL_RNG_GetState(&hRng) == HAL_RNG_STATE_IDLE, "state %d", (int)HAL_RNG_GetState(&hRng));
+
+  (void)memset(data, 0, sizeof(data));
+  CHECK(STM32_UTILS_RNG_POOL_Get(&Pool, data, sizeof(data), 0U) == STM32_UTILS_RNG_POOL_OK, "pool served");
+  CheckServed(data, sizeof(data));
+  CHECK(STM32_UTILS_RNG_POOL_Get(&Pool, data, sizeof(data), 10U) == STM32_UTILS_RNG_POOL_OK, "refills");
+  CheckServed(data, sizeof(data));
+}
+
+static void TestStop(void)
+{
+  uint8_t data[POOL_WORD * 4U];
+
+  StartPool();
+  CHECK(WaitLevel(POOL_WORD, 10U) == 1U, "pool not filled");
+  STM32_UTILS_RNG_POOL_Stop(&Pool);
+  CHECK(STM32_UTILS_RNG_POOL_Get(&Pool, data, 8U, 0U) == STM32_UTILS_RNG_POOL_OK, "words left served");
+  CheckServed(data, 8U);
+  HOST_MODEL_Run(START_CYCLES + (4U * REFILL_WORD * WORD_CYCLES));
+  CHECK(STM32_UTILS_RNG_POOL_GetLevel(&Pool) == (POOL_WORD - 2U), "refilled after the stop");
+  CHECK(STM32_UTILS_RNG_POOL_Get(&Pool, data, sizeof(data), 10U) == STM32_UTILS_RNG_POOL_ERROR,
+        "stopped and exhausted pool");
+}
+
+/* Exported functions --------------------------------------------------------*/
+int main(void)
+{
+  TestReference();
+  TestFill();
+  TestDrain();
+  TestTimeout();
+  TestSeedError();
+  TestStop();
+
+  return HOST_TEST_Report();
+}
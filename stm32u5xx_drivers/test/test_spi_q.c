@@ -0,0 +1,284 @@
+/**
+  ******************************************************************************
+  * @file    test_spi_q.c
+  * @brief   Host tests of the SPI transaction queue on the SPI and GPDMA models
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ * SPI1 master, full duplex, 8-bit frames, the slave of the model answering the complement of each frame, and two
+ * devices selected by the SPI NSS output, the second one with another prescaler and the LSB first:
+ * - transactions of both devices queued at once: the frames exchanged in order, one completion callback each, and
+ *   the bus reconfigured only when the device changes,
+ * - bus parameters partially applied: the prescaler set and the first bit refused by the locked configuration, the
+ *   transaction ended with error, then the parameters of the first device all set again on the next transaction.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#define _POSIX_C_SOURCE 200809L
+#include <string.h>
+
+#include "host_model.h"
+#include "host_test.h"
+#include "stm32_hal.h"
+#include "stm32_utils_spi_q.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define XFER_NBR          3U
+#define XFER_SIZE         16U
+
+/* Private variables ---------------------------------------------------------*/
+static hal_spi_handle_t hSpi;
+static hal_dma_handle_t hDmaTx;
+static hal_dma_handle_t hDmaRx;
+static stm32_utils_spi_q_t Queue;
+static stm32_utils_spi_q_device_t DevA;
+static stm32_utils_spi_q_device_t DevB;
+static stm32_utils_spi_q_xfer_t Xfers[XFER_NBR];
+static uint8_t TxData[XFER_NBR][XFER_SIZE];
+static uint8_t RxData[XFER_NBR][XFER_SIZE];
+static uint32_t Mosi[XFER_NBR * XFER_SIZE];
+static volatile uint32_t CbNbr;
+
+static const stm32_utils_spi_q_device_config_t ConfigA =
+{
+  HAL_SPI_CLOCK_POLARITY_LOW, HAL_SPI_CLOCK_PHASE_1_EDGE, HAL_SPI_BAUD_RATE_PRESCALER_8, HAL_SPI_MSB_FIRST,
+  HAL_SPI_DATA_WIDTH_8_BIT
+};
+static const stm32_utils_spi_q_device_config_t ConfigB =
+{
+  HAL_SPI_CLOCK_POLARITY_LOW, HAL_SPI_CLOCK_PHASE_1_EDGE, HAL_SPI_BAUD_RATE_PRESCALER_32, HAL_SPI_LSB_FIRST,
+  HAL_SPI_DATA_WIDTH_8_BIT
+};
+
+/* Handlers and callbacks ----------------------------------------------------*/
+void SPI1_IRQHandler(void)
+{
+  HAL_SPI_IRQHandler(&hSpi);
+}
+
+void GPDMA1_Channel2_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&hDmaTx);
+}
+
+void GPDMA1_Channel3_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&hDmaRx);
+}
+
+void HAL_SPI_TxRxCpltCallback(hal_spi_handle_t *hspi)
+{
+  STM32_UTILS_SPI_Q_XferCpltCallback(hspi);
+}
+
+void HAL_SPI_ErrorCallback(hal_spi_handle_t *hspi)
+{
+  STM32_UTILS_SPI_Q_ErrorCallback(hspi);
+}
+
+static void XferCb(stm32_utils_spi_q_xfer_t *p_xfer)
+{
+  (void)p_xfer;
+  CbNbr++;
+}
+
+static uint32_t Slave(void *p_context, uint32_t mosi_frame)
+{
+  (void)p_context;
+  return ~mosi_frame;
+}
+
+/* Private functions ---------------------------------------------------------*/
+static void Start(void)
+{
+  const hal_spi_config_t config =
+  {
+    HAL_SPI_MODE_MASTER, HAL_SPI_DIRECTION_FULL_DUPLEX, HAL_SPI_DATA_WIDTH_8_BIT, HAL_SPI_CLOCK_POLARITY_LOW,
+    HAL_SPI_CLOCK_PHASE_1_EDGE, HAL_SPI_BAUD_RATE_PRESCALER_8, HAL_SPI_MSB_FIRST, HAL_SPI_NSS_PIN_MGMT_INTERNAL
+  };
+  hal_dma_direct_xfer_config_t dma_config =
+  {
+    HAL_GPDMA1_REQUEST_SPI1_TX, HAL_DMA_DIRECTION_MEMORY_TO_PERIPH, HAL_DMA_SRC_ADDR_INCREMENTED,
+    HAL_DMA_DEST_ADDR_FIXED, HAL_DMA_SRC_DATA_WIDTH_BYTE, HAL_DMA_DEST_DATA_WIDTH_BYTE,
+    HAL_DMA_PRIORITY_LOW_WEIGHT_HIGH
+  };
+
+  HOST_TEST_Init();
+  CHECK(HAL_SPI_Init(&hSpi, HAL_SPI1) == HAL_OK, "HAL_SPI_Init");
+  CHECK(HAL_SPI_SetConfig(&hSpi, &config) == HAL_OK, "HAL_SPI_SetConfig");
+
+  CHECK(HAL_DMA_Init(&hDmaTx, HAL_GPDMA1_CH2) == HAL_OK, "HAL_DMA_Init Tx");
+  CHECK(HAL_DMA_SetConfigDirectXfer(&hDmaTx, &dma_config) == HAL_OK, "Tx DMA configuration");
+  CHECK(HAL_SPI_SetTxDMA(&hSpi, &hDmaTx) == HAL_OK, "HAL_SPI_SetTxDMA");
+
+  dma_config.request = HAL_GPDMA1_REQUEST_SPI1_RX;
+  dma_config.direction = HAL_DMA_DIRECTION_PERIPH_TO_MEMORY;
+  dma_config.src_inc = HAL_DMA_SRC_ADDR_FIXED;
+  dma_config.dest_inc = HAL_DMA_DEST_ADDR_INCREMENTED;
+  CHECK(HAL_DMA_Init(&hDmaRx, HAL_GPDMA1_CH3) == HAL_OK, "HAL_DMA_Init Rx");
+  CHECK(HAL_DMA_SetConfigDirectXfer(&hDmaRx, &dma_config) == HAL_OK, "Rx DMA configuration");
+  CHECK(HAL_SPI_SetRxDMA(&hSpi, &hDmaRx) == HAL_OK, "HAL_SPI_SetRxDMA");
+
+  HAL_CORTEX_NVIC_EnableIRQ(SPI1_IRQn);
+  HAL_CORTEX_NVIC_EnableIRQ(GPDMA1_CH2_IRQn);
+  HAL_CORTEX_NVIC_EnableIRQ(GPDMA1_CH3_IRQn);
+  HOST_MODEL_SPI_SetSlave(SPI1, Slave, NULL);
+
+  CHECK(STM32_UTILS_SPI_Q_Init(&Queue, &hSpi) == STM32_UTILS_SPI_Q_OK, "STM32_UTILS_SPI_Q_Init");
+  CHECK(STM32_UTILS_SPI_Q_InitDevice(&DevA, &ConfigA, HAL_GPIOA, 0U, HAL_GPIO_PIN_RESET) == STM32_UTILS_SPI_Q_OK,
+        "STM32_UTILS_SPI_Q_InitDevice A");
+  CHECK(STM32_UTILS_SPI_Q_InitDevice(&DevB, &ConfigB, HAL_GPIOA, 0U, HAL_GPIO_PIN_RESET) == STM32_UTILS_SPI_Q_OK,
+        "STM32_UTILS_SPI_Q_InitDevice B");
+  (void)memset(Xfers, 0, sizeof(Xfers));
+  CbNbr = 0U;
+}
+
+/* Waits for the completion callbacks of the transactions submitted */
+static uint32_t WaitCb(uint32_t cb_nbr)
+{
+  const uint32_t tickstart = HAL_GetTick();
+
+  while ((CbNbr < cb_nbr) && ((HAL_GetTick() - tickstart) < 100U))
+  {
+  }
+
+  return (CbNbr == cb_nbr) ? 1U : 0U;
+}
+
+static void Submit(uint32_t index, stm32_utils_spi_q_device_t *p_device)
+{
+  Xfers[index].p_device = p_device;
+  Xfers[index].p_tx_data = TxData[index];
+  Xfers[index].p_rx_data = RxData[index];
+  Xfers[index].count_packet = XFER_SIZE;
+  Xfers[index].p_xfer_cb = XferCb;
+  (void)memset(RxData[index], 0, XFER_SIZE);
+  CHECK(STM32_UTILS_SPI_Q_Submit(&Queue, &Xfers[index]) == STM32_UTILS_SPI_Q_OK, "STM32_UTILS_SPI_Q_Submit %u",
+        (unsigned int)index);
+}
+
+static void CheckXfer(uint32_t index)
+{
+  CHECK(Xfers[index].status == STM32_UTILS_SPI_Q_OK, "transaction %u: status 0x%X", (unsigned int)index,
+        (unsigned int)Xfers[index].status);
+  for (uint32_t i = 0U; i < XFER_SIZE; i++)
+  {
+    CHECK(RxData[index][i] == (uint8_t)~TxData[index][i], "transaction %u, frame %u: 0x%02X instead of 0x%02X",
+          (unsigned int)index, (unsigned int)i, (unsigned int)RxData[index][i],
+          (unsigned int)(uint8_t)~TxData[index][i]);
+  }
+}
+
+static void CheckBus(const stm32_utils_spi_q_device_config_t *p_config, const char *p_name)
+{
+  CHECK(HAL_SPI_GetBaudRatePrescaler(&hSpi) == p_config->baud_rate_prescaler, "prescaler 0x%X instead of the one of %s",
+        (unsigned int)HAL_SPI_GetBaudRatePrescaler(&hSpi), p_name);
+  CHECK(HAL_SPI_GetFirstBit(&hSpi) == p_config->first_bit, "first bit 0x%X instead of the one of %s",
+        (unsigned int)HAL_SPI_GetFirstBit(&hSpi), p_name);
+}
+
+static void TestQueue(void)
+{
+  stm32_utils_spi_q_stats_t stats_a;
+  stm32_utils_spi_q_stats_t stats_b;
+
+  Start();
+  Submit(0U, &DevA);
+  Submit(1U, &DevB);
+  Submit(2U, &DevA);
+  CHECK(STM32_UTILS_SPI_Q_GetCount(&Queue) == XFER_NBR, "%u transaction(s) queued",
+        (unsigned int)STM32_UTILS_SPI_Q_GetCount(&Queue));
+  CHECK(WaitCb(XFER_NBR) == 1U, "%u completion callback(s)", (unsigned int)CbNbr);
+  CHECK(STM32_UTILS_SPI_Q_GetCount(&Queue) == 0U, "%u transaction(s) left",
+        (unsigned int)STM32_UTILS_SPI_Q_GetCount(&Queue));
+
+  CHECK(HOST_MODEL_SPI_GetTx(SPI1, Mosi, XFER_NBR * XFER_SIZE) == (XFER_NBR * XFER_SIZE), "frames on MOSI");
+  for (uint32_t i = 0U; i < (XFER_NBR * XFER_SIZE); i++)
+  {
+    CHECK(Mosi[i] == TxData[i / XFER_SIZE][i % XFER_SIZE], "MOSI frame %u: 0x%02X instead of 0x%02X",
+          (unsigned int)i, (unsigned int)Mosi[i], (unsigned int)TxData[i / XFER_SIZE][i % XFER_SIZE]);
+  }
+  for (uint32_t i = 0U; i < XFER_NBR; i++)
+  {
+    CheckXfer(i);
+  }
+
+  /* The parameters set by HAL_SPI_SetConfig() are the ones of the first device */
+  STM32_UTILS_SPI_Q_GetDeviceStats(&DevA, &stats_a);
+  STM32_UTILS_SPI_Q_GetDeviceStats(&DevB, &stats_b);
+  CHECK((stats_a.xfer_count == 2U) && (stats_a.packet_count == (2U * XFER_SIZE)) && (stats_a.error_count == 0U)
+        && (stats_a.reconfig_count == 1U),
+        "device A: %u transaction(s), %u packet(s), %u error(s), %u reconfiguration(s)",
+        (unsigned int)stats_a.xfer_count, (unsigned int)stats_a.packet_count, (unsigned int)stats_a.error_count,
+        (unsigned int)stats_a.reconfig_count);
+  CHECK((stats_b.xfer_count == 1U) && (stats_b.error_count == 0U) && (stats_b.reconfig_count == 1U),
+        "device B: %u transaction(s), %u error(s), %u reconfiguration(s)", (unsigned int)stats_b.xfer_count,
+        (unsigned int)stats_b.error_count, (unsigned int)stats_b.reconfig_count);
+  CheckBus(&ConfigA, "device A");
+}
+
+static void TestPartialConfig(void)
+{
+  stm32_utils_spi_q_stats_t stats_b;
+
+  Start();
+  Submit(0U, &DevA);
+  CHECK(WaitCb(1U) == 1U, "%u completion callback(s)", (unsigned int)CbNbr);
+  CheckXfer(0U);
+
+  /* The prescaler is not locked, the first bit is: device B is half applied and its transaction fails */
+  LL_SPI_EnableIOLock(SPI1);
+  Submit(1U, &DevB);
+  CHECK(Xfers[1].status == STM32_UTILS_SPI_Q_ERROR, "status 0x%X with the configuration locked",
+        (unsigned int)Xfers[1].status);
+  CHECK(CbNbr == 2U, "%u completion callback(s)", (unsigned int)CbNbr);
+  CHECK(HAL_SPI_GetBaudRatePrescaler(&hSpi) == ConfigB.baud_rate_prescaler, "prescaler 0x%X",
+        (unsigned int)HAL_SPI_GetBaudRatePrescaler(&hSpi));
+  CHECK(HAL_SPI_GetFirstBit(&hSpi) == ConfigA.first_bit, "first bit 0x%X", (unsigned int)HAL_SPI_GetFirstBit(&hSpi));
+  STM32_UTILS_SPI_Q_GetDeviceStats(&DevB, &stats_b);
+  CHECK((stats_b.error_count == 1U) && (stats_b.reconfig_count == 0U),
+        "device B: %u error(s), %u reconfiguration(s)", (unsigned int)stats_b.error_count,
+        (unsigned int)stats_b.reconfig_count);
+
+  /* Only a reset of the SPI clears the lock, the model lets the test clear it */
+  SPI1->CR1 &= ~SPI_CR1_IOLOCK;
+
+  /* Device A again: its prescaler is set back although it was the last device configured */
+  Submit(2U, &DevA);
+  CHECK(WaitCb(3U) == 1U, "%u completion callback(s)", (unsigned int)CbNbr);
+  CheckXfer(2U);
+  CheckBus(&ConfigA, "device A");
+
+  Submit(1U, &DevB);
+  CHECK(WaitCb(4U) == 1U, "%u completion callback(s)", (unsigned int)CbNbr);
+  CheckXfer(1U);
+  CheckBus(&ConfigB, "device B");
+}
+
+/* Exported functions --------------------------------------------------------*/
+int main(void)
+{
+  for (uint32_t i = 0U; i < XFER_NBR; i++)
+  {
+    for (uint32_t j = 0U; j < XFER_SIZE; j++)
+    {
+      TxData[i][j] = (uint8_t)((i * 0x40U) + (j * 7U) + 1U);
+    }
+  }
+
+  TestQueue();
+  TestPartialConfig();
+
+  return HOST_TEST_Report();
+}
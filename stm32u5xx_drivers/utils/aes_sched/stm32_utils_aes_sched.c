@@ -0,0 +1,880 @@
+/**
+  **********************************************************************************************************************
+  * @file    stm32_utils_aes_sched.c
+  * @brief   This utility multiplexes the messages of several AES sessions on one AES peripheral.
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "stm32_utils_aes_sched.h"
+
+#if defined(USE_HAL_AES_MODULE) && (USE_HAL_AES_MODULE == 1U) \
+    && defined(USE_HAL_AES_DMA) && (USE_HAL_AES_DMA == 1) \
+    && defined(USE_HAL_AES_SUSPEND_RESUME) && (USE_HAL_AES_SUSPEND_RESUME == 1) \
+    && ((defined(USE_HAL_AES_ECB_CBC_ALGO) && (USE_HAL_AES_ECB_CBC_ALGO == 1)) \
+        || (defined(USE_HAL_AES_CTR_ALGO) && (USE_HAL_AES_CTR_ALGO == 1)) \
+        || (defined(USE_HAL_AES_GCM_GMAC_ALGO) && (USE_HAL_AES_GCM_GMAC_ALGO == 1)) \
+        || (defined(USE_HAL_AES_CCM_ALGO) && (USE_HAL_AES_CCM_ALGO == 1)))
+
+/** @addtogroup STM32_UTILS
+  * @{
+  */
+
+/** @addtogroup AES_SCHED
+  * @{
+  */
+
+/** @defgroup AES_SCHED_Introduction AES_SCHED Introduction
+  * @{
+
+  The AES session scheduler shares one AES peripheral between several messages in progress, each one a session with
+  its own algorithm, key and chaining state:
+
+  - A session is opened with STM32_UTILS_AES_SCHED_OpenSession(), with its configuration and a priority, 0 being the
+    highest. Its first job configures the peripheral with HAL_AES_xxx_SetConfig() and HAL_AES_SetNormalKey().
+  - The jobs submitted with STM32_UTILS_AES_SCHED_Submit() are processed in order within their session, by
+    HAL_AES_Encrypt_DMA() or HAL_AES_Decrypt_DMA() calls of at most chunk_size_byte bytes.
+  - After each chunk, the next one is taken from the session of highest priority having jobs, the sessions of equal
+    priority taking turns. The next chunk is started from the DMA completion interrupt of the previous one.
+  - When the session changes, the context of the previous one is saved with HAL_AES_SaveIdleContext() and the context
+    of the next one is restored with HAL_AES_RestoreIdleContext(), so each session continues its message where it
+    stopped.
+  - Each job has its own completion callback, called once all its chunks are processed.
+  - The authentication tag of a GCM or CCM session is computed by STM32_UTILS_AES_SCHED_GenerateAuthTag() once all
+    its jobs are completed. The next job of the session starts a new message from the session configuration.
+
+  The chunk size sets the latency of a high priority session against the cost of the context switches: an
+  ECB or CBC decryption session performs a key derivation at each restoration of its context.
+  Within a session, all the jobs but the last one of a GCM or CCM message are multiples of 16 bytes, and ECB, CBC or
+  CTR jobs are always multiples of 16 bytes. Once a GCM or CCM job of another size is submitted, the next jobs are
+  refused until the tag of the message is generated.
+
+  The AES handle must be initialized, with its DMA channels linked. With USE_HAL_AES_REGISTER_CALLBACKS set,
+  STM32_UTILS_AES_SCHED_Init() registers the AES output transfer complete and error callbacks. Otherwise
+  HAL_AES_OutCpltCallback() must call STM32_UTILS_AES_SCHED_OutCpltCallback() and HAL_AES_ErrorCallback() must call
+  STM32_UTILS_AES_SCHED_ErrorCallback().
+
+  The peripheral must not be used outside of the scheduler once it is initialized.
+
+  */
+/**
+  * @}
+  */
+
+/* Private constants ---------------------------------------------------------*/
+/** @defgroup AES_SCHED_Private_Constants AES_SCHED Private Constants
+  * @{
+  */
+#define AES_SCHED_STATE_IDLE   (0U)  /* No chunk in progress, no session selection running  */
+#define AES_SCHED_STATE_RUN    (1U)  /* Chunk in progress or session selection running      */
+
+#define AES_SCHED_BLOCK_BYTE   (16U) /* AES block size */
+
+/**
+  * @}
+  */
+
+/* Private variables ---------------------------------------------------------*/
+/** @defgroup AES_SCHED_Private_Variables AES_SCHED Private Variables
+  * @{
+  */
+static stm32_utils_aes_sched_t *p_aes_sched_list = NULL; /* Schedulers initialized, one per AES handle */
+
+/**
+  * @}
+  */
+
+/* Private function prototypes -----------------------------------------------*/
+/** @defgroup AES_SCHED_Private_Functions AES_SCHED Private Functions
+  * @{
+  */
+static stm32_utils_aes_sched_t *AES_SCHED_Find(const hal_aes_handle_t *haes);
+static stm32_utils_aes_sched_session_t *AES_SCHED_Select(stm32_utils_aes_sched_t *p_sched);
+static hal_status_t AES_SCHED_Setup(const stm32_utils_aes_sched_t *p_sched,
+                                    const stm32_utils_aes_sched_session_t *p_session);
+static hal_status_t AES_SCHED_Switch(stm32_utils_aes_sched_t *p_sched, stm32_utils_aes_sched_session_t *p_session);
+static void AES_SCHED_Run(stm32_utils_aes_sched_t *p_sched);
+static void AES_SCHED_End(stm32_utils_aes_sched_t *p_sched, stm32_utils_aes_sched_session_t *p_session,
+                          stm32_utils_aes_sched_status_t status);
+/**
+  * @}
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @defgroup AES_SCHED_Exported_Functions AES_SCHED Exported Functions
+  * @{
+  */
+
+/**
+  * @brief  Initialize the session scheduler of an AES peripheral.
+  * @param  p_sched         Pointer to the scheduler, allocated by the application.
+  * @param  haes            Pointer to the AES handle, initialized with its DMA channels linked.
+  * @param  chunk_size_byte Bytes processed by a session before the next session selection, multiple of 16 up to
+  *                         STM32_UTILS_AES_SCHED_CHUNK_MAX_BYTE.
+  * @retval STM32_UTILS_AES_SCHED_OK            The scheduler is ready.
+  * @retval STM32_UTILS_AES_SCHED_INVALID_PARAM A pointer is NULL or the chunk size is not valid.
+  * @retval STM32_UTILS_AES_SCHED_ERROR         The AES callbacks could not be registered.
+  */
+stm32_utils_aes_sched_status_t STM32_UTILS_AES_SCHED_Init(stm32_utils_aes_sched_t *p_sched, hal_aes_handle_t *haes,
+                                                          uint32_t chunk_size_byte)
+{
+  uint32_t primask_bit;
+
+  if ((p_sched == NULL) || (haes == NULL) || (chunk_size_byte == 0U)
+      || (chunk_size_byte > STM32_UTILS_AES_SCHED_CHUNK_MAX_BYTE) || ((chunk_size_byte % AES_SCHED_BLOCK_BYTE) != 0U))
+  {
+    return STM32_UTILS_AES_SCHED_INVALID_PARAM;
+  }
+
+#if defined(USE_HAL_AES_REGISTER_CALLBACKS) && (USE_HAL_AES_REGISTER_CALLBACKS == 1)
+  if ((HAL_AES_RegisterOutTransferCpltCallback(haes, STM32_UTILS_AES_SCHED_OutCpltCallback) != HAL_OK)
+      || (HAL_AES_RegisterErrorCallback(haes, STM32_UTILS_AES_SCHED_ErrorCallback) != HAL_OK))
+  {
+    return STM32_UTILS_AES_SCHED_ERROR;
+  }
+#endif /* USE_HAL_AES_REGISTER_CALLBACKS */
+
+  p_sched->haes            = haes;
+  p_sched->chunk_size_byte = chunk_size_byte;
+  p_sched->p_sessions      = NULL;
+  p_sched->p_current       = NULL;
+  p_sched->p_last          = NULL;
+  p_sched->p_running       = NULL;
+  p_sched->state           = AES_SCHED_STATE_IDLE;
+  p_sched->starting        = 0U;
+  p_sched->start_error     = 0U;
+  p_sched->chunk_count     = 0U;
+  p_sched->switch_count    = 0U;
+
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  if (AES_SCHED_Find(haes) == NULL)
+  {
+    p_sched->p_next = p_aes_sched_list;
+    p_aes_sched_list = p_sched;
+  }
+  __set_PRIMASK(primask_bit);
+
+  return STM32_UTILS_AES_SCHED_OK;
+}
+
+/**
+  * @brief  Open a session, the context of one message.
+  * @param  p_sched   Pointer to the scheduler.
+  * @param  p_session Pointer to the session, allocated by the application.
+  * @param  p_config  Configuration of the session, copied. The key, vector and header it points to are kept until the
+  *                   session is closed.
+  * @param  priority  Priority of the session, 0 is the highest.
+  * @retval STM32_UTILS_AES_SCHED_OK            The session is open.
+  * @retval STM32_UTILS_AES_SCHED_INVALID_PARAM A pointer is NULL or the algorithm is not enabled.
+  */
+stm32_utils_aes_sched_status_t STM32_UTILS_AES_SCHED_OpenSession(stm32_utils_aes_sched_t *p_sched,
+                                                                 stm32_utils_aes_sched_session_t *p_session,
+                                                                 const stm32_utils_aes_sched_session_config_t *p_config,
+                                                                 uint32_t priority)
+{
+  stm32_utils_aes_sched_session_t *p_tail;
+  uint32_t valid = 0U;
+  uint32_t primask_bit;
+
+  if ((p_sched == NULL) || (p_session == NULL) || (p_config == NULL) || (p_config->p_key == NULL))
+  {
+    return STM32_UTILS_AES_SCHED_INVALID_PARAM;
+  }
+
+  switch (p_config->algo)
+  {
+#if defined(USE_HAL_AES_ECB_CBC_ALGO) && (USE_HAL_AES_ECB_CBC_ALGO == 1)
+    case STM32_UTILS_AES_SCHED_ALGO_ECB:
+      valid = 1U;
+      break;
+    case STM32_UTILS_AES_SCHED_ALGO_CBC:
+      valid = (p_config->p_init_vect != NULL) ? 1U : 0U;
+      break;
+#endif /* USE_HAL_AES_ECB_CBC_ALGO */
+#if defined(USE_HAL_AES_CTR_ALGO) && (USE_HAL_AES_CTR_ALGO == 1)
+    case STM32_UTILS_AES_SCHED_ALGO_CTR:
+      valid = (p_config->p_init_vect != NULL) ? 1U : 0U;
+      break;
+#endif /* USE_HAL_AES_CTR_ALGO */
+#if defined(USE_HAL_AES_GCM_GMAC_ALGO) && (USE_HAL_AES_GCM_GMAC_ALGO == 1)
+    case STM32_UTILS_AES_SCHED_ALGO_GCM_GMAC:
+      valid = (p_config->p_gcm_config != NULL) ? 1U : 0U;
+      break;
+#endif /* USE_HAL_AES_GCM_GMAC_ALGO */
+#if defined(USE_HAL_AES_CCM_ALGO) && (USE_HAL_AES_CCM_ALGO == 1)
+    case STM32_UTILS_AES_SCHED_ALGO_CCM:
+      valid = (p_config->p_ccm_config != NULL) ? 1U : 0U;
+      break;
+#endif /* USE_HAL_AES_CCM_ALGO */
+    default:
+      break;
+  }
+
+  if (valid == 0U)
+  {
+    return STM32_UTILS_AES_SCHED_INVALID_PARAM;
+  }
+
+  p_session->config   = *p_config;
+  p_session->priority = priority;
+  p_session->started  = 0U;
+  p_session->closed   = 0U;
+  p_session->p_head   = NULL;
+  p_session->p_tail   = NULL;
+  p_session->p_sched  = p_sched;
+  p_session->p_next   = NULL;
+
+  /* Append the session, the order of the list is the round-robin order */
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  if (p_sched->p_sessions == NULL)
+  {
+    p_sched->p_sessions = p_session;
+  }
+  else
+  {
+    for (p_tail = p_sched->p_sessions; p_tail->p_next != NULL; p_tail = p_tail->p_next)
+    {
+    }
+    p_tail->p_next = p_session;
+  }
+  __set_PRIMASK(primask_bit);
+
+  return STM32_UTILS_AES_SCHED_OK;
+}
+
+/**
+  * @brief  Close a session.
+  * @param  p_session Pointer to the session.
+  * @retval STM32_UTILS_AES_SCHED_OK            The session is closed, its memory can be reused.
+  * @retval STM32_UTILS_AES_SCHED_INVALID_PARAM The pointer is NULL.
+  * @retval STM32_UTILS_AES_SCHED_BUSY          Jobs of the session are pending.
+  */
+stm32_utils_aes_sched_status_t STM32_UTILS_AES_SCHED_CloseSession(stm32_utils_aes_sched_session_t *p_session)
+{
+  stm32_utils_aes_sched_t *p_sched;
+  stm32_utils_aes_sched_session_t **pp_session;
+  uint32_t primask_bit;
+
+  if (p_session == NULL)
+  {
+    return STM32_UTILS_AES_SCHED_INVALID_PARAM;
+  }
+
+  p_sched = p_session->p_sched;
+
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  if ((p_session->p_head != NULL) || (p_sched->p_running == p_session))
+  {
+    __set_PRIMASK(primask_bit);
+    return STM32_UTILS_AES_SCHED_BUSY;
+  }
+
+  for (pp_session = &p_sched->p_sessions; *pp_session != NULL; pp_session = &(*pp_session)->p_next)
+  {
+    if (*pp_session == p_session)
+    {
+      *pp_session = p_session->p_next;
+      break;
+    }
+  }
+
+  /* The peripheral keeps the context of the session, it is configured again by the next switch */
+  if (p_sched->p_current == p_session)
+  {
+    p_sched->p_current = NULL;
+  }
+  if (p_sched->p_last == p_session)
+  {
+    p_sched->p_last = NULL;
+  }
+  __set_PRIMASK(primask_bit);
+
+  return STM32_UTILS_AES_SCHED_OK;
+}
+
+/**
+  * @brief  Submit a job to a session.
+  * @param  p_session Pointer to the session.
+  * @param  p_job     Pointer to the job, allocated by the application, kept by the scheduler until its callback.
+  * @param  p_input   Plaintext or ciphertext, word aligned.
+  * @param  p_output  Processed data, word aligned, of size_byte bytes.
+  * @param  size_byte Bytes to process.
+  * @param  p_cb      Callback called at the end of the job, can be NULL.
+  * @retval STM32_UTILS_AES_SCHED_OK            The job is queued.
+  * @retval STM32_UTILS_AES_SCHED_INVALID_PARAM A pointer is NULL or not aligned, or the size is 0, or not a multiple
+  *                                             of 16 for ECB, CBC and CTR sessions, or the GCM or CCM message was
+  *                                             ended by a job not multiple of 16 and its tag is not generated yet.
+  */
+stm32_utils_aes_sched_status_t STM32_UTILS_AES_SCHED_Submit(stm32_utils_aes_sched_session_t *p_session,
+                                                            stm32_utils_aes_sched_job_t *p_job, const void *p_input,
+                                                            void *p_output, uint32_t size_byte,
+                                                            stm32_utils_aes_sched_cb_t p_cb)
+{
+  stm32_utils_aes_sched_t *p_sched;
+  uint32_t run = 0U;
+  uint32_t primask_bit;
+
+  if ((p_session == NULL) || (p_job == NULL) || (p_input == NULL) || (p_output == NULL) || (size_byte == 0U))
+  {
+    return STM32_UTILS_AES_SCHED_INVALID_PARAM;
+  }
+
+  /* The HAL accesses the buffers by words, and the DMA addresses are 32-bit */
+  if (((((uintptr_t)p_input) & 3U) != 0U) || ((((uintptr_t)p_output) & 3U) != 0U))
+  {
+    return STM32_UTILS_AES_SCHED_INVALID_PARAM;
+  }
+
+  if ((p_session->config.algo != STM32_UTILS_AES_SCHED_ALGO_GCM_GMAC)
+      && (p_session->config.algo != STM32_UTILS_AES_SCHED_ALGO_CCM)
+      && ((size_byte % AES_SCHED_BLOCK_BYTE) != 0U))
+  {
+    return STM32_UTILS_AES_SCHED_INVALID_PARAM;
+  }
+
+  p_sched = p_session->p_sched;
+
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  /* The HAL pads the last block of a GCM or CCM message only: a job not multiple of 16 bytes ends the message */
+  if (p_session->closed != 0U)
+  {
+    __set_PRIMASK(primask_bit);
+    return STM32_UTILS_AES_SCHED_INVALID_PARAM;
+  }
+  if ((size_byte % AES_SCHED_BLOCK_BYTE) != 0U)
+  {
+    p_session->closed = 1U;
+  }
+
+  p_job->p_input    = (const uint8_t *)p_input;
+  p_job->p_output   = (uint8_t *)p_output;
+  p_job->size_byte  = size_byte;
+  p_job->p_cb       = p_cb;
+  p_job->status     = STM32_UTILS_AES_SCHED_BUSY;
+  p_job->done_byte  = 0U;
+  p_job->chunk_byte = 0U;
+  p_job->p_next     = NULL;
+
+  if (p_session->p_tail == NULL)
+  {
+    p_session->p_head = p_job;
+  }
+  else
+  {
+    p_session->p_tail->p_next = p_job;
+  }
+  p_session->p_tail = p_job;
+
+  if (p_sched->state == AES_SCHED_STATE_IDLE)
+  {
+    p_sched->state = AES_SCHED_STATE_RUN;
+    run = 1U;
+  }
+  __set_PRIMASK(primask_bit);
+
+  if (run != 0U)
+  {
+    AES_SCHED_Run(p_sched);
+  }
+
+  return STM32_UTILS_AES_SCHED_OK;
+}
+
+#if (defined(USE_HAL_AES_GCM_GMAC_ALGO) && (USE_HAL_AES_GCM_GMAC_ALGO == 1)) \
+    || (defined(USE_HAL_AES_CCM_ALGO) && (USE_HAL_AES_CCM_ALGO == 1))
+/**
+  * @brief  Generate the authentication tag of the message of a GCM or CCM session.
+  * @param  p_session  Pointer to the session.
+  * @param  p_auth_tag Pointer to the four words of the tag.
+  * @param  timeout_ms Timeout of the tag generation.
+  * @note   The next job of the session starts a new message from the session configuration, which can be updated
+  *         in place before, for instance with a new initialization vector.
+  * @retval STM32_UTILS_AES_SCHED_OK            The tag is generated.
+  * @retval STM32_UTILS_AES_SCHED_INVALID_PARAM A pointer is NULL or the session is not a GCM or CCM one.
+  * @retval STM32_UTILS_AES_SCHED_BUSY          Jobs of the session are pending, or a chunk is in progress.
+  * @retval STM32_UTILS_AES_SCHED_ERROR         No job was processed in the message, or the generation failed.
+  */
+stm32_utils_aes_sched_status_t STM32_UTILS_AES_SCHED_GenerateAuthTag(stm32_utils_aes_sched_session_t *p_session,
+                                                                     uint32_t *p_auth_tag, uint32_t timeout_ms)
+{
+  stm32_utils_aes_sched_t *p_sched;
+  stm32_utils_aes_sched_status_t status = STM32_UTILS_AES_SCHED_ERROR;
+  hal_status_t hal_status = HAL_ERROR;
+  uint32_t primask_bit;
+
+  if ((p_session == NULL) || (p_auth_tag == NULL))
+  {
+    return STM32_UTILS_AES_SCHED_INVALID_PARAM;
+  }
+
+  if ((p_session->config.algo != STM32_UTILS_AES_SCHED_ALGO_GCM_GMAC)
+      && (p_session->config.algo != STM32_UTILS_AES_SCHED_ALGO_CCM))
+  {
+    return STM32_UTILS_AES_SCHED_INVALID_PARAM;
+  }
+
+  p_sched = p_session->p_sched;
+
+  /* Take the peripheral, as a chunk would */
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  if ((p_sched->state != AES_SCHED_STATE_IDLE) || (p_session->p_head != NULL))
+  {
+    __set_PRIMASK(primask_bit);
+    return STM32_UTILS_AES_SCHED_BUSY;
+  }
+  p_sched->state = AES_SCHED_STATE_RUN;
+  __set_PRIMASK(primask_bit);
+
+  if ((p_session->started != 0U) && (AES_SCHED_Switch(p_sched, p_session) == HAL_OK))
+  {
+#if defined(USE_HAL_AES_GCM_GMAC_ALGO) && (USE_HAL_AES_GCM_GMAC_ALGO == 1)
+    if (p_session->config.algo == STM32_UTILS_AES_SCHED_ALGO_GCM_GMAC)
+    {
+      hal_status = HAL_AES_GCM_GenerateAuthTAG(p_sched->haes, p_auth_tag, timeout_ms);
+    }
+#endif /* USE_HAL_AES_GCM_GMAC_ALGO */
+#if defined(USE_HAL_AES_CCM_ALGO) && (USE_HAL_AES_CCM_ALGO == 1)
+    if (p_session->config.algo == STM32_UTILS_AES_SCHED_ALGO_CCM)
+    {
+      hal_status = HAL_AES_CCM_GenerateAuthTAG(p_sched->haes, p_auth_tag, timeout_ms);
+    }
+#endif /* USE_HAL_AES_CCM_ALGO */
+    if (hal_status == HAL_OK)
+    {
+      status = STM32_UTILS_AES_SCHED_OK;
+    }
+  }
+
+  /* The message is over, its context is not saved any more */
+  p_session->started = 0U;
+  p_session->closed  = 0U;
+  p_sched->p_current = NULL;
+
+  /* Give the peripheral back, to the jobs submitted meanwhile if any */
+  AES_SCHED_Run(p_sched);
+
+  return status;
+}
+#endif /* USE_HAL_AES_GCM_GMAC_ALGO or USE_HAL_AES_CCM_ALGO */
+
+/**
+  * @brief  Return whether all the jobs of a session are completed.
+  * @param  p_session Pointer to the session.
+  * @retval uint32_t 1 when no job of the session is pending, 0 otherwise.
+  */
+uint32_t STM32_UTILS_AES_SCHED_IsSessionIdle(const stm32_utils_aes_sched_session_t *p_session)
+{
+  return (p_session->p_head == NULL) ? 1U : 0U;
+}
+
+/**
+  * @brief  Return the number of chunks processed.
+  * @param  p_sched Pointer to the scheduler.
+  * @retval uint32_t Number of chunks.
+  */
+uint32_t STM32_UTILS_AES_SCHED_GetChunkCount(const stm32_utils_aes_sched_t *p_sched)
+{
+  return p_sched->chunk_count;
+}
+
+/**
+  * @brief  Return the number of context switches of the peripheral between sessions.
+  * @param  p_sched Pointer to the scheduler.
+  * @retval uint32_t Number of context switches.
+  */
+uint32_t STM32_UTILS_AES_SCHED_GetSwitchCount(const stm32_utils_aes_sched_t *p_sched)
+{
+  return p_sched->switch_count;
+}
+
+/**
+  * @brief  Account for the end of the chunk in progress and start the next one.
+  * @param  haes Pointer to the AES handle.
+  */
+void STM32_UTILS_AES_SCHED_OutCpltCallback(hal_aes_handle_t *haes)
+{
+  stm32_utils_aes_sched_t *p_sched = AES_SCHED_Find(haes);
+  stm32_utils_aes_sched_session_t *p_session;
+  uint32_t primask_bit;
+
+  if (p_sched == NULL)
+  {
+    return;
+  }
+
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  p_session = p_sched->p_running;
+  p_sched->p_running = NULL;
+  __set_PRIMASK(primask_bit);
+
+  if (p_session != NULL)
+  {
+    AES_SCHED_End(p_sched, p_session, STM32_UTILS_AES_SCHED_OK);
+    AES_SCHED_Run(p_sched);
+  }
+}
+
+/**
+  * @brief  Complete the job in progress with error and start the next one.
+  * @param  haes Pointer to the AES handle.
+  */
+void STM32_UTILS_AES_SCHED_ErrorCallback(hal_aes_handle_t *haes)
+{
+  stm32_utils_aes_sched_t *p_sched = AES_SCHED_Find(haes);
+  stm32_utils_aes_sched_session_t *p_session;
+  uint32_t primask_bit;
+
+  if (p_sched == NULL)
+  {
+    return;
+  }
+
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  p_session = p_sched->p_running;
+  p_sched->p_running = NULL;
+  if ((p_session != NULL) && (p_sched->starting != 0U))
+  {
+    /* Reported from within the start of the chunk, ended by AES_SCHED_Run() once the start returns */
+    p_sched->start_error = 1U;
+    p_session = NULL;
+  }
+  __set_PRIMASK(primask_bit);
+
+  if (p_session != NULL)
+  {
+    AES_SCHED_End(p_sched, p_session, STM32_UTILS_AES_SCHED_ERROR);
+    AES_SCHED_Run(p_sched);
+  }
+}
+
+/**
+  * @}
+  */
+
+/* Private functions ---------------------------------------------------------*/
+/** @addtogroup AES_SCHED_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Find the scheduler of an AES handle.
+  * @param  haes Pointer to the AES handle.
+  * @retval Pointer to the scheduler, NULL when none is initialized on the handle.
+  */
+static stm32_utils_aes_sched_t *AES_SCHED_Find(const hal_aes_handle_t *haes)
+{
+  stm32_utils_aes_sched_t *p_sched;
+
+  for (p_sched = p_aes_sched_list; p_sched != NULL; p_sched = p_sched->p_next)
+  {
+    if (p_sched->haes == haes)
+    {
+      break;
+    }
+  }
+
+  return p_sched;
+}
+
+/**
+  * @brief  Select the session of the next chunk, releasing the scheduler when no job is pending.
+  * @param  p_sched Pointer to the scheduler.
+  * @note   The sessions are scanned from the one following the last served, so that the first session of highest
+  *         priority found takes turns with the other sessions of the same priority.
+  * @retval Pointer to the session, NULL when no job is pending.
+  */
+static stm32_utils_aes_sched_session_t *AES_SCHED_Select(stm32_utils_aes_sched_t *p_sched)
+{
+  stm32_utils_aes_sched_session_t *p_best = NULL;
+  stm32_utils_aes_sched_session_t *p_start;
+  stm32_utils_aes_sched_session_t *p_session;
+  uint32_t primask_bit;
+
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  p_start = ((p_sched->p_last != NULL) && (p_sched->p_last->p_next != NULL)) ? p_sched->p_last->p_next
+            : p_sched->p_sessions;
+  p_session = p_start;
+  while (p_session != NULL)
+  {
+    if ((p_session->p_head != NULL) && ((p_best == NULL) || (p_session->priority < p_best->priority)))
+    {
+      p_best = p_session;
+    }
+
+    p_session = (p_session->p_next != NULL) ? p_session->p_next : p_sched->p_sessions;
+    if (p_session == p_start)
+    {
+      p_session = NULL;
+    }
+  }
+
+  if (p_best == NULL)
+  {
+    p_sched->state = AES_SCHED_STATE_IDLE;
+  }
+  __set_PRIMASK(primask_bit);
+
+  return p_best;
+}
+
+/**
+  * @brief  Configure the peripheral for the first job of the message of a session.
+  * @param  p_sched   Pointer to the scheduler.
+  * @param  p_session Pointer to the session.
+  * @retval HAL_OK    The peripheral is configured.
+  * @retval HAL_ERROR The configuration or the key loading failed.
+  */
+static hal_status_t AES_SCHED_Setup(const stm32_utils_aes_sched_t *p_sched,
+                                    const stm32_utils_aes_sched_session_t *p_session)
+{
+  hal_aes_handle_t *haes = p_sched->haes;
+  const stm32_utils_aes_sched_session_config_t *p_config = &p_session->config;
+  hal_status_t status = HAL_ERROR;
+
+  switch (p_config->algo)
+  {
+#if defined(USE_HAL_AES_ECB_CBC_ALGO) && (USE_HAL_AES_ECB_CBC_ALGO == 1)
+    case STM32_UTILS_AES_SCHED_ALGO_ECB:
+      status = HAL_AES_ECB_SetConfig(haes);
+      break;
+    case STM32_UTILS_AES_SCHED_ALGO_CBC:
+      status = HAL_AES_CBC_SetConfig(haes, p_config->p_init_vect);
+      break;
+#endif /* USE_HAL_AES_ECB_CBC_ALGO */
+#if defined(USE_HAL_AES_CTR_ALGO) && (USE_HAL_AES_CTR_ALGO == 1)
+    case STM32_UTILS_AES_SCHED_ALGO_CTR:
+      status = HAL_AES_CTR_SetConfig(haes, p_config->p_init_vect);
+      break;
+#endif /* USE_HAL_AES_CTR_ALGO */
+#if defined(USE_HAL_AES_GCM_GMAC_ALGO) && (USE_HAL_AES_GCM_GMAC_ALGO == 1)
+    case STM32_UTILS_AES_SCHED_ALGO_GCM_GMAC:
+      status = HAL_AES_GCM_GMAC_SetConfig(haes, p_config->p_gcm_config);
+      break;
+#endif /* USE_HAL_AES_GCM_GMAC_ALGO */
+#if defined(USE_HAL_AES_CCM_ALGO) && (USE_HAL_AES_CCM_ALGO == 1)
+    case STM32_UTILS_AES_SCHED_ALGO_CCM:
+      status = HAL_AES_CCM_SetConfig(haes, p_config->p_ccm_config);
+      break;
+#endif /* USE_HAL_AES_CCM_ALGO */
+    default:
+      break;
+  }
+
+  if (status != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  /* The algorithm configuration resets the swapping, set after it */
+  if ((HAL_AES_SetDataSwapping(haes, p_config->data_swapping) != HAL_OK)
+      || (HAL_AES_SetNormalKey(haes, p_config->key_size, p_config->p_key) != HAL_OK))
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Load the context of a session in the peripheral, saving the context of the session it replaces.
+  * @param  p_sched   Pointer to the scheduler.
+  * @param  p_session Pointer to the session.
+  * @retval HAL_OK    The context of the session is loaded.
+  * @retval HAL_ERROR The context could not be loaded, the session restarts its message with its next job.
+  */
+static hal_status_t AES_SCHED_Switch(stm32_utils_aes_sched_t *p_sched, stm32_utils_aes_sched_session_t *p_session)
+{
+  hal_status_t status;
+
+  if ((p_sched->p_current == p_session) && (p_session->started != 0U))
+  {
+    return HAL_OK;
+  }
+
+  if ((p_sched->p_current != NULL) && (p_sched->p_current->started != 0U))
+  {
+    (void)HAL_AES_SaveIdleContext(p_sched->haes, &p_sched->p_current->context);
+  }
+  p_sched->p_current = NULL;
+  p_sched->switch_count++;
+
+  if (p_session->started != 0U)
+  {
+    status = HAL_AES_RestoreIdleContext(p_sched->haes, &p_session->context);
+  }
+  else
+  {
+    status = AES_SCHED_Setup(p_sched, p_session);
+  }
+
+  if (status != HAL_OK)
+  {
+    p_session->started = 0U;
+    return HAL_ERROR;
+  }
+
+  p_session->started = 1U;
+  p_sched->p_current = p_session;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Start the next chunk, until one is in progress or no job is pending.
+  * @param  p_sched Pointer to the scheduler, taken by the caller.
+  */
+static void AES_SCHED_Run(stm32_utils_aes_sched_t *p_sched)
+{
+  stm32_utils_aes_sched_session_t *p_session;
+  stm32_utils_aes_sched_job_t *p_job;
+  hal_status_t hal_status;
+  uint32_t remain_byte;
+  uint32_t starting;
+  uint32_t end;
+  uint32_t primask_bit;
+
+  for (p_session = AES_SCHED_Select(p_sched); p_session != NULL; p_session = AES_SCHED_Select(p_sched))
+  {
+    p_sched->p_last = p_session;
+
+    if (AES_SCHED_Switch(p_sched, p_session) != HAL_OK)
+    {
+      AES_SCHED_End(p_sched, p_session, STM32_UTILS_AES_SCHED_ERROR);
+      continue;
+    }
+
+    /* A tail shorter than a block is processed with the chunk before it, as the HAL pads it */
+    p_job = p_session->p_head;
+    remain_byte = p_job->size_byte - p_job->done_byte;
+    p_job->chunk_byte = (remain_byte < (p_sched->chunk_size_byte + AES_SCHED_BLOCK_BYTE)) ? remain_byte
+                        : p_sched->chunk_size_byte;
+
+    starting = p_sched->starting;
+    p_sched->starting    = 1U;
+    p_sched->start_error = 0U;
+    p_sched->p_running   = p_session;
+    p_sched->chunk_count++;
+
+    if (p_session->config.dir == STM32_UTILS_AES_SCHED_ENCRYPT)
+    {
+      hal_status = HAL_AES_Encrypt_DMA(p_sched->haes, &p_job->p_input[p_job->done_byte],
+                                       (uint16_t)p_job->chunk_byte, &p_job->p_output[p_job->done_byte]);
+    }
+    else
+    {
+      hal_status = HAL_AES_Decrypt_DMA(p_sched->haes, &p_job->p_input[p_job->done_byte],
+                                       (uint16_t)p_job->chunk_byte, &p_job->p_output[p_job->done_byte]);
+    }
+
+    /* The chunk is over when the start failed, or when the HAL processed it without DMA (a GCM or CCM job shorter
+       than a block), the completion callbacks not being called in both cases */
+    primask_bit = __get_PRIMASK();
+    __set_PRIMASK(1);
+    p_sched->starting = starting;
+    end = 0U;
+    if (p_sched->start_error != 0U)
+    {
+      p_sched->start_error = 0U;
+      end = 1U;
+      hal_status = HAL_ERROR;
+    }
+    else if ((p_sched->p_running == p_session)
+             && ((hal_status != HAL_OK) || (HAL_AES_GetState(p_sched->haes) == HAL_AES_STATE_IDLE)))
+    {
+      p_sched->p_running = NULL;
+      end = 1U;
+    }
+    else
+    {
+      /* In progress, or already completed by its callback which started the next chunk */
+    }
+    __set_PRIMASK(primask_bit);
+
+    if (end == 0U)
+    {
+      break;
+    }
+
+    AES_SCHED_End(p_sched, p_session, (hal_status == HAL_OK) ? STM32_UTILS_AES_SCHED_OK
+                  : STM32_UTILS_AES_SCHED_ERROR);
+  }
+}
+
+/**
+  * @brief  Account for the end of a chunk of the first job of a session, completing the job on its last chunk or on
+  *         error.
+  * @param  p_sched   Pointer to the scheduler.
+  * @param  p_session Pointer to the session.
+  * @param  status    Result of the chunk.
+  */
+static void AES_SCHED_End(stm32_utils_aes_sched_t *p_sched, stm32_utils_aes_sched_session_t *p_session,
+                          stm32_utils_aes_sched_status_t status)
+{
+  stm32_utils_aes_sched_job_t *p_job = p_session->p_head;
+  uint32_t primask_bit;
+
+  if (status == STM32_UTILS_AES_SCHED_OK)
+  {
+    p_job->done_byte += p_job->chunk_byte;
+    if (p_job->done_byte < p_job->size_byte)
+    {
+      return;
+    }
+  }
+  else
+  {
+    /* The message is broken, the next job of the session starts a new one */
+    p_session->started = 0U;
+    if (p_sched->p_current == p_session)
+    {
+      p_sched->p_current = NULL;
+    }
+  }
+
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  p_session->p_head = p_job->p_next;
+  if (p_session->p_head == NULL)
+  {
+    p_session->p_tail = NULL;
+  }
+  __set_PRIMASK(primask_bit);
+
+  p_job->status = status;
+  if (p_job->p_cb != NULL)
+  {
+    p_job->p_cb(p_job);
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* USE_HAL_AES_MODULE && USE_HAL_AES_DMA && USE_HAL_AES_SUSPEND_RESUME && USE_HAL_AES_xxx_ALGO */
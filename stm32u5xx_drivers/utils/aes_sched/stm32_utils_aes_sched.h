@@ -0,0 +1,231 @@
+/**
+  **********************************************************************************************************************
+  * @file    stm32_utils_aes_sched.h
+  * @brief   Header file of UTILS AES session scheduler module.
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -----------------------------------------------------------------------------*/
+#ifndef STM32_UTILS_AES_SCHED_H
+#define STM32_UTILS_AES_SCHED_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32_hal.h"
+#include <stdint.h>
+
+#if defined(USE_HAL_AES_MODULE) && (USE_HAL_AES_MODULE == 1U) \
+    && defined(USE_HAL_AES_DMA) && (USE_HAL_AES_DMA == 1) \
+    && defined(USE_HAL_AES_SUSPEND_RESUME) && (USE_HAL_AES_SUSPEND_RESUME == 1) \
+    && ((defined(USE_HAL_AES_ECB_CBC_ALGO) && (USE_HAL_AES_ECB_CBC_ALGO == 1)) \
+        || (defined(USE_HAL_AES_CTR_ALGO) && (USE_HAL_AES_CTR_ALGO == 1)) \
+        || (defined(USE_HAL_AES_GCM_GMAC_ALGO) && (USE_HAL_AES_GCM_GMAC_ALGO == 1)) \
+        || (defined(USE_HAL_AES_CCM_ALGO) && (USE_HAL_AES_CCM_ALGO == 1)))
+
+/** @addtogroup STM32_UTILS
+  * @{
+  */
+
+/** @addtogroup AES_SCHED
+  * @{
+  */
+
+/* Exported constants --------------------------------------------------------*/
+/** @defgroup AES_SCHED_Exported_Constants AES_SCHED Exported Constants
+  * @{
+  */
+
+/** @brief Largest chunk, the largest multiple of the AES block fitting in the 16-bit size of the HAL DMA calls */
+#define STM32_UTILS_AES_SCHED_CHUNK_MAX_BYTE  0xFFF0U
+
+/**
+  * @}
+  */
+
+/* Exported types ------------------------------------------------------------*/
+/** @defgroup AES_SCHED_Exported_Types AES_SCHED Exported Types
+  * @{
+  */
+
+/**
+  * @brief  AES_SCHED Utils Status structures definition
+  */
+typedef enum
+{
+  STM32_UTILS_AES_SCHED_OK            = 0x00000000U, /*!< Utils AES_SCHED operation completed successfully  */
+  STM32_UTILS_AES_SCHED_ERROR         = 0xFFFFFFFFU, /*!< Utils AES_SCHED operation completed with error    */
+  STM32_UTILS_AES_SCHED_INVALID_PARAM = 0xAAAAAAAAU, /*!< Utils AES_SCHED invalid parameter                 */
+  STM32_UTILS_AES_SCHED_BUSY          = 0x55555555U, /*!< Utils AES_SCHED job pending or ongoing            */
+} stm32_utils_aes_sched_status_t;
+
+/**
+  * @brief  AES_SCHED session algorithm
+  */
+typedef enum
+{
+  STM32_UTILS_AES_SCHED_ALGO_ECB      = 0x00000000U, /*!< ECB, requires USE_HAL_AES_ECB_CBC_ALGO  */
+  STM32_UTILS_AES_SCHED_ALGO_CBC      = 0x00000001U, /*!< CBC, requires USE_HAL_AES_ECB_CBC_ALGO  */
+  STM32_UTILS_AES_SCHED_ALGO_CTR      = 0x00000002U, /*!< CTR, requires USE_HAL_AES_CTR_ALGO      */
+  STM32_UTILS_AES_SCHED_ALGO_GCM_GMAC = 0x00000003U, /*!< GCM, requires USE_HAL_AES_GCM_GMAC_ALGO */
+  STM32_UTILS_AES_SCHED_ALGO_CCM      = 0x00000004U, /*!< CCM, requires USE_HAL_AES_CCM_ALGO      */
+} stm32_utils_aes_sched_algo_t;
+
+/**
+  * @brief  AES_SCHED session direction
+  */
+typedef enum
+{
+  STM32_UTILS_AES_SCHED_ENCRYPT = 0x00000000U, /*!< Jobs processed by HAL_AES_Encrypt_DMA() */
+  STM32_UTILS_AES_SCHED_DECRYPT = 0x00000001U, /*!< Jobs processed by HAL_AES_Decrypt_DMA() */
+} stm32_utils_aes_sched_dir_t;
+
+/**
+  * @brief  AES_SCHED session configuration, the buffers pointed to are kept by the session until it is closed.
+  */
+typedef struct
+{
+  stm32_utils_aes_sched_algo_t algo;          /*!< Algorithm of the session                                  */
+  stm32_utils_aes_sched_dir_t  dir;           /*!< Direction of all the jobs of the session                  */
+  hal_aes_key_size_t           key_size;      /*!< Key size                                                  */
+  const uint32_t               *p_key;        /*!< Normal key                                                */
+  const uint32_t               *p_init_vect;  /*!< Initialization vector, CBC and CTR                        */
+#if defined(USE_HAL_AES_GCM_GMAC_ALGO) && (USE_HAL_AES_GCM_GMAC_ALGO == 1)
+  const hal_aes_gcm_config_t   *p_gcm_config; /*!< Initialization vector and header, GCM                     */
+#endif /* USE_HAL_AES_GCM_GMAC_ALGO */
+#if defined(USE_HAL_AES_CCM_ALGO) && (USE_HAL_AES_CCM_ALGO == 1)
+  const hal_aes_ccm_config_t   *p_ccm_config; /*!< B0 block and header, CCM                                  */
+#endif /* USE_HAL_AES_CCM_ALGO */
+  hal_aes_data_swapping_t      data_swapping; /*!< Data swapping of the jobs                                 */
+} stm32_utils_aes_sched_session_config_t;
+
+typedef struct stm32_utils_aes_sched_job_s stm32_utils_aes_sched_job_t;
+
+/**
+  * @brief  AES_SCHED job completion callback, called in the DMA interrupt context, or in the caller context for the
+  *         jobs processed without DMA.
+  */
+typedef void (*stm32_utils_aes_sched_cb_t)(stm32_utils_aes_sched_job_t *p_job);
+
+/**
+  * @brief  AES_SCHED job, allocated by the application and filled by STM32_UTILS_AES_SCHED_Submit().
+  *
+  * The job belongs to the scheduler until its callback is called.
+  */
+struct stm32_utils_aes_sched_job_s
+{
+  const uint8_t                         *p_input;    /*!< Plaintext or ciphertext, word aligned                */
+  uint8_t                               *p_output;   /*!< Processed data, word aligned                         */
+  uint32_t                              size_byte;   /*!< Bytes to process                                     */
+  stm32_utils_aes_sched_cb_t            p_cb;        /*!< Completion callback, can be NULL                     */
+  void                                  *p_user_data; /*!< Application context, not used by the scheduler     */
+  volatile stm32_utils_aes_sched_status_t status;    /*!< BUSY until completion, then the result               */
+  uint32_t                              done_byte;   /*!< Private: bytes processed                             */
+  uint32_t                              chunk_byte;  /*!< Private: bytes of the chunk in progress              */
+  stm32_utils_aes_sched_job_t           *p_next;     /*!< Private: next job of the session                     */
+};
+
+typedef struct stm32_utils_aes_sched_s stm32_utils_aes_sched_t;
+
+/**
+  * @brief  AES_SCHED session, one message context of the peripheral, allocated by the application.
+  *
+  * The fields are private to the scheduler.
+  */
+typedef struct stm32_utils_aes_sched_session_s
+{
+  stm32_utils_aes_sched_session_config_t config;     /*!< Configuration of the session                        */
+  uint32_t                               priority;   /*!< Priority, 0 is the highest                          */
+  hal_aes_save_context_t                 context;    /*!< Peripheral context while another session runs       */
+  uint32_t                               started;    /*!< Message started, the context is valid               */
+  uint32_t                               closed;     /*!< GCM or CCM message ended by a partial block job     */
+  stm32_utils_aes_sched_job_t            *p_head;    /*!< First job waiting or in progress                    */
+  stm32_utils_aes_sched_job_t            *p_tail;    /*!< Last job waiting                                    */
+  stm32_utils_aes_sched_t                *p_sched;   /*!< Scheduler owning the session                        */
+  struct stm32_utils_aes_sched_session_s *p_next;    /*!< Next session of the scheduler                       */
+} stm32_utils_aes_sched_session_t;
+
+/**
+  * @brief  AES_SCHED scheduler of one AES peripheral, allocated by the application.
+  *
+  * The fields are private to the scheduler.
+  */
+struct stm32_utils_aes_sched_s
+{
+  hal_aes_handle_t                *haes;            /*!< AES peripheral, DMA channels linked                 */
+  uint32_t                        chunk_size_byte;  /*!< Bytes processed before the next session selection   */
+  stm32_utils_aes_sched_session_t *p_sessions;      /*!< Sessions opened, in round-robin order               */
+  stm32_utils_aes_sched_session_t *p_current;       /*!< Session whose context is in the peripheral          */
+  stm32_utils_aes_sched_session_t *p_last;          /*!< Session of the last chunk, for the round-robin       */
+  stm32_utils_aes_sched_session_t *volatile p_running; /*!< Session of the chunk in progress               */
+  volatile uint32_t               state;            /*!< Scheduler state                                     */
+  volatile uint32_t               starting;         /*!< A chunk is being started                            */
+  volatile uint32_t               start_error;      /*!< Error reported while a chunk was being started      */
+  uint32_t                        chunk_count;      /*!< Chunks processed                                    */
+  uint32_t                        switch_count;     /*!< Context switches of the peripheral                  */
+  struct stm32_utils_aes_sched_s  *p_next;          /*!< Next scheduler, to find the one of an AES handle    */
+};
+
+/**
+  * @}
+  */
+
+/* Exported functions ------------------------------------------------------------------------------------------------*/
+/** @addtogroup AES_SCHED_Exported_Functions
+  * @{
+  */
+stm32_utils_aes_sched_status_t STM32_UTILS_AES_SCHED_Init(stm32_utils_aes_sched_t *p_sched, hal_aes_handle_t *haes,
+                                                          uint32_t chunk_size_byte);
+stm32_utils_aes_sched_status_t STM32_UTILS_AES_SCHED_OpenSession(stm32_utils_aes_sched_t *p_sched,
+                                                                 stm32_utils_aes_sched_session_t *p_session,
+                                                                 const stm32_utils_aes_sched_session_config_t *p_config,
+                                                                 uint32_t priority);
+stm32_utils_aes_sched_status_t STM32_UTILS_AES_SCHED_CloseSession(stm32_utils_aes_sched_session_t *p_session);
+stm32_utils_aes_sched_status_t STM32_UTILS_AES_SCHED_Submit(stm32_utils_aes_sched_session_t *p_session,
+                                                            stm32_utils_aes_sched_job_t *p_job, const void *p_input,
+                                                            void *p_output, uint32_t size_byte,
+                                                            stm32_utils_aes_sched_cb_t p_cb);
+#if (defined(USE_HAL_AES_GCM_GMAC_ALGO) && (USE_HAL_AES_GCM_GMAC_ALGO == 1)) \
+    || (defined(USE_HAL_AES_CCM_ALGO) && (USE_HAL_AES_CCM_ALGO == 1))
+stm32_utils_aes_sched_status_t STM32_UTILS_AES_SCHED_GenerateAuthTag(stm32_utils_aes_sched_session_t *p_session,
+                                                                     uint32_t *p_auth_tag, uint32_t timeout_ms);
+#endif /* USE_HAL_AES_GCM_GMAC_ALGO or USE_HAL_AES_CCM_ALGO */
+uint32_t STM32_UTILS_AES_SCHED_IsSessionIdle(const stm32_utils_aes_sched_session_t *p_session);
+uint32_t STM32_UTILS_AES_SCHED_GetChunkCount(const stm32_utils_aes_sched_t *p_sched);
+uint32_t STM32_UTILS_AES_SCHED_GetSwitchCount(const stm32_utils_aes_sched_t *p_sched);
+
+/* To be called from HAL_AES_OutCpltCallback and HAL_AES_ErrorCallback when USE_HAL_AES_REGISTER_CALLBACKS is not set */
+void STM32_UTILS_AES_SCHED_OutCpltCallback(hal_aes_handle_t *haes);
+void STM32_UTILS_AES_SCHED_ErrorCallback(hal_aes_handle_t *haes);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* USE_HAL_AES_MODULE && USE_HAL_AES_DMA && USE_HAL_AES_SUSPEND_RESUME && USE_HAL_AES_xxx_ALGO */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32_UTILS_AES_SCHED_H */
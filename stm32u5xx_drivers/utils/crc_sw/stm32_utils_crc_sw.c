@@ -0,0 +1,382 @@
+/**
+  **********************************************************************************************************************
+  * @file    stm32_utils_crc_sw.c
+  * @brief   This utility computes in software the CRC the CRC peripheral computes with the same configuration.
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "stm32_utils_crc_sw.h"
+
+#if defined(USE_HAL_CRC_MODULE) && (USE_HAL_CRC_MODULE == 1U)
+
+/** @addtogroup STM32_UTILS
+  * @{
+  */
+
+/** @addtogroup CRC_SW
+  * @{
+  */
+
+/** @defgroup CRC_SW_Introduction CRC_SW Introduction
+  * @{
+
+  The software CRC engine gives the result HAL_CRC_Calculate() and HAL_CRC_Accumulate() give for the same
+  @ref hal_crc_config_t and the same data, without the CRC peripheral:
+
+  - It is a reference for the peripheral results, and it runs on any target as it does not access any register.
+  - It is a fallback while the peripheral is used by another calculation, for instance a long HAL_CRC_Calculate_DMA().
+
+  The data are processed 8 bytes at a time with 8 tables of 256 entries built by STM32_UTILS_CRC_SW_Init() for the
+  polynomial (slice-by-8):
+
+  - Without input reverse mode, the CRC is kept left aligned in 32 bits and the bytes are processed most significant
+    bit first, as the peripheral does.
+  - With an input reverse mode, the CRC is kept bit reversed and the bytes are processed least significant bit first,
+    which is the same as processing the bit reversed bytes. The half-word and word modes reverse the bits of a
+    half-word or a word: the bytes of each half-word or word are processed in the reverse order.
+  - The output reverse mode reverses the bits of the CRC on the polynomial size.
+
+  The same data size rules as the peripheral apply: a multiple of 2 bytes in half-word input reverse mode, a multiple of
+  4 bytes in word input reverse mode.
+
+  */
+/**
+  * @}
+  */
+
+/* Private function prototypes -----------------------------------------------*/
+/** @defgroup CRC_SW_Private_Functions CRC_SW Private Functions
+  * @{
+  */
+static uint32_t CRC_SW_Reflect(uint32_t value, uint32_t bit_nbr);
+static void CRC_SW_Process(stm32_utils_crc_sw_t *p_crc, const uint8_t *p_data, uint32_t size_byte);
+static uint32_t CRC_SW_GetResult(const stm32_utils_crc_sw_t *p_crc);
+/**
+  * @}
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @defgroup CRC_SW_Exported_Functions CRC_SW Exported Functions
+  * @{
+  */
+
+/**
+  * @brief  Initialize the software CRC engine.
+  * @param  p_crc    Pointer to the engine, allocated by the application.
+  * @param  p_config Pointer to the CRC configuration, as given to HAL_CRC_SetConfig().
+  * @retval STM32_UTILS_CRC_SW_OK            The engine is ready, its CRC is set to the init value.
+  * @retval STM32_UTILS_CRC_SW_INVALID_PARAM A pointer is NULL or the configuration is invalid: even polynomial,
+  *                                          polynomial larger than its size or unknown mode.
+  */
+stm32_utils_crc_sw_status_t STM32_UTILS_CRC_SW_Init(stm32_utils_crc_sw_t *p_crc, const hal_crc_config_t *p_config)
+{
+  stm32_utils_crc_sw_status_t status = STM32_UTILS_CRC_SW_OK;
+  uint32_t poly;
+  uint32_t mask;
+  uint32_t value;
+  uint32_t i;
+  uint32_t j;
+
+  if ((p_crc == NULL) || (p_config == NULL))
+  {
+    return STM32_UTILS_CRC_SW_INVALID_PARAM;
+  }
+
+  switch (p_config->polynomial_size)
+  {
+    case HAL_CRC_POLY_SIZE_32B:
+      p_crc->poly_bit = 32U;
+      break;
+    case HAL_CRC_POLY_SIZE_16B:
+      p_crc->poly_bit = 16U;
+      break;
+    case HAL_CRC_POLY_SIZE_8B:
+      p_crc->poly_bit = 8U;
+      break;
+    case HAL_CRC_POLY_SIZE_7B:
+      p_crc->poly_bit = 7U;
+      break;
+    default:
+      status = STM32_UTILS_CRC_SW_INVALID_PARAM;
+      break;
+  }
+
+  switch (p_config->input_data_reverse_mode)
+  {
+    case HAL_CRC_INDATA_REVERSE_NONE:
+      p_crc->reflected = 0U;
+      p_crc->swap      = 0U;
+      break;
+    case HAL_CRC_INDATA_REVERSE_BYTE:
+      p_crc->reflected = 1U;
+      p_crc->swap      = 0U;
+      break;
+    case HAL_CRC_INDATA_REVERSE_HALFWORD:
+      p_crc->reflected = 1U;
+      p_crc->swap      = 1U;
+      break;
+    case HAL_CRC_INDATA_REVERSE_WORD:
+      p_crc->reflected = 1U;
+      p_crc->swap      = 3U;
+      break;
+    default:
+      status = STM32_UTILS_CRC_SW_INVALID_PARAM;
+      break;
+  }
+
+  if ((status != STM32_UTILS_CRC_SW_OK)
+      || ((p_config->output_data_reverse_mode != HAL_CRC_OUTDATA_REVERSE_NONE)
+          && (p_config->output_data_reverse_mode != HAL_CRC_OUTDATA_REVERSE_BIT)))
+  {
+    return STM32_UTILS_CRC_SW_INVALID_PARAM;
+  }
+  p_crc->out_reverse = (p_config->output_data_reverse_mode == HAL_CRC_OUTDATA_REVERSE_BIT) ? 1U : 0U;
+
+  mask = 0xFFFFFFFFU >> (32U - p_crc->poly_bit);
+  poly = p_config->polynomial_coefficient;
+
+  /* The peripheral does not support even polynomials */
+  if (((poly & 1U) == 0U) || ((poly & ~mask) != 0U))
+  {
+    return STM32_UTILS_CRC_SW_INVALID_PARAM;
+  }
+
+  if (p_crc->reflected == 0U)
+  {
+    poly <<= 32U - p_crc->poly_bit;
+
+    for (i = 0U; i < 256U; i++)
+    {
+      value = i << 24U;
+      for (j = 0U; j < 8U; j++)
+      {
+        value = ((value & 0x80000000U) != 0U) ? ((value << 1U) ^ poly) : (value << 1U);
+      }
+      p_crc->table[0][i] = value;
+    }
+
+    for (i = 0U; i < 256U; i++)
+    {
+      for (j = 1U; j < 8U; j++)
+      {
+        value = p_crc->table[j - 1U][i];
+        p_crc->table[j][i] = (value << 8U) ^ p_crc->table[0][value >> 24U];
+      }
+    }
+
+    p_crc->init = (p_config->crc_init_value & mask) << (32U - p_crc->poly_bit);
+  }
+  else
+  {
+    poly = CRC_SW_Reflect(poly, p_crc->poly_bit);
+
+    for (i = 0U; i < 256U; i++)
+    {
+      value = i;
+      for (j = 0U; j < 8U; j++)
+      {
+        value = ((value & 1U) != 0U) ? ((value >> 1U) ^ poly) : (value >> 1U);
+      }
+      p_crc->table[0][i] = value;
+    }
+
+    for (i = 0U; i < 256U; i++)
+    {
+      for (j = 1U; j < 8U; j++)
+      {
+        value = p_crc->table[j - 1U][i];
+        p_crc->table[j][i] = (value >> 8U) ^ p_crc->table[0][value & 0xFFU];
+      }
+    }
+
+    p_crc->init = CRC_SW_Reflect(p_config->crc_init_value & mask, p_crc->poly_bit);
+  }
+
+  p_crc->crc = p_crc->init;
+
+  return STM32_UTILS_CRC_SW_OK;
+}
+
+/**
+  * @brief  Compute the CRC of a data buffer starting with the init value, as HAL_CRC_Calculate() does.
+  * @param  p_crc        Pointer to the engine.
+  * @param  p_data       Pointer to the data buffer, without alignment constraint.
+  * @param  size_byte    Data buffer length in bytes.
+  * @param  p_crc_result Calculated CRC, with the size of the polynomial.
+  * @retval STM32_UTILS_CRC_SW_OK            The CRC is calculated.
+  * @retval STM32_UTILS_CRC_SW_INVALID_PARAM A pointer is NULL, or the size is 0 or not aligned to the input reverse
+  *                                          mode.
+  */
+stm32_utils_crc_sw_status_t STM32_UTILS_CRC_SW_Calculate(stm32_utils_crc_sw_t *p_crc, const void *p_data,
+                                                         uint32_t size_byte, uint32_t *p_crc_result)
+{
+  if (p_crc == NULL)
+  {
+    return STM32_UTILS_CRC_SW_INVALID_PARAM;
+  }
+
+  p_crc->crc = p_crc->init;
+
+  return STM32_UTILS_CRC_SW_Accumulate(p_crc, p_data, size_byte, p_crc_result);
+}
+
+/**
+  * @brief  Compute the CRC of a data buffer starting with the previously computed CRC, as HAL_CRC_Accumulate() does.
+  * @param  p_crc        Pointer to the engine.
+  * @param  p_data       Pointer to the data buffer, without alignment constraint.
+  * @param  size_byte    Data buffer length in bytes.
+  * @param  p_crc_result Calculated CRC, with the size of the polynomial.
+  * @retval STM32_UTILS_CRC_SW_OK            The CRC is calculated.
+  * @retval STM32_UTILS_CRC_SW_INVALID_PARAM A pointer is NULL, or the size is 0 or not aligned to the input reverse
+  *                                          mode.
+  */
+stm32_utils_crc_sw_status_t STM32_UTILS_CRC_SW_Accumulate(stm32_utils_crc_sw_t *p_crc, const void *p_data,
+                                                          uint32_t size_byte, uint32_t *p_crc_result)
+{
+  if ((p_crc == NULL) || (p_data == NULL) || (p_crc_result == NULL) || (size_byte == 0U)
+      || ((size_byte & p_crc->swap) != 0U))
+  {
+    return STM32_UTILS_CRC_SW_INVALID_PARAM;
+  }
+
+  CRC_SW_Process(p_crc, (const uint8_t *)p_data, size_byte);
+
+  *p_crc_result = CRC_SW_GetResult(p_crc);
+
+  return STM32_UTILS_CRC_SW_OK;
+}
+
+/**
+  * @}
+  */
+
+/* Private functions ---------------------------------------------------------*/
+/** @addtogroup CRC_SW_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Reverse the order of the lower bits of a value.
+  * @param  value   Value to reverse, the bits above bit_nbr being 0.
+  * @param  bit_nbr Number of bits to reverse, 1 to 32.
+  * @retval Reversed value.
+  */
+static uint32_t CRC_SW_Reflect(uint32_t value, uint32_t bit_nbr)
+{
+  uint32_t result = 0U;
+  uint32_t i;
+
+  for (i = 0U; i < bit_nbr; i++)
+  {
+    result = (result << 1U) | ((value >> i) & 1U);
+  }
+
+  return result;
+}
+
+/**
+  * @brief  Process data bytes into the current CRC.
+  * @param  p_crc     Pointer to the engine.
+  * @param  p_data    Pointer to the data.
+  * @param  size_byte Number of bytes, multiple of the input reverse mode granularity.
+  */
+static void CRC_SW_Process(stm32_utils_crc_sw_t *p_crc, const uint8_t *p_data, uint32_t size_byte)
+{
+  const uint32_t (*p_table)[256] = p_crc->table;
+  const uint8_t *p_byte = p_data;
+  uint32_t swap = p_crc->swap;
+  uint32_t count = size_byte;
+  uint32_t crc = p_crc->crc;
+  uint32_t i;
+
+  /* Byte i of the data is p_byte[i ^ swap]: the bytes of each half-word or word are taken in the reverse order in the
+     half-word and word input reverse modes */
+  if (p_crc->reflected == 0U)
+  {
+    while (count >= 8U)
+    {
+      crc ^= ((uint32_t)p_byte[0] << 24U) | ((uint32_t)p_byte[1] << 16U) | ((uint32_t)p_byte[2] << 8U)
+             | (uint32_t)p_byte[3];
+      crc = p_table[7][crc >> 24U] ^ p_table[6][(crc >> 16U) & 0xFFU] ^ p_table[5][(crc >> 8U) & 0xFFU]
+            ^ p_table[4][crc & 0xFFU] ^ p_table[3][p_byte[4]] ^ p_table[2][p_byte[5]] ^ p_table[1][p_byte[6]]
+            ^ p_table[0][p_byte[7]];
+      p_byte += 8U;
+      count -= 8U;
+    }
+
+    for (i = 0U; i < count; i++)
+    {
+      crc = (crc << 8U) ^ p_table[0][(crc >> 24U) ^ p_byte[i]];
+    }
+  }
+  else
+  {
+    while (count >= 8U)
+    {
+      crc ^= (uint32_t)p_byte[0U ^ swap] | ((uint32_t)p_byte[1U ^ swap] << 8U) | ((uint32_t)p_byte[2U ^ swap] << 16U)
+             | ((uint32_t)p_byte[3U ^ swap] << 24U);
+      crc = p_table[7][crc & 0xFFU] ^ p_table[6][(crc >> 8U) & 0xFFU] ^ p_table[5][(crc >> 16U) & 0xFFU]
+            ^ p_table[4][crc >> 24U] ^ p_table[3][p_byte[4U ^ swap]] ^ p_table[2][p_byte[5U ^ swap]]
+            ^ p_table[1][p_byte[6U ^ swap]] ^ p_table[0][p_byte[7U ^ swap]];
+      p_byte += 8U;
+      count -= 8U;
+    }
+
+    for (i = 0U; i < count; i++)
+    {
+      crc = (crc >> 8U) ^ p_table[0][(crc ^ p_byte[i ^ swap]) & 0xFFU];
+    }
+  }
+
+  p_crc->crc = crc;
+}
+
+/**
+  * @brief  Get the current CRC as the CRC data register gives it.
+  * @param  p_crc Pointer to the engine.
+  * @retval CRC with the size of the polynomial.
+  */
+static uint32_t CRC_SW_GetResult(const stm32_utils_crc_sw_t *p_crc)
+{
+  uint32_t result;
+
+  if (p_crc->reflected == 0U)
+  {
+    result = p_crc->crc >> (32U - p_crc->poly_bit);
+    if (p_crc->out_reverse != 0U)
+    {
+      result = CRC_SW_Reflect(result, p_crc->poly_bit);
+    }
+  }
+  else
+  {
+    result = (p_crc->out_reverse != 0U) ? p_crc->crc : CRC_SW_Reflect(p_crc->crc, p_crc->poly_bit);
+  }
+
+  return result;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* USE_HAL_CRC_MODULE */
@@ -0,0 +1,102 @@
+/**
+  **********************************************************************************************************************
+  * @file    stm32_utils_crc_sw.h
+  * @brief   Header file of UTILS software CRC module.
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -----------------------------------------------------------------------------*/
+#ifndef STM32_UTILS_CRC_SW_H
+#define STM32_UTILS_CRC_SW_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32_hal.h"
+#include <stdint.h>
+
+#if defined(USE_HAL_CRC_MODULE) && (USE_HAL_CRC_MODULE == 1U)
+
+/** @addtogroup STM32_UTILS
+  * @{
+  */
+
+/** @addtogroup CRC_SW
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+/** @defgroup CRC_SW_Exported_Types CRC_SW Exported Types
+  * @{
+  */
+
+/**
+  * @brief  CRC_SW Utils Status structures definition
+  */
+typedef enum
+{
+  STM32_UTILS_CRC_SW_OK            = 0x00000000U, /*!< Utils CRC_SW operation completed successfully */
+  STM32_UTILS_CRC_SW_INVALID_PARAM = 0xAAAAAAAAU, /*!< Utils CRC_SW invalid parameter                */
+} stm32_utils_crc_sw_status_t;
+
+/**
+  * @brief  CRC_SW engine, allocated by the application.
+  *
+  * The fields are private to the engine. The tables take 8 Kbytes.
+  */
+typedef struct
+{
+  uint32_t table[8][256]; /*!< Slice-by-8 tables of the polynomial                          */
+  uint32_t poly_bit;      /*!< Polynomial size in bits                                      */
+  uint32_t init;          /*!< Initial value, in the representation of crc                  */
+  uint32_t crc;           /*!< Current CRC, left aligned, or bit reversed when reflected    */
+  uint32_t reflected;     /*!< Input bit reversed, bytes processed least significant first  */
+  uint32_t swap;          /*!< Byte index exchange of the input reverse mode granularity    */
+  uint32_t out_reverse;   /*!< Output bit reversed                                          */
+} stm32_utils_crc_sw_t;
+
+/**
+  * @}
+  */
+
+/* Exported functions ------------------------------------------------------------------------------------------------*/
+/** @addtogroup CRC_SW_Exported_Functions
+  * @{
+  */
+stm32_utils_crc_sw_status_t STM32_UTILS_CRC_SW_Init(stm32_utils_crc_sw_t *p_crc, const hal_crc_config_t *p_config);
+stm32_utils_crc_sw_status_t STM32_UTILS_CRC_SW_Calculate(stm32_utils_crc_sw_t *p_crc, const void *p_data,
+                                                         uint32_t size_byte, uint32_t *p_crc_result);
+stm32_utils_crc_sw_status_t STM32_UTILS_CRC_SW_Accumulate(stm32_utils_crc_sw_t *p_crc, const void *p_data,
+                                                          uint32_t size_byte, uint32_t *p_crc_result);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* USE_HAL_CRC_MODULE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32_UTILS_CRC_SW_H */
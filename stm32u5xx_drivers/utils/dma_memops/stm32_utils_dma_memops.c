@@ -0,0 +1,727 @@
+/**
+  **********************************************************************************************************************
+  * @file    stm32_utils_dma_memops.c
+  * @brief   This utility queues memory copies and fills on a pool of DMA channels.
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "stm32_utils_dma_memops.h"
+#include <string.h>
+
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+
+/** @addtogroup STM32_UTILS
+  * @{
+  */
+
+/** @addtogroup DMA_MEMOPS
+  * @{
+  */
+
+/** @defgroup DMA_MEMOPS_Introduction DMA_MEMOPS Introduction
+  * @{
+
+  The DMA memory operations service owns a pool of DMA channels and executes memory copies, memory fills and
+  2D copies (rows with line strides) in the background:
+
+  - The application gives the channels, each with an array of linked-list nodes, to
+    STM32_UTILS_DMA_MEMOPS_AddChannel(), then submits requests with STM32_UTILS_DMA_MEMOPS_Memcpy(),
+    STM32_UTILS_DMA_MEMOPS_Memset() and STM32_UTILS_DMA_MEMOPS_Memcpy2D().
+  - A request is split in parts of at most one node per block of STM32_UTILS_DMA_MEMOPS_BLOCK_MAX_BYTE bytes, or one
+    node per row in 2D, and as many nodes as the channel has. The parts of a large request are spread over the free
+    channels.
+  - The requests are started in submission order. A request with parts left goes back to the end of the queue once
+    a part is given to a channel, so that a large request cannot hold all the channels while smaller ones wait.
+  - The data width is the largest of word, half-word and byte allowed by the alignment of the addresses and sizes.
+  - Requests smaller than the CPU threshold are executed at once by the CPU, which is faster than programming a
+    channel for a few bytes: their callback is called before the submission function returns.
+  - The request callback is called from the DMA interrupt when its last part completes: the requests executed on
+    different channels may complete out of submission order.
+  - STM32_UTILS_DMA_MEMOPS_GetCount() returns the number of requests waiting for a channel and
+    STM32_UTILS_DMA_MEMOPS_GetCompletedCount() the number of requests completed by DMA and by the CPU, to tune the
+    CPU threshold.
+
+  The data cache, if enabled on the memories, must be maintained by the application.
+
+  */
+/**
+  * @}
+  */
+
+/* Private function prototypes -----------------------------------------------*/
+/** @defgroup DMA_MEMOPS_Private_Functions DMA_MEMOPS Private Functions
+  * @{
+  */
+static stm32_utils_dma_memops_status_t DMA_MEMOPS_Submit(stm32_utils_dma_memops_t *p_ops,
+                                                         stm32_utils_dma_memops_req_t *p_req);
+static void DMA_MEMOPS_ExecuteCPU(const stm32_utils_dma_memops_req_t *p_req);
+static void DMA_MEMOPS_Dispatch(stm32_utils_dma_memops_t *p_ops);
+static hal_status_t DMA_MEMOPS_Start(stm32_utils_dma_memops_chan_t *p_chan, stm32_utils_dma_memops_req_t *p_req,
+                                     uint32_t first, uint32_t count);
+static void DMA_MEMOPS_PartEnd(hal_dma_handle_t *hdma, uint32_t failed);
+static void DMA_MEMOPS_Complete(stm32_utils_dma_memops_t *p_ops, stm32_utils_dma_memops_req_t *p_req);
+static void DMA_MEMOPS_XferCpltCallback(hal_dma_handle_t *hdma);
+static void DMA_MEMOPS_XferErrorCallback(hal_dma_handle_t *hdma);
+/**
+  * @}
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @defgroup DMA_MEMOPS_Exported_Functions DMA_MEMOPS Exported Functions
+  * @{
+  */
+
+/**
+  * @brief  Initialize the DMA memory operations service.
+  * @param  p_ops              Pointer to the service, allocated by the application.
+  * @param  p_node_config      Node template: priority, ports, bursts and security attributes. The direction,
+  *                            request, increments, data widths, addresses and sizes are set by the service.
+  * @param  cpu_threshold_byte Requests of fewer bytes are executed by the CPU, 0 to use the DMA for all requests.
+  * @retval STM32_UTILS_DMA_MEMOPS_OK            The service is ready.
+  * @retval STM32_UTILS_DMA_MEMOPS_INVALID_PARAM A pointer is NULL.
+  */
+stm32_utils_dma_memops_status_t STM32_UTILS_DMA_MEMOPS_Init(stm32_utils_dma_memops_t *p_ops,
+                                                            const hal_dma_node_config_t *p_node_config,
+                                                            uint32_t cpu_threshold_byte)
+{
+  if ((p_ops == NULL) || (p_node_config == NULL))
+  {
+    return STM32_UTILS_DMA_MEMOPS_INVALID_PARAM;
+  }
+
+  p_ops->node_config                 = *p_node_config;
+  p_ops->node_config.xfer.request    = HAL_DMA_REQUEST_SW;
+  p_ops->node_config.xfer.direction  = HAL_DMA_DIRECTION_MEMORY_TO_MEMORY;
+  p_ops->node_config.xfer.dest_inc   = HAL_DMA_DEST_ADDR_INCREMENTED;
+  p_ops->node_config.xfer_event_mode = HAL_DMA_LINKEDLIST_XFER_EVENT_Q;
+
+  p_ops->p_chan             = NULL;
+  p_ops->cpu_threshold_byte = cpu_threshold_byte;
+  p_ops->p_head             = NULL;
+  p_ops->p_tail             = NULL;
+  p_ops->dma_count          = 0U;
+  p_ops->cpu_count          = 0U;
+
+  return STM32_UTILS_DMA_MEMOPS_OK;
+}
+
+/**
+  * @brief  Give a DMA channel to the service.
+  * @param  p_ops    Pointer to the service.
+  * @param  p_chan   Pointer to the channel context, allocated by the application.
+  * @param  hdma     Pointer to the DMA handle, initialized with HAL_DMA_Init() and its interrupt enabled.
+  * @param  p_nodes  Nodes of the channel, allocated by the application in a memory reachable by the DMA.
+  * @param  node_nbr Number of nodes, the largest part of a request executed by the channel being
+  *                  node_nbr * STM32_UTILS_DMA_MEMOPS_BLOCK_MAX_BYTE bytes, or node_nbr rows in 2D.
+  * @note   The channel must not be used outside of the service afterwards.
+  * @retval STM32_UTILS_DMA_MEMOPS_OK            The channel executes the queued requests.
+  * @retval STM32_UTILS_DMA_MEMOPS_INVALID_PARAM A pointer is NULL or there is no node.
+  * @retval STM32_UTILS_DMA_MEMOPS_ERROR         The channel could not be configured.
+  */
+stm32_utils_dma_memops_status_t STM32_UTILS_DMA_MEMOPS_AddChannel(stm32_utils_dma_memops_t *p_ops,
+                                                                  stm32_utils_dma_memops_chan_t *p_chan,
+                                                                  hal_dma_handle_t *hdma, hal_dma_node_t *p_nodes,
+                                                                  uint32_t node_nbr)
+{
+  hal_dma_linkedlist_xfer_config_t ll_config;
+  uint32_t primask_bit;
+
+  if ((p_ops == NULL) || (p_chan == NULL) || (hdma == NULL) || (p_nodes == NULL) || (node_nbr == 0U))
+  {
+    return STM32_UTILS_DMA_MEMOPS_INVALID_PARAM;
+  }
+
+  ll_config.priority        = p_ops->node_config.xfer.priority;
+  ll_config.fetch_port      = p_ops->node_config.src_port;
+  ll_config.xfer_event_mode = HAL_DMA_LINKEDLIST_XFER_EVENT_Q;
+
+  if ((HAL_DMA_SetConfigLinkedListXfer(hdma, &ll_config) != HAL_OK)
+      || (HAL_DMA_RegisterXferCpltCallback(hdma, DMA_MEMOPS_XferCpltCallback) != HAL_OK)
+      || (HAL_DMA_RegisterXferErrorCallback(hdma, DMA_MEMOPS_XferErrorCallback) != HAL_OK))
+  {
+    return STM32_UTILS_DMA_MEMOPS_ERROR;
+  }
+
+  hdma->p_parent    = p_chan;
+  p_chan->hdma      = hdma;
+  p_chan->p_nodes   = p_nodes;
+  p_chan->node_nbr  = node_nbr;
+  p_chan->p_req     = NULL;
+  p_chan->p_ops     = p_ops;
+  (void)HAL_Q_Init(&p_chan->q, &HAL_DMA_LinearAddressing_DescOps);
+
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  p_chan->p_next = p_ops->p_chan;
+  p_ops->p_chan  = p_chan;
+  __set_PRIMASK(primask_bit);
+
+  /* Requests may be waiting for a channel */
+  DMA_MEMOPS_Dispatch(p_ops);
+
+  return STM32_UTILS_DMA_MEMOPS_OK;
+}
+
+/**
+  * @brief  Queue the copy of a memory area.
+  * @param  p_ops     Pointer to the service.
+  * @param  p_req     Pointer to the request.
+  * @param  p_dst     Destination, must not overlap the source.
+  * @param  p_src     Source.
+  * @param  size_byte Number of bytes to copy.
+  * @param  p_cb      Completion callback, can be NULL.
+  * @retval STM32_UTILS_DMA_MEMOPS_OK            The request is queued, or already executed by the CPU.
+  * @retval STM32_UTILS_DMA_MEMOPS_INVALID_PARAM A pointer is NULL or the size is 0.
+  * @retval STM32_UTILS_DMA_MEMOPS_BUSY          The request is already queued.
+  */
+stm32_utils_dma_memops_status_t STM32_UTILS_DMA_MEMOPS_Memcpy(stm32_utils_dma_memops_t *p_ops,
+                                                              stm32_utils_dma_memops_req_t *p_req, void *p_dst,
+                                                              const void *p_src, uint32_t size_byte,
+                                                              stm32_utils_dma_memops_cb_t p_cb)
+{
+  if ((p_req == NULL) || (p_src == NULL))
+  {
+    return STM32_UTILS_DMA_MEMOPS_INVALID_PARAM;
+  }
+
+  if (p_req->status == STM32_UTILS_DMA_MEMOPS_BUSY)
+  {
+    return STM32_UTILS_DMA_MEMOPS_BUSY;
+  }
+
+  p_req->type      = STM32_UTILS_DMA_MEMOPS_COPY;
+  p_req->p_dst     = p_dst;
+  p_req->p_src     = p_src;
+  p_req->size_byte = size_byte;
+  p_req->row_nbr   = 1U;
+  p_req->p_cb      = p_cb;
+  p_req->total     = size_byte;
+
+  return DMA_MEMOPS_Submit(p_ops, p_req);
+}
+
+/**
+  * @brief  Queue the fill of a memory area with a byte value.
+  * @param  p_ops     Pointer to the service.
+  * @param  p_req     Pointer to the request, which holds the value read by the DMA.
+  * @param  p_dst     Destination.
+  * @param  value     Fill value.
+  * @param  size_byte Number of bytes to fill.
+  * @param  p_cb      Completion callback, can be NULL.
+  * @retval STM32_UTILS_DMA_MEMOPS_OK            The request is queued, or already executed by the CPU.
+  * @retval STM32_UTILS_DMA_MEMOPS_INVALID_PARAM A pointer is NULL or the size is 0.
+  * @retval STM32_UTILS_DMA_MEMOPS_BUSY          The request is already queued.
+  */
+stm32_utils_dma_memops_status_t STM32_UTILS_DMA_MEMOPS_Memset(stm32_utils_dma_memops_t *p_ops,
+                                                              stm32_utils_dma_memops_req_t *p_req, void *p_dst,
+                                                              uint8_t value, uint32_t size_byte,
+                                                              stm32_utils_dma_memops_cb_t p_cb)
+{
+  if (p_req == NULL)
+  {
+    return STM32_UTILS_DMA_MEMOPS_INVALID_PARAM;
+  }
+
+  if (p_req->status == STM32_UTILS_DMA_MEMOPS_BUSY)
+  {
+    return STM32_UTILS_DMA_MEMOPS_BUSY;
+  }
+
+  p_req->type      = STM32_UTILS_DMA_MEMOPS_SET;
+  p_req->p_dst     = p_dst;
+  p_req->p_src     = NULL;
+  p_req->size_byte = size_byte;
+  p_req->row_nbr   = 1U;
+  p_req->pattern   = (uint32_t)value * 0x01010101U;
+  p_req->p_cb      = p_cb;
+  p_req->total     = size_byte;
+
+  return DMA_MEMOPS_Submit(p_ops, p_req);
+}
+
+/**
+  * @brief  Queue the copy of a rectangular area, row by row.
+  * @param  p_ops           Pointer to the service.
+  * @param  p_req           Pointer to the request.
+  * @param  p_dst           Destination of the first row, must not overlap the source.
+  * @param  dst_stride_byte Distance between the starts of two destination rows.
+  * @param  p_src           Source of the first row.
+  * @param  src_stride_byte Distance between the starts of two source rows.
+  * @param  row_byte        Bytes of a row, at most 65535.
+  * @param  row_nbr         Number of rows.
+  * @param  p_cb            Completion callback, can be NULL.
+  * @retval STM32_UTILS_DMA_MEMOPS_OK            The request is queued, or already executed by the CPU.
+  * @retval STM32_UTILS_DMA_MEMOPS_INVALID_PARAM A pointer is NULL, a size is 0 or a row is too large.
+  * @retval STM32_UTILS_DMA_MEMOPS_BUSY          The request is already queued.
+  */
+stm32_utils_dma_memops_status_t STM32_UTILS_DMA_MEMOPS_Memcpy2D(stm32_utils_dma_memops_t *p_ops,
+                                                                stm32_utils_dma_memops_req_t *p_req, void *p_dst,
+                                                                uint32_t dst_stride_byte, const void *p_src,
+                                                                uint32_t src_stride_byte, uint32_t row_byte,
+                                                                uint32_t row_nbr, stm32_utils_dma_memops_cb_t p_cb)
+{
+  if ((p_req == NULL) || (p_src == NULL) || (row_nbr == 0U) || (row_byte > 0xFFFFU))
+  {
+    return STM32_UTILS_DMA_MEMOPS_INVALID_PARAM;
+  }
+
+  if (p_req->status == STM32_UTILS_DMA_MEMOPS_BUSY)
+  {
+    return STM32_UTILS_DMA_MEMOPS_BUSY;
+  }
+
+  p_req->type            = STM32_UTILS_DMA_MEMOPS_COPY_2D;
+  p_req->p_dst           = p_dst;
+  p_req->p_src           = p_src;
+  p_req->size_byte       = row_byte;
+  p_req->row_nbr         = row_nbr;
+  p_req->src_stride_byte = src_stride_byte;
+  p_req->dst_stride_byte = dst_stride_byte;
+  p_req->p_cb            = p_cb;
+  p_req->total           = row_nbr;
+
+  return DMA_MEMOPS_Submit(p_ops, p_req);
+}
+
+/**
+  * @brief  Return the number of requests waiting for a channel.
+  * @param  p_ops Pointer to the service.
+  * @retval uint32_t Number of requests, a request being counted until its last part is given to a channel.
+  */
+uint32_t STM32_UTILS_DMA_MEMOPS_GetCount(const stm32_utils_dma_memops_t *p_ops)
+{
+  const stm32_utils_dma_memops_req_t *p_req;
+  uint32_t count = 0U;
+  uint32_t primask_bit;
+
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  for (p_req = p_ops->p_head; p_req != NULL; p_req = p_req->p_next)
+  {
+    count++;
+  }
+  __set_PRIMASK(primask_bit);
+
+  return count;
+}
+
+/**
+  * @brief  Return the number of requests completed by DMA and by the CPU since STM32_UTILS_DMA_MEMOPS_Init().
+  * @param  p_ops       Pointer to the service.
+  * @param  p_dma_count Pointer to the number of requests completed by DMA, with or without error.
+  * @param  p_cpu_count Pointer to the number of requests executed by the CPU, below the CPU threshold.
+  * @retval STM32_UTILS_DMA_MEMOPS_OK            The counts are returned.
+  * @retval STM32_UTILS_DMA_MEMOPS_INVALID_PARAM A pointer is NULL.
+  */
+stm32_utils_dma_memops_status_t STM32_UTILS_DMA_MEMOPS_GetCompletedCount(const stm32_utils_dma_memops_t *p_ops,
+                                                                         uint32_t *p_dma_count,
+                                                                         uint32_t *p_cpu_count)
+{
+  uint32_t primask_bit;
+
+  if ((p_ops == NULL) || (p_dma_count == NULL) || (p_cpu_count == NULL))
+  {
+    return STM32_UTILS_DMA_MEMOPS_INVALID_PARAM;
+  }
+
+  /* Both counts at the same time */
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  *p_dma_count = p_ops->dma_count;
+  *p_cpu_count = p_ops->cpu_count;
+  __set_PRIMASK(primask_bit);
+
+  return STM32_UTILS_DMA_MEMOPS_OK;
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup DMA_MEMOPS_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Execute a small request by the CPU, or queue it.
+  * @param  p_ops Pointer to the service.
+  * @param  p_req Pointer to the filled request.
+  * @retval STM32_UTILS_DMA_MEMOPS_OK            The request is queued or executed.
+  * @retval STM32_UTILS_DMA_MEMOPS_INVALID_PARAM A pointer is NULL or the size is 0.
+  */
+static stm32_utils_dma_memops_status_t DMA_MEMOPS_Submit(stm32_utils_dma_memops_t *p_ops,
+                                                         stm32_utils_dma_memops_req_t *p_req)
+{
+  uint32_t primask_bit;
+
+  if ((p_ops == NULL) || (p_req->p_dst == NULL) || (p_req->size_byte == 0U))
+  {
+    return STM32_UTILS_DMA_MEMOPS_INVALID_PARAM;
+  }
+
+  /* 64-bit product: a 2D request of up to 65535 bytes per row and 2^32 - 1 rows must not wrap below the threshold */
+  if (((uint64_t)p_req->size_byte * p_req->row_nbr) < p_ops->cpu_threshold_byte)
+  {
+    DMA_MEMOPS_ExecuteCPU(p_req);
+    primask_bit = __get_PRIMASK();
+    __set_PRIMASK(1);
+    p_ops->cpu_count++;
+    __set_PRIMASK(primask_bit);
+    p_req->status = STM32_UTILS_DMA_MEMOPS_OK;
+    if (p_req->p_cb != NULL)
+    {
+      p_req->p_cb(p_req);
+    }
+    return STM32_UTILS_DMA_MEMOPS_OK;
+  }
+
+  p_req->done     = 0U;
+  p_req->part_nbr = 0U;
+  p_req->failed   = 0U;
+  p_req->p_next   = NULL;
+  p_req->status   = STM32_UTILS_DMA_MEMOPS_BUSY;
+
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  if (p_ops->p_tail == NULL)
+  {
+    p_ops->p_head = p_req;
+  }
+  else
+  {
+    p_ops->p_tail->p_next = p_req;
+  }
+  p_ops->p_tail = p_req;
+  __set_PRIMASK(primask_bit);
+
+  DMA_MEMOPS_Dispatch(p_ops);
+
+  return STM32_UTILS_DMA_MEMOPS_OK;
+}
+
+/**
+  * @brief  Execute a request by the CPU.
+  * @param  p_req Pointer to the request.
+  */
+static void DMA_MEMOPS_ExecuteCPU(const stm32_utils_dma_memops_req_t *p_req)
+{
+  uint8_t *p_dst = (uint8_t *)p_req->p_dst;
+  const uint8_t *p_src = (const uint8_t *)p_req->p_src;
+
+  if (p_req->type == STM32_UTILS_DMA_MEMOPS_SET)
+  {
+    (void)memset(p_dst, (int32_t)(p_req->pattern & 0xFFU), p_req->size_byte);
+  }
+  else
+  {
+    for (uint32_t row = 0U; row < p_req->row_nbr; row++)
+    {
+      (void)memcpy(p_dst, p_src, p_req->size_byte);
+      p_dst += p_req->dst_stride_byte;
+      p_src += p_req->src_stride_byte;
+    }
+  }
+}
+
+/**
+  * @brief  Give the parts of the queued requests to the free channels.
+  * @param  p_ops Pointer to the service.
+  */
+static void DMA_MEMOPS_Dispatch(stm32_utils_dma_memops_t *p_ops)
+{
+  stm32_utils_dma_memops_chan_t *p_chan;
+  stm32_utils_dma_memops_req_t *p_req;
+  uint32_t first;
+  uint32_t count;
+  uint32_t complete;
+  uint32_t primask_bit;
+
+  for (;;)
+  {
+    primask_bit = __get_PRIMASK();
+    __set_PRIMASK(1);
+
+    p_chan = p_ops->p_chan;
+    while ((p_chan != NULL) && (p_chan->p_req != NULL))
+    {
+      p_chan = p_chan->p_next;
+    }
+    p_req = p_ops->p_head;
+    if ((p_chan == NULL) || (p_req == NULL))
+    {
+      __set_PRIMASK(primask_bit);
+      break;
+    }
+
+    p_ops->p_head = p_req->p_next;
+    if (p_ops->p_head == NULL)
+    {
+      p_ops->p_tail = NULL;
+    }
+    p_req->p_next = NULL;
+
+    if (p_req->failed != 0U)
+    {
+      /* A part failed: drop the parts not started yet */
+      p_req->done = p_req->total;
+      complete = (p_req->part_nbr == 0U) ? 1U : 0U;
+      __set_PRIMASK(primask_bit);
+      if (complete != 0U)
+      {
+        DMA_MEMOPS_Complete(p_ops, p_req);
+      }
+      continue;
+    }
+
+    first = p_req->done;
+    count = p_req->total - first;
+    if (p_req->type == STM32_UTILS_DMA_MEMOPS_COPY_2D)
+    {
+      count = (count > p_chan->node_nbr) ? p_chan->node_nbr : count;
+    }
+    else
+    {
+      count = (count > (p_chan->node_nbr * STM32_UTILS_DMA_MEMOPS_BLOCK_MAX_BYTE))
+              ? (p_chan->node_nbr * STM32_UTILS_DMA_MEMOPS_BLOCK_MAX_BYTE) : count;
+    }
+    p_req->done += count;
+    p_req->part_nbr++;
+    p_chan->p_req = p_req;
+
+    /* Parts left: back to the end of the queue, behind the requests submitted meanwhile */
+    if (p_req->done < p_req->total)
+    {
+      if (p_ops->p_tail == NULL)
+      {
+        p_ops->p_head = p_req;
+      }
+      else
+      {
+        p_ops->p_tail->p_next = p_req;
+      }
+      p_ops->p_tail = p_req;
+    }
+
+    __set_PRIMASK(primask_bit);
+
+    if (DMA_MEMOPS_Start(p_chan, p_req, first, count) != HAL_OK)
+    {
+      primask_bit = __get_PRIMASK();
+      __set_PRIMASK(1);
+      p_chan->p_req = NULL;
+      p_req->failed = 1U;
+      p_req->part_nbr--;
+      complete = ((p_req->part_nbr == 0U) && (p_req->done == p_req->total)) ? 1U : 0U;
+      __set_PRIMASK(primask_bit);
+      if (complete != 0U)
+      {
+        DMA_MEMOPS_Complete(p_ops, p_req);
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Build the linked-list of a part of a request and start the channel.
+  * @param  p_chan Pointer to the free channel.
+  * @param  p_req  Pointer to the request.
+  * @param  first  First byte, or row in 2D, of the part.
+  * @param  count  Number of bytes, or rows in 2D, of the part.
+  * @retval HAL_OK The channel is started, otherwise the status of the DMA HAL.
+  */
+static hal_status_t DMA_MEMOPS_Start(stm32_utils_dma_memops_chan_t *p_chan, stm32_utils_dma_memops_req_t *p_req,
+                                     uint32_t first, uint32_t count)
+{
+  hal_dma_node_config_t node_config = p_chan->p_ops->node_config;
+  uint32_t src_addr;
+  uint32_t dest_addr;
+  uint32_t align;
+  uint32_t node_idx = 0U;
+
+  HAL_Q_DeInit(&p_chan->q);
+  (void)HAL_Q_Init(&p_chan->q, &HAL_DMA_LinearAddressing_DescOps);
+
+  dest_addr = (uint32_t)p_req->p_dst;
+  if (p_req->type == STM32_UTILS_DMA_MEMOPS_SET)
+  {
+    src_addr = (uint32_t)&p_req->pattern;
+    node_config.xfer.src_inc = HAL_DMA_SRC_ADDR_FIXED;
+    align = dest_addr + first;
+  }
+  else
+  {
+    src_addr = (uint32_t)p_req->p_src;
+    node_config.xfer.src_inc = HAL_DMA_SRC_ADDR_INCREMENTED;
+    align = src_addr | dest_addr;
+  }
+
+  if (p_req->type == STM32_UTILS_DMA_MEMOPS_COPY_2D)
+  {
+    align |= p_req->size_byte | p_req->src_stride_byte | p_req->dst_stride_byte;
+  }
+  else
+  {
+    align |= first | count;
+  }
+
+  if ((align & 3U) == 0U)
+  {
+    node_config.xfer.src_data_width  = HAL_DMA_SRC_DATA_WIDTH_WORD;
+    node_config.xfer.dest_data_width = HAL_DMA_DEST_DATA_WIDTH_WORD;
+  }
+  else if ((align & 1U) == 0U)
+  {
+    node_config.xfer.src_data_width  = HAL_DMA_SRC_DATA_WIDTH_HALFWORD;
+    node_config.xfer.dest_data_width = HAL_DMA_DEST_DATA_WIDTH_HALFWORD;
+  }
+  else
+  {
+    node_config.xfer.src_data_width  = HAL_DMA_SRC_DATA_WIDTH_BYTE;
+    node_config.xfer.dest_data_width = HAL_DMA_DEST_DATA_WIDTH_BYTE;
+  }
+
+  if (p_req->type == STM32_UTILS_DMA_MEMOPS_COPY_2D)
+  {
+    /* One node per row */
+    node_config.size_byte = p_req->size_byte;
+    for (uint32_t row = first; row < (first + count); row++)
+    {
+      node_config.src_addr  = src_addr + (row * p_req->src_stride_byte);
+      node_config.dest_addr = dest_addr + (row * p_req->dst_stride_byte);
+      if ((HAL_DMA_FillNodeConfig(&p_chan->p_nodes[node_idx], &node_config, HAL_DMA_NODE_LINEAR_ADDRESSING) != HAL_OK)
+          || (HAL_Q_InsertNode_Tail(&p_chan->q, &p_chan->p_nodes[node_idx]) != HAL_OK))
+      {
+        return HAL_ERROR;
+      }
+      node_idx++;
+    }
+  }
+  else
+  {
+    /* One node per block */
+    node_config.src_addr  = (p_req->type == STM32_UTILS_DMA_MEMOPS_SET) ? src_addr : (src_addr + first);
+    node_config.dest_addr = dest_addr + first;
+    while (count != 0U)
+    {
+      node_config.size_byte = (count > STM32_UTILS_DMA_MEMOPS_BLOCK_MAX_BYTE) ? STM32_UTILS_DMA_MEMOPS_BLOCK_MAX_BYTE
+                              : count;
+      if ((HAL_DMA_FillNodeConfig(&p_chan->p_nodes[node_idx], &node_config, HAL_DMA_NODE_LINEAR_ADDRESSING) != HAL_OK)
+          || (HAL_Q_InsertNode_Tail(&p_chan->q, &p_chan->p_nodes[node_idx]) != HAL_OK))
+      {
+        return HAL_ERROR;
+      }
+      if (p_req->type != STM32_UTILS_DMA_MEMOPS_SET)
+      {
+        node_config.src_addr += node_config.size_byte;
+      }
+      node_config.dest_addr += node_config.size_byte;
+      count -= node_config.size_byte;
+      node_idx++;
+    }
+  }
+
+  return HAL_DMA_StartLinkedListXfer_IT_Opt(p_chan->hdma, &p_chan->q, HAL_DMA_OPT_IT_NONE);
+}
+
+/**
+  * @brief  End the part in progress on a channel, complete its request when it was the last part, and give the
+  *         channel to the next part waiting.
+  * @param  hdma   Pointer to the DMA handle of the channel.
+  * @param  failed 1 when the part completed with error.
+  */
+static void DMA_MEMOPS_PartEnd(hal_dma_handle_t *hdma, uint32_t failed)
+{
+  stm32_utils_dma_memops_chan_t *p_chan = (stm32_utils_dma_memops_chan_t *)hdma->p_parent;
+  stm32_utils_dma_memops_req_t *p_req = p_chan->p_req;
+  uint32_t complete = 0U;
+  uint32_t primask_bit;
+
+  if (p_req == NULL)
+  {
+    return;
+  }
+
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  p_chan->p_req = NULL;
+  p_req->failed |= failed;
+  p_req->part_nbr--;
+  if ((p_req->part_nbr == 0U) && (p_req->done == p_req->total))
+  {
+    complete = 1U;
+  }
+  __set_PRIMASK(primask_bit);
+
+  if (complete != 0U)
+  {
+    DMA_MEMOPS_Complete(p_chan->p_ops, p_req);
+  }
+
+  DMA_MEMOPS_Dispatch(p_chan->p_ops);
+}
+
+/**
+  * @brief  Complete a request executed by DMA.
+  * @param  p_ops Pointer to the service.
+  * @param  p_req Pointer to the request, all its parts ended.
+  */
+static void DMA_MEMOPS_Complete(stm32_utils_dma_memops_t *p_ops, stm32_utils_dma_memops_req_t *p_req)
+{
+  uint32_t primask_bit;
+
+  /* The channel interrupts of the service may have different priorities and preempt each other */
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  p_ops->dma_count++;
+  __set_PRIMASK(primask_bit);
+
+  p_req->status = (p_req->failed != 0U) ? STM32_UTILS_DMA_MEMOPS_ERROR : STM32_UTILS_DMA_MEMOPS_OK;
+
+  if (p_req->p_cb != NULL)
+  {
+    p_req->p_cb(p_req);
+  }
+}
+
+/**
+  * @brief  DMA transfer complete callback of the channels of the service.
+  * @param  hdma Pointer to the DMA handle.
+  */
+static void DMA_MEMOPS_XferCpltCallback(hal_dma_handle_t *hdma)
+{
+  DMA_MEMOPS_PartEnd(hdma, 0U);
+}
+
+/**
+  * @brief  DMA transfer error callback of the channels of the service.
+  * @param  hdma Pointer to the DMA handle.
+  */
+static void DMA_MEMOPS_XferErrorCallback(hal_dma_handle_t *hdma)
+{
+  DMA_MEMOPS_PartEnd(hdma, 1U);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* USE_HAL_DMA_LINKEDLIST */
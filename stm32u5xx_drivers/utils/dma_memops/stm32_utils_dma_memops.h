@@ -0,0 +1,197 @@
+/**
+  **********************************************************************************************************************
+  * @file    stm32_utils_dma_memops.h
+  * @brief   Header file of UTILS DMA memory operations module.
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -----------------------------------------------------------------------------*/
+#ifndef STM32_UTILS_DMA_MEMOPS_H
+#define STM32_UTILS_DMA_MEMOPS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32_hal.h"
+#include <stdint.h>
+
+#if defined (USE_HAL_DMA_LINKEDLIST) && (USE_HAL_DMA_LINKEDLIST == 1)
+
+/** @addtogroup STM32_UTILS
+  * @{
+  */
+
+/** @addtogroup DMA_MEMOPS
+  * @{
+  */
+
+/* Exported constants --------------------------------------------------------*/
+/** @defgroup DMA_MEMOPS_Exported_Constants DMA_MEMOPS Exported Constants
+  * @{
+  */
+
+/** @brief Largest block of a linked-list node, the largest multiple of 4 fitting in the 16-bit block size */
+#define STM32_UTILS_DMA_MEMOPS_BLOCK_MAX_BYTE  0xFFFCU
+
+/**
+  * @}
+  */
+
+/* Exported types ------------------------------------------------------------*/
+/** @defgroup DMA_MEMOPS_Exported_Types DMA_MEMOPS Exported Types
+  * @{
+  */
+
+/**
+  * @brief  DMA_MEMOPS Utils Status structures definition
+  */
+typedef enum
+{
+  STM32_UTILS_DMA_MEMOPS_OK            = 0x00000000U, /*!< Utils DMA_MEMOPS operation completed successfully */
+  STM32_UTILS_DMA_MEMOPS_ERROR         = 0xFFFFFFFFU, /*!< Utils DMA_MEMOPS operation completed with error   */
+  STM32_UTILS_DMA_MEMOPS_INVALID_PARAM = 0xAAAAAAAAU, /*!< Utils DMA_MEMOPS invalid parameter                */
+  STM32_UTILS_DMA_MEMOPS_BUSY          = 0x55555555U, /*!< Utils DMA_MEMOPS request pending or ongoing       */
+} stm32_utils_dma_memops_status_t;
+
+/**
+  * @brief  DMA_MEMOPS request type
+  */
+typedef enum
+{
+  STM32_UTILS_DMA_MEMOPS_COPY    = 0x00000000U, /*!< Copy size_byte bytes                                  */
+  STM32_UTILS_DMA_MEMOPS_SET     = 0x00000001U, /*!< Fill size_byte bytes with a value                     */
+  STM32_UTILS_DMA_MEMOPS_COPY_2D = 0x00000002U, /*!< Copy row_nbr rows of size_byte bytes with line strides */
+} stm32_utils_dma_memops_type_t;
+
+typedef struct stm32_utils_dma_memops_req_s stm32_utils_dma_memops_req_t;
+
+/**
+  * @brief  DMA_MEMOPS request completion callback, called in the DMA interrupt context, or in the caller context
+  *         for the requests executed by the CPU.
+  */
+typedef void (*stm32_utils_dma_memops_cb_t)(stm32_utils_dma_memops_req_t *p_req);
+
+/**
+  * @brief  DMA_MEMOPS request, allocated by the application and filled by the submission functions.
+  *
+  * The request belongs to the service until its callback is called. It must be zero-initialized before its
+  * first submission.
+  */
+struct stm32_utils_dma_memops_req_s
+{
+  stm32_utils_dma_memops_type_t type;            /*!< Request type                                         */
+  void                          *p_dst;          /*!< Destination                                          */
+  const void                    *p_src;          /*!< Source, copy requests                                */
+  uint32_t                      size_byte;       /*!< Bytes of the copy or fill, bytes of a row in 2D      */
+  uint32_t                      row_nbr;         /*!< Number of rows, 2D copy                              */
+  uint32_t                      src_stride_byte; /*!< Distance between two source rows, 2D copy            */
+  uint32_t                      dst_stride_byte; /*!< Distance between two destination rows, 2D copy       */
+  uint32_t                      pattern;         /*!< Fill value repeated in the 4 bytes, fill requests    */
+  stm32_utils_dma_memops_cb_t   p_cb;            /*!< Completion callback, can be NULL                     */
+  void                          *p_user_data;    /*!< Application context, not used by the service         */
+  volatile stm32_utils_dma_memops_status_t status; /*!< BUSY until completion, then the result             */
+  uint32_t                      total;           /*!< Private: bytes, or rows in 2D, to transfer           */
+  uint32_t                      done;            /*!< Private: bytes, or rows in 2D, given to a channel    */
+  uint32_t                      part_nbr;        /*!< Private: parts in progress on channels               */
+  uint32_t                      failed;          /*!< Private: a part completed with error                 */
+  stm32_utils_dma_memops_req_t  *p_next;         /*!< Private: next request waiting for a channel          */
+};
+
+typedef struct stm32_utils_dma_memops_s stm32_utils_dma_memops_t;
+
+/**
+  * @brief  DMA_MEMOPS channel, allocated by the application.
+  *
+  * The fields are private to the service.
+  */
+typedef struct stm32_utils_dma_memops_chan_s
+{
+  hal_dma_handle_t                     *hdma;     /*!< DMA channel, initialized with HAL_DMA_Init()          */
+  hal_dma_node_t                       *p_nodes;  /*!< Nodes of the channel, one per block of a part          */
+  uint32_t                             node_nbr;  /*!< Number of nodes of the channel                         */
+  hal_q_t                              q;         /*!< Linked-list of the part in progress                    */
+  stm32_utils_dma_memops_req_t         *p_req;    /*!< Request of the part in progress, NULL when free        */
+  stm32_utils_dma_memops_t             *p_ops;    /*!< Service owning the channel                             */
+  struct stm32_utils_dma_memops_chan_s *p_next;   /*!< Next channel of the service                            */
+} stm32_utils_dma_memops_chan_t;
+
+/**
+  * @brief  DMA_MEMOPS service, allocated by the application.
+  *
+  * The fields are private to the service.
+  */
+struct stm32_utils_dma_memops_s
+{
+  stm32_utils_dma_memops_chan_t *p_chan;           /*!< Channels owned by the service                     */
+  hal_dma_node_config_t         node_config;       /*!< Memory to memory node template                    */
+  uint32_t                      cpu_threshold_byte; /*!< Requests smaller than this are done by the CPU    */
+  stm32_utils_dma_memops_req_t  *p_head;           /*!< First request waiting for a channel               */
+  stm32_utils_dma_memops_req_t  *p_tail;           /*!< Last request waiting for a channel                */
+  uint32_t                      dma_count;         /*!< Requests completed by DMA, updated masked         */
+  uint32_t                      cpu_count;         /*!< Requests completed by the CPU, updated masked     */
+};
+
+/**
+  * @}
+  */
+
+/* Exported functions ------------------------------------------------------------------------------------------------*/
+/** @addtogroup DMA_MEMOPS_Exported_Functions
+  * @{
+  */
+stm32_utils_dma_memops_status_t STM32_UTILS_DMA_MEMOPS_Init(stm32_utils_dma_memops_t *p_ops,
+                                                            const hal_dma_node_config_t *p_node_config,
+                                                            uint32_t cpu_threshold_byte);
+stm32_utils_dma_memops_status_t STM32_UTILS_DMA_MEMOPS_AddChannel(stm32_utils_dma_memops_t *p_ops,
+                                                                  stm32_utils_dma_memops_chan_t *p_chan,
+                                                                  hal_dma_handle_t *hdma, hal_dma_node_t *p_nodes,
+                                                                  uint32_t node_nbr);
+stm32_utils_dma_memops_status_t STM32_UTILS_DMA_MEMOPS_Memcpy(stm32_utils_dma_memops_t *p_ops,
+                                                              stm32_utils_dma_memops_req_t *p_req, void *p_dst,
+                                                              const void *p_src, uint32_t size_byte,
+                                                              stm32_utils_dma_memops_cb_t p_cb);
+stm32_utils_dma_memops_status_t STM32_UTILS_DMA_MEMOPS_Memset(stm32_utils_dma_memops_t *p_ops,
+                                                              stm32_utils_dma_memops_req_t *p_req, void *p_dst,
+                                                              uint8_t value, uint32_t size_byte,
+                                                              stm32_utils_dma_memops_cb_t p_cb);
+stm32_utils_dma_memops_status_t STM32_UTILS_DMA_MEMOPS_Memcpy2D(stm32_utils_dma_memops_t *p_ops,
+                                                                stm32_utils_dma_memops_req_t *p_req, void *p_dst,
+                                                                uint32_t dst_stride_byte, const void *p_src,
+                                                                uint32_t src_stride_byte, uint32_t row_byte,
+                                                                uint32_t row_nbr, stm32_utils_dma_memops_cb_t p_cb);
+uint32_t STM32_UTILS_DMA_MEMOPS_GetCount(const stm32_utils_dma_memops_t *p_ops);
+stm32_utils_dma_memops_status_t STM32_UTILS_DMA_MEMOPS_GetCompletedCount(const stm32_utils_dma_memops_t *p_ops,
+                                                                         uint32_t *p_dma_count,
+                                                                         uint32_t *p_cpu_count);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* USE_HAL_DMA_LINKEDLIST */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32_UTILS_DMA_MEMOPS_H */
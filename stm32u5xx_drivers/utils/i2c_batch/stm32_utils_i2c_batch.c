@@ -0,0 +1,545 @@
+/**
+  **********************************************************************************************************************
+  * @file    stm32_utils_i2c_batch.c
+  * @brief   This utility runs lists of I2C register accesses from the I2C interrupts.
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "stm32_utils_i2c_batch.h"
+
+/** @addtogroup STM32_UTILS
+  * @{
+  */
+
+/** @addtogroup I2C_BATCH
+  * @{
+  */
+
+/** @defgroup I2C_BATCH_Introduction I2C_BATCH Introduction
+  * @{
+
+  The I2C command list engine runs a list of register writes, register reads, delays and register polls, typically
+  the initialization or the acquisition sequence of a sensor, without the application:
+
+  - Each register access is started from the completion interrupt of the previous one, with
+    HAL_I2C_MASTER_MemWrite_IT() / HAL_I2C_MASTER_MemRead_IT(), or their DMA variants.
+  - Delays and intervals between two reads of a poll command are counted by STM32_UTILS_I2C_BATCH_IncTick(),
+    to be called from a periodic interrupt, for instance the SysTick handler after HAL_IncTick().
+  - One completion callback is called at the end of each execution of the list.
+  - With a period, the list is executed again every period ticks, counted from the start of the previous
+    execution, until STM32_UTILS_I2C_BATCH_Stop() is called.
+
+  The I2C handle must be initialized in master mode, with its DMA channels set in DMA mode.
+  With USE_HAL_I2C_REGISTER_CALLBACKS set, STM32_UTILS_I2C_BATCH_Init() registers the I2C memory transfer complete and
+  error callbacks. Otherwise HAL_I2C_MASTER_MemTxCpltCallback() and HAL_I2C_MASTER_MemRxCpltCallback() must call
+  STM32_UTILS_I2C_BATCH_XferCpltCallback(), and HAL_I2C_ErrorCallback() must call
+  STM32_UTILS_I2C_BATCH_ErrorCallback().
+
+  The bus must not be used outside of the engine while a list runs.
+
+  */
+/**
+  * @}
+  */
+
+/* Private constants ---------------------------------------------------------*/
+/** @defgroup I2C_BATCH_Private_Constants I2C_BATCH Private Constants
+  * @{
+  */
+#define I2C_BATCH_STATE_IDLE        (0U)  /* No list running                                 */
+#define I2C_BATCH_STATE_XFER        (1U)  /* Register access in progress                     */
+#define I2C_BATCH_STATE_WAIT        (2U)  /* Delay command or interval between two polls     */
+#define I2C_BATCH_STATE_PERIOD      (3U)  /* Waiting for the next execution of the list      */
+
+/**
+  * @}
+  */
+
+/* Private variables ---------------------------------------------------------*/
+/** @defgroup I2C_BATCH_Private_Variables I2C_BATCH Private Variables
+  * @{
+  */
+static stm32_utils_i2c_batch_t *p_i2c_batch_list = NULL; /* Engines initialized, one per I2C handle */
+
+/**
+  * @}
+  */
+
+/* Private function prototypes -----------------------------------------------*/
+/** @defgroup I2C_BATCH_Private_Functions I2C_BATCH Private Functions
+  * @{
+  */
+static stm32_utils_i2c_batch_t *I2C_BATCH_Find(const hal_i2c_handle_t *hi2c);
+static void I2C_BATCH_Run(stm32_utils_i2c_batch_t *p_batch);
+static void I2C_BATCH_End(stm32_utils_i2c_batch_t *p_batch, stm32_utils_i2c_batch_status_t status);
+static hal_status_t I2C_BATCH_Access(stm32_utils_i2c_batch_t *p_batch, const stm32_utils_i2c_batch_cmd_t *p_cmd);
+/**
+  * @}
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @defgroup I2C_BATCH_Exported_Functions I2C_BATCH Exported Functions
+  * @{
+  */
+
+/**
+  * @brief  Initialize the command list engine of an I2C bus.
+  * @param  p_batch Pointer to the engine, allocated by the application.
+  * @param  hi2c    Pointer to the I2C handle, initialized in master mode.
+  * @param  mode    Transfer mode of the register accesses.
+  * @retval STM32_UTILS_I2C_BATCH_OK            The engine is ready.
+  * @retval STM32_UTILS_I2C_BATCH_INVALID_PARAM A pointer is NULL.
+  * @retval STM32_UTILS_I2C_BATCH_ERROR         The I2C callbacks could not be registered.
+  */
+stm32_utils_i2c_batch_status_t STM32_UTILS_I2C_BATCH_Init(stm32_utils_i2c_batch_t *p_batch, hal_i2c_handle_t *hi2c,
+                                                          stm32_utils_i2c_batch_mode_t mode)
+{
+  uint32_t primask_bit;
+
+  if ((p_batch == NULL) || (hi2c == NULL))
+  {
+    return STM32_UTILS_I2C_BATCH_INVALID_PARAM;
+  }
+
+#if defined(USE_HAL_I2C_REGISTER_CALLBACKS) && (USE_HAL_I2C_REGISTER_CALLBACKS == 1)
+  if ((HAL_I2C_MASTER_RegisterMemTxCpltCallback(hi2c, STM32_UTILS_I2C_BATCH_XferCpltCallback) != HAL_OK)
+      || (HAL_I2C_MASTER_RegisterMemRxCpltCallback(hi2c, STM32_UTILS_I2C_BATCH_XferCpltCallback) != HAL_OK)
+      || (HAL_I2C_RegisterErrorCallback(hi2c, STM32_UTILS_I2C_BATCH_ErrorCallback) != HAL_OK))
+  {
+    return STM32_UTILS_I2C_BATCH_ERROR;
+  }
+#endif /* USE_HAL_I2C_REGISTER_CALLBACKS */
+
+  p_batch->hi2c        = hi2c;
+  p_batch->mode        = mode;
+  p_batch->p_cmd       = NULL;
+  p_batch->cmd_nbr     = 0U;
+  p_batch->cmd_idx     = 0U;
+  p_batch->period_tick = 0U;
+  p_batch->period_left = 0U;
+  p_batch->wait_left   = 0U;
+  p_batch->state       = I2C_BATCH_STATE_IDLE;
+  p_batch->stop        = 0U;
+  p_batch->poll_count  = 0U;
+  p_batch->run_count   = 0U;
+  p_batch->error_count = 0U;
+  p_batch->p_cplt_cb   = NULL;
+
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  if (I2C_BATCH_Find(hi2c) == NULL)
+  {
+    p_batch->p_next = p_i2c_batch_list;
+    p_i2c_batch_list = p_batch;
+  }
+  __set_PRIMASK(primask_bit);
+
+  return STM32_UTILS_I2C_BATCH_OK;
+}
+
+/**
+  * @brief  Start the execution of a command list.
+  * @param  p_batch     Pointer to the engine.
+  * @param  p_cmd       Command list, kept by the engine until it is stopped.
+  * @param  cmd_nbr     Number of commands of the list.
+  * @param  period_tick Period of the executions of the list in ticks, 0 to execute it once.
+  * @param  p_cplt_cb   Callback called at the end of each execution of the list, can be NULL.
+  * @retval STM32_UTILS_I2C_BATCH_OK            The list is started.
+  * @retval STM32_UTILS_I2C_BATCH_INVALID_PARAM A pointer is NULL or the list is empty.
+  * @retval STM32_UTILS_I2C_BATCH_BUSY          A list is already running.
+  */
+stm32_utils_i2c_batch_status_t STM32_UTILS_I2C_BATCH_Start(stm32_utils_i2c_batch_t *p_batch,
+                                                           const stm32_utils_i2c_batch_cmd_t *p_cmd, uint32_t cmd_nbr,
+                                                           uint32_t period_tick, stm32_utils_i2c_batch_cb_t p_cplt_cb)
+{
+  uint32_t primask_bit;
+
+  if ((p_batch == NULL) || (p_cmd == NULL) || (cmd_nbr == 0U))
+  {
+    return STM32_UTILS_I2C_BATCH_INVALID_PARAM;
+  }
+
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  if (p_batch->state != I2C_BATCH_STATE_IDLE)
+  {
+    __set_PRIMASK(primask_bit);
+    return STM32_UTILS_I2C_BATCH_BUSY;
+  }
+  p_batch->state = I2C_BATCH_STATE_XFER;
+  __set_PRIMASK(primask_bit);
+
+  p_batch->p_cmd       = p_cmd;
+  p_batch->cmd_nbr     = cmd_nbr;
+  p_batch->cmd_idx     = 0U;
+  p_batch->poll_count  = 0U;
+  p_batch->period_tick = period_tick;
+  p_batch->period_left = period_tick;
+  p_batch->stop        = 0U;
+  p_batch->p_cplt_cb   = p_cplt_cb;
+
+  I2C_BATCH_Run(p_batch);
+
+  return STM32_UTILS_I2C_BATCH_OK;
+}
+
+/**
+  * @brief  Stop the periodic execution of the command list.
+  * @param  p_batch Pointer to the engine.
+  * @note   An execution in progress completes and calls the completion callback.
+  */
+void STM32_UTILS_I2C_BATCH_Stop(stm32_utils_i2c_batch_t *p_batch)
+{
+  uint32_t primask_bit;
+
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  p_batch->stop = 1U;
+  if (p_batch->state == I2C_BATCH_STATE_PERIOD)
+  {
+    p_batch->state = I2C_BATCH_STATE_IDLE;
+  }
+  __set_PRIMASK(primask_bit);
+}
+
+/**
+  * @brief  Return whether a command list is running or waiting for its next execution.
+  * @param  p_batch Pointer to the engine.
+  * @retval uint32_t 1 when a list is running, 0 otherwise.
+  */
+uint32_t STM32_UTILS_I2C_BATCH_IsRunning(const stm32_utils_i2c_batch_t *p_batch)
+{
+  return (p_batch->state != I2C_BATCH_STATE_IDLE) ? 1U : 0U;
+}
+
+/**
+  * @brief  Return the number of executions of the command list completed successfully.
+  * @param  p_batch Pointer to the engine.
+  * @retval uint32_t Number of executions.
+  */
+uint32_t STM32_UTILS_I2C_BATCH_GetRunCount(const stm32_utils_i2c_batch_t *p_batch)
+{
+  return p_batch->run_count;
+}
+
+/**
+  * @brief  Return the number of executions of the command list completed with error or timeout.
+  * @param  p_batch Pointer to the engine.
+  * @retval uint32_t Number of executions.
+  */
+uint32_t STM32_UTILS_I2C_BATCH_GetErrorCount(const stm32_utils_i2c_batch_t *p_batch)
+{
+  return p_batch->error_count;
+}
+
+/**
+  * @brief  Count the delays, poll intervals and periods of all the engines.
+  * @note   To be called from a periodic interrupt of priority not higher than the I2C and DMA ones, the tick
+  *         period being the unit of the delay, poll and period values.
+  */
+void STM32_UTILS_I2C_BATCH_IncTick(void)
+{
+  stm32_utils_i2c_batch_t *p_batch;
+  uint32_t run;
+  uint32_t primask_bit;
+
+  for (p_batch = p_i2c_batch_list; p_batch != NULL; p_batch = p_batch->p_next)
+  {
+    run = 0U;
+
+    primask_bit = __get_PRIMASK();
+    __set_PRIMASK(1);
+    if (p_batch->period_left != 0U)
+    {
+      p_batch->period_left--;
+    }
+    if (p_batch->state == I2C_BATCH_STATE_WAIT)
+    {
+      if (p_batch->wait_left != 0U)
+      {
+        p_batch->wait_left--;
+      }
+      if (p_batch->wait_left == 0U)
+      {
+        p_batch->state = I2C_BATCH_STATE_XFER;
+        run = 1U;
+      }
+    }
+    else if ((p_batch->state == I2C_BATCH_STATE_PERIOD) && (p_batch->period_left == 0U))
+    {
+      p_batch->state       = I2C_BATCH_STATE_XFER;
+      p_batch->cmd_idx     = 0U;
+      p_batch->poll_count  = 0U;
+      p_batch->period_left = p_batch->period_tick;
+      run = 1U;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    __set_PRIMASK(primask_bit);
+
+    if (run != 0U)
+    {
+      I2C_BATCH_Run(p_batch);
+    }
+  }
+}
+
+/**
+  * @brief  Go on with the command list after a register access.
+  * @param  hi2c Pointer to the I2C handle.
+  * @note   Registered as the I2C memory Tx and Rx complete callback with USE_HAL_I2C_REGISTER_CALLBACKS,
+  *         otherwise to be called from HAL_I2C_MASTER_MemTxCpltCallback() and HAL_I2C_MASTER_MemRxCpltCallback().
+  *         Does nothing for an I2C handle without engine or without list running.
+  */
+void STM32_UTILS_I2C_BATCH_XferCpltCallback(hal_i2c_handle_t *hi2c)
+{
+  stm32_utils_i2c_batch_t *p_batch = I2C_BATCH_Find(hi2c);
+  const stm32_utils_i2c_batch_cmd_t *p_cmd;
+
+  if ((p_batch == NULL) || (p_batch->state != I2C_BATCH_STATE_XFER))
+  {
+    return;
+  }
+
+  p_cmd = &p_batch->p_cmd[p_batch->cmd_idx];
+
+  if (p_cmd->type == STM32_UTILS_I2C_BATCH_CMD_POLL)
+  {
+    p_batch->poll_count++;
+    if ((p_batch->poll_value & p_cmd->mask) != p_cmd->match)
+    {
+      if (p_batch->poll_count > (uint32_t)p_cmd->retry)
+      {
+        I2C_BATCH_End(p_batch, STM32_UTILS_I2C_BATCH_TIMEOUT);
+        return;
+      }
+      if (p_cmd->tick != 0U)
+      {
+        /* Read the register again after the poll interval */
+        p_batch->wait_left = p_cmd->tick;
+        p_batch->state     = I2C_BATCH_STATE_WAIT;
+        return;
+      }
+      I2C_BATCH_Run(p_batch);
+      return;
+    }
+  }
+
+  p_batch->cmd_idx++;
+  p_batch->poll_count = 0U;
+  I2C_BATCH_Run(p_batch);
+}
+
+/**
+  * @brief  End the command list execution with error.
+  * @param  hi2c Pointer to the I2C handle.
+  * @note   Registered as the I2C error callback with USE_HAL_I2C_REGISTER_CALLBACKS, otherwise to be called from
+  *         HAL_I2C_ErrorCallback(). Does nothing for an I2C handle without engine or without list running.
+  */
+void STM32_UTILS_I2C_BATCH_ErrorCallback(hal_i2c_handle_t *hi2c)
+{
+  stm32_utils_i2c_batch_t *p_batch = I2C_BATCH_Find(hi2c);
+
+  if ((p_batch != NULL) && (p_batch->state == I2C_BATCH_STATE_XFER))
+  {
+    I2C_BATCH_End(p_batch, STM32_UTILS_I2C_BATCH_ERROR);
+  }
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup I2C_BATCH_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Find the engine of an I2C handle.
+  * @param  hi2c Pointer to the I2C handle.
+  * @retval Pointer to the engine, NULL when the handle has none.
+  */
+static stm32_utils_i2c_batch_t *I2C_BATCH_Find(const hal_i2c_handle_t *hi2c)
+{
+  stm32_utils_i2c_batch_t *p_batch = p_i2c_batch_list;
+
+  while ((p_batch != NULL) && (p_batch->hi2c != hi2c))
+  {
+    p_batch = p_batch->p_next;
+  }
+
+  return p_batch;
+}
+
+/**
+  * @brief  Execute the commands from the current one until a register access or a wait is started.
+  * @param  p_batch Pointer to the engine, in XFER state.
+  */
+static void I2C_BATCH_Run(stm32_utils_i2c_batch_t *p_batch)
+{
+  const stm32_utils_i2c_batch_cmd_t *p_cmd;
+
+  while (p_batch->cmd_idx < p_batch->cmd_nbr)
+  {
+    p_cmd = &p_batch->p_cmd[p_batch->cmd_idx];
+
+    if (p_cmd->type == STM32_UTILS_I2C_BATCH_CMD_DELAY)
+    {
+      if (p_batch->poll_count == 0U)
+      {
+        /* Delay starting, poll_count tells it is over when the wait ends */
+        if (p_cmd->tick != 0U)
+        {
+          p_batch->poll_count = 1U;
+          p_batch->wait_left  = p_cmd->tick;
+          p_batch->state      = I2C_BATCH_STATE_WAIT;
+          return;
+        }
+      }
+      p_batch->cmd_idx++;
+      p_batch->poll_count = 0U;
+    }
+    else
+    {
+      if (I2C_BATCH_Access(p_batch, p_cmd) != HAL_OK)
+      {
+        I2C_BATCH_End(p_batch, STM32_UTILS_I2C_BATCH_ERROR);
+      }
+      return;
+    }
+  }
+
+  I2C_BATCH_End(p_batch, STM32_UTILS_I2C_BATCH_OK);
+}
+
+/**
+  * @brief  End an execution of the command list: completion callback and next execution.
+  * @param  p_batch Pointer to the engine.
+  * @param  status  Result of the execution.
+  */
+static void I2C_BATCH_End(stm32_utils_i2c_batch_t *p_batch, stm32_utils_i2c_batch_status_t status)
+{
+  uint32_t primask_bit;
+  uint32_t again = 0U;
+
+  if (status == STM32_UTILS_I2C_BATCH_OK)
+  {
+    p_batch->run_count++;
+  }
+  else
+  {
+    p_batch->error_count++;
+  }
+
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  if ((p_batch->period_tick == 0U) || (p_batch->stop != 0U))
+  {
+    p_batch->state = I2C_BATCH_STATE_IDLE;
+  }
+  else if (p_batch->period_left != 0U)
+  {
+    p_batch->state = I2C_BATCH_STATE_PERIOD;
+  }
+  else
+  {
+    /* Execution longer than the period: start again at once */
+    p_batch->cmd_idx     = 0U;
+    p_batch->poll_count  = 0U;
+    p_batch->period_left = p_batch->period_tick;
+    again = 1U;
+  }
+  __set_PRIMASK(primask_bit);
+
+  if (p_batch->p_cplt_cb != NULL)
+  {
+    p_batch->p_cplt_cb(p_batch, status);
+  }
+
+  if ((again != 0U) && (p_batch->stop == 0U))
+  {
+    I2C_BATCH_Run(p_batch);
+  }
+  else if (again != 0U)
+  {
+    p_batch->state = I2C_BATCH_STATE_IDLE;
+  }
+  else
+  {
+    /* Idle or waiting for the period */
+  }
+}
+
+/**
+  * @brief  Start the register access of a command.
+  * @param  p_batch Pointer to the engine.
+  * @param  p_cmd   Pointer to the write, read or poll command.
+  * @retval HAL_OK The access is started, otherwise the status of the I2C HAL.
+  */
+static hal_status_t I2C_BATCH_Access(stm32_utils_i2c_batch_t *p_batch, const stm32_utils_i2c_batch_cmd_t *p_cmd)
+{
+  void *p_data = p_cmd->p_data;
+  uint32_t size_byte = p_cmd->size_byte;
+  hal_status_t status;
+
+  if (p_cmd->type == STM32_UTILS_I2C_BATCH_CMD_POLL)
+  {
+    p_data    = &p_batch->poll_value;
+    size_byte = 1U;
+  }
+
+#if defined (USE_HAL_I2C_DMA) && (USE_HAL_I2C_DMA == 1)
+  if (p_batch->mode == STM32_UTILS_I2C_BATCH_MODE_DMA)
+  {
+    if (p_cmd->type == STM32_UTILS_I2C_BATCH_CMD_WRITE_REG)
+    {
+      status = HAL_I2C_MASTER_MemWrite_DMA(p_batch->hi2c, p_cmd->device_addr, p_cmd->reg, p_cmd->reg_size,
+                                           p_data, size_byte);
+    }
+    else
+    {
+      status = HAL_I2C_MASTER_MemRead_DMA(p_batch->hi2c, p_cmd->device_addr, p_cmd->reg, p_cmd->reg_size,
+                                          p_data, size_byte);
+    }
+    return status;
+  }
+#endif /* USE_HAL_I2C_DMA */
+
+  if (p_cmd->type == STM32_UTILS_I2C_BATCH_CMD_WRITE_REG)
+  {
+    status = HAL_I2C_MASTER_MemWrite_IT(p_batch->hi2c, p_cmd->device_addr, p_cmd->reg, p_cmd->reg_size,
+                                        p_data, size_byte);
+  }
+  else
+  {
+    status = HAL_I2C_MASTER_MemRead_IT(p_batch->hi2c, p_cmd->device_addr, p_cmd->reg, p_cmd->reg_size,
+                                       p_data, size_byte);
+  }
+
+  return status;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
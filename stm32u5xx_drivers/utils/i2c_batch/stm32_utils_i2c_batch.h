@@ -0,0 +1,198 @@
+/**
+  **********************************************************************************************************************
+  * @file    stm32_utils_i2c_batch.h
+  * @brief   Header file of UTILS I2C command list module.
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -----------------------------------------------------------------------------*/
+#ifndef STM32_UTILS_I2C_BATCH_H
+#define STM32_UTILS_I2C_BATCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32_hal.h"
+#include <stdint.h>
+
+
+/** @addtogroup STM32_UTILS
+  * @{
+  */
+
+/** @addtogroup I2C_BATCH
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+/** @defgroup I2C_BATCH_Exported_Types I2C_BATCH Exported Types
+  * @{
+  */
+
+/**
+  * @brief  I2C_BATCH Utils Status structures definition
+  */
+typedef enum
+{
+  STM32_UTILS_I2C_BATCH_OK            = 0x00000000U, /*!< Utils I2C_BATCH operation completed successfully      */
+  STM32_UTILS_I2C_BATCH_ERROR         = 0xFFFFFFFFU, /*!< Utils I2C_BATCH operation completed with error        */
+  STM32_UTILS_I2C_BATCH_INVALID_PARAM = 0xAAAAAAAAU, /*!< Utils I2C_BATCH invalid parameter                     */
+  STM32_UTILS_I2C_BATCH_BUSY          = 0x55555555U, /*!< Utils I2C_BATCH command list already running          */
+  STM32_UTILS_I2C_BATCH_TIMEOUT       = 0x33333333U, /*!< Utils I2C_BATCH poll command retries exhausted        */
+} stm32_utils_i2c_batch_status_t;
+
+/**
+  * @brief  I2C_BATCH transfer mode of the register accesses
+  */
+typedef enum
+{
+  STM32_UTILS_I2C_BATCH_MODE_IT  = 0x00000000U, /*!< Register accesses by HAL_I2C_MASTER_MemWrite_IT/MemRead_IT   */
+#if defined (USE_HAL_I2C_DMA) && (USE_HAL_I2C_DMA == 1)
+  STM32_UTILS_I2C_BATCH_MODE_DMA = 0x00000001U, /*!< Register accesses by HAL_I2C_MASTER_MemWrite_DMA/MemRead_DMA */
+#endif /* USE_HAL_I2C_DMA */
+} stm32_utils_i2c_batch_mode_t;
+
+/**
+  * @brief  I2C_BATCH command type
+  */
+typedef enum
+{
+  STM32_UTILS_I2C_BATCH_CMD_WRITE_REG = 0x00000000U, /*!< Write size_byte bytes of p_data to register reg        */
+  STM32_UTILS_I2C_BATCH_CMD_READ_REG  = 0x00000001U, /*!< Read size_byte bytes from register reg into p_data     */
+  STM32_UTILS_I2C_BATCH_CMD_DELAY     = 0x00000002U, /*!< Wait tick periods of STM32_UTILS_I2C_BATCH_IncTick()   */
+  STM32_UTILS_I2C_BATCH_CMD_POLL      = 0x00000003U, /*!< Read register reg until (value & mask) == match, every
+                                                          tick periods, at most retry + 1 times                  */
+} stm32_utils_i2c_batch_cmd_type_t;
+
+/**
+  * @brief  I2C_BATCH command, usually built with the STM32_UTILS_I2C_BATCH_xxx() macros in a const array.
+  */
+typedef struct
+{
+  stm32_utils_i2c_batch_cmd_type_t type;        /*!< Command type                                        */
+  uint16_t                         device_addr; /*!< Device address, as for HAL_I2C_MASTER_MemRead_IT()   */
+  uint16_t                         reg;         /*!< Register address                                    */
+  hal_i2c_mem_addr_size_t          reg_size;    /*!< Register address size                               */
+  void                             *p_data;     /*!< Data written or read                                */
+  uint32_t                         size_byte;   /*!< Number of bytes written or read                     */
+  uint8_t                          mask;        /*!< Poll: bits of the register tested                   */
+  uint8_t                          match;       /*!< Poll: expected value of the bits tested             */
+  uint16_t                         retry;       /*!< Poll: number of reads after the first one           */
+  uint32_t                         tick;        /*!< Delay, or poll: number of ticks between two reads   */
+} stm32_utils_i2c_batch_cmd_t;
+
+typedef struct stm32_utils_i2c_batch_s stm32_utils_i2c_batch_t;
+
+/**
+  * @brief  I2C_BATCH command list completion callback, called in interrupt context once per execution of the list.
+  */
+typedef void (*stm32_utils_i2c_batch_cb_t)(stm32_utils_i2c_batch_t *p_batch, stm32_utils_i2c_batch_status_t status);
+
+/**
+  * @brief  I2C_BATCH engine of one I2C bus, allocated by the application.
+  *
+  * The fields are private to the engine service.
+  */
+struct stm32_utils_i2c_batch_s
+{
+  hal_i2c_handle_t                  *hi2c;         /*!< I2C bus, master                                   */
+  stm32_utils_i2c_batch_mode_t      mode;          /*!< Transfer mode of the register accesses            */
+  const stm32_utils_i2c_batch_cmd_t *p_cmd;        /*!< Command list running                              */
+  uint32_t                          cmd_nbr;       /*!< Number of commands of the list                    */
+  volatile uint32_t                 cmd_idx;       /*!< Command in progress                               */
+  uint32_t                          period_tick;   /*!< Period of the list executions, 0 to run it once   */
+  volatile uint32_t                 period_left;   /*!< Ticks until the next execution of the list        */
+  volatile uint32_t                 wait_left;     /*!< Ticks until the end of a delay or the next poll   */
+  volatile uint32_t                 state;         /*!< Engine state                                      */
+  volatile uint32_t                 stop;          /*!< Stop requested, no further execution of the list  */
+  uint32_t                          poll_count;    /*!< Reads done by the poll command in progress        */
+  uint8_t                           poll_value;    /*!< Register value read by the poll command           */
+  uint32_t                          run_count;     /*!< Executions of the list completed successfully     */
+  uint32_t                          error_count;   /*!< Executions of the list completed with error       */
+  stm32_utils_i2c_batch_cb_t        p_cplt_cb;     /*!< Completion callback                               */
+  void                              *p_user_data;  /*!< Application context, not used by the engine       */
+  struct stm32_utils_i2c_batch_s    *p_next;       /*!< Next engine, to find the engine of an I2C handle  */
+};
+
+/**
+  * @}
+  */
+
+/* Exported macros ---------------------------------------------------------------------------------------------------*/
+/** @defgroup I2C_BATCH_Exported_Macros I2C_BATCH Exported Macros
+  * @{
+  */
+
+/** @brief Write a register of 8-bit address. */
+#define STM32_UTILS_I2C_BATCH_WRITE_REG(addr, reg_addr, p_buf, size)                                                 \
+  { STM32_UTILS_I2C_BATCH_CMD_WRITE_REG, (addr), (reg_addr), HAL_I2C_MEM_ADDR_8BIT, (void *)(p_buf), (size),       \
+    0U, 0U, 0U, 0U }
+
+/** @brief Read a register of 8-bit address. */
+#define STM32_UTILS_I2C_BATCH_READ_REG(addr, reg_addr, p_buf, size)                                                  \
+  { STM32_UTILS_I2C_BATCH_CMD_READ_REG, (addr), (reg_addr), HAL_I2C_MEM_ADDR_8BIT, (p_buf), (size), 0U, 0U, 0U, 0U }
+
+/** @brief Wait a number of ticks. */
+#define STM32_UTILS_I2C_BATCH_DELAY(nb_tick)                                                                         \
+  { STM32_UTILS_I2C_BATCH_CMD_DELAY, 0U, 0U, HAL_I2C_MEM_ADDR_8BIT, NULL, 0U, 0U, 0U, 0U, (nb_tick) }
+
+/** @brief Poll a register of 8-bit address until (value & bit_mask) == bit_match. */
+#define STM32_UTILS_I2C_BATCH_POLL(addr, reg_addr, bit_mask, bit_match, nb_tick, nb_retry)                           \
+  { STM32_UTILS_I2C_BATCH_CMD_POLL, (addr), (reg_addr), HAL_I2C_MEM_ADDR_8BIT, NULL, 1U, (bit_mask), (bit_match),  \
+    (nb_retry), (nb_tick) }
+
+/**
+  * @}
+  */
+
+/* Exported functions ------------------------------------------------------------------------------------------------*/
+/** @addtogroup I2C_BATCH_Exported_Functions
+  * @{
+  */
+stm32_utils_i2c_batch_status_t STM32_UTILS_I2C_BATCH_Init(stm32_utils_i2c_batch_t *p_batch, hal_i2c_handle_t *hi2c,
+                                                          stm32_utils_i2c_batch_mode_t mode);
+stm32_utils_i2c_batch_status_t STM32_UTILS_I2C_BATCH_Start(stm32_utils_i2c_batch_t *p_batch,
+                                                           const stm32_utils_i2c_batch_cmd_t *p_cmd, uint32_t cmd_nbr,
+                                                           uint32_t period_tick, stm32_utils_i2c_batch_cb_t p_cplt_cb);
+void STM32_UTILS_I2C_BATCH_Stop(stm32_utils_i2c_batch_t *p_batch);
+uint32_t STM32_UTILS_I2C_BATCH_IsRunning(const stm32_utils_i2c_batch_t *p_batch);
+uint32_t STM32_UTILS_I2C_BATCH_GetRunCount(const stm32_utils_i2c_batch_t *p_batch);
+uint32_t STM32_UTILS_I2C_BATCH_GetErrorCount(const stm32_utils_i2c_batch_t *p_batch);
+
+/* To be called periodically, for instance from the SysTick handler after HAL_IncTick() */
+void STM32_UTILS_I2C_BATCH_IncTick(void);
+
+/* To be called from HAL_I2C_MASTER_MemTxCpltCallback, HAL_I2C_MASTER_MemRxCpltCallback and HAL_I2C_ErrorCallback
+   when USE_HAL_I2C_REGISTER_CALLBACKS is not set */
+void STM32_UTILS_I2C_BATCH_XferCpltCallback(hal_i2c_handle_t *hi2c);
+void STM32_UTILS_I2C_BATCH_ErrorCallback(hal_i2c_handle_t *hi2c);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32_UTILS_I2C_BATCH_H */
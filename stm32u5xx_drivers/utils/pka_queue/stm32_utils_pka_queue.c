@@ -0,0 +1,709 @@
+/**
+  **********************************************************************************************************************
+  * @file    stm32_utils_pka_queue.c
+  * @brief   This utility chains the operations of a PKA from its completion interrupt.
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "stm32_utils_pka_queue.h"
+#include <string.h>
+
+#if defined(PKA) && defined(USE_HAL_PKA_MODULE) && (USE_HAL_PKA_MODULE == 1U)
+
+/** @addtogroup STM32_UTILS
+  * @{
+  */
+
+/** @addtogroup PKA_QUEUE
+  * @{
+  */
+
+/** @defgroup PKA_QUEUE_Introduction PKA_QUEUE Introduction
+  * @{
+
+  The PKA job queue runs ECDSA verifications, ECC scalar multiplications and modular exponentiations one after the
+  other on a PKA, without the application sequencing the loading of the parameters and the reading of the results:
+
+  - A job is submitted with STM32_UTILS_PKA_QUEUE_SubmitECDSAVerif(), STM32_UTILS_PKA_QUEUE_SubmitECCMul() or
+    STM32_UTILS_PKA_QUEUE_SubmitModExp(), with the HAL configuration of the operation. The jobs are processed in
+    their submission order.
+  - STM32_UTILS_PKA_QUEUE_SubmitECDSAVerifBatch() queues an array of verifications at once, so that no other job is
+    inserted between them.
+  - The operation of a job is started with HAL_PKA_Compute_IT(). From the PKA completion interrupt, the result is
+    read into the job, the job callback is called and the next job is started.
+  - When reuse_params is set, a job using the same curve parameters, or the same modulus, as the previous job of the
+    same operation only loads its own operands with HAL_PKA_ECDSA_UpdateVerifSignature(), HAL_PKA_ECC_UpdateMul() or
+    HAL_PKA_UpdateModExp(). The parameters are compared by address and size: the buffers holding them must not be
+    modified in place while jobs using them are queued.
+  - STM32_UTILS_PKA_QUEUE_GetStats() returns the jobs completed, the jobs in error, the parameter loads and reuses,
+    and the time the PKA was busy against the time elapsed, from which the throughput and the PKA load are derived.
+
+  A job ends with STM32_UTILS_PKA_QUEUE_OK once its result is read: the validity of an ECDSA signature is then in its
+  signature field, the size of the other results in its result_size_byte field. An ECC scalar multiplication whose
+  result is reported in error by the PKA, or an operation stopped by a PKA error, ends with
+  STM32_UTILS_PKA_QUEUE_ERROR. After a PKA error, the next job loads all its parameters.
+
+  The PKA handle must be initialized. With USE_HAL_PKA_REGISTER_CALLBACKS set, STM32_UTILS_PKA_QUEUE_Init() registers
+  the PKA operation complete and error callbacks. Otherwise HAL_PKA_OperationCpltCallback() must call
+  STM32_UTILS_PKA_QUEUE_OperationCpltCallback() and HAL_PKA_ErrorCallback() must call
+  STM32_UTILS_PKA_QUEUE_ErrorCallback().
+
+  The PKA must not be used outside of the queue once it is initialized.
+
+  */
+/**
+  * @}
+  */
+
+/* Private constants ---------------------------------------------------------*/
+/** @defgroup PKA_QUEUE_Private_Constants PKA_QUEUE Private Constants
+  * @{
+  */
+#define PKA_QUEUE_STATE_IDLE   (0U)  /* No operation in progress, no job being started  */
+#define PKA_QUEUE_STATE_RUN    (1U)  /* Operation in progress or job being started      */
+
+/**
+  * @}
+  */
+
+/* Private variables ---------------------------------------------------------*/
+/** @defgroup PKA_QUEUE_Private_Variables PKA_QUEUE Private Variables
+  * @{
+  */
+static stm32_utils_pka_queue_t *p_pka_queue_list = NULL; /* Queues initialized, one per PKA handle */
+
+/**
+  * @}
+  */
+
+/* Private function prototypes -----------------------------------------------*/
+/** @defgroup PKA_QUEUE_Private_Functions PKA_QUEUE Private Functions
+  * @{
+  */
+static stm32_utils_pka_queue_t *PKA_QUEUE_Find(const hal_pka_handle_t *hpka);
+static void PKA_QUEUE_Prepare(stm32_utils_pka_queue_job_t *p_job, stm32_utils_pka_queue_op_t op, const void *p_config,
+                              void *p_result, stm32_utils_pka_queue_cb_t p_cb);
+static void PKA_QUEUE_Append(stm32_utils_pka_queue_t *p_queue, stm32_utils_pka_queue_job_t *p_first,
+                             stm32_utils_pka_queue_job_t *p_last);
+static void PKA_QUEUE_GetParams(const stm32_utils_pka_queue_job_t *p_job, stm32_utils_pka_queue_params_t *p_params);
+static hal_status_t PKA_QUEUE_Load(stm32_utils_pka_queue_t *p_queue, const stm32_utils_pka_queue_job_t *p_job);
+static stm32_utils_pka_queue_job_t *PKA_QUEUE_Next(stm32_utils_pka_queue_t *p_queue);
+static void PKA_QUEUE_Run(stm32_utils_pka_queue_t *p_queue);
+static void PKA_QUEUE_End(stm32_utils_pka_queue_t *p_queue, stm32_utils_pka_queue_job_t *p_job,
+                          stm32_utils_pka_queue_status_t status);
+/**
+  * @}
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @defgroup PKA_QUEUE_Exported_Functions PKA_QUEUE Exported Functions
+  * @{
+  */
+
+/**
+  * @brief  Initialize the job queue of a PKA.
+  * @param  p_queue      Pointer to the queue, allocated by the application.
+  * @param  hpka         Pointer to the PKA handle, initialized.
+  * @param  reuse_params 1 to keep the curve parameters or the modulus in the PKA RAM between consecutive jobs sharing
+  *                      them, 0 to load all the parameters of each job.
+  * @retval STM32_UTILS_PKA_QUEUE_OK            The queue is ready.
+  * @retval STM32_UTILS_PKA_QUEUE_INVALID_PARAM A pointer is NULL.
+  * @retval STM32_UTILS_PKA_QUEUE_ERROR         The PKA callbacks could not be registered.
+  */
+stm32_utils_pka_queue_status_t STM32_UTILS_PKA_QUEUE_Init(stm32_utils_pka_queue_t *p_queue, hal_pka_handle_t *hpka,
+                                                          uint32_t reuse_params)
+{
+  uint32_t primask_bit;
+
+  if ((p_queue == NULL) || (hpka == NULL))
+  {
+    return STM32_UTILS_PKA_QUEUE_INVALID_PARAM;
+  }
+
+#if defined(USE_HAL_PKA_REGISTER_CALLBACKS) && (USE_HAL_PKA_REGISTER_CALLBACKS == 1)
+  if ((HAL_PKA_RegisterOperationCpltCallback(hpka, STM32_UTILS_PKA_QUEUE_OperationCpltCallback) != HAL_OK)
+      || (HAL_PKA_RegisterErrorCallback(hpka, STM32_UTILS_PKA_QUEUE_ErrorCallback) != HAL_OK))
+  {
+    return STM32_UTILS_PKA_QUEUE_ERROR;
+  }
+#endif /* USE_HAL_PKA_REGISTER_CALLBACKS */
+
+  p_queue->hpka         = hpka;
+  p_queue->reuse_params = (reuse_params != 0U) ? 1U : 0U;
+  p_queue->p_head       = NULL;
+  p_queue->p_tail       = NULL;
+  p_queue->p_running    = NULL;
+  p_queue->state        = PKA_QUEUE_STATE_IDLE;
+  p_queue->start_tick   = 0U;
+  (void)memset(&p_queue->loaded, 0, sizeof(p_queue->loaded));
+  STM32_UTILS_PKA_QUEUE_ResetStats(p_queue);
+
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  if (PKA_QUEUE_Find(hpka) == NULL)
+  {
+    p_queue->p_next = p_pka_queue_list;
+    p_pka_queue_list = p_queue;
+  }
+  __set_PRIMASK(primask_bit);
+
+  return STM32_UTILS_PKA_QUEUE_OK;
+}
+
+/**
+  * @brief  Submit an ECDSA signature verification.
+  * @param  p_queue  Pointer to the queue.
+  * @param  p_job    Pointer to the job, allocated by the application, kept by the queue until its callback.
+  * @param  p_config Configuration of the verification, kept by the queue until the job callback.
+  * @param  p_cb     Callback called at the end of the job, can be NULL.
+  * @retval STM32_UTILS_PKA_QUEUE_OK            The job is queued.
+  * @retval STM32_UTILS_PKA_QUEUE_INVALID_PARAM A pointer is NULL.
+  */
+stm32_utils_pka_queue_status_t STM32_UTILS_PKA_QUEUE_SubmitECDSAVerif(stm32_utils_pka_queue_t *p_queue,
+                                                                      stm32_utils_pka_queue_job_t *p_job,
+                                                                      const hal_pka_ecdsa_verif_config_t *p_config,
+                                                                      stm32_utils_pka_queue_cb_t p_cb)
+{
+  if ((p_queue == NULL) || (p_job == NULL) || (p_config == NULL))
+  {
+    return STM32_UTILS_PKA_QUEUE_INVALID_PARAM;
+  }
+
+  PKA_QUEUE_Prepare(p_job, STM32_UTILS_PKA_QUEUE_ECDSA_VERIF, p_config, NULL, p_cb);
+  PKA_QUEUE_Append(p_queue, p_job, p_job);
+
+  return STM32_UTILS_PKA_QUEUE_OK;
+}
+
+/**
+  * @brief  Submit consecutive ECDSA signature verifications.
+  * @param  p_queue   Pointer to the queue.
+  * @param  p_jobs    Array of nbr_job jobs, allocated by the application, each kept by the queue until its callback.
+  * @param  p_configs Array of nbr_job verification configurations, each kept by the queue until its job callback.
+  * @param  nbr_job   Number of verifications.
+  * @param  p_cb      Callback called at the end of each job, can be NULL.
+  * @note   The verifications are processed one after the other, no job submitted meanwhile being inserted between
+  *         them: the ones on the same curve load its parameters once when reuse_params is set.
+  * @retval STM32_UTILS_PKA_QUEUE_OK            The jobs are queued.
+  * @retval STM32_UTILS_PKA_QUEUE_INVALID_PARAM A pointer is NULL or nbr_job is 0.
+  */
+stm32_utils_pka_queue_status_t STM32_UTILS_PKA_QUEUE_SubmitECDSAVerifBatch(
+  stm32_utils_pka_queue_t *p_queue, stm32_utils_pka_queue_job_t *p_jobs,
+  const hal_pka_ecdsa_verif_config_t *p_configs, uint32_t nbr_job, stm32_utils_pka_queue_cb_t p_cb)
+{
+  uint32_t i;
+
+  if ((p_queue == NULL) || (p_jobs == NULL) || (p_configs == NULL) || (nbr_job == 0U))
+  {
+    return STM32_UTILS_PKA_QUEUE_INVALID_PARAM;
+  }
+
+  for (i = 0U; i < nbr_job; i++)
+  {
+    PKA_QUEUE_Prepare(&p_jobs[i], STM32_UTILS_PKA_QUEUE_ECDSA_VERIF, &p_configs[i], NULL, p_cb);
+    if (i != 0U)
+    {
+      p_jobs[i - 1U].p_next = &p_jobs[i];
+    }
+  }
+  PKA_QUEUE_Append(p_queue, &p_jobs[0], &p_jobs[nbr_job - 1U]);
+
+  return STM32_UTILS_PKA_QUEUE_OK;
+}
+
+/**
+  * @brief  Submit an ECC scalar multiplication.
+  * @param  p_queue  Pointer to the queue.
+  * @param  p_job    Pointer to the job, allocated by the application, kept by the queue until its callback.
+  * @param  p_config Configuration of the multiplication, kept by the queue until the job callback.
+  * @param  p_result Buffers of the coordinates of the result, of modulus_size_byte bytes each.
+  * @param  p_cb     Callback called at the end of the job, can be NULL.
+  * @retval STM32_UTILS_PKA_QUEUE_OK            The job is queued.
+  * @retval STM32_UTILS_PKA_QUEUE_INVALID_PARAM A pointer is NULL.
+  */
+stm32_utils_pka_queue_status_t STM32_UTILS_PKA_QUEUE_SubmitECCMul(stm32_utils_pka_queue_t *p_queue,
+                                                                  stm32_utils_pka_queue_job_t *p_job,
+                                                                  const hal_pka_ecc_mul_config_t *p_config,
+                                                                  hal_pka_ecc_mul_result_t *p_result,
+                                                                  stm32_utils_pka_queue_cb_t p_cb)
+{
+  if ((p_queue == NULL) || (p_job == NULL) || (p_config == NULL) || (p_result == NULL) || (p_result->p_pt_x == NULL)
+      || (p_result->p_pt_y == NULL))
+  {
+    return STM32_UTILS_PKA_QUEUE_INVALID_PARAM;
+  }
+
+  PKA_QUEUE_Prepare(p_job, STM32_UTILS_PKA_QUEUE_ECC_MUL, p_config, p_result, p_cb);
+  PKA_QUEUE_Append(p_queue, p_job, p_job);
+
+  return STM32_UTILS_PKA_QUEUE_OK;
+}
+
+/**
+  * @brief  Submit a modular exponentiation.
+  * @param  p_queue  Pointer to the queue.
+  * @param  p_job    Pointer to the job, allocated by the application, kept by the queue until its callback.
+  * @param  p_config Configuration of the exponentiation, kept by the queue until the job callback.
+  * @param  p_result Buffer of the result, of operand_size_byte bytes.
+  * @param  p_cb     Callback called at the end of the job, can be NULL.
+  * @retval STM32_UTILS_PKA_QUEUE_OK            The job is queued.
+  * @retval STM32_UTILS_PKA_QUEUE_INVALID_PARAM A pointer is NULL.
+  */
+stm32_utils_pka_queue_status_t STM32_UTILS_PKA_QUEUE_SubmitModExp(stm32_utils_pka_queue_t *p_queue,
+                                                                  stm32_utils_pka_queue_job_t *p_job,
+                                                                  const hal_pka_mod_exp_config_t *p_config,
+                                                                  uint8_t *p_result, stm32_utils_pka_queue_cb_t p_cb)
+{
+  if ((p_queue == NULL) || (p_job == NULL) || (p_config == NULL) || (p_result == NULL))
+  {
+    return STM32_UTILS_PKA_QUEUE_INVALID_PARAM;
+  }
+
+  PKA_QUEUE_Prepare(p_job, STM32_UTILS_PKA_QUEUE_MOD_EXP, p_config, p_result, p_cb);
+  PKA_QUEUE_Append(p_queue, p_job, p_job);
+
+  return STM32_UTILS_PKA_QUEUE_OK;
+}
+
+/**
+  * @brief  Tell whether all the jobs submitted are completed.
+  * @param  p_queue Pointer to the queue.
+  * @retval 1 No job is pending or in progress.
+  * @retval 0 Jobs are pending or in progress.
+  */
+uint32_t STM32_UTILS_PKA_QUEUE_IsIdle(const stm32_utils_pka_queue_t *p_queue)
+{
+  return (p_queue->state == PKA_QUEUE_STATE_IDLE) ? 1U : 0U;
+}
+
+/**
+  * @brief  Get the throughput counters of the queue.
+  * @param  p_queue Pointer to the queue.
+  * @param  p_stats Pointer to the counters, filled by the function.
+  */
+void STM32_UTILS_PKA_QUEUE_GetStats(const stm32_utils_pka_queue_t *p_queue, stm32_utils_pka_queue_stats_t *p_stats)
+{
+  uint32_t primask_bit;
+
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  *p_stats = p_queue->stats;
+  if (p_queue->p_running != NULL)
+  {
+    /* Account for the operation in progress up to now */
+    p_stats->busy_ms += HAL_GetTick() - p_queue->start_tick;
+  }
+  p_stats->elapsed_ms = HAL_GetTick() - p_queue->reset_tick;
+  __set_PRIMASK(primask_bit);
+}
+
+/**
+  * @brief  Reset the throughput counters of the queue.
+  * @param  p_queue Pointer to the queue.
+  */
+void STM32_UTILS_PKA_QUEUE_ResetStats(stm32_utils_pka_queue_t *p_queue)
+{
+  uint32_t primask_bit;
+
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  (void)memset(&p_queue->stats, 0, sizeof(p_queue->stats));
+  p_queue->reset_tick = HAL_GetTick();
+  if (p_queue->p_running != NULL)
+  {
+    p_queue->start_tick = p_queue->reset_tick;
+  }
+  __set_PRIMASK(primask_bit);
+}
+
+/**
+  * @brief  Read the result of the operation in progress into its job and start the next job.
+  * @param  hpka Pointer to the PKA handle.
+  */
+void STM32_UTILS_PKA_QUEUE_OperationCpltCallback(hal_pka_handle_t *hpka)
+{
+  stm32_utils_pka_queue_t *p_queue = PKA_QUEUE_Find(hpka);
+  stm32_utils_pka_queue_job_t *p_job;
+  stm32_utils_pka_queue_status_t status = STM32_UTILS_PKA_QUEUE_OK;
+  uint32_t primask_bit;
+
+  if (p_queue == NULL)
+  {
+    return;
+  }
+
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  p_job = p_queue->p_running;
+  p_queue->p_running = NULL;
+  __set_PRIMASK(primask_bit);
+
+  if (p_job == NULL)
+  {
+    return;
+  }
+
+  p_queue->stats.busy_ms += HAL_GetTick() - p_queue->start_tick;
+
+  switch (p_job->op)
+  {
+    case STM32_UTILS_PKA_QUEUE_ECDSA_VERIF:
+      p_job->signature = HAL_PKA_ECDSA_IsValidVerifSignature(hpka);
+      break;
+    case STM32_UTILS_PKA_QUEUE_ECC_MUL:
+      p_job->result_size_byte = HAL_PKA_ECC_GetResultMul(hpka, (hal_pka_ecc_mul_result_t *)p_job->p_result);
+      status = (p_job->result_size_byte != 0U) ? STM32_UTILS_PKA_QUEUE_OK : STM32_UTILS_PKA_QUEUE_ERROR;
+      break;
+    case STM32_UTILS_PKA_QUEUE_MOD_EXP:
+      p_job->result_size_byte = HAL_PKA_GetResultModExp(hpka, (uint8_t *)p_job->p_result);
+      break;
+    default:
+      status = STM32_UTILS_PKA_QUEUE_ERROR;
+      break;
+  }
+
+  PKA_QUEUE_End(p_queue, p_job, status);
+  PKA_QUEUE_Run(p_queue);
+}
+
+/**
+  * @brief  Complete the job in progress with error and start the next one.
+  * @param  hpka Pointer to the PKA handle.
+  */
+void STM32_UTILS_PKA_QUEUE_ErrorCallback(hal_pka_handle_t *hpka)
+{
+  stm32_utils_pka_queue_t *p_queue = PKA_QUEUE_Find(hpka);
+  stm32_utils_pka_queue_job_t *p_job;
+  uint32_t primask_bit;
+
+  if (p_queue == NULL)
+  {
+    return;
+  }
+
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  p_job = p_queue->p_running;
+  p_queue->p_running = NULL;
+  __set_PRIMASK(primask_bit);
+
+  if (p_job == NULL)
+  {
+    return;
+  }
+
+  p_queue->stats.busy_ms += HAL_GetTick() - p_queue->start_tick;
+
+  /* The operation is stopped, the PKA is disabled and returns to the INIT state. The operation being the one of the
+     queue, the abort does not race with another caller. The PKA RAM is no longer trusted. */
+  (void)HAL_PKA_Abort(hpka);
+  p_queue->loaded.op = 0U;
+
+  PKA_QUEUE_End(p_queue, p_job, STM32_UTILS_PKA_QUEUE_ERROR);
+  PKA_QUEUE_Run(p_queue);
+}
+
+/**
+  * @}
+  */
+
+/* Private functions ---------------------------------------------------------*/
+/** @addtogroup PKA_QUEUE_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Find the queue of a PKA handle.
+  * @param  hpka Pointer to the PKA handle.
+  * @retval Pointer to the queue, NULL when none is initialized on the handle.
+  */
+static stm32_utils_pka_queue_t *PKA_QUEUE_Find(const hal_pka_handle_t *hpka)
+{
+  stm32_utils_pka_queue_t *p_queue;
+
+  for (p_queue = p_pka_queue_list; p_queue != NULL; p_queue = p_queue->p_next)
+  {
+    if (p_queue->hpka == hpka)
+    {
+      break;
+    }
+  }
+
+  return p_queue;
+}
+
+/**
+  * @brief  Fill a job before its submission.
+  * @param  p_job    Pointer to the job.
+  * @param  op       Operation of the job.
+  * @param  p_config HAL configuration of the operation.
+  * @param  p_result Result buffers of the operation, NULL for an ECDSA verification.
+  * @param  p_cb     Completion callback, can be NULL.
+  */
+static void PKA_QUEUE_Prepare(stm32_utils_pka_queue_job_t *p_job, stm32_utils_pka_queue_op_t op, const void *p_config,
+                              void *p_result, stm32_utils_pka_queue_cb_t p_cb)
+{
+  p_job->op               = op;
+  p_job->p_cb             = p_cb;
+  p_job->status           = STM32_UTILS_PKA_QUEUE_BUSY;
+  p_job->signature        = PKA_ECDSA_SIGNATURE_NOT_VALID;
+  p_job->result_size_byte = 0U;
+  p_job->p_config         = p_config;
+  p_job->p_result         = p_result;
+  p_job->p_next           = NULL;
+}
+
+/**
+  * @brief  Append a chain of jobs to the queue, starting the first one when the PKA is free.
+  * @param  p_queue Pointer to the queue.
+  * @param  p_first First job of the chain.
+  * @param  p_last  Last job of the chain.
+  */
+static void PKA_QUEUE_Append(stm32_utils_pka_queue_t *p_queue, stm32_utils_pka_queue_job_t *p_first,
+                             stm32_utils_pka_queue_job_t *p_last)
+{
+  uint32_t run = 0U;
+  uint32_t primask_bit;
+
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  if (p_queue->p_tail == NULL)
+  {
+    p_queue->p_head = p_first;
+  }
+  else
+  {
+    p_queue->p_tail->p_next = p_first;
+  }
+  p_queue->p_tail = p_last;
+
+  if (p_queue->state == PKA_QUEUE_STATE_IDLE)
+  {
+    p_queue->state = PKA_QUEUE_STATE_RUN;
+    run = 1U;
+  }
+  __set_PRIMASK(primask_bit);
+
+  if (run != 0U)
+  {
+    PKA_QUEUE_Run(p_queue);
+  }
+}
+
+/**
+  * @brief  Extract the parameters of a job which can be shared with the previous job.
+  * @param  p_job    Pointer to the job.
+  * @param  p_params Pointer to the parameters, filled by the function.
+  */
+static void PKA_QUEUE_GetParams(const stm32_utils_pka_queue_job_t *p_job, stm32_utils_pka_queue_params_t *p_params)
+{
+  const hal_pka_ecdsa_verif_config_t *p_verif;
+  const hal_pka_ecc_mul_config_t *p_mul;
+  const hal_pka_mod_exp_config_t *p_exp;
+
+  /* Cleared as a whole, the parameters being compared with memcmp() */
+  (void)memset(p_params, 0, sizeof(*p_params));
+  p_params->op = (uint32_t)p_job->op;
+
+  switch (p_job->op)
+  {
+    case STM32_UTILS_PKA_QUEUE_ECDSA_VERIF:
+      p_verif = (const hal_pka_ecdsa_verif_config_t *)p_job->p_config;
+      p_params->modulus_size_byte     = p_verif->modulus_size_byte;
+      p_params->prime_order_size_byte = p_verif->prime_order_size_byte;
+      p_params->coeff_sign            = p_verif->coeff_sign;
+      p_params->p_modulus             = p_verif->p_modulus;
+      p_params->p_coeff_a             = p_verif->p_coeff;
+      p_params->p_base_pt_x           = p_verif->p_base_pt_x;
+      p_params->p_base_pt_y           = p_verif->p_base_pt_y;
+      p_params->p_prime_order         = p_verif->p_prime_order;
+      break;
+    case STM32_UTILS_PKA_QUEUE_ECC_MUL:
+      p_mul = (const hal_pka_ecc_mul_config_t *)p_job->p_config;
+      p_params->modulus_size_byte     = p_mul->modulus_size_byte;
+      p_params->prime_order_size_byte = p_mul->prime_order_size_byte;
+      p_params->coeff_sign            = p_mul->coeff_sign;
+      p_params->p_modulus             = p_mul->p_modulus;
+      p_params->p_coeff_a             = p_mul->p_coeff_a;
+      p_params->p_coeff_b             = p_mul->p_coeff_b;
+      p_params->p_prime_order         = p_mul->p_prime_order;
+      break;
+    case STM32_UTILS_PKA_QUEUE_MOD_EXP:
+      p_exp = (const hal_pka_mod_exp_config_t *)p_job->p_config;
+      p_params->modulus_size_byte     = p_exp->operand_size_byte;
+      p_params->p_modulus             = p_exp->p_modulus;
+      break;
+    default:
+      break;
+  }
+}
+
+/**
+  * @brief  Load the parameters of a job in the PKA, only its own operands when the previous job shares the others.
+  * @param  p_queue Pointer to the queue.
+  * @param  p_job   Pointer to the job.
+  * @retval HAL_OK    The operation of the job is configured.
+  * @retval HAL_ERROR The configuration failed.
+  */
+static hal_status_t PKA_QUEUE_Load(stm32_utils_pka_queue_t *p_queue, const stm32_utils_pka_queue_job_t *p_job)
+{
+  stm32_utils_pka_queue_params_t params;
+  hal_status_t status = HAL_ERROR;
+  uint32_t reuse;
+
+  PKA_QUEUE_GetParams(p_job, &params);
+  reuse = ((p_queue->reuse_params != 0U) && (p_queue->loaded.op != 0U)
+           && (memcmp(&params, &p_queue->loaded, sizeof(params)) == 0)) ? 1U : 0U;
+
+  /* Written again by the next job if this configuration fails */
+  p_queue->loaded.op = 0U;
+
+  switch (p_job->op)
+  {
+    case STM32_UTILS_PKA_QUEUE_ECDSA_VERIF:
+      status = (reuse != 0U)
+               ? HAL_PKA_ECDSA_UpdateVerifSignature(p_queue->hpka,
+                                                    (const hal_pka_ecdsa_verif_config_t *)p_job->p_config)
+               : HAL_PKA_ECDSA_SetConfigVerifSignature(p_queue->hpka,
+                                                       (const hal_pka_ecdsa_verif_config_t *)p_job->p_config);
+      break;
+    case STM32_UTILS_PKA_QUEUE_ECC_MUL:
+      status = (reuse != 0U)
+               ? HAL_PKA_ECC_UpdateMul(p_queue->hpka, (const hal_pka_ecc_mul_config_t *)p_job->p_config)
+               : HAL_PKA_ECC_SetConfigMul(p_queue->hpka, (const hal_pka_ecc_mul_config_t *)p_job->p_config);
+      break;
+    case STM32_UTILS_PKA_QUEUE_MOD_EXP:
+      status = (reuse != 0U)
+               ? HAL_PKA_UpdateModExp(p_queue->hpka, (const hal_pka_mod_exp_config_t *)p_job->p_config)
+               : HAL_PKA_SetConfigModExp(p_queue->hpka, (const hal_pka_mod_exp_config_t *)p_job->p_config);
+      break;
+    default:
+      break;
+  }
+
+  if (status != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  p_queue->loaded = params;
+  if (reuse != 0U)
+  {
+    p_queue->stats.reuse_count++;
+  }
+  else
+  {
+    p_queue->stats.load_count++;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Get the next job to process, releasing the queue when no job is pending.
+  * @param  p_queue Pointer to the queue.
+  * @retval Pointer to the job, NULL when no job is pending.
+  */
+static stm32_utils_pka_queue_job_t *PKA_QUEUE_Next(stm32_utils_pka_queue_t *p_queue)
+{
+  stm32_utils_pka_queue_job_t *p_job;
+  uint32_t primask_bit;
+
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  p_job = p_queue->p_head;
+  if (p_job == NULL)
+  {
+    p_queue->state = PKA_QUEUE_STATE_IDLE;
+  }
+  __set_PRIMASK(primask_bit);
+
+  return p_job;
+}
+
+/**
+  * @brief  Start the next job, until one is in progress or no job is pending.
+  * @param  p_queue Pointer to the queue, taken by the caller.
+  */
+static void PKA_QUEUE_Run(stm32_utils_pka_queue_t *p_queue)
+{
+  stm32_utils_pka_queue_job_t *p_job;
+
+  for (p_job = PKA_QUEUE_Next(p_queue); p_job != NULL; p_job = PKA_QUEUE_Next(p_queue))
+  {
+    if (PKA_QUEUE_Load(p_queue, p_job) == HAL_OK)
+    {
+      p_queue->p_running  = p_job;
+      p_queue->start_tick = HAL_GetTick();
+
+      if (HAL_PKA_Compute_IT(p_queue->hpka) == HAL_OK)
+      {
+        /* Completed from the PKA interrupt, which starts the next job */
+        break;
+      }
+
+      p_queue->p_running = NULL;
+      (void)HAL_PKA_Abort(p_queue->hpka);
+      p_queue->loaded.op = 0U;
+    }
+
+    PKA_QUEUE_End(p_queue, p_job, STM32_UTILS_PKA_QUEUE_ERROR);
+  }
+}
+
+/**
+  * @brief  Complete the first job of the queue.
+  * @param  p_queue Pointer to the queue.
+  * @param  p_job   Pointer to the job, first of the queue.
+  * @param  status  Result of the job.
+  */
+static void PKA_QUEUE_End(stm32_utils_pka_queue_t *p_queue, stm32_utils_pka_queue_job_t *p_job,
+                          stm32_utils_pka_queue_status_t status)
+{
+  uint32_t primask_bit;
+
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  p_queue->p_head = p_job->p_next;
+  if (p_queue->p_head == NULL)
+  {
+    p_queue->p_tail = NULL;
+  }
+  p_queue->stats.job_count++;
+  if (status != STM32_UTILS_PKA_QUEUE_OK)
+  {
+    p_queue->stats.error_count++;
+  }
+  __set_PRIMASK(primask_bit);
+
+  p_job->status = status;
+  if (p_job->p_cb != NULL)
+  {
+    p_job->p_cb(p_job);
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* PKA && USE_HAL_PKA_MODULE */
@@ -0,0 +1,195 @@
+/**
+  **********************************************************************************************************************
+  * @file    stm32_utils_pka_queue.h
+  * @brief   Header file of UTILS PKA job queue module.
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -----------------------------------------------------------------------------*/
+#ifndef STM32_UTILS_PKA_QUEUE_H
+#define STM32_UTILS_PKA_QUEUE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32_hal.h"
+#include <stdint.h>
+
+#if defined(PKA) && defined(USE_HAL_PKA_MODULE) && (USE_HAL_PKA_MODULE == 1U)
+
+/** @addtogroup STM32_UTILS
+  * @{
+  */
+
+/** @addtogroup PKA_QUEUE
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+/** @defgroup PKA_QUEUE_Exported_Types PKA_QUEUE Exported Types
+  * @{
+  */
+
+/**
+  * @brief  PKA_QUEUE Utils Status structures definition
+  */
+typedef enum
+{
+  STM32_UTILS_PKA_QUEUE_OK            = 0x00000000U, /*!< Utils PKA_QUEUE operation completed successfully  */
+  STM32_UTILS_PKA_QUEUE_ERROR         = 0xFFFFFFFFU, /*!< Utils PKA_QUEUE operation completed with error    */
+  STM32_UTILS_PKA_QUEUE_INVALID_PARAM = 0xAAAAAAAAU, /*!< Utils PKA_QUEUE invalid parameter                 */
+  STM32_UTILS_PKA_QUEUE_BUSY          = 0x55555555U, /*!< Utils PKA_QUEUE job pending or ongoing            */
+} stm32_utils_pka_queue_status_t;
+
+/**
+  * @brief  PKA_QUEUE job operation
+  */
+typedef enum
+{
+  STM32_UTILS_PKA_QUEUE_ECDSA_VERIF = 0x00000001U, /*!< ECDSA signature verification   */
+  STM32_UTILS_PKA_QUEUE_ECC_MUL     = 0x00000002U, /*!< ECC scalar multiplication      */
+  STM32_UTILS_PKA_QUEUE_MOD_EXP     = 0x00000003U, /*!< Modular exponentiation         */
+} stm32_utils_pka_queue_op_t;
+
+typedef struct stm32_utils_pka_queue_job_s stm32_utils_pka_queue_job_t;
+
+/**
+  * @brief  PKA_QUEUE job completion callback, called in the PKA interrupt context, or in the caller context for the
+  *         jobs which could not be started.
+  */
+typedef void (*stm32_utils_pka_queue_cb_t)(stm32_utils_pka_queue_job_t *p_job);
+
+/**
+  * @brief  PKA_QUEUE job, allocated by the application and filled by the STM32_UTILS_PKA_QUEUE_Submitxxx() functions.
+  *
+  * The job, its configuration and the buffers it points to belong to the queue until its callback is called.
+  */
+struct stm32_utils_pka_queue_job_s
+{
+  stm32_utils_pka_queue_op_t             op;               /*!< Operation of the job                                */
+  stm32_utils_pka_queue_cb_t             p_cb;             /*!< Completion callback, can be NULL                    */
+  void                                   *p_user_data;     /*!< Application context, not used by the queue          */
+  volatile stm32_utils_pka_queue_status_t status;          /*!< BUSY until completion, then the result              */
+  hal_pka_ecdsa_signature_status_t       signature;        /*!< ECDSA verification result, valid or not             */
+  uint32_t                               result_size_byte; /*!< Size of the result of the other operations          */
+  const void                             *p_config;        /*!< Private: HAL configuration of the operation         */
+  void                                   *p_result;        /*!< Private: result buffers of the operation            */
+  stm32_utils_pka_queue_job_t            *p_next;          /*!< Private: next job of the queue                      */
+};
+
+/**
+  * @brief  PKA_QUEUE parameters shared by consecutive jobs and kept in the PKA RAM, private to the queue
+  */
+typedef struct
+{
+  uint32_t      op;                    /*!< Operation, 0 when no parameters are loaded           */
+  uint32_t      modulus_size_byte;     /*!< Size of the modulus                                  */
+  uint32_t      prime_order_size_byte; /*!< Size of the curve order                              */
+  uint32_t      coeff_sign;            /*!< Curve coefficient a sign                             */
+  const uint8_t *p_modulus;            /*!< Modulus                                              */
+  const uint8_t *p_coeff_a;            /*!< Curve coefficient |a|                                */
+  const uint8_t *p_coeff_b;            /*!< Curve coefficient b                                  */
+  const uint8_t *p_base_pt_x;          /*!< Curve base point x, ECDSA verification               */
+  const uint8_t *p_base_pt_y;          /*!< Curve base point y, ECDSA verification               */
+  const uint8_t *p_prime_order;        /*!< Curve order                                          */
+} stm32_utils_pka_queue_params_t;
+
+/**
+  * @brief  PKA_QUEUE throughput counters
+  */
+typedef struct
+{
+  uint32_t job_count;    /*!< Jobs completed, successfully or not                                          */
+  uint32_t error_count;  /*!< Jobs completed with error                                                    */
+  uint32_t load_count;   /*!< Jobs which loaded all their parameters in the PKA RAM                         */
+  uint32_t reuse_count;  /*!< Jobs which reused the curve parameters or modulus loaded by the previous job  */
+  uint32_t busy_ms;      /*!< Time with an operation in progress, in ms                                    */
+  uint32_t elapsed_ms;   /*!< Time since the counters were reset, in ms                                    */
+} stm32_utils_pka_queue_stats_t;
+
+/**
+  * @brief  PKA_QUEUE job queue of one PKA, allocated by the application.
+  *
+  * The fields are private to the queue.
+  */
+typedef struct stm32_utils_pka_queue_s
+{
+  hal_pka_handle_t                       *hpka;          /*!< PKA, initialized                                   */
+  uint32_t                               reuse_params;   /*!< Keep the parameters shared by consecutive jobs     */
+  stm32_utils_pka_queue_job_t            *p_head;        /*!< First job waiting or in progress                   */
+  stm32_utils_pka_queue_job_t            *p_tail;        /*!< Last job waiting                                   */
+  stm32_utils_pka_queue_job_t            *volatile p_running; /*!< Job of the operation in progress            */
+  volatile uint32_t                      state;          /*!< Queue state                                        */
+  stm32_utils_pka_queue_params_t         loaded;         /*!< Parameters in the PKA RAM                          */
+  uint32_t                               start_tick;     /*!< Start of the operation in progress                 */
+  uint32_t                               reset_tick;     /*!< Reset of the counters                              */
+  stm32_utils_pka_queue_stats_t          stats;          /*!< Throughput counters                                */
+  struct stm32_utils_pka_queue_s         *p_next;        /*!< Next queue, to find the one of a PKA handle        */
+} stm32_utils_pka_queue_t;
+
+/**
+  * @}
+  */
+
+/* Exported functions ------------------------------------------------------------------------------------------------*/
+/** @addtogroup PKA_QUEUE_Exported_Functions
+  * @{
+  */
+stm32_utils_pka_queue_status_t STM32_UTILS_PKA_QUEUE_Init(stm32_utils_pka_queue_t *p_queue, hal_pka_handle_t *hpka,
+                                                          uint32_t reuse_params);
+stm32_utils_pka_queue_status_t STM32_UTILS_PKA_QUEUE_SubmitECDSAVerif(stm32_utils_pka_queue_t *p_queue,
+                                                                      stm32_utils_pka_queue_job_t *p_job,
+                                                                      const hal_pka_ecdsa_verif_config_t *p_config,
+                                                                      stm32_utils_pka_queue_cb_t p_cb);
+stm32_utils_pka_queue_status_t STM32_UTILS_PKA_QUEUE_SubmitECDSAVerifBatch(
+  stm32_utils_pka_queue_t *p_queue, stm32_utils_pka_queue_job_t *p_jobs,
+  const hal_pka_ecdsa_verif_config_t *p_configs, uint32_t nbr_job, stm32_utils_pka_queue_cb_t p_cb);
+stm32_utils_pka_queue_status_t STM32_UTILS_PKA_QUEUE_SubmitECCMul(stm32_utils_pka_queue_t *p_queue,
+                                                                  stm32_utils_pka_queue_job_t *p_job,
+                                                                  const hal_pka_ecc_mul_config_t *p_config,
+                                                                  hal_pka_ecc_mul_result_t *p_result,
+                                                                  stm32_utils_pka_queue_cb_t p_cb);
+stm32_utils_pka_queue_status_t STM32_UTILS_PKA_QUEUE_SubmitModExp(stm32_utils_pka_queue_t *p_queue,
+                                                                  stm32_utils_pka_queue_job_t *p_job,
+                                                                  const hal_pka_mod_exp_config_t *p_config,
+                                                                  uint8_t *p_result, stm32_utils_pka_queue_cb_t p_cb);
+uint32_t STM32_UTILS_PKA_QUEUE_IsIdle(const stm32_utils_pka_queue_t *p_queue);
+void STM32_UTILS_PKA_QUEUE_GetStats(const stm32_utils_pka_queue_t *p_queue, stm32_utils_pka_queue_stats_t *p_stats);
+void STM32_UTILS_PKA_QUEUE_ResetStats(stm32_utils_pka_queue_t *p_queue);
+
+/* To be called from HAL_PKA_OperationCpltCallback and HAL_PKA_ErrorCallback when USE_HAL_PKA_REGISTER_CALLBACKS
+   is not set */
+void STM32_UTILS_PKA_QUEUE_OperationCpltCallback(hal_pka_handle_t *hpka);
+void STM32_UTILS_PKA_QUEUE_ErrorCallback(hal_pka_handle_t *hpka);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* PKA && USE_HAL_PKA_MODULE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32_UTILS_PKA_QUEUE_H */
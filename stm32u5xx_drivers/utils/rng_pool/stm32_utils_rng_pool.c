@@ -0,0 +1,422 @@
+/**
+  **********************************************************************************************************************
+  * @file    stm32_utils_rng_pool.c
+  * @brief   This utility keeps a pool of random words filled by the RNG interrupt.
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "stm32_utils_rng_pool.h"
+#include <string.h>
+
+#if defined(USE_HAL_RNG_MODULE) && (USE_HAL_RNG_MODULE == 1U)
+
+/** @addtogroup STM32_UTILS
+  * @{
+  */
+
+/** @addtogroup RNG_POOL
+  * @{
+  */
+
+/** @defgroup RNG_POOL_Introduction RNG_POOL Introduction
+  * @{
+
+  The RNG entropy pool serves random bytes without waiting for the RNG:
+
+  - The pool is a ring of words, allocated by the application, kept filled by HAL_RNG_GenerateRandomNumber_IT()
+    refills of at most refill_word words, each one started from the completion interrupt of the previous one until
+    the ring is full.
+  - STM32_UTILS_RNG_POOL_Get() copies the requested bytes from the pool and starts a refill. Each word of the pool is
+    served once, the unused bytes of the last word of a request being dropped.
+  - When the pool does not hold enough words, the request waits for the refills, up to its timeout.
+  - On a seed error, the words of the refill in progress are discarded, the RNG is recovered with
+    HAL_RNG_RecoverSeedError() and the refills restart. When the recovery fails, the requests return an error once
+    the pool is empty.
+  - STM32_UTILS_RNG_POOL_GetStats() returns the pool level, its low watermark and the error counters.
+
+  The RNG handle must be initialized and configured, and its interrupt enabled in the NVIC, usually at a low priority
+  as the refills are not urgent. With USE_HAL_RNG_REGISTER_CALLBACKS set, STM32_UTILS_RNG_POOL_Init() registers the
+  RNG generation complete and error callbacks. Otherwise HAL_RNG_GenerationCpltCallback() must call
+  STM32_UTILS_RNG_POOL_GenerationCpltCallback(), and HAL_RNG_ErrorCallback() must call
+  STM32_UTILS_RNG_POOL_ErrorCallback().
+
+  The RNG must not be used outside of the pool until STM32_UTILS_RNG_POOL_Stop() is called and the refill in
+  progress is over. The requests of a pool must be issued from one context at a time.
+
+  */
+/**
+  * @}
+  */
+
+/* Private variables ---------------------------------------------------------*/
+/** @defgroup RNG_POOL_Private_Variables RNG_POOL Private Variables
+  * @{
+  */
+static stm32_utils_rng_pool_t *p_rng_pool_list = NULL; /* Pools initialized, one per RNG handle */
+
+/**
+  * @}
+  */
+
+/* Private function prototypes -----------------------------------------------*/
+/** @defgroup RNG_POOL_Private_Functions RNG_POOL Private Functions
+  * @{
+  */
+static stm32_utils_rng_pool_t *RNG_POOL_Find(const hal_rng_handle_t *hrng);
+static void RNG_POOL_Refill(stm32_utils_rng_pool_t *p_pool);
+static uint32_t RNG_POOL_Take(stm32_utils_rng_pool_t *p_pool, uint8_t *p_data, uint32_t size_byte);
+/**
+  * @}
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @defgroup RNG_POOL_Exported_Functions RNG_POOL Exported Functions
+  * @{
+  */
+
+/**
+  * @brief  Initialize the entropy pool of an RNG and start filling it.
+  * @param  p_pool      Pointer to the pool, allocated by the application.
+  * @param  hrng        Pointer to the RNG handle, initialized and configured.
+  * @param  p_buf       Ring of size_word words.
+  * @param  size_word   Words of the ring.
+  * @param  refill_word Largest number of words generated by one refill, bounding the words lost on a seed error.
+  * @retval STM32_UTILS_RNG_POOL_OK            The pool is filling.
+  * @retval STM32_UTILS_RNG_POOL_INVALID_PARAM A pointer is NULL or a size is 0.
+  * @retval STM32_UTILS_RNG_POOL_ERROR         The RNG callbacks could not be registered.
+  */
+stm32_utils_rng_pool_status_t STM32_UTILS_RNG_POOL_Init(stm32_utils_rng_pool_t *p_pool, hal_rng_handle_t *hrng,
+                                                        uint32_t *p_buf, uint32_t size_word, uint32_t refill_word)
+{
+  uint32_t primask_bit;
+
+  if ((p_pool == NULL) || (hrng == NULL) || (p_buf == NULL) || (size_word == 0U) || (refill_word == 0U))
+  {
+    return STM32_UTILS_RNG_POOL_INVALID_PARAM;
+  }
+
+#if defined(USE_HAL_RNG_REGISTER_CALLBACKS) && (USE_HAL_RNG_REGISTER_CALLBACKS == 1)
+  if ((HAL_RNG_RegisterGenerationCpltCallback(hrng, STM32_UTILS_RNG_POOL_GenerationCpltCallback) != HAL_OK)
+      || (HAL_RNG_RegisterErrorCallback(hrng, STM32_UTILS_RNG_POOL_ErrorCallback) != HAL_OK))
+  {
+    return STM32_UTILS_RNG_POOL_ERROR;
+  }
+#endif /* USE_HAL_RNG_REGISTER_CALLBACKS */
+
+  p_pool->hrng        = hrng;
+  p_pool->p_buf       = p_buf;
+  p_pool->size_word   = size_word;
+  p_pool->refill_word = refill_word;
+  p_pool->tail        = 0U;
+  p_pool->level       = 0U;
+  p_pool->pending     = 0U;
+  p_pool->stop        = 0U;
+  p_pool->failed      = 0U;
+  (void)memset(&p_pool->stats, 0, sizeof(p_pool->stats));
+  p_pool->stats.min_level_word = size_word;
+
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  if (RNG_POOL_Find(hrng) == NULL)
+  {
+    p_pool->p_next = p_rng_pool_list;
+    p_rng_pool_list = p_pool;
+  }
+  __set_PRIMASK(primask_bit);
+
+  RNG_POOL_Refill(p_pool);
+
+  return STM32_UTILS_RNG_POOL_OK;
+}
+
+/**
+  * @brief  Stop the refills of the pool.
+  * @param  p_pool Pointer to the pool.
+  * @note   A refill in progress completes. The words left in the pool are still served.
+  */
+void STM32_UTILS_RNG_POOL_Stop(stm32_utils_rng_pool_t *p_pool)
+{
+  p_pool->stop = 1U;
+}
+
+/**
+  * @brief  Fill a buffer with random bytes from the pool.
+  * @param  p_pool     Pointer to the pool.
+  * @param  p_data     Buffer to fill, any alignment.
+  * @param  size_byte  Bytes to fill.
+  * @param  timeout_ms Time to wait for the refills when the pool is exhausted.
+  * @retval STM32_UTILS_RNG_POOL_OK            The buffer is filled.
+  * @retval STM32_UTILS_RNG_POOL_INVALID_PARAM The pointer is NULL or the size is 0.
+  * @retval STM32_UTILS_RNG_POOL_TIMEOUT       The pool did not provide enough words within the timeout.
+  * @retval STM32_UTILS_RNG_POOL_ERROR         The pool is exhausted and the RNG failed or is stopped.
+  */
+stm32_utils_rng_pool_status_t STM32_UTILS_RNG_POOL_Get(stm32_utils_rng_pool_t *p_pool, void *p_data,
+                                                       uint32_t size_byte, uint32_t timeout_ms)
+{
+  uint8_t *p_dst = (uint8_t *)p_data;
+  uint32_t done_byte;
+  uint32_t tickstart;
+
+  if ((p_pool == NULL) || (p_data == NULL) || (size_byte == 0U))
+  {
+    return STM32_UTILS_RNG_POOL_INVALID_PARAM;
+  }
+
+  done_byte = RNG_POOL_Take(p_pool, p_dst, size_byte);
+  if (done_byte == size_byte)
+  {
+    return STM32_UTILS_RNG_POOL_OK;
+  }
+
+  /* Exhausted: serve the words as the refills bring them */
+  p_pool->stats.wait_count++;
+  tickstart = HAL_GetTick();
+  while (done_byte < size_byte)
+  {
+    if (((p_pool->failed != 0U) || (p_pool->stop != 0U)) && (p_pool->pending == 0U) && (p_pool->level == 0U))
+    {
+      return STM32_UTILS_RNG_POOL_ERROR;
+    }
+
+    if ((HAL_GetTick() - tickstart) >= timeout_ms)
+    {
+      return STM32_UTILS_RNG_POOL_TIMEOUT;
+    }
+
+    done_byte += RNG_POOL_Take(p_pool, &p_dst[done_byte], size_byte - done_byte);
+  }
+
+  return STM32_UTILS_RNG_POOL_OK;
+}
+
+/**
+  * @brief  Return the number of words in the pool.
+  * @param  p_pool Pointer to the pool.
+  * @retval uint32_t Words in the pool.
+  */
+uint32_t STM32_UTILS_RNG_POOL_GetLevel(const stm32_utils_rng_pool_t *p_pool)
+{
+  return p_pool->level;
+}
+
+/**
+  * @brief  Return the statistics of the pool.
+  * @param  p_pool  Pointer to the pool.
+  * @param  p_stats Pointer to the statistics filled.
+  */
+void STM32_UTILS_RNG_POOL_GetStats(const stm32_utils_rng_pool_t *p_pool, stm32_utils_rng_pool_stats_t *p_stats)
+{
+  uint32_t primask_bit;
+
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  *p_stats = p_pool->stats;
+  p_stats->level_word = p_pool->level;
+  __set_PRIMASK(primask_bit);
+}
+
+/**
+  * @brief  Add the words of the refill completed to the pool and start the next refill.
+  * @param  hrng Pointer to the RNG handle.
+  */
+void STM32_UTILS_RNG_POOL_GenerationCpltCallback(hal_rng_handle_t *hrng)
+{
+  stm32_utils_rng_pool_t *p_pool = RNG_POOL_Find(hrng);
+
+  if ((p_pool == NULL) || (p_pool->pending == 0U))
+  {
+    return;
+  }
+
+  p_pool->level += p_pool->pending;
+  p_pool->stats.generated_word += p_pool->pending;
+  p_pool->pending = 0U;
+
+  RNG_POOL_Refill(p_pool);
+}
+
+/**
+  * @brief  Count the clock errors, recover the seed errors and restart the refills.
+  * @param  hrng Pointer to the RNG handle.
+  */
+void STM32_UTILS_RNG_POOL_ErrorCallback(hal_rng_handle_t *hrng)
+{
+  stm32_utils_rng_pool_t *p_pool = RNG_POOL_Find(hrng);
+
+  if (p_pool == NULL)
+  {
+    return;
+  }
+
+  if (HAL_RNG_GetState(hrng) != HAL_RNG_STATE_ERROR)
+  {
+    /* Clock error, the generation continues */
+    p_pool->stats.clock_error_count++;
+    return;
+  }
+
+  /* Seed error, the words already read by the refill in progress are not trusted */
+  p_pool->stats.seed_error_count++;
+  p_pool->pending = 0U;
+
+  if (HAL_RNG_RecoverSeedError(hrng) != HAL_OK)
+  {
+    p_pool->failed = 1U;
+    return;
+  }
+
+  RNG_POOL_Refill(p_pool);
+}
+
+/**
+  * @}
+  */
+
+/* Private functions ---------------------------------------------------------*/
+/** @addtogroup RNG_POOL_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Find the pool of an RNG handle.
+  * @param  hrng Pointer to the RNG handle.
+  * @retval Pointer to the pool, NULL when none is initialized on the handle.
+  */
+static stm32_utils_rng_pool_t *RNG_POOL_Find(const hal_rng_handle_t *hrng)
+{
+  stm32_utils_rng_pool_t *p_pool;
+
+  for (p_pool = p_rng_pool_list; p_pool != NULL; p_pool = p_pool->p_next)
+  {
+    if (p_pool->hrng == hrng)
+    {
+      break;
+    }
+  }
+
+  return p_pool;
+}
+
+/**
+  * @brief  Start a refill of the free words following the pool, up to the end of the ring.
+  * @param  p_pool Pointer to the pool.
+  */
+static void RNG_POOL_Refill(stm32_utils_rng_pool_t *p_pool)
+{
+  uint32_t head;
+  uint32_t nbr;
+  uint32_t primask_bit;
+
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  if ((p_pool->pending != 0U) || (p_pool->stop != 0U) || (p_pool->failed != 0U)
+      || (p_pool->level == p_pool->size_word))
+  {
+    __set_PRIMASK(primask_bit);
+    return;
+  }
+
+  head = p_pool->tail + p_pool->level;
+  if (head >= p_pool->size_word)
+  {
+    head -= p_pool->size_word;
+  }
+
+  /* Free words are contiguous up to the tail, or up to the end of the ring */
+  nbr = ((head < p_pool->tail) ? p_pool->tail : p_pool->size_word) - head;
+  if (nbr > p_pool->refill_word)
+  {
+    nbr = p_pool->refill_word;
+  }
+  p_pool->pending = nbr;
+  __set_PRIMASK(primask_bit);
+
+  if (HAL_RNG_GenerateRandomNumber_IT(p_pool->hrng, &p_pool->p_buf[head], nbr) != HAL_OK)
+  {
+    p_pool->pending = 0U;
+  }
+}
+
+/**
+  * @brief  Copy bytes from the pool, releasing the words served.
+  * @param  p_pool    Pointer to the pool.
+  * @param  p_data    Destination.
+  * @param  size_byte Bytes requested.
+  * @retval uint32_t Bytes copied, up to the bytes of the words in the pool.
+  */
+static uint32_t RNG_POOL_Take(stm32_utils_rng_pool_t *p_pool, uint8_t *p_data, uint32_t size_byte)
+{
+  uint32_t word_nbr = (size_byte + 3U) / 4U;
+  uint32_t level = p_pool->level;
+  uint32_t copy_byte;
+  uint32_t first_byte;
+  uint32_t primask_bit;
+
+  /* The words up to the level are not written by the refills until released. The level is read once: a refill
+     completing in between must not raise the number of words taken above the request. */
+  if (word_nbr > level)
+  {
+    word_nbr = level;
+  }
+
+  if (word_nbr != 0U)
+  {
+    copy_byte = (word_nbr * 4U < size_byte) ? (word_nbr * 4U) : size_byte;
+    first_byte = (p_pool->size_word - p_pool->tail) * 4U;
+    if (first_byte > copy_byte)
+    {
+      first_byte = copy_byte;
+    }
+
+    (void)memcpy(p_data, &p_pool->p_buf[p_pool->tail], first_byte);
+    (void)memcpy(&p_data[first_byte], p_pool->p_buf, copy_byte - first_byte);
+
+    primask_bit = __get_PRIMASK();
+    __set_PRIMASK(1);
+    p_pool->tail += word_nbr;
+    if (p_pool->tail >= p_pool->size_word)
+    {
+      p_pool->tail -= p_pool->size_word;
+    }
+    p_pool->level -= word_nbr;
+    if (p_pool->level < p_pool->stats.min_level_word)
+    {
+      p_pool->stats.min_level_word = p_pool->level;
+    }
+    p_pool->stats.served_byte += copy_byte;
+    __set_PRIMASK(primask_bit);
+  }
+  else
+  {
+    copy_byte = 0U;
+  }
+
+  RNG_POOL_Refill(p_pool);
+
+  return copy_byte;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* USE_HAL_RNG_MODULE */
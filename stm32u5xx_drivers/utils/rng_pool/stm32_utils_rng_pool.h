@@ -0,0 +1,129 @@
+/**
+  **********************************************************************************************************************
+  * @file    stm32_utils_rng_pool.h
+  * @brief   Header file of UTILS RNG entropy pool module.
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -----------------------------------------------------------------------------*/
+#ifndef STM32_UTILS_RNG_POOL_H
+#define STM32_UTILS_RNG_POOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32_hal.h"
+#include <stdint.h>
+
+#if defined(USE_HAL_RNG_MODULE) && (USE_HAL_RNG_MODULE == 1U)
+
+/** @addtogroup STM32_UTILS
+  * @{
+  */
+
+/** @addtogroup RNG_POOL
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+/** @defgroup RNG_POOL_Exported_Types RNG_POOL Exported Types
+  * @{
+  */
+
+/**
+  * @brief  RNG_POOL Utils Status structures definition
+  */
+typedef enum
+{
+  STM32_UTILS_RNG_POOL_OK            = 0x00000000U, /*!< Utils RNG_POOL operation completed successfully          */
+  STM32_UTILS_RNG_POOL_ERROR         = 0xFFFFFFFFU, /*!< Utils RNG_POOL seed error not recovered, or RNG failure  */
+  STM32_UTILS_RNG_POOL_INVALID_PARAM = 0xAAAAAAAAU, /*!< Utils RNG_POOL invalid parameter                         */
+  STM32_UTILS_RNG_POOL_TIMEOUT       = 0x33333333U, /*!< Utils RNG_POOL request not served within the timeout     */
+} stm32_utils_rng_pool_status_t;
+
+/**
+  * @brief  RNG_POOL statistics
+  */
+typedef struct
+{
+  uint32_t level_word;        /*!< Words in the pool                                                  */
+  uint32_t min_level_word;    /*!< Lowest number of words left in the pool after a request            */
+  uint32_t served_byte;       /*!< Bytes served to the requests                                       */
+  uint32_t generated_word;    /*!< Words added to the pool by the RNG                                 */
+  uint32_t wait_count;        /*!< Requests which waited for the RNG, the pool being exhausted        */
+  uint32_t seed_error_count;  /*!< Seed errors, the words of the refill in progress being discarded   */
+  uint32_t clock_error_count; /*!< Clock errors reported by the RNG                                   */
+} stm32_utils_rng_pool_stats_t;
+
+/**
+  * @brief  RNG_POOL entropy pool of one RNG, allocated by the application.
+  *
+  * The fields are private to the pool service.
+  */
+typedef struct stm32_utils_rng_pool_s
+{
+  hal_rng_handle_t              *hrng;         /*!< RNG, initialized and configured                      */
+  uint32_t                      *p_buf;        /*!< Ring of random words                                 */
+  uint32_t                      size_word;     /*!< Words of the ring                                    */
+  uint32_t                      refill_word;   /*!< Largest number of words generated per refill         */
+  uint32_t                      tail;          /*!< Index of the oldest word of the pool                 */
+  volatile uint32_t             level;         /*!< Words in the pool, following the tail                */
+  volatile uint32_t             pending;       /*!< Words of the refill in progress, 0 when none         */
+  volatile uint32_t             stop;          /*!< Refills stopped                                      */
+  volatile uint32_t             failed;        /*!< Seed error not recovered, no more refills            */
+  stm32_utils_rng_pool_stats_t  stats;         /*!< Statistics                                           */
+  struct stm32_utils_rng_pool_s *p_next;       /*!< Next pool, to find the pool of an RNG handle         */
+} stm32_utils_rng_pool_t;
+
+/**
+  * @}
+  */
+
+/* Exported functions ------------------------------------------------------------------------------------------------*/
+/** @addtogroup RNG_POOL_Exported_Functions
+  * @{
+  */
+stm32_utils_rng_pool_status_t STM32_UTILS_RNG_POOL_Init(stm32_utils_rng_pool_t *p_pool, hal_rng_handle_t *hrng,
+                                                        uint32_t *p_buf, uint32_t size_word, uint32_t refill_word);
+void STM32_UTILS_RNG_POOL_Stop(stm32_utils_rng_pool_t *p_pool);
+stm32_utils_rng_pool_status_t STM32_UTILS_RNG_POOL_Get(stm32_utils_rng_pool_t *p_pool, void *p_data,
+                                                       uint32_t size_byte, uint32_t timeout_ms);
+uint32_t STM32_UTILS_RNG_POOL_GetLevel(const stm32_utils_rng_pool_t *p_pool);
+void STM32_UTILS_RNG_POOL_GetStats(const stm32_utils_rng_pool_t *p_pool, stm32_utils_rng_pool_stats_t *p_stats);
+
+/* To be called from HAL_RNG_GenerationCpltCallback and HAL_RNG_ErrorCallback when USE_HAL_RNG_REGISTER_CALLBACKS
+   is not set */
+void STM32_UTILS_RNG_POOL_GenerationCpltCallback(hal_rng_handle_t *hrng);
+void STM32_UTILS_RNG_POOL_ErrorCallback(hal_rng_handle_t *hrng);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* USE_HAL_RNG_MODULE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32_UTILS_RNG_POOL_H */
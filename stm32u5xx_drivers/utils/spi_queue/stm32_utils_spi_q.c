@@ -0,0 +1,569 @@
+/**
+  **********************************************************************************************************************
+  * @file    stm32_utils_spi_q.c
+  * @brief   This utility queues SPI transactions to several devices sharing one SPI bus.
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "stm32_utils_spi_q.h"
+
+#if defined(USE_HAL_SPI_MODULE) && (USE_HAL_SPI_MODULE == 1U) && defined(USE_HAL_SPI_DMA) && (USE_HAL_SPI_DMA == 1U)
+
+/** @addtogroup STM32_UTILS
+  * @{
+  */
+
+/** @addtogroup SPI_Q
+  * @{
+  */
+
+/** @defgroup SPI_Q_Introduction SPI_Q Introduction
+  * @{
+
+  The SPI transaction queue keeps a SPI bus busy with the transactions of several devices:
+
+  - The application describes each device once (bus parameters and chip select GPIO) with
+    STM32_UTILS_SPI_Q_InitDevice(), then submits prepared transaction descriptors with STM32_UTILS_SPI_Q_Submit().
+  - The next transaction is started from the completion interrupt of the previous one, without the application:
+    the chip select of the previous device is released, the bus parameters are updated only when they differ
+    from the ones in use, the chip select of the new device is driven and the DMA transfer is started.
+  - The completion callback of the descriptor is called, in interrupt context, before the next transaction starts.
+  - Each device counts its transactions, packets, errors and bus reconfigurations.
+
+  The SPI handle must be initialized in master mode, full duplex, with the chip select pins configured as GPIO
+  outputs and the Tx and Rx DMA channels set with HAL_SPI_SetTxDMA() and HAL_SPI_SetRxDMA(). The queue is only
+  built with USE_HAL_SPI_MODULE and USE_HAL_SPI_DMA set.
+  With USE_HAL_SPI_REGISTER_CALLBACKS set, STM32_UTILS_SPI_Q_Init() registers the SPI completion and error
+  callbacks. Otherwise HAL_SPI_TxCpltCallback(), HAL_SPI_RxCpltCallback() and HAL_SPI_TxRxCpltCallback() must call
+  STM32_UTILS_SPI_Q_XferCpltCallback(), and HAL_SPI_ErrorCallback() must call STM32_UTILS_SPI_Q_ErrorCallback().
+
+  The bus must not be used outside of the queue once STM32_UTILS_SPI_Q_Init() has been called.
+
+  */
+/**
+  * @}
+  */
+
+/* Private variables ---------------------------------------------------------*/
+/** @defgroup SPI_Q_Private_Variables SPI_Q Private Variables
+  * @{
+  */
+static stm32_utils_spi_q_t *p_spi_q_list = NULL; /* Queues initialized, one per SPI handle */
+
+/**
+  * @}
+  */
+
+/* Private function prototypes -----------------------------------------------*/
+/** @defgroup SPI_Q_Private_Functions SPI_Q Private Functions
+  * @{
+  */
+static stm32_utils_spi_q_t *SPI_Q_Find(const hal_spi_handle_t *hspi);
+static void SPI_Q_ReadConfig(stm32_utils_spi_q_t *p_q);
+static hal_status_t SPI_Q_Configure(stm32_utils_spi_q_t *p_q, stm32_utils_spi_q_device_t *p_device);
+static hal_status_t SPI_Q_Start(stm32_utils_spi_q_t *p_q, stm32_utils_spi_q_xfer_t *p_xfer);
+static void SPI_Q_End(stm32_utils_spi_q_t *p_q, stm32_utils_spi_q_status_t status);
+static void SPI_Q_StartNext(stm32_utils_spi_q_t *p_q);
+static void SPI_Q_CsWrite(const stm32_utils_spi_q_device_t *p_device, uint32_t active);
+/**
+  * @}
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @defgroup SPI_Q_Exported_Functions SPI_Q Exported Functions
+  * @{
+  */
+
+/**
+  * @brief  Initialize the transaction queue of a SPI bus.
+  * @param  p_q  Pointer to the queue, allocated by the application.
+  * @param  hspi Pointer to the SPI handle, initialized in master mode with its DMA channels set.
+  * @retval STM32_UTILS_SPI_Q_OK            The queue is ready.
+  * @retval STM32_UTILS_SPI_Q_INVALID_PARAM A pointer is NULL.
+  * @retval STM32_UTILS_SPI_Q_ERROR         The SPI callbacks could not be registered.
+  */
+stm32_utils_spi_q_status_t STM32_UTILS_SPI_Q_Init(stm32_utils_spi_q_t *p_q, hal_spi_handle_t *hspi)
+{
+  uint32_t primask_bit;
+
+  if ((p_q == NULL) || (hspi == NULL))
+  {
+    return STM32_UTILS_SPI_Q_INVALID_PARAM;
+  }
+
+#if defined(USE_HAL_SPI_REGISTER_CALLBACKS) && (USE_HAL_SPI_REGISTER_CALLBACKS == 1)
+  if ((HAL_SPI_RegisterTxCpltCallback(hspi, STM32_UTILS_SPI_Q_XferCpltCallback) != HAL_OK)
+      || (HAL_SPI_RegisterRxCpltCallback(hspi, STM32_UTILS_SPI_Q_XferCpltCallback) != HAL_OK)
+      || (HAL_SPI_RegisterTxRxCpltCallback(hspi, STM32_UTILS_SPI_Q_XferCpltCallback) != HAL_OK)
+      || (HAL_SPI_RegisterErrorCallback(hspi, STM32_UTILS_SPI_Q_ErrorCallback) != HAL_OK))
+  {
+    return STM32_UTILS_SPI_Q_ERROR;
+  }
+#endif /* USE_HAL_SPI_REGISTER_CALLBACKS */
+
+  p_q->hspi      = hspi;
+  p_q->p_head    = NULL;
+  p_q->p_tail    = NULL;
+  p_q->p_active  = NULL;
+  p_q->p_cs_dev  = NULL;
+  p_q->p_cfg_dev = NULL;
+
+  /* Bus parameters set by HAL_SPI_SetConfig(), the first device only changes the ones it needs */
+  SPI_Q_ReadConfig(p_q);
+
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  if (SPI_Q_Find(hspi) == NULL)
+  {
+    p_q->p_next = p_spi_q_list;
+    p_spi_q_list = p_q;
+  }
+  __set_PRIMASK(primask_bit);
+
+  return STM32_UTILS_SPI_Q_OK;
+}
+
+/**
+  * @brief  Initialize a device of a SPI bus and clear its statistics.
+  * @param  p_device  Pointer to the device, allocated by the application.
+  * @param  p_config  Bus parameters of the device.
+  * @param  cs_port   GPIO port of the chip select.
+  * @param  cs_pin    GPIO pin of the chip select, 0 when the device uses the SPI NSS output.
+  * @param  cs_active Level of the chip select selecting the device.
+  * @note   The chip select is driven to its inactive level.
+  * @retval STM32_UTILS_SPI_Q_OK            The device is ready.
+  * @retval STM32_UTILS_SPI_Q_INVALID_PARAM A pointer is NULL.
+  */
+stm32_utils_spi_q_status_t STM32_UTILS_SPI_Q_InitDevice(stm32_utils_spi_q_device_t *p_device,
+                                                        const stm32_utils_spi_q_device_config_t *p_config,
+                                                        hal_gpio_t cs_port, uint32_t cs_pin,
+                                                        hal_gpio_pin_state_t cs_active)
+{
+  if ((p_device == NULL) || (p_config == NULL))
+  {
+    return STM32_UTILS_SPI_Q_INVALID_PARAM;
+  }
+
+  p_device->config    = *p_config;
+  p_device->cs_port   = cs_port;
+  p_device->cs_pin    = cs_pin;
+  p_device->cs_active = cs_active;
+  STM32_UTILS_SPI_Q_ResetDeviceStats(p_device);
+
+  SPI_Q_CsWrite(p_device, 0U);
+
+  return STM32_UTILS_SPI_Q_OK;
+}
+
+/**
+  * @brief  Queue a transaction, started at once when the bus is free.
+  * @param  p_q    Pointer to the queue of the SPI bus.
+  * @param  p_xfer Pointer to the transaction descriptor.
+  * @note   Can be called from a completion callback to chain a transaction, or from any interrupt of a
+  *         priority not higher than the SPI and DMA ones.
+  * @retval STM32_UTILS_SPI_Q_OK            The transaction is queued, or already completed with error when it could
+  *                                         not be started: see its status.
+  * @retval STM32_UTILS_SPI_Q_INVALID_PARAM A pointer is NULL, there is no buffer or no packet.
+  * @retval STM32_UTILS_SPI_Q_BUSY          The descriptor is already queued.
+  */
+stm32_utils_spi_q_status_t STM32_UTILS_SPI_Q_Submit(stm32_utils_spi_q_t *p_q, stm32_utils_spi_q_xfer_t *p_xfer)
+{
+  uint32_t primask_bit;
+
+  if ((p_q == NULL) || (p_xfer == NULL) || (p_xfer->p_device == NULL) || (p_xfer->count_packet == 0U)
+      || ((p_xfer->p_tx_data == NULL) && (p_xfer->p_rx_data == NULL)))
+  {
+    return STM32_UTILS_SPI_Q_INVALID_PARAM;
+  }
+
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  if (p_xfer->status == STM32_UTILS_SPI_Q_BUSY)
+  {
+    __set_PRIMASK(primask_bit);
+    return STM32_UTILS_SPI_Q_BUSY;
+  }
+  p_xfer->status = STM32_UTILS_SPI_Q_BUSY;
+  p_xfer->p_next = NULL;
+  if (p_q->p_tail == NULL)
+  {
+    p_q->p_head = p_xfer;
+  }
+  else
+  {
+    p_q->p_tail->p_next = p_xfer;
+  }
+  p_q->p_tail = p_xfer;
+  __set_PRIMASK(primask_bit);
+
+  SPI_Q_StartNext(p_q);
+
+  return STM32_UTILS_SPI_Q_OK;
+}
+
+/**
+  * @brief  Return the number of transactions queued, including the one in progress.
+  * @param  p_q Pointer to the queue of the SPI bus.
+  * @retval uint32_t Number of transactions.
+  */
+uint32_t STM32_UTILS_SPI_Q_GetCount(const stm32_utils_spi_q_t *p_q)
+{
+  const stm32_utils_spi_q_xfer_t *p_xfer;
+  uint32_t count;
+  uint32_t primask_bit;
+
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  count = (p_q->p_active != NULL) ? 1U : 0U;
+  for (p_xfer = p_q->p_head; p_xfer != NULL; p_xfer = p_xfer->p_next)
+  {
+    count++;
+  }
+  __set_PRIMASK(primask_bit);
+
+  return count;
+}
+
+/**
+  * @brief  Return the statistics of a device.
+  * @param  p_device Pointer to the device.
+  * @param  p_stats  Pointer to the statistics filled.
+  */
+void STM32_UTILS_SPI_Q_GetDeviceStats(const stm32_utils_spi_q_device_t *p_device, stm32_utils_spi_q_stats_t *p_stats)
+{
+  uint32_t primask_bit;
+
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  *p_stats = p_device->stats;
+  __set_PRIMASK(primask_bit);
+}
+
+/**
+  * @brief  Clear the statistics of a device.
+  * @param  p_device Pointer to the device.
+  */
+void STM32_UTILS_SPI_Q_ResetDeviceStats(stm32_utils_spi_q_device_t *p_device)
+{
+  uint32_t primask_bit;
+
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+  p_device->stats.xfer_count     = 0U;
+  p_device->stats.packet_count   = 0U;
+  p_device->stats.error_count    = 0U;
+  p_device->stats.reconfig_count = 0U;
+  __set_PRIMASK(primask_bit);
+}
+
+/**
+  * @brief  End the transaction in progress and start the next one.
+  * @param  hspi Pointer to the SPI handle.
+  * @note   Registered as the SPI Tx, Rx and TxRx complete callback with USE_HAL_SPI_REGISTER_CALLBACKS,
+  *         otherwise to be called from HAL_SPI_TxCpltCallback(), HAL_SPI_RxCpltCallback() and
+  *         HAL_SPI_TxRxCpltCallback(). Does nothing for a SPI handle without queue.
+  */
+void STM32_UTILS_SPI_Q_XferCpltCallback(hal_spi_handle_t *hspi)
+{
+  stm32_utils_spi_q_t *p_q = SPI_Q_Find(hspi);
+
+  if ((p_q != NULL) && (p_q->p_active != NULL))
+  {
+    SPI_Q_End(p_q, STM32_UTILS_SPI_Q_OK);
+    SPI_Q_StartNext(p_q);
+  }
+}
+
+/**
+  * @brief  End the transaction in progress with error and start the next one.
+  * @param  hspi Pointer to the SPI handle.
+  * @note   Registered as the SPI error callback with USE_HAL_SPI_REGISTER_CALLBACKS, otherwise to be called from
+  *         HAL_SPI_ErrorCallback(). Does nothing for a SPI handle without queue.
+  */
+void STM32_UTILS_SPI_Q_ErrorCallback(hal_spi_handle_t *hspi)
+{
+  stm32_utils_spi_q_t *p_q = SPI_Q_Find(hspi);
+
+  if ((p_q != NULL) && (p_q->p_active != NULL))
+  {
+    SPI_Q_End(p_q, STM32_UTILS_SPI_Q_ERROR);
+    SPI_Q_StartNext(p_q);
+  }
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup SPI_Q_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Find the queue of a SPI handle.
+  * @param  hspi Pointer to the SPI handle.
+  * @retval Pointer to the queue, NULL when the handle has none.
+  */
+static stm32_utils_spi_q_t *SPI_Q_Find(const hal_spi_handle_t *hspi)
+{
+  stm32_utils_spi_q_t *p_q = p_spi_q_list;
+
+  while ((p_q != NULL) && (p_q->hspi != hspi))
+  {
+    p_q = p_q->p_next;
+  }
+
+  return p_q;
+}
+
+/**
+  * @brief  Read the bus parameters in use from the SPI.
+  * @param  p_q Pointer to the queue of the SPI bus.
+  */
+static void SPI_Q_ReadConfig(stm32_utils_spi_q_t *p_q)
+{
+  p_q->cfg.clock_polarity      = HAL_SPI_GetClockPolarity(p_q->hspi);
+  p_q->cfg.clock_phase         = HAL_SPI_GetClockPhase(p_q->hspi);
+  p_q->cfg.baud_rate_prescaler = HAL_SPI_GetBaudRatePrescaler(p_q->hspi);
+  p_q->cfg.first_bit           = HAL_SPI_GetFirstBit(p_q->hspi);
+  p_q->cfg.data_width          = HAL_SPI_GetDataWidth(p_q->hspi);
+}
+
+/**
+  * @brief  Set the bus parameters of a device, only the ones differing from the parameters in use.
+  * @param  p_q      Pointer to the queue of the SPI bus.
+  * @param  p_device Pointer to the device.
+  * @retval HAL_OK    The bus is configured for the device.
+  * @retval HAL_ERROR The SPI configuration is locked.
+  */
+static hal_status_t SPI_Q_Configure(stm32_utils_spi_q_t *p_q, stm32_utils_spi_q_device_t *p_device)
+{
+  const stm32_utils_spi_q_device_config_t *p_config = &p_device->config;
+  hal_status_t status = HAL_OK;
+  uint32_t changed = 0U;
+
+  /* Consecutive transactions of the same device */
+  if (p_q->p_cfg_dev == p_device)
+  {
+    return HAL_OK;
+  }
+
+  if (p_q->cfg.clock_polarity != p_config->clock_polarity)
+  {
+    status = HAL_SPI_SetClockPolarity(p_q->hspi, p_config->clock_polarity);
+    changed = 1U;
+  }
+  if ((status == HAL_OK) && (p_q->cfg.clock_phase != p_config->clock_phase))
+  {
+    status = HAL_SPI_SetClockPhase(p_q->hspi, p_config->clock_phase);
+    changed = 1U;
+  }
+  if ((status == HAL_OK) && (p_q->cfg.baud_rate_prescaler != p_config->baud_rate_prescaler))
+  {
+    status = HAL_SPI_SetBaudRatePrescaler(p_q->hspi, p_config->baud_rate_prescaler);
+    changed = 1U;
+  }
+  if ((status == HAL_OK) && (p_q->cfg.first_bit != p_config->first_bit))
+  {
+    status = HAL_SPI_SetFirstBit(p_q->hspi, p_config->first_bit);
+    changed = 1U;
+  }
+  if ((status == HAL_OK) && (p_q->cfg.data_width != p_config->data_width))
+  {
+    status = HAL_SPI_SetDataWidth(p_q->hspi, p_config->data_width);
+    changed = 1U;
+  }
+
+  if (status != HAL_OK)
+  {
+    /* Parameters partially applied: the ones in use are read back and compared again on the next transaction */
+    SPI_Q_ReadConfig(p_q);
+    p_q->p_cfg_dev = NULL;
+    return status;
+  }
+
+  if (changed != 0U)
+  {
+    p_q->cfg = *p_config;
+    p_device->stats.reconfig_count++;
+  }
+  p_q->p_cfg_dev = p_device;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Start a transaction: chip select, bus parameters and DMA transfer.
+  * @param  p_q    Pointer to the queue of the SPI bus.
+  * @param  p_xfer Pointer to the transaction.
+  * @retval HAL_OK The transfer is started, otherwise the status of the SPI HAL.
+  */
+static hal_status_t SPI_Q_Start(stm32_utils_spi_q_t *p_q, stm32_utils_spi_q_xfer_t *p_xfer)
+{
+  stm32_utils_spi_q_device_t *p_device = p_xfer->p_device;
+  hal_status_t status;
+
+  /* Chip select held by a previous transaction of another device */
+  if ((p_q->p_cs_dev != NULL) && (p_q->p_cs_dev != p_device))
+  {
+    SPI_Q_CsWrite(p_q->p_cs_dev, 0U);
+    p_q->p_cs_dev = NULL;
+  }
+
+  status = SPI_Q_Configure(p_q, p_device);
+  if (status != HAL_OK)
+  {
+    return status;
+  }
+
+  if (p_q->p_cs_dev == NULL)
+  {
+    SPI_Q_CsWrite(p_device, 1U);
+    p_q->p_cs_dev = p_device;
+  }
+
+  if (p_xfer->p_rx_data == NULL)
+  {
+    status = HAL_SPI_Transmit_DMA(p_q->hspi, p_xfer->p_tx_data, p_xfer->count_packet);
+  }
+  else if (p_xfer->p_tx_data == NULL)
+  {
+    status = HAL_SPI_Receive_DMA(p_q->hspi, p_xfer->p_rx_data, p_xfer->count_packet);
+  }
+  else
+  {
+    status = HAL_SPI_TransmitReceive_DMA(p_q->hspi, p_xfer->p_tx_data, p_xfer->p_rx_data, p_xfer->count_packet);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  End the transaction in progress: chip select, statistics and completion callback.
+  * @param  p_q    Pointer to the queue of the SPI bus.
+  * @param  status Result of the transaction.
+  */
+static void SPI_Q_End(stm32_utils_spi_q_t *p_q, stm32_utils_spi_q_status_t status)
+{
+  stm32_utils_spi_q_xfer_t *p_xfer = p_q->p_active;
+  stm32_utils_spi_q_device_t *p_device = p_xfer->p_device;
+
+  if ((status != STM32_UTILS_SPI_Q_OK) || ((p_xfer->flags & STM32_UTILS_SPI_Q_FLAG_CS_HOLD) == 0U))
+  {
+    if (p_q->p_cs_dev != NULL)
+    {
+      SPI_Q_CsWrite(p_q->p_cs_dev, 0U);
+      p_q->p_cs_dev = NULL;
+    }
+  }
+
+  if (status == STM32_UTILS_SPI_Q_OK)
+  {
+    p_device->stats.xfer_count++;
+    p_device->stats.packet_count += p_xfer->count_packet;
+  }
+  else
+  {
+    p_device->stats.error_count++;
+  }
+
+  p_q->p_active = NULL;
+  p_xfer->status = status;
+
+  if (p_xfer->p_xfer_cb != NULL)
+  {
+    p_xfer->p_xfer_cb(p_xfer);
+  }
+}
+
+/**
+  * @brief  Start the queued transactions while the bus is free.
+  * @param  p_q Pointer to the queue of the SPI bus.
+  * @note   A transaction which cannot be started is ended with error and the next one is tried.
+  */
+static void SPI_Q_StartNext(stm32_utils_spi_q_t *p_q)
+{
+  stm32_utils_spi_q_xfer_t *p_xfer;
+  uint32_t primask_bit;
+
+  for (;;)
+  {
+    /* Claim the bus, a transaction already in progress starts the next one when it completes */
+    primask_bit = __get_PRIMASK();
+    __set_PRIMASK(1);
+    p_xfer = NULL;
+    if (p_q->p_active == NULL)
+    {
+      p_xfer = p_q->p_head;
+      if (p_xfer != NULL)
+      {
+        p_q->p_head = p_xfer->p_next;
+        if (p_q->p_head == NULL)
+        {
+          p_q->p_tail = NULL;
+        }
+        p_q->p_active = p_xfer;
+      }
+    }
+    __set_PRIMASK(primask_bit);
+
+    if (p_xfer == NULL)
+    {
+      break;
+    }
+
+    if (SPI_Q_Start(p_q, p_xfer) == HAL_OK)
+    {
+      break;
+    }
+
+    SPI_Q_End(p_q, STM32_UTILS_SPI_Q_ERROR);
+  }
+}
+
+/**
+  * @brief  Drive the chip select of a device.
+  * @param  p_device Pointer to the device.
+  * @param  active   1 to select the device, 0 to release it.
+  */
+static void SPI_Q_CsWrite(const stm32_utils_spi_q_device_t *p_device, uint32_t active)
+{
+  hal_gpio_pin_state_t state = p_device->cs_active;
+
+  if (p_device->cs_pin == 0U)
+  {
+    return;
+  }
+
+  if (active == 0U)
+  {
+    state = (state == HAL_GPIO_PIN_SET) ? HAL_GPIO_PIN_RESET : HAL_GPIO_PIN_SET;
+  }
+
+  HAL_GPIO_WritePin(p_device->cs_port, p_device->cs_pin, state);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* USE_HAL_SPI_MODULE && USE_HAL_SPI_DMA */
@@ -0,0 +1,197 @@
+/**
+  **********************************************************************************************************************
+  * @file    stm32_utils_spi_q.h
+  * @brief   Header file of UTILS SPI transaction queue module.
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -----------------------------------------------------------------------------*/
+#ifndef STM32_UTILS_SPI_Q_H
+#define STM32_UTILS_SPI_Q_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32_hal.h"
+#include <stdint.h>
+
+#if defined(USE_HAL_SPI_MODULE) && (USE_HAL_SPI_MODULE == 1U) && defined(USE_HAL_SPI_DMA) && (USE_HAL_SPI_DMA == 1U)
+
+/** @addtogroup STM32_UTILS
+  * @{
+  */
+
+/** @addtogroup SPI_Q
+  * @{
+  */
+
+/* Exported constants --------------------------------------------------------*/
+/** @defgroup SPI_Q_Exported_Constants SPI_Q Exported Constants
+  * @{
+  */
+
+/** @defgroup SPI_Q_Xfer_Flags SPI_Q transaction flags
+  * @{
+  */
+#define STM32_UTILS_SPI_Q_FLAG_NONE    0x00000000U  /*!< Chip select released at the end of the transaction       */
+#define STM32_UTILS_SPI_Q_FLAG_CS_HOLD 0x00000001U  /*!< Chip select kept active until the next transaction starts,
+                                                         so that a command and its data phase are seen as one
+                                                         frame by the device. It is released before selecting
+                                                         another device.                                          */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Exported types ------------------------------------------------------------*/
+/** @defgroup SPI_Q_Exported_Types SPI_Q Exported Types
+  * @{
+  */
+
+/**
+  * @brief  SPI_Q Utils Status structures definition
+  */
+typedef enum
+{
+  STM32_UTILS_SPI_Q_OK            = 0x00000000U, /*!< Utils SPI_Q operation completed successfully */
+  STM32_UTILS_SPI_Q_ERROR         = 0xFFFFFFFFU, /*!< Utils SPI_Q operation completed with error   */
+  STM32_UTILS_SPI_Q_INVALID_PARAM = 0xAAAAAAAAU, /*!< Utils SPI_Q invalid parameter                */
+  STM32_UTILS_SPI_Q_BUSY          = 0x55555555U, /*!< Utils SPI_Q transaction pending or ongoing   */
+} stm32_utils_spi_q_status_t;
+
+/**
+  * @brief  SPI_Q device bus parameters, compared to the ones in use before each transaction.
+  */
+typedef struct
+{
+  hal_spi_clock_polarity_t      clock_polarity;      /*!< Serial clock steady state         */
+  hal_spi_clock_phase_t         clock_phase;         /*!< Clock active edge for bit capture */
+  hal_spi_baud_rate_prescaler_t baud_rate_prescaler; /*!< SCK prescaler                     */
+  hal_spi_first_bit_t           first_bit;           /*!< MSB or LSB first                  */
+  hal_spi_data_width_t          data_width;          /*!< Data width of a packet            */
+} stm32_utils_spi_q_device_config_t;
+
+/**
+  * @brief  SPI_Q per-device statistics
+  */
+typedef struct
+{
+  uint32_t xfer_count;     /*!< Number of transactions completed successfully                      */
+  uint32_t packet_count;   /*!< Number of packets exchanged by the transactions completed          */
+  uint32_t error_count;    /*!< Number of transactions completed with error                        */
+  uint32_t reconfig_count; /*!< Number of times the bus parameters had to be changed for the device */
+} stm32_utils_spi_q_stats_t;
+
+/**
+  * @brief  SPI_Q device, allocated by the application and shared by all its transactions.
+  */
+typedef struct
+{
+  stm32_utils_spi_q_device_config_t config; /*!< Bus parameters of the device                               */
+  hal_gpio_t                cs_port;        /*!< GPIO port of the chip select                               */
+  uint32_t                  cs_pin;         /*!< GPIO pin of the chip select, 0 when the device is selected
+                                                 by the SPI NSS output                                      */
+  hal_gpio_pin_state_t      cs_active;      /*!< Level of the chip select when the device is selected       */
+  stm32_utils_spi_q_stats_t stats;          /*!< Statistics, private: use STM32_UTILS_SPI_Q_GetDeviceStats() */
+} stm32_utils_spi_q_device_t;
+
+typedef struct stm32_utils_spi_q_xfer_s stm32_utils_spi_q_xfer_t;
+
+/**
+  * @brief  SPI_Q transaction completion callback, called in the SPI or DMA interrupt context.
+  */
+typedef void (*stm32_utils_spi_q_xfer_cb_t)(stm32_utils_spi_q_xfer_t *p_xfer);
+
+/**
+  * @brief  SPI_Q transaction descriptor, prepared by the application.
+  *
+  * The descriptor and its buffers belong to the queue from STM32_UTILS_SPI_Q_Submit() until its callback is called,
+  * it can then be submitted again as is. It must be zero-initialized before its first submission.
+  */
+struct stm32_utils_spi_q_xfer_s
+{
+  stm32_utils_spi_q_device_t *p_device;      /*!< Target device                                             */
+  const void                 *p_tx_data;     /*!< Data to send, NULL for a receive only transaction         */
+  void                       *p_rx_data;     /*!< Data received, NULL for a transmit only transaction       */
+  uint32_t                   count_packet;   /*!< Number of packets of the device data width                */
+  uint32_t                   flags;          /*!< Combination of @ref SPI_Q_Xfer_Flags                      */
+  stm32_utils_spi_q_xfer_cb_t p_xfer_cb;     /*!< Completion callback, can be NULL                          */
+  void                       *p_user_data;   /*!< Application context, not used by the queue                */
+  volatile stm32_utils_spi_q_status_t status; /*!< BUSY while queued, then the result of the transaction    */
+  stm32_utils_spi_q_xfer_t   *p_next;        /*!< Private, next queued transaction                          */
+};
+
+/**
+  * @brief  SPI_Q transaction queue of one SPI bus, allocated by the application.
+  *
+  * The fields are private to the queue service.
+  */
+typedef struct stm32_utils_spi_q_s
+{
+  hal_spi_handle_t                  *hspi;       /*!< SPI bus, master with Tx and Rx DMA channels set    */
+  stm32_utils_spi_q_xfer_t          *p_head;     /*!< First transaction waiting for the bus              */
+  stm32_utils_spi_q_xfer_t          *p_tail;     /*!< Last transaction waiting for the bus               */
+  stm32_utils_spi_q_xfer_t *volatile p_active;   /*!< Transaction in progress                            */
+  stm32_utils_spi_q_device_t        *p_cs_dev;   /*!< Device whose chip select is active                 */
+  const stm32_utils_spi_q_device_t  *p_cfg_dev;  /*!< Device the bus parameters were last set for        */
+  stm32_utils_spi_q_device_config_t cfg;         /*!< Bus parameters in use                              */
+  struct stm32_utils_spi_q_s        *p_next;     /*!< Next queue, to find the queue of a SPI handle      */
+} stm32_utils_spi_q_t;
+
+/**
+  * @}
+  */
+
+/* Exported functions ------------------------------------------------------------------------------------------------*/
+/** @addtogroup SPI_Q_Exported_Functions
+  * @{
+  */
+stm32_utils_spi_q_status_t STM32_UTILS_SPI_Q_Init(stm32_utils_spi_q_t *p_q, hal_spi_handle_t *hspi);
+stm32_utils_spi_q_status_t STM32_UTILS_SPI_Q_InitDevice(stm32_utils_spi_q_device_t *p_device,
+                                                        const stm32_utils_spi_q_device_config_t *p_config,
+                                                        hal_gpio_t cs_port, uint32_t cs_pin,
+                                                        hal_gpio_pin_state_t cs_active);
+stm32_utils_spi_q_status_t STM32_UTILS_SPI_Q_Submit(stm32_utils_spi_q_t *p_q, stm32_utils_spi_q_xfer_t *p_xfer);
+uint32_t STM32_UTILS_SPI_Q_GetCount(const stm32_utils_spi_q_t *p_q);
+void STM32_UTILS_SPI_Q_GetDeviceStats(const stm32_utils_spi_q_device_t *p_device, stm32_utils_spi_q_stats_t *p_stats);
+void STM32_UTILS_SPI_Q_ResetDeviceStats(stm32_utils_spi_q_device_t *p_device);
+
+/* To be called from HAL_SPI_TxCpltCallback, HAL_SPI_RxCpltCallback, HAL_SPI_TxRxCpltCallback and
+   HAL_SPI_ErrorCallback when USE_HAL_SPI_REGISTER_CALLBACKS is not set */
+void STM32_UTILS_SPI_Q_XferCpltCallback(hal_spi_handle_t *hspi);
+void STM32_UTILS_SPI_Q_ErrorCallback(hal_spi_handle_t *hspi);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* USE_HAL_SPI_MODULE && USE_HAL_SPI_DMA */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32_UTILS_SPI_Q_H */
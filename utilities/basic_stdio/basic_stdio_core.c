@@ -18,27 +18,396 @@
 /* Includes ------------------------------------------------------------------*/
 #include "basic_stdio_core.h"
 #include "basic_stdio_itf_io.h"
+#include "basic_stdio_log.h"
+
+#if (BASIC_STDIO_BUFFERED == 1U)
+#include <string.h>
+#endif /* BASIC_STDIO_BUFFERED */
 
 /* Private defines -----------------------------------------------------------*/
+#if (BASIC_STDIO_BUFFERED == 1U)
+#if ((BASIC_STDIO_BUFFER_SIZE & (BASIC_STDIO_BUFFER_SIZE - 1U)) != 0U)
+#error "BASIC_STDIO_BUFFER_SIZE must be a power of 2"
+#endif /* BASIC_STDIO_BUFFER_SIZE */
+
+/* Largest transfer of interface_io_Send_Async() */
+#define BASIC_STDIO_MAX_TRANSFER  0xFFFFU
+#endif /* BASIC_STDIO_BUFFERED */
+
 /* Private macros ------------------------------------------------------------*/
+#if (BASIC_STDIO_BUFFERED == 1U)
+#if defined(BASIC_STDIO_HOST)
+/* host stand-in: no interrupt, the transfers are completed by the test code */
+#ifndef BASIC_STDIO_ENTER_CRITICAL_SECTION
+#define BASIC_STDIO_ENTER_CRITICAL_SECTION()
+#endif /* BASIC_STDIO_ENTER_CRITICAL_SECTION */
+#ifndef BASIC_STDIO_EXIT_CRITICAL_SECTION
+#define BASIC_STDIO_EXIT_CRITICAL_SECTION()
+#endif /* BASIC_STDIO_EXIT_CRITICAL_SECTION */
+#ifndef BASIC_STDIO_DMB
+#define BASIC_STDIO_DMB()                     __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#endif /* BASIC_STDIO_DMB */
+#ifndef BASIC_STDIO_IN_ISR
+#define BASIC_STDIO_IN_ISR()                  (0 != 0)
+#endif /* BASIC_STDIO_IN_ISR */
+#ifndef BASIC_STDIO_GET_TICK
+#define BASIC_STDIO_GET_TICK()                interface_io_host_GetTick()
+#endif /* BASIC_STDIO_GET_TICK */
+#endif /* BASIC_STDIO_HOST */
+
+#ifndef BASIC_STDIO_ENTER_CRITICAL_SECTION
+#define BASIC_STDIO_ENTER_CRITICAL_SECTION()  uint32_t primask_bit = __get_PRIMASK(); \
+  __disable_irq()
+#endif /* BASIC_STDIO_ENTER_CRITICAL_SECTION */
+
+#ifndef BASIC_STDIO_EXIT_CRITICAL_SECTION
+#define BASIC_STDIO_EXIT_CRITICAL_SECTION()   __set_PRIMASK(primask_bit)
+#endif /* BASIC_STDIO_EXIT_CRITICAL_SECTION */
+
+#ifndef BASIC_STDIO_DMB
+#define BASIC_STDIO_DMB()                     __DMB()
+#endif /* BASIC_STDIO_DMB */
+
+/* The completion interrupt cannot come: called from an interrupt handler or with the interrupts masked */
+#ifndef BASIC_STDIO_IN_ISR
+#define BASIC_STDIO_IN_ISR()                  ((__get_IPSR() != 0U) || (__get_PRIMASK() != 0U))
+#endif /* BASIC_STDIO_IN_ISR */
+
+#ifndef BASIC_STDIO_GET_TICK
+#define BASIC_STDIO_GET_TICK()                HAL_GetTick()
+#endif /* BASIC_STDIO_GET_TICK */
+#endif /* BASIC_STDIO_BUFFERED */
+
 /* Private typedef -----------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 void *io_interface_Object = NULL;
+
+#if (BASIC_STDIO_BUFFERED == 1U)
+/*
+ * Ring buffer of the buffered mode, indexes are free running:
+ * - [buffer_done, buffer_tail[ is being transmitted,
+ * - [buffer_tail, buffer_head[ is pending.
+ * buffer_head is written by the writer only, without critical section.
+ * buffer_tail and buffer_done are written in critical section, by the transmission or by the overwrite policy.
+ */
+static uint8_t buffer_data[BASIC_STDIO_BUFFER_SIZE];
+static volatile uint32_t buffer_head;
+static volatile uint32_t buffer_tail;
+static volatile uint32_t buffer_done;
+static volatile uint32_t buffer_busy;
+static volatile uint32_t buffer_dropped;
+#endif /* BASIC_STDIO_BUFFERED */
+
 /* Private function prototypes -----------------------------------------------*/
+#if (BASIC_STDIO_BUFFERED == 1U)
+static void buffer_start(void);
+static void buffer_kick(void);
+static uint32_t buffer_wait(uint32_t *p_done, uint32_t *p_start);
+static uint32_t buffer_write(const uint8_t *ptr, uint32_t len, uint32_t whole);
+#if (BASIC_STDIO_OVERFLOW_POLICY == BASIC_STDIO_OVERFLOW_OVERWRITE)
+static uint32_t buffer_discard(uint32_t head, uint32_t count, uint32_t whole);
+#endif /* BASIC_STDIO_OVERFLOW_POLICY */
+#endif /* BASIC_STDIO_BUFFERED */
+
 /* Functions Definition ------------------------------------------------------*/
 
 void UTIL_BASIC_STDIO_Init(void *pobj)
 {
   /* keep object value */
   io_interface_Object = pobj;
+#if (BASIC_STDIO_BUFFERED == 1U)
+  buffer_head = 0U;
+  buffer_tail = 0U;
+  buffer_done = 0U;
+  buffer_busy = 0U;
+  buffer_dropped = 0U;
+#endif /* BASIC_STDIO_BUFFERED */
   interface_io_Init(io_interface_Object);
 }
 
+void UTIL_BASIC_STDIO_LogWrite(const uint32_t *p_record, uint32_t word_nbr)
+{
+  /* the record is at most 36 bytes, it is sent in one piece */
+#if (BASIC_STDIO_BUFFERED == 1U)
+  /* a truncated record would corrupt the stream: it is written whole or dropped whole */
+  (void)buffer_write((const uint8_t *)p_record, word_nbr * 4U, 1U);
+#else
+  (void)interface_io_Send(io_interface_Object, (const uint8_t *)p_record, (uint16_t)(word_nbr * 4U));
+#endif /* BASIC_STDIO_BUFFERED */
+}
+
+#if (BASIC_STDIO_BUFFERED == 1U)
+uint32_t UTIL_BASIC_STDIO_Flush(void)
+{
+  uint32_t wait_done = buffer_done;
+  uint32_t wait_start = BASIC_STDIO_GET_TICK();
+
+  buffer_kick();
+  while ((buffer_busy != 0U) || (buffer_tail != buffer_head))
+  {
+    if (BASIC_STDIO_IN_ISR())
+    {
+      break;
+    }
+    /* restart the transmission if the interface was not available, give up if it is stuck */
+    if (buffer_wait(&wait_done, &wait_start) != 0U)
+    {
+      break;
+    }
+  }
+  return (buffer_head - buffer_done);
+}
+
+uint32_t UTIL_BASIC_STDIO_GetDropped(void)
+{
+  return buffer_dropped;
+}
+
+void UTIL_BASIC_STDIO_TxCpltCallback(void)
+{
+  BASIC_STDIO_ENTER_CRITICAL_SECTION();
+  buffer_busy = 0U;
+  buffer_done = buffer_tail;
+  buffer_start();
+  BASIC_STDIO_EXIT_CRITICAL_SECTION();
+}
+
+/* Start the transmission of the pending bytes, contiguous in the ring buffer. Must be called in critical section. */
+static void buffer_start(void)
+{
+  uint32_t tail = buffer_tail;
+  uint32_t offset = tail & (BASIC_STDIO_BUFFER_SIZE - 1U);
+  uint32_t len = buffer_head - tail;
+
+  if ((buffer_busy != 0U) || (len == 0U))
+  {
+    return;
+  }
+  if (len > (BASIC_STDIO_BUFFER_SIZE - offset))
+  {
+    len = BASIC_STDIO_BUFFER_SIZE - offset;
+  }
+  if (len > BASIC_STDIO_MAX_TRANSFER)
+  {
+    len = BASIC_STDIO_MAX_TRANSFER;
+  }
+
+  /* the bytes before tail have been transmitted or discarded */
+  buffer_done = tail;
+  buffer_tail = tail + len;
+  buffer_busy = 1U;
+  if (interface_io_Send_Async(io_interface_Object, &buffer_data[offset], (uint16_t)len) != len)
+  {
+    /* interface not available, retried at the next write or flush */
+    buffer_tail = tail;
+    buffer_busy = 0U;
+  }
+}
+
+/*
+ * Restart the transmission when it is idle, for the loops waiting for it.
+ * Returns 1 when no transfer has completed for BASIC_STDIO_WAIT_TIMEOUT ms: the interface is not available or the
+ * completion interrupt does not come, the caller must stop waiting.
+ */
+static uint32_t buffer_wait(uint32_t *p_done, uint32_t *p_start)
+{
+  uint32_t now = BASIC_STDIO_GET_TICK();
+
+  if (*p_done != buffer_done)
+  {
+    /* progress, the timeout restarts */
+    *p_done = buffer_done;
+    *p_start = now;
+  }
+  else if ((now - *p_start) >= BASIC_STDIO_WAIT_TIMEOUT)
+  {
+    return 1U;
+  }
+  else
+  {
+    /* still waiting */
+  }
+  buffer_kick();
+
+  return 0U;
+}
+
+/* Start the transmission when it is idle */
+static void buffer_kick(void)
+{
+  if (buffer_busy == 0U)
+  {
+    BASIC_STDIO_ENTER_CRITICAL_SECTION();
+    buffer_start();
+    BASIC_STDIO_EXIT_CRITICAL_SECTION();
+  }
+}
+
+#if (BASIC_STDIO_OVERFLOW_POLICY == BASIC_STDIO_OVERFLOW_OVERWRITE)
+/*
+ * Discard up to count of the oldest pending bytes and return the number discarded, the head moves back by as much.
+ * With whole set, nothing is discarded unless count bytes can be.
+ * While a transfer is in flight, the free room is contiguous to the head only: the pending bytes kept are moved
+ * down over the discarded ones, right after the bytes being transmitted. They are hidden from the transmission
+ * during the move, so that the copy is done outside the critical section.
+ */
+static uint32_t buffer_discard(uint32_t head, uint32_t count, uint32_t whole)
+{
+  uint32_t tail;
+  uint32_t discard;
+  uint32_t busy;
+
+  BASIC_STDIO_ENTER_CRITICAL_SECTION();
+  tail = buffer_tail;
+  discard = head - tail;
+  if (discard > count)
+  {
+    discard = count;
+  }
+  else if ((discard < count) && (whole != 0U))
+  {
+    discard = 0U;
+  }
+  else
+  {
+    /* enough pending bytes */
+  }
+  busy = buffer_busy;
+  if (busy == 0U)
+  {
+    /* nothing in flight, the room is freed by moving the start of the pending bytes */
+    buffer_tail = tail + discard;
+    buffer_done = tail + discard;
+  }
+  else if (discard != 0U)
+  {
+    buffer_head = tail;
+  }
+  else
+  {
+    /* nothing to discard */
+  }
+  buffer_dropped += discard;
+  BASIC_STDIO_EXIT_CRITICAL_SECTION();
+
+  if ((busy == 0U) || (discard == 0U))
+  {
+    return discard;
+  }
+
+  /* the source is ahead of the destination, a forward copy is safe */
+  for (uint32_t index = tail; index != (head - discard); index++)
+  {
+    buffer_data[index & (BASIC_STDIO_BUFFER_SIZE - 1U)] =
+      buffer_data[(index + discard) & (BASIC_STDIO_BUFFER_SIZE - 1U)];
+  }
+  BASIC_STDIO_DMB();
+  buffer_head = head - discard;
+
+  return discard;
+}
+#endif /* BASIC_STDIO_OVERFLOW_POLICY */
+
+/* Append bytes to the ring buffer according to the overflow policy, all of them or none when whole is set */
+static uint32_t buffer_write(const uint8_t *ptr, uint32_t len, uint32_t whole)
+{
+  uint32_t head = buffer_head;
+  uint32_t offset;
+  uint32_t room;
+  uint32_t count;
+  uint32_t written = 0U;
+#if (BASIC_STDIO_OVERFLOW_POLICY == BASIC_STDIO_OVERFLOW_BLOCK)
+  uint32_t wait_done = buffer_done;
+  uint32_t wait_start = BASIC_STDIO_GET_TICK();
+#endif /* BASIC_STDIO_OVERFLOW_POLICY */
+
+  while (written < len)
+  {
+    room = BASIC_STDIO_BUFFER_SIZE - (head - buffer_done);
+    count = len - written;
+
+    if (count > room)
+    {
+#if (BASIC_STDIO_OVERFLOW_POLICY == BASIC_STDIO_OVERFLOW_BLOCK)
+      if (((room == 0U) || (whole != 0U)) && !BASIC_STDIO_IN_ISR() && (buffer_wait(&wait_done, &wait_start) == 0U))
+      {
+        /* wait for the transmission to free some room */
+        continue;
+      }
+#elif (BASIC_STDIO_OVERFLOW_POLICY == BASIC_STDIO_OVERFLOW_OVERWRITE)
+      {
+        /* discard the oldest pending bytes, the ones being transmitted are kept */
+        uint32_t discard = buffer_discard(head, count - room, whole);
+
+        head -= discard;
+        room += discard;
+      }
+#endif /* BASIC_STDIO_OVERFLOW_POLICY */
+      if ((count > room) && (whole != 0U))
+      {
+        buffer_dropped += count;
+        break;
+      }
+      if (count > room)
+      {
+#if (BASIC_STDIO_OVERFLOW_POLICY == BASIC_STDIO_OVERFLOW_BLOCK)
+        if ((room != 0U) && !BASIC_STDIO_IN_ISR())
+        {
+          /* write what fits, wait for the rest */
+          count = room;
+        }
+        else
+#endif /* BASIC_STDIO_OVERFLOW_POLICY */
+        {
+          buffer_dropped += count - room;
+#if (BASIC_STDIO_OVERFLOW_POLICY == BASIC_STDIO_OVERFLOW_OVERWRITE)
+          /* the newest bytes are kept */
+          written += count - room;
+#else
+          len = written + room;
+#endif /* BASIC_STDIO_OVERFLOW_POLICY */
+          count = room;
+        }
+      }
+    }
+
+    /* copy, wrapping around the end of the buffer */
+    offset = head & (BASIC_STDIO_BUFFER_SIZE - 1U);
+    if (count > (BASIC_STDIO_BUFFER_SIZE - offset))
+    {
+      (void)memcpy(&buffer_data[offset], &ptr[written], BASIC_STDIO_BUFFER_SIZE - offset);
+      (void)memcpy(&buffer_data[0], &ptr[written + BASIC_STDIO_BUFFER_SIZE - offset],
+                   count - (BASIC_STDIO_BUFFER_SIZE - offset));
+    }
+    else
+    {
+      (void)memcpy(&buffer_data[offset], &ptr[written], count);
+    }
+
+    /* publish the bytes before the transmission can see them */
+    BASIC_STDIO_DMB();
+    head += count;
+    buffer_head = head;
+    written += count;
+
+    buffer_kick();
+  }
+
+  return written;
+}
+#endif /* BASIC_STDIO_BUFFERED */
+
 #if defined(WRITE_PROTO)
 WRITE_PROTO(file, ptr, len)
 {
   (void)(file); /* prevent "unused variable" warnings */
+#if (BASIC_STDIO_BUFFERED == 1U)
+  /* the discarded bytes are reported as written so that the libc does not retry */
+  (void)buffer_write((const uint8_t *)ptr, (uint32_t)len, 0U);
+  return len;
+#else
   return interface_io_Send(io_interface_Object, (const uint8_t *)ptr, len);
+#endif /* BASIC_STDIO_BUFFERED */
 }
 #else
 int fputc(int c, FILE *f)
@@ -46,7 +415,13 @@ int fputc(int c, FILE *f)
   (void)(f); /* prevent "unused variable" warnings */
 
   uint32_t res ;
+#if (BASIC_STDIO_BUFFERED == 1U)
+  uint8_t ch = (uint8_t)c;
+  (void)buffer_write(&ch, 1U, 0U);
+  res = 1U;
+#else
   res = interface_io_Send(io_interface_Object, (const uint8_t *)&c, 1);
+#endif /* BASIC_STDIO_BUFFERED */
   if (res != 1)
   {
     return EOF;
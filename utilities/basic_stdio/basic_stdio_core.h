@@ -28,6 +28,41 @@
 /* Exported types ------------------------------------------------------------*/
 /* External variables --------------------------------------------------------*/
 /* Exported constants --------------------------------------------------------*/
+/** @brief Overflow policies of the buffered mode */
+#define BASIC_STDIO_OVERFLOW_DROP       0U  /*!< the bytes which do not fit are discarded                  */
+#define BASIC_STDIO_OVERFLOW_BLOCK      1U  /*!< the caller waits for free space (drops when in an ISR)     */
+#define BASIC_STDIO_OVERFLOW_OVERWRITE  2U  /*!< the oldest bytes not yet transmitted are discarded          */
+
+/** @def BASIC_STDIO_BUFFERED
+  * @brief Set to 1 to append the output to a ring buffer drained by the asynchronous (DMA) transmission
+  * of the I/O interface, instead of a blocking transmission per call.
+  */
+#ifndef BASIC_STDIO_BUFFERED
+#define BASIC_STDIO_BUFFERED  0U
+#endif /* BASIC_STDIO_BUFFERED */
+
+/** @def BASIC_STDIO_BUFFER_SIZE
+  * @brief Size in bytes of the ring buffer of the buffered mode, must be a power of 2.
+  */
+#ifndef BASIC_STDIO_BUFFER_SIZE
+#define BASIC_STDIO_BUFFER_SIZE  1024U
+#endif /* BASIC_STDIO_BUFFER_SIZE */
+
+/** @def BASIC_STDIO_OVERFLOW_POLICY
+  * @brief Behavior of the buffered mode when the ring buffer is full.
+  */
+#ifndef BASIC_STDIO_OVERFLOW_POLICY
+#define BASIC_STDIO_OVERFLOW_POLICY  BASIC_STDIO_OVERFLOW_DROP
+#endif /* BASIC_STDIO_OVERFLOW_POLICY */
+
+/** @def BASIC_STDIO_WAIT_TIMEOUT
+  * @brief Time in ms after which UTIL_BASIC_STDIO_Flush() and the block policy stop waiting
+  * when no transfer completes, read with BASIC_STDIO_GET_TICK() (HAL_GetTick() by default).
+  */
+#ifndef BASIC_STDIO_WAIT_TIMEOUT
+#define BASIC_STDIO_WAIT_TIMEOUT  1000U
+#endif /* BASIC_STDIO_WAIT_TIMEOUT */
+
 /* Exported macros -----------------------------------------------------------*/
 /** @def WRITE_PROTO
   * @brief __If defined__, expands to the signature of the low-level hook specified by your libc
@@ -105,6 +140,30 @@ extern "C"
   */
 void UTIL_BASIC_STDIO_Init(void *pobj);
 
+#if (BASIC_STDIO_BUFFERED == 1U)
+/** @brief Wait until all the buffered output has been transmitted.
+  *
+  * @note When called from an interrupt or with the interrupts masked, the transmission is only restarted,
+  *       without waiting. The wait stops when no transfer completes for BASIC_STDIO_WAIT_TIMEOUT ms.
+  * @returns number of bytes not yet transmitted, 0 when the buffer is empty
+  */
+uint32_t UTIL_BASIC_STDIO_Flush(void);
+
+/** @brief Number of bytes discarded because the ring buffer was full.
+  * @returns number of bytes since UTIL_BASIC_STDIO_Init()
+  */
+uint32_t UTIL_BASIC_STDIO_GetDropped(void);
+
+/** @brief Transmission complete notification of the buffered mode.
+  *
+  * Called by the I/O interface when the transmission started by interface_io_Send_Async() is done,
+  * the next pending bytes are then transmitted.
+  * The UART interface registers it in the HAL when USE_HAL_UART_REGISTER_CALLBACKS is set,
+  * otherwise the application calls it from HAL_UART_TxCpltCallback().
+  */
+void UTIL_BASIC_STDIO_TxCpltCallback(void);
+#endif /* BASIC_STDIO_BUFFERED */
+
 /*
   If a WRITE_PROTO-based hook is available, it will be implemented
   to redirect stdout to the desired peripheral.
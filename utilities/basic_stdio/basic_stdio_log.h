@@ -0,0 +1,156 @@
+/**
+  ******************************************************************************
+  * @file    basic_stdio_log.h
+  * @brief   deferred (tokenised) logging API of the Basic stdio utility
+  ******************************************************************************
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef BASIC_STDIO_LOG_H
+#define BASIC_STDIO_LOG_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "basic_stdio_core.h"
+
+/* Internal functions ------------------------------------------------------- */
+/* Exported types ------------------------------------------------------------*/
+/* External variables --------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/** @brief First byte of a log record, never found in an UTF-8 text so that records and printf output can be mixed */
+#define BASIC_STDIO_LOG_MARKER    0xF5U
+
+/** @brief Maximum number of arguments of a log call */
+#define BASIC_STDIO_LOG_ARG_MAX   8U
+
+/** @def BASIC_STDIO_LOG_SECTION
+  * @brief Name of the section collecting the format strings.
+  *
+  * The strings are only identified by their offset in the section: their content is never read by the target,
+  * so the section can be placed in an (INFO) or (COPY) output section of the linker script to save flash.
+  * Not in a NOLOAD one: the decoder reads the strings from the ELF file, and NOLOAD sections have no content there.
+  * The name is a C identifier so that GNU ld defines __start_basic_stdio_log.
+  */
+#ifndef BASIC_STDIO_LOG_SECTION
+#define BASIC_STDIO_LOG_SECTION   "basic_stdio_log"
+#endif /* BASIC_STDIO_LOG_SECTION */
+
+/** @def BASIC_STDIO_LOG_SECTION_START
+  * @brief Start address of the section collecting the format strings.
+  */
+#ifndef BASIC_STDIO_LOG_SECTION_START
+#define BASIC_STDIO_LOG_SECTION_START  __start_basic_stdio_log
+extern const char __start_basic_stdio_log[];
+#endif /* BASIC_STDIO_LOG_SECTION_START */
+
+/* Exported macros -----------------------------------------------------------*/
+/** @def UTIL_BASIC_STDIO_LOG
+  * @brief Log a format string and up to 8 arguments, without formatting them.
+  *
+  * The record sent is a header word followed by the arguments, each one converted to 32 bits:
+  * - byte 0: @ref BASIC_STDIO_LOG_MARKER,
+  * - byte 1: number of arguments,
+  * - bytes 2-3: offset of the format string in @ref BASIC_STDIO_LOG_SECTION, divided by 4.
+  *
+  * The records are formatted by the host decoder (tools/basic_stdio_log_decoder.py) with the ELF file.
+  * Integer, character and pointer arguments are supported; 64 bit and floating point values are truncated,
+  * and %s prints the address of the string.
+  *
+  * @param ... string literal with the format, followed by the arguments
+  */
+#define UTIL_BASIC_STDIO_LOG(...) \
+  BASIC_STDIO_LOG_CAT(BASIC_STDIO_LOG_, BASIC_STDIO_LOG_NARGS(__VA_ARGS__))(__VA_ARGS__)
+
+/* Private macros, not to be used directly */
+#define BASIC_STDIO_LOG_CAT(a, b)   BASIC_STDIO_LOG_CAT_(a, b)
+#define BASIC_STDIO_LOG_CAT_(a, b)  a##b
+
+#define BASIC_STDIO_LOG_NARGS(...)  BASIC_STDIO_LOG_NARGS_(__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0, 0)
+#define BASIC_STDIO_LOG_NARGS_(fmt, a1, a2, a3, a4, a5, a6, a7, a8, n, ...)  n
+
+#define BASIC_STDIO_LOG_ARG(a)      ((uint32_t)(uintptr_t)(a))
+
+#define BASIC_STDIO_LOG_HEADER(str, n)                                                      \
+  (BASIC_STDIO_LOG_MARKER | ((uint32_t)(n) << 8U)                                           \
+   | ((uint32_t)(((uintptr_t)(str) - (uintptr_t)BASIC_STDIO_LOG_SECTION_START) >> 2U) << 16U))
+
+#define BASIC_STDIO_LOG_STR(fmt) \
+  static const char log_str[] __attribute__((section(BASIC_STDIO_LOG_SECTION), aligned(4), used)) = fmt
+
+#define BASIC_STDIO_LOG_RECORD(fmt, n, ...)                                                   \
+  do {                                                                                        \
+    BASIC_STDIO_LOG_STR(fmt);                                                                 \
+    const uint32_t log_record[(n) + 1U] = { BASIC_STDIO_LOG_HEADER(log_str, n), __VA_ARGS__ }; \
+    UTIL_BASIC_STDIO_LogWrite(log_record, (n) + 1U);                                          \
+  } while (0)
+
+#define BASIC_STDIO_LOG_0(fmt)                                                                \
+  do {                                                                                        \
+    BASIC_STDIO_LOG_STR(fmt);                                                                 \
+    const uint32_t log_record = BASIC_STDIO_LOG_HEADER(log_str, 0U);                          \
+    UTIL_BASIC_STDIO_LogWrite(&log_record, 1U);                                               \
+  } while (0)
+#define BASIC_STDIO_LOG_1(fmt, a1) \
+  BASIC_STDIO_LOG_RECORD(fmt, 1U, BASIC_STDIO_LOG_ARG(a1))
+#define BASIC_STDIO_LOG_2(fmt, a1, a2) \
+  BASIC_STDIO_LOG_RECORD(fmt, 2U, BASIC_STDIO_LOG_ARG(a1), BASIC_STDIO_LOG_ARG(a2))
+#define BASIC_STDIO_LOG_3(fmt, a1, a2, a3) \
+  BASIC_STDIO_LOG_RECORD(fmt, 3U, BASIC_STDIO_LOG_ARG(a1), BASIC_STDIO_LOG_ARG(a2), BASIC_STDIO_LOG_ARG(a3))
+#define BASIC_STDIO_LOG_4(fmt, a1, a2, a3, a4) \
+  BASIC_STDIO_LOG_RECORD(fmt, 4U, BASIC_STDIO_LOG_ARG(a1), BASIC_STDIO_LOG_ARG(a2), BASIC_STDIO_LOG_ARG(a3), \
+                         BASIC_STDIO_LOG_ARG(a4))
+#define BASIC_STDIO_LOG_5(fmt, a1, a2, a3, a4, a5) \
+  BASIC_STDIO_LOG_RECORD(fmt, 5U, BASIC_STDIO_LOG_ARG(a1), BASIC_STDIO_LOG_ARG(a2), BASIC_STDIO_LOG_ARG(a3), \
+                         BASIC_STDIO_LOG_ARG(a4), BASIC_STDIO_LOG_ARG(a5))
+#define BASIC_STDIO_LOG_6(fmt, a1, a2, a3, a4, a5, a6) \
+  BASIC_STDIO_LOG_RECORD(fmt, 6U, BASIC_STDIO_LOG_ARG(a1), BASIC_STDIO_LOG_ARG(a2), BASIC_STDIO_LOG_ARG(a3), \
+                         BASIC_STDIO_LOG_ARG(a4), BASIC_STDIO_LOG_ARG(a5), BASIC_STDIO_LOG_ARG(a6))
+#define BASIC_STDIO_LOG_7(fmt, a1, a2, a3, a4, a5, a6, a7) \
+  BASIC_STDIO_LOG_RECORD(fmt, 7U, BASIC_STDIO_LOG_ARG(a1), BASIC_STDIO_LOG_ARG(a2), BASIC_STDIO_LOG_ARG(a3), \
+                         BASIC_STDIO_LOG_ARG(a4), BASIC_STDIO_LOG_ARG(a5), BASIC_STDIO_LOG_ARG(a6), \
+                         BASIC_STDIO_LOG_ARG(a7))
+#define BASIC_STDIO_LOG_8(fmt, a1, a2, a3, a4, a5, a6, a7, a8) \
+  BASIC_STDIO_LOG_RECORD(fmt, 8U, BASIC_STDIO_LOG_ARG(a1), BASIC_STDIO_LOG_ARG(a2), BASIC_STDIO_LOG_ARG(a3), \
+                         BASIC_STDIO_LOG_ARG(a4), BASIC_STDIO_LOG_ARG(a5), BASIC_STDIO_LOG_ARG(a6), \
+                         BASIC_STDIO_LOG_ARG(a7), BASIC_STDIO_LOG_ARG(a8))
+
+/* Exported functions --------------------------------------------------------*/
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+/**
+  * @defgroup Basicstdio_Log_API
+  * @{
+  */
+
+/** @brief Write a log record built by @ref UTIL_BASIC_STDIO_LOG to the I/O interface.
+  *
+  * The record goes to the ring buffer in buffered mode, so that it keeps its order with the printf output,
+  * otherwise it is sent by interface_io_Send().
+  *
+  * @param p_record header word followed by the arguments
+  * @param word_nbr number of words of the record
+  */
+void UTIL_BASIC_STDIO_LogWrite(const uint32_t *p_record, uint32_t word_nbr);
+
+/**
+  * }@
+  */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* BASIC_STDIO_LOG_H */
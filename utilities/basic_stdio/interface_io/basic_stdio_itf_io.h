@@ -20,7 +20,11 @@
 #define BASIC_STDIO_ITF_IO_H
 
 /* Includes ------------------------------------------------------------------*/
+#if defined(BASIC_STDIO_HOST)
+#include <stdint.h>
+#else
 #include "stm32_hal.h"
+#endif /* BASIC_STDIO_HOST */
 /* Internal functions ------------------------------------------------------- */
 /* Exported types ------------------------------------------------------------*/
 /* External variables --------------------------------------------------------*/
@@ -52,6 +56,30 @@ void interface_io_Init(void *pObj);
   */
 uint32_t interface_io_Send(void *pObj, const uint8_t *Ptr, uint16_t Size);
 
+/**
+  * @brief interface to start sending data without waiting, used by the buffered mode.
+  *        UTIL_BASIC_STDIO_TxCpltCallback() is called when the transfer is done.
+  * @param pObj pointer on an HAL handle.
+  * @param Ptr  data pointer, kept untouched until the end of the transfer
+  * @param Size number of data to transfer
+  * @retval Size when the transfer is started, 0 otherwise
+  */
+uint32_t interface_io_Send_Async(void *pObj, const uint8_t *Ptr, uint16_t Size);
+
+#if defined(BASIC_STDIO_HOST)
+/**
+  * @brief host stand-in only: completes the transfer started by interface_io_Send_Async(),
+  *        as the DMA interrupt would do, when BASIC_STDIO_HOST_DEFERRED is set.
+  * @retval number of bytes of the completed transfer, 0 if none was pending
+  */
+uint32_t interface_io_host_Complete(void);
+/**
+  * @brief host stand-in only: millisecond tick of the waits of the buffered mode, as HAL_GetTick() on the target.
+  * @retval monotonic time in ms
+  */
+uint32_t interface_io_host_GetTick(void);
+#endif /* BASIC_STDIO_HOST */
+
 /**
   * }@
   */
@@ -0,0 +1,117 @@
+/**
+  ******************************************************************************
+  * @file    basic_stdio_itfio_host.c
+  * @brief   This file contains the interface io functions of the host stand-in,
+  *          used to test the basic stdio utility on a PC.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <time.h>
+#include "basic_stdio_itf_io.h"
+#include "basic_stdio_core.h"
+
+/* Private defines -----------------------------------------------------------*/
+/* Private macros ------------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+
+/*
+ * The object passed to UTIL_BASIC_STDIO_Init() is the FILE to write to, stdout when NULL.
+ */
+static FILE *host_file = NULL;
+
+#if defined(BASIC_STDIO_HOST_DEFERRED)
+/*
+ * Transfer started by interface_io_Send_Async(), written by interface_io_host_Complete().
+ */
+static const uint8_t *host_pending_ptr = NULL;
+static uint16_t host_pending_size = 0U;
+#endif /* BASIC_STDIO_HOST_DEFERRED */
+
+/* Private function prototypes -----------------------------------------------*/
+/* Functions Definition ------------------------------------------------------*/
+
+void interface_io_Init(void *pObj)
+{
+  host_file = (pObj != NULL) ? (FILE *)pObj : stdout;
+#if defined(BASIC_STDIO_HOST_DEFERRED)
+  host_pending_ptr = NULL;
+  host_pending_size = 0U;
+#endif /* BASIC_STDIO_HOST_DEFERRED */
+}
+
+uint32_t interface_io_Send(void *pObj, const uint8_t *Ptr, uint16_t Size)
+{
+  (void)(pObj); /* prevent "unused variable" warnings */
+
+  return (uint32_t)fwrite(Ptr, 1U, Size, host_file);
+}
+
+uint32_t interface_io_Send_Async(void *pObj, const uint8_t *Ptr, uint16_t Size)
+{
+#if defined(BASIC_STDIO_HOST_DEFERRED)
+  (void)(pObj); /* prevent "unused variable" warnings */
+
+  if (host_pending_ptr != NULL)
+  {
+    return 0;
+  }
+  host_pending_ptr = Ptr;
+  host_pending_size = Size;
+  return Size;
+#else
+  uint32_t res;
+
+  /* the transfer is complete on return, as with the ITM */
+  res = interface_io_Send(pObj, Ptr, Size);
+#if (BASIC_STDIO_BUFFERED == 1U)
+  if (res == Size)
+  {
+    UTIL_BASIC_STDIO_TxCpltCallback();
+  }
+#endif /* BASIC_STDIO_BUFFERED */
+  return res;
+#endif /* BASIC_STDIO_HOST_DEFERRED */
+}
+
+uint32_t interface_io_host_Complete(void)
+{
+#if defined(BASIC_STDIO_HOST_DEFERRED)
+  uint32_t res;
+
+  if (host_pending_ptr == NULL)
+  {
+    return 0;
+  }
+  res = interface_io_Send(NULL, host_pending_ptr, host_pending_size);
+  host_pending_ptr = NULL;
+  host_pending_size = 0U;
+#if (BASIC_STDIO_BUFFERED == 1U)
+  UTIL_BASIC_STDIO_TxCpltCallback();
+#endif /* BASIC_STDIO_BUFFERED */
+  return res;
+#else
+  return 0;
+#endif /* BASIC_STDIO_HOST_DEFERRED */
+}
+
+uint32_t interface_io_host_GetTick(void)
+{
+  struct timespec now;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint32_t)((now.tv_sec * 1000) + (now.tv_nsec / 1000000));
+}
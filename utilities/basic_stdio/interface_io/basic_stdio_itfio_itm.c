@@ -17,6 +17,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "basic_stdio_itf_io.h"
+#include "basic_stdio_core.h"
 
 /* Private defines -----------------------------------------------------------*/
 /* Private macros ------------------------------------------------------------*/
@@ -49,4 +50,19 @@ uint32_t interface_io_Send(void *pObj, const uint8_t *Ptr, uint16_t Size)
     ITM_SendChar(Ptr[i]);
   }
   return Size;
-}
\ No newline at end of file
+}
+
+#if (BASIC_STDIO_BUFFERED == 1U)
+uint32_t interface_io_Send_Async(void *pObj, const uint8_t *Ptr, uint16_t Size)
+{
+  uint32_t res;
+
+  /* the ITM has no DMA: the data is sent right away and the transfer is complete on return */
+  res = interface_io_Send(pObj, Ptr, Size);
+  if (res == Size)
+  {
+    UTIL_BASIC_STDIO_TxCpltCallback();
+  }
+  return res;
+}
+#endif /* BASIC_STDIO_BUFFERED */
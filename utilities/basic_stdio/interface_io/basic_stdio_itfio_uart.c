@@ -17,6 +17,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "basic_stdio_itf_io.h"
+#include "basic_stdio_core.h"
 
 /* Private defines -----------------------------------------------------------*/
 /* Private macros ------------------------------------------------------------*/
@@ -28,11 +29,19 @@
  */
 
 /* Private function prototypes -----------------------------------------------*/
+#if (BASIC_STDIO_BUFFERED == 1U) && defined(USE_HAL_UART_REGISTER_CALLBACKS) && (USE_HAL_UART_REGISTER_CALLBACKS == 1)
+static void interface_io_TxCpltCallback(hal_uart_handle_t *huart);
+#endif /* BASIC_STDIO_BUFFERED && USE_HAL_UART_REGISTER_CALLBACKS */
+
 /* Functions Definition ------------------------------------------------------*/
 
 void interface_io_Init(void *pObj)
 {
+#if (BASIC_STDIO_BUFFERED == 1U) && defined(USE_HAL_UART_REGISTER_CALLBACKS) && (USE_HAL_UART_REGISTER_CALLBACKS == 1)
+  (void)HAL_UART_RegisterTxCpltCallback(pObj, interface_io_TxCpltCallback);
+#else
   (void)pObj;
+#endif /* BASIC_STDIO_BUFFERED && USE_HAL_UART_REGISTER_CALLBACKS */
 }
 
 uint32_t interface_io_Send(void *pObj, const uint8_t *Ptr, uint16_t Size)
@@ -45,4 +54,26 @@ uint32_t interface_io_Send(void *pObj, const uint8_t *Ptr, uint16_t Size)
   {
     return 0;
   }
-}
\ No newline at end of file
+}
+
+#if (BASIC_STDIO_BUFFERED == 1U)
+uint32_t interface_io_Send_Async(void *pObj, const uint8_t *Ptr, uint16_t Size)
+{
+  if (HAL_UART_Transmit_DMA(pObj, Ptr, Size) == HAL_OK)
+  {
+    return Size;
+  }
+  else
+  {
+    return 0;
+  }
+}
+
+#if defined(USE_HAL_UART_REGISTER_CALLBACKS) && (USE_HAL_UART_REGISTER_CALLBACKS == 1)
+static void interface_io_TxCpltCallback(hal_uart_handle_t *huart)
+{
+  (void)huart;
+  UTIL_BASIC_STDIO_TxCpltCallback();
+}
+#endif /* USE_HAL_UART_REGISTER_CALLBACKS */
+#endif /* BASIC_STDIO_BUFFERED */
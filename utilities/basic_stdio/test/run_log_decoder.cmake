@@ -0,0 +1,10 @@
+# Runs the log program, then checks the decoding of its capture.
+execute_process(COMMAND ${PROGRAM} ${OUTPUT}.bin ${OUTPUT}.txt RESULT_VARIABLE RESULT)
+if(NOT RESULT EQUAL 0)
+  message(FATAL_ERROR "${PROGRAM} failed: ${RESULT}")
+endif()
+execute_process(COMMAND ${PYTHON} ${CHECKER} ${DECODER} ${PROGRAM} ${OUTPUT}.bin ${OUTPUT}.txt ${DECODER_ARGS}
+                RESULT_VARIABLE RESULT)
+if(NOT RESULT EQUAL 0)
+  message(FATAL_ERROR "decoding of ${OUTPUT}.bin failed")
+endif()
@@ -0,0 +1,298 @@
+/**
+  ******************************************************************************
+  * @file    test_basic_stdio.c
+  * @brief   Host tests of the buffered mode of the basic stdio utility
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ * The ring buffer is 64 bytes, the transfers complete when the test calls interface_io_host_Complete().
+ * The tests fill the ring while a transfer is in flight and check the output and the dropped count of the
+ * overflow policy the test is built with:
+ * - full ring with a transfer in flight, then a write which does not fit,
+ * - overwrite of pending bytes wrapping around the end of the ring,
+ * - overwrite with a write larger than the room left by the transfer in flight,
+ * - log records written whole or dropped whole,
+ * - flush of a transfer which never completes, returning after BASIC_STDIO_WAIT_TIMEOUT,
+ * - random writes and completions: output and dropped bytes account for the whole input, in order.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "basic_stdio_core.h"
+#include "basic_stdio_itf_io.h"
+#include "basic_stdio_log.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define INPUT_MAX     200000U
+
+#define CHECK(cond, ...)                                      \
+  do                                                          \
+  {                                                           \
+    if (!(cond))                                              \
+    {                                                         \
+      printf("FAIL %s:%d: ", __FILE__, __LINE__);             \
+      printf(__VA_ARGS__);                                    \
+      printf("\n");                                           \
+      Failures++;                                             \
+    }                                                         \
+  } while (0)
+
+/* Private variables ---------------------------------------------------------*/
+static FILE *OutFile;
+static char *OutData;
+static size_t OutSize;
+static uint8_t Input[INPUT_MAX];
+static uint8_t Expected[INPUT_MAX];
+static uint32_t ExpectedSize;
+static int Failures;
+
+/* Private functions ---------------------------------------------------------*/
+static void Reset(void)
+{
+  if (OutFile != NULL)
+  {
+    (void)fclose(OutFile);
+    free(OutData);
+  }
+  OutData = NULL;
+  OutSize = 0U;
+  OutFile = open_memstream(&OutData, &OutSize);
+  UTIL_BASIC_STDIO_Init(OutFile);
+  ExpectedSize = 0U;
+}
+
+/* Input byte i, a counter so that the order of the output can be checked */
+static void Write(uint32_t first, uint32_t len)
+{
+  (void)_write(1, (const char *)&Input[first], (int)len);
+}
+
+static void Expect(uint32_t first, uint32_t len)
+{
+  (void)memcpy(&Expected[ExpectedSize], &Input[first], len);
+  ExpectedSize += len;
+}
+
+static void CompleteAll(void)
+{
+  while (interface_io_host_Complete() != 0U)
+  {
+  }
+}
+
+static void CheckOutput(const char *p_name, uint32_t dropped)
+{
+  CompleteAll();
+  (void)fflush(OutFile);
+  CHECK((OutSize == ExpectedSize) && (memcmp(OutData, Expected, ExpectedSize) == 0),
+        "%s: %u bytes output, %u expected", p_name, (uint32_t)OutSize, ExpectedSize);
+  CHECK(UTIL_BASIC_STDIO_GetDropped() == dropped, "%s: %u bytes dropped, %u expected", p_name,
+        UTIL_BASIC_STDIO_GetDropped(), dropped);
+}
+
+/* 40 bytes in flight, 24 pending: the ring is full when 16 more bytes are written */
+static void TestFullInFlight(void)
+{
+  Reset();
+  Write(0U, 40U);
+  Write(40U, 24U);
+  Write(64U, 16U);
+
+  Expect(0U, 40U);
+#if (BASIC_STDIO_OVERFLOW_POLICY == BASIC_STDIO_OVERFLOW_OVERWRITE)
+  /* the 16 oldest pending bytes make room for the new ones, they are the only ones dropped */
+  Expect(56U, 24U);
+#else
+  /* the new bytes are dropped, after the timeout of the wait with the block policy */
+  Expect(40U, 24U);
+#endif /* BASIC_STDIO_OVERFLOW_POLICY */
+  CheckOutput("full ring", 16U);
+}
+
+#if (BASIC_STDIO_OVERFLOW_POLICY == BASIC_STDIO_OVERFLOW_OVERWRITE)
+/* 14 bytes in flight up to the end of the ring, 16 pending at its start: the kept ones move across the wrap */
+static void TestOverwriteWrap(void)
+{
+  Reset();
+  Write(0U, 50U);
+  CompleteAll();
+  Write(50U, 30U);
+  Write(80U, 40U);
+
+  Expect(0U, 64U);
+  Expect(70U, 50U);
+  CheckOutput("overwrite across the wrap", 6U);
+}
+
+/* 40 bytes in flight, 10 pending, 60 written: all the pending bytes and the oldest new ones are dropped */
+static void TestOverwriteLarge(void)
+{
+  Reset();
+  Write(0U, 40U);
+  Write(40U, 10U);
+  Write(50U, 60U);
+
+  Expect(0U, 40U);
+  Expect(86U, 24U);
+  CheckOutput("overwrite larger than the room", 46U);
+}
+#endif /* BASIC_STDIO_OVERFLOW_POLICY */
+
+/* Log record of 9 words made of the input bytes from first */
+static void WriteRecord(uint32_t first)
+{
+  uint32_t record[9];
+
+  (void)memcpy(record, &Input[first], sizeof(record));
+  UTIL_BASIC_STDIO_LogWrite(record, 9U);
+}
+
+/* A log record is written whole or dropped whole, never truncated */
+static void TestRecord(void)
+{
+  /* 40 bytes in flight, 8 pending: 16 bytes of room, 24 with all the pending bytes discarded */
+  Reset();
+  Write(0U, 40U);
+  Write(40U, 8U);
+  WriteRecord(100U);
+  Expect(0U, 48U);
+  CheckOutput("record larger than the room", 36U);
+
+  /* 20 bytes in flight, 20 pending: 24 bytes of room, 44 with all the pending bytes discarded */
+  Reset();
+  Write(0U, 20U);
+  Write(20U, 20U);
+  WriteRecord(100U);
+  Expect(0U, 20U);
+#if (BASIC_STDIO_OVERFLOW_POLICY == BASIC_STDIO_OVERFLOW_OVERWRITE)
+  Expect(32U, 8U);
+  Expect(100U, 36U);
+  CheckOutput("record overwriting pending bytes", 12U);
+#else
+  Expect(20U, 20U);
+  CheckOutput("record overwriting pending bytes", 36U);
+#endif /* BASIC_STDIO_OVERFLOW_POLICY */
+
+  /* enough room */
+  Reset();
+  Write(0U, 20U);
+  WriteRecord(100U);
+  Write(20U, 8U);
+  Expect(0U, 20U);
+  Expect(100U, 36U);
+  Expect(20U, 8U);
+  CheckOutput("record with enough room", 0U);
+}
+
+/* A transfer which never completes does not block the flush */
+static void TestFlushTimeout(void)
+{
+  uint32_t start;
+  uint32_t elapsed;
+  uint32_t left;
+
+  Reset();
+  Write(0U, 40U);
+  Write(40U, 10U);
+
+  start = interface_io_host_GetTick();
+  left = UTIL_BASIC_STDIO_Flush();
+  elapsed = interface_io_host_GetTick() - start;
+  CHECK(left == 50U, "flush of a stuck transfer: %u bytes left", left);
+  CHECK((elapsed >= BASIC_STDIO_WAIT_TIMEOUT) && (elapsed < (BASIC_STDIO_WAIT_TIMEOUT + 1000U)),
+        "flush of a stuck transfer returned after %u ms", elapsed);
+
+  Expect(0U, 50U);
+  CheckOutput("flush timeout", 0U);
+  CHECK(UTIL_BASIC_STDIO_Flush() == 0U, "flush of an empty buffer");
+}
+
+#if (BASIC_STDIO_OVERFLOW_POLICY != BASIC_STDIO_OVERFLOW_BLOCK)
+/* Random writes and completions: the output is a subsequence of the input and nothing is unaccounted for */
+static void TestRandom(void)
+{
+  uint32_t rand_state = 0x2545F491U;
+  uint32_t input_size = 0U;
+  uint32_t matched = 0U;
+
+  Reset();
+  while (input_size < (INPUT_MAX - 128U))
+  {
+    uint32_t len;
+
+    rand_state ^= rand_state << 13U;
+    rand_state ^= rand_state >> 17U;
+    rand_state ^= rand_state << 5U;
+
+    len = 1U + (rand_state % 100U);
+    Write(input_size, len);
+    input_size += len;
+    for (uint32_t i = 0U; i < ((rand_state >> 8U) % 3U); i++)
+    {
+      (void)interface_io_host_Complete();
+    }
+  }
+  CompleteAll();
+  (void)fflush(OutFile);
+
+  for (uint32_t i = 0U; (i < input_size) && (matched < OutSize); i++)
+  {
+    if (Input[i] == (uint8_t)OutData[matched])
+    {
+      matched++;
+    }
+  }
+  CHECK(matched == OutSize, "random: the output is not a subsequence of the input (%u of %u bytes)", matched,
+        (uint32_t)OutSize);
+  CHECK((OutSize + UTIL_BASIC_STDIO_GetDropped()) == input_size, "random: %u output + %u dropped, %u written",
+        (uint32_t)OutSize, UTIL_BASIC_STDIO_GetDropped(), input_size);
+  CHECK(UTIL_BASIC_STDIO_GetDropped() != 0U, "random: the ring was never full");
+}
+#endif /* BASIC_STDIO_OVERFLOW_POLICY */
+
+/* Public functions ----------------------------------------------------------*/
+int main(void)
+{
+  for (uint32_t i = 0U; i < INPUT_MAX; i++)
+  {
+    /* 251 is prime, a dropped chunk of the ring size cannot look like a shifted copy */
+    Input[i] = (uint8_t)(i % 251U);
+  }
+
+  TestFullInFlight();
+#if (BASIC_STDIO_OVERFLOW_POLICY == BASIC_STDIO_OVERFLOW_OVERWRITE)
+  TestOverwriteWrap();
+  TestOverwriteLarge();
+#endif /* BASIC_STDIO_OVERFLOW_POLICY */
+  TestRecord();
+  TestFlushTimeout();
+#if (BASIC_STDIO_OVERFLOW_POLICY != BASIC_STDIO_OVERFLOW_BLOCK)
+  TestRandom();
+#endif /* BASIC_STDIO_OVERFLOW_POLICY */
+
+  (void)fclose(OutFile);
+  free(OutData);
+
+  if (Failures != 0)
+  {
+    printf("%d check(s) failed\n", Failures);
+    return 1;
+  }
+  printf("all checks passed\n");
+  return 0;
+}
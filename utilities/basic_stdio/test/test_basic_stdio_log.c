@@ -0,0 +1,91 @@
+/**
+  ******************************************************************************
+  * @file    test_basic_stdio_log.c
+  * @brief   Host program emitting deferred logs, checked by the decoder test
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ * Usage: test_basic_stdio_log capture.bin expected.txt
+ *
+ * Writes text and log records mixed to capture.bin through the basic stdio utility, and the same output formatted
+ * by printf to expected.txt. test_log_decoder.py decodes capture.bin with the ELF file of this program and compares
+ * the result with expected.txt.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+
+#include "basic_stdio_core.h"
+#include "basic_stdio_log.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define RECORD_NBR    500U
+
+/* Private variables ---------------------------------------------------------*/
+static FILE *Expected;
+
+/* Private functions ---------------------------------------------------------*/
+static void Text(const char *p_text)
+{
+  (void)_write(1, p_text, (int)strlen(p_text));
+  (void)fputs(p_text, Expected);
+}
+
+/* Public functions ----------------------------------------------------------*/
+int main(int argc, char **argv)
+{
+  FILE *capture;
+
+  if (argc != 3)
+  {
+    printf("usage: %s capture.bin expected.txt\n", argv[0]);
+    return 1;
+  }
+  capture = fopen(argv[1], "wb");
+  Expected = fopen(argv[2], "w");
+  if ((capture == NULL) || (Expected == NULL))
+  {
+    printf("%s: cannot create the output files\n", argv[0]);
+    return 1;
+  }
+  UTIL_BASIC_STDIO_Init(capture);
+
+  Text("start of the capture, temp\xC3\xA9rature\n");
+  UTIL_BASIC_STDIO_LOG("no argument\n");
+  (void)fprintf(Expected, "no argument\n");
+
+  for (uint32_t i = 0U; i < RECORD_NBR; i++)
+  {
+    int32_t value = (int32_t)(i * 7919U) - 1000000;
+
+    UTIL_BASIC_STDIO_LOG("record %u: %d 0x%08x %5u%c\n", i, value, i * 0x01010101U, i % 1000U, 'A' + (i % 26U));
+    (void)fprintf(Expected, "record %u: %d 0x%08x %5u%c\n", i, value, i * 0x01010101U, i % 1000U,
+                  (char)('A' + (i % 26U)));
+    if ((i % 50U) == 0U)
+    {
+      UTIL_BASIC_STDIO_LOG("%s %s: %u %u %u %u %u %u\n", "eight", "arguments", i, i + 1U, i + 2U, i + 3U, i + 4U,
+                           i + 5U);
+      (void)fprintf(Expected, "%s %s: %u %u %u %u %u %u\n", "eight", "arguments", i, i + 1U, i + 2U, i + 3U, i + 4U,
+                    i + 5U);
+      Text("text between the records\n");
+    }
+  }
+  Text("end\n");
+
+  (void)UTIL_BASIC_STDIO_Flush();
+  (void)fclose(capture);
+  (void)fclose(Expected);
+  return 0;
+}
@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025 STMicroelectronics.
+# All rights reserved.
+#
+# This software is licensed under terms that can be found in the LICENSE file
+# in the root directory of this software component.
+# If no LICENSE file comes with this software, it is provided AS-IS.
+#
+"""Test of tools/basic_stdio_log_decoder.py.
+
+Usage: test_log_decoder.py decoder.py program.elf capture.bin expected.txt [--nobits]
+
+The capture of test_basic_stdio_log is decoded from a file and from a stream
+returning 1 to 3 bytes per read, as a serial device does, and compared with
+the output formatted by printf. With --nobits, the ELF file has the strings
+in a NOLOAD section and the decoder must reject it.
+"""
+
+import importlib.util
+import io
+import random
+import sys
+
+
+class ShortReader:
+    """Stream returning at most 3 bytes per read."""
+
+    def __init__(self, data):
+        self.data = data
+        self.position = 0
+        self.random = random.Random(1)
+
+    def read(self, size):
+        size = min(size, self.random.randint(1, 3))
+        chunk = self.data[self.position:self.position + size]
+        self.position += len(chunk)
+        return chunk
+
+
+def main(argv):
+    spec = importlib.util.spec_from_file_location("decoder", argv[1])
+    decoder = importlib.util.module_from_spec(spec)
+    spec.loader.exec_module(decoder)
+    elf = decoder.Elf(argv[2])
+    with open(argv[3], "rb") as f:
+        capture = f.read()
+
+    if "--nobits" in argv:
+        try:
+            decoder.decode(elf, io.BytesIO(capture), io.StringIO())
+        except ValueError as error:
+            print("rejected: %s" % error)
+            return 0
+        print("FAIL: the strings of a NOLOAD section were accepted")
+        return 1
+
+    with open(argv[4], "r", encoding="utf-8") as f:
+        expected = f.read()
+    failures = 0
+    for (name, stream) in (("file", io.BytesIO(capture)), ("short reads", ShortReader(capture))):
+        out = io.StringIO()
+        decoder.decode(elf, stream, out)
+        if out.getvalue() != expected:
+            failures += 1
+            got = out.getvalue()
+            index = next((i for i in range(min(len(got), len(expected))) if got[i] != expected[i]),
+                         min(len(got), len(expected)))
+            print("FAIL %s: output differs at character %d: %r instead of %r" %
+                  (name, index, got[index:index + 40], expected[index:index + 40]))
+    if failures == 0:
+        print("all checks passed")
+    return 1 if failures != 0 else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,191 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025 STMicroelectronics.
+# All rights reserved.
+#
+# This software is licensed under terms that can be found in the LICENSE file
+# in the root directory of this software component.
+# If no LICENSE file comes with this software, it is provided AS-IS.
+#
+"""Decoder of the deferred logs of the basic stdio utility.
+
+Reads the output of the target (a file, a serial device or stdin), formats the
+records written by UTIL_BASIC_STDIO_LOG() with the format strings found in the
+ELF file of the application, and copies the other bytes (printf output) as is.
+
+Usage: basic_stdio_log_decoder.py application.elf [capture.bin | /dev/ttyACM0]
+"""
+
+import codecs
+import re
+import struct
+import sys
+import time
+
+LOG_MARKER = 0xF5
+LOG_ARG_MAX = 8
+LOG_SECTION = "basic_stdio_log"
+
+SHF_ALLOC = 0x2
+SHT_NOBITS = 8
+
+FORMAT_SPEC = re.compile(r"%([-+ #0]*)(\d+|\*)?(?:\.(\d+|\*))?(hh|h|ll|l|j|z|t|L)?([diouxXcspfFeEgGaA%])")
+
+
+class Elf:
+    """Minimal ELF reader: sections by name and by address."""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            data = f.read()
+        if data[:4] != b"\x7fELF":
+            raise ValueError("%s is not an ELF file" % path)
+        is64 = data[4] == 2
+        endian = "<" if data[5] == 1 else ">"
+        if is64:
+            shoff, = struct.unpack_from(endian + "Q", data, 0x28)
+            shentsize, shnum, shstrndx = struct.unpack_from(endian + "HHH", data, 0x3A)
+            shdr = endian + "IIQQQQIIQQ"
+        else:
+            shoff, = struct.unpack_from(endian + "I", data, 0x20)
+            shentsize, shnum, shstrndx = struct.unpack_from(endian + "HHH", data, 0x2E)
+            shdr = endian + "IIIIIIIIII"
+        headers = [struct.unpack_from(shdr, data, shoff + i * shentsize) for i in range(shnum)]
+        names = headers[shstrndx]
+        self.sections = {}
+        self.nobits = {}
+        self.loaded = []
+        for (name, kind, flags, addr, offset, size, _, _, _, _) in headers:
+            start = names[4] + name
+            label = data[start:data.index(b"\0", start)].decode()
+            content = b"" if kind == SHT_NOBITS else data[offset:offset + size]
+            self.sections[label] = content
+            self.nobits[label] = kind == SHT_NOBITS and size != 0
+            if (flags & SHF_ALLOC) and kind != SHT_NOBITS and size != 0:
+                self.loaded.append((addr, content))
+
+    def string_at(self, address):
+        """Return the string at a target address, None when it is not in the ELF file."""
+        for (addr, content) in self.loaded:
+            if addr <= address < addr + len(content):
+                start = address - addr
+                end = content.find(b"\0", start)
+                if end >= 0:
+                    return content[start:end].decode(errors="replace")
+        return None
+
+
+def format_record(elf, fmt, args):
+    """printf-like formatting of 32 bit arguments."""
+    args = list(args)
+
+    def next_arg():
+        return args.pop(0) if args else 0
+
+    def convert(match):
+        flags, width, precision, _, conv = match.groups()
+        if conv == "%":
+            return "%"
+        if width == "*":
+            width = str(struct.unpack("<i", struct.pack("<I", next_arg()))[0])
+        if precision == "*":
+            precision = str(next_arg())
+        spec = "%" + flags + (width or "") + ("." + precision if precision is not None else "")
+        value = next_arg()
+        signed = struct.unpack("<i", struct.pack("<I", value))[0]
+        if conv in "di":
+            return (spec + "d") % signed
+        if conv == "u":
+            return (spec + "d") % value
+        if conv in "oxX":
+            return (spec + conv) % value
+        if conv == "c":
+            return (spec + "c") % chr(value & 0xFF)
+        if conv == "s":
+            text = elf.string_at(value)
+            return (spec + "s") % (text if text is not None else "<0x%08x>" % value)
+        if conv == "p":
+            return "0x%08x" % value
+        # floating point values are truncated to integers by the target
+        return (spec + ("f" if conv in "aA" else conv)) % float(signed)
+
+    return FORMAT_SPEC.sub(convert, fmt)
+
+
+def read_exact(stream, size):
+    """Read size bytes, looping on the short reads of serial devices and pipes.
+
+    Returns fewer bytes only at the end of the stream.
+    """
+    data = b""
+    while len(data) < size:
+        chunk = stream.read(size - len(data))
+        if chunk is None:
+            # non-blocking stream without data yet
+            time.sleep(0.01)
+            continue
+        if chunk == b"":
+            break
+        data += chunk
+    return data
+
+
+def decode(elf, stream, out):
+    """Decode the byte stream, copying the bytes which are not part of a record."""
+    strings = elf.sections.get(LOG_SECTION)
+    if strings is None:
+        raise ValueError("no %s section in the ELF file" % LOG_SECTION)
+    if elf.nobits.get(LOG_SECTION):
+        raise ValueError("the %s section has no content in the ELF file: it is placed in a NOLOAD output section, "
+                         "use (INFO) or (COPY) instead" % LOG_SECTION)
+    # the marker is not valid UTF-8, the text between the records is decoded incrementally
+    text = codecs.getincrementaldecoder("utf-8")(errors="replace")
+    pending = b""
+    while True:
+        if not pending:
+            pending = read_exact(stream, 1)
+            if not pending:
+                break
+        if pending[0] != LOG_MARKER:
+            out.write(text.decode(pending[:1]))
+            pending = pending[1:]
+            continue
+        pending += read_exact(stream, 4 - len(pending))
+        if len(pending) < 4:
+            # truncated header at the end of the stream
+            break
+        count = pending[1]
+        offset = (pending[2] | (pending[3] << 8)) * 4
+        if count > LOG_ARG_MAX or offset >= len(strings) or (offset != 0 and strings[offset - 1] != 0):
+            # not a record: resynchronize on the next byte
+            out.write(text.decode(pending[:1]))
+            pending = pending[1:]
+            continue
+        body = read_exact(stream, count * 4)
+        if len(body) < count * 4:
+            # truncated record at the end of the stream
+            break
+        end = strings.index(b"\0", offset)
+        fmt = strings[offset:end].decode(errors="replace")
+        out.write(format_record(elf, fmt, struct.unpack("<%dI" % count, body)))
+        out.flush()
+        pending = b""
+    out.write(text.decode(b"", final=True))
+    out.flush()
+
+
+def main(argv):
+    if len(argv) < 2:
+        sys.stderr.write(__doc__)
+        return 1
+    elf = Elf(argv[1])
+    if len(argv) > 2:
+        with open(argv[2], "rb", buffering=0) as stream:
+            decode(elf, stream, sys.stdout)
+    else:
+        decode(elf, sys.stdin.buffer, sys.stdout)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
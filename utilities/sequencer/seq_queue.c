@@ -0,0 +1,391 @@
+/**
+  **********************************************************************************************************************
+  * @file    seq_queue.c
+  * @author  MCD Application Team
+  * @brief   Lock free message queues from ISRs to the sequencer tasks
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2019-2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "seq_queue.h"
+
+/** @addtogroup SEQUENCER_QUEUE
+  * @{
+A message queue carries fixed size messages from ISRs or tasks to one consumer task of the sequencer.
+Pushing a message sets the consumer task, so that a message is never lost when the task is set several times before
+being executed. The consumer pops the messages by batch.
+# Single producer
+The queue is a ring buffer with a head index written by the consumer and a tail index written by the producer.
+No critical section is needed, only memory barriers.
+# Multiple producers
+Each message has a sequence number telling whether it is free, being written or ready. A producer reserves a
+message by incrementing the tail index with LDREX/STREX, copies it and then publishes it by updating its
+sequence number. An interrupt preempting a producer never waits for it: it reserves the next message.
+The consumer stops on a message reserved and not yet published, it is executed again when the message is published.
+On Cortex-M0 which has no LDREX/STREX, the tail index is incremented in a short critical section.
+  */
+
+/* Private defines ---------------------------------------------------------------------------------------------------*/
+/** @defgroup SEQUENCER_QUEUE_Private_define SEQUENCER queue private defines
+  *  @{
+  */
+
+/**
+  * @brief default definition of memcpy macro.
+  */
+#ifndef SEQ_MEMCPY8
+#define SEQ_MEMCPY8(dest, src, size)      memcpy((dest),(src),(size))
+#endif /* SEQ_MEMCPY8 */
+
+/**
+  * @brief default definition of the data memory barrier.
+  */
+#ifndef SEQ_QUEUE_DMB
+#define SEQ_QUEUE_DMB( )                  __DMB( )
+#endif /* SEQ_QUEUE_DMB */
+
+/**
+  * @brief default definition of the compare and swap of a 32 bit word, returns 1 on success.
+  */
+#ifndef SEQ_QUEUE_CAS
+#define SEQ_QUEUE_CAS(ptr, expected, desired)  SEQ_QueueCas((ptr), (expected), (desired))
+#define SEQ_QUEUE_CAS_DEFAULT
+#endif /* SEQ_QUEUE_CAS */
+
+/**
+  * @}
+  */
+
+/* Private function prototypes ---------------------------------------------------------------------------------------*/
+/** @defgroup SEQUENCER_QUEUE_Private_function SEQUENCER queue private functions
+  *  @{
+  */
+#if defined(SEQ_QUEUE_CAS_DEFAULT)
+static uint32_t SEQ_QueueCas(volatile uint32_t *p_value, uint32_t expected, uint32_t desired);
+#endif /* SEQ_QUEUE_CAS_DEFAULT */
+static uint32_t SEQ_QueuePushSpsc(seq_queue_t *p_queue, const void *p_msg);
+static uint32_t SEQ_QueuePushMpsc(seq_queue_t *p_queue, const void *p_msg);
+
+/**
+  * @}
+  */
+
+/* Functions Definition ----------------------------------------------------------------------------------------------*/
+/** @addtogroup SEQUENCER_QUEUE_Exported_function SEQUENCER queue exported functions
+  *  @{
+  */
+
+/**
+  * @brief  This function initializes a message queue.
+  *
+  * @param p_queue pointer to the queue
+  * @param mode single or multiple producers
+  * @param p_buffer pointer to the messages storage of depth * msg_size bytes
+  * @param p_seq pointer to an array of depth words, used in SEQ_QUEUE_MPSC mode only, NULL otherwise
+  * @param msg_size size of a message in bytes
+  * @param depth number of messages, it must be a power of 2
+  * @param task_idx index of the consumer task, set by each push
+  * @param task_prio priority of the consumer task
+  * @retval 1 if the queue is initialized, 0 if a parameter is invalid
+  *
+  * @note   It must not be called while the queue is used.
+  *
+  */
+uint32_t SEQ_QueueInit(seq_queue_t *p_queue, seq_queue_mode_t mode, void *p_buffer, uint32_t *p_seq,
+                       uint32_t msg_size, uint32_t depth, uint32_t task_idx, uint32_t task_prio)
+{
+  if ((depth == 0U) || ((depth & (depth - 1U)) != 0U) || (msg_size == 0U) || (p_buffer == NULL)
+      || ((mode == SEQ_QUEUE_MPSC) && (p_seq == NULL)))
+  {
+    return 0U;
+  }
+
+  p_queue->p_buffer = (uint8_t *)p_buffer;
+  p_queue->p_seq = p_seq;
+  p_queue->msg_size = msg_size;
+  p_queue->mask = depth - 1U;
+  p_queue->head = 0U;
+  p_queue->tail = 0U;
+  p_queue->dropped = 0U;
+  p_queue->task_idx = task_idx;
+  p_queue->task_prio = task_prio;
+  p_queue->mode = (uint32_t)mode;
+
+  if (mode == SEQ_QUEUE_MPSC)
+  {
+    /* message n is free for the push number n */
+    for (uint32_t index = 0U; index < depth; index++)
+    {
+      p_seq[index] = index;
+    }
+  }
+  SEQ_QUEUE_DMB();
+
+  return 1U;
+}
+
+/**
+  * @brief  This function pushes a message and sets the consumer task.
+  *
+  * @param p_queue pointer to the queue
+  * @param p_msg pointer to the message, msg_size bytes are copied
+  * @retval 1 if the message is queued, 0 if the queue is full. The lost messages are counted.
+  *
+  * @note   It can be called from an ISR. In SEQ_QUEUE_SPSC mode, a single context must push.
+  *
+  */
+uint32_t SEQ_QueuePush(seq_queue_t *p_queue, const void *p_msg)
+{
+  uint32_t status;
+
+  if (p_queue->mode == (uint32_t)SEQ_QUEUE_MPSC)
+  {
+    status = SEQ_QueuePushMpsc(p_queue, p_msg);
+  }
+  else
+  {
+    status = SEQ_QueuePushSpsc(p_queue, p_msg);
+  }
+
+  if (status != 0U)
+  {
+    SEQ_SetTaskIdx(p_queue->task_idx, p_queue->task_prio);
+  }
+  else
+  {
+    uint32_t dropped;
+    do
+    {
+      dropped = p_queue->dropped;
+    } while (SEQ_QUEUE_CAS(&p_queue->dropped, dropped, dropped + 1U) == 0U);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  This function pops up to msg_nbr messages.
+  *         When msg_nbr messages have been popped and the queue is still not empty, the consumer task is set again
+  *         so that the other tasks can be executed before the next batch.
+  *
+  * @param p_queue pointer to the queue
+  * @param p_msg pointer to the destination of msg_nbr messages
+  * @param msg_nbr maximum number of messages to be popped
+  * @retval number of messages popped
+  *
+  * @note   It must be called by the consumer task only.
+  *
+  */
+uint32_t SEQ_QueuePop(seq_queue_t *p_queue, void *p_msg, uint32_t msg_nbr)
+{
+  uint8_t *p_dest = (uint8_t *)p_msg;
+  uint32_t head = p_queue->head;
+  uint32_t count = 0U;
+  uint32_t pending;
+
+  if (p_queue->mode == (uint32_t)SEQ_QUEUE_MPSC)
+  {
+    while ((count < msg_nbr) && (p_queue->p_seq[head & p_queue->mask] == (head + 1U)))
+    {
+      SEQ_QUEUE_DMB();
+      SEQ_MEMCPY8(p_dest, &p_queue->p_buffer[(head & p_queue->mask) * p_queue->msg_size], p_queue->msg_size);
+      SEQ_QUEUE_DMB();
+      /* the message is free for the push of the next round */
+      p_queue->p_seq[head & p_queue->mask] = head + p_queue->mask + 1U;
+      p_dest = &p_dest[p_queue->msg_size];
+      head++;
+      count++;
+    }
+    p_queue->head = head;
+    pending = (p_queue->p_seq[head & p_queue->mask] == (head + 1U)) ? 1U : 0U;
+  }
+  else
+  {
+    uint32_t available = p_queue->tail - head;
+
+    SEQ_QUEUE_DMB();
+    while ((count < msg_nbr) && (count < available))
+    {
+      SEQ_MEMCPY8(p_dest, &p_queue->p_buffer[(head & p_queue->mask) * p_queue->msg_size], p_queue->msg_size);
+      p_dest = &p_dest[p_queue->msg_size];
+      head++;
+      count++;
+    }
+    SEQ_QUEUE_DMB();
+    p_queue->head = head;
+    pending = (p_queue->tail != head) ? 1U : 0U;
+  }
+
+  if ((count == msg_nbr) && (pending != 0U))
+  {
+    SEQ_SetTaskIdx(p_queue->task_idx, p_queue->task_prio);
+  }
+
+  return count;
+}
+
+/**
+  * @brief  This function returns the number of messages in the queue, including the ones being pushed.
+  *
+  * @param p_queue pointer to the queue
+  * @retval number of messages
+  *
+  */
+uint32_t SEQ_QueueGetCount(const seq_queue_t *p_queue)
+{
+  uint32_t head = p_queue->head;
+
+  return (p_queue->tail - head);
+}
+
+/**
+  * @brief  This function returns the number of messages lost because the queue was full.
+  *
+  * @param p_queue pointer to the queue
+  * @retval number of messages lost since the initialization
+  *
+  */
+uint32_t SEQ_QueueGetDropped(const seq_queue_t *p_queue)
+{
+  return p_queue->dropped;
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup SEQUENCER_QUEUE_Private_function
+  *  @{
+  */
+
+#if defined(SEQ_QUEUE_CAS_DEFAULT)
+#if defined(__CORTEX_M) && (__CORTEX_M == 0U)
+/**
+  * @brief compare and swap of a 32 bit word in critical section
+  * @param p_value pointer to the word
+  * @param expected value expected in the word
+  * @param desired value to be written when the word has the expected value
+  * @retval 1 if the word has been written, 0 otherwise
+  */
+static uint32_t SEQ_QueueCas(volatile uint32_t *p_value, uint32_t expected, uint32_t desired)
+{
+  uint32_t status = 0U;
+
+  SEQ_ENTER_CRITICAL_SECTION();
+  if (*p_value == expected)
+  {
+    *p_value = desired;
+    status = 1U;
+  }
+  SEQ_EXIT_CRITICAL_SECTION();
+
+  return status;
+}
+#else
+/**
+  * @brief compare and swap of a 32 bit word with LDREX/STREX
+  * @param p_value pointer to the word
+  * @param expected value expected in the word
+  * @param desired value to be written when the word has the expected value
+  * @retval 1 if the word has been written, 0 otherwise
+  */
+static uint32_t SEQ_QueueCas(volatile uint32_t *p_value, uint32_t expected, uint32_t desired)
+{
+  do
+  {
+    if (__LDREXW(p_value) != expected)
+    {
+      __CLREX();
+      return 0U;
+    }
+  } while (__STREXW(desired, p_value) != 0U);
+
+  return 1U;
+}
+#endif /* __CORTEX_M */
+#endif /* SEQ_QUEUE_CAS_DEFAULT */
+
+/**
+  * @brief push a message in a single producer queue
+  * @param p_queue pointer to the queue
+  * @param p_msg pointer to the message
+  * @retval 1 if the message is queued, 0 if the queue is full
+  */
+static uint32_t SEQ_QueuePushSpsc(seq_queue_t *p_queue, const void *p_msg)
+{
+  uint32_t tail = p_queue->tail;
+
+  if ((tail - p_queue->head) > p_queue->mask)
+  {
+    return 0U;
+  }
+
+  /* the message must not be written before the head has been read */
+  SEQ_QUEUE_DMB();
+  SEQ_MEMCPY8(&p_queue->p_buffer[(tail & p_queue->mask) * p_queue->msg_size], p_msg, p_queue->msg_size);
+  SEQ_QUEUE_DMB();
+  p_queue->tail = tail + 1U;
+
+  return 1U;
+}
+
+/**
+  * @brief push a message in a multiple producers queue
+  * @param p_queue pointer to the queue
+  * @param p_msg pointer to the message
+  * @retval 1 if the message is queued, 0 if the queue is full
+  */
+static uint32_t SEQ_QueuePushMpsc(seq_queue_t *p_queue, const void *p_msg)
+{
+  uint32_t tail = p_queue->tail;
+  int32_t diff;
+
+  /* reserve a message */
+  for (;;)
+  {
+    diff = (int32_t)(p_queue->p_seq[tail & p_queue->mask] - tail);
+    if (diff == 0)
+    {
+      if (SEQ_QUEUE_CAS(&p_queue->tail, tail, tail + 1U) != 0U)
+      {
+        break;
+      }
+    }
+    else if (diff < 0)
+    {
+      /* the message of the previous round has not been popped */
+      return 0U;
+    }
+    else
+    {
+      /* another producer has reserved this message */
+    }
+    tail = p_queue->tail;
+  }
+
+  /* copy and publish */
+  SEQ_QUEUE_DMB();
+  SEQ_MEMCPY8(&p_queue->p_buffer[(tail & p_queue->mask) * p_queue->msg_size], p_msg, p_queue->msg_size);
+  SEQ_QUEUE_DMB();
+  p_queue->p_seq[tail & p_queue->mask] = tail + 1U;
+
+  return 1U;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
@@ -0,0 +1,104 @@
+/**
+  **********************************************************************************************************************
+  * @file    seq_queue.h
+  * @author  MCD Application Team
+  * @brief   sequencer message queue interface
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2019-2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+
+/* Define to prevent recursive inclusion -----------------------------------------------------------------------------*/
+#ifndef SEQ_QUEUE_H
+#define SEQ_QUEUE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "sequencer.h"
+
+/** @addtogroup SEQUENCER
+  * @{
+  */
+
+/** @defgroup SEQUENCER_QUEUE sequencer message queues
+  * @{
+  */
+
+/* Exported types ----------------------------------------------------------------------------------------------------*/
+/** @defgroup SEQUENCER_QUEUE_Exported_type SEQUENCER queue exported types
+  *  @{
+  */
+
+/**
+  * @brief  producers of a queue.
+  */
+typedef enum
+{
+  SEQ_QUEUE_SPSC,  /*!<single producer: one ISR or one task.                    */
+  SEQ_QUEUE_MPSC,  /*!<several producers, ISRs of any priority and tasks.       */
+} seq_queue_mode_t;
+
+/**
+  * @brief  message queue, allocated by the application.
+  *
+  * The fields are private to the queue service.
+  */
+typedef struct
+{
+  uint8_t *p_buffer;            /*!<messages, depth * msg_size bytes.                     */
+  volatile uint32_t *p_seq;     /*!<sequence number of each message, MPSC mode only.      */
+  uint32_t msg_size;            /*!<size of a message in bytes.                           */
+  uint32_t mask;                /*!<depth - 1.                                            */
+  volatile uint32_t head;       /*!<next message to be popped.                            */
+  volatile uint32_t tail;       /*!<next message to be pushed.                            */
+  volatile uint32_t dropped;    /*!<number of messages lost because the queue was full.   */
+  uint32_t task_idx;            /*!<consumer task.                                        */
+  uint32_t task_prio;           /*!<priority of the consumer task.                        */
+  uint32_t mode;                /*!<value of @ref seq_queue_mode_t.                       */
+} seq_queue_t;
+
+/**
+  * @}
+  */
+
+/* Exported functions ----------------------------------------------------------------------------------------------- */
+/** @defgroup SEQUENCER_QUEUE_Exported_function SEQUENCER queue exported functions
+  *  @{
+  */
+
+uint32_t SEQ_QueueInit(seq_queue_t *p_queue, seq_queue_mode_t mode, void *p_buffer, uint32_t *p_seq,
+                       uint32_t msg_size, uint32_t depth, uint32_t task_idx, uint32_t task_prio);
+uint32_t SEQ_QueuePush(seq_queue_t *p_queue, const void *p_msg);
+uint32_t SEQ_QueuePop(seq_queue_t *p_queue, void *p_msg, uint32_t msg_nbr);
+uint32_t SEQ_QueueGetCount(const seq_queue_t *p_queue);
+uint32_t SEQ_QueueGetDropped(const seq_queue_t *p_queue);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SEQ_QUEUE_H */
@@ -0,0 +1,507 @@
+/**
+  **********************************************************************************************************************
+  * @file    seq_timer.c
+  * @author  MCD Application Team
+  * @brief   Timer service of the sequencer
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2019-2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "seq_timer.h"
+
+/** @addtogroup SEQUENCER_TIMER
+  * @{
+The timer service sets a task or an event of the sequencer at the expiry of one shot or periodic timers.
+# Timing wheel
+The timers are stored in a hierarchical timing wheel of SEQ_TIMER_LEVEL_NBR levels of 64 slots:
+  - level 0 holds the timers expiring in less than 64 ticks, one slot per tick,
+  - level n holds the timers expiring in less than 64^(n+1) ticks, one slot per 64^n ticks.
+When the time reaches the start of a slot of level n, its timers are moved to the lower levels.
+Each level has a 64 bit mapping of its non empty slots, so that start, stop and expiry do not depend on the
+number of timers, and the wheel jumps directly from one non empty slot to the next one.
+# Tickless idle
+SEQ_TimerGetNextDelay() returns the number of ticks until the next slot to be processed. The application can
+sleep until then, for example:
+@verbatim
+  void SEQ_Idle(void)
+  {
+    uint32_t delay = SEQ_TimerGetNextDelay();
+    if (delay != SEQ_TIMER_NO_DELAY)
+    {
+      program the LPTIM or RTC wakeup in delay ticks
+    }
+    enter low power mode
+  }
+
+  void SEQ_PostIdle(void)
+  {
+    SEQ_TimerProcess();
+  }
+@endverbatim
+When the next slot belongs to an upper level, the core wakes up before the expiry to move its timers, which
+happens at most SEQ_TIMER_LEVEL_NBR - 1 times for a timer.
+SEQ_TimerProcess() can also be called from the wakeup or tick interrupt handler.
+  */
+
+/* Private defines ---------------------------------------------------------------------------------------------------*/
+/** @defgroup SEQUENCER_TIMER_Private_define SEQUENCER timer private defines
+  *  @{
+  */
+
+/**
+  * @brief number of slots of a level
+  */
+#define SEQ_TIMER_SLOT_NBR      (1UL << SEQ_TIMER_SLOT_BITS)
+
+/**
+  * @brief slot value of a stopped timer
+  */
+#define SEQ_TIMER_NO_SLOT       (0xFFFFU)
+
+/**
+  * @brief number of bits of a tick covered by the levels below level _LEVEL_
+  */
+#define SEQ_TIMER_SHIFT(_LEVEL_)  ((_LEVEL_) * SEQ_TIMER_SLOT_BITS)
+
+#if (SEQ_TIMER_SLOT_BITS != 6U)
+#error "SEQ_TIMER_SLOT_BITS must be 6, the non empty slots of a level are mapped on 64 bits"
+#endif /* SEQ_TIMER_SLOT_BITS */
+
+#if (SEQ_TIMER_LEVEL_NBR * SEQ_TIMER_SLOT_BITS) > 30U
+#error "SEQ_TIMER_LEVEL_NBR is too high for a 32 bit tick"
+#endif /* SEQ_TIMER_LEVEL_NBR */
+
+/**
+  * @}
+  */
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+/** @defgroup SEQUENCER_TIMER_Private_variable SEQUENCER timer private variables
+  *  @{
+  */
+
+/**
+  * @brief first timer of each slot.
+  */
+static seq_timer_t *TimerSlot[SEQ_TIMER_LEVEL_NBR][SEQ_TIMER_SLOT_NBR];
+
+/**
+  * @brief bit mapping of the non empty slots of each level.
+  */
+static uint64_t TimerSlotSet[SEQ_TIMER_LEVEL_NBR];
+
+/**
+  * @brief first tick not yet processed.
+  */
+static uint32_t TimerNow;
+
+/**
+  * @}
+  */
+
+/* Private function prototypes ---------------------------------------------------------------------------------------*/
+/** @defgroup SEQUENCER_TIMER_Private_function SEQUENCER timer private functions
+  *  @{
+  */
+static void SEQ_TimerInsert(seq_timer_t *p_timer);
+static void SEQ_TimerRemove(seq_timer_t *p_timer);
+static seq_timer_t *SEQ_TimerDetach(uint32_t level, uint32_t index);
+static uint32_t SEQ_TimerNextSlot(uint32_t level, uint32_t index);
+static uint32_t SEQ_TimerNextEvent(uint32_t from, uint32_t *p_next);
+
+/**
+  * @}
+  */
+
+/* Functions Definition ----------------------------------------------------------------------------------------------*/
+/** @addtogroup SEQUENCER_TIMER_Exported_function SEQUENCER timer exported functions
+  *  @{
+  */
+
+/**
+  * @brief  This function initializes the timer service, all timers are stopped.
+  *
+  * @note   It must not be called from an ISR.
+  *
+  */
+void SEQ_TimerInit(void)
+{
+  (void)SEQ_MEMSET8((uint8_t *)TimerSlot, 0, sizeof(TimerSlot));
+  (void)SEQ_MEMSET8((uint8_t *)TimerSlotSet, 0, sizeof(TimerSlotSet));
+  TimerNow = SEQ_TIMER_GET_TICK();
+}
+
+/**
+  * @brief  This function initializes a timer which sets a task at its expiry.
+  *
+  * @param p_timer pointer to the timer
+  * @param task_idx The index of the task, from 0 to SEQ_CONF_TASK_NBR - 1
+  * @param task_prio The priority of the task
+  *
+  */
+void SEQ_TimerCreateTask(seq_timer_t *p_timer, uint32_t task_idx, uint32_t task_prio)
+{
+  (void)SEQ_MEMSET8((uint8_t *)p_timer, 0, sizeof(seq_timer_t));
+  p_timer->id = task_idx;
+  p_timer->action = (uint8_t)SEQ_TIMER_SET_TASK;
+  p_timer->prio = (uint8_t)task_prio;
+  p_timer->slot = SEQ_TIMER_NO_SLOT;
+}
+
+/**
+  * @brief  This function initializes a timer which sets an event at its expiry.
+  *
+  * @param p_timer pointer to the timer
+  * @param evt_id_bm event id bit mask
+  *
+  */
+void SEQ_TimerCreateEvt(seq_timer_t *p_timer, seq_bm_t evt_id_bm)
+{
+  (void)SEQ_MEMSET8((uint8_t *)p_timer, 0, sizeof(seq_timer_t));
+  p_timer->id = evt_id_bm;
+  p_timer->action = (uint8_t)SEQ_TIMER_SET_EVT;
+  p_timer->slot = SEQ_TIMER_NO_SLOT;
+}
+
+/**
+  * @brief  This function starts a timer, a running timer is restarted.
+  *
+  * @param p_timer pointer to the timer
+  * @param delay number of ticks before the first expiry.
+  *        The expiry is processed by the first call of SEQ_TimerProcess() after the tick has been reached.
+  * @param period number of ticks between the next expiries, 0 for a one shot timer
+  *
+  * @note   It can be called from an ISR.
+  *
+  */
+void SEQ_TimerStart(seq_timer_t *p_timer, uint32_t delay, uint32_t period)
+{
+  SEQ_ENTER_CRITICAL_SECTION();
+
+  if (p_timer->slot != SEQ_TIMER_NO_SLOT)
+  {
+    SEQ_TimerRemove(p_timer);
+  }
+  p_timer->expiry = SEQ_TIMER_GET_TICK() + delay;
+  p_timer->period = period;
+  SEQ_TimerInsert(p_timer);
+
+  SEQ_EXIT_CRITICAL_SECTION();
+}
+
+/**
+  * @brief  This function stops a timer.
+  *
+  * @param p_timer pointer to the timer
+  *
+  * @note   It can be called from an ISR.
+  *
+  */
+void SEQ_TimerStop(seq_timer_t *p_timer)
+{
+  SEQ_ENTER_CRITICAL_SECTION();
+
+  if (p_timer->slot != SEQ_TIMER_NO_SLOT)
+  {
+    SEQ_TimerRemove(p_timer);
+  }
+
+  SEQ_EXIT_CRITICAL_SECTION();
+}
+
+/**
+  * @brief  This function checks if a timer is running.
+  *
+  * @param p_timer pointer to the timer
+  * @retval 0 if not 1 if true
+  *
+  */
+uint32_t SEQ_TimerIsRunning(const seq_timer_t *p_timer)
+{
+  return (p_timer->slot != SEQ_TIMER_NO_SLOT) ? 1U : 0U;
+}
+
+/**
+  * @brief  This function processes the timers expired up to the current tick.
+  *         The task or the event of each expired timer is set and the periodic timers are restarted.
+  *
+  * @note   It can be called from an ISR. The critical section is released between two slots, it lasts for the
+  *         timers expiring at the same tick.
+  *
+  */
+void SEQ_TimerProcess(void)
+{
+  uint32_t target = SEQ_TIMER_GET_TICK();
+  uint32_t next;
+  uint32_t found;
+  seq_timer_t *p_timer;
+  seq_timer_t *p_list;
+
+  while ((int32_t)(target - TimerNow) >= 0)
+  {
+    SEQ_ENTER_CRITICAL_SECTION();
+
+    found = SEQ_TimerNextEvent(TimerNow, &next);
+    if ((found == 0U) || ((int32_t)(next - target) > 0))
+    {
+      /* nothing to do up to the target */
+      TimerNow = target + 1U;
+    }
+    else
+    {
+      TimerNow = next;
+
+      /* move the timers of the upper levels starting at this tick */
+      for (uint32_t level = SEQ_TIMER_LEVEL_NBR - 1U; level != 0U; level--)
+      {
+        if ((next & ((1UL << SEQ_TIMER_SHIFT(level)) - 1U)) == 0U)
+        {
+          p_list = SEQ_TimerDetach(level, (next >> SEQ_TIMER_SHIFT(level)) & (SEQ_TIMER_SLOT_NBR - 1U));
+          while (p_list != NULL)
+          {
+            p_timer = p_list;
+            p_list = p_list->p_next;
+            SEQ_TimerInsert(p_timer);
+          }
+        }
+      }
+
+      /* expire the timers of the slot */
+      p_list = SEQ_TimerDetach(0U, next & (SEQ_TIMER_SLOT_NBR - 1U));
+      TimerNow = next + 1U;
+      while (p_list != NULL)
+      {
+        p_timer = p_list;
+        p_list = p_list->p_next;
+
+        if (p_timer->period != 0U)
+        {
+          p_timer->expiry += p_timer->period;
+          SEQ_TimerInsert(p_timer);
+        }
+
+        if (p_timer->action == (uint8_t)SEQ_TIMER_SET_TASK)
+        {
+          SEQ_SetTaskIdx(p_timer->id, p_timer->prio);
+        }
+        else
+        {
+          SEQ_SetEvt(p_timer->id);
+        }
+      }
+    }
+
+    SEQ_EXIT_CRITICAL_SECTION();
+  }
+}
+
+/**
+  * @brief  This function returns the number of ticks before SEQ_TimerProcess() has something to do.
+  *         It is used to program the wakeup of the core from SEQ_Idle().
+  *
+  * @retval number of ticks, 0 when SEQ_TimerProcess() must be called now,
+  *         SEQ_TIMER_NO_DELAY when no timer is running
+  *
+  * @note   It can be called from an ISR.
+  *
+  */
+uint32_t SEQ_TimerGetNextDelay(void)
+{
+  uint32_t delay = SEQ_TIMER_NO_DELAY;
+  uint32_t next;
+  uint32_t now;
+
+  SEQ_ENTER_CRITICAL_SECTION();
+
+  if (SEQ_TimerNextEvent(TimerNow, &next) != 0U)
+  {
+    now = SEQ_TIMER_GET_TICK();
+    delay = ((int32_t)(next - now) > 0) ? (next - now) : 0U;
+  }
+
+  SEQ_EXIT_CRITICAL_SECTION();
+
+  return delay;
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup SEQUENCER_TIMER_Private_function
+  *  @{
+  */
+
+/**
+  * @brief insert a timer in the wheel according to its expiry
+  * @param p_timer pointer to the timer
+  * @note  It must be called in critical section.
+  */
+static void SEQ_TimerInsert(seq_timer_t *p_timer)
+{
+  uint32_t delta = p_timer->expiry - TimerNow;
+  uint32_t expiry = p_timer->expiry;
+  uint32_t level = 0U;
+  uint32_t index;
+
+  if ((int32_t)delta < 0)
+  {
+    /* already expired, it is processed with the first tick */
+    expiry = TimerNow;
+    p_timer->expiry = expiry;
+    delta = 0U;
+  }
+
+  while ((level < (SEQ_TIMER_LEVEL_NBR - 1U)) && (delta >= (1UL << SEQ_TIMER_SHIFT(level + 1U))))
+  {
+    level++;
+  }
+  if (delta >= (1UL << SEQ_TIMER_SHIFT(SEQ_TIMER_LEVEL_NBR)))
+  {
+    /* out of the wheel: parked in the last slot of the last level, inserted again when the slot is reached */
+    expiry = TimerNow + (1UL << SEQ_TIMER_SHIFT(SEQ_TIMER_LEVEL_NBR)) - 1U;
+  }
+
+  index = (expiry >> SEQ_TIMER_SHIFT(level)) & (SEQ_TIMER_SLOT_NBR - 1U);
+
+  p_timer->p_prev = NULL;
+  p_timer->p_next = TimerSlot[level][index];
+  if (p_timer->p_next != NULL)
+  {
+    p_timer->p_next->p_prev = p_timer;
+  }
+  TimerSlot[level][index] = p_timer;
+  TimerSlotSet[level] |= (uint64_t)1U << index;
+  p_timer->slot = (uint16_t)((level << SEQ_TIMER_SLOT_BITS) + index);
+}
+
+/**
+  * @brief remove a running timer from the wheel
+  * @param p_timer pointer to the timer
+  * @note  It must be called in critical section.
+  */
+static void SEQ_TimerRemove(seq_timer_t *p_timer)
+{
+  uint32_t level = (uint32_t)p_timer->slot >> SEQ_TIMER_SLOT_BITS;
+  uint32_t index = (uint32_t)p_timer->slot & (SEQ_TIMER_SLOT_NBR - 1U);
+
+  if (p_timer->p_prev != NULL)
+  {
+    p_timer->p_prev->p_next = p_timer->p_next;
+  }
+  else
+  {
+    TimerSlot[level][index] = p_timer->p_next;
+    if (p_timer->p_next == NULL)
+    {
+      TimerSlotSet[level] &= ~((uint64_t)1U << index);
+    }
+  }
+  if (p_timer->p_next != NULL)
+  {
+    p_timer->p_next->p_prev = p_timer->p_prev;
+  }
+  p_timer->slot = SEQ_TIMER_NO_SLOT;
+}
+
+/**
+  * @brief detach all the timers of a slot, the timers are marked as stopped
+  * @param level level of the slot
+  * @param index index of the slot
+  * @retval list of the timers linked with p_next
+  * @note  It must be called in critical section.
+  */
+static seq_timer_t *SEQ_TimerDetach(uint32_t level, uint32_t index)
+{
+  seq_timer_t *p_list = TimerSlot[level][index];
+
+  TimerSlot[level][index] = NULL;
+  TimerSlotSet[level] &= ~((uint64_t)1U << index);
+  for (seq_timer_t *p_timer = p_list; p_timer != NULL; p_timer = p_timer->p_next)
+  {
+    p_timer->slot = SEQ_TIMER_NO_SLOT;
+  }
+  return p_list;
+}
+
+/**
+  * @brief distance to the first non empty slot of a level
+  * @param level level
+  * @param index index of the first slot to consider
+  * @retval distance from index, from 0 to 63, or SEQ_TIMER_SLOT_NBR if the level is empty
+  */
+static uint32_t SEQ_TimerNextSlot(uint32_t level, uint32_t index)
+{
+  uint64_t set = TimerSlotSet[level];
+  uint32_t word;
+
+  if (set == 0U)
+  {
+    return SEQ_TIMER_SLOT_NBR;
+  }
+
+  /* rotate so that bit 0 is the slot index */
+  if (index != 0U)
+  {
+    set = (set >> index) | (set << (SEQ_TIMER_SLOT_NBR - index));
+  }
+
+  word = (uint32_t)set;
+  if (word != 0U)
+  {
+    return SEQ_BitPosition(word & (0U - word));
+  }
+  word = (uint32_t)(set >> 32U);
+  return 32U + SEQ_BitPosition(word & (0U - word));
+}
+
+/**
+  * @brief first tick from a given tick at which a slot has to be processed
+  * @param from first tick to consider
+  * @param p_next tick of the next slot to be processed
+  * @retval 0 if no timer is running, 1 otherwise
+  * @note  It must be called in critical section.
+  */
+static uint32_t SEQ_TimerNextEvent(uint32_t from, uint32_t *p_next)
+{
+  uint32_t found = 0U;
+  uint32_t block;
+  uint32_t distance;
+  uint32_t tick;
+
+  for (uint32_t level = 0U; level < SEQ_TIMER_LEVEL_NBR; level++)
+  {
+    /* first slot of the level starting at or after from */
+    block = (from + (1UL << SEQ_TIMER_SHIFT(level)) - 1U) >> SEQ_TIMER_SHIFT(level);
+    distance = SEQ_TimerNextSlot(level, block & (SEQ_TIMER_SLOT_NBR - 1U));
+    if (distance != SEQ_TIMER_SLOT_NBR)
+    {
+      tick = (block + distance) << SEQ_TIMER_SHIFT(level);
+      if ((found == 0U) || ((int32_t)(tick - *p_next) < 0))
+      {
+        *p_next = tick;
+        found = 1U;
+      }
+    }
+  }
+
+  return found;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
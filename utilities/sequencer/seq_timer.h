@@ -0,0 +1,144 @@
+/**
+  **********************************************************************************************************************
+  * @file    seq_timer.h
+  * @author  MCD Application Team
+  * @brief   sequencer timer interface
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2019-2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+
+/* Define to prevent recursive inclusion -----------------------------------------------------------------------------*/
+#ifndef SEQ_TIMER_H
+#define SEQ_TIMER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "sequencer.h"
+
+/** @addtogroup SEQUENCER
+  * @{
+  */
+
+/** @defgroup SEQUENCER_TIMER sequencer timers
+  * @{
+  */
+
+/* Exported constants ------------------------------------------------------------------------------------------------*/
+/** @defgroup SEQUENCER_TIMER_Exported_const SEQUENCER timer exported constants
+  *  @{
+  */
+
+/**
+  * @brief value returned by SEQ_TimerGetNextDelay() when no timer is running.
+  */
+#define SEQ_TIMER_NO_DELAY      (0xFFFFFFFFU)
+
+/**
+  * @brief number of levels of the timing wheel.
+  */
+#define SEQ_TIMER_LEVEL_NBR     (4U)
+
+/**
+  * @brief number of bits of the slot index inside a level, each level has 2^SEQ_TIMER_SLOT_BITS slots.
+  *
+  * With 4 levels of 64 slots, the wheel covers 2^24 ticks. Longer delays are supported, the timer is
+  * then moved around the last level until its expiry is in range.
+  */
+#define SEQ_TIMER_SLOT_BITS     (6U)
+
+/**
+  * @brief timer tick, a free running 32 bit counter, to be defined in seq_user_conf.h.
+  *
+  * The sequencer does not depend on the HAL, so seq_user_conf.h must also include the header declaring the
+  * counter, for example:
+  * \#include "stm32_hal.h"
+  * \#define SEQ_TIMER_GET_TICK()    HAL_GetTick()
+  * In tickless designs it is typically a LPTIM or RTC based counter.
+  */
+#ifndef SEQ_TIMER_GET_TICK
+#error "SEQ_TIMER_GET_TICK() must be defined in seq_user_conf.h to use the sequencer timers"
+#endif /* SEQ_TIMER_GET_TICK */
+
+/**
+  * @}
+  */
+
+/* Exported types ----------------------------------------------------------------------------------------------------*/
+/** @defgroup SEQUENCER_TIMER_Exported_type SEQUENCER timer exported types
+  *  @{
+  */
+
+/**
+  * @brief  action executed at the expiry of a timer.
+  */
+typedef enum
+{
+  SEQ_TIMER_SET_TASK,  /*!<SEQ_SetTaskIdx() is called. */
+  SEQ_TIMER_SET_EVT,   /*!<SEQ_SetEvt() is called.     */
+} seq_timer_action_t;
+
+/**
+  * @brief  timer, allocated by the application.
+  *
+  * The fields are private to the timer service.
+  */
+typedef struct seq_timer_s
+{
+  struct seq_timer_s *p_next;  /*!<next timer of the slot.                          */
+  struct seq_timer_s *p_prev;  /*!<previous timer of the slot.                      */
+  uint32_t expiry;             /*!<tick of the next expiry.                         */
+  uint32_t period;             /*!<period in ticks, 0 for a one shot timer.         */
+  seq_bm_t id;                 /*!<task index or event bit mapping.                 */
+  uint8_t action;              /*!<value of @ref seq_timer_action_t.                */
+  uint8_t prio;                /*!<priority of the task.                            */
+  uint16_t slot;               /*!<slot of the wheel, SEQ_TIMER_NO_SLOT if stopped. */
+} seq_timer_t;
+
+/**
+  * @}
+  */
+
+/* Exported functions ----------------------------------------------------------------------------------------------- */
+/** @defgroup SEQUENCER_TIMER_Exported_function SEQUENCER timer exported functions
+  *  @{
+  */
+
+void SEQ_TimerInit(void);
+void SEQ_TimerCreateTask(seq_timer_t *p_timer, uint32_t task_idx, uint32_t task_prio);
+void SEQ_TimerCreateEvt(seq_timer_t *p_timer, seq_bm_t evt_id_bm);
+void SEQ_TimerStart(seq_timer_t *p_timer, uint32_t delay, uint32_t period);
+void SEQ_TimerStop(seq_timer_t *p_timer);
+uint32_t SEQ_TimerIsRunning(const seq_timer_t *p_timer);
+void SEQ_TimerProcess(void);
+uint32_t SEQ_TimerGetNextDelay(void);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SEQ_TIMER_H */
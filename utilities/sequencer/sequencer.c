@@ -44,11 +44,18 @@ The main features of sequencers are described below:
 
 /**
   * @brief structure used to manage task scheduling
+  *
+  * For each priority, the tasks ready to be executed are mapped on two levels:
+  *   - ready[] holds one bit per task, 32 tasks per word,
+  *   - summary holds one bit per non empty word of ready[].
+  * Both levels are searched with a count leading zero so that the selection, the set and the clear of a task
+  * do not depend on the number of tasks.
   */
 typedef struct
 {
-  uint32_t priority;    /*!<bit field of the enabled task.          */
-  uint32_t round_robin; /*!<mask on the allowed task to be running. */
+  seq_bm_t ready[SEQ_TASK_BM_NBR]; /*!<bit field of the tasks set and not paused.           */
+  seq_bm_t summary;                /*!<bit field of the non empty words of ready[].         */
+  uint32_t round_robin;            /*!<index of the last task executed with this priority.  */
 } seq_priority_t;
 
 /**
@@ -77,10 +84,24 @@ typedef struct
 #define SEQ_ALL_BIT_SET    (~0U)
 
 
-#if SEQ_CONF_TASK_NBR > 32
-#error "SEQ_CONF_TASK_NBR must be less than or equal to 32"
+/**
+  * @brief word index of a task inside a task bit mapping
+  */
+#define SEQ_BM_WORD(_IDX_)      ((_IDX_) >> 5U)
+
+/**
+  * @brief bit of a task inside its word of a task bit mapping
+  */
+#define SEQ_BM_BIT(_IDX_)       ((seq_bm_t)1U << ((_IDX_) & 31U))
+
+#if SEQ_CONF_TASK_NBR > 1024
+#error "SEQ_CONF_TASK_NBR must be less than or equal to 1024"
 #endif /* SEQ_CONF_TASK_NBR */
 
+#if SEQ_CONF_PRIO_NBR > 32
+#error "SEQ_CONF_PRIO_NBR must be less than or equal to 32"
+#endif /* SEQ_CONF_PRIO_NBR */
+
 /**
   * @}
   */
@@ -94,17 +115,17 @@ typedef struct
 /**
   * @brief task set.
   */
-static volatile seq_bm_t TaskSet;
+static volatile seq_bm_t TaskSet[SEQ_TASK_BM_NBR];
 
 /**
   * @brief task mask.
   */
-static volatile seq_bm_t TaskMask = SEQ_ALL_BIT_SET;
+static volatile seq_bm_t TaskMask[SEQ_TASK_BM_NBR];
 
 /**
   * @brief super mask.
   */
-static seq_bm_t SuperMask = SEQ_ALL_BIT_SET;
+static seq_bm_t SuperMask[SEQ_TASK_BM_NBR];
 
 /**
   * @brief evt set mask.
@@ -126,15 +147,42 @@ static uint32_t CurrentTaskIdx = 0U;
   */
 static void (*TaskCb[SEQ_CONF_TASK_NBR])(void);
 
+/**
+  * @brief priority requested for each task set.
+  */
+static uint8_t TaskPrioIdx[SEQ_CONF_TASK_NBR];
+
 /**
   * @brief task prio management.
   */
-static volatile seq_priority_t TaskPrio[SEQ_CONF_PRIO_NBR];
+static seq_priority_t TaskPrio[SEQ_CONF_PRIO_NBR];
+
+/**
+  * @brief bit field of the priorities having at least one task ready.
+  */
+static seq_bm_t PrioSet = SEQ_NO_BIT_SET;
+
+#if (SEQ_CONF_STATS_ENABLE == 1U)
+/**
+  * @brief runtime statistics of the tasks.
+  */
+static seq_task_stats_t TaskStats[SEQ_CONF_TASK_NBR];
+
+/**
+  * @brief timestamp of the last SEQ_SetTask() of each pending task.
+  */
+static uint32_t TaskSetStamp[SEQ_CONF_TASK_NBR];
+
+/**
+  * @brief runtime statistics of the sequencer.
+  */
+static seq_stats_t SeqStats;
 
 /**
-  * @brief List of the cleared tasks.
+  * @brief timestamp of the last update of SeqStats.total_time.
   */
-static seq_bm_t  TaskClearList = 0;
+static uint32_t SeqStatsStamp;
+#endif /* SEQ_CONF_STATS_ENABLE */
 
 /**
   * @}
@@ -144,7 +192,17 @@ static seq_bm_t  TaskClearList = 0;
 /** @defgroup SEQUENCER_Private_function SEQUENCER private functions
   *  @{
   */
-uint8_t SEQ_BitPosition(uint32_t value);
+static void SEQ_ReadyAdd(uint32_t task_idx);
+static void SEQ_ReadyRemove(uint32_t task_idx);
+static uint32_t SEQ_FindTask(void);
+static void SEQ_SetTaskCore(uint32_t task_idx, uint32_t task_prio);
+static void SEQ_PauseTaskCore(uint32_t task_idx);
+static void SEQ_ResumeTaskCore(uint32_t task_idx);
+static void SEQ_Schedule(void);
+#if (SEQ_CONF_STATS_ENABLE == 1U)
+static uint32_t SEQ_StatsElapsed(void);
+static uint8_t *SEQ_StatsPut(uint8_t *p_dest, uint64_t value, uint32_t size);
+#endif /* SEQ_CONF_STATS_ENABLE */
 
 /**
   * @}
@@ -168,20 +226,27 @@ uint8_t SEQ_BitPosition(uint32_t value);
   */
 void SEQ_Init(void)
 {
-  TaskSet = SEQ_NO_BIT_SET;
-  TaskMask = SEQ_ALL_BIT_SET;
-  SuperMask = SEQ_ALL_BIT_SET;
+  for (uint32_t index = 0; index < SEQ_TASK_BM_NBR; index++)
+  {
+    TaskSet[index] = SEQ_NO_BIT_SET;
+    TaskMask[index] = SEQ_ALL_BIT_SET;
+    SuperMask[index] = SEQ_ALL_BIT_SET;
+  }
   EvtSet = SEQ_NO_BIT_SET;
   EvtWaited = SEQ_NO_BIT_SET;
   CurrentTaskIdx = 0U;
   (void)SEQ_MEMSET8((uint8_t *)TaskCb, 0, sizeof(TaskCb));
+  (void)SEQ_MEMSET8((uint8_t *)TaskPrioIdx, 0, sizeof(TaskPrioIdx));
+  (void)SEQ_MEMSET8((uint8_t *)TaskPrio, 0, sizeof(TaskPrio));
   for (uint32_t index = 0; index < SEQ_CONF_PRIO_NBR; index++)
   {
-    TaskPrio[index].priority = 0;
-    TaskPrio[index].round_robin = 0;
+    TaskPrio[index].round_robin = SEQ_CONF_TASK_NBR;
   }
+  PrioSet = SEQ_NO_BIT_SET;
   SEQ_INIT_CRITICAL_SECTION();
-  TaskClearList = 0;
+#if (SEQ_CONF_STATS_ENABLE == 1U)
+  SEQ_StatsReset();
+#endif /* SEQ_CONF_STATS_ENABLE */
 }
 
 /**
@@ -268,212 +333,67 @@ __WEAK void SEQ_PostIdle(void)
   *        This function must be called in a while loop in the application
   *
   * @param mask_bm list of task (bit mapping) that is be kept in the sequencer list.
+  *        It applies to the tasks 0 to 31. The tasks above are not masked, use SEQ_RunMask() to mask them.
   *
   * @note  It must not be called from an ISR.
   * @note  The construction of the task must take into account the fact that there is no counting / protection
   *        on the activation of the task. Thus, when the task is running, it must perform all the operations
   *        in progress programmed before its call or manage a reprogramming of the task.
   * This function can be nested.
-  * That is the reason why many variables that are used only in that function are declared static.
-  * @note: These variables could have been declared static in the function.
   *
   */
 void SEQ_Run(seq_bm_t mask_bm)
 {
-  uint32_t counter;
-  seq_bm_t current_task_set;
-  seq_bm_t super_mask_backup;
-  seq_bm_t local_taskset;
-  seq_bm_t local_evtset;
-  seq_bm_t local_taskmask;
-  seq_bm_t local_evtwaited;
-  uint32_t round_robin[SEQ_CONF_PRIO_NBR];
-  seq_bm_t task_starving_list;
+  seq_bm_t super_mask_backup[SEQ_TASK_BM_NBR];
 
   /*
    * When this function is nested, the mask to be applied cannot be larger than the first call
    * The mask is always getting smaller and smaller
    * A copy is made of the mask set by SEQ_Run() in case it is called again in the task
    */
-  super_mask_backup = SuperMask;
-  SuperMask &= mask_bm;
-
-  /*
-   * There are two independent mask to check:
-   * TaskMask that comes from SEQ_PauseTask() / SEQ_ResumeTask
-   * SuperMask that comes from SEQ_Run
-   * If the waited event is there, exit from  SEQ_Run() to return to the
-   * waiting task
-   */
-  local_taskset = TaskSet;
-  local_evtset = EvtSet;
-  local_taskmask = TaskMask;
-  local_evtwaited = EvtWaited;
-  while (((local_taskset & local_taskmask & SuperMask) != 0U) && ((local_evtset & local_evtwaited) == 0U))
+  for (uint32_t index = 0; index < SEQ_TASK_BM_NBR; index++)
   {
-    counter = 0U;
-    /*
-     * When a flag is set, the associated bit is set in TaskPrio[counter].priority mask depending
-     * on the priority parameter given from SEQ_SetTask()
-     * The while loop is looking for a flag set from the highest priority mask to the lower
-     */
-    while ((TaskPrio[counter].priority & local_taskmask & SuperMask) == 0U)
-    {
-      counter++;
-    }
-
-    current_task_set = TaskPrio[counter].priority & local_taskmask & SuperMask;
-
-    /*
-     * The round_robin register is a mask of allowed flags to be evaluated.
-     * The concept is to make sure that on each round on SEQ_Run(), if two same flags are always set,
-     * the sequencer does not run always only the first one.
-     * When a task has been executed, The flag is removed from the round_robin mask.
-     * If on the next SEQ_RUN(), the two same flags are set again, the round_robin mask will
-     * mask out the first flag so that the second one can be executed.
-     * Note that the first flag is not removed from the list of pending task but just masked by
-     * the round_robin mask
-     *
-     * In the check below, the round_robin mask is reinitialize in case all pending
-     * tasks haven been executed at least once
-     */
-    if ((TaskPrio[counter].round_robin & current_task_set) == 0U)
-    {
-      TaskPrio[counter].round_robin = SEQ_ALL_BIT_SET;
-    }
-
-    /*
-     * Compute the Stack Starving List
-     * This is the list of the task that have been set at least once minus one that have been cleared ar least once
-     */
-    task_starving_list = TaskSet;
-
-    /*
-     * Due to the concept of TaskPrio[counter].round_robin and TaskClearList, it could be that at some points in time,
-     * (when using SEQ_WaitEvt()), that there is a situation where at the same time, a bit is set in
-     * TaskPrio[counter].round_robin and reset in TaskClearList and another bit is set in TaskClearList and reset in
-     * TaskPrio[counter].round_robin.
-     * Such situation must not happen when evaluating task_starving_list
-     * At any time, there must not be any bit reset in TaskPrio[counter].round_robin and reset in TaskClearList
-     * It is correct with regard to the Sequencer Architecture to set in TaskClearList all tasks that are said to be
-     * executed from TaskPrio[counter].round_robin.
-     * This synchronizes both information before calculating the CurrentTaskIdx
-     */
-    TaskClearList |= (~TaskPrio[counter].round_robin);
-
-    task_starving_list &= (~TaskClearList);
-
-    /*
-     * Consider first the starving list and update current_task_set accordingly
-     */
-    if ((task_starving_list & current_task_set) != 0U)
-    {
-      current_task_set = (task_starving_list & current_task_set);
-    }
-    else
-    {
-      /* nothing to go */
-    }
-
-    /*
-     * Reinitialize the Starving List if required
-     */
-    if (task_starving_list == 0U)
-    {
-      TaskClearList = 0;
-    }
-
-    /*
-     * Read the flag index of the task to be executed
-     * Once the index is read, the associated task will be executed even though a higher priority stack is requested
-     * before task execution.
-     */
-    CurrentTaskIdx = (SEQ_BitPosition(current_task_set & TaskPrio[counter].round_robin));
-
-    SEQ_ENTER_CRITICAL_SECTION();
-    /* remove from the list or pending task the one that has been selected to be executed */
-    TaskSet &= ~(1U << CurrentTaskIdx);
-    /* remove from all priority mask the task that has been selected to be executed */
-    for (counter = SEQ_CONF_PRIO_NBR; counter != 0U; counter--)
-    {
-      TaskPrio[counter - 1U].priority &= ~(1U << CurrentTaskIdx);
-    }
-    SEQ_EXIT_CRITICAL_SECTION();
-
-    SEQ_PreTask(CurrentTaskIdx);
-
-    /*
-     * Check that function exists before calling it
-     */
-    if ((CurrentTaskIdx < SEQ_CONF_TASK_NBR) && (TaskCb[CurrentTaskIdx] != NULL))
-    {
-      /*
-       * save the round-robin value to take into account the operation done in SEQ_WaitEvt
-       */
-      for (uint32_t index = 0; index < SEQ_CONF_PRIO_NBR; index++)
-      {
-        TaskPrio[index].round_robin &= ~(1UL << CurrentTaskIdx);
-        round_robin[index] = TaskPrio[index].round_robin;
-      }
-
-      /* Execute the task */
-      TaskCb[CurrentTaskIdx]();
+    super_mask_backup[index] = SuperMask[index];
+  }
+  SuperMask[0] &= mask_bm;
 
-      /*
-       * restore the round-robin context
-       */
-      for (uint32_t index = 0; index < SEQ_CONF_PRIO_NBR; index++)
-      {
-        TaskPrio[index].round_robin &= round_robin[index];
-      }
+  SEQ_Schedule();
 
-      SEQ_PostTask(CurrentTaskIdx);
+  /* restore the mask from SEQ_Run() */
+  for (uint32_t index = 0; index < SEQ_TASK_BM_NBR; index++)
+  {
+    SuperMask[index] = super_mask_backup[index];
+  }
 
-      local_taskset = TaskSet;
-      local_evtset = EvtSet;
-      local_taskmask = TaskMask;
-      local_evtwaited = EvtWaited;
+  return;
+}
 
-      /*
-       * Update the two list for next round
-       */
-      TaskClearList |= (uint32_t)(1U) << CurrentTaskIdx;
-    }
-    else
-    {
-      /*
-       * must never occurs, it means there is a warning in the system
-       */
-      SEQ_CatchWarning(SEQ_WARNING_INVALIDTASKID);
-    }
-  }
+/**
+  * @brief This function is identical to SEQ_Run() with a mask covering all the tasks.
+  *
+  * @param mask_bm list of task (bit mapping) that is be kept in the sequencer list.
+  *        It is an array of SEQ_TASK_BM_NBR words, bit n of word w being the task 32 * w + n.
+  *
+  * @note  It must not be called from an ISR.
+  *
+  */
+void SEQ_RunMask(const seq_bm_t *mask_bm)
+{
+  seq_bm_t super_mask_backup[SEQ_TASK_BM_NBR];
 
-  /* the set of CurrentTaskIdx to no task running allows to call WaitEvt in the Pre/Post idle context */
-  CurrentTaskIdx = SEQ_NOTASKRUNNING;
-  /* if a waited event is present, ignore the IDLE sequence */
-  if ((local_evtset & EvtWaited) == 0U)
+  for (uint32_t index = 0; index < SEQ_TASK_BM_NBR; index++)
   {
-    SEQ_PreIdle();
+    super_mask_backup[index] = SuperMask[index];
+    SuperMask[index] &= mask_bm[index];
+  }
 
-    SEQ_ENTER_CRITICAL_SECTION_IDLE();
-    local_taskset = TaskSet;
-    local_evtset = EvtSet;
-    local_taskmask = TaskMask;
-    if ((local_taskset & local_taskmask & SuperMask) == 0U)
-    {
-      if ((local_evtset & EvtWaited) == 0U)
-      {
-        SEQ_Idle();
-      }
-    }
-    SEQ_EXIT_CRITICAL_SECTION_IDLE();
+  SEQ_Schedule();
 
-    SEQ_PostIdle();
+  for (uint32_t index = 0; index < SEQ_TASK_BM_NBR; index++)
+  {
+    SuperMask[index] = super_mask_backup[index];
   }
 
-  /* restore the mask from SEQ_Run() */
-  SuperMask = super_mask_backup;
-
   return;
 }
 
@@ -495,13 +415,29 @@ void SEQ_Run(seq_bm_t mask_bm)
   *
   */
 void SEQ_RegTask(seq_task_id_t task_id_bm, uint32_t flags, void (*task)(void))
+{
+  SEQ_RegTaskIdx(SEQ_BitPosition((uint32_t)task_id_bm), flags, task);
+
+  return;
+}
+
+/**
+  * @brief This function registers a task in the sequencer from its index.
+  *
+  * @param task_idx The index of the task, from 0 to SEQ_CONF_TASK_NBR - 1
+  * @param flags flags are reserved parameter for future use
+  * @param task Reference of the function to be executed
+  *
+  * @note  It can be called from an ISR.
+  *
+  */
+void SEQ_RegTaskIdx(uint32_t task_idx, uint32_t flags, void (*task)(void))
 {
   (void)flags;
   SEQ_ENTER_CRITICAL_SECTION();
-  uint32_t position = SEQ_BitPosition((uint32_t)task_id_bm);
-  if (position < SEQ_CONF_TASK_NBR)
+  if (task_idx < SEQ_CONF_TASK_NBR)
   {
-    TaskCb[position] = task;
+    TaskCb[task_idx] = task;
   }
   SEQ_EXIT_CRITICAL_SECTION();
 
@@ -515,13 +451,23 @@ void SEQ_RegTask(seq_task_id_t task_id_bm, uint32_t flags, void (*task)(void))
   * @retval 0 if not 1 if true
   */
 uint32_t SEQ_IsRegisteredTask(seq_task_id_t task_id_bm)
+{
+  return SEQ_IsRegisteredTaskIdx(SEQ_BitPosition((uint32_t)task_id_bm));
+}
+
+/**
+  * @brief This function checks if a task is registered from its index
+  *
+  * @param task_idx The index of the task, from 0 to SEQ_CONF_TASK_NBR - 1
+  * @retval 0 if not 1 if true
+  */
+uint32_t SEQ_IsRegisteredTaskIdx(uint32_t task_idx)
 {
   uint32_t status = 0;
   SEQ_ENTER_CRITICAL_SECTION();
-  uint32_t position = SEQ_BitPosition((uint32_t)task_id_bm);
-  if (position < SEQ_CONF_TASK_NBR)
+  if (task_idx < SEQ_CONF_TASK_NBR)
   {
-    if (TaskCb[position] != NULL)
+    if (TaskCb[task_idx] != NULL)
     {
       status = 1;
     }
@@ -544,7 +490,7 @@ uint32_t SEQ_IsRegisteredTask(seq_task_id_t task_id_bm)
   *
   * @param task_id_bm The Id of the task, this parameter must be a value of the enumeration @ref seq_task_id_t
   * @param task_prio The priority of the task
-  *        It must a number from  0 (high priority) to 31 (low priority)
+  *        It must a number from  0 (high priority) to SEQ_CONF_PRIO_NBR - 1 (low priority)
   *        The priority is checked each time the sequencer needs to select a new task to execute
   *        It does not permit to preempt a running task with lower priority
   *
@@ -553,10 +499,59 @@ uint32_t SEQ_IsRegisteredTask(seq_task_id_t task_id_bm)
   */
 void SEQ_SetTask(seq_task_id_t task_id_bm, uint32_t task_prio)
 {
+  uint32_t task_bm = (uint32_t)task_id_bm;
+  uint32_t task_idx;
+
+  if (task_prio >= SEQ_CONF_PRIO_NBR)
+  {
+    SEQ_CatchWarning(SEQ_WARNING_INVALIDPRIO);
+    return;
+  }
+
+  SEQ_ENTER_CRITICAL_SECTION();
+
+  while (task_bm != 0U)
+  {
+    task_idx = SEQ_BitPosition(task_bm);
+    task_bm &= ~((uint32_t)1U << task_idx);
+    if (task_idx < SEQ_CONF_TASK_NBR)
+    {
+      SEQ_SetTaskCore(task_idx, task_prio);
+    }
+  }
+
+  SEQ_EXIT_CRITICAL_SECTION();
+
+  return;
+}
+
+/**
+  * @brief This function requests a task to be executed from its index
+  *
+  * @param task_idx The index of the task, from 0 to SEQ_CONF_TASK_NBR - 1
+  * @param task_prio The priority of the task, from 0 (high priority) to SEQ_CONF_PRIO_NBR - 1 (low priority)
+  *
+  * @note   When a task is set several times before being executed, it is executed once with the highest
+  *         priority requested.
+  * @note   It can be called from an ISR
+  *
+  */
+void SEQ_SetTaskIdx(uint32_t task_idx, uint32_t task_prio)
+{
+  if (task_idx >= SEQ_CONF_TASK_NBR)
+  {
+    SEQ_CatchWarning(SEQ_WARNING_INVALIDTASKID);
+    return;
+  }
+  if (task_prio >= SEQ_CONF_PRIO_NBR)
+  {
+    SEQ_CatchWarning(SEQ_WARNING_INVALIDPRIO);
+    return;
+  }
+
   SEQ_ENTER_CRITICAL_SECTION();
 
-  TaskSet |= (seq_bm_t)task_id_bm;
-  TaskPrio[task_prio].priority |= (uint32_t)task_id_bm;
+  SEQ_SetTaskCore(task_idx, task_prio);
 
   SEQ_EXIT_CRITICAL_SECTION();
 
@@ -579,14 +574,41 @@ uint32_t SEQ_IsSchedulableTask(seq_task_id_t task_id_bm)
 
   SEQ_ENTER_CRITICAL_SECTION();
 
-  local_taskset = TaskSet;
-  _status = ((local_taskset & TaskMask & SuperMask & ((seq_bm_t)task_id_bm)) == ((seq_bm_t)task_id_bm)) \
+  local_taskset = TaskSet[0];
+  _status = ((local_taskset & TaskMask[0] & SuperMask[0] & ((seq_bm_t)task_id_bm)) == ((seq_bm_t)task_id_bm)) \
             ? 1U : 0U;
 
   SEQ_EXIT_CRITICAL_SECTION();
   return _status;
 }
 
+/**
+  * @brief This function checks if a task could be scheduled from its index.
+  *
+  * @param task_idx The index of the task, from 0 to SEQ_CONF_TASK_NBR - 1
+  * @retval 0 if not 1 if true
+  *
+  * @note   It can be called from an ISR.
+  *
+  */
+uint32_t SEQ_IsSchedulableTaskIdx(uint32_t task_idx)
+{
+  uint32_t _status = 0U;
+  seq_bm_t local_taskset;
+
+  if (task_idx < SEQ_CONF_TASK_NBR)
+  {
+    SEQ_ENTER_CRITICAL_SECTION();
+
+    local_taskset = TaskSet[SEQ_BM_WORD(task_idx)];
+    _status = ((local_taskset & TaskMask[SEQ_BM_WORD(task_idx)] & SuperMask[SEQ_BM_WORD(task_idx)]
+                & SEQ_BM_BIT(task_idx)) != 0U) ? 1U : 0U;
+
+    SEQ_EXIT_CRITICAL_SECTION();
+  }
+  return _status;
+}
+
 /**
   * @}
   */
@@ -606,15 +628,48 @@ uint32_t SEQ_IsSchedulableTask(seq_task_id_t task_id_bm)
   */
 void SEQ_PauseTask(seq_task_id_t task_id_bm)
 {
+  uint32_t task_bm = (uint32_t)task_id_bm;
+  uint32_t task_idx;
+
   SEQ_ENTER_CRITICAL_SECTION();
 
-  TaskMask &= ((seq_bm_t)(~task_id_bm));
+  while (task_bm != 0U)
+  {
+    task_idx = SEQ_BitPosition(task_bm);
+    task_bm &= ~((uint32_t)1U << task_idx);
+    if (task_idx < SEQ_CONF_TASK_NBR)
+    {
+      SEQ_PauseTaskCore(task_idx);
+    }
+  }
 
   SEQ_EXIT_CRITICAL_SECTION();
 
   return;
 }
 
+/**
+  * @brief This function prevents a task to be called by the sequencer from its index
+  *
+  * @param task_idx The index of the task, from 0 to SEQ_CONF_TASK_NBR - 1
+  *
+  * @note  It can be called from an ISR.
+  *
+  */
+void SEQ_PauseTaskIdx(uint32_t task_idx)
+{
+  if (task_idx < SEQ_CONF_TASK_NBR)
+  {
+    SEQ_ENTER_CRITICAL_SECTION();
+
+    SEQ_PauseTaskCore(task_idx);
+
+    SEQ_EXIT_CRITICAL_SECTION();
+  }
+
+  return;
+}
+
 /**
   * @brief This function allows to know if the task has been put in pause.
   *        By default, all tasks are executed by the sequencer when set with SEQ_SetTask()
@@ -630,12 +685,31 @@ uint32_t SEQ_IsPauseTask(seq_task_id_t task_id_bm)
   uint32_t _status;
   SEQ_ENTER_CRITICAL_SECTION();
 
-  _status = ((TaskMask & ((seq_bm_t)task_id_bm)) == ((seq_bm_t)task_id_bm)) ? 0U : 1U;
+  _status = ((TaskMask[0] & ((seq_bm_t)task_id_bm)) == ((seq_bm_t)task_id_bm)) ? 0U : 1U;
 
   SEQ_EXIT_CRITICAL_SECTION();
   return _status;
 }
 
+/**
+  * @brief This function allows to know if the task has been put in pause from its index.
+  *
+  * @param task_idx The index of the task, from 0 to SEQ_CONF_TASK_NBR - 1
+  * @retval 0 if not 1 if true
+  * @note  It can be called from an ISR.
+  *
+  */
+uint32_t SEQ_IsPauseTaskIdx(uint32_t task_idx)
+{
+  uint32_t _status = 0U;
+
+  if (task_idx < SEQ_CONF_TASK_NBR)
+  {
+    _status = ((TaskMask[SEQ_BM_WORD(task_idx)] & SEQ_BM_BIT(task_idx)) != 0U) ? 0U : 1U;
+  }
+  return _status;
+}
+
 /**
   * @brief This function allows again a task to be called by the sequencer if set with SEQ_SetTask()
   *        This is used in relation with SEQ_PauseTask()
@@ -647,14 +721,48 @@ uint32_t SEQ_IsPauseTask(seq_task_id_t task_id_bm)
   */
 void SEQ_ResumeTask(seq_task_id_t task_id_bm)
 {
+  uint32_t task_bm = (uint32_t)task_id_bm;
+  uint32_t task_idx;
+
   SEQ_ENTER_CRITICAL_SECTION();
 
-  TaskMask |= ((seq_bm_t)task_id_bm);
+  while (task_bm != 0U)
+  {
+    task_idx = SEQ_BitPosition(task_bm);
+    task_bm &= ~((uint32_t)1U << task_idx);
+    if (task_idx < SEQ_CONF_TASK_NBR)
+    {
+      SEQ_ResumeTaskCore(task_idx);
+    }
+  }
 
   SEQ_EXIT_CRITICAL_SECTION();
 
   return;
 }
+
+/**
+  * @brief This function allows again a task to be called by the sequencer from its index
+  *        This is used in relation with SEQ_PauseTaskIdx()
+  *
+  * @param task_idx The index of the task, from 0 to SEQ_CONF_TASK_NBR - 1
+  *
+  * @note  It can be called from an ISR.
+  *
+  */
+void SEQ_ResumeTaskIdx(uint32_t task_idx)
+{
+  if (task_idx < SEQ_CONF_TASK_NBR)
+  {
+    SEQ_ENTER_CRITICAL_SECTION();
+
+    SEQ_ResumeTaskCore(task_idx);
+
+    SEQ_EXIT_CRITICAL_SECTION();
+  }
+
+  return;
+}
 /**
   * @}
   */
@@ -731,6 +839,17 @@ void SEQ_WaitEvt(seq_bm_t evt_id_bm)
   {
     wait_task_idx = 0U;
   }
+#if SEQ_CONF_TASK_NBR > 32
+  else if (CurrentTaskIdx >= 32U)
+  {
+    /*
+     * The task cannot be given to SEQ_EvtIdle() in a 32 bit mapping,
+     * so it is removed from the super mask until the event is received
+     */
+    wait_task_idx = 0U;
+    SuperMask[SEQ_BM_WORD(current_task_idx)] &= ~SEQ_BM_BIT(current_task_idx);
+  }
+#endif /* SEQ_CONF_TASK_NBR */
   else
   {
     wait_task_idx = (uint32_t)1U << CurrentTaskIdx;
@@ -759,6 +878,12 @@ void SEQ_WaitEvt(seq_bm_t evt_id_bm)
    * in the same process pass the correct current_task_id_bm in the call of SEQ_EvtIdle()
    */
   CurrentTaskIdx = current_task_idx;
+#if SEQ_CONF_TASK_NBR > 32
+  if ((current_task_idx != SEQ_NOTASKRUNNING) && (current_task_idx >= 32U))
+  {
+    SuperMask[SEQ_BM_WORD(current_task_idx)] |= SEQ_BM_BIT(current_task_idx);
+  }
+#endif /* SEQ_CONF_TASK_NBR */
 
   SEQ_ENTER_CRITICAL_SECTION();
 
@@ -860,6 +985,170 @@ __WEAK void SEQ_CatchWarning(seq_warning_t warning_id)
 /**
   * @}
   */
+
+#if (SEQ_CONF_STATS_ENABLE == 1U)
+/** @addtogroup SEQUENCER_Exported_function_G9 Statistics functions
+  * @{
+  */
+
+/**
+  * @brief This function clears the runtime statistics and restarts the timestamp counter.
+  *
+  * @note  It is called by SEQ_Init(). It must not be called from an ISR.
+  *
+  */
+void SEQ_StatsReset(void)
+{
+  SEQ_ENTER_CRITICAL_SECTION();
+
+  (void)SEQ_MEMSET8((uint8_t *)TaskStats, 0, sizeof(TaskStats));
+  (void)SEQ_MEMSET8((uint8_t *)&SeqStats, 0, sizeof(SeqStats));
+  SEQ_STATS_INIT_TIMESTAMP();
+  SeqStatsStamp = SEQ_STATS_TIMESTAMP();
+
+  SEQ_EXIT_CRITICAL_SECTION();
+
+  return;
+}
+
+/**
+  * @brief This function returns the runtime statistics of the sequencer.
+  *        The idle share is p_stats->idle_time / p_stats->total_time.
+  *
+  * @param p_stats pointer to the statistics to be filled
+  *
+  * @note  It must not be called from an ISR.
+  *
+  */
+void SEQ_StatsGet(seq_stats_t *p_stats)
+{
+  SEQ_ENTER_CRITICAL_SECTION();
+
+  (void)SEQ_StatsElapsed();
+  *p_stats = SeqStats;
+
+  SEQ_EXIT_CRITICAL_SECTION();
+
+  return;
+}
+
+/**
+  * @brief This function returns a snapshot of the runtime statistics of a task.
+  *
+  * @param task_idx The index of the task, from 0 to SEQ_CONF_TASK_NBR - 1
+  * @param p_stats pointer to the statistics to be filled
+  * @retval 0 if the task index is invalid, 1 otherwise
+  *
+  * @note  It can be called from an ISR.
+  *
+  */
+uint32_t SEQ_StatsGetTask(uint32_t task_idx, seq_task_stats_t *p_stats)
+{
+  uint32_t status = 0U;
+
+  if (task_idx < SEQ_CONF_TASK_NBR)
+  {
+    SEQ_ENTER_CRITICAL_SECTION();
+
+    *p_stats = TaskStats[task_idx];
+
+    SEQ_EXIT_CRITICAL_SECTION();
+    status = 1U;
+  }
+  return status;
+}
+
+/**
+  * @brief This function writes the runtime statistics in a compact binary format for offline analysis.
+  *
+  * All fields are little endian:
+  *   - header:        "SEQS" (4 bytes), version = 1 (1 byte), SEQ_CONF_STATS_HIST_NBR (1 byte),
+  *                    SEQ_CONF_TASK_NBR (2 bytes), total_time (8 bytes), idle_time (8 bytes)
+  *   - one record for each task executed at least once:
+  *                    task index (2 bytes), number n of histogram bins up to the last non null one (1 byte),
+  *                    reserved (1 byte), run_count (4 bytes), max_runtime (4 bytes), total_runtime (8 bytes),
+  *                    n histogram bins (4 bytes each)
+  *
+  * @param p_buffer pointer to the destination buffer, or NULL to get the size needed
+  * @param size size of the destination buffer in bytes
+  * @retval number of bytes written, only complete records are written.
+  *         When p_buffer is NULL, number of bytes needed to dump all the statistics.
+  *
+  * @note  It must not be called from an ISR.
+  *
+  */
+uint32_t SEQ_StatsDump(uint8_t *p_buffer, uint32_t size)
+{
+  seq_task_stats_t task_stats;
+  seq_stats_t seq_stats;
+  uint8_t *p_dest = p_buffer;
+  uint32_t length = 0U;
+  uint32_t record;
+  uint32_t bins;
+
+  SEQ_StatsGet(&seq_stats);
+
+  record = 24U;
+  if (p_buffer != NULL)
+  {
+    if (size < record)
+    {
+      return 0U;
+    }
+    *p_dest++ = (uint8_t)'S';
+    *p_dest++ = (uint8_t)'E';
+    *p_dest++ = (uint8_t)'Q';
+    *p_dest++ = (uint8_t)'S';
+    p_dest = SEQ_StatsPut(p_dest, 1U, 1U);
+    p_dest = SEQ_StatsPut(p_dest, SEQ_CONF_STATS_HIST_NBR, 1U);
+    p_dest = SEQ_StatsPut(p_dest, SEQ_CONF_TASK_NBR, 2U);
+    p_dest = SEQ_StatsPut(p_dest, seq_stats.total_time, 8U);
+    p_dest = SEQ_StatsPut(p_dest, seq_stats.idle_time, 8U);
+  }
+  length += record;
+
+  for (uint32_t task_idx = 0U; task_idx < SEQ_CONF_TASK_NBR; task_idx++)
+  {
+    (void)SEQ_StatsGetTask(task_idx, &task_stats);
+    if (task_stats.run_count == 0U)
+    {
+      continue;
+    }
+
+    bins = SEQ_CONF_STATS_HIST_NBR;
+    while ((bins != 0U) && (task_stats.wait_hist[bins - 1U] == 0U))
+    {
+      bins--;
+    }
+    record = 20U + (4U * bins);
+
+    if (p_buffer != NULL)
+    {
+      if ((length + record) > size)
+      {
+        break;
+      }
+      p_dest = SEQ_StatsPut(p_dest, task_idx, 2U);
+      p_dest = SEQ_StatsPut(p_dest, bins, 1U);
+      p_dest = SEQ_StatsPut(p_dest, 0U, 1U);
+      p_dest = SEQ_StatsPut(p_dest, task_stats.run_count, 4U);
+      p_dest = SEQ_StatsPut(p_dest, task_stats.max_runtime, 4U);
+      p_dest = SEQ_StatsPut(p_dest, task_stats.total_runtime, 8U);
+      for (uint32_t bin = 0U; bin < bins; bin++)
+      {
+        p_dest = SEQ_StatsPut(p_dest, task_stats.wait_hist[bin], 4U);
+      }
+    }
+    length += record;
+  }
+
+  return length;
+}
+
+/**
+  * @}
+  */
+#endif /* SEQ_CONF_STATS_ENABLE */
 /**
   * @}
  */
@@ -867,6 +1156,337 @@ __WEAK void SEQ_CatchWarning(seq_warning_t warning_id)
   *  @{
   */
 
+/**
+  * @brief add a task set and not paused to the ready list of its priority
+  * @param task_idx task index
+  * @note  It must be called in critical section.
+  */
+static void SEQ_ReadyAdd(uint32_t task_idx)
+{
+  uint32_t prio = TaskPrioIdx[task_idx];
+  uint32_t word = SEQ_BM_WORD(task_idx);
+
+  TaskPrio[prio].ready[word] |= SEQ_BM_BIT(task_idx);
+  TaskPrio[prio].summary |= (seq_bm_t)1U << word;
+  PrioSet |= (seq_bm_t)1U << prio;
+}
+
+/**
+  * @brief remove a task from the ready list of its priority
+  * @param task_idx task index
+  * @note  It must be called in critical section.
+  */
+static void SEQ_ReadyRemove(uint32_t task_idx)
+{
+  uint32_t prio = TaskPrioIdx[task_idx];
+  uint32_t word = SEQ_BM_WORD(task_idx);
+
+  TaskPrio[prio].ready[word] &= ~SEQ_BM_BIT(task_idx);
+  if (TaskPrio[prio].ready[word] == 0U)
+  {
+    TaskPrio[prio].summary &= ~((seq_bm_t)1U << word);
+    if (TaskPrio[prio].summary == 0U)
+    {
+      PrioSet &= ~((seq_bm_t)1U << prio);
+    }
+  }
+}
+
+/**
+  * @brief look for the next task to be executed
+  *
+  * The highest priority having a ready task is selected, then inside this priority the tasks are executed
+  * in round robin from the highest index to the lowest one: the search starts below the last task executed
+  * with this priority and wraps around.
+  * Without restriction from SEQ_Run() mask, the first word found in the summary has a ready task so the
+  * search does not depend on the number of tasks.
+  *
+  * @retval task index or SEQ_NOTASKRUNNING when no task can be executed
+  * @note  It must be called in critical section.
+  */
+static uint32_t SEQ_FindTask(void)
+{
+  seq_bm_t prio_set = PrioSet;
+  seq_bm_t summary;
+  seq_bm_t bits;
+  uint32_t prio;
+  uint32_t last;
+  uint32_t word;
+
+  while (prio_set != 0U)
+  {
+    /* lowest priority value is the highest priority */
+    prio = SEQ_BitPosition(prio_set & (0U - prio_set));
+    prio_set &= ~((seq_bm_t)1U << prio);
+
+    /* tasks below the last one executed in the same word */
+    last = TaskPrio[prio].round_robin;
+    word = SEQ_BM_WORD(last);
+    if (word < SEQ_TASK_BM_NBR)
+    {
+      bits = TaskPrio[prio].ready[word] & SuperMask[word] & (SEQ_BM_BIT(last) - 1U);
+      if (bits != 0U)
+      {
+        return ((word << 5U) + SEQ_BitPosition(bits));
+      }
+      summary = TaskPrio[prio].summary & (((seq_bm_t)1U << word) - 1U);
+    }
+    else
+    {
+      summary = TaskPrio[prio].summary;
+    }
+
+    /* tasks in the words below, then wrap around on all words */
+    for (uint32_t pass = 0U; pass < 2U; pass++)
+    {
+      while (summary != 0U)
+      {
+        word = SEQ_BitPosition(summary);
+        summary &= ~((seq_bm_t)1U << word);
+        bits = TaskPrio[prio].ready[word] & SuperMask[word];
+        if (bits != 0U)
+        {
+          return ((word << 5U) + SEQ_BitPosition(bits));
+        }
+      }
+      summary = TaskPrio[prio].summary;
+    }
+  }
+
+  return SEQ_NOTASKRUNNING;
+}
+
+/**
+  * @brief set a task
+  * @param task_idx task index
+  * @param task_prio task priority
+  * @note  It must be called in critical section.
+  */
+static void SEQ_SetTaskCore(uint32_t task_idx, uint32_t task_prio)
+{
+  uint32_t word = SEQ_BM_WORD(task_idx);
+  seq_bm_t bit = SEQ_BM_BIT(task_idx);
+  uint32_t paused = ((TaskMask[word] & bit) == 0U) ? 1U : 0U;
+
+  if ((TaskSet[word] & bit) == 0U)
+  {
+    TaskSet[word] |= bit;
+    TaskPrioIdx[task_idx] = (uint8_t)task_prio;
+#if (SEQ_CONF_STATS_ENABLE == 1U)
+    TaskSetStamp[task_idx] = SEQ_STATS_TIMESTAMP();
+#endif /* SEQ_CONF_STATS_ENABLE */
+    if (paused == 0U)
+    {
+      SEQ_ReadyAdd(task_idx);
+    }
+  }
+  else if (task_prio < TaskPrioIdx[task_idx])
+  {
+    /* already set with a lower priority: the task is moved to the highest one */
+    if (paused == 0U)
+    {
+      SEQ_ReadyRemove(task_idx);
+    }
+    TaskPrioIdx[task_idx] = (uint8_t)task_prio;
+    if (paused == 0U)
+    {
+      SEQ_ReadyAdd(task_idx);
+    }
+  }
+  else
+  {
+    /* nothing to do */
+  }
+}
+
+/**
+  * @brief pause a task
+  * @param task_idx task index
+  * @note  It must be called in critical section.
+  */
+static void SEQ_PauseTaskCore(uint32_t task_idx)
+{
+  uint32_t word = SEQ_BM_WORD(task_idx);
+  seq_bm_t bit = SEQ_BM_BIT(task_idx);
+
+  if ((TaskMask[word] & bit) != 0U)
+  {
+    TaskMask[word] &= ~bit;
+    if ((TaskSet[word] & bit) != 0U)
+    {
+      SEQ_ReadyRemove(task_idx);
+    }
+  }
+}
+
+/**
+  * @brief resume a task
+  * @param task_idx task index
+  * @note  It must be called in critical section.
+  */
+static void SEQ_ResumeTaskCore(uint32_t task_idx)
+{
+  uint32_t word = SEQ_BM_WORD(task_idx);
+  seq_bm_t bit = SEQ_BM_BIT(task_idx);
+
+  if ((TaskMask[word] & bit) == 0U)
+  {
+    TaskMask[word] |= bit;
+    if ((TaskSet[word] & bit) != 0U)
+    {
+      SEQ_ReadyAdd(task_idx);
+    }
+  }
+}
+
+/**
+  * @brief execute the pending tasks allowed by the super mask, then enter idle
+  */
+static void SEQ_Schedule(void)
+{
+  uint32_t task_idx;
+
+  /*
+   * There are two independent mask to check:
+   * TaskMask that comes from SEQ_PauseTask() / SEQ_ResumeTask, paused tasks are not in the ready lists
+   * SuperMask that comes from SEQ_Run
+   * If the waited event is there, exit from  SEQ_Run() to return to the
+   * waiting task
+   */
+  while ((EvtSet & EvtWaited) == 0U)
+  {
+    /*
+     * Select the task and remove it from the list of pending tasks in the same critical section.
+     * Once the index is read, the associated task will be executed even though a higher priority task is requested
+     * before task execution.
+     */
+    SEQ_ENTER_CRITICAL_SECTION();
+    task_idx = SEQ_FindTask();
+    if (task_idx != SEQ_NOTASKRUNNING)
+    {
+      SEQ_ReadyRemove(task_idx);
+      TaskSet[SEQ_BM_WORD(task_idx)] &= ~SEQ_BM_BIT(task_idx);
+      TaskPrio[TaskPrioIdx[task_idx]].round_robin = task_idx;
+    }
+    SEQ_EXIT_CRITICAL_SECTION();
+
+    if (task_idx == SEQ_NOTASKRUNNING)
+    {
+      break;
+    }
+
+    CurrentTaskIdx = task_idx;
+
+    SEQ_PreTask(CurrentTaskIdx);
+
+    /*
+     * Check that function exists before calling it
+     */
+    if (TaskCb[CurrentTaskIdx] != NULL)
+    {
+#if (SEQ_CONF_STATS_ENABLE == 1U)
+      uint32_t start;
+      uint32_t runtime;
+      uint32_t bin;
+
+      /* wait latency, the bin is the number of significant bits of the wait */
+      (void)SEQ_StatsElapsed();
+      start = SeqStatsStamp;
+      runtime = start - TaskSetStamp[task_idx];
+      bin = (runtime == 0U) ? 0U : ((uint32_t)SEQ_BitPosition(runtime) + 1U);
+      if (bin >= SEQ_CONF_STATS_HIST_NBR)
+      {
+        bin = SEQ_CONF_STATS_HIST_NBR - 1U;
+      }
+      TaskStats[task_idx].wait_hist[bin]++;
+#endif /* SEQ_CONF_STATS_ENABLE */
+
+      /* Execute the task */
+      TaskCb[CurrentTaskIdx]();
+
+#if (SEQ_CONF_STATS_ENABLE == 1U)
+      /* the tasks executed by a nested SEQ_Run() are counted in the runtime of this task */
+      (void)SEQ_StatsElapsed();
+      runtime = SeqStatsStamp - start;
+      TaskStats[task_idx].run_count++;
+      TaskStats[task_idx].total_runtime += runtime;
+      if (runtime > TaskStats[task_idx].max_runtime)
+      {
+        TaskStats[task_idx].max_runtime = runtime;
+      }
+#endif /* SEQ_CONF_STATS_ENABLE */
+
+      SEQ_PostTask(CurrentTaskIdx);
+    }
+    else
+    {
+      /*
+       * must never occurs, it means there is a warning in the system
+       */
+      SEQ_CatchWarning(SEQ_WARNING_INVALIDTASKID);
+    }
+  }
+
+  /* the set of CurrentTaskIdx to no task running allows to call WaitEvt in the Pre/Post idle context */
+  CurrentTaskIdx = SEQ_NOTASKRUNNING;
+  /* if a waited event is present, ignore the IDLE sequence */
+  if ((EvtSet & EvtWaited) == 0U)
+  {
+    SEQ_PreIdle();
+
+    SEQ_ENTER_CRITICAL_SECTION_IDLE();
+    if (SEQ_FindTask() == SEQ_NOTASKRUNNING)
+    {
+      if ((EvtSet & EvtWaited) == 0U)
+      {
+#if (SEQ_CONF_STATS_ENABLE == 1U)
+        (void)SEQ_StatsElapsed();
+        SEQ_Idle();
+        SeqStats.idle_time += SEQ_StatsElapsed();
+#else
+        SEQ_Idle();
+#endif /* SEQ_CONF_STATS_ENABLE */
+      }
+    }
+    SEQ_EXIT_CRITICAL_SECTION_IDLE();
+
+    SEQ_PostIdle();
+  }
+}
+
+#if (SEQ_CONF_STATS_ENABLE == 1U)
+/**
+  * @brief update the total time of the statistics
+  * @retval time elapsed since the previous update
+  */
+static uint32_t SEQ_StatsElapsed(void)
+{
+  uint32_t now = SEQ_STATS_TIMESTAMP();
+  uint32_t elapsed = now - SeqStatsStamp;
+
+  SeqStatsStamp = now;
+  SeqStats.total_time += elapsed;
+
+  return elapsed;
+}
+
+/**
+  * @brief write a value in little endian
+  * @param p_dest destination
+  * @param value value to be written
+  * @param size number of bytes to be written
+  * @retval pointer after the written bytes
+  */
+static uint8_t *SEQ_StatsPut(uint8_t *p_dest, uint64_t value, uint32_t size)
+{
+  for (uint32_t index = 0U; index < size; index++)
+  {
+    p_dest[index] = (uint8_t)(value >> (8U * index));
+  }
+  return &p_dest[size];
+}
+#endif /* SEQ_CONF_STATS_ENABLE */
+
 #if defined(__CORTEX_M) && (__CORTEX_M == 0U)
 
 const uint8_t SEQ_clz_table_4bit[16U] = {4U, 3U, 2U, 2U, 1U, 1U, 1U, 1U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U};
@@ -37,6 +37,58 @@ extern "C" {
   * @{
   */
 
+/** @defgroup SEQUENCER_Exported_stats_const SEQUENCER statistics configuration
+  *  @{
+  */
+
+/**
+  * @brief enable the runtime statistics of the tasks.
+  *
+  * Disabled by default, can be set to 1 in seq_user_conf.h.
+  */
+#ifndef SEQ_CONF_STATS_ENABLE
+#define SEQ_CONF_STATS_ENABLE  (0U)
+#endif /* SEQ_CONF_STATS_ENABLE */
+
+/**
+  * @brief number of bins of the wait latency histogram of each task.
+  *
+  * The default value 32 covers all the 32 bit timestamp range, can be reduced in seq_user_conf.h.
+  */
+#ifndef SEQ_CONF_STATS_HIST_NBR
+#define SEQ_CONF_STATS_HIST_NBR  (32U)
+#endif /* SEQ_CONF_STATS_HIST_NBR */
+
+/**
+  * @brief timestamp used by the statistics, a free running 32 bit counter.
+  *
+  * The default is the DWT cycle counter of the core. It can be redefined in seq_user_conf.h,
+  * for example on a host:
+  * static inline uint32_t host_timestamp(void)
+  * {
+  *   struct timespec ts;
+  *   clock_gettime(CLOCK_MONOTONIC, &ts);
+  *   return (uint32_t)((uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec);
+  * }
+  * \#define SEQ_STATS_TIMESTAMP()       host_timestamp()
+  * \#define SEQ_STATS_INIT_TIMESTAMP( )
+  */
+#ifndef SEQ_STATS_TIMESTAMP
+#define SEQ_STATS_TIMESTAMP()       (DWT->CYCCNT)
+#endif /* SEQ_STATS_TIMESTAMP */
+
+/**
+  * @brief macro used to start the timestamp counter, called by SEQ_Init() and SEQ_StatsReset().
+  */
+#ifndef SEQ_STATS_INIT_TIMESTAMP
+#define SEQ_STATS_INIT_TIMESTAMP( ) do { CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk; \
+                                         DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk; } while(0)
+#endif /* SEQ_STATS_INIT_TIMESTAMP */
+
+/**
+  * @}
+  */
+
 /* Exported types ----------------------------------------------------------------------------------------------------*/
 /** @defgroup SEQUENCER_Exported_type SEQUENCER exported types
   *  @{
@@ -45,6 +97,7 @@ extern "C" {
   *  @brief  bit mapping of the task.
   *
   *  this value is used to represent a list of tasks (each corresponds to a task).
+  *  When more than 32 tasks are configured, a list of all the tasks is an array of SEQ_TASK_BM_NBR words.
   */
 typedef uint32_t seq_bm_t;
 
@@ -56,12 +109,14 @@ typedef uint32_t seq_bm_t;
 typedef enum
 {
   SEQ_WARNING_INVALIDTASKID,
+  SEQ_WARNING_INVALIDPRIO,
 } seq_warning_t;
 
 /**
   * @brief  sequencer Task_id definition.
   *
   * bit mapped task ID definition on 32 bits.
+  * The tasks above 31 are identified by their index with the functions SEQ_xxxTaskIdx().
   */
 typedef enum
 {
@@ -99,6 +154,32 @@ typedef enum
   SEQ_TASK_31    = (1U << 31U)
 } seq_task_id_t;
 
+#if (SEQ_CONF_STATS_ENABLE == 1U)
+/**
+  * @brief  runtime statistics of a task.
+  *
+  * Durations are expressed in ticks of SEQ_STATS_TIMESTAMP().
+  */
+typedef struct
+{
+  uint32_t run_count;                          /*!<number of executions.                                */
+  uint32_t max_runtime;                        /*!<longest execution.                                   */
+  uint64_t total_runtime;                      /*!<sum of all executions.                               */
+  uint32_t wait_hist[SEQ_CONF_STATS_HIST_NBR]; /*!<wait between SEQ_SetTask() and execution, bin n counts
+                                                   the waits in [2^(n-1), 2^n[, bin 0 the null waits and
+                                                   the last bin all the longer waits.                    */
+} seq_task_stats_t;
+
+/**
+  * @brief  runtime statistics of the sequencer.
+  */
+typedef struct
+{
+  uint64_t total_time;                         /*!<time elapsed since SEQ_Init() or SEQ_StatsReset().   */
+  uint64_t idle_time;                          /*!<time spent in SEQ_Idle().                            */
+} seq_stats_t;
+#endif /* SEQ_CONF_STATS_ENABLE */
+
 /**
   * @}
  */
@@ -112,16 +193,21 @@ typedef enum
 /**
   * @brief default number of task.
   *
-  * Default value is 32 (maximum), can be reduced by redefining it in seq_user_conf.h.
+  * Default value is 32, can be redefined in seq_user_conf.h up to 1024.
   */
 #ifndef SEQ_CONF_TASK_NBR
 #define SEQ_CONF_TASK_NBR  (32U)
 #endif /* SEQ_CONF_TASK_NBR */
 
+/**
+  * @brief number of 32 bit words of a list of all the tasks.
+  */
+#define SEQ_TASK_BM_NBR    ((SEQ_CONF_TASK_NBR + 31U) / 32U)
+
 /**
   * @brief default value of priority.
   *
-  * The default priority value is 2, can be redefined in seq_user_conf.h.
+  * The default priority value is 2, can be redefined in seq_user_conf.h up to 32.
   */
 #ifndef SEQ_CONF_PRIO_NBR
 #define SEQ_CONF_PRIO_NBR  (2U)
@@ -290,6 +376,7 @@ void SEQ_PostIdle(void);
  */
 
 void SEQ_Run(seq_bm_t mask_bm);
+void SEQ_RunMask(const seq_bm_t *mask_bm);
 
 /**
   * @}
@@ -301,6 +388,8 @@ void SEQ_Run(seq_bm_t mask_bm);
 
 void SEQ_RegTask(seq_task_id_t task_id_bm, uint32_t flags, void (*task)(void));
 uint32_t SEQ_IsRegisteredTask(seq_task_id_t task_id_bm);
+void SEQ_RegTaskIdx(uint32_t task_idx, uint32_t flags, void (*task)(void));
+uint32_t SEQ_IsRegisteredTaskIdx(uint32_t task_idx);
 
 /**
   * @}
@@ -312,6 +401,8 @@ uint32_t SEQ_IsRegisteredTask(seq_task_id_t task_id_bm);
 
 void SEQ_SetTask(seq_task_id_t task_id_bm, uint32_t task_prio);
 uint32_t SEQ_IsSchedulableTask(seq_task_id_t task_id_bm);
+void SEQ_SetTaskIdx(uint32_t task_idx, uint32_t task_prio);
+uint32_t SEQ_IsSchedulableTaskIdx(uint32_t task_idx);
 /**
   * @}
   */
@@ -323,6 +414,9 @@ uint32_t SEQ_IsSchedulableTask(seq_task_id_t task_id_bm);
 void SEQ_PauseTask(seq_task_id_t task_id_bm);
 uint32_t SEQ_IsPauseTask(seq_task_id_t task_id_bm);
 void SEQ_ResumeTask(seq_task_id_t task_id_bm);
+void SEQ_PauseTaskIdx(uint32_t task_idx);
+uint32_t SEQ_IsPauseTaskIdx(uint32_t task_idx);
+void SEQ_ResumeTaskIdx(uint32_t task_idx);
 
 /**
   * @}
@@ -353,6 +447,31 @@ void SEQ_CatchWarning(seq_warning_t warning_id);
   * @}
   */
 
+/** @defgroup SEQUENCER_Exported_function_G10 Functions shared with the timers and the message queues
+  * @{
+  */
+
+uint8_t SEQ_BitPosition(uint32_t value);
+
+/**
+  * @}
+  */
+
+#if (SEQ_CONF_STATS_ENABLE == 1U)
+/** @defgroup SEQUENCER_Exported_function_G9 Statistics functions
+  * @{
+  */
+
+void SEQ_StatsReset(void);
+void SEQ_StatsGet(seq_stats_t *p_stats);
+uint32_t SEQ_StatsGetTask(uint32_t task_idx, seq_task_stats_t *p_stats);
+uint32_t SEQ_StatsDump(uint8_t *p_buffer, uint32_t size);
+
+/**
+  * @}
+  */
+#endif /* SEQ_CONF_STATS_ENABLE */
+
 /**
   * @}
  */
@@ -43,9 +43,23 @@ extern "C" {
   */
 #define SEQ_EXIT_CRITICAL_SECTION( )       __set_PRIMASK( primask_bit )
 
+/**
+  * @brief free running 32 bit tick of the timers, required by seq_timer.c only.
+  *        HAL_GetTick() needs the HAL header to be included here.
+  */
+/* #include "stm32_hal.h" */
+/* #define SEQ_TIMER_GET_TICK( )              HAL_GetTick( ) */
+
 #define SEQ_CONF_TASK_NBR                  (32U)
 #define SEQ_CONF_PRIO_NBR                  (2U)
 
+/**
+  * @brief runtime statistics of the tasks, disabled by default.
+  *        When enabled, the default timestamp is DWT->CYCCNT so the device header must be included here.
+  */
+#define SEQ_CONF_STATS_ENABLE              (0U)
+#define SEQ_CONF_STATS_HIST_NBR            (32U)
+
 /**
   * @brief memset macro.
   */
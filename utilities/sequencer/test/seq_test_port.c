@@ -0,0 +1,77 @@
+/**
+  **********************************************************************************************************************
+  * @file    seq_test_port.c
+  * @author  MCD Application Team
+  * @brief   Host port of the sequencer for the tests
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2019-2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+
+#include "sequencer.h"
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+/* The critical section masks the interrupts on target: on host, it excludes the threads standing in for the ISRs */
+static pthread_mutex_t SEQ_TestLock = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+
+/* Number of calls between two forced preemptions, per thread */
+#define SEQ_TEST_PREEMPT_PERIOD   (61U)
+static __thread uint32_t SEQ_TestPreemptCount;
+
+/* Public variables --------------------------------------------------------------------------------------------------*/
+/* Simulated clock read by SEQ_TIMER_GET_TICK() */
+volatile uint32_t SEQ_TestTick;
+
+/* Simulated timestamp read by SEQ_STATS_TIMESTAMP() */
+volatile uint32_t SEQ_TestTimestamp;
+
+/* Functions Definition ----------------------------------------------------------------------------------------------*/
+void SEQ_TestEnterCritical(void)
+{
+  (void)pthread_mutex_lock(&SEQ_TestLock);
+}
+
+void SEQ_TestExitCritical(void)
+{
+  (void)pthread_mutex_unlock(&SEQ_TestLock);
+}
+
+static void SEQ_TestPreempt(void)
+{
+  SEQ_TestPreemptCount++;
+  if (SEQ_TestPreemptCount >= SEQ_TEST_PREEMPT_PERIOD)
+  {
+    SEQ_TestPreemptCount = 0U;
+    (void)sched_yield();
+  }
+}
+
+uint32_t SEQ_TestCas(volatile uint32_t *p_value, uint32_t expected, uint32_t desired)
+{
+  SEQ_TestPreempt();
+  return __atomic_compare_exchange_n(p_value, &expected, desired, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) ? 1U : 0U;
+}
+
+void SEQ_TestCopy(void *p_dest, const void *p_src, uint32_t size)
+{
+  uint32_t half = size / 2U;
+
+  /* preempted in the middle of the copy */
+  (void)memcpy(p_dest, p_src, half);
+  SEQ_TestPreempt();
+  (void)memcpy((uint8_t *)p_dest + half, (const uint8_t *)p_src + half, size - half);
+}
@@ -0,0 +1,85 @@
+/**
+  **********************************************************************************************************************
+  * @file    seq_user_conf.h
+  * @author  MCD Application Team
+  * @brief   Sequencer configuration file of the host tests
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2019-2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -----------------------------------------------------------------------------*/
+#ifndef SEQ_USER_CONF_H
+#define SEQ_USER_CONF_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <string.h>
+
+/* Exported macros ---------------------------------------------------------------------------------------------------*/
+/**
+  * @brief  the compiler intrinsics used by the sequencer, normally from cmsis_compiler.h.
+  */
+#define __WEAK                             __attribute__((weak))
+#define __CLZ(value)                       (((value) == 0U) ? 32U : (uint32_t)__builtin_clz(value))
+
+/**
+  * @brief  critical sections, a recursive mutex shared with the threads standing in for the ISRs.
+  */
+void SEQ_TestEnterCritical(void);
+void SEQ_TestExitCritical(void);
+#define SEQ_ENTER_CRITICAL_SECTION( )      SEQ_TestEnterCritical( )
+#define SEQ_EXIT_CRITICAL_SECTION( )       SEQ_TestExitCritical( )
+
+/**
+  * @brief  barrier and compare and swap of the message queues, normally DMB and LDREX/STREX.
+  *         The compare and swap and the copy of the messages sometimes yield, as if an ISR preempted the caller,
+  *         so that the races are exercised on a single core too.
+  */
+uint32_t SEQ_TestCas(volatile uint32_t *p_value, uint32_t expected, uint32_t desired);
+void SEQ_TestCopy(void *p_dest, const void *p_src, uint32_t size);
+#define SEQ_QUEUE_DMB( )                   __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define SEQ_QUEUE_CAS(ptr, expected, desired)  SEQ_TestCas((ptr), (expected), (desired))
+#define SEQ_MEMCPY8(dest, src, size)       SEQ_TestCopy((dest), (src), (size))
+
+/**
+  * @brief  simulated clock of the timers.
+  */
+extern volatile uint32_t SEQ_TestTick;
+#define SEQ_TIMER_GET_TICK( )              (SEQ_TestTick)
+
+/**
+  * @brief  simulated timestamp of the statistics, when the test build sets SEQ_CONF_STATS_ENABLE.
+  */
+extern volatile uint32_t SEQ_TestTimestamp;
+#define SEQ_STATS_TIMESTAMP( )             (SEQ_TestTimestamp)
+#define SEQ_STATS_INIT_TIMESTAMP( )
+
+/**
+  * @brief  number of tasks and priorities, set by the test build.
+  */
+#ifndef SEQ_CONF_TASK_NBR
+#define SEQ_CONF_TASK_NBR                  (32U)
+#endif /* SEQ_CONF_TASK_NBR */
+#ifndef SEQ_CONF_PRIO_NBR
+#define SEQ_CONF_PRIO_NBR                  (2U)
+#endif /* SEQ_CONF_PRIO_NBR */
+
+#define SEQ_MEMSET8(dest, value, size)     memset((dest),(value),(size));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*SEQ_USER_CONF_H */
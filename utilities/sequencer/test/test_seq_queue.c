@@ -0,0 +1,300 @@
+/**
+  **********************************************************************************************************************
+  * @file    test_seq_queue.c
+  * @author  MCD Application Team
+  * @brief   Host stress test of the sequencer message queues
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2019-2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/*
+  Threads stand in for the ISRs pushing the messages, the main thread runs the sequencer and the consumer task pops
+  them by batch. The threads run truly in parallel, so a push can be interrupted at any instruction by another push
+  or by a pop, which is more than the preemption of an ISR by a higher priority one.
+  Each message carries its producer, its push number and a check word, the tests verify that:
+  - every accepted message is popped exactly once, not torn, and in the push order of its producer,
+  - every rejected message is counted by SEQ_QueueGetDropped(),
+  - the consumer task is set whenever a message is pending: once the producers have stopped, a single SEQ_Run()
+    empties the queue.
+  The MPSC test also has a task producer, pushing from the sequencer context as the ISRs preempt the consumer.
+ */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sequencer.h"
+#include "seq_queue.h"
+
+/* Private defines ---------------------------------------------------------------------------------------------------*/
+#define QUEUE_DEPTH         (64U)
+#define BATCH_NBR           (8U)
+#define PUSH_NBR            (200000U)
+#define ISR_NBR             (4U)
+#define PRODUCER_NBR        (ISR_NBR + 1U)      /* the last producer is the task */
+#define TASK_PUSH_NBR       (20000U)
+
+#define CONSUMER_TASK       (1U)
+#define PRODUCER_TASK       (0U)
+
+#define CHECK(cond, ...)                                      \
+  do                                                          \
+  {                                                           \
+    if (!(cond))                                              \
+    {                                                         \
+      printf("FAIL %s:%d: ", __FILE__, __LINE__);             \
+      printf(__VA_ARGS__);                                    \
+      printf("\n");                                           \
+      Failures++;                                             \
+    }                                                         \
+  } while (0)
+
+/* Private types -----------------------------------------------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t producer;
+  uint32_t number;
+  uint32_t check[2];
+} msg_t;
+
+typedef struct
+{
+  uint32_t *p_accepted;     /* push numbers accepted by the queue, in push order */
+  uint32_t accepted_nbr;
+  uint32_t rejected_nbr;
+  uint32_t *p_popped;       /* push numbers popped by the consumer, in pop order */
+  uint32_t popped_nbr;
+} producer_t;
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+static seq_queue_t Queue;
+static msg_t Buffer[QUEUE_DEPTH];
+static uint32_t Seq[QUEUE_DEPTH];
+static producer_t Producers[PRODUCER_NBR];
+static uint32_t TaskPushNbr;
+static volatile uint32_t Started;
+static uint32_t Finished;
+static uint32_t Torn;
+static uint32_t Unknown;
+static int Failures;
+
+/* Private functions -------------------------------------------------------------------------------------------------*/
+static uint32_t CheckWord(uint32_t producer, uint32_t number, uint32_t word)
+{
+  return ((number * 0x9E3779B1U) ^ (producer << 24U)) + word;
+}
+
+static uint32_t Push(uint32_t producer, uint32_t number)
+{
+  producer_t *p_prod = &Producers[producer];
+  msg_t msg;
+
+  msg.producer = producer;
+  msg.number = number;
+  msg.check[0] = CheckWord(producer, number, 0U);
+  msg.check[1] = CheckWord(producer, number, 1U);
+
+  if (SEQ_QueuePush(&Queue, &msg) != 0U)
+  {
+    p_prod->p_accepted[p_prod->accepted_nbr] = number;
+    p_prod->accepted_nbr++;
+    return 1U;
+  }
+  p_prod->rejected_nbr++;
+  return 0U;
+}
+
+/* Bursts of pushes separated by pauses, so that the queue is in turn full, empty and in between */
+static void *IsrThread(void *p_arg)
+{
+  uint32_t producer = (uint32_t)(uintptr_t)p_arg;
+  uint32_t rand_state = 0x1234567U + producer;
+  uint32_t number = 0U;
+
+  while (Started == 0U)
+  {
+  }
+
+  while (number < PUSH_NBR)
+  {
+    uint32_t burst;
+
+    rand_state ^= rand_state << 13U;
+    rand_state ^= rand_state >> 17U;
+    rand_state ^= rand_state << 5U;
+    burst = 1U + (rand_state % (2U * QUEUE_DEPTH));
+
+    for (uint32_t i = 0U; (i < burst) && (number < PUSH_NBR); i++)
+    {
+      (void)Push(producer, number);
+      number++;
+    }
+    /* give the consumer a chance to run, on a single core too */
+    (void)sched_yield();
+    for (volatile uint32_t spin = 0U; spin < (rand_state & 0xFFFU); spin++)
+    {
+    }
+  }
+  (void)__atomic_fetch_add(&Finished, 1U, __ATOMIC_SEQ_CST);
+
+  return NULL;
+}
+
+static void ConsumerTask(void)
+{
+  msg_t msgs[BATCH_NBR];
+  uint32_t count = SEQ_QueuePop(&Queue, msgs, BATCH_NBR);
+
+  for (uint32_t i = 0U; i < count; i++)
+  {
+    producer_t *p_prod;
+
+    if (msgs[i].producer >= PRODUCER_NBR)
+    {
+      Unknown++;
+      continue;
+    }
+    if ((msgs[i].check[0] != CheckWord(msgs[i].producer, msgs[i].number, 0U))
+        || (msgs[i].check[1] != CheckWord(msgs[i].producer, msgs[i].number, 1U)))
+    {
+      Torn++;
+    }
+    p_prod = &Producers[msgs[i].producer];
+    p_prod->p_popped[p_prod->popped_nbr] = msgs[i].number;
+    p_prod->popped_nbr++;
+  }
+}
+
+/* Pushes from the sequencer context, one message per execution */
+static void ProducerTask(void)
+{
+  if (TaskPushNbr < TASK_PUSH_NBR)
+  {
+    (void)Push(ISR_NBR, TaskPushNbr);
+    TaskPushNbr++;
+    SEQ_SetTaskIdx(PRODUCER_TASK, 0U);
+  }
+}
+
+static void Run(seq_queue_mode_t mode, uint32_t isr_nbr, uint32_t task_producer)
+{
+  pthread_t threads[ISR_NBR];
+  uint32_t total_rejected = 0U;
+  uint32_t total_popped = 0U;
+  const char *p_name = (mode == SEQ_QUEUE_MPSC) ? "MPSC" : "SPSC";
+
+  SEQ_Init();
+  SEQ_RegTaskIdx(CONSUMER_TASK, SEQ_RFU, ConsumerTask);
+  SEQ_RegTaskIdx(PRODUCER_TASK, SEQ_RFU, ProducerTask);
+  CHECK(SEQ_QueueInit(&Queue, mode, Buffer, (mode == SEQ_QUEUE_MPSC) ? Seq : NULL, sizeof(msg_t), QUEUE_DEPTH,
+                      CONSUMER_TASK, 0U) == 1U, "%s init", p_name);
+  for (uint32_t p = 0U; p < PRODUCER_NBR; p++)
+  {
+    Producers[p].accepted_nbr = 0U;
+    Producers[p].rejected_nbr = 0U;
+    Producers[p].popped_nbr = 0U;
+  }
+  TaskPushNbr = (task_producer != 0U) ? 0U : TASK_PUSH_NBR;
+  Torn = 0U;
+  Unknown = 0U;
+  Started = 0U;
+  Finished = 0U;
+
+  for (uint32_t p = 0U; p < isr_nbr; p++)
+  {
+    (void)pthread_create(&threads[p], NULL, IsrThread, (void *)(uintptr_t)p);
+  }
+  if (task_producer != 0U)
+  {
+    SEQ_SetTaskIdx(PRODUCER_TASK, 0U);
+  }
+  Started = 1U;
+
+  /* the main loop of the application */
+  while (__atomic_load_n(&Finished, __ATOMIC_SEQ_CST) < isr_nbr)
+  {
+    SEQ_Run(SEQ_DEFAULT);
+  }
+  for (uint32_t p = 0U; p < isr_nbr; p++)
+  {
+    (void)pthread_join(threads[p], NULL);
+  }
+
+  /* no wakeup is lost: the last pushes have set the consumer task */
+  SEQ_Run(SEQ_DEFAULT);
+  CHECK(SEQ_QueueGetCount(&Queue) == 0U, "%s: %u messages left after the last run", p_name,
+        SEQ_QueueGetCount(&Queue));
+  CHECK(TaskPushNbr == TASK_PUSH_NBR, "%s: task producer stopped after %u pushes", p_name, TaskPushNbr);
+
+  CHECK(Torn == 0U, "%s: %u torn messages", p_name, Torn);
+  CHECK(Unknown == 0U, "%s: %u messages from an unknown producer", p_name, Unknown);
+  for (uint32_t p = 0U; p < PRODUCER_NBR; p++)
+  {
+    producer_t *p_prod = &Producers[p];
+    uint32_t errors = 0U;
+
+    CHECK(p_prod->popped_nbr == p_prod->accepted_nbr, "%s producer %u: %u accepted, %u popped", p_name, p,
+          p_prod->accepted_nbr, p_prod->popped_nbr);
+    for (uint32_t i = 0U; (i < p_prod->popped_nbr) && (i < p_prod->accepted_nbr); i++)
+    {
+      if (p_prod->p_popped[i] != p_prod->p_accepted[i])
+      {
+        errors++;
+      }
+    }
+    CHECK(errors == 0U, "%s producer %u: %u messages out of order, lost or duplicated", p_name, p, errors);
+    total_rejected += p_prod->rejected_nbr;
+    total_popped += p_prod->popped_nbr;
+  }
+  CHECK(SEQ_QueueGetDropped(&Queue) == total_rejected, "%s: %u dropped, %u rejected", p_name,
+        SEQ_QueueGetDropped(&Queue), total_rejected);
+  /* the queue must have been full sometimes, otherwise the test does not cover the drops */
+  CHECK(total_rejected != 0U, "%s: the queue was never full", p_name);
+
+  printf("%s: %u producers, %u messages popped, %u dropped\n", p_name, isr_nbr + task_producer, total_popped,
+         total_rejected);
+}
+
+/* Public functions --------------------------------------------------------------------------------------------------*/
+int main(void)
+{
+  for (uint32_t p = 0U; p < PRODUCER_NBR; p++)
+  {
+    Producers[p].p_accepted = malloc(PUSH_NBR * sizeof(uint32_t));
+    Producers[p].p_popped = malloc(PUSH_NBR * sizeof(uint32_t));
+    if ((Producers[p].p_accepted == NULL) || (Producers[p].p_popped == NULL))
+    {
+      printf("out of memory\n");
+      return 1;
+    }
+  }
+
+  Run(SEQ_QUEUE_SPSC, 1U, 0U);
+  Run(SEQ_QUEUE_MPSC, ISR_NBR, 1U);
+
+  for (uint32_t p = 0U; p < PRODUCER_NBR; p++)
+  {
+    free(Producers[p].p_accepted);
+    free(Producers[p].p_popped);
+  }
+
+  if (Failures != 0)
+  {
+    printf("%d check(s) failed\n", Failures);
+    return 1;
+  }
+  printf("all checks passed\n");
+  return 0;
+}
@@ -0,0 +1,336 @@
+/**
+  **********************************************************************************************************************
+  * @file    test_seq_stats.c
+  * @author  MCD Application Team
+  * @brief   Host tests of the runtime statistics of the sequencer with a simulated timestamp
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2019-2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/*
+  Built with SEQ_CONF_STATS_ENABLE, SEQ_STATS_TIMESTAMP() reads SEQ_TestTimestamp. The tasks and SEQ_Idle() advance
+  it by a chosen duration, the test advances it between SEQ_SetTask() and SEQ_Run(), so every statistic is known
+  exactly. The tests are:
+  - run count, total and maximum runtime, and the idle and total times,
+  - the wait histogram: null wait, bin boundaries, a wait including the runtime of a higher priority task, a task
+    set twice before it runs and a wait beyond the last bin,
+  - the record stream of SEQ_StatsDump(): header, tasks which never ran skipped, trimmed histograms and truncation
+    to complete records,
+  - SEQ_StatsReset() and an invalid task index.
+  The timestamp starts close to the 32 bit wrap so that the durations cross it.
+ */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sequencer.h"
+
+/* Private defines ---------------------------------------------------------------------------------------------------*/
+#define TASK_USED_NBR       (4U)
+#define START_STAMP         (0xFFFFFF00U)
+#define IDLE_TIME           (1000U)
+#define DUMP_SIZE           (24U + (TASK_USED_NBR * (20U + (4U * SEQ_CONF_STATS_HIST_NBR))))
+
+#define CHECK(cond, ...)                                      \
+  do                                                          \
+  {                                                           \
+    if (!(cond))                                              \
+    {                                                         \
+      printf("FAIL %s:%d: ", __FILE__, __LINE__);             \
+      printf(__VA_ARGS__);                                    \
+      printf("\n");                                           \
+      Failures++;                                             \
+    }                                                         \
+  } while (0)
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+/* Duration of the next execution of each task */
+static uint32_t RunTime[TASK_USED_NBR];
+static uint32_t IdleNbr;
+static int Failures;
+
+/* Private functions -------------------------------------------------------------------------------------------------*/
+void SEQ_Idle(void)
+{
+  IdleNbr++;
+  SEQ_TestTimestamp += IDLE_TIME;
+}
+
+static void Task0(void)
+{
+  SEQ_TestTimestamp += RunTime[0];
+}
+
+static void Task1(void)
+{
+  SEQ_TestTimestamp += RunTime[1];
+}
+
+static void Task2(void)
+{
+  SEQ_TestTimestamp += RunTime[2];
+}
+
+static void (*const TaskFunc[TASK_USED_NBR - 1U])(void) = {Task0, Task1, Task2};
+
+/* Expected histogram bin of a wait */
+static uint32_t Bin(uint32_t wait)
+{
+  uint32_t bin = 0U;
+
+  while ((bin < 32U) && ((wait >> bin) != 0U))
+  {
+    bin++;
+  }
+  return (bin < SEQ_CONF_STATS_HIST_NBR) ? bin : (SEQ_CONF_STATS_HIST_NBR - 1U);
+}
+
+/* Task 3 is registered but never runs */
+static void Reset(void)
+{
+  SEQ_TestTimestamp = START_STAMP;
+  SEQ_Init();
+  for (uint32_t i = 0U; i < TASK_USED_NBR; i++)
+  {
+    SEQ_RegTaskIdx(i, SEQ_RFU, (i < (TASK_USED_NBR - 1U)) ? TaskFunc[i] : Task0);
+    RunTime[i] = 0U;
+  }
+  IdleNbr = 0U;
+}
+
+/* Sets a task, waits, then runs the sequencer until idle */
+static void SetWaitRun(uint32_t task_idx, uint32_t wait, uint32_t runtime)
+{
+  SEQ_SetTaskIdx(task_idx, 0U);
+  SEQ_TestTimestamp += wait;
+  RunTime[task_idx] = runtime;
+  SEQ_Run(SEQ_DEFAULT);
+}
+
+static void CheckHist(const seq_task_stats_t *p_stats, const uint32_t *p_expected, uint32_t task_idx)
+{
+  for (uint32_t bin = 0U; bin < SEQ_CONF_STATS_HIST_NBR; bin++)
+  {
+    CHECK(p_stats->wait_hist[bin] == p_expected[bin], "task %u, bin %u: %u waits, expected %u", task_idx, bin,
+          p_stats->wait_hist[bin], p_expected[bin]);
+  }
+}
+
+static uint64_t Get(const uint8_t *p_src, uint32_t size)
+{
+  uint64_t value = 0U;
+
+  for (uint32_t index = 0U; index < size; index++)
+  {
+    value |= (uint64_t)p_src[index] << (8U * index);
+  }
+  return value;
+}
+
+static void TestRunTime(void)
+{
+  static const uint32_t waits[3] = {0U, 5U, 300U};
+  static const uint32_t runtimes[3] = {10U, 50U, 20U};
+  uint32_t expected[SEQ_CONF_STATS_HIST_NBR] = {0U};
+  seq_task_stats_t task_stats;
+  seq_stats_t stats;
+
+  Reset();
+  for (uint32_t i = 0U; i < 3U; i++)
+  {
+    SetWaitRun(0U, waits[i], runtimes[i]);
+    expected[Bin(waits[i])]++;
+  }
+
+  CHECK(SEQ_StatsGetTask(0U, &task_stats) == 1U, "task 0 is valid");
+  CHECK(task_stats.run_count == 3U, "run count %u", task_stats.run_count);
+  CHECK(task_stats.total_runtime == 80U, "total runtime %llu", (unsigned long long)task_stats.total_runtime);
+  CHECK(task_stats.max_runtime == 50U, "max runtime %u", task_stats.max_runtime);
+  CheckHist(&task_stats, expected, 0U);
+
+  /* 3 executions ended by idle */
+  SEQ_StatsGet(&stats);
+  CHECK(IdleNbr == 3U, "%u idle", IdleNbr);
+  CHECK(stats.idle_time == (3U * IDLE_TIME), "idle time %llu", (unsigned long long)stats.idle_time);
+  CHECK(stats.total_time == (uint32_t)(SEQ_TestTimestamp - START_STAMP), "total time %llu, elapsed %u",
+        (unsigned long long)stats.total_time, (uint32_t)(SEQ_TestTimestamp - START_STAMP));
+  CHECK(stats.total_time == (305U + 80U + (3U * IDLE_TIME)), "total time %llu",
+        (unsigned long long)stats.total_time);
+
+  /* Time since the last update is counted by SEQ_StatsGet() */
+  SEQ_TestTimestamp += 7U;
+  SEQ_StatsGet(&stats);
+  CHECK(stats.total_time == (312U + 80U + (3U * IDLE_TIME)), "total time %llu after 7 ticks",
+        (unsigned long long)stats.total_time);
+}
+
+static void TestWait(void)
+{
+  uint32_t expected[3][SEQ_CONF_STATS_HIST_NBR] = {{0U}};
+  seq_task_stats_t task_stats;
+
+  Reset();
+
+  /* Bin boundaries: bin n counts the waits in [2^(n-1), 2^n[ */
+  for (uint32_t bit = 0U; bit < 12U; bit++)
+  {
+    SetWaitRun(0U, 1UL << bit, 1U);
+    expected[0][Bin(1UL << bit)]++;
+    SetWaitRun(0U, (2UL << bit) - 1U, 1U);
+    expected[0][Bin((2UL << bit) - 1U)]++;
+  }
+  CHECK(Bin(1U) == 1U, "bin of 1");
+  CHECK(Bin(2U) == 2U, "bin of 2");
+  CHECK(Bin(3U) == 2U, "bin of 3");
+
+  /* Task 1 waits for task 0, which has a higher priority */
+  SEQ_SetTaskIdx(1U, 1U);
+  SEQ_SetTaskIdx(0U, 0U);
+  SEQ_TestTimestamp += 3U;
+  RunTime[0] = 40U;
+  RunTime[1] = 1U;
+  SEQ_Run(SEQ_DEFAULT);
+  expected[0][Bin(3U)]++;
+  expected[1][Bin(43U)]++;
+
+  /* The wait starts at the first SEQ_SetTask() */
+  SEQ_SetTaskIdx(2U, 0U);
+  SEQ_TestTimestamp += 100U;
+  SetWaitRun(2U, 1U, 1U);
+  expected[2][Bin(101U)]++;
+
+  /* Beyond the last bin */
+  SetWaitRun(2U, 0x80000000U, 1U);
+  expected[2][SEQ_CONF_STATS_HIST_NBR - 1U]++;
+
+  for (uint32_t i = 0U; i < 3U; i++)
+  {
+    (void)SEQ_StatsGetTask(i, &task_stats);
+    CheckHist(&task_stats, expected[i], i);
+  }
+  (void)SEQ_StatsGetTask(1U, &task_stats);
+  CHECK(task_stats.run_count == 1U, "task 1: run count %u", task_stats.run_count);
+  (void)SEQ_StatsGetTask(2U, &task_stats);
+  CHECK(task_stats.run_count == 2U, "task 2: run count %u", task_stats.run_count);
+}
+
+static void TestDump(void)
+{
+  static uint8_t buffer[DUMP_SIZE + 1U];
+  seq_task_stats_t task_stats;
+  seq_stats_t stats;
+  const uint8_t *p_src;
+  uint32_t size;
+  uint32_t length;
+  uint32_t last_record = 0U;
+  uint32_t bins;
+
+  Reset();
+  SetWaitRun(0U, 0U, 3U);
+  SetWaitRun(2U, 5U, 9U);
+  SetWaitRun(2U, 200U, 4U);
+  SetWaitRun(1U, 2U, 0U);
+
+  size = SEQ_StatsDump(NULL, 0U);
+  CHECK(size <= DUMP_SIZE, "dump of %u bytes", size);
+  length = SEQ_StatsDump(buffer, sizeof(buffer));
+  CHECK(length == size, "%u bytes written, %u needed", length, size);
+
+  /* Header */
+  SEQ_StatsGet(&stats);
+  CHECK((buffer[0] == 'S') && (buffer[1] == 'E') && (buffer[2] == 'Q') && (buffer[3] == 'S'), "magic");
+  CHECK(buffer[4] == 1U, "version %u", buffer[4]);
+  CHECK(buffer[5] == SEQ_CONF_STATS_HIST_NBR, "%u bins", buffer[5]);
+  CHECK(Get(&buffer[6], 2U) == SEQ_CONF_TASK_NBR, "%u tasks", (uint32_t)Get(&buffer[6], 2U));
+  CHECK(Get(&buffer[8], 8U) == stats.total_time, "total time %llu", (unsigned long long)Get(&buffer[8], 8U));
+  CHECK(Get(&buffer[16], 8U) == stats.idle_time, "idle time %llu", (unsigned long long)Get(&buffer[16], 8U));
+
+  /* Tasks 0 to 2 in order, not task 3 which never ran */
+  p_src = &buffer[24];
+  for (uint32_t i = 0U; i < 3U; i++)
+  {
+    if ((p_src + 20U) > (buffer + length))
+    {
+      CHECK(0, "record of task %u missing", i);
+      break;
+    }
+    (void)SEQ_StatsGetTask(i, &task_stats);
+    bins = SEQ_CONF_STATS_HIST_NBR;
+    while ((bins != 0U) && (task_stats.wait_hist[bins - 1U] == 0U))
+    {
+      bins--;
+    }
+    CHECK(Get(&p_src[0], 2U) == i, "record of task %u instead of %u", (uint32_t)Get(&p_src[0], 2U), i);
+    CHECK(p_src[2] == bins, "task %u: %u bins, expected %u", i, p_src[2], bins);
+    CHECK(p_src[3] == 0U, "task %u: reserved %u", i, p_src[3]);
+    CHECK(Get(&p_src[4], 4U) == task_stats.run_count, "task %u: run count", i);
+    CHECK(Get(&p_src[8], 4U) == task_stats.max_runtime, "task %u: max runtime", i);
+    CHECK(Get(&p_src[12], 8U) == task_stats.total_runtime, "task %u: total runtime", i);
+    for (uint32_t bin = 0U; bin < bins; bin++)
+    {
+      CHECK(Get(&p_src[20U + (4U * bin)], 4U) == task_stats.wait_hist[bin], "task %u: bin %u", i, bin);
+    }
+    last_record = 20U + (4U * bins);
+    p_src += last_record;
+  }
+  CHECK(p_src == (buffer + length), "%u bytes after the last record", (uint32_t)((buffer + length) - p_src));
+
+  /* Task 0 had a null wait and task 1 a wait of 2: their histograms are trimmed after bins 0 and 2 */
+  CHECK(buffer[24U + 2U] == (Bin(0U) + 1U), "task 0: %u bins", buffer[24U + 2U]);
+  CHECK(buffer[24U + 20U + (4U * (Bin(0U) + 1U)) + 2U] == (Bin(2U) + 1U), "task 1: %u bins",
+        buffer[24U + 20U + (4U * (Bin(0U) + 1U)) + 2U]);
+
+  /* Only complete records */
+  CHECK(SEQ_StatsDump(buffer, size - 1U) == (size - last_record), "truncated dump");
+  CHECK(SEQ_StatsDump(buffer, 23U) == 0U, "dump without room for the header");
+}
+
+static void TestReset(void)
+{
+  seq_task_stats_t task_stats;
+  seq_stats_t stats;
+
+  Reset();
+  SetWaitRun(0U, 10U, 10U);
+  SEQ_TestTimestamp += 50U;
+  SEQ_StatsReset();
+  SEQ_TestTimestamp += 4U;
+
+  (void)SEQ_StatsGetTask(0U, &task_stats);
+  CHECK((task_stats.run_count == 0U) && (task_stats.total_runtime == 0U) && (task_stats.max_runtime == 0U),
+        "task 0 after reset: %u runs", task_stats.run_count);
+  CHECK(task_stats.wait_hist[Bin(10U)] == 0U, "task 0 histogram after reset");
+  SEQ_StatsGet(&stats);
+  CHECK((stats.total_time == 4U) && (stats.idle_time == 0U), "total time %llu, idle time %llu after reset",
+        (unsigned long long)stats.total_time, (unsigned long long)stats.idle_time);
+  CHECK(SEQ_StatsDump(NULL, 0U) == 24U, "dump after reset");
+
+  CHECK(SEQ_StatsGetTask(SEQ_CONF_TASK_NBR, &task_stats) == 0U, "invalid task index");
+}
+
+/* Exported functions ------------------------------------------------------------------------------------------------*/
+int main(void)
+{
+  TestRunTime();
+  TestWait();
+  TestDump();
+  TestReset();
+
+  if (Failures != 0)
+  {
+    printf("%d check(s) failed\n", Failures);
+    return 1;
+  }
+  printf("all checks passed\n");
+  return 0;
+}
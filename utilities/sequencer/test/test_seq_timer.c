@@ -0,0 +1,362 @@
+/**
+  **********************************************************************************************************************
+  * @file    test_seq_timer.c
+  * @author  MCD Application Team
+  * @brief   Host tests of the sequencer timers with a simulated clock
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2019-2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/*
+  SEQ_TIMER_GET_TICK() reads SEQ_TestTick, advanced by the test. Timer i sets task i, SEQ_PreTask() records the
+  expiries. The tests are:
+  - random start, stop and clock advances on 1000 timers, compared with a model: each expiry is processed by the
+    first SEQ_TimerProcess() at or after its tick, never before, and periodic timers do not drift,
+  - a tickless drain which only advances the clock by SEQ_TimerGetNextDelay(): every timer expires exactly at its
+    tick, including delays up to 2^28 ticks, and the number of wakeups stays bounded,
+  - an event timer waited with SEQ_WaitEvt().
+  The clock starts close to the 32 bit wrap so that all the tests cross it.
+ */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sequencer.h"
+#include "seq_timer.h"
+
+/* Private defines ---------------------------------------------------------------------------------------------------*/
+#define TIMER_NBR           (1000U)
+#define OP_NBR              (200000U)
+#define MIN_PERIOD          (512U)
+#define MAX_STEP            (256U)
+
+#define CHECK(cond, ...)                                      \
+  do                                                          \
+  {                                                           \
+    if (!(cond))                                              \
+    {                                                         \
+      printf("FAIL %s:%d: ", __FILE__, __LINE__);             \
+      printf(__VA_ARGS__);                                    \
+      printf("\n");                                           \
+      Failures++;                                             \
+    }                                                         \
+  } while (0)
+
+/* Private types -----------------------------------------------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t running;
+  uint32_t expiry;
+  uint32_t period;
+} model_t;
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+static seq_timer_t Timers[TIMER_NBR];
+static model_t Model[TIMER_NBR];
+static uint32_t Fired[TIMER_NBR];
+static uint32_t FiredTick[TIMER_NBR];
+static uint32_t LastProcessed;
+static uint32_t RandState = 12345U;
+static int Failures;
+
+/* Private functions -------------------------------------------------------------------------------------------------*/
+static uint32_t Rand(void)
+{
+  RandState ^= RandState << 13U;
+  RandState ^= RandState >> 17U;
+  RandState ^= RandState << 5U;
+  return RandState;
+}
+
+void SEQ_PreTask(uint32_t task_id)
+{
+  if (task_id < TIMER_NBR)
+  {
+    Fired[task_id]++;
+    FiredTick[task_id] = SEQ_TestTick;
+  }
+}
+
+static void TimerTask(void)
+{
+}
+
+static void Reset(uint32_t tick)
+{
+  SEQ_TestTick = tick;
+  LastProcessed = tick - 1U;
+  SEQ_Init();
+  SEQ_TimerInit();
+  for (uint32_t i = 0U; i < TIMER_NBR; i++)
+  {
+    SEQ_RegTaskIdx(i, SEQ_RFU, TimerTask);
+    SEQ_TimerCreateTask(&Timers[i], i, 0U);
+    Model[i].running = 0U;
+    Fired[i] = 0U;
+  }
+}
+
+static void Start(uint32_t idx, uint32_t delay, uint32_t period)
+{
+  uint32_t expiry = SEQ_TestTick + delay;
+
+  SEQ_TimerStart(&Timers[idx], delay, period);
+
+  /* a tick already processed is handled with the next one */
+  if ((int32_t)(expiry - (LastProcessed + 1U)) < 0)
+  {
+    expiry = LastProcessed + 1U;
+  }
+  Model[idx].running = 1U;
+  Model[idx].expiry = expiry;
+  Model[idx].period = period;
+}
+
+/* Process the timers at the current tick and compare the expiries with the model */
+static uint32_t ProcessAndCheck(void)
+{
+  uint32_t now = SEQ_TestTick;
+  uint32_t errors = 0U;
+  uint32_t expired = 0U;
+
+  SEQ_TimerProcess();
+  SEQ_Run(SEQ_DEFAULT);
+  LastProcessed = now;
+
+  for (uint32_t i = 0U; i < TIMER_NBR; i++)
+  {
+    uint32_t due = ((Model[i].running != 0U) && ((int32_t)(now - Model[i].expiry) >= 0)) ? 1U : 0U;
+
+    if (Fired[i] != due)
+    {
+      if (errors < 5U)
+      {
+        printf("timer %u at tick 0x%08x: fired %u, expected %u (expiry 0x%08x)\n", i, now, Fired[i], due,
+               Model[i].expiry);
+      }
+      errors++;
+    }
+    if (due != 0U)
+    {
+      expired++;
+      if (Model[i].period != 0U)
+      {
+        Model[i].expiry += Model[i].period;
+      }
+      else
+      {
+        Model[i].running = 0U;
+      }
+    }
+    if (SEQ_TimerIsRunning(&Timers[i]) != Model[i].running)
+    {
+      errors++;
+    }
+    Fired[i] = 0U;
+  }
+  CHECK(errors == 0U, "%u timers differ from the model at tick 0x%08x", errors, now);
+
+  return expired;
+}
+
+/* Earliest expiry of the model */
+static uint32_t NextExpiry(uint32_t *p_found)
+{
+  uint32_t next = 0U;
+
+  *p_found = 0U;
+  for (uint32_t i = 0U; i < TIMER_NBR; i++)
+  {
+    if ((Model[i].running != 0U) && ((*p_found == 0U) || ((int32_t)(Model[i].expiry - next) < 0)))
+    {
+      next = Model[i].expiry;
+      *p_found = 1U;
+    }
+  }
+  return next;
+}
+
+static uint32_t RandomDelay(void)
+{
+  uint32_t r = Rand() % 100U;
+
+  if (r < 50U)
+  {
+    return Rand() % 64U;
+  }
+  if (r < 80U)
+  {
+    return 64U + (Rand() % 4032U);
+  }
+  if (r < 95U)
+  {
+    return 4096U + (Rand() % (1UL << 20U));
+  }
+  return (1UL << 20U) + (Rand() % (1UL << 28U));
+}
+
+static void TestRandom(void)
+{
+  uint32_t expired = 0U;
+  uint32_t found;
+  uint32_t next;
+  uint32_t delay;
+
+  Reset(0xFFFFFFFFU - 200000U);
+
+  for (uint32_t op = 0U; op < OP_NBR; op++)
+  {
+    uint32_t r = Rand() % 100U;
+    uint32_t idx = Rand() % TIMER_NBR;
+
+    if (r < 30U)
+    {
+      Start(idx, RandomDelay(), ((Rand() & 1U) != 0U) ? 0U : (MIN_PERIOD + (Rand() % 4500U)));
+    }
+    else if (r < 40U)
+    {
+      SEQ_TimerStop(&Timers[idx]);
+      Model[idx].running = 0U;
+    }
+    else
+    {
+      /* the next delay never goes past the earliest expiry */
+      delay = SEQ_TimerGetNextDelay();
+      next = NextExpiry(&found);
+      CHECK((found != 0U) == (delay != SEQ_TIMER_NO_DELAY), "next delay %u with %u timers", delay, found);
+      if ((found != 0U) && (delay != SEQ_TIMER_NO_DELAY))
+      {
+        CHECK((int32_t)(next - (SEQ_TestTick + delay)) >= 0, "next delay %u past the expiry 0x%08x", delay, next);
+      }
+
+      if ((r < 45U) && (delay != SEQ_TIMER_NO_DELAY))
+      {
+        /* tickless wakeup */
+        SEQ_TestTick += (delay != 0U) ? delay : 1U;
+      }
+      else
+      {
+        SEQ_TestTick += 1U + (Rand() % MAX_STEP);
+      }
+      expired += ProcessAndCheck();
+    }
+  }
+
+  CHECK(expired > (OP_NBR / 10U), "only %u expiries", expired);
+  CHECK((int32_t)(SEQ_TestTick - 0x100U) > 0, "the clock did not wrap: 0x%08x", SEQ_TestTick);
+}
+
+static void TestTicklessDrain(void)
+{
+  uint32_t bound = 0U;
+  uint32_t wakeups = 0U;
+  uint32_t expired = 0U;
+  uint32_t errors = 0U;
+  uint32_t expected[TIMER_NBR];
+  uint32_t delay;
+
+  Reset(0xFFFFFF00U);
+  for (uint32_t i = 0U; i < TIMER_NBR; i++)
+  {
+    /* log uniform delays from 1 to 2^28 */
+    uint32_t bits = 1U + (i % 28U);
+
+    delay = (1UL << (bits - 1U)) + (Rand() & ((1UL << (bits - 1U)) - 1U));
+    if (i == 0U)
+    {
+      delay = 1UL << 28U;
+    }
+    Start(i, delay, 0U);
+    expected[i] = Model[i].expiry;
+    /* one wakeup per level to cascade, plus one per turn of the last level for the delays out of the wheel */
+    bound += SEQ_TIMER_LEVEL_NBR + (delay >> (SEQ_TIMER_LEVEL_NBR * SEQ_TIMER_SLOT_BITS));
+  }
+
+  while ((delay = SEQ_TimerGetNextDelay()) != SEQ_TIMER_NO_DELAY)
+  {
+    CHECK(delay != 0U, "null delay after processing");
+    SEQ_TestTick += (delay != 0U) ? delay : 1U;
+    SEQ_TimerProcess();
+    SEQ_Run(SEQ_DEFAULT);
+    LastProcessed = SEQ_TestTick;
+    wakeups++;
+    if (wakeups > bound)
+    {
+      break;
+    }
+  }
+
+  for (uint32_t i = 0U; i < TIMER_NBR; i++)
+  {
+    expired += Fired[i];
+    if ((Fired[i] != 1U) || (FiredTick[i] != expected[i]))
+    {
+      errors++;
+    }
+  }
+  CHECK(errors == 0U, "%u timers did not expire exactly at their tick", errors);
+  CHECK(expired == TIMER_NBR, "%u expiries", expired);
+  CHECK(wakeups <= bound, "%u wakeups, bound %u", wakeups, bound);
+  printf("tickless drain: %u timers, %u wakeups\n", TIMER_NBR, wakeups);
+}
+
+/* An event timer wakes up a task waiting with SEQ_WaitEvt() */
+#define TEST_EVT   (1U << 3U)
+
+static seq_timer_t EvtTimer;
+static uint32_t WaitStart;
+static uint32_t WaitEnd;
+
+void SEQ_EvtIdle(seq_bm_t task_id_bm, seq_bm_t evt_waited_bm)
+{
+  (void)task_id_bm;
+  (void)evt_waited_bm;
+  SEQ_TestTick++;
+  SEQ_TimerProcess();
+}
+
+static void WaitingTask(void)
+{
+  WaitStart = SEQ_TestTick;
+  SEQ_TimerStart(&EvtTimer, 5U, 0U);
+  SEQ_WaitEvt(TEST_EVT);
+  WaitEnd = SEQ_TestTick;
+}
+
+static void TestEvent(void)
+{
+  Reset(0xFFFFFFFEU);
+  SEQ_TimerCreateEvt(&EvtTimer, TEST_EVT);
+  SEQ_RegTaskIdx(TIMER_NBR, SEQ_RFU, WaitingTask);
+  SEQ_SetTaskIdx(TIMER_NBR, 0U);
+  SEQ_Run(SEQ_DEFAULT);
+
+  CHECK(WaitEnd - WaitStart == 5U, "event received after %u ticks", WaitEnd - WaitStart);
+  CHECK(SEQ_TimerIsRunning(&EvtTimer) == 0U, "one shot timer still running");
+}
+
+/* Public functions --------------------------------------------------------------------------------------------------*/
+int main(void)
+{
+  TestRandom();
+  TestTicklessDrain();
+  TestEvent();
+
+  if (Failures != 0)
+  {
+    printf("%d check(s) failed\n", Failures);
+    return 1;
+  }
+  printf("all checks passed\n");
+  return 0;
+}
@@ -0,0 +1,353 @@
+/**
+  **********************************************************************************************************************
+  * @file    test_sequencer.c
+  * @author  MCD Application Team
+  * @brief   Host tests of the scheduling of the sequencer: fairness and starvation
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2019-2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/*
+  The test is built for several values of SEQ_CONF_TASK_NBR and SEQ_CONF_PRIO_NBR. Every task runs the same body,
+  SEQ_PreTask() records the dispatch order. The expected behavior is:
+  - inside a priority, the ready tasks run in round robin from the highest index to the lowest one, so a task
+    ready for the whole test runs exactly once every N dispatches, N being the number of ready tasks of its priority,
+  - a task set while the other tasks of its priority keep running waits at most one dispatch per other task,
+  - between priorities the scheduling is strict: a lower priority only runs when no higher priority task is ready,
+    it is starved as long as a higher priority keeps setting its tasks,
+  - a task set several times keeps the highest priority requested,
+  - paused or masked tasks stay pending and run once resumed or unmasked.
+ */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include <stdio.h>
+
+#include "sequencer.h"
+
+/* Private defines ---------------------------------------------------------------------------------------------------*/
+#define TRACE_NBR           (200000U)
+#define LAST_PRIO           (SEQ_CONF_PRIO_NBR - 1U)
+
+#define CHECK(cond, ...)                                      \
+  do                                                          \
+  {                                                           \
+    if (!(cond))                                              \
+    {                                                         \
+      printf("FAIL %s:%d: ", __FILE__, __LINE__);             \
+      printf(__VA_ARGS__);                                    \
+      printf("\n");                                           \
+      Failures++;                                             \
+    }                                                         \
+  } while (0)
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+static uint32_t Trace[TRACE_NBR];                /* task of each dispatch                          */
+static uint32_t TraceNbr;
+static uint32_t Budget[SEQ_CONF_TASK_NBR];       /* number of times a task sets itself again       */
+static uint32_t Prio[SEQ_CONF_TASK_NBR];         /* priority used when a task sets itself again    */
+static uint32_t CurrentTask;
+static void (*OnDispatch)(uint32_t dispatch);    /* scenario specific action at each dispatch      */
+static int Failures;
+
+/* Private functions -------------------------------------------------------------------------------------------------*/
+void SEQ_PreTask(uint32_t task_id)
+{
+  CurrentTask = task_id;
+  if (TraceNbr < TRACE_NBR)
+  {
+    Trace[TraceNbr] = task_id;
+  }
+  TraceNbr++;
+}
+
+static void TestTask(void)
+{
+  if (OnDispatch != NULL)
+  {
+    OnDispatch(TraceNbr - 1U);
+  }
+  if (Budget[CurrentTask] > 0U)
+  {
+    Budget[CurrentTask]--;
+    SEQ_SetTaskIdx(CurrentTask, Prio[CurrentTask]);
+  }
+}
+
+static void Reset(void)
+{
+  SEQ_Init();
+  for (uint32_t idx = 0U; idx < SEQ_CONF_TASK_NBR; idx++)
+  {
+    SEQ_RegTaskIdx(idx, SEQ_RFU, TestTask);
+    Budget[idx] = 0U;
+    Prio[idx] = LAST_PRIO;
+  }
+  TraceNbr = 0U;
+  OnDispatch = NULL;
+}
+
+/* Set a task which sets itself again budget times */
+static void Start(uint32_t task_idx, uint32_t prio, uint32_t budget)
+{
+  Prio[task_idx] = prio;
+  Budget[task_idx] = budget;
+  SEQ_SetTaskIdx(task_idx, prio);
+}
+
+/* Every ready task of a priority runs once per round, in decreasing index order */
+static void TestFairness(const uint32_t *p_tasks, uint32_t nbr, uint32_t prio, uint32_t rounds)
+{
+  uint32_t errors = 0U;
+
+  Reset();
+  for (uint32_t i = 0U; i < nbr; i++)
+  {
+    Start(p_tasks[i], prio, rounds - 1U);
+  }
+  SEQ_Run(SEQ_DEFAULT);
+
+  CHECK(TraceNbr == nbr * rounds, "%u tasks x %u rounds: %u dispatches", nbr, rounds, TraceNbr);
+  for (uint32_t d = 0U; (d < TraceNbr) && (d < TRACE_NBR); d++)
+  {
+    /* p_tasks is sorted by increasing index */
+    if (Trace[d] != p_tasks[nbr - 1U - (d % nbr)])
+    {
+      errors++;
+    }
+  }
+  CHECK(errors == 0U, "%u tasks at priority %u: %u dispatches out of the round robin order", nbr, prio, errors);
+}
+
+static void TestFairnessAll(void)
+{
+  static uint32_t tasks[SEQ_CONF_TASK_NBR];
+
+  for (uint32_t i = 0U; i < SEQ_CONF_TASK_NBR; i++)
+  {
+    tasks[i] = i;
+  }
+  TestFairness(tasks, SEQ_CONF_TASK_NBR, LAST_PRIO, 50U);
+  TestFairness(tasks, SEQ_CONF_TASK_NBR, 0U, 3U);
+}
+
+static void TestFairnessSparse(void)
+{
+  static const uint32_t candidates[] = { 0U, 1U, 30U, 31U, 32U, 63U, 64U, 99U, 500U, 511U, 512U, 1000U, 1023U };
+  uint32_t tasks[sizeof(candidates) / sizeof(candidates[0])];
+  uint32_t nbr = 0U;
+
+  for (uint32_t i = 0U; i < sizeof(candidates) / sizeof(candidates[0]); i++)
+  {
+    if (candidates[i] < SEQ_CONF_TASK_NBR)
+    {
+      tasks[nbr++] = candidates[i];
+    }
+  }
+  TestFairness(tasks, nbr, LAST_PRIO / 2U, 1000U);
+}
+
+/* A task set while the others of its priority keep running waits one dispatch per other ready task at most */
+static uint32_t LateTask;
+static uint32_t LateSetAt;
+
+static void SetLate(uint32_t dispatch)
+{
+  if (dispatch == LateSetAt)
+  {
+    SEQ_SetTaskIdx(LateTask, LAST_PRIO);
+  }
+}
+
+static void TestBoundedWait(void)
+{
+  uint32_t busy = (SEQ_CONF_TASK_NBR > 64U) ? 64U : (SEQ_CONF_TASK_NBR - 1U);
+  uint32_t worst = 0U;
+
+  for (LateTask = 0U; LateTask < SEQ_CONF_TASK_NBR; LateTask += (SEQ_CONF_TASK_NBR / 16U) + 1U)
+  {
+    for (LateSetAt = 0U; LateSetAt < 2U * busy; LateSetAt += 7U)
+    {
+      uint32_t ran = TRACE_NBR;
+
+      Reset();
+      /* busy tasks around the late one keep the priority saturated */
+      for (uint32_t i = 0U; i <= busy; i++)
+      {
+        uint32_t idx = (LateTask + SEQ_CONF_TASK_NBR - (busy / 2U) + i) % SEQ_CONF_TASK_NBR;
+
+        if (idx != LateTask)
+        {
+          Start(idx, LAST_PRIO, 4U * busy);
+        }
+      }
+      OnDispatch = SetLate;
+      SEQ_Run(SEQ_DEFAULT);
+
+      for (uint32_t d = LateSetAt + 1U; d < TraceNbr; d++)
+      {
+        if (Trace[d] == LateTask)
+        {
+          ran = d;
+          break;
+        }
+      }
+      CHECK(ran != TRACE_NBR, "task %u set at dispatch %u never ran", LateTask, LateSetAt);
+      if ((ran != TRACE_NBR) && ((ran - LateSetAt) > worst))
+      {
+        worst = ran - LateSetAt;
+      }
+    }
+  }
+  CHECK(worst <= busy, "late task waited %u dispatches with %u busy tasks", worst, busy);
+}
+
+/* A lower priority runs only when no higher priority task is ready */
+static void TestStarvation(void)
+{
+  uint32_t low = 0U;
+  uint32_t first_low = TRACE_NBR;
+
+  if (SEQ_CONF_PRIO_NBR < 2U)
+  {
+    return;
+  }
+
+  Reset();
+  Start(low, LAST_PRIO, 0U);
+  /* one self setting task per higher priority */
+  for (uint32_t prio = 0U; prio < LAST_PRIO; prio++)
+  {
+    Start(SEQ_CONF_TASK_NBR - 1U - prio, prio, 1000U);
+  }
+  SEQ_Run(SEQ_DEFAULT);
+
+  CHECK(TraceNbr == (LAST_PRIO * 1001U) + 1U, "%u dispatches", TraceNbr);
+  for (uint32_t d = 0U; d < TraceNbr; d++)
+  {
+    if (Trace[d] == low)
+    {
+      first_low = d;
+      break;
+    }
+  }
+  CHECK(first_low == TraceNbr - 1U, "lowest priority ran at dispatch %u of %u", first_low, TraceNbr);
+
+  /* the higher priorities run in priority order: each one drains before the next */
+  for (uint32_t d = 1U; d + 1U < TraceNbr; d++)
+  {
+    if (Prio[Trace[d]] < Prio[Trace[d - 1U]])
+    {
+      CHECK(0, "priority %u ran after priority %u at dispatch %u", Prio[Trace[d]], Prio[Trace[d - 1U]], d);
+      break;
+    }
+  }
+}
+
+/* Tasks set in reverse priority order run in priority order */
+static void TestPriorityOrder(void)
+{
+  uint32_t errors = 0U;
+
+  Reset();
+  for (uint32_t prio = SEQ_CONF_PRIO_NBR; prio > 0U; prio--)
+  {
+    Start((prio * 7U) % SEQ_CONF_TASK_NBR, prio - 1U, 0U);
+  }
+  SEQ_Run(SEQ_DEFAULT);
+
+  CHECK(TraceNbr == SEQ_CONF_PRIO_NBR, "%u dispatches", TraceNbr);
+  for (uint32_t d = 0U; d < TraceNbr; d++)
+  {
+    if (Trace[d] != (((d + 1U) * 7U) % SEQ_CONF_TASK_NBR))
+    {
+      errors++;
+    }
+  }
+  CHECK(errors == 0U, "%u tasks out of priority order", errors);
+}
+
+/* A task set several times keeps the highest priority requested */
+static void TestPriorityUpgrade(void)
+{
+  uint32_t a = 1U;
+  uint32_t b = SEQ_CONF_TASK_NBR - 1U;
+
+  if (SEQ_CONF_PRIO_NBR < 2U)
+  {
+    return;
+  }
+
+  /* b has the highest index, it would run first at the same priority */
+  Reset();
+  SEQ_SetTaskIdx(a, LAST_PRIO);
+  SEQ_SetTaskIdx(b, LAST_PRIO);
+  SEQ_SetTaskIdx(a, 0U);
+  SEQ_SetTaskIdx(a, LAST_PRIO);
+  SEQ_Run(SEQ_DEFAULT);
+
+  CHECK((TraceNbr == 2U) && (Trace[0] == a) && (Trace[1] == b), "upgraded task did not run first");
+}
+
+/* Paused and masked tasks stay pending */
+static void TestPauseAndMask(void)
+{
+  uint32_t a = SEQ_CONF_TASK_NBR - 1U;
+  uint32_t b = 0U;
+  seq_bm_t mask[SEQ_TASK_BM_NBR];
+
+  Reset();
+  SEQ_PauseTaskIdx(a);
+  SEQ_SetTaskIdx(a, 0U);
+  SEQ_SetTaskIdx(b, LAST_PRIO);
+  SEQ_Run(SEQ_DEFAULT);
+  CHECK((TraceNbr == 1U) && (Trace[0] == b), "paused task ran");
+  CHECK(SEQ_IsPauseTaskIdx(a) == 1U, "task not reported paused");
+
+  SEQ_ResumeTaskIdx(a);
+  SEQ_Run(SEQ_DEFAULT);
+  CHECK((TraceNbr == 2U) && (Trace[1] == a), "resumed task did not run");
+
+  /* mask every task but b */
+  for (uint32_t w = 0U; w < SEQ_TASK_BM_NBR; w++)
+  {
+    mask[w] = 0U;
+  }
+  mask[0] = 1U;
+  SEQ_SetTaskIdx(a, 0U);
+  SEQ_SetTaskIdx(b, LAST_PRIO);
+  SEQ_RunMask(mask);
+  CHECK((TraceNbr == 3U) && (Trace[2] == b), "masked task ran");
+  CHECK(SEQ_IsSchedulableTaskIdx(a) == 1U, "masked task no longer pending");
+
+  SEQ_Run(SEQ_DEFAULT);
+  CHECK((TraceNbr == 4U) && (Trace[3] == a), "unmasked task did not run");
+}
+
+/* Public functions --------------------------------------------------------------------------------------------------*/
+int main(void)
+{
+  TestFairnessAll();
+  TestFairnessSparse();
+  TestBoundedWait();
+  TestStarvation();
+  TestPriorityOrder();
+  TestPriorityUpgrade();
+  TestPauseAndMask();
+
+  if (Failures != 0)
+  {
+    printf("%u tasks, %u priorities: %d check(s) failed\n", SEQ_CONF_TASK_NBR, SEQ_CONF_PRIO_NBR, Failures);
+    return 1;
+  }
+  printf("%u tasks, %u priorities: all checks passed\n", SEQ_CONF_TASK_NBR, SEQ_CONF_PRIO_NBR);
+  return 0;
+}
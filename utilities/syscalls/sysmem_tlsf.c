@@ -0,0 +1,1180 @@
+/**
+  ******************************************************************************
+  * @file      sysmem_tlsf.c
+  * @brief     O(1) memory allocators: TLSF heap and fixed-size block pools
+  *
+  *            The TLSF (Two-Level Segregated Fit) heap finds a free block with
+  *            two bitmap scans, whatever the number of blocks, and merges the
+  *            freed blocks with their neighbours immediately: malloc and free
+  *            run in bounded time and the fragmentation stays low.
+  *            The fixed-size block pools serve the frequent object sizes with
+  *            a single free list operation.
+  *
+  *            malloc and free are redirected to this allocator with the
+  *            -Wl,--wrap linker option, see sysmem_tlsf.h.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes */
+#include <errno.h>
+#include <string.h>
+#include "sysmem_tlsf.h"
+
+/* Defines */
+#define ALIGN_LOG2          3U
+#define ALIGN_SIZE          (1U << ALIGN_LOG2)
+#define SL_COUNT            (1U << SYSMEM_TLSF_SL_LOG2)
+#define FL_SHIFT            (SYSMEM_TLSF_SL_LOG2 + ALIGN_LOG2)
+#define FL_COUNT            (SYSMEM_TLSF_FL_MAX - FL_SHIFT + 1U)
+#define SMALL_BLOCK_SIZE    ((size_t)1U << FL_SHIFT)
+#define BLOCK_SIZE_MAX      ((size_t)1U << SYSMEM_TLSF_FL_MAX)
+
+/* Flags stored in the low bits of the block size */
+#define BLOCK_FREE          1U
+#define BLOCK_PREV_FREE     2U
+#define BLOCK_FLAGS         (BLOCK_FREE | BLOCK_PREV_FREE)
+
+#if (SL_COUNT > 32U)
+#error "SYSMEM_TLSF_SL_LOG2 must be lower or equal to 5"
+#endif /* SL_COUNT */
+
+/**
+  * Set to 1 to initialize the TLSF heap at the first allocation, with the
+  * memory between the '_end' and '__stack - _Min_Stack_Size' linker symbols,
+  * as _sbrk() does in sysmem.c
+  */
+#ifndef SYSMEM_TLSF_AUTO_INIT
+#if defined(__arm__)
+#define SYSMEM_TLSF_AUTO_INIT   1U
+#else
+#define SYSMEM_TLSF_AUTO_INIT   0U
+#endif /* __arm__ */
+#endif /* SYSMEM_TLSF_AUTO_INIT */
+
+/**
+  * Lock of the allocator, the newlib malloc lock by default so that the
+  * RTOS hooks of newlib also protect this allocator
+  */
+#ifndef SYSMEM_LOCK
+#if defined(_NEWLIB_VERSION)
+struct _reent;
+extern struct _reent *_impure_ptr;
+void __malloc_lock(struct _reent *reent);
+void __malloc_unlock(struct _reent *reent);
+#define SYSMEM_LOCK()       __malloc_lock(_impure_ptr)
+#define SYSMEM_UNLOCK()     __malloc_unlock(_impure_ptr)
+#else
+#define SYSMEM_LOCK()
+#define SYSMEM_UNLOCK()
+#endif /* _NEWLIB_VERSION */
+#endif /* SYSMEM_LOCK */
+
+/* Types */
+
+/**
+  * Header of a block of the TLSF heap. The payload starts at next_free:
+  * the free list links are only valid in the free blocks, and prev_phys is
+  * only valid when the previous block is free.
+  */
+typedef struct sysmem_block_s
+{
+  struct sysmem_block_s *prev_phys;
+  size_t size;
+  struct sysmem_block_s *next_free;
+  struct sysmem_block_s *prev_free;
+} sysmem_block_t;
+
+#define BLOCK_OVERHEAD      (offsetof(sysmem_block_t, next_free))
+#define BLOCK_SIZE_MIN      ((sizeof(sysmem_block_t) - BLOCK_OVERHEAD + ALIGN_SIZE - 1U) & ~(size_t)(ALIGN_SIZE - 1U))
+
+/* Variables */
+
+/**
+  * TLSF heap: bitmaps of the non-empty lists and heads of the free lists
+  */
+static uint32_t tlsf_fl_bitmap = 0U;
+static uint32_t tlsf_sl_bitmap[FL_COUNT];
+static sysmem_block_t *tlsf_blocks[FL_COUNT][SL_COUNT];
+static uint32_t tlsf_initialized = 0U;
+static sysmem_stats_t tlsf_stats;
+static size_t tlsf_free_size = 0U;
+
+/**
+  * Pools used by SYSMEM_Malloc(), by increasing block size
+  */
+static sysmem_pool_t *sysmem_pools = NULL;
+
+/* Functions prototype */
+static inline uint32_t tlsf_fls(size_t size);
+static inline uint32_t tlsf_ffs(uint32_t word);
+static void tlsf_mapping_insert(size_t size, uint32_t *p_fl, uint32_t *p_sl);
+static sysmem_block_t *tlsf_search(size_t size);
+static void tlsf_insert(sysmem_block_t *p_block);
+static void tlsf_remove(sysmem_block_t *p_block);
+static void tlsf_trim(sysmem_block_t *p_block, size_t size);
+static sysmem_block_t *tlsf_merge(sysmem_block_t *p_block);
+static void tlsf_mark_used(sysmem_block_t *p_block);
+static size_t tlsf_adjust(size_t size);
+static void *tlsf_use(sysmem_block_t *p_block, size_t size);
+static void *tlsf_malloc(size_t size);
+static void *tlsf_memalign(size_t align, size_t size);
+static void tlsf_free(void *p_ptr);
+static void *tlsf_realloc(void *p_ptr, size_t size);
+static void tlsf_auto_init(void);
+static void *pool_alloc(sysmem_pool_t *p_pool);
+static void pool_free(sysmem_pool_t *p_pool, void *p_ptr);
+static sysmem_pool_t *pool_find(const void *p_ptr);
+static void *sysmem_malloc(size_t size);
+static void *sysmem_memalign(size_t align, size_t size);
+static void sysmem_free(void *p_ptr);
+
+/* Block helpers */
+#define BLOCK_SIZE(b)       ((b)->size & ~(size_t)BLOCK_FLAGS)
+#define BLOCK_PTR(b)        ((void *)((uint8_t *)(b) + BLOCK_OVERHEAD))
+#define BLOCK_FROM_PTR(p)   ((sysmem_block_t *)(void *)((uint8_t *)(p) - BLOCK_OVERHEAD))
+#define BLOCK_NEXT(b)       ((sysmem_block_t *)(void *)((uint8_t *)BLOCK_PTR(b) + BLOCK_SIZE(b)))
+
+/* Functions */
+
+/**
+  * @brief Index of the most significant bit set, size must not be 0
+  */
+static inline uint32_t tlsf_fls(size_t size)
+{
+#if (SIZE_MAX > 0xFFFFFFFFU)
+  return 63U - (uint32_t)__builtin_clzll((unsigned long long)size);
+#else
+  return 31U - (uint32_t)__builtin_clz((unsigned int)size);
+#endif /* SIZE_MAX */
+}
+
+/**
+  * @brief Index of the least significant bit set, word must not be 0
+  */
+static inline uint32_t tlsf_ffs(uint32_t word)
+{
+  return (uint32_t)__builtin_ctz(word);
+}
+
+/**
+  * @brief First and second level indexes of the list holding the blocks of a size
+  */
+static void tlsf_mapping_insert(size_t size, uint32_t *p_fl, uint32_t *p_sl)
+{
+  uint32_t fl;
+
+  if (size < SMALL_BLOCK_SIZE)
+  {
+    *p_fl = 0U;
+    *p_sl = (uint32_t)(size >> ALIGN_LOG2);
+  }
+  else
+  {
+    fl = tlsf_fls(size);
+    *p_sl = (uint32_t)(size >> (fl - SYSMEM_TLSF_SL_LOG2)) ^ SL_COUNT;
+    *p_fl = fl - (FL_SHIFT - 1U);
+  }
+}
+
+/**
+  * @brief Find and remove a free block of at least size bytes: the size is rounded up
+  *        to the next list so that any block of the list found fits.
+  */
+static sysmem_block_t *tlsf_search(size_t size)
+{
+  uint32_t fl;
+  uint32_t sl;
+  uint32_t sl_map;
+  uint32_t fl_map;
+  sysmem_block_t *p_block;
+
+  if (size >= SMALL_BLOCK_SIZE)
+  {
+    size += ((size_t)1U << (tlsf_fls(size) - SYSMEM_TLSF_SL_LOG2)) - 1U;
+  }
+  tlsf_mapping_insert(size, &fl, &sl);
+  if (fl >= FL_COUNT)
+  {
+    return NULL;
+  }
+
+  sl_map = tlsf_sl_bitmap[fl] & (~0UL << sl);
+  if (sl_map == 0U)
+  {
+    /* no block in the second level lists, take the next first level list */
+    fl_map = (fl + 1U < 32U) ? (tlsf_fl_bitmap & (~0UL << (fl + 1U))) : 0U;
+    if (fl_map == 0U)
+    {
+      return NULL;
+    }
+    fl = tlsf_ffs(fl_map);
+    sl_map = tlsf_sl_bitmap[fl];
+  }
+  sl = tlsf_ffs(sl_map);
+
+  p_block = tlsf_blocks[fl][sl];
+  tlsf_remove(p_block);
+  return p_block;
+}
+
+/**
+  * @brief Insert a free block in its list
+  */
+static void tlsf_insert(sysmem_block_t *p_block)
+{
+  uint32_t fl;
+  uint32_t sl;
+  sysmem_block_t *p_head;
+
+  tlsf_mapping_insert(BLOCK_SIZE(p_block), &fl, &sl);
+  p_head = tlsf_blocks[fl][sl];
+  p_block->next_free = p_head;
+  p_block->prev_free = NULL;
+  if (p_head != NULL)
+  {
+    p_head->prev_free = p_block;
+  }
+  tlsf_blocks[fl][sl] = p_block;
+  tlsf_fl_bitmap |= (1UL << fl);
+  tlsf_sl_bitmap[fl] |= (1UL << sl);
+  tlsf_free_size += BLOCK_SIZE(p_block);
+}
+
+/**
+  * @brief Remove a free block from its list
+  */
+static void tlsf_remove(sysmem_block_t *p_block)
+{
+  uint32_t fl;
+  uint32_t sl;
+  sysmem_block_t *p_prev = p_block->prev_free;
+  sysmem_block_t *p_next = p_block->next_free;
+
+  tlsf_mapping_insert(BLOCK_SIZE(p_block), &fl, &sl);
+  if (p_next != NULL)
+  {
+    p_next->prev_free = p_prev;
+  }
+  if (p_prev != NULL)
+  {
+    p_prev->next_free = p_next;
+  }
+  else
+  {
+    tlsf_blocks[fl][sl] = p_next;
+    if (p_next == NULL)
+    {
+      tlsf_sl_bitmap[fl] &= ~(1UL << sl);
+      if (tlsf_sl_bitmap[fl] == 0U)
+      {
+        tlsf_fl_bitmap &= ~(1UL << fl);
+      }
+    }
+  }
+  tlsf_free_size -= BLOCK_SIZE(p_block);
+}
+
+/**
+  * @brief Split a block not in a free list to size bytes, the remainder is freed
+  */
+static void tlsf_trim(sysmem_block_t *p_block, size_t size)
+{
+  sysmem_block_t *p_remain;
+  sysmem_block_t *p_next;
+
+  if (BLOCK_SIZE(p_block) >= (size + BLOCK_OVERHEAD + BLOCK_SIZE_MIN))
+  {
+    p_remain = (sysmem_block_t *)(void *)((uint8_t *)BLOCK_PTR(p_block) + size);
+    p_remain->size = (BLOCK_SIZE(p_block) - size - BLOCK_OVERHEAD) | BLOCK_FREE;
+    p_block->size = size | (p_block->size & BLOCK_FLAGS);
+    p_next = BLOCK_NEXT(p_remain);
+    p_next->prev_phys = p_remain;
+    p_next->size |= BLOCK_PREV_FREE;
+    /* the split block is not free, the remainder has a used block before it */
+    p_remain = tlsf_merge(p_remain);
+    tlsf_insert(p_remain);
+  }
+}
+
+/**
+  * @brief Merge a block being freed with its free neighbours, returns the merged block
+  */
+static sysmem_block_t *tlsf_merge(sysmem_block_t *p_block)
+{
+  sysmem_block_t *p_prev;
+  sysmem_block_t *p_next = BLOCK_NEXT(p_block);
+
+  if ((p_next->size & BLOCK_FREE) != 0U)
+  {
+    tlsf_remove(p_next);
+    p_block->size += BLOCK_SIZE(p_next) + BLOCK_OVERHEAD;
+    p_next = BLOCK_NEXT(p_block);
+    p_next->prev_phys = p_block;
+  }
+  if ((p_block->size & BLOCK_PREV_FREE) != 0U)
+  {
+    p_prev = p_block->prev_phys;
+    tlsf_remove(p_prev);
+    p_prev->size += BLOCK_SIZE(p_block) + BLOCK_OVERHEAD;
+    p_block = p_prev;
+    p_next->prev_phys = p_block;
+  }
+  return p_block;
+}
+
+/**
+  * @brief Flag a block as used, in the block and in the next one
+  */
+static void tlsf_mark_used(sysmem_block_t *p_block)
+{
+  p_block->size &= ~(size_t)BLOCK_FREE;
+  BLOCK_NEXT(p_block)->size &= ~(size_t)BLOCK_PREV_FREE;
+}
+
+/**
+  * @brief Block size of a request, 0 if too large
+  */
+static size_t tlsf_adjust(size_t size)
+{
+  size_t adjust;
+
+  if (size >= BLOCK_SIZE_MAX)
+  {
+    return 0U;
+  }
+  adjust = (size + ALIGN_SIZE - 1U) & ~(size_t)(ALIGN_SIZE - 1U);
+  return (adjust < BLOCK_SIZE_MIN) ? BLOCK_SIZE_MIN : adjust;
+}
+
+/**
+  * @brief Trim a block removed from its list to size bytes and count it as allocated
+  */
+static void *tlsf_use(sysmem_block_t *p_block, size_t size)
+{
+  tlsf_trim(p_block, size);
+  tlsf_mark_used(p_block);
+
+  tlsf_stats.alloc_count++;
+  tlsf_stats.used_size += BLOCK_SIZE(p_block);
+  if (tlsf_stats.used_size > tlsf_stats.max_used_size)
+  {
+    tlsf_stats.max_used_size = tlsf_stats.used_size;
+  }
+  return BLOCK_PTR(p_block);
+}
+
+static void *tlsf_malloc(size_t size)
+{
+  size_t adjust = tlsf_adjust(size);
+  sysmem_block_t *p_block = NULL;
+
+  tlsf_auto_init();
+  if (adjust != 0U)
+  {
+    p_block = tlsf_search(adjust);
+  }
+  if (p_block == NULL)
+  {
+    tlsf_stats.fail_count++;
+    return NULL;
+  }
+  return tlsf_use(p_block, adjust);
+}
+
+/**
+  * @brief Allocate with the payload aligned on align bytes, a power of 2
+  *
+  * The block searched has room for a free block before the aligned payload,
+  * which is given back to its list: one search as for tlsf_malloc().
+  */
+static void *tlsf_memalign(size_t align, size_t size)
+{
+  const size_t gap_min = BLOCK_OVERHEAD + BLOCK_SIZE_MIN;
+  size_t adjust = tlsf_adjust(size);
+  sysmem_block_t *p_block = NULL;
+  sysmem_block_t *p_aligned;
+  uintptr_t payload;
+  uintptr_t aligned;
+
+  if (align <= ALIGN_SIZE)
+  {
+    return tlsf_malloc(size);
+  }
+  tlsf_auto_init();
+  if ((adjust != 0U) && (align < BLOCK_SIZE_MAX) && ((adjust + align + gap_min) < BLOCK_SIZE_MAX))
+  {
+    p_block = tlsf_search(adjust + align + gap_min);
+  }
+  if (p_block == NULL)
+  {
+    tlsf_stats.fail_count++;
+    return NULL;
+  }
+
+  payload = (uintptr_t)BLOCK_PTR(p_block);
+  aligned = (payload + align - 1U) & ~(uintptr_t)(align - 1U);
+  if (aligned != payload)
+  {
+    if ((aligned - payload) < gap_min)
+    {
+      aligned = (payload + gap_min + align - 1U) & ~(uintptr_t)(align - 1U);
+    }
+    /* the block is split before the aligned payload, the first part stays free */
+    p_aligned = BLOCK_FROM_PTR((void *)aligned);
+    p_aligned->prev_phys = p_block;
+    p_aligned->size = (BLOCK_SIZE(p_block) - (size_t)(aligned - payload)) | BLOCK_PREV_FREE;
+    p_block->size = ((size_t)(aligned - payload) - BLOCK_OVERHEAD) | (p_block->size & BLOCK_FLAGS);
+    tlsf_insert(p_block);
+    p_block = p_aligned;
+  }
+  return tlsf_use(p_block, adjust);
+}
+
+static void tlsf_free(void *p_ptr)
+{
+  sysmem_block_t *p_block = BLOCK_FROM_PTR(p_ptr);
+  sysmem_block_t *p_next;
+
+  tlsf_stats.alloc_count--;
+  tlsf_stats.used_size -= BLOCK_SIZE(p_block);
+
+  p_block->size |= BLOCK_FREE;
+  p_block = tlsf_merge(p_block);
+  p_next = BLOCK_NEXT(p_block);
+  p_next->prev_phys = p_block;
+  p_next->size |= BLOCK_PREV_FREE;
+  tlsf_insert(p_block);
+}
+
+static void *tlsf_realloc(void *p_ptr, size_t size)
+{
+  sysmem_block_t *p_block = BLOCK_FROM_PTR(p_ptr);
+  sysmem_block_t *p_next = BLOCK_NEXT(p_block);
+  size_t current = BLOCK_SIZE(p_block);
+  size_t adjust = tlsf_adjust(size);
+  void *p_new;
+
+  if (adjust == 0U)
+  {
+    tlsf_stats.fail_count++;
+    return NULL;
+  }
+
+  if (adjust > current)
+  {
+    if (((p_next->size & BLOCK_FREE) == 0U) || ((current + BLOCK_SIZE(p_next) + BLOCK_OVERHEAD) < adjust))
+    {
+      /* cannot grow in place */
+      p_new = tlsf_malloc(size);
+      if (p_new != NULL)
+      {
+        (void)memcpy(p_new, p_ptr, current);
+        tlsf_free(p_ptr);
+      }
+      return p_new;
+    }
+    /* take the next free block */
+    tlsf_remove(p_next);
+    p_block->size += BLOCK_SIZE(p_next) + BLOCK_OVERHEAD;
+    tlsf_mark_used(p_block);
+  }
+
+  tlsf_trim(p_block, adjust);
+  tlsf_stats.used_size += BLOCK_SIZE(p_block);
+  tlsf_stats.used_size -= current;
+  if (tlsf_stats.used_size > tlsf_stats.max_used_size)
+  {
+    tlsf_stats.max_used_size = tlsf_stats.used_size;
+  }
+  return p_ptr;
+}
+
+/**
+  * @brief Initialize the heap with the memory left by the linker, at the first allocation
+  */
+static void tlsf_auto_init(void)
+{
+#if (SYSMEM_TLSF_AUTO_INIT == 1U)
+  extern uint8_t _end; /* Symbol defined in the linker script */
+  extern uint8_t __stack; /* Symbol defined in the linker script */
+  extern uint32_t _Min_Stack_Size; /* Symbol defined in the linker script */
+  const uint32_t stack_limit = (uint32_t)&__stack - (uint32_t)&_Min_Stack_Size;
+
+  if (tlsf_initialized == 0U)
+  {
+    (void)SYSMEM_TLSF_Init(&_end, stack_limit - (uint32_t)&_end);
+  }
+#endif /* SYSMEM_TLSF_AUTO_INIT */
+}
+
+/**
+  * @brief Initialize the TLSF heap with a memory area, the previous allocations are lost
+  *
+  * @param p_mem Memory area
+  * @param size Size of the memory area in bytes, at most 2^SYSMEM_TLSF_FL_MAX is used
+  * @return 0 on success, -1 if the area is too small
+  */
+int SYSMEM_TLSF_Init(void *p_mem, size_t size)
+{
+  uintptr_t start = (uintptr_t)p_mem;
+  uintptr_t end = start + size;
+  size_t block_size;
+  sysmem_block_t *p_block;
+  sysmem_block_t *p_sentinel;
+
+  /* the payload of the blocks is aligned */
+  start = ((start + BLOCK_OVERHEAD + ALIGN_SIZE - 1U) & ~(uintptr_t)(ALIGN_SIZE - 1U)) - BLOCK_OVERHEAD;
+  end &= ~(uintptr_t)(ALIGN_SIZE - 1U);
+  if ((end <= start) || ((end - start) < (2U * BLOCK_OVERHEAD + BLOCK_SIZE_MIN)))
+  {
+    return -1;
+  }
+  block_size = (size_t)(end - start) - (2U * BLOCK_OVERHEAD);
+  if (block_size >= BLOCK_SIZE_MAX)
+  {
+    block_size = BLOCK_SIZE_MAX - ALIGN_SIZE;
+  }
+
+  SYSMEM_LOCK();
+  tlsf_fl_bitmap = 0U;
+  (void)memset(tlsf_sl_bitmap, 0, sizeof(tlsf_sl_bitmap));
+  (void)memset(tlsf_blocks, 0, sizeof(tlsf_blocks));
+  (void)memset(&tlsf_stats, 0, sizeof(tlsf_stats));
+  tlsf_free_size = 0U;
+
+  /* one free block, followed by an empty used block which stops the merges */
+  p_block = (sysmem_block_t *)start;
+  p_block->size = block_size | BLOCK_FREE;
+  p_sentinel = BLOCK_NEXT(p_block);
+  p_sentinel->prev_phys = p_block;
+  p_sentinel->size = BLOCK_PREV_FREE;
+  tlsf_insert(p_block);
+
+  tlsf_stats.total_size = block_size;
+  tlsf_initialized = 1U;
+  SYSMEM_UNLOCK();
+
+  return 0;
+}
+
+/**
+  * @brief Allocate from the TLSF heap
+  *
+  * @param size Size in bytes
+  * @return Pointer aligned on 8 bytes, NULL if no block is large enough
+  */
+void *SYSMEM_TLSF_Malloc(size_t size)
+{
+  void *p_ptr;
+
+  SYSMEM_LOCK();
+  p_ptr = tlsf_malloc(size);
+  SYSMEM_UNLOCK();
+  return p_ptr;
+}
+
+/**
+  * @brief Free a memory allocated from the TLSF heap
+  *
+  * @param p_ptr Pointer returned by SYSMEM_TLSF_Malloc(), SYSMEM_TLSF_Memalign() or SYSMEM_TLSF_Realloc(), or NULL
+  */
+void SYSMEM_TLSF_Free(void *p_ptr)
+{
+  if (p_ptr != NULL)
+  {
+    SYSMEM_LOCK();
+    tlsf_free(p_ptr);
+    SYSMEM_UNLOCK();
+  }
+}
+
+/**
+  * @brief Allocate from the TLSF heap with an alignment
+  *
+  * @param align Alignment in bytes, a power of 2
+  * @param size Size in bytes
+  * @return Pointer aligned on align bytes, NULL if align is not a power of 2 or no block is large enough
+  */
+void *SYSMEM_TLSF_Memalign(size_t align, size_t size)
+{
+  void *p_ptr = NULL;
+
+  if ((align != 0U) && ((align & (align - 1U)) == 0U))
+  {
+    SYSMEM_LOCK();
+    p_ptr = tlsf_memalign(align, size);
+    SYSMEM_UNLOCK();
+  }
+  return p_ptr;
+}
+
+/**
+  * @brief Resize a memory allocated from the TLSF heap, in place when possible
+  *
+  * @param p_ptr Pointer returned by SYSMEM_TLSF_Malloc() or SYSMEM_TLSF_Realloc(), or NULL
+  * @param size New size in bytes
+  * @return Pointer to the memory, NULL if no block is large enough (p_ptr is then unchanged)
+  */
+void *SYSMEM_TLSF_Realloc(void *p_ptr, size_t size)
+{
+  void *p_new;
+
+  if (p_ptr == NULL)
+  {
+    return SYSMEM_TLSF_Malloc(size);
+  }
+  SYSMEM_LOCK();
+  p_new = tlsf_realloc(p_ptr, size);
+  SYSMEM_UNLOCK();
+  return p_new;
+}
+
+/**
+  * @brief Usable size of a memory allocated from the TLSF heap
+  */
+size_t SYSMEM_TLSF_GetSize(const void *p_ptr)
+{
+  return (p_ptr != NULL) ? BLOCK_SIZE(BLOCK_FROM_PTR(p_ptr)) : 0U;
+}
+
+/**
+  * @brief Statistics of the TLSF heap
+  *
+  * The largest free block is searched in the highest non-empty list, the
+  * duration depends on the number of blocks of that list.
+  */
+void SYSMEM_TLSF_GetStats(sysmem_stats_t *p_stats)
+{
+  uint32_t fl;
+  uint32_t sl;
+  const sysmem_block_t *p_block;
+  size_t largest = 0U;
+
+  SYSMEM_LOCK();
+  *p_stats = tlsf_stats;
+  if (tlsf_fl_bitmap != 0U)
+  {
+    fl = 31U - (uint32_t)__builtin_clz(tlsf_fl_bitmap);
+    sl = 31U - (uint32_t)__builtin_clz(tlsf_sl_bitmap[fl]);
+    for (p_block = tlsf_blocks[fl][sl]; p_block != NULL; p_block = p_block->next_free)
+    {
+      if (BLOCK_SIZE(p_block) > largest)
+      {
+        largest = BLOCK_SIZE(p_block);
+      }
+    }
+  }
+  p_stats->largest_free_size = largest;
+  p_stats->fragmentation = (tlsf_free_size != 0U)
+                           ? (uint32_t)(1000U - (uint32_t)(((uint64_t)largest * 1000U) / tlsf_free_size)) : 0U;
+  SYSMEM_UNLOCK();
+}
+
+static void *pool_alloc(sysmem_pool_t *p_pool)
+{
+  void *p_ptr = p_pool->p_free;
+
+  if (p_ptr == NULL)
+  {
+    p_pool->fail_count++;
+    return NULL;
+  }
+  p_pool->p_free = *(void **)p_ptr;
+  p_pool->used_nbr++;
+  if (p_pool->used_nbr > p_pool->max_used_nbr)
+  {
+    p_pool->max_used_nbr = p_pool->used_nbr;
+  }
+  return p_ptr;
+}
+
+static void pool_free(sysmem_pool_t *p_pool, void *p_ptr)
+{
+  *(void **)p_ptr = p_pool->p_free;
+  p_pool->p_free = p_ptr;
+  p_pool->used_nbr--;
+}
+
+/**
+  * @brief Registered pool holding a pointer, NULL if none
+  */
+static sysmem_pool_t *pool_find(const void *p_ptr)
+{
+  sysmem_pool_t *p_pool;
+
+  for (p_pool = sysmem_pools; p_pool != NULL; p_pool = p_pool->p_next)
+  {
+    if (((const uint8_t *)p_ptr >= p_pool->p_start) && ((const uint8_t *)p_ptr < p_pool->p_end))
+    {
+      break;
+    }
+  }
+  return p_pool;
+}
+
+/**
+  * @brief Initialize a pool of fixed-size blocks
+  *
+  * @param p_pool Pool
+  * @param p_mem Memory of the blocks, block_nbr * block_size bytes aligned on 8 bytes
+  * @param block_size Size of a block, rounded up to a multiple of 8
+  * @param block_nbr Number of blocks
+  * @return 0 on success, -1 if the memory is not aligned
+  */
+int SYSMEM_PoolInit(sysmem_pool_t *p_pool, void *p_mem, size_t block_size, uint32_t block_nbr)
+{
+  uint8_t *p_block = (uint8_t *)p_mem;
+  uint32_t i;
+
+  if (((uintptr_t)p_mem & (ALIGN_SIZE - 1U)) != 0U)
+  {
+    return -1;
+  }
+  block_size = (block_size + ALIGN_SIZE - 1U) & ~(size_t)(ALIGN_SIZE - 1U);
+  if (block_size < sizeof(void *))
+  {
+    block_size = ALIGN_SIZE;
+  }
+
+  p_pool->p_free = (block_nbr != 0U) ? p_mem : NULL;
+  for (i = 1U; i < block_nbr; i++)
+  {
+    *(void **)p_block = p_block + block_size;
+    p_block += block_size;
+  }
+  if (block_nbr != 0U)
+  {
+    *(void **)p_block = NULL;
+  }
+  p_pool->p_start = (uint8_t *)p_mem;
+  p_pool->p_end = (uint8_t *)p_mem + (block_size * block_nbr);
+  p_pool->block_size = block_size;
+  p_pool->block_nbr = block_nbr;
+  p_pool->used_nbr = 0U;
+  p_pool->max_used_nbr = 0U;
+  p_pool->fail_count = 0U;
+  p_pool->p_next = NULL;
+  return 0;
+}
+
+/**
+  * @brief Allocate a block of a pool
+  *
+  * @return Pointer to the block, NULL if the pool is exhausted
+  */
+void *SYSMEM_PoolAlloc(sysmem_pool_t *p_pool)
+{
+  void *p_ptr;
+
+  SYSMEM_LOCK();
+  p_ptr = pool_alloc(p_pool);
+  SYSMEM_UNLOCK();
+  return p_ptr;
+}
+
+/**
+  * @brief Free a block of a pool
+  */
+void SYSMEM_PoolFree(sysmem_pool_t *p_pool, void *p_ptr)
+{
+  if (p_ptr != NULL)
+  {
+    SYSMEM_LOCK();
+    pool_free(p_pool, p_ptr);
+    SYSMEM_UNLOCK();
+  }
+}
+
+/**
+  * @brief Use a pool for the allocations of SYSMEM_Malloc(), and of malloc() when it is wrapped
+  *
+  * An allocation is served by the pool with the smallest block size large enough,
+  * or by the TLSF heap when that pool is exhausted.
+  *
+  * @return 0 on success, -1 if the pool is already registered
+  */
+int SYSMEM_PoolRegister(sysmem_pool_t *p_pool)
+{
+  sysmem_pool_t **pp_link;
+  int res = 0;
+
+  SYSMEM_LOCK();
+  for (pp_link = &sysmem_pools; *pp_link != NULL; pp_link = &(*pp_link)->p_next)
+  {
+    if (*pp_link == p_pool)
+    {
+      res = -1;
+      break;
+    }
+    if ((*pp_link)->block_size > p_pool->block_size)
+    {
+      break;
+    }
+  }
+  if (res == 0)
+  {
+    p_pool->p_next = *pp_link;
+    *pp_link = p_pool;
+  }
+  SYSMEM_UNLOCK();
+  return res;
+}
+
+/**
+  * @brief Statistics of a pool, there is no external fragmentation in a pool
+  */
+void SYSMEM_PoolGetStats(const sysmem_pool_t *p_pool, sysmem_stats_t *p_stats)
+{
+  p_stats->total_size = p_pool->block_size * p_pool->block_nbr;
+  p_stats->used_size = p_pool->block_size * p_pool->used_nbr;
+  p_stats->max_used_size = p_pool->block_size * p_pool->max_used_nbr;
+  p_stats->largest_free_size = (p_pool->p_free != NULL) ? p_pool->block_size : 0U;
+  p_stats->alloc_count = p_pool->used_nbr;
+  p_stats->fail_count = p_pool->fail_count;
+  p_stats->fragmentation = 0U;
+}
+
+static void *sysmem_malloc(size_t size)
+{
+  sysmem_pool_t *p_pool;
+  void *p_ptr;
+
+  for (p_pool = sysmem_pools; p_pool != NULL; p_pool = p_pool->p_next)
+  {
+    if (size <= p_pool->block_size)
+    {
+      p_ptr = pool_alloc(p_pool);
+      if (p_ptr != NULL)
+      {
+        return p_ptr;
+      }
+      break;
+    }
+  }
+  return tlsf_malloc(size);
+}
+
+/**
+  * @brief The pool blocks are aligned on 8 bytes, the larger alignments are served by the TLSF heap
+  */
+static void *sysmem_memalign(size_t align, size_t size)
+{
+  if ((align == 0U) || ((align & (align - 1U)) != 0U))
+  {
+    return NULL;
+  }
+  return (align <= ALIGN_SIZE) ? sysmem_malloc(size) : tlsf_memalign(align, size);
+}
+
+static void sysmem_free(void *p_ptr)
+{
+  sysmem_pool_t *p_pool = pool_find(p_ptr);
+
+  if (p_pool != NULL)
+  {
+    pool_free(p_pool, p_ptr);
+  }
+  else
+  {
+    tlsf_free(p_ptr);
+  }
+}
+
+/**
+  * @brief Allocate from the registered pools, then from the TLSF heap
+  *
+  * @param size Size in bytes
+  * @return Pointer aligned on 8 bytes, NULL and errno set to ENOMEM on failure
+  */
+void *SYSMEM_Malloc(size_t size)
+{
+  void *p_ptr;
+
+  SYSMEM_LOCK();
+  p_ptr = sysmem_malloc(size);
+  SYSMEM_UNLOCK();
+  if (p_ptr == NULL)
+  {
+    errno = ENOMEM;
+  }
+  return p_ptr;
+}
+
+/**
+  * @brief Allocate with an alignment, from the registered pools when 8 bytes are enough, else from the TLSF heap
+  *
+  * @param align Alignment in bytes, a power of 2
+  * @param size Size in bytes
+  * @return Pointer aligned on align bytes, NULL and errno set to EINVAL or ENOMEM on failure
+  */
+void *SYSMEM_Memalign(size_t align, size_t size)
+{
+  void *p_ptr;
+
+  if ((align == 0U) || ((align & (align - 1U)) != 0U))
+  {
+    errno = EINVAL;
+    return NULL;
+  }
+  SYSMEM_LOCK();
+  p_ptr = sysmem_memalign(align, size);
+  SYSMEM_UNLOCK();
+  if (p_ptr == NULL)
+  {
+    errno = ENOMEM;
+  }
+  return p_ptr;
+}
+
+/**
+  * @brief Free a memory allocated by SYSMEM_Malloc(), SYSMEM_Memalign(), SYSMEM_Realloc() or SYSMEM_Calloc()
+  */
+void SYSMEM_Free(void *p_ptr)
+{
+  if (p_ptr != NULL)
+  {
+    SYSMEM_LOCK();
+    sysmem_free(p_ptr);
+    SYSMEM_UNLOCK();
+  }
+}
+
+/**
+  * @brief Resize a memory allocated by SYSMEM_Malloc(), SYSMEM_Realloc() or SYSMEM_Calloc()
+  *
+  * @return Pointer to the memory, NULL and errno set to ENOMEM on failure (p_ptr is then unchanged)
+  */
+void *SYSMEM_Realloc(void *p_ptr, size_t size)
+{
+  sysmem_pool_t *p_pool;
+  void *p_new;
+
+  if (p_ptr == NULL)
+  {
+    return SYSMEM_Malloc(size);
+  }
+  if (size == 0U)
+  {
+    SYSMEM_Free(p_ptr);
+    return NULL;
+  }
+
+  SYSMEM_LOCK();
+  p_pool = pool_find(p_ptr);
+  if (p_pool == NULL)
+  {
+    p_new = tlsf_realloc(p_ptr, size);
+  }
+  else if (size <= p_pool->block_size)
+  {
+    p_new = p_ptr;
+  }
+  else
+  {
+    p_new = sysmem_malloc(size);
+    if (p_new != NULL)
+    {
+      (void)memcpy(p_new, p_ptr, p_pool->block_size);
+      pool_free(p_pool, p_ptr);
+    }
+  }
+  SYSMEM_UNLOCK();
+  if (p_new == NULL)
+  {
+    errno = ENOMEM;
+  }
+  return p_new;
+}
+
+/**
+  * @brief Usable size of a memory allocated by SYSMEM_Malloc(), SYSMEM_Memalign(), SYSMEM_Realloc() or
+  *        SYSMEM_Calloc(): the pool block size or the TLSF block size, 0 for NULL
+  */
+size_t SYSMEM_GetSize(const void *p_ptr)
+{
+  const sysmem_pool_t *p_pool;
+  size_t size = 0U;
+
+  if (p_ptr != NULL)
+  {
+    SYSMEM_LOCK();
+    p_pool = pool_find(p_ptr);
+    size = (p_pool != NULL) ? p_pool->block_size : BLOCK_SIZE(BLOCK_FROM_PTR(p_ptr));
+    SYSMEM_UNLOCK();
+  }
+  return size;
+}
+
+/**
+  * @brief Allocate and clear an array
+  *
+  * @return Pointer to the memory, NULL and errno set to ENOMEM on failure
+  */
+void *SYSMEM_Calloc(size_t nmemb, size_t size)
+{
+  void *p_ptr;
+
+  if ((size != 0U) && (nmemb > (SIZE_MAX / size)))
+  {
+    errno = ENOMEM;
+    return NULL;
+  }
+  p_ptr = SYSMEM_Malloc(nmemb * size);
+  if (p_ptr != NULL)
+  {
+    (void)memset(p_ptr, 0, nmemb * size);
+  }
+  return p_ptr;
+}
+
+#if (SYSMEM_TLSF_WRAP == 1U)
+struct _reent;
+
+/* functions prototype */
+void *__wrap_malloc(size_t size);
+void __wrap_free(void *ptr);
+void *__wrap_realloc(void *ptr, size_t size);
+void *__wrap_calloc(size_t nmemb, size_t size);
+void *__wrap__malloc_r(struct _reent *reent, size_t size);
+void __wrap__free_r(struct _reent *reent, void *ptr);
+void *__wrap__realloc_r(struct _reent *reent, void *ptr, size_t size);
+void *__wrap__calloc_r(struct _reent *reent, size_t nmemb, size_t size);
+void *__wrap_memalign(size_t align, size_t size);
+void *__wrap__memalign_r(struct _reent *reent, size_t align, size_t size);
+void *__wrap_aligned_alloc(size_t align, size_t size);
+int __wrap_posix_memalign(void **pp_ptr, size_t align, size_t size);
+void *__wrap_valloc(size_t size);
+void *__wrap__valloc_r(struct _reent *reent, size_t size);
+void *__wrap_pvalloc(size_t size);
+void *__wrap__pvalloc_r(struct _reent *reent, size_t size);
+size_t __wrap_malloc_usable_size(void *ptr);
+size_t __wrap__malloc_usable_size_r(struct _reent *reent, void *ptr);
+
+void *__wrap_malloc(size_t size)
+{
+  return SYSMEM_Malloc(size);
+}
+
+void __wrap_free(void *ptr)
+{
+  SYSMEM_Free(ptr);
+}
+
+void *__wrap_realloc(void *ptr, size_t size)
+{
+  return SYSMEM_Realloc(ptr, size);
+}
+
+void *__wrap_calloc(size_t nmemb, size_t size)
+{
+  return SYSMEM_Calloc(nmemb, size);
+}
+
+void *__wrap__malloc_r(struct _reent *reent, size_t size)
+{
+  (void)reent;
+  return SYSMEM_Malloc(size);
+}
+
+void __wrap__free_r(struct _reent *reent, void *ptr)
+{
+  (void)reent;
+  SYSMEM_Free(ptr);
+}
+
+void *__wrap__realloc_r(struct _reent *reent, void *ptr, size_t size)
+{
+  (void)reent;
+  return SYSMEM_Realloc(ptr, size);
+}
+
+void *__wrap__calloc_r(struct _reent *reent, size_t nmemb, size_t size)
+{
+  (void)reent;
+  return SYSMEM_Calloc(nmemb, size);
+}
+void *__wrap_memalign(size_t align, size_t size)
+{
+  return SYSMEM_Memalign(align, size);
+}
+
+void *__wrap__memalign_r(struct _reent *reent, size_t align, size_t size)
+{
+  (void)reent;
+  return SYSMEM_Memalign(align, size);
+}
+
+void *__wrap_aligned_alloc(size_t align, size_t size)
+{
+  return SYSMEM_Memalign(align, size);
+}
+
+int __wrap_posix_memalign(void **pp_ptr, size_t align, size_t size)
+{
+  void *p_ptr;
+
+  if ((align == 0U) || ((align % sizeof(void *)) != 0U) || ((align & (align - 1U)) != 0U))
+  {
+    return EINVAL;
+  }
+  SYSMEM_LOCK();
+  p_ptr = sysmem_memalign(align, size);
+  SYSMEM_UNLOCK();
+  if (p_ptr == NULL)
+  {
+    return ENOMEM;
+  }
+  *pp_ptr = p_ptr;
+  return 0;
+}
+
+/* valloc and pvalloc align on the page size of newlib malloc */
+void *__wrap_valloc(size_t size)
+{
+  return SYSMEM_Memalign(SYSMEM_TLSF_PAGE_SIZE, size);
+}
+
+void *__wrap__valloc_r(struct _reent *reent, size_t size)
+{
+  (void)reent;
+  return SYSMEM_Memalign(SYSMEM_TLSF_PAGE_SIZE, size);
+}
+
+void *__wrap_pvalloc(size_t size)
+{
+  if (size > (SIZE_MAX - SYSMEM_TLSF_PAGE_SIZE))
+  {
+    errno = ENOMEM;
+    return NULL;
+  }
+  return SYSMEM_Memalign(SYSMEM_TLSF_PAGE_SIZE,
+                         (size + SYSMEM_TLSF_PAGE_SIZE - 1U) & ~(size_t)(SYSMEM_TLSF_PAGE_SIZE - 1U));
+}
+
+void *__wrap__pvalloc_r(struct _reent *reent, size_t size)
+{
+  (void)reent;
+  return __wrap_pvalloc(size);
+}
+
+size_t __wrap_malloc_usable_size(void *ptr)
+{
+  return SYSMEM_GetSize(ptr);
+}
+
+size_t __wrap__malloc_usable_size_r(struct _reent *reent, void *ptr)
+{
+  (void)reent;
+  return SYSMEM_GetSize(ptr);
+}
+#endif /* SYSMEM_TLSF_WRAP */
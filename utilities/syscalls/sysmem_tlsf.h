@@ -0,0 +1,123 @@
+/**
+  ******************************************************************************
+  * @file      sysmem_tlsf.h
+  * @brief     O(1) memory allocators: TLSF heap and fixed-size block pools
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef SYSMEM_TLSF_H
+#define SYSMEM_TLSF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes */
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+  * log2 of the number of second level lists per power of 2: the size classes
+  * are 1/16th of a power of 2 apart with the default 4.
+  */
+#ifndef SYSMEM_TLSF_SL_LOG2
+#define SYSMEM_TLSF_SL_LOG2       4U
+#endif /* SYSMEM_TLSF_SL_LOG2 */
+
+/**
+  * log2 of the largest block of the TLSF heap, 16 Mbytes with the default 24.
+  */
+#ifndef SYSMEM_TLSF_FL_MAX
+#define SYSMEM_TLSF_FL_MAX        24U
+#endif /* SYSMEM_TLSF_FL_MAX */
+
+/**
+  * Set to 1 to define the __wrap_ functions replacing the newlib allocator, when
+  * linking with -Wl,--wrap=<function> for each of them:
+  * malloc, free, realloc, calloc, memalign, aligned_alloc, posix_memalign, valloc,
+  * pvalloc, malloc_usable_size, and the reentrant variants _malloc_r, _free_r,
+  * _realloc_r, _calloc_r, _memalign_r, _valloc_r, _pvalloc_r, _malloc_usable_size_r.
+  * All of them are needed: a block of the newlib allocator freed into the TLSF heap
+  * corrupts it.
+  */
+#ifndef SYSMEM_TLSF_WRAP
+#define SYSMEM_TLSF_WRAP          1U
+#endif /* SYSMEM_TLSF_WRAP */
+
+/**
+  * Alignment of valloc() and pvalloc(), the page size of newlib malloc
+  */
+#ifndef SYSMEM_TLSF_PAGE_SIZE
+#define SYSMEM_TLSF_PAGE_SIZE     4096U
+#endif /* SYSMEM_TLSF_PAGE_SIZE */
+
+/**
+  * Fixed-size block pool, allocated by the application.
+  * The fields are private to the allocator, use SYSMEM_PoolGetStats().
+  */
+typedef struct sysmem_pool_s
+{
+  void *p_free;                /* first free block                   */
+  uint8_t *p_start;            /* first block                        */
+  uint8_t *p_end;              /* end of the last block              */
+  size_t block_size;           /* size of a block in bytes           */
+  uint32_t block_nbr;          /* number of blocks                   */
+  uint32_t used_nbr;           /* number of blocks allocated         */
+  uint32_t max_used_nbr;       /* high-water mark of used_nbr        */
+  uint32_t fail_count;         /* allocations failed, pool exhausted */
+  struct sysmem_pool_s *p_next; /* next registered pool, by size      */
+} sysmem_pool_t;
+
+/**
+  * Statistics of a pool or of the TLSF heap.
+  */
+typedef struct
+{
+  size_t total_size;           /* bytes available to the allocations                          */
+  size_t used_size;            /* bytes allocated                                             */
+  size_t max_used_size;        /* high-water mark of used_size                                */
+  size_t largest_free_size;    /* largest allocation which can succeed                        */
+  uint32_t alloc_count;        /* number of allocations alive                                 */
+  uint32_t fail_count;         /* number of allocations failed                                */
+  uint32_t fragmentation;      /* per mille of the free memory outside of the largest block   */
+} sysmem_stats_t;
+
+/* TLSF heap */
+int SYSMEM_TLSF_Init(void *p_mem, size_t size);
+void *SYSMEM_TLSF_Malloc(size_t size);
+void *SYSMEM_TLSF_Memalign(size_t align, size_t size);
+void SYSMEM_TLSF_Free(void *p_ptr);
+void *SYSMEM_TLSF_Realloc(void *p_ptr, size_t size);
+size_t SYSMEM_TLSF_GetSize(const void *p_ptr);
+void SYSMEM_TLSF_GetStats(sysmem_stats_t *p_stats);
+
+/* Fixed-size block pools */
+int SYSMEM_PoolInit(sysmem_pool_t *p_pool, void *p_mem, size_t block_size, uint32_t block_nbr);
+void *SYSMEM_PoolAlloc(sysmem_pool_t *p_pool);
+void SYSMEM_PoolFree(sysmem_pool_t *p_pool, void *p_ptr);
+int SYSMEM_PoolRegister(sysmem_pool_t *p_pool);
+void SYSMEM_PoolGetStats(const sysmem_pool_t *p_pool, sysmem_stats_t *p_stats);
+
+/* Allocation from the registered pools, then from the TLSF heap */
+void *SYSMEM_Malloc(size_t size);
+void *SYSMEM_Memalign(size_t align, size_t size);
+void SYSMEM_Free(void *p_ptr);
+void *SYSMEM_Realloc(void *p_ptr, size_t size);
+void *SYSMEM_Calloc(size_t nmemb, size_t size);
+size_t SYSMEM_GetSize(const void *p_ptr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SYSMEM_TLSF_H */
@@ -0,0 +1,206 @@
+/**
+  ******************************************************************************
+  * @file      bench_sysmem_tlsf.c
+  * @brief     Host benchmark of the latency of the TLSF heap against malloc
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+  The same random sequence of allocations of 16 to 4096 bytes and of frees, on 4096 slots, runs on the TLSF heap
+  (SYSMEM_Malloc(), SYSMEM_Free()) and on the malloc of the host libc, which stands in for the newlib malloc: both
+  derive from dlmalloc, newlib not being available on the host.
+  Each call is timed with the cycle counter of the host (the monotonic clock in ns elsewhere), the benchmark prints
+  the median, the 99th and 99.9th percentiles and the maximum per allocator and per function. The maximum includes
+  the preemptions of the host: the 99.9th percentile is the worst case which can be compared.
+  The contents of the allocations are checked, and the TLSF heap must be one free block again at the end.
+ */
+
+/* Includes */
+#define _POSIX_C_SOURCE 200809L
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif /* __x86_64__ */
+#include "sysmem_tlsf.h"
+
+/* Defines */
+#define HEAP_SIZE           (16U * 1024U * 1024U)
+#define SLOT_NBR            (4096U)
+#define OP_NBR              (1000000U)
+#define WARMUP_NBR          (SLOT_NBR * 4U)
+#define SIZE_MIN_LOG2       (4U)
+#define SIZE_MAX_LOG2       (12U)
+
+#define CHECK(cond, ...)                                      \
+  do                                                          \
+  {                                                           \
+    if (!(cond))                                              \
+    {                                                         \
+      printf("FAIL %s:%d: ", __FILE__, __LINE__);             \
+      printf(__VA_ARGS__);                                    \
+      printf("\n");                                           \
+      Failures++;                                             \
+    }                                                         \
+  } while (0)
+
+/* Types */
+typedef struct
+{
+  const char *p_name;
+  void *(*p_malloc)(size_t size);
+  void (*p_free)(void *p_ptr);
+} allocator_t;
+
+typedef struct
+{
+  uint8_t *p_ptr;
+  size_t size;
+} slot_t;
+
+/* Variables */
+static uint64_t Heap[HEAP_SIZE / sizeof(uint64_t)];
+static slot_t Slots[SLOT_NBR];
+static uint32_t MallocTicks[OP_NBR];
+static uint32_t FreeTicks[OP_NBR];
+static uint32_t Seed;
+static int Failures;
+
+/* Functions */
+static uint32_t Rand(void)
+{
+  Seed = (Seed * 1103515245U) + 12345U;
+  return Seed >> 8U;
+}
+
+static inline uint64_t Ticks(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  struct timespec now;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &now);
+  return ((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec;
+#endif /* __x86_64__ */
+}
+
+static int CompareTicks(const void *p_a, const void *p_b)
+{
+  const uint32_t a = *(const uint32_t *)p_a;
+  const uint32_t b = *(const uint32_t *)p_b;
+
+  return (a > b) - (a < b);
+}
+
+static void Report(const char *p_name, const char *p_function, uint32_t *p_ticks, uint32_t nbr)
+{
+  qsort(p_ticks, nbr, sizeof(p_ticks[0]), CompareTicks);
+  printf("%-6s %-6s %7u calls: median %6u, p99 %6u, p99.9 %6u, max %8u ticks\n", p_name, p_function,
+         (unsigned int)nbr, (unsigned int)p_ticks[nbr / 2U], (unsigned int)p_ticks[(nbr * 99U) / 100U],
+         (unsigned int)p_ticks[(nbr * 999U) / 1000U], (unsigned int)p_ticks[nbr - 1U]);
+}
+
+static void Run(const allocator_t *p_alloc)
+{
+  uint32_t malloc_nbr = 0U;
+  uint32_t free_nbr = 0U;
+
+  /* the same sequence for every allocator */
+  Seed = 45U;
+  for (uint32_t op = 0U; op < (WARMUP_NBR + OP_NBR); op++)
+  {
+    slot_t *p_slot = &Slots[Rand() % SLOT_NBR];
+    const uint8_t fill = (uint8_t)(p_slot - Slots);
+    uint64_t start;
+    uint32_t ticks;
+
+    if (p_slot->p_ptr != NULL)
+    {
+      CHECK((p_slot->p_ptr[0] == fill) && (p_slot->p_ptr[p_slot->size - 1U] == fill), "%s: operation %u: contents lost",
+            p_alloc->p_name, (unsigned int)op);
+      start = Ticks();
+      p_alloc->p_free(p_slot->p_ptr);
+      ticks = (uint32_t)(Ticks() - start);
+      p_slot->p_ptr = NULL;
+      if ((op >= WARMUP_NBR) && (free_nbr < OP_NBR))
+      {
+        FreeTicks[free_nbr] = ticks;
+        free_nbr++;
+      }
+    }
+    else
+    {
+      const uint32_t log2 = SIZE_MIN_LOG2 + (Rand() % (SIZE_MAX_LOG2 - SIZE_MIN_LOG2));
+      const size_t size = ((size_t)1U << log2) + (Rand() & (((uint32_t)1U << log2) - 1U));
+
+      start = Ticks();
+      p_slot->p_ptr = p_alloc->p_malloc(size);
+      ticks = (uint32_t)(Ticks() - start);
+      CHECK(p_slot->p_ptr != NULL, "%s: operation %u: %u bytes not allocated", p_alloc->p_name, (unsigned int)op,
+            (unsigned int)size);
+      if (p_slot->p_ptr != NULL)
+      {
+        p_slot->size = size;
+        p_slot->p_ptr[0] = fill;
+        p_slot->p_ptr[size - 1U] = fill;
+      }
+      if ((op >= WARMUP_NBR) && (malloc_nbr < OP_NBR))
+      {
+        MallocTicks[malloc_nbr] = ticks;
+        malloc_nbr++;
+      }
+    }
+  }
+  for (uint32_t i = 0U; i < SLOT_NBR; i++)
+  {
+    p_alloc->p_free(Slots[i].p_ptr);
+    Slots[i].p_ptr = NULL;
+  }
+
+  Report(p_alloc->p_name, "malloc", MallocTicks, malloc_nbr);
+  Report(p_alloc->p_name, "free", FreeTicks, free_nbr);
+}
+
+int main(void)
+{
+  static const allocator_t allocators[] =
+  {
+    {"TLSF", SYSMEM_Malloc, SYSMEM_Free},
+    {"libc", malloc, free},
+  };
+  sysmem_stats_t stats;
+
+  CHECK(SYSMEM_TLSF_Init(Heap, sizeof(Heap)) == 0, "SYSMEM_TLSF_Init");
+  for (uint32_t i = 0U; i < (sizeof(allocators) / sizeof(allocators[0])); i++)
+  {
+    Run(&allocators[i]);
+  }
+
+  SYSMEM_TLSF_GetStats(&stats);
+  printf("TLSF heap: %u bytes used at most, %u failed allocations\n", (unsigned int)stats.max_used_size,
+         (unsigned int)stats.fail_count);
+  CHECK((stats.alloc_count == 0U) && (stats.largest_free_size == stats.total_size),
+        "TLSF heap not merged: %u allocation(s), largest free block of %u bytes", (unsigned int)stats.alloc_count,
+        (unsigned int)stats.largest_free_size);
+
+  if (Failures != 0)
+  {
+    printf("%d check(s) failed\n", Failures);
+    return 1;
+  }
+  printf("all checks passed\n");
+  return 0;
+}
@@ -0,0 +1,263 @@
+/**
+  ******************************************************************************
+  * @file      test_sysmem_tlsf.c
+  * @brief     Host test of the allocator family redirected to the TLSF heap
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+  The program is linked with the -Wl,--wrap options of the component, so its calls of malloc, memalign,
+  aligned_alloc, posix_memalign, valloc, pvalloc, malloc_usable_size, realloc and free reach sysmem_tlsf.c:
+  - each function returns memory of the heap area, aligned as requested, with a usable size large enough,
+  - posix_memalign refuses the alignments which are not a power of 2 multiple of sizeof(void *),
+  - the alignments of 8 bytes at most are served by the registered pool, the larger ones by the TLSF heap,
+  - random allocations, aligned or not, reallocations and frees keep the contents, and once all freed the heap is
+    one free block again: the blocks split before an aligned payload are merged back.
+ */
+
+/* Includes */
+#define _GNU_SOURCE
+#include <errno.h>
+#include <malloc.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sysmem_tlsf.h"
+
+/* Defines */
+#define HEAP_SIZE           (1024U * 1024U)
+#define SLOT_NBR            (512U)
+#define OP_NBR              (200000U)
+#define SIZE_MAX_LOG2       (12U)
+#define POOL_BLOCK_SIZE     (32U)
+#define POOL_BLOCK_NBR      (16U)
+
+#define CHECK(cond, ...)                                      \
+  do                                                          \
+  {                                                           \
+    if (!(cond))                                              \
+    {                                                         \
+      printf("FAIL %s:%d: ", __FILE__, __LINE__);             \
+      printf(__VA_ARGS__);                                    \
+      printf("\n");                                           \
+      Failures++;                                             \
+    }                                                         \
+  } while (0)
+
+/* Types */
+typedef struct
+{
+  uint8_t *p_ptr;
+  size_t size;
+  uint8_t fill;
+} slot_t;
+
+/* Variables */
+static uint64_t Heap[HEAP_SIZE / sizeof(uint64_t)];
+static uint64_t PoolMem[(POOL_BLOCK_SIZE * POOL_BLOCK_NBR) / sizeof(uint64_t)];
+static sysmem_pool_t Pool;
+static slot_t Slots[SLOT_NBR];
+static uint32_t Seed = 45U;
+static int Failures;
+
+/* Functions */
+static uint32_t Rand(void)
+{
+  Seed = (Seed * 1103515245U) + 12345U;
+  return Seed >> 8U;
+}
+
+static int InHeap(const void *p_ptr, size_t size)
+{
+  const uint8_t *p_start = (const uint8_t *)Heap;
+
+  return ((const uint8_t *)p_ptr >= p_start) && (((const uint8_t *)p_ptr + size) <= (p_start + sizeof(Heap)));
+}
+
+static int Aligned(const void *p_ptr, size_t align)
+{
+  return ((uintptr_t)p_ptr & (align - 1U)) == 0U;
+}
+
+/* Every allocation freed: one block holding the whole heap */
+static void CheckMerged(const char *p_step)
+{
+  sysmem_stats_t stats;
+
+  SYSMEM_TLSF_GetStats(&stats);
+  CHECK((stats.alloc_count == 0U) && (stats.used_size == 0U), "%s: %u allocation(s) of %u bytes left", p_step,
+        (unsigned int)stats.alloc_count, (unsigned int)stats.used_size);
+  CHECK(stats.largest_free_size == stats.total_size, "%s: largest free block of %u bytes out of %u", p_step,
+        (unsigned int)stats.largest_free_size, (unsigned int)stats.total_size);
+}
+
+static void TestFamily(void)
+{
+  static const size_t aligns[] = {8U, 16U, 64U, 256U, 4096U};
+  void *p_ptr = NULL;
+  void *p_malloc;
+  void *p_valloc;
+  void *p_pvalloc;
+
+  p_malloc = malloc(100U);
+  CHECK(InHeap(p_malloc, 100U) && Aligned(p_malloc, 8U), "malloc: %p", p_malloc);
+  CHECK(malloc_usable_size(p_malloc) >= 100U, "malloc_usable_size: %u", (unsigned int)malloc_usable_size(p_malloc));
+
+  for (uint32_t i = 0U; i < (sizeof(aligns) / sizeof(aligns[0])); i++)
+  {
+    void *p_memalign = memalign(aligns[i], 100U);
+    void *p_aligned = aligned_alloc(aligns[i], 2U * aligns[i]);
+    int res = posix_memalign(&p_ptr, aligns[i], 1000U);
+
+    CHECK(InHeap(p_memalign, 100U) && Aligned(p_memalign, aligns[i]), "memalign(%u): %p", (unsigned int)aligns[i],
+          p_memalign);
+    CHECK(malloc_usable_size(p_memalign) >= 100U, "memalign(%u): usable size %u", (unsigned int)aligns[i],
+          (unsigned int)malloc_usable_size(p_memalign));
+    CHECK(InHeap(p_aligned, 2U * aligns[i]) && Aligned(p_aligned, aligns[i]), "aligned_alloc(%u): %p",
+          (unsigned int)aligns[i], p_aligned);
+    CHECK((res == 0) && InHeap(p_ptr, 1000U) && Aligned(p_ptr, aligns[i]), "posix_memalign(%u): %d, %p",
+          (unsigned int)aligns[i], res, p_ptr);
+    (void)memset(p_memalign, 0xA5, 100U);
+    (void)memset(p_aligned, 0x5A, 2U * aligns[i]);
+    (void)memset(p_ptr, 0x3C, 1000U);
+    free(p_memalign);
+    free(p_aligned);
+    free(p_ptr);
+  }
+
+  p_ptr = p_malloc;
+  CHECK(posix_memalign(&p_ptr, 12U, 16U) == EINVAL, "posix_memalign accepts 12 bytes");
+  CHECK(posix_memalign(&p_ptr, 0U, 16U) == EINVAL, "posix_memalign accepts 0 byte");
+  CHECK(posix_memalign(&p_ptr, 4U, 16U) == EINVAL, "posix_memalign accepts 4 bytes");
+  CHECK(p_ptr == p_malloc, "posix_memalign changed the pointer on error");
+  errno = 0;
+  CHECK((memalign(24U, 16U) == NULL) && (errno == EINVAL), "memalign accepts 24 bytes");
+
+  p_valloc = valloc(10U);
+  p_pvalloc = pvalloc(5000U);
+  CHECK(InHeap(p_valloc, 10U) && Aligned(p_valloc, SYSMEM_TLSF_PAGE_SIZE), "valloc: %p", p_valloc);
+  CHECK(InHeap(p_pvalloc, 8192U) && Aligned(p_pvalloc, SYSMEM_TLSF_PAGE_SIZE)
+        && (malloc_usable_size(p_pvalloc) >= 8192U), "pvalloc: %p, usable size %u", p_pvalloc,
+        (unsigned int)malloc_usable_size(p_pvalloc));
+  free(p_valloc);
+  free(p_pvalloc);
+  free(p_malloc);
+  CHECK(malloc_usable_size(NULL) == 0U, "malloc_usable_size(NULL)");
+
+  CheckMerged("allocator family");
+}
+
+static void TestPool(void)
+{
+  void *p_small;
+  void *p_large;
+
+  CHECK(SYSMEM_PoolInit(&Pool, PoolMem, POOL_BLOCK_SIZE, POOL_BLOCK_NBR) == 0, "SYSMEM_PoolInit");
+  CHECK(SYSMEM_PoolRegister(&Pool) == 0, "SYSMEM_PoolRegister");
+
+  /* 8 bytes are the alignment of the pool blocks */
+  p_small = memalign(8U, 16U);
+  p_large = memalign(64U, 16U);
+  CHECK(((uint8_t *)p_small >= (uint8_t *)PoolMem) && ((uint8_t *)p_small < ((uint8_t *)PoolMem + sizeof(PoolMem))),
+        "memalign(8) not served by the pool: %p", p_small);
+  CHECK(malloc_usable_size(p_small) == POOL_BLOCK_SIZE, "usable size of a pool block: %u",
+        (unsigned int)malloc_usable_size(p_small));
+  CHECK(InHeap(p_large, 16U) && Aligned(p_large, 64U), "memalign(64): %p", p_large);
+  free(p_small);
+  free(p_large);
+  CHECK(Pool.used_nbr == 0U, "%u pool block(s) left", (unsigned int)Pool.used_nbr);
+
+  CheckMerged("pool");
+}
+
+static void TestRandom(void)
+{
+  for (uint32_t op = 0U; op < OP_NBR; op++)
+  {
+    slot_t *p_slot = &Slots[Rand() % SLOT_NBR];
+    const uint32_t action = Rand() % 4U;
+
+    if (p_slot->p_ptr != NULL)
+    {
+      size_t i;
+
+      for (i = 0U; (i < p_slot->size) && (p_slot->p_ptr[i] == p_slot->fill); i++)
+      {
+      }
+      CHECK(i == p_slot->size, "operation %u: byte %u of %u overwritten", (unsigned int)op, (unsigned int)i,
+            (unsigned int)p_slot->size);
+    }
+
+    if ((p_slot->p_ptr != NULL) && (action == 0U))
+    {
+      /* the contents are kept up to the smaller size */
+      const size_t size = ((size_t)1U << (Rand() % SIZE_MAX_LOG2)) + (Rand() % 64U);
+      uint8_t *p_new = realloc(p_slot->p_ptr, size);
+
+      if (p_new != NULL)
+      {
+        if (size > p_slot->size)
+        {
+          (void)memset(&p_new[p_slot->size], p_slot->fill, size - p_slot->size);
+        }
+        p_slot->p_ptr = p_new;
+        p_slot->size = size;
+      }
+    }
+    else if (p_slot->p_ptr != NULL)
+    {
+      free(p_slot->p_ptr);
+      p_slot->p_ptr = NULL;
+    }
+    else
+    {
+      const size_t size = ((size_t)1U << (Rand() % SIZE_MAX_LOG2)) + (Rand() % 64U);
+      const size_t align = (size_t)8U << (Rand() % 8U);
+
+      p_slot->p_ptr = (action < 2U) ? malloc(size) : memalign(align, size);
+      if (p_slot->p_ptr != NULL)
+      {
+        CHECK(Aligned(p_slot->p_ptr, (action < 2U) ? 8U : align), "operation %u: %p not aligned on %u",
+              (unsigned int)op, (void *)p_slot->p_ptr, (unsigned int)align);
+        p_slot->size = size;
+        p_slot->fill = (uint8_t)Rand();
+        (void)memset(p_slot->p_ptr, p_slot->fill, size);
+      }
+    }
+  }
+
+  for (uint32_t i = 0U; i < SLOT_NBR; i++)
+  {
+    free(Slots[i].p_ptr);
+    Slots[i].p_ptr = NULL;
+  }
+  CheckMerged("random");
+}
+
+int main(void)
+{
+  CHECK(SYSMEM_TLSF_Init(Heap, sizeof(Heap)) == 0, "SYSMEM_TLSF_Init");
+
+  TestFamily();
+  TestRandom();
+  TestPool();
+
+  if (Failures != 0)
+  {
+    printf("%d check(s) failed\n", Failures);
+    return 1;
+  }
+  printf("all checks passed\n");
+  return 0;
+}